@@ -0,0 +1,261 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/.git/HEAD"
+  "/root/repo/.git/refs/heads/master"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "/root/repo/cmake/CheckCCompilerFlagStackSmashing.cmake"
+  "/root/repo/cmake/CheckCXXCompilerFlagStackSmashing.cmake"
+  "/root/repo/cmake/CompileOptions.cmake"
+  "/root/repo/cmake/Custom.cmake"
+  "/root/repo/cmake/FindClangFormat.cmake"
+  "/root/repo/cmake/GetGitRevisionDescription.cmake"
+  "/root/repo/cmake/GetGitRevisionDescription.cmake.in"
+  "/root/repo/cmake/Portability.cmake"
+  "/root/repo/cmake/ProfileGuidedOptimization.cmake"
+  "/root/repo/cmake/RuntimeDependencies.cmake"
+  "/root/repo/cmake/SecurityFlags.cmake"
+  "/root/repo/cmake/Warnings.cmake"
+  "/root/repo/deploy/CMakeLists.txt"
+  "/root/repo/deploy/packages/pack-metacall.cmake"
+  "/root/repo/docs/CMakeLists.txt"
+  "/root/repo/metacall-config-version.cmake.in"
+  "/root/repo/metacall-config.cmake.in"
+  "/root/repo/source/CMakeLists.txt"
+  "/root/repo/source/adt/CMakeLists.txt"
+  "/root/repo/source/benchmarks/CMakeLists.txt"
+  "/root/repo/source/cli/CMakeLists.txt"
+  "/root/repo/source/configuration/CMakeLists.txt"
+  "/root/repo/source/detour/CMakeLists.txt"
+  "/root/repo/source/detours/CMakeLists.txt"
+  "/root/repo/source/dynlink/CMakeLists.txt"
+  "/root/repo/source/dynlink/include/dynlink/dynlink_interface.h.in"
+  "/root/repo/source/dynlink/source/dynlink_interface.c.in"
+  "/root/repo/source/environment/CMakeLists.txt"
+  "/root/repo/source/examples/CMakeLists.txt"
+  "/root/repo/source/filesystem/CMakeLists.txt"
+  "/root/repo/source/format/CMakeLists.txt"
+  "/root/repo/source/loader/CMakeLists.txt"
+  "/root/repo/source/loaders/CMakeLists.txt"
+  "/root/repo/source/loaders/loaders.h.in"
+  "/root/repo/source/log/CMakeLists.txt"
+  "/root/repo/source/memory/CMakeLists.txt"
+  "/root/repo/source/metacall/CMakeLists.txt"
+  "/root/repo/source/metacall/metacall_def.h.in"
+  "/root/repo/source/portability/CMakeLists.txt"
+  "/root/repo/source/ports/CMakeLists.txt"
+  "/root/repo/source/preprocessor/CMakeLists.txt"
+  "/root/repo/source/preprocessor/cmake/preprocessor_arguments.cmake"
+  "/root/repo/source/preprocessor/cmake/preprocessor_arithmetic.cmake"
+  "/root/repo/source/preprocessor/cmake/preprocessor_boolean.cmake"
+  "/root/repo/source/preprocessor/cmake/preprocessor_for.cmake"
+  "/root/repo/source/preprocessor/cmake/preprocessor_template.cmake"
+  "/root/repo/source/reflect/CMakeLists.txt"
+  "/root/repo/source/scripts/CMakeLists.txt"
+  "/root/repo/source/serial/CMakeLists.txt"
+  "/root/repo/source/serials/CMakeLists.txt"
+  "/root/repo/source/tests/CMakeLists.txt"
+  "/root/repo/source/threading/CMakeLists.txt"
+  "/root/repo/source/version/CMakeLists.txt"
+  "/root/repo/source/version/include/version/version.h.in"
+  "/root/repo/source/version/source/version.c.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeConfigurableFile.in"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-CXX-FeatureTests.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-CXX-FeatureTests.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-CXX-TestableFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-FeatureTests.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-CXX-FeatureTests.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteCompilerDetectionHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/exportheader.cmake.in"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/git-data/HEAD"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "CMakeFiles/git-data/head-ref"
+  "metacall-config.cmake"
+  "metacall-config-version.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/include/metacall/metacall_loaders.h"
+  "source/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/include/metacall/metacall_version.h"
+  "source/metacall/source/metacall_version.c"
+  "source/version/include/version/version_features.h"
+  "source/version/include/version/version_api.h"
+  "source/version/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/preprocessor/include/preprocessor/preprocessor_features.h"
+  "source/preprocessor/include/preprocessor/preprocessor_api.h"
+  "source/preprocessor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/environment/include/environment/environment_features.h"
+  "source/environment/include/environment/environment_api.h"
+  "source/environment/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/format/include/format/format_features.h"
+  "source/format/include/format/format_api.h"
+  "source/format/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/log/include/log/log_features.h"
+  "source/log/include/log/log_api.h"
+  "source/log/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/memory/include/memory/memory_features.h"
+  "source/memory/include/memory/memory_api.h"
+  "source/memory/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/portability/include/portability/portability_features.h"
+  "source/portability/include/portability/portability_api.h"
+  "source/portability/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/threading/include/threading/threading_features.h"
+  "source/threading/include/threading/threading_api.h"
+  "source/threading/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/adt/include/adt/adt_features.h"
+  "source/adt/include/adt/adt_api.h"
+  "source/adt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/filesystem/include/filesystem/filesystem_features.h"
+  "source/filesystem/include/filesystem/filesystem_api.h"
+  "source/filesystem/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/dynlink/include/dynlink/dynlink_interface.h"
+  "source/dynlink/source/dynlink_interface.c"
+  "source/dynlink/include/dynlink/dynlink_features.h"
+  "source/dynlink/include/dynlink/dynlink_api.h"
+  "source/dynlink/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/detour/include/detour/detour_features.h"
+  "source/detour/include/detour/detour_api.h"
+  "source/detour/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/reflect/include/reflect/reflect_features.h"
+  "source/reflect/include/reflect/reflect_api.h"
+  "source/reflect/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/serial/include/serial/serial_features.h"
+  "source/serial/include/serial/serial_api.h"
+  "source/serial/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/configuration/include/configuration/configuration_features.h"
+  "source/configuration/include/configuration/configuration_api.h"
+  "source/configuration/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loader/include/loader/loader_features.h"
+  "source/loader/include/loader/loader_api.h"
+  "source/loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/metacall/include/metacall/metacall_def.h"
+  "source/metacall/include/metacall/metacall_features.h"
+  "source/metacall/include/metacall/metacall_api.h"
+  "source/metacall/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/cli/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/serials/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/detours/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/ports/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "CPackConfig-MetaCall.cmake"
+  "CPackSourceConfig.cmake"
+  "deploy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/pgo.dir/DependInfo.cmake"
+  "source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  "source/preprocessor/CMakeFiles/preprocessor.dir/DependInfo.cmake"
+  "source/environment/CMakeFiles/environment.dir/DependInfo.cmake"
+  "source/format/CMakeFiles/format.dir/DependInfo.cmake"
+  "source/log/CMakeFiles/log.dir/DependInfo.cmake"
+  "source/memory/CMakeFiles/memory.dir/DependInfo.cmake"
+  "source/portability/CMakeFiles/portability.dir/DependInfo.cmake"
+  "source/threading/CMakeFiles/threading.dir/DependInfo.cmake"
+  "source/adt/CMakeFiles/adt.dir/DependInfo.cmake"
+  "source/filesystem/CMakeFiles/filesystem.dir/DependInfo.cmake"
+  "source/dynlink/CMakeFiles/dynlink.dir/DependInfo.cmake"
+  "source/detour/CMakeFiles/detour.dir/DependInfo.cmake"
+  "source/reflect/CMakeFiles/reflect.dir/DependInfo.cmake"
+  "source/serial/CMakeFiles/serial.dir/DependInfo.cmake"
+  "source/configuration/CMakeFiles/configuration.dir/DependInfo.cmake"
+  "source/loader/CMakeFiles/loader.dir/DependInfo.cmake"
+  "source/metacall/CMakeFiles/metacall.dir/DependInfo.cmake"
+  "deploy/CMakeFiles/pack.dir/DependInfo.cmake"
+  "deploy/CMakeFiles/pack-metacall.dir/DependInfo.cmake"
+  "deploy/CMakeFiles/component_install.dir/DependInfo.cmake"
+  "deploy/CMakeFiles/component_uninstall.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,86 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS MetaCall::configuration)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Create imported target MetaCall::configuration
+add_library(MetaCall::configuration OBJECT IMPORTED)
+
+set_target_properties(MetaCall::configuration PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "\$<\$<NOT:\$<BOOL:ON>>:CONFIGURATION_STATIC_DEFINE>;LOG_POLICY_FORMAT_PRETTY=1;SYSTEM_LINUX;NDEBUG"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/source/configuration/include;/root/repo/_gate_build/source/configuration/include"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:MetaCall::version>;\$<LINK_ONLY:MetaCall::preprocessor>;\$<LINK_ONLY:MetaCall::environment>;\$<LINK_ONLY:MetaCall::format>;\$<LINK_ONLY:MetaCall::threading>;\$<LINK_ONLY:MetaCall::log>;\$<LINK_ONLY:MetaCall::memory>;\$<LINK_ONLY:MetaCall::portability>;\$<LINK_ONLY:MetaCall::adt>;\$<LINK_ONLY:MetaCall::reflect>;\$<LINK_ONLY:MetaCall::dynlink>;\$<LINK_ONLY:MetaCall::serial>;-pthread"
+)
+
+# Import target "MetaCall::configuration" for configuration "Release"
+set_property(TARGET MetaCall::configuration APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(MetaCall::configuration PROPERTIES
+  IMPORTED_COMMON_LANGUAGE_RUNTIME_RELEASE ""
+  IMPORTED_OBJECTS_RELEASE "/root/repo/_gate_build/source/configuration/CMakeFiles/configuration.dir/source/configuration.c.o;/root/repo/_gate_build/source/configuration/CMakeFiles/configuration.dir/source/configuration_singleton.c.o;/root/repo/_gate_build/source/configuration/CMakeFiles/configuration.dir/source/configuration_object.c.o;/root/repo/_gate_build/source/configuration/CMakeFiles/configuration.dir/source/configuration_impl.c.o;/root/repo/_gate_build/source/configuration/CMakeFiles/configuration.dir/source/configuration_blob.c.o"
+  )
+
+# Make sure the targets which have been exported in some other
+# export set exist.
+unset(${CMAKE_FIND_PACKAGE_NAME}_NOT_FOUND_MESSAGE_targets)
+foreach(_target "MetaCall::version" "MetaCall::preprocessor" "MetaCall::environment" "MetaCall::format" "MetaCall::threading" "MetaCall::log" "MetaCall::memory" "MetaCall::portability" "MetaCall::adt" "MetaCall::reflect" "MetaCall::dynlink" "MetaCall::serial" )
+  if(NOT TARGET "${_target}" )
+    set(${CMAKE_FIND_PACKAGE_NAME}_NOT_FOUND_MESSAGE_targets "${${CMAKE_FIND_PACKAGE_NAME}_NOT_FOUND_MESSAGE_targets} ${_target}")
+  endif()
+endforeach()
+
+if(DEFINED ${CMAKE_FIND_PACKAGE_NAME}_NOT_FOUND_MESSAGE_targets)
+  if(CMAKE_FIND_PACKAGE_NAME)
+    set( ${CMAKE_FIND_PACKAGE_NAME}_FOUND FALSE)
+    set( ${CMAKE_FIND_PACKAGE_NAME}_NOT_FOUND_MESSAGE "The following imported targets are referenced, but are missing: ${${CMAKE_FIND_PACKAGE_NAME}_NOT_FOUND_MESSAGE_targets}")
+  else()
+    message(FATAL_ERROR "The following imported targets are referenced, but are missing: ${${CMAKE_FIND_PACKAGE_NAME}_NOT_FOUND_MESSAGE_targets}")
+  endif()
+endif()
+unset(${CMAKE_FIND_PACKAGE_NAME}_NOT_FOUND_MESSAGE_targets)
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
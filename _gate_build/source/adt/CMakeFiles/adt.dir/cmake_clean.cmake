@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adt.dir/source/adt.c.o"
+  "CMakeFiles/adt.dir/source/adt.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_comparable.c.o"
+  "CMakeFiles/adt.dir/source/adt_comparable.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_hash.c.o"
+  "CMakeFiles/adt.dir/source/adt_hash.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_hashmap.c.o"
+  "CMakeFiles/adt.dir/source/adt_hashmap.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_hashmap_concurrent.c.o"
+  "CMakeFiles/adt.dir/source/adt_hashmap_concurrent.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_radix_tree.c.o"
+  "CMakeFiles/adt.dir/source/adt_radix_tree.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_set.c.o"
+  "CMakeFiles/adt.dir/source/adt_set.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_set_bucket.c.o"
+  "CMakeFiles/adt.dir/source/adt_set_bucket.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_string_pool.c.o"
+  "CMakeFiles/adt.dir/source/adt_string_pool.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_trie.c.o"
+  "CMakeFiles/adt.dir/source/adt_trie.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_vector.c.o"
+  "CMakeFiles/adt.dir/source/adt_vector.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/adt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,163 @@
+# Install script for directory: /root/repo/source
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "dev" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include" TYPE DIRECTORY FILES "/root/repo/_gate_build/source/include/metacall")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --yellow --bold "MetaCall configuration paths (overwritables)")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --green --bold "LOADER_SCRIPT_PATH:")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Description: Directory where scripts are located")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Install Location: N/A")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Default Location: scripts")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --green --bold "LOADER_LIBRARY_PATH:")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Description: Directory where MetaCall loader plugins are located")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Install Location: /usr/local/lib")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Default Location: .")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --green --bold "CONFIGURATION_PATH:")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Description: Path to the main global MetaCall configuration")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Install Location: /usr/local/share/metacall/configurations/global.json")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Default Location: configurations/global.json")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --green --bold "SERIAL_LIBRARY_PATH:")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Description: Directory where MetaCall serial plugins are located")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Install Location: /usr/local/lib")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Default Location: serials")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --green --bold "DETOUR_LIBRARY_PATH:")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Description: Directory where MetaCall detour plugins are located")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Install Location: /usr/local/lib")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND /usr/bin/cmake -E cmake_echo_color --normal --bold "	Default Location: detours")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_gate_build/source/version/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/preprocessor/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/environment/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/format/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/log/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/memory/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/portability/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/threading/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/adt/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/filesystem/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/dynlink/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/detour/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/reflect/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/serial/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/configuration/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/loader/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/metacall/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/tests/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/cli/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/examples/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/benchmarks/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/loaders/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/scripts/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/serials/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/detours/cmake_install.cmake")
+  include("/root/repo/_gate_build/source/ports/cmake_install.cmake")
+
+endif()
+
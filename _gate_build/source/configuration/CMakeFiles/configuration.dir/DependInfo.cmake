@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/configuration/source/configuration.c" "source/configuration/CMakeFiles/configuration.dir/source/configuration.c.o" "gcc" "source/configuration/CMakeFiles/configuration.dir/source/configuration.c.o.d"
+  "/root/repo/source/configuration/source/configuration_blob.c" "source/configuration/CMakeFiles/configuration.dir/source/configuration_blob.c.o" "gcc" "source/configuration/CMakeFiles/configuration.dir/source/configuration_blob.c.o.d"
+  "/root/repo/source/configuration/source/configuration_impl.c" "source/configuration/CMakeFiles/configuration.dir/source/configuration_impl.c.o" "gcc" "source/configuration/CMakeFiles/configuration.dir/source/configuration_impl.c.o.d"
+  "/root/repo/source/configuration/source/configuration_object.c" "source/configuration/CMakeFiles/configuration.dir/source/configuration_object.c.o" "gcc" "source/configuration/CMakeFiles/configuration.dir/source/configuration_object.c.o.d"
+  "/root/repo/source/configuration/source/configuration_singleton.c" "source/configuration/CMakeFiles/configuration.dir/source/configuration_singleton.c.o" "gcc" "source/configuration/CMakeFiles/configuration.dir/source/configuration_singleton.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
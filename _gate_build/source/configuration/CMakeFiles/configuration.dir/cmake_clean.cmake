@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/configuration.dir/source/configuration.c.o"
+  "CMakeFiles/configuration.dir/source/configuration.c.o.d"
+  "CMakeFiles/configuration.dir/source/configuration_blob.c.o"
+  "CMakeFiles/configuration.dir/source/configuration_blob.c.o.d"
+  "CMakeFiles/configuration.dir/source/configuration_impl.c.o"
+  "CMakeFiles/configuration.dir/source/configuration_impl.c.o.d"
+  "CMakeFiles/configuration.dir/source/configuration_object.c.o"
+  "CMakeFiles/configuration.dir/source/configuration_object.c.o.d"
+  "CMakeFiles/configuration.dir/source/configuration_singleton.c.o"
+  "CMakeFiles/configuration.dir/source/configuration_singleton.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/configuration.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+#ifndef CONFIGURATION_API_H
+#define CONFIGURATION_API_H
+
+#ifdef CONFIGURATION_STATIC_DEFINE
+#  define CONFIGURATION_API
+#  define CONFIGURATION_NO_EXPORT
+#else
+#  ifndef CONFIGURATION_API
+#    ifdef CONFIGURATION_EXPORTS
+        /* We are building this library */
+#      define CONFIGURATION_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define CONFIGURATION_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef CONFIGURATION_NO_EXPORT
+#    define CONFIGURATION_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef CONFIGURATION_DEPRECATED
+#  define CONFIGURATION_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef CONFIGURATION_DEPRECATED_EXPORT
+#  define CONFIGURATION_DEPRECATED_EXPORT CONFIGURATION_API CONFIGURATION_DEPRECATED
+#endif
+
+#ifndef CONFIGURATION_DEPRECATED_NO_EXPORT
+#  define CONFIGURATION_DEPRECATED_NO_EXPORT CONFIGURATION_NO_EXPORT CONFIGURATION_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef CONFIGURATION_NO_DEPRECATED
+#    define CONFIGURATION_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* CONFIGURATION_API_H */
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/detour/source/detour.c" "source/detour/CMakeFiles/detour.dir/source/detour.c.o" "gcc" "source/detour/CMakeFiles/detour.dir/source/detour.c.o.d"
+  "/root/repo/source/detour/source/detour_impl.c" "source/detour/CMakeFiles/detour.dir/source/detour_impl.c.o" "gcc" "source/detour/CMakeFiles/detour.dir/source/detour_impl.c.o.d"
+  "/root/repo/source/detour/source/detour_singleton.c" "source/detour/CMakeFiles/detour.dir/source/detour_singleton.c.o" "gcc" "source/detour/CMakeFiles/detour.dir/source/detour_singleton.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/detour.dir/source/detour.c.o"
+  "CMakeFiles/detour.dir/source/detour.c.o.d"
+  "CMakeFiles/detour.dir/source/detour_impl.c.o"
+  "CMakeFiles/detour.dir/source/detour_impl.c.o.d"
+  "CMakeFiles/detour.dir/source/detour_singleton.c.o"
+  "CMakeFiles/detour.dir/source/detour_singleton.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/detour.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
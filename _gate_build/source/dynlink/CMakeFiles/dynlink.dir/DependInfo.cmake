@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/dynlink/source/dynlink.c" "source/dynlink/CMakeFiles/dynlink.dir/source/dynlink.c.o" "gcc" "source/dynlink/CMakeFiles/dynlink.dir/source/dynlink.c.o.d"
+  "/root/repo/source/dynlink/source/dynlink_impl.c" "source/dynlink/CMakeFiles/dynlink.dir/source/dynlink_impl.c.o" "gcc" "source/dynlink/CMakeFiles/dynlink.dir/source/dynlink_impl.c.o.d"
+  "/root/repo/source/dynlink/source/dynlink_impl_unix.c" "source/dynlink/CMakeFiles/dynlink.dir/source/dynlink_impl_unix.c.o" "gcc" "source/dynlink/CMakeFiles/dynlink.dir/source/dynlink_impl_unix.c.o.d"
+  "/root/repo/_gate_build/source/dynlink/source/dynlink_interface.c" "source/dynlink/CMakeFiles/dynlink.dir/source/dynlink_interface.c.o" "gcc" "source/dynlink/CMakeFiles/dynlink.dir/source/dynlink_interface.c.o.d"
+  "/root/repo/source/dynlink/source/dynlink_symbol.c" "source/dynlink/CMakeFiles/dynlink.dir/source/dynlink_symbol.c.o" "gcc" "source/dynlink/CMakeFiles/dynlink.dir/source/dynlink_symbol.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
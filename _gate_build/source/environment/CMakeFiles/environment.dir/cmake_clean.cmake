@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/environment.dir/source/environment.c.o"
+  "CMakeFiles/environment.dir/source/environment.c.o.d"
+  "CMakeFiles/environment.dir/source/environment_snapshot.c.o"
+  "CMakeFiles/environment.dir/source/environment_snapshot.c.o.d"
+  "CMakeFiles/environment.dir/source/environment_variable.c.o"
+  "CMakeFiles/environment.dir/source/environment_variable.c.o.d"
+  "CMakeFiles/environment.dir/source/environment_variable_path.c.o"
+  "CMakeFiles/environment.dir/source/environment_variable_path.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/environment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,514 @@
+
+// This is a generated file. Do not edit!
+
+#ifndef ENVIRONMENT_COMPILER_DETECTION_H
+#define ENVIRONMENT_COMPILER_DETECTION_H
+
+#ifdef __cplusplus
+# define ENVIRONMENT_COMPILER_IS_Comeau 0
+# define ENVIRONMENT_COMPILER_IS_Intel 0
+# define ENVIRONMENT_COMPILER_IS_IntelLLVM 0
+# define ENVIRONMENT_COMPILER_IS_PathScale 0
+# define ENVIRONMENT_COMPILER_IS_Embarcadero 0
+# define ENVIRONMENT_COMPILER_IS_Borland 0
+# define ENVIRONMENT_COMPILER_IS_Watcom 0
+# define ENVIRONMENT_COMPILER_IS_OpenWatcom 0
+# define ENVIRONMENT_COMPILER_IS_SunPro 0
+# define ENVIRONMENT_COMPILER_IS_HP 0
+# define ENVIRONMENT_COMPILER_IS_Compaq 0
+# define ENVIRONMENT_COMPILER_IS_zOS 0
+# define ENVIRONMENT_COMPILER_IS_IBMClang 0
+# define ENVIRONMENT_COMPILER_IS_XLClang 0
+# define ENVIRONMENT_COMPILER_IS_XL 0
+# define ENVIRONMENT_COMPILER_IS_VisualAge 0
+# define ENVIRONMENT_COMPILER_IS_NVHPC 0
+# define ENVIRONMENT_COMPILER_IS_PGI 0
+# define ENVIRONMENT_COMPILER_IS_Cray 0
+# define ENVIRONMENT_COMPILER_IS_TI 0
+# define ENVIRONMENT_COMPILER_IS_FujitsuClang 0
+# define ENVIRONMENT_COMPILER_IS_Fujitsu 0
+# define ENVIRONMENT_COMPILER_IS_GHS 0
+# define ENVIRONMENT_COMPILER_IS_Tasking 0
+# define ENVIRONMENT_COMPILER_IS_SCO 0
+# define ENVIRONMENT_COMPILER_IS_ARMCC 0
+# define ENVIRONMENT_COMPILER_IS_AppleClang 0
+# define ENVIRONMENT_COMPILER_IS_ARMClang 0
+# define ENVIRONMENT_COMPILER_IS_Clang 0
+# define ENVIRONMENT_COMPILER_IS_LCC 0
+# define ENVIRONMENT_COMPILER_IS_GNU 0
+# define ENVIRONMENT_COMPILER_IS_MSVC 0
+# define ENVIRONMENT_COMPILER_IS_ADSP 0
+# define ENVIRONMENT_COMPILER_IS_IAR 0
+# define ENVIRONMENT_COMPILER_IS_MIPSpro 0
+
+#if defined(__COMO__)
+# undef ENVIRONMENT_COMPILER_IS_Comeau
+# define ENVIRONMENT_COMPILER_IS_Comeau 1
+
+#elif defined(__INTEL_COMPILER) || defined(__ICC)
+# undef ENVIRONMENT_COMPILER_IS_Intel
+# define ENVIRONMENT_COMPILER_IS_Intel 1
+
+#elif (defined(__clang__) && defined(__INTEL_CLANG_COMPILER)) || defined(__INTEL_LLVM_COMPILER)
+# undef ENVIRONMENT_COMPILER_IS_IntelLLVM
+# define ENVIRONMENT_COMPILER_IS_IntelLLVM 1
+
+#elif defined(__PATHCC__)
+# undef ENVIRONMENT_COMPILER_IS_PathScale
+# define ENVIRONMENT_COMPILER_IS_PathScale 1
+
+#elif defined(__BORLANDC__) && defined(__CODEGEARC_VERSION__)
+# undef ENVIRONMENT_COMPILER_IS_Embarcadero
+# define ENVIRONMENT_COMPILER_IS_Embarcadero 1
+
+#elif defined(__BORLANDC__)
+# undef ENVIRONMENT_COMPILER_IS_Borland
+# define ENVIRONMENT_COMPILER_IS_Borland 1
+
+#elif defined(__WATCOMC__) && __WATCOMC__ < 1200
+# undef ENVIRONMENT_COMPILER_IS_Watcom
+# define ENVIRONMENT_COMPILER_IS_Watcom 1
+
+#elif defined(__WATCOMC__)
+# undef ENVIRONMENT_COMPILER_IS_OpenWatcom
+# define ENVIRONMENT_COMPILER_IS_OpenWatcom 1
+
+#elif defined(__SUNPRO_CC)
+# undef ENVIRONMENT_COMPILER_IS_SunPro
+# define ENVIRONMENT_COMPILER_IS_SunPro 1
+
+#elif defined(__HP_aCC)
+# undef ENVIRONMENT_COMPILER_IS_HP
+# define ENVIRONMENT_COMPILER_IS_HP 1
+
+#elif defined(__DECCXX)
+# undef ENVIRONMENT_COMPILER_IS_Compaq
+# define ENVIRONMENT_COMPILER_IS_Compaq 1
+
+#elif defined(__IBMCPP__) && defined(__COMPILER_VER__)
+# undef ENVIRONMENT_COMPILER_IS_zOS
+# define ENVIRONMENT_COMPILER_IS_zOS 1
+
+#elif defined(__open_xl__) && defined(__clang__)
+# undef ENVIRONMENT_COMPILER_IS_IBMClang
+# define ENVIRONMENT_COMPILER_IS_IBMClang 1
+
+#elif defined(__ibmxl__) && defined(__clang__)
+# undef ENVIRONMENT_COMPILER_IS_XLClang
+# define ENVIRONMENT_COMPILER_IS_XLClang 1
+
+#elif defined(__IBMCPP__) && !defined(__COMPILER_VER__) && __IBMCPP__ >= 800
+# undef ENVIRONMENT_COMPILER_IS_XL
+# define ENVIRONMENT_COMPILER_IS_XL 1
+
+#elif defined(__IBMCPP__) && !defined(__COMPILER_VER__) && __IBMCPP__ < 800
+# undef ENVIRONMENT_COMPILER_IS_VisualAge
+# define ENVIRONMENT_COMPILER_IS_VisualAge 1
+
+#elif defined(__NVCOMPILER)
+# undef ENVIRONMENT_COMPILER_IS_NVHPC
+# define ENVIRONMENT_COMPILER_IS_NVHPC 1
+
+#elif defined(__PGI)
+# undef ENVIRONMENT_COMPILER_IS_PGI
+# define ENVIRONMENT_COMPILER_IS_PGI 1
+
+#elif defined(_CRAYC)
+# undef ENVIRONMENT_COMPILER_IS_Cray
+# define ENVIRONMENT_COMPILER_IS_Cray 1
+
+#elif defined(__TI_COMPILER_VERSION__)
+# undef ENVIRONMENT_COMPILER_IS_TI
+# define ENVIRONMENT_COMPILER_IS_TI 1
+
+#elif defined(__CLANG_FUJITSU)
+# undef ENVIRONMENT_COMPILER_IS_FujitsuClang
+# define ENVIRONMENT_COMPILER_IS_FujitsuClang 1
+
+#elif defined(__FUJITSU)
+# undef ENVIRONMENT_COMPILER_IS_Fujitsu
+# define ENVIRONMENT_COMPILER_IS_Fujitsu 1
+
+#elif defined(__ghs__)
+# undef ENVIRONMENT_COMPILER_IS_GHS
+# define ENVIRONMENT_COMPILER_IS_GHS 1
+
+#elif defined(__TASKING__)
+# undef ENVIRONMENT_COMPILER_IS_Tasking
+# define ENVIRONMENT_COMPILER_IS_Tasking 1
+
+#elif defined(__SCO_VERSION__)
+# undef ENVIRONMENT_COMPILER_IS_SCO
+# define ENVIRONMENT_COMPILER_IS_SCO 1
+
+#elif defined(__ARMCC_VERSION) && !defined(__clang__)
+# undef ENVIRONMENT_COMPILER_IS_ARMCC
+# define ENVIRONMENT_COMPILER_IS_ARMCC 1
+
+#elif defined(__clang__) && defined(__apple_build_version__)
+# undef ENVIRONMENT_COMPILER_IS_AppleClang
+# define ENVIRONMENT_COMPILER_IS_AppleClang 1
+
+#elif defined(__clang__) && defined(__ARMCOMPILER_VERSION)
+# undef ENVIRONMENT_COMPILER_IS_ARMClang
+# define ENVIRONMENT_COMPILER_IS_ARMClang 1
+
+#elif defined(__clang__)
+# undef ENVIRONMENT_COMPILER_IS_Clang
+# define ENVIRONMENT_COMPILER_IS_Clang 1
+
+#elif defined(__LCC__) && (defined(__GNUC__) || defined(__GNUG__) || defined(__MCST__))
+# undef ENVIRONMENT_COMPILER_IS_LCC
+# define ENVIRONMENT_COMPILER_IS_LCC 1
+
+#elif defined(__GNUC__) || defined(__GNUG__)
+# undef ENVIRONMENT_COMPILER_IS_GNU
+# define ENVIRONMENT_COMPILER_IS_GNU 1
+
+#elif defined(_MSC_VER)
+# undef ENVIRONMENT_COMPILER_IS_MSVC
+# define ENVIRONMENT_COMPILER_IS_MSVC 1
+
+#elif defined(_ADI_COMPILER)
+# undef ENVIRONMENT_COMPILER_IS_ADSP
+# define ENVIRONMENT_COMPILER_IS_ADSP 1
+
+#elif defined(__IAR_SYSTEMS_ICC__) || defined(__IAR_SYSTEMS_ICC)
+# undef ENVIRONMENT_COMPILER_IS_IAR
+# define ENVIRONMENT_COMPILER_IS_IAR 1
+
+
+#endif
+
+#  if ENVIRONMENT_COMPILER_IS_AppleClang
+
+#    if !(((__clang_major__ * 100) + __clang_minor__) >= 400)
+#      error Unsupported compiler version
+#    endif
+
+# define ENVIRONMENT_COMPILER_VERSION_MAJOR (__clang_major__)
+# define ENVIRONMENT_COMPILER_VERSION_MINOR (__clang_minor__)
+# define ENVIRONMENT_COMPILER_VERSION_PATCH (__clang_patchlevel__)
+# if defined(_MSC_VER)
+   /* _MSC_VER = VVRR */
+#  define ENVIRONMENT_SIMULATE_VERSION_MAJOR (_MSC_VER / 100)
+#  define ENVIRONMENT_SIMULATE_VERSION_MINOR (_MSC_VER % 100)
+# endif
+# define ENVIRONMENT_COMPILER_VERSION_TWEAK (__apple_build_version__)
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_alignas)
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNAS 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNAS 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_alignas)
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNOF 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNOF 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_constexpr)
+#      define ENVIRONMENT_COMPILER_CXX_CONSTEXPR 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_CONSTEXPR 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_override_control)
+#      define ENVIRONMENT_COMPILER_CXX_FINAL 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_FINAL 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_noexcept)
+#      define ENVIRONMENT_COMPILER_CXX_NOEXCEPT 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_NOEXCEPT 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_nullptr)
+#      define ENVIRONMENT_COMPILER_CXX_NULLPTR 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_NULLPTR 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __cplusplus >= 201103L
+#      define ENVIRONMENT_COMPILER_CXX_SIZEOF_MEMBER 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_SIZEOF_MEMBER 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_thread_local)
+#      define ENVIRONMENT_COMPILER_CXX_THREAD_LOCAL 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_THREAD_LOCAL 0
+#    endif
+
+#  elif ENVIRONMENT_COMPILER_IS_Clang
+
+#    if !(((__clang_major__ * 100) + __clang_minor__) >= 301)
+#      error Unsupported compiler version
+#    endif
+
+# define ENVIRONMENT_COMPILER_VERSION_MAJOR (__clang_major__)
+# define ENVIRONMENT_COMPILER_VERSION_MINOR (__clang_minor__)
+# define ENVIRONMENT_COMPILER_VERSION_PATCH (__clang_patchlevel__)
+# if defined(_MSC_VER)
+   /* _MSC_VER = VVRR */
+#  define ENVIRONMENT_SIMULATE_VERSION_MAJOR (_MSC_VER / 100)
+#  define ENVIRONMENT_SIMULATE_VERSION_MINOR (_MSC_VER % 100)
+# endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_alignas)
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNAS 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNAS 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_alignas)
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNOF 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNOF 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_constexpr)
+#      define ENVIRONMENT_COMPILER_CXX_CONSTEXPR 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_CONSTEXPR 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_override_control)
+#      define ENVIRONMENT_COMPILER_CXX_FINAL 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_FINAL 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_noexcept)
+#      define ENVIRONMENT_COMPILER_CXX_NOEXCEPT 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_NOEXCEPT 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_nullptr)
+#      define ENVIRONMENT_COMPILER_CXX_NULLPTR 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_NULLPTR 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __cplusplus >= 201103L
+#      define ENVIRONMENT_COMPILER_CXX_SIZEOF_MEMBER 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_SIZEOF_MEMBER 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_thread_local)
+#      define ENVIRONMENT_COMPILER_CXX_THREAD_LOCAL 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_THREAD_LOCAL 0
+#    endif
+
+#  elif ENVIRONMENT_COMPILER_IS_GNU
+
+#    if !((__GNUC__ * 100 + __GNUC_MINOR__) >= 404)
+#      error Unsupported compiler version
+#    endif
+
+# if defined(__GNUC__)
+#  define ENVIRONMENT_COMPILER_VERSION_MAJOR (__GNUC__)
+# else
+#  define ENVIRONMENT_COMPILER_VERSION_MAJOR (__GNUG__)
+# endif
+# if defined(__GNUC_MINOR__)
+#  define ENVIRONMENT_COMPILER_VERSION_MINOR (__GNUC_MINOR__)
+# endif
+# if defined(__GNUC_PATCHLEVEL__)
+#  define ENVIRONMENT_COMPILER_VERSION_PATCH (__GNUC_PATCHLEVEL__)
+# endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 408 && __cplusplus >= 201103L
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNAS 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNAS 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 408 && __cplusplus >= 201103L
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNOF 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNOF 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 406 && (__cplusplus >= 201103L || (defined(__GXX_EXPERIMENTAL_CXX0X__) && __GXX_EXPERIMENTAL_CXX0X__))
+#      define ENVIRONMENT_COMPILER_CXX_CONSTEXPR 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_CONSTEXPR 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 407 && __cplusplus >= 201103L
+#      define ENVIRONMENT_COMPILER_CXX_FINAL 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_FINAL 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 406 && (__cplusplus >= 201103L || (defined(__GXX_EXPERIMENTAL_CXX0X__) && __GXX_EXPERIMENTAL_CXX0X__))
+#      define ENVIRONMENT_COMPILER_CXX_NOEXCEPT 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_NOEXCEPT 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 406 && (__cplusplus >= 201103L || (defined(__GXX_EXPERIMENTAL_CXX0X__) && __GXX_EXPERIMENTAL_CXX0X__))
+#      define ENVIRONMENT_COMPILER_CXX_NULLPTR 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_NULLPTR 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 404 && (__cplusplus >= 201103L || (defined(__GXX_EXPERIMENTAL_CXX0X__) && __GXX_EXPERIMENTAL_CXX0X__))
+#      define ENVIRONMENT_COMPILER_CXX_SIZEOF_MEMBER 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_SIZEOF_MEMBER 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 408 && __cplusplus >= 201103L
+#      define ENVIRONMENT_COMPILER_CXX_THREAD_LOCAL 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_THREAD_LOCAL 0
+#    endif
+
+#  elif ENVIRONMENT_COMPILER_IS_MSVC
+
+#    if !(_MSC_VER >= 1600)
+#      error Unsupported compiler version
+#    endif
+
+  /* _MSC_VER = VVRR */
+# define ENVIRONMENT_COMPILER_VERSION_MAJOR (_MSC_VER / 100)
+# define ENVIRONMENT_COMPILER_VERSION_MINOR (_MSC_VER % 100)
+# if defined(_MSC_FULL_VER)
+#  if _MSC_VER >= 1400
+    /* _MSC_FULL_VER = VVRRPPPPP */
+#   define ENVIRONMENT_COMPILER_VERSION_PATCH (_MSC_FULL_VER % 100000)
+#  else
+    /* _MSC_FULL_VER = VVRRPPPP */
+#   define ENVIRONMENT_COMPILER_VERSION_PATCH (_MSC_FULL_VER % 10000)
+#  endif
+# endif
+# if defined(_MSC_BUILD)
+#  define ENVIRONMENT_COMPILER_VERSION_TWEAK (_MSC_BUILD)
+# endif
+
+#    if _MSC_VER >= 1900
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNAS 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNAS 0
+#    endif
+
+#    if _MSC_VER >= 1900
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNOF 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_ALIGNOF 0
+#    endif
+
+#    if _MSC_VER >= 1900
+#      define ENVIRONMENT_COMPILER_CXX_CONSTEXPR 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_CONSTEXPR 0
+#    endif
+
+#    if _MSC_VER >= 1700
+#      define ENVIRONMENT_COMPILER_CXX_FINAL 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_FINAL 0
+#    endif
+
+#    if _MSC_VER >= 1900
+#      define ENVIRONMENT_COMPILER_CXX_NOEXCEPT 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_NOEXCEPT 0
+#    endif
+
+#    if _MSC_VER >= 1600
+#      define ENVIRONMENT_COMPILER_CXX_NULLPTR 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_NULLPTR 0
+#    endif
+
+#    if _MSC_VER >= 1900
+#      define ENVIRONMENT_COMPILER_CXX_SIZEOF_MEMBER 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_SIZEOF_MEMBER 0
+#    endif
+
+#    if _MSC_VER >= 1900
+#      define ENVIRONMENT_COMPILER_CXX_THREAD_LOCAL 1
+#    else
+#      define ENVIRONMENT_COMPILER_CXX_THREAD_LOCAL 0
+#    endif
+
+#  else
+#    error Unsupported compiler
+#  endif
+
+#  if defined(ENVIRONMENT_COMPILER_CXX_ALIGNAS) && ENVIRONMENT_COMPILER_CXX_ALIGNAS
+#    define ENVIRONMENT_ALIGNAS(X) alignas(X)
+#  elif ENVIRONMENT_COMPILER_IS_GNU || ENVIRONMENT_COMPILER_IS_Clang || ENVIRONMENT_COMPILER_IS_AppleClang
+#    define ENVIRONMENT_ALIGNAS(X) __attribute__ ((__aligned__(X)))
+#  elif ENVIRONMENT_COMPILER_IS_MSVC
+#    define ENVIRONMENT_ALIGNAS(X) __declspec(align(X))
+#  else
+#    define ENVIRONMENT_ALIGNAS(X)
+#  endif
+
+
+#  if defined(ENVIRONMENT_COMPILER_CXX_ALIGNOF) && ENVIRONMENT_COMPILER_CXX_ALIGNOF
+#    define ENVIRONMENT_ALIGNOF(X) alignof(X)
+#  elif ENVIRONMENT_COMPILER_IS_GNU || ENVIRONMENT_COMPILER_IS_Clang || ENVIRONMENT_COMPILER_IS_AppleClang
+#    define ENVIRONMENT_ALIGNOF(X) __alignof__(X)
+#  elif ENVIRONMENT_COMPILER_IS_MSVC
+#    define ENVIRONMENT_ALIGNOF(X) __alignof(X)
+#  endif
+
+
+#  if defined(ENVIRONMENT_COMPILER_CXX_CONSTEXPR) && ENVIRONMENT_COMPILER_CXX_CONSTEXPR
+#    define ENVIRONMENT_CONSTEXPR constexpr
+#  else
+#    define ENVIRONMENT_CONSTEXPR 
+#  endif
+
+
+#  if defined(ENVIRONMENT_COMPILER_CXX_FINAL) && ENVIRONMENT_COMPILER_CXX_FINAL
+#    define ENVIRONMENT_FINAL final
+#  else
+#    define ENVIRONMENT_FINAL 
+#  endif
+
+
+#  if defined(ENVIRONMENT_COMPILER_CXX_NOEXCEPT) && ENVIRONMENT_COMPILER_CXX_NOEXCEPT
+#    define ENVIRONMENT_NOEXCEPT noexcept
+#    define ENVIRONMENT_NOEXCEPT_EXPR(X) noexcept(X)
+#  else
+#    define ENVIRONMENT_NOEXCEPT
+#    define ENVIRONMENT_NOEXCEPT_EXPR(X)
+#  endif
+
+
+#  if defined(ENVIRONMENT_COMPILER_CXX_NULLPTR) && ENVIRONMENT_COMPILER_CXX_NULLPTR
+#    define ENVIRONMENT_NULLPTR nullptr
+#  elif ENVIRONMENT_COMPILER_IS_GNU
+#    define ENVIRONMENT_NULLPTR __null
+#  else
+#    define ENVIRONMENT_NULLPTR 0
+#  endif
+
+
+#  if defined(ENVIRONMENT_COMPILER_CXX_THREAD_LOCAL) && ENVIRONMENT_COMPILER_CXX_THREAD_LOCAL
+#    define ENVIRONMENT_THREAD_LOCAL thread_local
+#  elif ENVIRONMENT_COMPILER_IS_GNU || ENVIRONMENT_COMPILER_IS_Clang || ENVIRONMENT_COMPILER_IS_AppleClang
+#    define ENVIRONMENT_THREAD_LOCAL __thread
+#  elif ENVIRONMENT_COMPILER_IS_MSVC
+#    define ENVIRONMENT_THREAD_LOCAL __declspec(thread)
+#  else
+// ENVIRONMENT_THREAD_LOCAL not defined for this configuration.
+#  endif
+
+#endif
+
+#endif
@@ -0,0 +1,514 @@
+
+// This is a generated file. Do not edit!
+
+#ifndef FILESYSTEM_COMPILER_DETECTION_H
+#define FILESYSTEM_COMPILER_DETECTION_H
+
+#ifdef __cplusplus
+# define FILESYSTEM_COMPILER_IS_Comeau 0
+# define FILESYSTEM_COMPILER_IS_Intel 0
+# define FILESYSTEM_COMPILER_IS_IntelLLVM 0
+# define FILESYSTEM_COMPILER_IS_PathScale 0
+# define FILESYSTEM_COMPILER_IS_Embarcadero 0
+# define FILESYSTEM_COMPILER_IS_Borland 0
+# define FILESYSTEM_COMPILER_IS_Watcom 0
+# define FILESYSTEM_COMPILER_IS_OpenWatcom 0
+# define FILESYSTEM_COMPILER_IS_SunPro 0
+# define FILESYSTEM_COMPILER_IS_HP 0
+# define FILESYSTEM_COMPILER_IS_Compaq 0
+# define FILESYSTEM_COMPILER_IS_zOS 0
+# define FILESYSTEM_COMPILER_IS_IBMClang 0
+# define FILESYSTEM_COMPILER_IS_XLClang 0
+# define FILESYSTEM_COMPILER_IS_XL 0
+# define FILESYSTEM_COMPILER_IS_VisualAge 0
+# define FILESYSTEM_COMPILER_IS_NVHPC 0
+# define FILESYSTEM_COMPILER_IS_PGI 0
+# define FILESYSTEM_COMPILER_IS_Cray 0
+# define FILESYSTEM_COMPILER_IS_TI 0
+# define FILESYSTEM_COMPILER_IS_FujitsuClang 0
+# define FILESYSTEM_COMPILER_IS_Fujitsu 0
+# define FILESYSTEM_COMPILER_IS_GHS 0
+# define FILESYSTEM_COMPILER_IS_Tasking 0
+# define FILESYSTEM_COMPILER_IS_SCO 0
+# define FILESYSTEM_COMPILER_IS_ARMCC 0
+# define FILESYSTEM_COMPILER_IS_AppleClang 0
+# define FILESYSTEM_COMPILER_IS_ARMClang 0
+# define FILESYSTEM_COMPILER_IS_Clang 0
+# define FILESYSTEM_COMPILER_IS_LCC 0
+# define FILESYSTEM_COMPILER_IS_GNU 0
+# define FILESYSTEM_COMPILER_IS_MSVC 0
+# define FILESYSTEM_COMPILER_IS_ADSP 0
+# define FILESYSTEM_COMPILER_IS_IAR 0
+# define FILESYSTEM_COMPILER_IS_MIPSpro 0
+
+#if defined(__COMO__)
+# undef FILESYSTEM_COMPILER_IS_Comeau
+# define FILESYSTEM_COMPILER_IS_Comeau 1
+
+#elif defined(__INTEL_COMPILER) || defined(__ICC)
+# undef FILESYSTEM_COMPILER_IS_Intel
+# define FILESYSTEM_COMPILER_IS_Intel 1
+
+#elif (defined(__clang__) && defined(__INTEL_CLANG_COMPILER)) || defined(__INTEL_LLVM_COMPILER)
+# undef FILESYSTEM_COMPILER_IS_IntelLLVM
+# define FILESYSTEM_COMPILER_IS_IntelLLVM 1
+
+#elif defined(__PATHCC__)
+# undef FILESYSTEM_COMPILER_IS_PathScale
+# define FILESYSTEM_COMPILER_IS_PathScale 1
+
+#elif defined(__BORLANDC__) && defined(__CODEGEARC_VERSION__)
+# undef FILESYSTEM_COMPILER_IS_Embarcadero
+# define FILESYSTEM_COMPILER_IS_Embarcadero 1
+
+#elif defined(__BORLANDC__)
+# undef FILESYSTEM_COMPILER_IS_Borland
+# define FILESYSTEM_COMPILER_IS_Borland 1
+
+#elif defined(__WATCOMC__) && __WATCOMC__ < 1200
+# undef FILESYSTEM_COMPILER_IS_Watcom
+# define FILESYSTEM_COMPILER_IS_Watcom 1
+
+#elif defined(__WATCOMC__)
+# undef FILESYSTEM_COMPILER_IS_OpenWatcom
+# define FILESYSTEM_COMPILER_IS_OpenWatcom 1
+
+#elif defined(__SUNPRO_CC)
+# undef FILESYSTEM_COMPILER_IS_SunPro
+# define FILESYSTEM_COMPILER_IS_SunPro 1
+
+#elif defined(__HP_aCC)
+# undef FILESYSTEM_COMPILER_IS_HP
+# define FILESYSTEM_COMPILER_IS_HP 1
+
+#elif defined(__DECCXX)
+# undef FILESYSTEM_COMPILER_IS_Compaq
+# define FILESYSTEM_COMPILER_IS_Compaq 1
+
+#elif defined(__IBMCPP__) && defined(__COMPILER_VER__)
+# undef FILESYSTEM_COMPILER_IS_zOS
+# define FILESYSTEM_COMPILER_IS_zOS 1
+
+#elif defined(__open_xl__) && defined(__clang__)
+# undef FILESYSTEM_COMPILER_IS_IBMClang
+# define FILESYSTEM_COMPILER_IS_IBMClang 1
+
+#elif defined(__ibmxl__) && defined(__clang__)
+# undef FILESYSTEM_COMPILER_IS_XLClang
+# define FILESYSTEM_COMPILER_IS_XLClang 1
+
+#elif defined(__IBMCPP__) && !defined(__COMPILER_VER__) && __IBMCPP__ >= 800
+# undef FILESYSTEM_COMPILER_IS_XL
+# define FILESYSTEM_COMPILER_IS_XL 1
+
+#elif defined(__IBMCPP__) && !defined(__COMPILER_VER__) && __IBMCPP__ < 800
+# undef FILESYSTEM_COMPILER_IS_VisualAge
+# define FILESYSTEM_COMPILER_IS_VisualAge 1
+
+#elif defined(__NVCOMPILER)
+# undef FILESYSTEM_COMPILER_IS_NVHPC
+# define FILESYSTEM_COMPILER_IS_NVHPC 1
+
+#elif defined(__PGI)
+# undef FILESYSTEM_COMPILER_IS_PGI
+# define FILESYSTEM_COMPILER_IS_PGI 1
+
+#elif defined(_CRAYC)
+# undef FILESYSTEM_COMPILER_IS_Cray
+# define FILESYSTEM_COMPILER_IS_Cray 1
+
+#elif defined(__TI_COMPILER_VERSION__)
+# undef FILESYSTEM_COMPILER_IS_TI
+# define FILESYSTEM_COMPILER_IS_TI 1
+
+#elif defined(__CLANG_FUJITSU)
+# undef FILESYSTEM_COMPILER_IS_FujitsuClang
+# define FILESYSTEM_COMPILER_IS_FujitsuClang 1
+
+#elif defined(__FUJITSU)
+# undef FILESYSTEM_COMPILER_IS_Fujitsu
+# define FILESYSTEM_COMPILER_IS_Fujitsu 1
+
+#elif defined(__ghs__)
+# undef FILESYSTEM_COMPILER_IS_GHS
+# define FILESYSTEM_COMPILER_IS_GHS 1
+
+#elif defined(__TASKING__)
+# undef FILESYSTEM_COMPILER_IS_Tasking
+# define FILESYSTEM_COMPILER_IS_Tasking 1
+
+#elif defined(__SCO_VERSION__)
+# undef FILESYSTEM_COMPILER_IS_SCO
+# define FILESYSTEM_COMPILER_IS_SCO 1
+
+#elif defined(__ARMCC_VERSION) && !defined(__clang__)
+# undef FILESYSTEM_COMPILER_IS_ARMCC
+# define FILESYSTEM_COMPILER_IS_ARMCC 1
+
+#elif defined(__clang__) && defined(__apple_build_version__)
+# undef FILESYSTEM_COMPILER_IS_AppleClang
+# define FILESYSTEM_COMPILER_IS_AppleClang 1
+
+#elif defined(__clang__) && defined(__ARMCOMPILER_VERSION)
+# undef FILESYSTEM_COMPILER_IS_ARMClang
+# define FILESYSTEM_COMPILER_IS_ARMClang 1
+
+#elif defined(__clang__)
+# undef FILESYSTEM_COMPILER_IS_Clang
+# define FILESYSTEM_COMPILER_IS_Clang 1
+
+#elif defined(__LCC__) && (defined(__GNUC__) || defined(__GNUG__) || defined(__MCST__))
+# undef FILESYSTEM_COMPILER_IS_LCC
+# define FILESYSTEM_COMPILER_IS_LCC 1
+
+#elif defined(__GNUC__) || defined(__GNUG__)
+# undef FILESYSTEM_COMPILER_IS_GNU
+# define FILESYSTEM_COMPILER_IS_GNU 1
+
+#elif defined(_MSC_VER)
+# undef FILESYSTEM_COMPILER_IS_MSVC
+# define FILESYSTEM_COMPILER_IS_MSVC 1
+
+#elif defined(_ADI_COMPILER)
+# undef FILESYSTEM_COMPILER_IS_ADSP
+# define FILESYSTEM_COMPILER_IS_ADSP 1
+
+#elif defined(__IAR_SYSTEMS_ICC__) || defined(__IAR_SYSTEMS_ICC)
+# undef FILESYSTEM_COMPILER_IS_IAR
+# define FILESYSTEM_COMPILER_IS_IAR 1
+
+
+#endif
+
+#  if FILESYSTEM_COMPILER_IS_AppleClang
+
+#    if !(((__clang_major__ * 100) + __clang_minor__) >= 400)
+#      error Unsupported compiler version
+#    endif
+
+# define FILESYSTEM_COMPILER_VERSION_MAJOR (__clang_major__)
+# define FILESYSTEM_COMPILER_VERSION_MINOR (__clang_minor__)
+# define FILESYSTEM_COMPILER_VERSION_PATCH (__clang_patchlevel__)
+# if defined(_MSC_VER)
+   /* _MSC_VER = VVRR */
+#  define FILESYSTEM_SIMULATE_VERSION_MAJOR (_MSC_VER / 100)
+#  define FILESYSTEM_SIMULATE_VERSION_MINOR (_MSC_VER % 100)
+# endif
+# define FILESYSTEM_COMPILER_VERSION_TWEAK (__apple_build_version__)
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_alignas)
+#      define FILESYSTEM_COMPILER_CXX_ALIGNAS 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_ALIGNAS 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_alignas)
+#      define FILESYSTEM_COMPILER_CXX_ALIGNOF 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_ALIGNOF 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_constexpr)
+#      define FILESYSTEM_COMPILER_CXX_CONSTEXPR 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_CONSTEXPR 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_override_control)
+#      define FILESYSTEM_COMPILER_CXX_FINAL 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_FINAL 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_noexcept)
+#      define FILESYSTEM_COMPILER_CXX_NOEXCEPT 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_NOEXCEPT 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_nullptr)
+#      define FILESYSTEM_COMPILER_CXX_NULLPTR 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_NULLPTR 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __cplusplus >= 201103L
+#      define FILESYSTEM_COMPILER_CXX_SIZEOF_MEMBER 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_SIZEOF_MEMBER 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 400 && __has_feature(cxx_thread_local)
+#      define FILESYSTEM_COMPILER_CXX_THREAD_LOCAL 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_THREAD_LOCAL 0
+#    endif
+
+#  elif FILESYSTEM_COMPILER_IS_Clang
+
+#    if !(((__clang_major__ * 100) + __clang_minor__) >= 301)
+#      error Unsupported compiler version
+#    endif
+
+# define FILESYSTEM_COMPILER_VERSION_MAJOR (__clang_major__)
+# define FILESYSTEM_COMPILER_VERSION_MINOR (__clang_minor__)
+# define FILESYSTEM_COMPILER_VERSION_PATCH (__clang_patchlevel__)
+# if defined(_MSC_VER)
+   /* _MSC_VER = VVRR */
+#  define FILESYSTEM_SIMULATE_VERSION_MAJOR (_MSC_VER / 100)
+#  define FILESYSTEM_SIMULATE_VERSION_MINOR (_MSC_VER % 100)
+# endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_alignas)
+#      define FILESYSTEM_COMPILER_CXX_ALIGNAS 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_ALIGNAS 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_alignas)
+#      define FILESYSTEM_COMPILER_CXX_ALIGNOF 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_ALIGNOF 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_constexpr)
+#      define FILESYSTEM_COMPILER_CXX_CONSTEXPR 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_CONSTEXPR 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_override_control)
+#      define FILESYSTEM_COMPILER_CXX_FINAL 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_FINAL 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_noexcept)
+#      define FILESYSTEM_COMPILER_CXX_NOEXCEPT 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_NOEXCEPT 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_nullptr)
+#      define FILESYSTEM_COMPILER_CXX_NULLPTR 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_NULLPTR 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __cplusplus >= 201103L
+#      define FILESYSTEM_COMPILER_CXX_SIZEOF_MEMBER 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_SIZEOF_MEMBER 0
+#    endif
+
+#    if ((__clang_major__ * 100) + __clang_minor__) >= 301 && __has_feature(cxx_thread_local)
+#      define FILESYSTEM_COMPILER_CXX_THREAD_LOCAL 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_THREAD_LOCAL 0
+#    endif
+
+#  elif FILESYSTEM_COMPILER_IS_GNU
+
+#    if !((__GNUC__ * 100 + __GNUC_MINOR__) >= 404)
+#      error Unsupported compiler version
+#    endif
+
+# if defined(__GNUC__)
+#  define FILESYSTEM_COMPILER_VERSION_MAJOR (__GNUC__)
+# else
+#  define FILESYSTEM_COMPILER_VERSION_MAJOR (__GNUG__)
+# endif
+# if defined(__GNUC_MINOR__)
+#  define FILESYSTEM_COMPILER_VERSION_MINOR (__GNUC_MINOR__)
+# endif
+# if defined(__GNUC_PATCHLEVEL__)
+#  define FILESYSTEM_COMPILER_VERSION_PATCH (__GNUC_PATCHLEVEL__)
+# endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 408 && __cplusplus >= 201103L
+#      define FILESYSTEM_COMPILER_CXX_ALIGNAS 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_ALIGNAS 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 408 && __cplusplus >= 201103L
+#      define FILESYSTEM_COMPILER_CXX_ALIGNOF 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_ALIGNOF 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 406 && (__cplusplus >= 201103L || (defined(__GXX_EXPERIMENTAL_CXX0X__) && __GXX_EXPERIMENTAL_CXX0X__))
+#      define FILESYSTEM_COMPILER_CXX_CONSTEXPR 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_CONSTEXPR 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 407 && __cplusplus >= 201103L
+#      define FILESYSTEM_COMPILER_CXX_FINAL 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_FINAL 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 406 && (__cplusplus >= 201103L || (defined(__GXX_EXPERIMENTAL_CXX0X__) && __GXX_EXPERIMENTAL_CXX0X__))
+#      define FILESYSTEM_COMPILER_CXX_NOEXCEPT 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_NOEXCEPT 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 406 && (__cplusplus >= 201103L || (defined(__GXX_EXPERIMENTAL_CXX0X__) && __GXX_EXPERIMENTAL_CXX0X__))
+#      define FILESYSTEM_COMPILER_CXX_NULLPTR 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_NULLPTR 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 404 && (__cplusplus >= 201103L || (defined(__GXX_EXPERIMENTAL_CXX0X__) && __GXX_EXPERIMENTAL_CXX0X__))
+#      define FILESYSTEM_COMPILER_CXX_SIZEOF_MEMBER 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_SIZEOF_MEMBER 0
+#    endif
+
+#    if (__GNUC__ * 100 + __GNUC_MINOR__) >= 408 && __cplusplus >= 201103L
+#      define FILESYSTEM_COMPILER_CXX_THREAD_LOCAL 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_THREAD_LOCAL 0
+#    endif
+
+#  elif FILESYSTEM_COMPILER_IS_MSVC
+
+#    if !(_MSC_VER >= 1600)
+#      error Unsupported compiler version
+#    endif
+
+  /* _MSC_VER = VVRR */
+# define FILESYSTEM_COMPILER_VERSION_MAJOR (_MSC_VER / 100)
+# define FILESYSTEM_COMPILER_VERSION_MINOR (_MSC_VER % 100)
+# if defined(_MSC_FULL_VER)
+#  if _MSC_VER >= 1400
+    /* _MSC_FULL_VER = VVRRPPPPP */
+#   define FILESYSTEM_COMPILER_VERSION_PATCH (_MSC_FULL_VER % 100000)
+#  else
+    /* _MSC_FULL_VER = VVRRPPPP */
+#   define FILESYSTEM_COMPILER_VERSION_PATCH (_MSC_FULL_VER % 10000)
+#  endif
+# endif
+# if defined(_MSC_BUILD)
+#  define FILESYSTEM_COMPILER_VERSION_TWEAK (_MSC_BUILD)
+# endif
+
+#    if _MSC_VER >= 1900
+#      define FILESYSTEM_COMPILER_CXX_ALIGNAS 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_ALIGNAS 0
+#    endif
+
+#    if _MSC_VER >= 1900
+#      define FILESYSTEM_COMPILER_CXX_ALIGNOF 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_ALIGNOF 0
+#    endif
+
+#    if _MSC_VER >= 1900
+#      define FILESYSTEM_COMPILER_CXX_CONSTEXPR 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_CONSTEXPR 0
+#    endif
+
+#    if _MSC_VER >= 1700
+#      define FILESYSTEM_COMPILER_CXX_FINAL 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_FINAL 0
+#    endif
+
+#    if _MSC_VER >= 1900
+#      define FILESYSTEM_COMPILER_CXX_NOEXCEPT 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_NOEXCEPT 0
+#    endif
+
+#    if _MSC_VER >= 1600
+#      define FILESYSTEM_COMPILER_CXX_NULLPTR 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_NULLPTR 0
+#    endif
+
+#    if _MSC_VER >= 1900
+#      define FILESYSTEM_COMPILER_CXX_SIZEOF_MEMBER 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_SIZEOF_MEMBER 0
+#    endif
+
+#    if _MSC_VER >= 1900
+#      define FILESYSTEM_COMPILER_CXX_THREAD_LOCAL 1
+#    else
+#      define FILESYSTEM_COMPILER_CXX_THREAD_LOCAL 0
+#    endif
+
+#  else
+#    error Unsupported compiler
+#  endif
+
+#  if defined(FILESYSTEM_COMPILER_CXX_ALIGNAS) && FILESYSTEM_COMPILER_CXX_ALIGNAS
+#    define FILESYSTEM_ALIGNAS(X) alignas(X)
+#  elif FILESYSTEM_COMPILER_IS_GNU || FILESYSTEM_COMPILER_IS_Clang || FILESYSTEM_COMPILER_IS_AppleClang
+#    define FILESYSTEM_ALIGNAS(X) __attribute__ ((__aligned__(X)))
+#  elif FILESYSTEM_COMPILER_IS_MSVC
+#    define FILESYSTEM_ALIGNAS(X) __declspec(align(X))
+#  else
+#    define FILESYSTEM_ALIGNAS(X)
+#  endif
+
+
+#  if defined(FILESYSTEM_COMPILER_CXX_ALIGNOF) && FILESYSTEM_COMPILER_CXX_ALIGNOF
+#    define FILESYSTEM_ALIGNOF(X) alignof(X)
+#  elif FILESYSTEM_COMPILER_IS_GNU || FILESYSTEM_COMPILER_IS_Clang || FILESYSTEM_COMPILER_IS_AppleClang
+#    define FILESYSTEM_ALIGNOF(X) __alignof__(X)
+#  elif FILESYSTEM_COMPILER_IS_MSVC
+#    define FILESYSTEM_ALIGNOF(X) __alignof(X)
+#  endif
+
+
+#  if defined(FILESYSTEM_COMPILER_CXX_CONSTEXPR) && FILESYSTEM_COMPILER_CXX_CONSTEXPR
+#    define FILESYSTEM_CONSTEXPR constexpr
+#  else
+#    define FILESYSTEM_CONSTEXPR 
+#  endif
+
+
+#  if defined(FILESYSTEM_COMPILER_CXX_FINAL) && FILESYSTEM_COMPILER_CXX_FINAL
+#    define FILESYSTEM_FINAL final
+#  else
+#    define FILESYSTEM_FINAL 
+#  endif
+
+
+#  if defined(FILESYSTEM_COMPILER_CXX_NOEXCEPT) && FILESYSTEM_COMPILER_CXX_NOEXCEPT
+#    define FILESYSTEM_NOEXCEPT noexcept
+#    define FILESYSTEM_NOEXCEPT_EXPR(X) noexcept(X)
+#  else
+#    define FILESYSTEM_NOEXCEPT
+#    define FILESYSTEM_NOEXCEPT_EXPR(X)
+#  endif
+
+
+#  if defined(FILESYSTEM_COMPILER_CXX_NULLPTR) && FILESYSTEM_COMPILER_CXX_NULLPTR
+#    define FILESYSTEM_NULLPTR nullptr
+#  elif FILESYSTEM_COMPILER_IS_GNU
+#    define FILESYSTEM_NULLPTR __null
+#  else
+#    define FILESYSTEM_NULLPTR 0
+#  endif
+
+
+#  if defined(FILESYSTEM_COMPILER_CXX_THREAD_LOCAL) && FILESYSTEM_COMPILER_CXX_THREAD_LOCAL
+#    define FILESYSTEM_THREAD_LOCAL thread_local
+#  elif FILESYSTEM_COMPILER_IS_GNU || FILESYSTEM_COMPILER_IS_Clang || FILESYSTEM_COMPILER_IS_AppleClang
+#    define FILESYSTEM_THREAD_LOCAL __thread
+#  elif FILESYSTEM_COMPILER_IS_MSVC
+#    define FILESYSTEM_THREAD_LOCAL __declspec(thread)
+#  else
+// FILESYSTEM_THREAD_LOCAL not defined for this configuration.
+#  endif
+
+#endif
+
+#endif
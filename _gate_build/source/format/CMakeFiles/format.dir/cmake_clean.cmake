@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/format.dir/source/format.c.o"
+  "CMakeFiles/format.dir/source/format.c.o.d"
+  "CMakeFiles/format.dir/source/format_number.c.o"
+  "CMakeFiles/format.dir/source/format_number.c.o.d"
+  "CMakeFiles/format.dir/source/format_print.c.o"
+  "CMakeFiles/format.dir/source/format_print.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/format.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
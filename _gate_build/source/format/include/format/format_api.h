@@ -0,0 +1,42 @@
+
+#ifndef FORMAT_API_H
+#define FORMAT_API_H
+
+#ifdef FORMAT_STATIC_DEFINE
+#  define FORMAT_API
+#  define FORMAT_NO_EXPORT
+#else
+#  ifndef FORMAT_API
+#    ifdef FORMAT_EXPORTS
+        /* We are building this library */
+#      define FORMAT_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define FORMAT_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef FORMAT_NO_EXPORT
+#    define FORMAT_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef FORMAT_DEPRECATED
+#  define FORMAT_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef FORMAT_DEPRECATED_EXPORT
+#  define FORMAT_DEPRECATED_EXPORT FORMAT_API FORMAT_DEPRECATED
+#endif
+
+#ifndef FORMAT_DEPRECATED_NO_EXPORT
+#  define FORMAT_DEPRECATED_NO_EXPORT FORMAT_NO_EXPORT FORMAT_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef FORMAT_NO_DEPRECATED
+#    define FORMAT_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* FORMAT_API_H */
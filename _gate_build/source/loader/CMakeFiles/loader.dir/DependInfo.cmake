@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/loader/source/loader.c" "source/loader/CMakeFiles/loader.dir/source/loader.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader.c.o.d"
+  "/root/repo/source/loader/source/loader_discovery_cache.c" "source/loader/CMakeFiles/loader.dir/source/loader_discovery_cache.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_discovery_cache.c.o.d"
+  "/root/repo/source/loader/source/loader_dispatch.c" "source/loader/CMakeFiles/loader.dir/source/loader_dispatch.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_dispatch.c.o.d"
+  "/root/repo/source/loader/source/loader_env.c" "source/loader/CMakeFiles/loader.dir/source/loader_env.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_env.c.o.d"
+  "/root/repo/source/loader/source/loader_fork.c" "source/loader/CMakeFiles/loader.dir/source/loader_fork.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_fork.c.o.d"
+  "/root/repo/source/loader/source/loader_impl.c" "source/loader/CMakeFiles/loader.dir/source/loader_impl.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_impl.c.o.d"
+  "/root/repo/source/loader/source/loader_impl_static.c" "source/loader/CMakeFiles/loader.dir/source/loader_impl_static.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_impl_static.c.o.d"
+  "/root/repo/source/loader/source/loader_naming.c" "source/loader/CMakeFiles/loader.dir/source/loader_naming.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_naming.c.o.d"
+  "/root/repo/source/loader/source/loader_path.c" "source/loader/CMakeFiles/loader.dir/source/loader_path.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_path.c.o.d"
+  "/root/repo/source/loader/source/loader_path_index.c" "source/loader/CMakeFiles/loader.dir/source/loader_path_index.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_path_index.c.o.d"
+  "/root/repo/source/loader/source/loader_profile.c" "source/loader/CMakeFiles/loader.dir/source/loader_profile.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_profile.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/loader.dir/source/loader.c.o"
+  "CMakeFiles/loader.dir/source/loader.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_discovery_cache.c.o"
+  "CMakeFiles/loader.dir/source/loader_discovery_cache.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_dispatch.c.o"
+  "CMakeFiles/loader.dir/source/loader_dispatch.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_env.c.o"
+  "CMakeFiles/loader.dir/source/loader_env.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_fork.c.o"
+  "CMakeFiles/loader.dir/source/loader_fork.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_impl.c.o"
+  "CMakeFiles/loader.dir/source/loader_impl.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_impl_static.c.o"
+  "CMakeFiles/loader.dir/source/loader_impl_static.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_naming.c.o"
+  "CMakeFiles/loader.dir/source/loader_naming.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_path.c.o"
+  "CMakeFiles/loader.dir/source/loader_path.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_path_index.c.o"
+  "CMakeFiles/loader.dir/source/loader_path_index.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_profile.c.o"
+  "CMakeFiles/loader.dir/source/loader_profile.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/loader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+#ifndef LOADER_API_H
+#define LOADER_API_H
+
+#ifdef LOADER_STATIC_DEFINE
+#  define LOADER_API
+#  define LOADER_NO_EXPORT
+#else
+#  ifndef LOADER_API
+#    ifdef LOADER_EXPORTS
+        /* We are building this library */
+#      define LOADER_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define LOADER_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef LOADER_NO_EXPORT
+#    define LOADER_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef LOADER_DEPRECATED
+#  define LOADER_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef LOADER_DEPRECATED_EXPORT
+#  define LOADER_DEPRECATED_EXPORT LOADER_API LOADER_DEPRECATED
+#endif
+
+#ifndef LOADER_DEPRECATED_NO_EXPORT
+#  define LOADER_DEPRECATED_NO_EXPORT LOADER_NO_EXPORT LOADER_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef LOADER_NO_DEPRECATED
+#    define LOADER_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* LOADER_API_H */
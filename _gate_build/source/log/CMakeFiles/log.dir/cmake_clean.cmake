@@ -0,0 +1,71 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/log.dir/source/log.c.o"
+  "CMakeFiles/log.dir/source/log.c.o.d"
+  "CMakeFiles/log.dir/source/log_aspect.c.o"
+  "CMakeFiles/log.dir/source/log_aspect.c.o.d"
+  "CMakeFiles/log.dir/source/log_aspect_format.c.o"
+  "CMakeFiles/log.dir/source/log_aspect_format.c.o.d"
+  "CMakeFiles/log.dir/source/log_aspect_schedule.c.o"
+  "CMakeFiles/log.dir/source/log_aspect_schedule.c.o.d"
+  "CMakeFiles/log.dir/source/log_aspect_storage.c.o"
+  "CMakeFiles/log.dir/source/log_aspect_storage.c.o.d"
+  "CMakeFiles/log.dir/source/log_aspect_stream.c.o"
+  "CMakeFiles/log.dir/source/log_aspect_stream.c.o.d"
+  "CMakeFiles/log.dir/source/log_handle.c.o"
+  "CMakeFiles/log.dir/source/log_handle.c.o.d"
+  "CMakeFiles/log.dir/source/log_impl.c.o"
+  "CMakeFiles/log.dir/source/log_impl.c.o.d"
+  "CMakeFiles/log.dir/source/log_level.c.o"
+  "CMakeFiles/log.dir/source/log_level.c.o.d"
+  "CMakeFiles/log.dir/source/log_map.c.o"
+  "CMakeFiles/log.dir/source/log_map.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy.c.o"
+  "CMakeFiles/log.dir/source/log_policy.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_format.c.o"
+  "CMakeFiles/log.dir/source/log_policy_format.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_format_binary.c.o"
+  "CMakeFiles/log.dir/source/log_policy_format_binary.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_format_custom.c.o"
+  "CMakeFiles/log.dir/source/log_policy_format_custom.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_format_text.c.o"
+  "CMakeFiles/log.dir/source/log_policy_format_text.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_schedule.c.o"
+  "CMakeFiles/log.dir/source/log_policy_schedule.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_schedule_async.c.o"
+  "CMakeFiles/log.dir/source/log_policy_schedule_async.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_schedule_sync.c.o"
+  "CMakeFiles/log.dir/source/log_policy_schedule_sync.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_storage.c.o"
+  "CMakeFiles/log.dir/source/log_policy_storage.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_storage_batch.c.o"
+  "CMakeFiles/log.dir/source/log_policy_storage_batch.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_storage_mmap.c.o"
+  "CMakeFiles/log.dir/source/log_policy_storage_mmap.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_storage_sequential.c.o"
+  "CMakeFiles/log.dir/source/log_policy_storage_sequential.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_stream.c.o"
+  "CMakeFiles/log.dir/source/log_policy_stream.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_stream_custom.c.o"
+  "CMakeFiles/log.dir/source/log_policy_stream_custom.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_stream_file.c.o"
+  "CMakeFiles/log.dir/source/log_policy_stream_file.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_stream_nginx.c.o"
+  "CMakeFiles/log.dir/source/log_policy_stream_nginx.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_stream_socket.c.o"
+  "CMakeFiles/log.dir/source/log_policy_stream_socket.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_stream_stdio.c.o"
+  "CMakeFiles/log.dir/source/log_policy_stream_stdio.c.o.d"
+  "CMakeFiles/log.dir/source/log_policy_stream_syslog.c.o"
+  "CMakeFiles/log.dir/source/log_policy_stream_syslog.c.o.d"
+  "CMakeFiles/log.dir/source/log_record.c.o"
+  "CMakeFiles/log.dir/source/log_record.c.o.d"
+  "CMakeFiles/log.dir/source/log_singleton.c.o"
+  "CMakeFiles/log.dir/source/log_singleton.c.o.d"
+  "CMakeFiles/log.dir/source/log_valid_size.c.o"
+  "CMakeFiles/log.dir/source/log_valid_size.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/log.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+#ifndef LOG_API_H
+#define LOG_API_H
+
+#ifdef LOG_STATIC_DEFINE
+#  define LOG_API
+#  define LOG_NO_EXPORT
+#else
+#  ifndef LOG_API
+#    ifdef LOG_EXPORTS
+        /* We are building this library */
+#      define LOG_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define LOG_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef LOG_NO_EXPORT
+#    define LOG_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef LOG_DEPRECATED
+#  define LOG_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef LOG_DEPRECATED_EXPORT
+#  define LOG_DEPRECATED_EXPORT LOG_API LOG_DEPRECATED
+#endif
+
+#ifndef LOG_DEPRECATED_NO_EXPORT
+#  define LOG_DEPRECATED_NO_EXPORT LOG_NO_EXPORT LOG_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef LOG_NO_DEPRECATED
+#    define LOG_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* LOG_API_H */
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memory.dir/source/memory.c.o"
+  "CMakeFiles/memory.dir/source/memory.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_arena.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_arena.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_arena_impl.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_arena_impl.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_nginx.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_nginx.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_nginx_impl.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_nginx_impl.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_shared.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_shared.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_shared_impl.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_shared_impl.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_std.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_std.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_std_impl.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_std_impl.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_trace.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_trace.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_trace_impl.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_trace_impl.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+#ifndef MEMORY_API_H
+#define MEMORY_API_H
+
+#ifdef MEMORY_STATIC_DEFINE
+#  define MEMORY_API
+#  define MEMORY_NO_EXPORT
+#else
+#  ifndef MEMORY_API
+#    ifdef MEMORY_EXPORTS
+        /* We are building this library */
+#      define MEMORY_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define MEMORY_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef MEMORY_NO_EXPORT
+#    define MEMORY_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef MEMORY_DEPRECATED
+#  define MEMORY_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef MEMORY_DEPRECATED_EXPORT
+#  define MEMORY_DEPRECATED_EXPORT MEMORY_API MEMORY_DEPRECATED
+#endif
+
+#ifndef MEMORY_DEPRECATED_NO_EXPORT
+#  define MEMORY_DEPRECATED_NO_EXPORT MEMORY_NO_EXPORT MEMORY_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef MEMORY_NO_DEPRECATED
+#    define MEMORY_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* MEMORY_API_H */
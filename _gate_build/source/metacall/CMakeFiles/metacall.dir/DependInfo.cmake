@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/metacall/source/metacall.c" "source/metacall/CMakeFiles/metacall.dir/source/metacall.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/source/metacall.c.o.d"
+  "/root/repo/source/metacall/source/metacall_allocator.c" "source/metacall/CMakeFiles/metacall.dir/source/metacall_allocator.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/source/metacall_allocator.c.o.d"
+  "/root/repo/source/metacall/source/metacall_graph.c" "source/metacall/CMakeFiles/metacall.dir/source/metacall_graph.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/source/metacall_graph.c.o.d"
+  "/root/repo/source/metacall/source/metacall_log.c" "source/metacall/CMakeFiles/metacall.dir/source/metacall_log.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/source/metacall_log.c.o.d"
+  "/root/repo/source/metacall/source/metacall_value.c" "source/metacall/CMakeFiles/metacall.dir/source/metacall_value.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/source/metacall_value.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
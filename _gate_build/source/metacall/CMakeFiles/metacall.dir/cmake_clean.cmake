@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../libmetacall.pdb"
+  "../../libmetacall.so"
+  "CMakeFiles/metacall.dir/source/metacall.c.o"
+  "CMakeFiles/metacall.dir/source/metacall.c.o.d"
+  "CMakeFiles/metacall.dir/source/metacall_allocator.c.o"
+  "CMakeFiles/metacall.dir/source/metacall_allocator.c.o.d"
+  "CMakeFiles/metacall.dir/source/metacall_graph.c.o"
+  "CMakeFiles/metacall.dir/source/metacall_graph.c.o.d"
+  "CMakeFiles/metacall.dir/source/metacall_log.c.o"
+  "CMakeFiles/metacall.dir/source/metacall_log.c.o.d"
+  "CMakeFiles/metacall.dir/source/metacall_value.c.o"
+  "CMakeFiles/metacall.dir/source/metacall_value.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/metacall.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,78 @@
+/*
+ *	CMake Versioning Utility by Parra Studios
+ *	A template for generating versioning utilities.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <metacall/metacall_version.h>
+
+/* -- Methods -- */
+
+const void * metacall_version_data()
+{
+	static const struct metacall_version_type version =
+	{
+		METACALL_VERSION_MAJOR_ID,
+		METACALL_VERSION_MINOR_ID,
+		METACALL_VERSION_PATCH_ID,
+		METACALL_VERSION_REVISION,
+		METACALL_VERSION,
+		METACALL_NAME_VERSION
+	};
+
+	return &version;
+}
+
+uint32_t metacall_version_hex_make(unsigned int major, unsigned int minor, unsigned int patch)
+{
+	const uint32_t version_hex = (major << 0x18) + (minor << 0x10) + patch;
+
+	return version_hex;
+}
+
+uint32_t metacall_version_hex()
+{
+	static const uint32_t version_hex =
+		(METACALL_VERSION_MAJOR_ID << 0x18) +
+		(METACALL_VERSION_MINOR_ID << 0x10) +
+		METACALL_VERSION_PATCH_ID;
+
+	return version_hex;
+}
+
+const char * metacall_version_str()
+{
+	static const char version_string[] = METACALL_VERSION;
+
+	return version_string;
+}
+
+const char * metacall_version_revision()
+{
+	static const char version_revision[] = METACALL_VERSION_REVISION;
+
+	return version_revision;
+}
+
+const char * metacall_version_name()
+{
+	static const char version_name[] = METACALL_NAME_VERSION;
+
+	return version_name;
+}
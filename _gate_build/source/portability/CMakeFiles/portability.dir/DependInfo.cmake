@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/portability/source/portability.c" "source/portability/CMakeFiles/portability.dir/source/portability.c.o" "gcc" "source/portability/CMakeFiles/portability.dir/source/portability.c.o.d"
+  "/root/repo/source/portability/source/portability_clock.c" "source/portability/CMakeFiles/portability.dir/source/portability_clock.c.o" "gcc" "source/portability/CMakeFiles/portability.dir/source/portability_clock.c.o.d"
+  "/root/repo/source/portability/source/portability_ipc.c" "source/portability/CMakeFiles/portability.dir/source/portability_ipc.c.o" "gcc" "source/portability/CMakeFiles/portability.dir/source/portability_ipc.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/portability.dir/source/portability.c.o"
+  "CMakeFiles/portability.dir/source/portability.c.o.d"
+  "CMakeFiles/portability.dir/source/portability_clock.c.o"
+  "CMakeFiles/portability.dir/source/portability_clock.c.o.d"
+  "CMakeFiles/portability.dir/source/portability_ipc.c.o"
+  "CMakeFiles/portability.dir/source/portability_ipc.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/portability.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+#ifndef PREPROCESSOR_API_H
+#define PREPROCESSOR_API_H
+
+#ifdef PREPROCESSOR_STATIC_DEFINE
+#  define PREPROCESSOR_API
+#  define PREPROCESSOR_NO_EXPORT
+#else
+#  ifndef PREPROCESSOR_API
+#    ifdef PREPROCESSOR_EXPORTS
+        /* We are building this library */
+#      define PREPROCESSOR_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define PREPROCESSOR_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef PREPROCESSOR_NO_EXPORT
+#    define PREPROCESSOR_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef PREPROCESSOR_DEPRECATED
+#  define PREPROCESSOR_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef PREPROCESSOR_DEPRECATED_EXPORT
+#  define PREPROCESSOR_DEPRECATED_EXPORT PREPROCESSOR_API PREPROCESSOR_DEPRECATED
+#endif
+
+#ifndef PREPROCESSOR_DEPRECATED_NO_EXPORT
+#  define PREPROCESSOR_DEPRECATED_NO_EXPORT PREPROCESSOR_NO_EXPORT PREPROCESSOR_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef PREPROCESSOR_NO_DEPRECATED
+#    define PREPROCESSOR_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* PREPROCESSOR_API_H */
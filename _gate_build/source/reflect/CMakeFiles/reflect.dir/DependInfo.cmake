@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/reflect/source/reflect.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect.c.o.d"
+  "/root/repo/source/reflect/source/reflect_class.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_class.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_class.c.o.d"
+  "/root/repo/source/reflect/source/reflect_context.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_context.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_context.c.o.d"
+  "/root/repo/source/reflect/source/reflect_function.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_function.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_function.c.o.d"
+  "/root/repo/source/reflect/source/reflect_future.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_future.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_future.c.o.d"
+  "/root/repo/source/reflect/source/reflect_object.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_object.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_object.c.o.d"
+  "/root/repo/source/reflect/source/reflect_scope.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_scope.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_scope.c.o.d"
+  "/root/repo/source/reflect/source/reflect_signature.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_signature.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_signature.c.o.d"
+  "/root/repo/source/reflect/source/reflect_stream.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_stream.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_stream.c.o.d"
+  "/root/repo/source/reflect/source/reflect_type.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_type.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_type.c.o.d"
+  "/root/repo/source/reflect/source/reflect_type_id.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_type_id.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_type_id.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_cast.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_cast.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_cast.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_demotion.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_demotion.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_demotion.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_id_size.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_id_size.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_id_size.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_promotion.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_promotion.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_promotion.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_traits.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_traits.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_traits.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/serial/source/serial.c" "source/serial/CMakeFiles/serial.dir/source/serial.c.o" "gcc" "source/serial/CMakeFiles/serial.dir/source/serial.c.o.d"
+  "/root/repo/source/serial/source/serial_buffer.c" "source/serial/CMakeFiles/serial.dir/source/serial_buffer.c.o" "gcc" "source/serial/CMakeFiles/serial.dir/source/serial_buffer.c.o.d"
+  "/root/repo/source/serial/source/serial_impl.c" "source/serial/CMakeFiles/serial.dir/source/serial_impl.c.o" "gcc" "source/serial/CMakeFiles/serial.dir/source/serial_impl.c.o.d"
+  "/root/repo/source/serial/source/serial_schema.c" "source/serial/CMakeFiles/serial.dir/source/serial_schema.c.o" "gcc" "source/serial/CMakeFiles/serial.dir/source/serial_schema.c.o.d"
+  "/root/repo/source/serial/source/serial_singleton.c" "source/serial/CMakeFiles/serial.dir/source/serial_singleton.c.o" "gcc" "source/serial/CMakeFiles/serial.dir/source/serial_singleton.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/serial.dir/source/serial.c.o"
+  "CMakeFiles/serial.dir/source/serial.c.o.d"
+  "CMakeFiles/serial.dir/source/serial_buffer.c.o"
+  "CMakeFiles/serial.dir/source/serial_buffer.c.o.d"
+  "CMakeFiles/serial.dir/source/serial_impl.c.o"
+  "CMakeFiles/serial.dir/source/serial_impl.c.o.d"
+  "CMakeFiles/serial.dir/source/serial_schema.c.o"
+  "CMakeFiles/serial.dir/source/serial_schema.c.o.d"
+  "CMakeFiles/serial.dir/source/serial_singleton.c.o"
+  "CMakeFiles/serial.dir/source/serial_singleton.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/threading/source/threading.c" "source/threading/CMakeFiles/threading.dir/source/threading.c.o" "gcc" "source/threading/CMakeFiles/threading.dir/source/threading.c.o.d"
+  "/root/repo/source/threading/source/threading_event.c" "source/threading/CMakeFiles/threading.dir/source/threading_event.c.o" "gcc" "source/threading/CMakeFiles/threading.dir/source/threading_event.c.o.d"
+  "/root/repo/source/threading/source/threading_mutex.c" "source/threading/CMakeFiles/threading.dir/source/threading_mutex.c.o" "gcc" "source/threading/CMakeFiles/threading.dir/source/threading_mutex.c.o.d"
+  "/root/repo/source/threading/source/threading_pool.c" "source/threading/CMakeFiles/threading.dir/source/threading_pool.c.o" "gcc" "source/threading/CMakeFiles/threading.dir/source/threading_pool.c.o.d"
+  "/root/repo/source/threading/source/threading_thread_id.c" "source/threading/CMakeFiles/threading.dir/source/threading_thread_id.c.o" "gcc" "source/threading/CMakeFiles/threading.dir/source/threading_thread_id.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
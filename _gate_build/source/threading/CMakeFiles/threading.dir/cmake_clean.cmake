@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/threading.dir/source/threading.c.o"
+  "CMakeFiles/threading.dir/source/threading.c.o.d"
+  "CMakeFiles/threading.dir/source/threading_event.c.o"
+  "CMakeFiles/threading.dir/source/threading_event.c.o.d"
+  "CMakeFiles/threading.dir/source/threading_mutex.c.o"
+  "CMakeFiles/threading.dir/source/threading_mutex.c.o.d"
+  "CMakeFiles/threading.dir/source/threading_pool.c.o"
+  "CMakeFiles/threading.dir/source/threading_pool.c.o.d"
+  "CMakeFiles/threading.dir/source/threading_thread_id.c.o"
+  "CMakeFiles/threading.dir/source/threading_thread_id.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/threading.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/version.dir/__/metacall/source/metacall_version.c.o"
+  "CMakeFiles/version.dir/__/metacall/source/metacall_version.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,76 @@
+#
+#	Benchmark Gate by Parra Studios
+#	Utility for registering benchmarks as regression gated tests.
+#
+#	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+#
+#	Licensed under the Apache License, Version 2.0 (the "License");
+#	you may not use this file except in compliance with the License.
+#	You may obtain a copy of the License at
+#
+#		http://www.apache.org/licenses/LICENSE-2.0
+#
+#	Unless required by applicable law or agreed to in writing, software
+#	distributed under the License is distributed on an "AS IS" BASIS,
+#	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#	See the License for the specific language governing permissions and
+#	limitations under the License.
+#
+
+if(BENCHMARK_GATE_FOUND)
+	return()
+endif()
+
+set(BENCHMARK_GATE_FOUND YES)
+
+get_filename_component(BENCHMARK_GATE_PATH ${CMAKE_CURRENT_LIST_FILE} PATH)
+
+# Baselines are machine local (timings do not transfer between hosts),
+# stored under a per-hostname directory so a shared location can serve
+# several machines; override the root to persist them across build trees
+set(OPTION_BENCHMARK_BASELINE_DIR "${PROJECT_BINARY_DIR}/benchmarks/baselines" CACHE PATH "Root directory where benchmark baselines are stored per machine")
+
+#
+# Register the benchmark @target as a CTest test that runs it with
+# repetitions, computes a median with MAD based outlier rejection per
+# benchmark and compares it against the machine stored baseline,
+# failing the test when the regression threshold is exceeded.
+#
+# benchmark_gate(<target>
+#	[THRESHOLD <percent>]		# Allowed regression over the baseline (default 5)
+#	[REPETITIONS <count>]		# Benchmark repetitions for the statistics (default 8)
+# )
+#
+# The first run on a machine records the baseline and passes. Set the
+# environment variable BENCHMARK_BASELINE_UPDATE to rewrite it (after
+# an accepted performance change or a hardware swap).
+#
+function(benchmark_gate target)
+
+	set(options)
+	set(one_value_args THRESHOLD REPETITIONS)
+	set(multi_value_args)
+
+	cmake_parse_arguments(BENCHMARK_GATE "${options}" "${one_value_args}" "${multi_value_args}" ${ARGN})
+
+	if(NOT BENCHMARK_GATE_THRESHOLD)
+		set(BENCHMARK_GATE_THRESHOLD 5)
+	endif()
+
+	if(NOT BENCHMARK_GATE_REPETITIONS)
+		set(BENCHMARK_GATE_REPETITIONS 8)
+	endif()
+
+	cmake_host_system_information(RESULT benchmark_gate_host QUERY HOSTNAME)
+
+	add_test(NAME ${target}
+		COMMAND ${CMAKE_COMMAND}
+			-DBENCHMARK_EXECUTABLE=$<TARGET_FILE:${target}>
+			-DBENCHMARK_NAME=${target}
+			-DBENCHMARK_BASELINE_FILE=${OPTION_BENCHMARK_BASELINE_DIR}/${benchmark_gate_host}/${target}.baseline
+			-DBENCHMARK_THRESHOLD=${BENCHMARK_GATE_THRESHOLD}
+			-DBENCHMARK_REPETITIONS=${BENCHMARK_GATE_REPETITIONS}
+			-P ${BENCHMARK_GATE_PATH}/BenchmarkGateRunner.cmake
+	)
+
+endfunction()
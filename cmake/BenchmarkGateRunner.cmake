@@ -0,0 +1,224 @@
+#
+#	Benchmark Gate Runner by Parra Studios
+#	Script running a benchmark and gating it against its baseline.
+#
+#	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+#
+#	Licensed under the Apache License, Version 2.0 (the "License");
+#	you may not use this file except in compliance with the License.
+#	You may obtain a copy of the License at
+#
+#		http://www.apache.org/licenses/LICENSE-2.0
+#
+#	Unless required by applicable law or agreed to in writing, software
+#	distributed under the License is distributed on an "AS IS" BASIS,
+#	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#	See the License for the specific language governing permissions and
+#	limitations under the License.
+#
+
+# Expects:
+#	BENCHMARK_EXECUTABLE	Path to the benchmark binary
+#	BENCHMARK_NAME			Name of the benchmark target
+#	BENCHMARK_BASELINE_FILE	Machine local baseline file
+#	BENCHMARK_THRESHOLD		Allowed regression over the baseline (percent)
+#	BENCHMARK_REPETITIONS	Benchmark repetitions for the statistics
+
+# Median of the integer samples held by the variable named @list_var
+function(benchmark_gate_median list_var result_var)
+	set(samples ${${list_var}})
+
+	list(SORT samples COMPARE NATURAL)
+
+	list(LENGTH samples size)
+
+	math(EXPR middle "${size} / 2")
+
+	list(GET samples ${middle} median)
+
+	set(${result_var} ${median} PARENT_SCOPE)
+endfunction()
+
+# Median with outlier rejection: samples farther than three times the
+# median absolute deviation from the median are discarded (this also
+# drops warm up repetitions that ran on cold caches) and the median is
+# recomputed over the survivors
+function(benchmark_gate_filtered_median list_var result_var)
+	benchmark_gate_median(${list_var} median)
+
+	set(deviations)
+
+	foreach(sample ${${list_var}})
+		math(EXPR deviation "${sample} - ${median}")
+
+		if(deviation LESS 0)
+			math(EXPR deviation "0 - ${deviation}")
+		endif()
+
+		list(APPEND deviations ${deviation})
+	endforeach()
+
+	benchmark_gate_median(deviations mad)
+
+	math(EXPR limit "3 * ${mad}")
+
+	set(survivors)
+
+	foreach(sample ${${list_var}})
+		math(EXPR deviation "${sample} - ${median}")
+
+		if(deviation LESS 0)
+			math(EXPR deviation "0 - ${deviation}")
+		endif()
+
+		if(NOT deviation GREATER limit)
+			list(APPEND survivors ${sample})
+		endif()
+	endforeach()
+
+	if(NOT survivors)
+		set(survivors ${${list_var}})
+	endif()
+
+	benchmark_gate_median(survivors filtered)
+
+	set(${result_var} ${filtered} PARENT_SCOPE)
+endfunction()
+
+# The statistics need string(JSON ...), degrade to a plain run when the
+# CMake driving CTest predates it
+if(CMAKE_VERSION VERSION_LESS "3.19")
+	message(STATUS "Benchmark gate needs CMake >= 3.19, running ${BENCHMARK_NAME} without regression gating")
+
+	execute_process(COMMAND "${BENCHMARK_EXECUTABLE}" RESULT_VARIABLE benchmark_result)
+
+	if(NOT benchmark_result EQUAL 0)
+		message(FATAL_ERROR "Benchmark ${BENCHMARK_NAME} failed (${benchmark_result})")
+	endif()
+
+	return()
+endif()
+
+cmake_policy(VERSION 3.19)
+
+get_filename_component(benchmark_output_path "${BENCHMARK_BASELINE_FILE}" PATH)
+
+file(MAKE_DIRECTORY "${benchmark_output_path}")
+
+set(benchmark_output_file "${BENCHMARK_BASELINE_FILE}.json")
+
+execute_process(COMMAND "${BENCHMARK_EXECUTABLE}"
+	--benchmark_repetitions=${BENCHMARK_REPETITIONS}
+	--benchmark_out=${benchmark_output_file}
+	--benchmark_out_format=json
+	RESULT_VARIABLE benchmark_result
+)
+
+if(NOT benchmark_result EQUAL 0)
+	message(FATAL_ERROR "Benchmark ${BENCHMARK_NAME} failed (${benchmark_result})")
+endif()
+
+file(READ "${benchmark_output_file}" benchmark_json)
+
+string(JSON benchmark_count LENGTH "${benchmark_json}" benchmarks)
+
+# Group the repetition samples by benchmark name, skipping the
+# aggregate entries that the repetitions produce
+set(benchmark_names)
+
+math(EXPR benchmark_last "${benchmark_count} - 1")
+
+foreach(benchmark_index RANGE ${benchmark_last})
+	string(JSON benchmark_entry GET "${benchmark_json}" benchmarks ${benchmark_index})
+
+	string(JSON benchmark_entry_name GET "${benchmark_entry}" name)
+
+	if(benchmark_entry_name MATCHES "(_mean|_median|_stddev|_cv)$")
+		continue()
+	endif()
+
+	string(JSON benchmark_entry_time GET "${benchmark_entry}" real_time)
+
+	# Integer nanoseconds are enough resolution for the gate
+	if(NOT benchmark_entry_time MATCHES "^([0-9]+)")
+		continue()
+	endif()
+
+	set(benchmark_entry_time ${CMAKE_MATCH_1})
+
+	string(MAKE_C_IDENTIFIER "${benchmark_entry_name}" benchmark_entry_id)
+
+	if(NOT benchmark_entry_name IN_LIST benchmark_names)
+		list(APPEND benchmark_names "${benchmark_entry_name}")
+
+		set(benchmark_ids_${benchmark_entry_id} "${benchmark_entry_name}")
+
+		set(benchmark_samples_${benchmark_entry_id})
+	endif()
+
+	list(APPEND benchmark_samples_${benchmark_entry_id} ${benchmark_entry_time})
+endforeach()
+
+# Load the baseline (one "<name>;<nanoseconds>" entry per line)
+set(benchmark_baseline_names)
+
+if(EXISTS "${BENCHMARK_BASELINE_FILE}" AND NOT DEFINED ENV{BENCHMARK_BASELINE_UPDATE})
+	file(STRINGS "${BENCHMARK_BASELINE_FILE}" benchmark_baseline_lines)
+
+	foreach(benchmark_baseline_line ${benchmark_baseline_lines})
+		string(REGEX MATCH "^(.+)=([0-9]+)$" benchmark_baseline_match "${benchmark_baseline_line}")
+
+		if(benchmark_baseline_match)
+			string(MAKE_C_IDENTIFIER "${CMAKE_MATCH_1}" benchmark_baseline_id)
+
+			list(APPEND benchmark_baseline_names "${CMAKE_MATCH_1}")
+
+			set(benchmark_baseline_${benchmark_baseline_id} ${CMAKE_MATCH_2})
+		endif()
+	endforeach()
+endif()
+
+set(benchmark_failures)
+
+set(benchmark_baseline_content "")
+
+foreach(benchmark_entry_name ${benchmark_names})
+	string(MAKE_C_IDENTIFIER "${benchmark_entry_name}" benchmark_entry_id)
+
+	# Drop the first repetition as warm up when there are enough samples
+	list(LENGTH benchmark_samples_${benchmark_entry_id} benchmark_sample_count)
+
+	if(benchmark_sample_count GREATER 2)
+		list(REMOVE_AT benchmark_samples_${benchmark_entry_id} 0)
+	endif()
+
+	benchmark_gate_filtered_median(benchmark_samples_${benchmark_entry_id} benchmark_entry_median)
+
+	if(benchmark_entry_name IN_LIST benchmark_baseline_names)
+		set(benchmark_entry_baseline ${benchmark_baseline_${benchmark_entry_id}})
+
+		math(EXPR benchmark_entry_limit "${benchmark_entry_baseline} * (100 + ${BENCHMARK_THRESHOLD}) / 100")
+
+		if(benchmark_entry_median GREATER benchmark_entry_limit)
+			list(APPEND benchmark_failures "${benchmark_entry_name}: ${benchmark_entry_median}ns > ${benchmark_entry_limit}ns (baseline ${benchmark_entry_baseline}ns + ${BENCHMARK_THRESHOLD}%)")
+		else()
+			message(STATUS "${benchmark_entry_name}: ${benchmark_entry_median}ns within ${benchmark_entry_limit}ns (baseline ${benchmark_entry_baseline}ns + ${BENCHMARK_THRESHOLD}%)")
+		endif()
+
+		# Baselines only move on explicit update, a faster run today
+		# must not mask a regression tomorrow
+		string(APPEND benchmark_baseline_content "${benchmark_entry_name}=${benchmark_entry_baseline}\n")
+	else()
+		message(STATUS "${benchmark_entry_name}: recording baseline ${benchmark_entry_median}ns")
+
+		string(APPEND benchmark_baseline_content "${benchmark_entry_name}=${benchmark_entry_median}\n")
+	endif()
+endforeach()
+
+file(WRITE "${BENCHMARK_BASELINE_FILE}" "${benchmark_baseline_content}")
+
+if(benchmark_failures)
+	string(REPLACE ";" "\n" benchmark_failures "${benchmark_failures}")
+
+	message(FATAL_ERROR "Benchmark ${BENCHMARK_NAME} regression gate failed:\n${benchmark_failures}")
+endif()
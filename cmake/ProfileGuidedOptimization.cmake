@@ -0,0 +1,119 @@
+#
+#	Profile Guided Optimization by Parra Studios
+#	Utility for building libmetacall with training profiles and LTO.
+#
+#	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+#
+#	Licensed under the Apache License, Version 2.0 (the "License");
+#	you may not use this file except in compliance with the License.
+#	You may obtain a copy of the License at
+#
+#		http://www.apache.org/licenses/LICENSE-2.0
+#
+#	Unless required by applicable law or agreed to in writing, software
+#	distributed under the License is distributed on an "AS IS" BASIS,
+#	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#	See the License for the specific language governing permissions and
+#	limitations under the License.
+#
+
+if(PROFILE_GUIDED_OPTIMIZATION_FOUND)
+	return()
+endif()
+
+set(PROFILE_GUIDED_OPTIMIZATION_FOUND YES)
+
+get_filename_component(PROFILE_GUIDED_OPTIMIZATION_PATH ${CMAKE_CURRENT_LIST_FILE} PATH)
+
+# Directory where the instrumented build writes its profiles and the
+# optimized build reads them back; shared between the two phases so it
+# defaults to a location outside of both build trees
+set(OPTION_PGO_PROFILE_DIR "${PROJECT_BINARY_DIR}/pgo/profiles" CACHE PATH "Directory where profile guided optimization data is collected and consumed")
+
+if(OPTION_PGO_INSTRUMENT AND OPTION_PGO_OPTIMIZE)
+	message(FATAL_ERROR "OPTION_PGO_INSTRUMENT and OPTION_PGO_OPTIMIZE are mutually exclusive, the pipeline builds them as two separate trees")
+endif()
+
+if(OPTION_PGO_OPTIMIZE)
+	include(CheckIPOSupported)
+
+	check_ipo_supported(RESULT PGO_IPO_SUPPORTED OUTPUT PGO_IPO_OUTPUT)
+
+	if(NOT PGO_IPO_SUPPORTED)
+		message(STATUS "Link time optimization not supported, building with profiles only (${PGO_IPO_OUTPUT})")
+	endif()
+endif()
+
+#
+# Apply the profile guided optimization phase flags to @target. The
+# call path crosses many small functions spread over separate
+# translation units (metacall -> loader -> reflect -> adt), so the
+# optimized phase additionally enables link time optimization on the
+# targets, letting the collected profiles drive cross unit inlining
+# decisions when the object libraries are folded into libmetacall.
+#
+function(pgo_core_target target)
+
+	if(NOT OPTION_PGO_INSTRUMENT AND NOT OPTION_PGO_OPTIMIZE)
+		return()
+	endif()
+
+	get_target_property(target_type ${target} TYPE)
+
+	if(OPTION_PGO_INSTRUMENT)
+		if("${CMAKE_C_COMPILER_ID}" STREQUAL "GNU")
+			# Atomic profile updates, the training workload is threaded
+			target_compile_options(${target} PRIVATE -fprofile-generate=${OPTION_PGO_PROFILE_DIR} -fprofile-update=atomic)
+
+			if(NOT "${target_type}" STREQUAL "OBJECT_LIBRARY")
+				target_link_libraries(${target} PRIVATE -fprofile-generate=${OPTION_PGO_PROFILE_DIR})
+			endif()
+		elseif("${CMAKE_C_COMPILER_ID}" MATCHES "Clang")
+			target_compile_options(${target} PRIVATE -fprofile-instr-generate=${OPTION_PGO_PROFILE_DIR}/metacall-%m.profraw)
+
+			if(NOT "${target_type}" STREQUAL "OBJECT_LIBRARY")
+				target_link_libraries(${target} PRIVATE -fprofile-instr-generate=${OPTION_PGO_PROFILE_DIR}/metacall-%m.profraw)
+			endif()
+		else()
+			message(STATUS "Profile guided optimization not supported for compiler ${CMAKE_C_COMPILER_ID}, target ${target} builds without instrumentation")
+		endif()
+	else()
+		if("${CMAKE_C_COMPILER_ID}" STREQUAL "GNU")
+			# Profile correction tolerates counters merged from
+			# training runs that did not exit cleanly, the missing
+			# profile warning is silenced for cold translation units
+			# the training workload never reached
+			target_compile_options(${target} PRIVATE -fprofile-use=${OPTION_PGO_PROFILE_DIR} -fprofile-correction -Wno-missing-profile)
+		elseif("${CMAKE_C_COMPILER_ID}" MATCHES "Clang")
+			target_compile_options(${target} PRIVATE -fprofile-instr-use=${OPTION_PGO_PROFILE_DIR}/metacall.profdata -Wno-profile-instr-unprofiled -Wno-profile-instr-out-of-date)
+		else()
+			message(STATUS "Profile guided optimization not supported for compiler ${CMAKE_C_COMPILER_ID}, target ${target} builds without profiles")
+		endif()
+
+		if(PGO_IPO_SUPPORTED)
+			set_target_properties(${target} PROPERTIES INTERPROCEDURAL_OPTIMIZATION TRUE)
+		endif()
+	endif()
+
+endfunction()
+
+#
+# Driver target for the whole pipeline, available from a regular tree:
+# it builds an instrumented libmetacall in a nested tree, trains it
+# with the mock loader driven core tests and the built benchmarks,
+# merges the profiles and builds the optimized tree
+#
+if(NOT OPTION_PGO_INSTRUMENT AND NOT OPTION_PGO_OPTIMIZE)
+	add_custom_target(pgo
+		COMMAND ${CMAKE_COMMAND}
+			-D "PGO_SOURCE_DIR=${PROJECT_SOURCE_DIR}"
+			-D "PGO_BINARY_DIR=${PROJECT_BINARY_DIR}/pgo"
+			-D "PGO_PROFILE_DIR=${OPTION_PGO_PROFILE_DIR}"
+			-D "PGO_GENERATOR=${CMAKE_GENERATOR}"
+			-D "PGO_C_COMPILER=${CMAKE_C_COMPILER}"
+			-D "PGO_CXX_COMPILER=${CMAKE_CXX_COMPILER}"
+			-P "${PROFILE_GUIDED_OPTIMIZATION_PATH}/ProfileGuidedOptimizationRunner.cmake"
+		COMMENT "Building libmetacall with profile guided optimization"
+		VERBATIM
+	)
+endif()
@@ -0,0 +1,161 @@
+#
+#	Profile Guided Optimization Runner by Parra Studios
+#	Script driving the instrument, train and optimize pipeline.
+#
+#	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+#
+#	Licensed under the Apache License, Version 2.0 (the "License");
+#	you may not use this file except in compliance with the License.
+#	You may obtain a copy of the License at
+#
+#		http://www.apache.org/licenses/LICENSE-2.0
+#
+#	Unless required by applicable law or agreed to in writing, software
+#	distributed under the License is distributed on an "AS IS" BASIS,
+#	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#	See the License for the specific language governing permissions and
+#	limitations under the License.
+#
+
+# Expects:
+#	PGO_SOURCE_DIR		Source tree root
+#	PGO_BINARY_DIR		Root for the instrumented and optimized trees
+#	PGO_PROFILE_DIR		Directory collecting the training profiles
+#	PGO_GENERATOR		CMake generator of the parent tree
+#	PGO_C_COMPILER		C compiler of the parent tree
+#	PGO_CXX_COMPILER	C++ compiler of the parent tree
+
+set(PGO_INSTRUMENTED_DIR "${PGO_BINARY_DIR}/instrumented")
+set(PGO_OPTIMIZED_DIR "${PGO_BINARY_DIR}/optimized")
+
+file(MAKE_DIRECTORY "${PGO_PROFILE_DIR}")
+
+#
+# Phase 1: instrumented tree
+#
+
+message(STATUS "PGO phase 1: building the instrumented tree")
+
+execute_process(
+	COMMAND ${CMAKE_COMMAND}
+		-S "${PGO_SOURCE_DIR}"
+		-B "${PGO_INSTRUMENTED_DIR}"
+		-G "${PGO_GENERATOR}"
+		-D "CMAKE_C_COMPILER=${PGO_C_COMPILER}"
+		-D "CMAKE_CXX_COMPILER=${PGO_CXX_COMPILER}"
+		-D "CMAKE_BUILD_TYPE=Release"
+		-D "OPTION_PGO_INSTRUMENT=ON"
+		-D "OPTION_PGO_PROFILE_DIR=${PGO_PROFILE_DIR}"
+		-D "OPTION_BUILD_BENCHMARKS=ON"
+	RESULT_VARIABLE configure_result
+)
+
+if(NOT configure_result EQUAL 0)
+	message(FATAL_ERROR "PGO instrumented tree configuration failed")
+endif()
+
+execute_process(
+	COMMAND ${CMAKE_COMMAND} --build "${PGO_INSTRUMENTED_DIR}" --parallel
+	RESULT_VARIABLE build_result
+)
+
+if(NOT build_result EQUAL 0)
+	message(FATAL_ERROR "PGO instrumented tree build failed")
+endif()
+
+#
+# Phase 2: training workload
+#
+# The mock loader driven core tests replay the load, discover, call
+# and destroy paths and the benchmarks stress the hot call dispatch;
+# individual training failures are tolerated, partial profiles still
+# improve the optimized build
+#
+
+message(STATUS "PGO phase 2: training")
+
+execute_process(
+	COMMAND ${CMAKE_COMMAND} -E env CTEST_OUTPUT_ON_FAILURE=0
+		ctest --test-dir "${PGO_INSTRUMENTED_DIR}" -R "metacall-(test|clear-test|inspect-test|load-memory-test|handle-get-test|handle-export-test|duplicated-handle-test|init-fini-test|initialize-test)"
+	RESULT_VARIABLE training_result
+)
+
+if(NOT training_result EQUAL 0)
+	message(STATUS "PGO training tests reported failures, continuing with the collected profiles")
+endif()
+
+foreach(benchmark
+	metacall-call-matrix-bench
+	metacall-alloc-bench
+	log-bench)
+
+	if(EXISTS "${PGO_INSTRUMENTED_DIR}/${benchmark}")
+		message(STATUS "PGO training benchmark ${benchmark}")
+
+		execute_process(
+			COMMAND "${PGO_INSTRUMENTED_DIR}/${benchmark}" --benchmark_min_time=1
+			RESULT_VARIABLE benchmark_result
+		)
+
+		if(NOT benchmark_result EQUAL 0)
+			message(STATUS "PGO training benchmark ${benchmark} failed, continuing")
+		endif()
+	endif()
+endforeach()
+
+#
+# Phase 3: profile merge (Clang only, GCC consumes its counters as is)
+#
+
+file(GLOB profile_raw_files "${PGO_PROFILE_DIR}/*.profraw")
+
+if(profile_raw_files)
+	find_program(PGO_LLVM_PROFDATA llvm-profdata)
+
+	if(NOT PGO_LLVM_PROFDATA)
+		message(FATAL_ERROR "llvm-profdata is required to merge the raw Clang profiles")
+	endif()
+
+	execute_process(
+		COMMAND ${PGO_LLVM_PROFDATA} merge -output "${PGO_PROFILE_DIR}/metacall.profdata" ${profile_raw_files}
+		RESULT_VARIABLE merge_result
+	)
+
+	if(NOT merge_result EQUAL 0)
+		message(FATAL_ERROR "PGO profile merge failed")
+	endif()
+endif()
+
+#
+# Phase 4: optimized tree
+#
+
+message(STATUS "PGO phase 4: building the optimized tree")
+
+execute_process(
+	COMMAND ${CMAKE_COMMAND}
+		-S "${PGO_SOURCE_DIR}"
+		-B "${PGO_OPTIMIZED_DIR}"
+		-G "${PGO_GENERATOR}"
+		-D "CMAKE_C_COMPILER=${PGO_C_COMPILER}"
+		-D "CMAKE_CXX_COMPILER=${PGO_CXX_COMPILER}"
+		-D "CMAKE_BUILD_TYPE=Release"
+		-D "OPTION_PGO_OPTIMIZE=ON"
+		-D "OPTION_PGO_PROFILE_DIR=${PGO_PROFILE_DIR}"
+	RESULT_VARIABLE configure_result
+)
+
+if(NOT configure_result EQUAL 0)
+	message(FATAL_ERROR "PGO optimized tree configuration failed")
+endif()
+
+execute_process(
+	COMMAND ${CMAKE_COMMAND} --build "${PGO_OPTIMIZED_DIR}" --parallel
+	RESULT_VARIABLE build_result
+)
+
+if(NOT build_result EQUAL 0)
+	message(FATAL_ERROR "PGO optimized tree build failed")
+endif()
+
+message(STATUS "PGO pipeline finished, the optimized libmetacall is under ${PGO_OPTIMIZED_DIR}")
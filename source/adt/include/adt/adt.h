@@ -25,6 +25,10 @@
 
 #include <adt/adt_comparable.h>
 #include <adt/adt_hash.h>
+#include <adt/adt_hashmap.h>
+#include <adt/adt_hashmap_concurrent.h>
+#include <adt/adt_radix_tree.h>
+#include <adt/adt_string_pool.h>
 #include <adt/adt_trie.h>
 #include <adt/adt_vector.h>
 
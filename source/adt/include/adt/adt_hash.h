@@ -27,6 +27,10 @@
 extern "C" {
 #endif
 
+/* -- Headers -- */
+
+#include <stdint.h>
+
 /* -- Type Definitions -- */
 
 typedef unsigned int hash;
@@ -39,6 +43,12 @@ typedef hash (*hash_callback)(const hash_key);
 
 ADT_API hash hash_callback_str(const hash_key key);
 
+ADT_API hash hash_callback_str_fast(const hash_key key);
+
+ADT_API hash hash_callback_ptr(const hash_key key);
+
+ADT_API hash hash_callback_uintptr(uintptr_t key);
+
 #ifdef __cplusplus
 }
 #endif
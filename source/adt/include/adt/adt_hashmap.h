@@ -0,0 +1,103 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A abstract data type library providing generic containers.
+ *
+ */
+
+#ifndef ADT_HASHMAP_H
+#define ADT_HASHMAP_H 1
+
+/* -- Headers -- */
+
+#include <adt/adt_api.h>
+
+#include <adt/adt_comparable.h>
+#include <adt/adt_hash.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Headers -- */
+
+#include <stdlib.h>
+
+/* -- Forward Declarations -- */
+
+struct hashmap_type;
+
+struct hashmap_cursor_type;
+
+/* -- Type Definitions -- */
+
+typedef struct hashmap_type *hashmap;
+
+typedef hash hashmap_hash;
+
+typedef comparable hashmap_key;
+
+typedef void *hashmap_value;
+
+typedef void *hashmap_cb_iterate_args;
+
+typedef hash_callback hashmap_cb_hash;
+
+typedef comparable_callback hashmap_cb_compare;
+
+typedef int (*hashmap_cb_iterate)(hashmap, hashmap_key, hashmap_value, hashmap_cb_iterate_args);
+
+typedef struct hashmap_cursor_type *hashmap_cursor;
+
+/* -- Member Data -- */
+
+/* Caller owned traversal state for allocation free iteration,
+the members must be treated as opaque */
+struct hashmap_cursor_type
+{
+	hashmap map;
+	size_t slot;
+};
+
+/* -- Methods -- */
+
+ADT_API hashmap hashmap_create(hashmap_cb_hash hash_cb, hashmap_cb_compare compare_cb);
+
+ADT_API size_t hashmap_size(hashmap map);
+
+ADT_API int hashmap_insert(hashmap map, hashmap_key key, hashmap_value value);
+
+ADT_API hashmap_value hashmap_get(hashmap map, hashmap_key key);
+
+ADT_API int hashmap_contains(hashmap map, hashmap_key key);
+
+ADT_API int hashmap_contains_any(hashmap dest, hashmap src);
+
+ADT_API hashmap_value hashmap_remove(hashmap map, hashmap_key key);
+
+ADT_API void hashmap_iterate(hashmap map, hashmap_cb_iterate iterate_cb, hashmap_cb_iterate_args args);
+
+ADT_API int hashmap_append(hashmap dest, hashmap src);
+
+ADT_API int hashmap_disjoint(hashmap dest, hashmap src);
+
+ADT_API int hashmap_clear(hashmap map);
+
+ADT_API void hashmap_destroy(hashmap map);
+
+ADT_API void hashmap_cursor_begin(hashmap map, hashmap_cursor cursor);
+
+ADT_API int hashmap_cursor_end(hashmap_cursor cursor);
+
+ADT_API void hashmap_cursor_next(hashmap_cursor cursor);
+
+ADT_API hashmap_key hashmap_cursor_key(hashmap_cursor cursor);
+
+ADT_API hashmap_value hashmap_cursor_value(hashmap_cursor cursor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADT_HASHMAP_H */
@@ -0,0 +1,60 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A abstract data type library providing generic containers.
+ *
+ */
+
+#ifndef ADT_HASHMAP_CONCURRENT_H
+#define ADT_HASHMAP_CONCURRENT_H 1
+
+/* -- Headers -- */
+
+#include <adt/adt_api.h>
+
+#include <adt/adt_hashmap.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Headers -- */
+
+#include <stdlib.h>
+
+/* -- Forward Declarations -- */
+
+struct hashmap_concurrent_type;
+
+/* -- Type Definitions -- */
+
+typedef struct hashmap_concurrent_type *hashmap_concurrent;
+
+typedef int (*hashmap_concurrent_cb_iterate)(hashmap_concurrent, hashmap_key, hashmap_value, hashmap_cb_iterate_args);
+
+/* -- Methods -- */
+
+ADT_API hashmap_concurrent hashmap_concurrent_create(hashmap_cb_hash hash_cb, hashmap_cb_compare compare_cb);
+
+ADT_API size_t hashmap_concurrent_size(hashmap_concurrent map);
+
+ADT_API int hashmap_concurrent_insert(hashmap_concurrent map, hashmap_key key, hashmap_value value);
+
+ADT_API hashmap_value hashmap_concurrent_get(hashmap_concurrent map, hashmap_key key);
+
+ADT_API int hashmap_concurrent_contains(hashmap_concurrent map, hashmap_key key);
+
+ADT_API hashmap_value hashmap_concurrent_remove(hashmap_concurrent map, hashmap_key key);
+
+ADT_API void hashmap_concurrent_iterate(hashmap_concurrent map, hashmap_concurrent_cb_iterate iterate_cb, hashmap_cb_iterate_args args);
+
+ADT_API int hashmap_concurrent_clear(hashmap_concurrent map);
+
+ADT_API void hashmap_concurrent_destroy(hashmap_concurrent map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADT_HASHMAP_CONCURRENT_H */
@@ -0,0 +1,64 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A abstract data type library providing generic containers.
+ *
+ */
+
+#ifndef ADT_RADIX_TREE_H
+#define ADT_RADIX_TREE_H 1
+
+/* -- Headers -- */
+
+#include <adt/adt_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Headers -- */
+
+#include <stdlib.h>
+
+/* -- Forward Declarations -- */
+
+struct radix_tree_type;
+
+/* -- Type Definitions -- */
+
+typedef struct radix_tree_type *radix_tree;
+
+typedef void *radix_tree_value;
+
+typedef void *radix_tree_cb_iterate_args;
+
+typedef int (*radix_tree_cb_iterate)(radix_tree, const char *, radix_tree_value, radix_tree_cb_iterate_args);
+
+/* -- Methods -- */
+
+ADT_API radix_tree radix_tree_create(void);
+
+ADT_API size_t radix_tree_size(radix_tree tree);
+
+ADT_API int radix_tree_insert(radix_tree tree, const char *key, radix_tree_value value);
+
+ADT_API radix_tree_value radix_tree_get(radix_tree tree, const char *key);
+
+ADT_API int radix_tree_contains(radix_tree tree, const char *key);
+
+ADT_API radix_tree_value radix_tree_match(radix_tree tree, const char *key);
+
+ADT_API radix_tree_value radix_tree_remove(radix_tree tree, const char *key);
+
+ADT_API void radix_tree_iterate(radix_tree tree, radix_tree_cb_iterate iterate_cb, radix_tree_cb_iterate_args args);
+
+ADT_API int radix_tree_clear(radix_tree tree);
+
+ADT_API void radix_tree_destroy(radix_tree tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADT_RADIX_TREE_H */
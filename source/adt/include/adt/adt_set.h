@@ -30,6 +30,8 @@ struct set_type;
 
 struct set_iterator_type;
 
+struct set_cursor_type;
+
 /* -- Type Definitions -- */
 
 typedef struct set_type *set;
@@ -50,10 +52,27 @@ typedef int (*set_cb_iterate)(set, set_key, set_value, set_cb_iterate_args);
 
 typedef struct set_iterator_type *set_iterator;
 
+typedef struct set_cursor_type *set_cursor;
+
+/* -- Member Data -- */
+
+/* Caller owned traversal state for allocation free iteration,
+the members must be treated as opaque */
+struct set_cursor_type
+{
+	set s;
+	size_t bucket;
+	size_t pair;
+};
+
 /* -- Methods -- */
 
 ADT_API set set_create(set_cb_hash hash_cb, set_cb_compare compare_cb);
 
+/* Create a set whose bucket array already holds @capacity elements
+without rehashing */
+ADT_API set set_create_reserve(set_cb_hash hash_cb, set_cb_compare compare_cb, size_t capacity);
+
 ADT_API size_t set_size(set s);
 
 ADT_API int set_insert(set s, set_key key, set_value value);
@@ -76,6 +95,10 @@ ADT_API int set_disjoint(set dest, set src);
 
 ADT_API int set_clear(set s);
 
+/* Shrink the table and the per bucket pair arrays to the current
+contents, for sets that become effectively immutable after load */
+ADT_API int set_compact(set s);
+
 ADT_API void set_destroy(set s);
 
 ADT_API set_iterator set_iterator_begin(set s);
@@ -88,6 +111,16 @@ ADT_API void set_iterator_next(set_iterator it);
 
 ADT_API int set_iterator_end(set_iterator *it);
 
+ADT_API void set_cursor_begin(set s, set_cursor cursor);
+
+ADT_API int set_cursor_end(set_cursor cursor);
+
+ADT_API void set_cursor_next(set_cursor cursor);
+
+ADT_API set_key set_cursor_key(set_cursor cursor);
+
+ADT_API set_value set_cursor_value(set_cursor cursor);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,50 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A abstract data type library providing generic containers.
+ *
+ */
+
+#ifndef ADT_STRING_POOL_H
+#define ADT_STRING_POOL_H 1
+
+/* -- Headers -- */
+
+#include <adt/adt_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Headers -- */
+
+#include <stdlib.h>
+
+/* -- Forward Declarations -- */
+
+struct string_pool_type;
+
+/* -- Type Definitions -- */
+
+typedef struct string_pool_type *string_pool;
+
+/* -- Methods -- */
+
+ADT_API string_pool string_pool_create(void);
+
+ADT_API const char *string_pool_intern(string_pool pool, const char *str);
+
+ADT_API size_t string_pool_size(string_pool pool);
+
+ADT_API void string_pool_destroy(string_pool pool);
+
+ADT_API const char *string_intern(const char *str);
+
+ADT_API void string_intern_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADT_STRING_POOL_H */
@@ -29,6 +29,8 @@ extern "C" {
 
 struct trie_type;
 
+struct trie_cursor_type;
+
 /* -- Type Definitions -- */
 
 typedef struct trie_type *trie;
@@ -47,6 +49,20 @@ typedef comparable_callback trie_cb_compare;
 
 typedef int (*trie_cb_iterate)(trie, trie_key, trie_value, trie_cb_iterate_args);
 
+typedef struct trie_cursor_type *trie_cursor;
+
+/* -- Member Data -- */
+
+/* Caller owned traversal state for allocation free iteration over
+the flat node array, the visit order is unspecified and intermediate
+nodes are visited with a null value; the members must be treated as
+opaque */
+struct trie_cursor_type
+{
+	trie t;
+	size_t index;
+};
+
 /* -- Methods -- */
 
 ADT_API trie trie_create(trie_cb_hash hash_cb, trie_cb_compare compare_cb);
@@ -77,6 +93,16 @@ ADT_API trie trie_suffixes(trie t, trie_key key);
 
 ADT_API void trie_destroy(trie t);
 
+ADT_API void trie_cursor_begin(trie t, trie_cursor cursor);
+
+ADT_API int trie_cursor_end(trie_cursor cursor);
+
+ADT_API void trie_cursor_next(trie_cursor cursor);
+
+ADT_API trie_key trie_cursor_key(trie_cursor cursor);
+
+ADT_API trie_value trie_cursor_value(trie_cursor cursor);
+
 #ifdef __cplusplus
 }
 #endif
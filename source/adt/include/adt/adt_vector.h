@@ -344,6 +344,20 @@ ADT_API vector vector_copy(vector v);
 */
 ADT_API int vector_reserve(vector v, size_t capacity);
 
+/**
+*  @brief
+*    Reduce the vector capacity to fit its current size,
+*    moving the elements back to the inline buffer when
+*    they fit in it
+*
+*  @param[in] v
+*    Vector pointer
+*
+*  @return
+*    Positive number on error, zero on success
+*/
+ADT_API int vector_shrink(vector v);
+
 /**
 *  @brief
 *    Resizes container so that it contains @size elements
@@ -22,6 +22,24 @@
 
 #include <string.h>
 
+/* -- Private Methods -- */
+
+static uint64_t hash_mix_64(uint64_t h);
+
+/* -- Methods -- */
+
+uint64_t hash_mix_64(uint64_t h)
+{
+	/* Finalization avalanche of MurmurHash3 */
+	h ^= h >> 33;
+	h *= 0xFF51AFD7ED558CCDULL;
+	h ^= h >> 33;
+	h *= 0xC4CEB9FE1A85EC53ULL;
+	h ^= h >> 33;
+
+	return h;
+}
+
 hash hash_callback_str(const hash_key key)
 {
 	const char *str = (const char *)key;
@@ -35,3 +53,52 @@ hash hash_callback_str(const hash_key key)
 
 	return h;
 }
+
+hash hash_callback_str_fast(const hash_key key)
+{
+	const char *str = (const char *)key;
+
+	size_t length = strlen(str);
+
+	uint64_t h = 0x9E3779B97F4A7C15ULL ^ (uint64_t)length;
+
+	uint64_t chunk;
+
+	/* Consume the string a word at a time instead of byte by byte,
+	the unaligned loads go through memcpy which compilers lower to
+	plain word loads on the platforms we target */
+	while (length >= sizeof(uint64_t))
+	{
+		memcpy(&chunk, str, sizeof(uint64_t));
+
+		h = (h ^ chunk) * 0x9DDFEA08EB382D69ULL;
+
+		str += sizeof(uint64_t);
+		length -= sizeof(uint64_t);
+	}
+
+	if (length > 0)
+	{
+		chunk = 0;
+
+		memcpy(&chunk, str, length);
+
+		h = (h ^ chunk) * 0x9DDFEA08EB382D69ULL;
+	}
+
+	h = hash_mix_64(h);
+
+	return (hash)(h ^ (h >> 32));
+}
+
+hash hash_callback_ptr(const hash_key key)
+{
+	return hash_callback_uintptr((uintptr_t)key);
+}
+
+hash hash_callback_uintptr(uintptr_t key)
+{
+	uint64_t h = hash_mix_64((uint64_t)key);
+
+	return (hash)(h ^ (h >> 32));
+}
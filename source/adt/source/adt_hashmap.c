@@ -0,0 +1,544 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <adt/adt_hashmap.h>
+
+#include <log/log.h>
+
+#include <string.h>
+
+/* -- Definitions -- */
+
+#define HASHMAP_CAPACITY_MIN ((size_t)0x10)
+
+/* Distance of a free slot, any occupied slot holds the
+probe distance from its preferred position */
+#define HASHMAP_SLOT_FREE ((size_t)~0)
+
+/* -- Member Data -- */
+
+/* Open addressing with robin hood probing, the slots store
+key, value and cached hash inline in a single flat array so
+a lookup walks contiguous memory instead of chasing buckets */
+struct hashmap_slot_type
+{
+	hashmap_key key;
+	hashmap_value value;
+	hashmap_hash h;
+	size_t distance;
+};
+
+typedef struct hashmap_slot_type *hashmap_slot;
+
+struct hashmap_type
+{
+	size_t count;
+	size_t capacity; /* Always a power of two */
+	hashmap_slot slots;
+	hashmap_cb_hash hash_cb;
+	hashmap_cb_compare compare_cb;
+};
+
+struct hashmap_contains_any_cb_iterator_type
+{
+	hashmap map;
+	int result;
+};
+
+typedef struct hashmap_contains_any_cb_iterator_type *hashmap_contains_any_cb_iterator;
+
+/* -- Private Methods -- */
+
+static hashmap_slot hashmap_slot_create(size_t capacity);
+
+static hashmap_slot hashmap_slot_find(hashmap map, hashmap_key key);
+
+static void hashmap_slot_insert(hashmap_slot slots, size_t capacity, hashmap_key key, hashmap_value value, hashmap_hash h);
+
+static int hashmap_rehash(hashmap map, size_t capacity);
+
+/* -- Methods -- */
+
+hashmap_slot hashmap_slot_create(size_t capacity)
+{
+	hashmap_slot slots = malloc(sizeof(struct hashmap_slot_type) * capacity);
+
+	size_t iterator;
+
+	if (slots == NULL)
+	{
+		return NULL;
+	}
+
+	for (iterator = 0; iterator < capacity; ++iterator)
+	{
+		slots[iterator].distance = HASHMAP_SLOT_FREE;
+	}
+
+	return slots;
+}
+
+hashmap_slot hashmap_slot_find(hashmap map, hashmap_key key)
+{
+	hashmap_hash h = map->hash_cb(key);
+
+	size_t index = (size_t)h & (map->capacity - 1);
+
+	size_t distance = 0;
+
+	for (;;)
+	{
+		hashmap_slot slot = &map->slots[index];
+
+		if (slot->distance == HASHMAP_SLOT_FREE || distance > slot->distance)
+		{
+			/* With robin hood invariants the key cannot be further
+			than a slot poorer than the probe, stop early */
+			return NULL;
+		}
+
+		if (slot->h == h && map->compare_cb(slot->key, key) == 0)
+		{
+			return slot;
+		}
+
+		index = (index + 1) & (map->capacity - 1);
+
+		++distance;
+	}
+}
+
+void hashmap_slot_insert(hashmap_slot slots, size_t capacity, hashmap_key key, hashmap_value value, hashmap_hash h)
+{
+	size_t index = (size_t)h & (capacity - 1);
+
+	size_t distance = 0;
+
+	for (;;)
+	{
+		hashmap_slot slot = &slots[index];
+
+		if (slot->distance == HASHMAP_SLOT_FREE)
+		{
+			slot->key = key;
+			slot->value = value;
+			slot->h = h;
+			slot->distance = distance;
+
+			return;
+		}
+
+		/* Steal the slot from richer entries so the maximum
+		probe length stays bounded */
+		if (slot->distance < distance)
+		{
+			struct hashmap_slot_type swap = *slot;
+
+			slot->key = key;
+			slot->value = value;
+			slot->h = h;
+			slot->distance = distance;
+
+			key = swap.key;
+			value = swap.value;
+			h = swap.h;
+			distance = swap.distance;
+		}
+
+		index = (index + 1) & (capacity - 1);
+
+		++distance;
+	}
+}
+
+int hashmap_rehash(hashmap map, size_t capacity)
+{
+	hashmap_slot slots = hashmap_slot_create(capacity);
+
+	size_t iterator;
+
+	if (slots == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad hashmap slot reallocation");
+
+		return 1;
+	}
+
+	for (iterator = 0; iterator < map->capacity; ++iterator)
+	{
+		hashmap_slot slot = &map->slots[iterator];
+
+		if (slot->distance != HASHMAP_SLOT_FREE)
+		{
+			hashmap_slot_insert(slots, capacity, slot->key, slot->value, slot->h);
+		}
+	}
+
+	free(map->slots);
+
+	map->slots = slots;
+	map->capacity = capacity;
+
+	return 0;
+}
+
+hashmap hashmap_create(hashmap_cb_hash hash_cb, hashmap_cb_compare compare_cb)
+{
+	hashmap map;
+
+	if (hash_cb == NULL || compare_cb == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid hashmap creation parameters");
+
+		return NULL;
+	}
+
+	map = malloc(sizeof(struct hashmap_type));
+
+	if (map == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad hashmap allocation");
+
+		return NULL;
+	}
+
+	map->hash_cb = hash_cb;
+	map->compare_cb = compare_cb;
+	map->count = 0;
+	map->capacity = HASHMAP_CAPACITY_MIN;
+	map->slots = hashmap_slot_create(map->capacity);
+
+	if (map->slots == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad hashmap slot creation");
+
+		free(map);
+
+		return NULL;
+	}
+
+	return map;
+}
+
+size_t hashmap_size(hashmap map)
+{
+	if (map != NULL)
+	{
+		return map->count;
+	}
+
+	return 0;
+}
+
+int hashmap_insert(hashmap map, hashmap_key key, hashmap_value value)
+{
+	hashmap_slot slot;
+
+	if (map == NULL || key == NULL || value == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid hashmap insertion parameters");
+
+		return 1;
+	}
+
+	slot = hashmap_slot_find(map, key);
+
+	if (slot != NULL)
+	{
+		slot->value = value;
+
+		return 0;
+	}
+
+	/* Grow at three quarters load so probe sequences stay short */
+	if ((map->count + 1) * 4 >= map->capacity * 3)
+	{
+		if (hashmap_rehash(map, map->capacity << 1) != 0)
+		{
+			return 1;
+		}
+	}
+
+	hashmap_slot_insert(map->slots, map->capacity, key, value, map->hash_cb(key));
+
+	++map->count;
+
+	return 0;
+}
+
+hashmap_value hashmap_get(hashmap map, hashmap_key key)
+{
+	if (map != NULL && key != NULL)
+	{
+		hashmap_slot slot = hashmap_slot_find(map, key);
+
+		if (slot != NULL)
+		{
+			return slot->value;
+		}
+	}
+
+	return NULL;
+}
+
+int hashmap_contains(hashmap map, hashmap_key key)
+{
+	if (map != NULL && key != NULL)
+	{
+		if (hashmap_slot_find(map, key) != NULL)
+		{
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+static int hashmap_contains_any_cb_iterate(hashmap map, hashmap_key key, hashmap_value value, hashmap_cb_iterate_args args)
+{
+	hashmap_contains_any_cb_iterator iterator = (hashmap_contains_any_cb_iterator)args;
+
+	(void)map;
+	(void)value;
+
+	iterator->result = hashmap_contains(iterator->map, key);
+
+	/* Stop iteration if we found an element */
+	return !iterator->result;
+}
+
+int hashmap_contains_any(hashmap dest, hashmap src)
+{
+	struct hashmap_contains_any_cb_iterator_type args;
+
+	args.map = dest;
+	args.result = 1;
+
+	hashmap_iterate(src, &hashmap_contains_any_cb_iterate, (hashmap_cb_iterate_args)&args);
+
+	return args.result;
+}
+
+hashmap_value hashmap_remove(hashmap map, hashmap_key key)
+{
+	hashmap_slot slot;
+
+	hashmap_value value;
+
+	size_t index, next;
+
+	if (map == NULL || key == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid hashmap remove parameters");
+
+		return NULL;
+	}
+
+	slot = hashmap_slot_find(map, key);
+
+	if (slot == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid hashmap remove: %p", key);
+
+		return NULL;
+	}
+
+	value = slot->value;
+
+	/* Backward shift deletion, pull the displaced entries of the
+	probe chain one slot closer to their preferred position */
+	index = (size_t)(slot - map->slots);
+
+	for (;;)
+	{
+		next = (index + 1) & (map->capacity - 1);
+
+		if (map->slots[next].distance == HASHMAP_SLOT_FREE || map->slots[next].distance == 0)
+		{
+			break;
+		}
+
+		map->slots[index] = map->slots[next];
+
+		--map->slots[index].distance;
+
+		index = next;
+	}
+
+	map->slots[index].distance = HASHMAP_SLOT_FREE;
+
+	--map->count;
+
+	return value;
+}
+
+void hashmap_iterate(hashmap map, hashmap_cb_iterate iterate_cb, hashmap_cb_iterate_args args)
+{
+	if (map != NULL && map->slots != NULL && iterate_cb != NULL)
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < map->capacity; ++iterator)
+		{
+			hashmap_slot slot = &map->slots[iterator];
+
+			if (slot->distance != HASHMAP_SLOT_FREE)
+			{
+				if (iterate_cb(map, slot->key, slot->value, args) != 0)
+				{
+					return;
+				}
+			}
+		}
+	}
+}
+
+static int hashmap_append_cb_iterate(hashmap map, hashmap_key key, hashmap_value value, hashmap_cb_iterate_args args)
+{
+	hashmap dest = (hashmap)args;
+
+	(void)map;
+
+	return hashmap_insert(dest, key, value);
+}
+
+int hashmap_append(hashmap dest, hashmap src)
+{
+	hashmap_cb_iterate_args args = (hashmap_cb_iterate_args)dest;
+
+	hashmap_iterate(src, &hashmap_append_cb_iterate, args);
+
+	return 0;
+}
+
+static int hashmap_disjoint_cb_iterate(hashmap map, hashmap_key key, hashmap_value value, hashmap_cb_iterate_args args)
+{
+	hashmap dest = (hashmap)args;
+
+	hashmap_value deleted = hashmap_remove(dest, key);
+
+	(void)map;
+
+	return !(deleted == value);
+}
+
+int hashmap_disjoint(hashmap dest, hashmap src)
+{
+	hashmap_cb_iterate_args args = (hashmap_cb_iterate_args)dest;
+
+	hashmap_iterate(src, &hashmap_disjoint_cb_iterate, args);
+
+	return 0;
+}
+
+int hashmap_clear(hashmap map)
+{
+	hashmap_slot slots;
+
+	if (map == NULL)
+	{
+		return 1;
+	}
+
+	slots = hashmap_slot_create(HASHMAP_CAPACITY_MIN);
+
+	if (slots == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad hashmap clear slot creation");
+
+		return 1;
+	}
+
+	if (map->slots != NULL)
+	{
+		free(map->slots);
+	}
+
+	map->count = 0;
+	map->capacity = HASHMAP_CAPACITY_MIN;
+	map->slots = slots;
+
+	return 0;
+}
+
+static void hashmap_cursor_seek(hashmap_cursor cursor)
+{
+	for (; cursor->slot < cursor->map->capacity; ++cursor->slot)
+	{
+		if (cursor->map->slots[cursor->slot].distance != HASHMAP_SLOT_FREE)
+		{
+			return;
+		}
+	}
+}
+
+void hashmap_cursor_begin(hashmap map, hashmap_cursor cursor)
+{
+	cursor->map = map;
+	cursor->slot = 0;
+
+	if (map != NULL && map->slots != NULL)
+	{
+		hashmap_cursor_seek(cursor);
+	}
+	else
+	{
+		cursor->slot = (map != NULL) ? map->capacity : 0;
+	}
+}
+
+int hashmap_cursor_end(hashmap_cursor cursor)
+{
+	return (cursor->map != NULL && cursor->slot < cursor->map->capacity);
+}
+
+void hashmap_cursor_next(hashmap_cursor cursor)
+{
+	++cursor->slot;
+
+	hashmap_cursor_seek(cursor);
+}
+
+hashmap_key hashmap_cursor_key(hashmap_cursor cursor)
+{
+	return cursor->map->slots[cursor->slot].key;
+}
+
+hashmap_value hashmap_cursor_value(hashmap_cursor cursor)
+{
+	return cursor->map->slots[cursor->slot].value;
+}
+
+void hashmap_destroy(hashmap map)
+{
+	if (map == NULL)
+	{
+		return;
+	}
+
+	if (map->slots != NULL)
+	{
+		free(map->slots);
+	}
+
+	free(map);
+}
@@ -0,0 +1,302 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <adt/adt_hashmap_concurrent.h>
+
+#include <threading/threading_mutex.h>
+
+#include <log/log.h>
+
+/* -- Definitions -- */
+
+#define HASHMAP_CONCURRENT_SHARD_COUNT ((size_t)0x10) /**< Number of independent shards, must be a power of two */
+
+/* -- Member Data -- */
+
+/* Each shard pairs a plain hashmap with its own mutex, so operations
+on keys hashing into different shards never contend with each other
+and read-mostly lookups spread across the shard locks instead of
+funneling through a single one */
+struct hashmap_concurrent_shard_type
+{
+	threading_mutex mutex;
+	hashmap map;
+};
+
+struct hashmap_concurrent_type
+{
+	struct hashmap_concurrent_shard_type shards[HASHMAP_CONCURRENT_SHARD_COUNT];
+	hashmap_cb_hash hash_cb;
+};
+
+/* Adapts the per-shard iteration callback so consumers observe the
+concurrent map instead of the shard it is currently traversing */
+struct hashmap_concurrent_iterate_type
+{
+	hashmap_concurrent map;
+	hashmap_concurrent_cb_iterate iterate_cb;
+	hashmap_cb_iterate_args args;
+};
+
+/* -- Private Methods -- */
+
+static struct hashmap_concurrent_shard_type *hashmap_concurrent_shard(hashmap_concurrent map, hashmap_key key);
+
+static int hashmap_concurrent_shard_cb_iterate(hashmap map, hashmap_key key, hashmap_value value, hashmap_cb_iterate_args args);
+
+/* -- Methods -- */
+
+struct hashmap_concurrent_shard_type *hashmap_concurrent_shard(hashmap_concurrent map, hashmap_key key)
+{
+	hashmap_hash h = map->hash_cb(key);
+
+	/* Fold the high bits in so the shard index is decorrelated from
+	the bucket index inside the shard map, which uses the low bits */
+	return &map->shards[(h ^ (h >> 16)) & (HASHMAP_CONCURRENT_SHARD_COUNT - 1)];
+}
+
+int hashmap_concurrent_shard_cb_iterate(hashmap map, hashmap_key key, hashmap_value value, hashmap_cb_iterate_args args)
+{
+	struct hashmap_concurrent_iterate_type *iterate = args;
+
+	(void)map;
+
+	return iterate->iterate_cb(iterate->map, key, value, iterate->args);
+}
+
+hashmap_concurrent hashmap_concurrent_create(hashmap_cb_hash hash_cb, hashmap_cb_compare compare_cb)
+{
+	hashmap_concurrent map = malloc(sizeof(struct hashmap_concurrent_type));
+
+	size_t iterator;
+
+	if (map == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad concurrent hashmap allocation");
+
+		return NULL;
+	}
+
+	map->hash_cb = hash_cb;
+
+	for (iterator = 0; iterator < HASHMAP_CONCURRENT_SHARD_COUNT; ++iterator)
+	{
+		map->shards[iterator].mutex = threading_mutex_create();
+
+		map->shards[iterator].map = hashmap_create(hash_cb, compare_cb);
+
+		if (map->shards[iterator].mutex == NULL || map->shards[iterator].map == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Bad concurrent hashmap shard allocation");
+
+			for (; iterator != (size_t)~0; --iterator)
+			{
+				threading_mutex_destroy(map->shards[iterator].mutex);
+
+				if (map->shards[iterator].map != NULL)
+				{
+					hashmap_destroy(map->shards[iterator].map);
+				}
+			}
+
+			free(map);
+
+			return NULL;
+		}
+	}
+
+	return map;
+}
+
+size_t hashmap_concurrent_size(hashmap_concurrent map)
+{
+	size_t size = 0, iterator;
+
+	if (map == NULL)
+	{
+		return 0;
+	}
+
+	for (iterator = 0; iterator < HASHMAP_CONCURRENT_SHARD_COUNT; ++iterator)
+	{
+		threading_mutex_lock(map->shards[iterator].mutex);
+
+		size += hashmap_size(map->shards[iterator].map);
+
+		threading_mutex_unlock(map->shards[iterator].mutex);
+	}
+
+	return size;
+}
+
+int hashmap_concurrent_insert(hashmap_concurrent map, hashmap_key key, hashmap_value value)
+{
+	struct hashmap_concurrent_shard_type *shard;
+
+	int result;
+
+	if (map == NULL || key == NULL)
+	{
+		return 1;
+	}
+
+	shard = hashmap_concurrent_shard(map, key);
+
+	threading_mutex_lock(shard->mutex);
+
+	result = hashmap_insert(shard->map, key, value);
+
+	threading_mutex_unlock(shard->mutex);
+
+	return result;
+}
+
+hashmap_value hashmap_concurrent_get(hashmap_concurrent map, hashmap_key key)
+{
+	struct hashmap_concurrent_shard_type *shard;
+
+	hashmap_value value;
+
+	if (map == NULL || key == NULL)
+	{
+		return NULL;
+	}
+
+	shard = hashmap_concurrent_shard(map, key);
+
+	threading_mutex_lock(shard->mutex);
+
+	value = hashmap_get(shard->map, key);
+
+	threading_mutex_unlock(shard->mutex);
+
+	return value;
+}
+
+int hashmap_concurrent_contains(hashmap_concurrent map, hashmap_key key)
+{
+	struct hashmap_concurrent_shard_type *shard;
+
+	int result;
+
+	if (map == NULL || key == NULL)
+	{
+		return 1;
+	}
+
+	shard = hashmap_concurrent_shard(map, key);
+
+	threading_mutex_lock(shard->mutex);
+
+	result = hashmap_contains(shard->map, key);
+
+	threading_mutex_unlock(shard->mutex);
+
+	return result;
+}
+
+hashmap_value hashmap_concurrent_remove(hashmap_concurrent map, hashmap_key key)
+{
+	struct hashmap_concurrent_shard_type *shard;
+
+	hashmap_value value;
+
+	if (map == NULL || key == NULL)
+	{
+		return NULL;
+	}
+
+	shard = hashmap_concurrent_shard(map, key);
+
+	threading_mutex_lock(shard->mutex);
+
+	value = hashmap_remove(shard->map, key);
+
+	threading_mutex_unlock(shard->mutex);
+
+	return value;
+}
+
+void hashmap_concurrent_iterate(hashmap_concurrent map, hashmap_concurrent_cb_iterate iterate_cb, hashmap_cb_iterate_args args)
+{
+	if (map != NULL && iterate_cb != NULL)
+	{
+		struct hashmap_concurrent_iterate_type iterate;
+
+		size_t iterator;
+
+		iterate.map = map;
+		iterate.iterate_cb = iterate_cb;
+		iterate.args = args;
+
+		/* Shards are visited one at a time under their own lock, the
+		callback must not touch the map it is iterating */
+		for (iterator = 0; iterator < HASHMAP_CONCURRENT_SHARD_COUNT; ++iterator)
+		{
+			threading_mutex_lock(map->shards[iterator].mutex);
+
+			hashmap_iterate(map->shards[iterator].map, &hashmap_concurrent_shard_cb_iterate, (hashmap_cb_iterate_args)&iterate);
+
+			threading_mutex_unlock(map->shards[iterator].mutex);
+		}
+	}
+}
+
+int hashmap_concurrent_clear(hashmap_concurrent map)
+{
+	size_t iterator;
+
+	int result = 0;
+
+	if (map == NULL)
+	{
+		return 1;
+	}
+
+	for (iterator = 0; iterator < HASHMAP_CONCURRENT_SHARD_COUNT; ++iterator)
+	{
+		threading_mutex_lock(map->shards[iterator].mutex);
+
+		result |= hashmap_clear(map->shards[iterator].map);
+
+		threading_mutex_unlock(map->shards[iterator].mutex);
+	}
+
+	return result;
+}
+
+void hashmap_concurrent_destroy(hashmap_concurrent map)
+{
+	if (map != NULL)
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < HASHMAP_CONCURRENT_SHARD_COUNT; ++iterator)
+		{
+			hashmap_destroy(map->shards[iterator].map);
+
+			threading_mutex_destroy(map->shards[iterator].mutex);
+		}
+
+		free(map);
+	}
+}
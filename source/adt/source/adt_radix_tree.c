@@ -0,0 +1,703 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <adt/adt_radix_tree.h>
+
+#include <log/log.h>
+
+#include <string.h>
+
+/* -- Forward Declarations -- */
+
+struct radix_tree_node_type;
+
+/* -- Type Definitions -- */
+
+typedef struct radix_tree_node_type *radix_tree_node;
+
+/* -- Member Data -- */
+
+/* Each node stores a whole compressed edge instead of a single byte,
+so lookups only descend once per divergence point of the stored keys,
+and the children live in one contiguous array sorted by the first
+label byte so the descent is a binary search instead of a hash */
+struct radix_tree_node_type
+{
+	char *label;							 /**< Compressed edge bytes relative to the parent */
+	size_t label_size;						 /**< Size of the label without the null terminator */
+	radix_tree_value value;					 /**< Value stored at this node when @contained */
+	int contained;							 /**< Distinguishes stored values from intermediate nodes */
+	struct radix_tree_node_type *childs;	 /**< Contiguous child array sorted by first label byte */
+	size_t child_count;						 /**< Number of children in the array */
+};
+
+struct radix_tree_type
+{
+	struct radix_tree_node_type root; /**< Root node with an empty label */
+	size_t size;					  /**< Number of keys stored in the tree */
+};
+
+/* Traversal state shared across the recursive iteration, the key
+buffer grows to hold the largest key reconstructed from the labels */
+struct radix_tree_iterate_type
+{
+	radix_tree tree;
+	radix_tree_cb_iterate iterate_cb;
+	radix_tree_cb_iterate_args args;
+	char *key;
+	size_t size;
+	size_t capacity;
+};
+
+/* -- Private Methods -- */
+
+static char *radix_tree_label_copy(const char *bytes, size_t size);
+
+static size_t radix_tree_label_prefix(const char *label, size_t label_size, const char *key);
+
+static size_t radix_tree_node_child_index(radix_tree_node node, char byte, int *found);
+
+static radix_tree_node radix_tree_node_child_insert(radix_tree_node node, size_t index, const char *key, radix_tree_value value);
+
+static int radix_tree_node_split(radix_tree_node node, size_t prefix);
+
+static int radix_tree_node_merge(radix_tree_node node);
+
+static int radix_tree_node_iterate(struct radix_tree_iterate_type *iterate, radix_tree_node node);
+
+static void radix_tree_node_clear(radix_tree_node node);
+
+/* -- Methods -- */
+
+char *radix_tree_label_copy(const char *bytes, size_t size)
+{
+	char *label = malloc(sizeof(char) * (size + 1));
+
+	if (label == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad radix tree label allocation");
+
+		return NULL;
+	}
+
+	memcpy(label, bytes, size);
+
+	label[size] = '\0';
+
+	return label;
+}
+
+size_t radix_tree_label_prefix(const char *label, size_t label_size, const char *key)
+{
+	size_t prefix = 0;
+
+	while (prefix < label_size && key[prefix] != '\0' && label[prefix] == key[prefix])
+	{
+		++prefix;
+	}
+
+	return prefix;
+}
+
+size_t radix_tree_node_child_index(radix_tree_node node, char byte, int *found)
+{
+	size_t begin = 0, end = node->child_count;
+
+	while (begin < end)
+	{
+		size_t middle = begin + ((end - begin) >> 1);
+
+		char first = node->childs[middle].label[0];
+
+		if (first == byte)
+		{
+			*found = 1;
+
+			return middle;
+		}
+
+		if (first < byte)
+		{
+			begin = middle + 1;
+		}
+		else
+		{
+			end = middle;
+		}
+	}
+
+	*found = 0;
+
+	return begin;
+}
+
+radix_tree_node radix_tree_node_child_insert(radix_tree_node node, size_t index, const char *key, radix_tree_value value)
+{
+	size_t label_size = strlen(key);
+
+	radix_tree_node childs = realloc(node->childs, sizeof(struct radix_tree_node_type) * (node->child_count + 1));
+
+	radix_tree_node child;
+
+	char *label;
+
+	if (childs == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad radix tree child array reallocation");
+
+		return NULL;
+	}
+
+	node->childs = childs;
+
+	label = radix_tree_label_copy(key, label_size);
+
+	if (label == NULL)
+	{
+		return NULL;
+	}
+
+	memmove(&childs[index + 1], &childs[index], sizeof(struct radix_tree_node_type) * (node->child_count - index));
+
+	child = &childs[index];
+
+	child->label = label;
+	child->label_size = label_size;
+	child->value = value;
+	child->contained = 1;
+	child->childs = NULL;
+	child->child_count = 0;
+
+	++node->child_count;
+
+	return child;
+}
+
+int radix_tree_node_split(radix_tree_node node, size_t prefix)
+{
+	radix_tree_node childs = malloc(sizeof(struct radix_tree_node_type));
+
+	char *suffix;
+
+	if (childs == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad radix tree node split allocation");
+
+		return 1;
+	}
+
+	suffix = radix_tree_label_copy(node->label + prefix, node->label_size - prefix);
+
+	if (suffix == NULL)
+	{
+		free(childs);
+
+		return 1;
+	}
+
+	/* The node keeps the common prefix and its former content
+	moves down into a single child holding the divergent suffix */
+	childs[0].label = suffix;
+	childs[0].label_size = node->label_size - prefix;
+	childs[0].value = node->value;
+	childs[0].contained = node->contained;
+	childs[0].childs = node->childs;
+	childs[0].child_count = node->child_count;
+
+	node->label[prefix] = '\0';
+	node->label_size = prefix;
+	node->value = NULL;
+	node->contained = 0;
+	node->childs = childs;
+	node->child_count = 1;
+
+	return 0;
+}
+
+int radix_tree_node_merge(radix_tree_node node)
+{
+	struct radix_tree_node_type child = node->childs[0];
+
+	char *label = realloc(node->label, sizeof(char) * (node->label_size + child.label_size + 1));
+
+	if (label == NULL)
+	{
+		/* Keep the pass-through node, the tree is still correct */
+		return 1;
+	}
+
+	memcpy(label + node->label_size, child.label, child.label_size + 1);
+
+	free(child.label);
+
+	free(node->childs);
+
+	node->label = label;
+	node->label_size += child.label_size;
+	node->value = child.value;
+	node->contained = child.contained;
+	node->childs = child.childs;
+	node->child_count = child.child_count;
+
+	return 0;
+}
+
+radix_tree radix_tree_create(void)
+{
+	radix_tree tree = malloc(sizeof(struct radix_tree_type));
+
+	if (tree == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad radix tree allocation");
+
+		return NULL;
+	}
+
+	tree->root.label = NULL;
+	tree->root.label_size = 0;
+	tree->root.value = NULL;
+	tree->root.contained = 0;
+	tree->root.childs = NULL;
+	tree->root.child_count = 0;
+
+	tree->size = 0;
+
+	return tree;
+}
+
+size_t radix_tree_size(radix_tree tree)
+{
+	if (tree != NULL)
+	{
+		return tree->size;
+	}
+
+	return 0;
+}
+
+int radix_tree_insert(radix_tree tree, const char *key, radix_tree_value value)
+{
+	radix_tree_node node;
+
+	if (tree == NULL || key == NULL)
+	{
+		return 1;
+	}
+
+	node = &tree->root;
+
+	for (;;)
+	{
+		radix_tree_node child;
+
+		size_t index, prefix;
+
+		int found;
+
+		if (*key == '\0')
+		{
+			if (node->contained == 0)
+			{
+				node->contained = 1;
+
+				++tree->size;
+			}
+
+			node->value = value;
+
+			return 0;
+		}
+
+		index = radix_tree_node_child_index(node, *key, &found);
+
+		if (found == 0)
+		{
+			if (radix_tree_node_child_insert(node, index, key, value) == NULL)
+			{
+				return 1;
+			}
+
+			++tree->size;
+
+			return 0;
+		}
+
+		child = &node->childs[index];
+
+		prefix = radix_tree_label_prefix(child->label, child->label_size, key);
+
+		if (prefix < child->label_size)
+		{
+			if (radix_tree_node_split(child, prefix) != 0)
+			{
+				return 1;
+			}
+		}
+
+		key += prefix;
+
+		node = child;
+	}
+}
+
+radix_tree_value radix_tree_get(radix_tree tree, const char *key)
+{
+	radix_tree_node node;
+
+	if (tree == NULL || key == NULL)
+	{
+		return NULL;
+	}
+
+	node = &tree->root;
+
+	while (*key != '\0')
+	{
+		size_t index, prefix;
+
+		int found;
+
+		index = radix_tree_node_child_index(node, *key, &found);
+
+		if (found == 0)
+		{
+			return NULL;
+		}
+
+		node = &node->childs[index];
+
+		prefix = radix_tree_label_prefix(node->label, node->label_size, key);
+
+		if (prefix < node->label_size)
+		{
+			return NULL;
+		}
+
+		key += prefix;
+	}
+
+	if (node->contained == 0)
+	{
+		return NULL;
+	}
+
+	return node->value;
+}
+
+int radix_tree_contains(radix_tree tree, const char *key)
+{
+	radix_tree_node node;
+
+	if (tree == NULL || key == NULL)
+	{
+		return 1;
+	}
+
+	node = &tree->root;
+
+	while (*key != '\0')
+	{
+		size_t index, prefix;
+
+		int found;
+
+		index = radix_tree_node_child_index(node, *key, &found);
+
+		if (found == 0)
+		{
+			return 1;
+		}
+
+		node = &node->childs[index];
+
+		prefix = radix_tree_label_prefix(node->label, node->label_size, key);
+
+		if (prefix < node->label_size)
+		{
+			return 1;
+		}
+
+		key += prefix;
+	}
+
+	return !(node->contained != 0);
+}
+
+radix_tree_value radix_tree_match(radix_tree tree, const char *key)
+{
+	radix_tree_node node, best = NULL;
+
+	if (tree == NULL || key == NULL)
+	{
+		return NULL;
+	}
+
+	node = &tree->root;
+
+	if (node->contained != 0)
+	{
+		best = node;
+	}
+
+	while (*key != '\0')
+	{
+		size_t index, prefix;
+
+		int found;
+
+		index = radix_tree_node_child_index(node, *key, &found);
+
+		if (found == 0)
+		{
+			break;
+		}
+
+		node = &node->childs[index];
+
+		prefix = radix_tree_label_prefix(node->label, node->label_size, key);
+
+		if (prefix < node->label_size)
+		{
+			break;
+		}
+
+		key += prefix;
+
+		if (node->contained != 0)
+		{
+			best = node;
+		}
+	}
+
+	if (best == NULL)
+	{
+		return NULL;
+	}
+
+	return best->value;
+}
+
+radix_tree_value radix_tree_remove(radix_tree tree, const char *key)
+{
+	radix_tree_node parent = NULL, node;
+
+	radix_tree_value value;
+
+	size_t slot = 0;
+
+	if (tree == NULL || key == NULL)
+	{
+		return NULL;
+	}
+
+	node = &tree->root;
+
+	while (*key != '\0')
+	{
+		size_t index, prefix;
+
+		int found;
+
+		index = radix_tree_node_child_index(node, *key, &found);
+
+		if (found == 0)
+		{
+			return NULL;
+		}
+
+		parent = node;
+		slot = index;
+
+		node = &node->childs[index];
+
+		prefix = radix_tree_label_prefix(node->label, node->label_size, key);
+
+		if (prefix < node->label_size)
+		{
+			return NULL;
+		}
+
+		key += prefix;
+	}
+
+	if (node->contained == 0)
+	{
+		return NULL;
+	}
+
+	value = node->value;
+
+	node->value = NULL;
+	node->contained = 0;
+
+	--tree->size;
+
+	if (node->child_count == 0 && parent != NULL)
+	{
+		/* Drop the emptied leaf from the parent array */
+		free(node->label);
+
+		memmove(&parent->childs[slot], &parent->childs[slot + 1], sizeof(struct radix_tree_node_type) * (parent->child_count - slot - 1));
+
+		--parent->child_count;
+
+		if (parent->child_count == 0)
+		{
+			free(parent->childs);
+
+			parent->childs = NULL;
+		}
+		else if (parent->child_count == 1 && parent->contained == 0 && parent != &tree->root)
+		{
+			radix_tree_node_merge(parent);
+		}
+	}
+	else if (node->child_count == 1 && node != &tree->root)
+	{
+		/* The node became a pass-through, fold its single child in */
+		radix_tree_node_merge(node);
+	}
+
+	return value;
+}
+
+int radix_tree_node_iterate(struct radix_tree_iterate_type *iterate, radix_tree_node node)
+{
+	size_t iterator;
+
+	if (iterate->size + node->label_size + 1 > iterate->capacity)
+	{
+		size_t capacity = (iterate->capacity << 1) + node->label_size + 1;
+
+		char *key = realloc(iterate->key, sizeof(char) * capacity);
+
+		if (key == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Bad radix tree iteration key reallocation");
+
+			return 1;
+		}
+
+		iterate->key = key;
+		iterate->capacity = capacity;
+	}
+
+	if (node->label_size > 0)
+	{
+		memcpy(iterate->key + iterate->size, node->label, node->label_size);
+
+		iterate->size += node->label_size;
+	}
+
+	iterate->key[iterate->size] = '\0';
+
+	if (node->contained != 0 && iterate->iterate_cb(iterate->tree, iterate->key, node->value, iterate->args) != 0)
+	{
+		iterate->size -= node->label_size;
+
+		return 1;
+	}
+
+	for (iterator = 0; iterator < node->child_count; ++iterator)
+	{
+		if (radix_tree_node_iterate(iterate, &node->childs[iterator]) != 0)
+		{
+			iterate->size -= node->label_size;
+
+			return 1;
+		}
+	}
+
+	iterate->size -= node->label_size;
+
+	return 0;
+}
+
+void radix_tree_iterate(radix_tree tree, radix_tree_cb_iterate iterate_cb, radix_tree_cb_iterate_args args)
+{
+	if (tree != NULL && iterate_cb != NULL)
+	{
+		struct radix_tree_iterate_type iterate;
+
+		iterate.tree = tree;
+		iterate.iterate_cb = iterate_cb;
+		iterate.args = args;
+		iterate.key = NULL;
+		iterate.size = 0;
+		iterate.capacity = 0;
+
+		radix_tree_node_iterate(&iterate, &tree->root);
+
+		if (iterate.key != NULL)
+		{
+			free(iterate.key);
+		}
+	}
+}
+
+void radix_tree_node_clear(radix_tree_node node)
+{
+	size_t iterator;
+
+	for (iterator = 0; iterator < node->child_count; ++iterator)
+	{
+		radix_tree_node_clear(&node->childs[iterator]);
+
+		free(node->childs[iterator].label);
+	}
+
+	if (node->childs != NULL)
+	{
+		free(node->childs);
+
+		node->childs = NULL;
+	}
+
+	node->child_count = 0;
+}
+
+int radix_tree_clear(radix_tree tree)
+{
+	if (tree == NULL)
+	{
+		return 1;
+	}
+
+	radix_tree_node_clear(&tree->root);
+
+	tree->root.value = NULL;
+	tree->root.contained = 0;
+
+	tree->size = 0;
+
+	return 0;
+}
+
+void radix_tree_destroy(radix_tree tree)
+{
+	if (tree != NULL)
+	{
+		radix_tree_node_clear(&tree->root);
+
+		free(tree);
+	}
+}
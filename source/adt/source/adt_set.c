@@ -30,6 +30,8 @@
 #define SET_BUCKET_RATIO_MIN 0.1f
 #define SET_BUCKET_RATIO_MAX 0.77f
 
+#define SET_REHASH_STEP ((size_t)0x08) /**< Old buckets migrated per mutating operation */
+
 /* -- Member Data -- */
 
 struct set_type
@@ -40,6 +42,13 @@ struct set_type
 	set_bucket buckets;
 	set_cb_hash hash_cb;
 	set_cb_compare compare_cb;
+
+	/* Growth rehashes incrementally: the old bucket array is drained
+	a few buckets per mutating operation into the new one, so the call
+	that crosses the ratio never pays the whole rehash inline */
+	set_bucket rehash_buckets; /**< Old bucket array still being drained */
+	size_t rehash_capacity;	   /**< Capacity of the old array */
+	size_t rehash_index;	   /**< Next old bucket to migrate */
 };
 
 struct set_iterator_type
@@ -59,7 +68,21 @@ typedef struct set_contains_any_cb_iterator_type *set_contains_any_cb_iterator;
 
 /* -- Methods -- */
 
-set set_create(set_cb_hash hash_cb, set_cb_compare compare_cb)
+/* Smallest prime index whose capacity keeps @count below the maximum
+bucket ratio, so insertions up to @count never trigger a rehash */
+static size_t set_prime_for(size_t count)
+{
+	size_t prime = 0;
+
+	while ((float)count >= (float)set_bucket_capacity(prime) * SET_BUCKET_RATIO_MAX)
+	{
+		++prime;
+	}
+
+	return prime;
+}
+
+static set set_create_prime(set_cb_hash hash_cb, set_cb_compare compare_cb, size_t prime)
 {
 	set s;
 
@@ -80,9 +103,12 @@ set set_create(set_cb_hash hash_cb, set_cb_compare compare_cb)
 	s->hash_cb = hash_cb;
 	s->compare_cb = compare_cb;
 	s->count = 0;
-	s->prime = 0;
+	s->prime = prime;
 	s->capacity = set_bucket_capacity(s->prime);
 	s->buckets = set_bucket_create(s->capacity);
+	s->rehash_buckets = NULL;
+	s->rehash_capacity = 0;
+	s->rehash_index = 0;
 
 	if (s->buckets == NULL)
 	{
@@ -96,6 +122,16 @@ set set_create(set_cb_hash hash_cb, set_cb_compare compare_cb)
 	return s;
 }
 
+set set_create(set_cb_hash hash_cb, set_cb_compare compare_cb)
+{
+	return set_create_prime(hash_cb, compare_cb, 0);
+}
+
+set set_create_reserve(set_cb_hash hash_cb, set_cb_compare compare_cb, size_t capacity)
+{
+	return set_create_prime(hash_cb, compare_cb, set_prime_for(capacity));
+}
+
 size_t set_size(set s)
 {
 	if (s != NULL)
@@ -133,27 +169,128 @@ static int set_bucket_realloc_iterator(set s, set_key key, set_value value, set_
 	return 1;
 }
 
-static int set_bucket_realloc(set s)
+static int set_rehash_bucket_migrate(set s, set_bucket bucket)
 {
-	struct set_type new_set;
+	size_t iterator;
 
-	size_t prime = s->prime;
+	for (iterator = 0; iterator < bucket->count; ++iterator)
+	{
+		set_pair pair = &bucket->pairs[iterator];
 
-	float ratio = (float)((float)s->count / (float)s->capacity);
+		set_hash h = s->hash_cb(pair->key);
 
-	if (prime > 0 && ratio <= SET_BUCKET_RATIO_MIN)
-	{
-		--prime;
+		if (set_bucket_insert(&s->buckets[h % s->capacity], pair->key, pair->value) != 0)
+		{
+			return 1;
+		}
 	}
-	else if (ratio >= SET_BUCKET_RATIO_MAX)
+
+	if (bucket->pairs != NULL)
 	{
-		++prime;
+		free(bucket->pairs);
+
+		bucket->pairs = NULL;
 	}
-	else
+
+	bucket->count = 0;
+	bucket->capacity = 0;
+
+	return 0;
+}
+
+static int set_rehash_step(set s, size_t slots)
+{
+	if (s->rehash_buckets == NULL)
 	{
 		return 0;
 	}
 
+	while (slots > 0 && s->rehash_index < s->rehash_capacity)
+	{
+		if (set_rehash_bucket_migrate(s, &s->rehash_buckets[s->rehash_index]) != 0)
+		{
+			return 1;
+		}
+
+		++s->rehash_index;
+		--slots;
+	}
+
+	if (s->rehash_index >= s->rehash_capacity)
+	{
+		free(s->rehash_buckets);
+
+		s->rehash_buckets = NULL;
+		s->rehash_capacity = 0;
+		s->rehash_index = 0;
+	}
+
+	return 0;
+}
+
+static int set_rehash_finish(set s)
+{
+	while (s->rehash_buckets != NULL)
+	{
+		if (set_rehash_step(s, s->rehash_capacity - s->rehash_index) != 0)
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int set_rehash_begin(set s, size_t prime)
+{
+	size_t capacity = set_bucket_capacity(prime);
+
+	set_bucket buckets = set_bucket_create(capacity);
+
+	if (buckets == NULL)
+	{
+		return 1;
+	}
+
+	s->rehash_buckets = s->buckets;
+	s->rehash_capacity = s->capacity;
+	s->rehash_index = 0;
+	s->buckets = buckets;
+	s->capacity = capacity;
+	s->prime = prime;
+
+	return 0;
+}
+
+/* Old bucket holding @h while its slot has not been migrated yet */
+static set_bucket set_rehash_old_bucket(set s, set_hash h)
+{
+	size_t index;
+
+	if (s->rehash_buckets == NULL)
+	{
+		return NULL;
+	}
+
+	index = h % s->rehash_capacity;
+
+	if (index < s->rehash_index)
+	{
+		return NULL;
+	}
+
+	return &s->rehash_buckets[index];
+}
+
+static int set_bucket_resize(set s, size_t prime)
+{
+	struct set_type new_set;
+
+	if (set_rehash_finish(s) != 0)
+	{
+		return 1;
+	}
+
 	new_set.hash_cb = s->hash_cb;
 	new_set.compare_cb = s->compare_cb;
 	new_set.count = 0;
@@ -189,30 +326,51 @@ static int set_bucket_realloc(set s)
 	return 1;
 }
 
-int set_insert(set s, set_key key, set_value value)
+static int set_bucket_realloc(set s)
 {
-	set_hash h;
+	size_t prime = s->prime;
 
-	size_t index;
+	float ratio;
 
-	set_bucket bucket;
+	/* One migration at a time, the ratio is rechecked once it drains */
+	if (s->rehash_buckets != NULL)
+	{
+		return 0;
+	}
 
-	set_pair pair;
+	ratio = (float)((float)s->count / (float)s->capacity);
 
-	if (s == NULL || key == NULL || value == NULL)
+	if (prime > 0 && ratio <= SET_BUCKET_RATIO_MIN)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid set insertion parameters");
-
-		return 1;
+		return set_bucket_resize(s, prime - 1);
+	}
+	else if (ratio >= SET_BUCKET_RATIO_MAX)
+	{
+		return set_rehash_begin(s, prime + 1);
 	}
 
-	h = s->hash_cb(key);
+	return 0;
+}
 
-	index = h % s->capacity;
+static int set_insert_pair(set s, set_key key, set_value value)
+{
+	set_hash h = s->hash_cb(key);
 
-	bucket = &s->buckets[index];
+	size_t index = h % s->capacity;
+
+	set_bucket bucket = &s->buckets[index];
 
-	pair = set_bucket_get_pair(bucket, s->compare_cb, key);
+	set_pair pair = set_bucket_get_pair(bucket, s->compare_cb, key);
+
+	if (pair == NULL)
+	{
+		set_bucket old_bucket = set_rehash_old_bucket(s, h);
+
+		if (old_bucket != NULL)
+		{
+			pair = set_bucket_get_pair(old_bucket, s->compare_cb, key);
+		}
+	}
 
 	if (pair != NULL)
 	{
@@ -230,12 +388,34 @@ int set_insert(set s, set_key key, set_value value)
 
 	++s->count;
 
+	return 0;
+}
+
+int set_insert(set s, set_key key, set_value value)
+{
+	if (s == NULL || key == NULL || value == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid set insertion parameters");
+
+		return 1;
+	}
+
+	if (set_rehash_step(s, SET_REHASH_STEP) != 0)
+	{
+		return 1;
+	}
+
+	if (set_insert_pair(s, key, value) != 0)
+	{
+		return 1;
+	}
+
 	return set_bucket_realloc(s);
 }
 
 int set_insert_array(set s, set_key keys[], set_value values[], size_t size)
 {
-	size_t iterator;
+	size_t iterator, prime;
 
 	if (s == NULL || keys == NULL || values == NULL)
 	{
@@ -244,9 +424,18 @@ int set_insert_array(set s, set_key keys[], set_value values[], size_t size)
 		return 1;
 	}
 
+	/* Size the bucket array once for the whole batch, the inserts
+	below cannot cross the ratio and rehash midway */
+	prime = set_prime_for(s->count + size);
+
+	if (prime > s->prime && set_bucket_resize(s, prime) != 0)
+	{
+		return 1;
+	}
+
 	for (iterator = 0; iterator < size; ++iterator)
 	{
-		if (set_insert(s, keys[iterator], values[iterator]) != 0)
+		if (set_insert_pair(s, keys[iterator], values[iterator]) != 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid set array insertion");
 
@@ -257,6 +446,59 @@ int set_insert_array(set s, set_key keys[], set_value values[], size_t size)
 	return 0;
 }
 
+int set_compact(set s)
+{
+	size_t iterator, prime;
+
+	if (s == NULL)
+	{
+		return 1;
+	}
+
+	if (set_rehash_finish(s) != 0)
+	{
+		return 1;
+	}
+
+	/* Sets that become effectively immutable after load shrink to the
+	smallest table holding their contents and drop the slack kept in
+	each bucket for future insertions */
+	prime = set_prime_for(s->count);
+
+	if (prime < s->prime && set_bucket_resize(s, prime) != 0)
+	{
+		return 1;
+	}
+
+	for (iterator = 0; iterator < s->capacity; ++iterator)
+	{
+		set_bucket bucket = &s->buckets[iterator];
+
+		if (bucket->pairs != NULL)
+		{
+			if (bucket->count == 0)
+			{
+				free(bucket->pairs);
+
+				bucket->pairs = NULL;
+				bucket->capacity = 0;
+			}
+			else if (bucket->capacity > bucket->count)
+			{
+				set_pair pairs = realloc(bucket->pairs, bucket->count * sizeof(struct set_pair_type));
+
+				if (pairs != NULL)
+				{
+					bucket->pairs = pairs;
+					bucket->capacity = bucket->count;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
 set_value set_get(set s, set_key key)
 {
 	if (s != NULL && key != NULL)
@@ -269,6 +511,16 @@ set_value set_get(set s, set_key key)
 
 		set_pair pair = set_bucket_get_pair(bucket, s->compare_cb, key);
 
+		if (pair == NULL)
+		{
+			set_bucket old_bucket = set_rehash_old_bucket(s, hash);
+
+			if (old_bucket != NULL)
+			{
+				pair = set_bucket_get_pair(old_bucket, s->compare_cb, key);
+			}
+		}
+
 		if (pair != NULL)
 		{
 			return pair->value;
@@ -290,6 +542,16 @@ int set_contains(set s, set_key key)
 
 		set_pair pair = set_bucket_get_pair(bucket, s->compare_cb, key);
 
+		if (pair == NULL)
+		{
+			set_bucket old_bucket = set_rehash_old_bucket(s, hash);
+
+			if (old_bucket != NULL)
+			{
+				pair = set_bucket_get_pair(old_bucket, s->compare_cb, key);
+			}
+		}
+
 		if (pair != NULL)
 		{
 			return 0;
@@ -341,12 +603,33 @@ set_value set_remove(set s, set_key key)
 		return NULL;
 	}
 
+	if (set_rehash_step(s, SET_REHASH_STEP) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid set remove rehash step");
+
+		return NULL;
+	}
+
 	h = s->hash_cb(key);
 
 	index = h % s->capacity;
 
 	bucket = &s->buckets[index];
 
+	/* The pair may still live in the old bucket array while the
+	incremental rehash drains it */
+	if (set_bucket_get_pair(bucket, s->compare_cb, key) == NULL)
+	{
+		bucket = set_rehash_old_bucket(s, h);
+
+		if (bucket == NULL || set_bucket_get_pair(bucket, s->compare_cb, key) == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid set bucket remove: %p", key);
+
+			return NULL;
+		}
+	}
+
 	if (set_bucket_remove(bucket, s->compare_cb, key, &value) != 0)
 	{
 		log_write("metacall", LOG_LEVEL_ERROR, "Invalid set bucket remove: %p", key);
@@ -391,6 +674,30 @@ void set_iterate(set s, set_cb_iterate iterate_cb, set_cb_iterate_args args)
 				}
 			}
 		}
+
+		/* Pairs not migrated yet live in the old bucket array */
+		if (s->rehash_buckets != NULL)
+		{
+			for (bucket_iterator = s->rehash_index; bucket_iterator < s->rehash_capacity; ++bucket_iterator)
+			{
+				set_bucket bucket = &s->rehash_buckets[bucket_iterator];
+
+				if (bucket->pairs != NULL && bucket->count > 0)
+				{
+					size_t pair_iterator;
+
+					for (pair_iterator = 0; pair_iterator < bucket->count; ++pair_iterator)
+					{
+						set_pair pair = &bucket->pairs[pair_iterator];
+
+						if (iterate_cb(s, pair->key, pair->value, args) != 0)
+						{
+							return;
+						}
+					}
+				}
+			}
+		}
 	}
 }
 
@@ -456,6 +763,27 @@ int set_clear(set s)
 		free(s->buckets);
 	}
 
+	if (s->rehash_buckets != NULL)
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < s->rehash_capacity; ++iterator)
+		{
+			set_bucket bucket = &s->rehash_buckets[iterator];
+
+			if (bucket->pairs != NULL)
+			{
+				free(bucket->pairs);
+			}
+		}
+
+		free(s->rehash_buckets);
+
+		s->rehash_buckets = NULL;
+		s->rehash_capacity = 0;
+		s->rehash_index = 0;
+	}
+
 	s->count = 0;
 	s->prime = 0;
 	s->capacity = set_bucket_capacity(s->prime);
@@ -495,6 +823,23 @@ void set_destroy(set s)
 		free(s->buckets);
 	}
 
+	if (s->rehash_buckets != NULL)
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < s->rehash_capacity; ++iterator)
+		{
+			set_bucket bucket = &s->rehash_buckets[iterator];
+
+			if (bucket->pairs != NULL)
+			{
+				free(bucket->pairs);
+			}
+		}
+
+		free(s->rehash_buckets);
+	}
+
 	free(s);
 }
 
@@ -502,7 +847,16 @@ set_iterator set_iterator_begin(set s)
 {
 	if (s != NULL && s->buckets != NULL && set_size(s) > 0)
 	{
-		set_iterator it = malloc(sizeof(struct set_iterator_type));
+		set_iterator it;
+
+		/* Iterators walk the primary bucket array only, drain any
+		pending migration so no pair is skipped */
+		if (set_rehash_finish(s) != 0)
+		{
+			return NULL;
+		}
+
+		it = malloc(sizeof(struct set_iterator_type));
 
 		if (it != NULL)
 		{
@@ -565,6 +919,63 @@ void set_iterator_next(set_iterator it)
 	}
 }
 
+static void set_cursor_seek(set_cursor cursor)
+{
+	for (; cursor->bucket < cursor->s->capacity; ++cursor->bucket)
+	{
+		set_bucket bucket = &cursor->s->buckets[cursor->bucket];
+
+		if (bucket->pairs != NULL && cursor->pair < bucket->count)
+		{
+			return;
+		}
+
+		cursor->pair = 0;
+	}
+}
+
+void set_cursor_begin(set s, set_cursor cursor)
+{
+	cursor->s = s;
+	cursor->bucket = 0;
+	cursor->pair = 0;
+
+	if (s != NULL && s->buckets != NULL)
+	{
+		/* Cursors walk the primary bucket array only, drain any
+		pending migration so no pair is skipped */
+		set_rehash_finish(s);
+
+		set_cursor_seek(cursor);
+	}
+	else
+	{
+		cursor->bucket = (s != NULL) ? s->capacity : 0;
+	}
+}
+
+int set_cursor_end(set_cursor cursor)
+{
+	return (cursor->s != NULL && cursor->bucket < cursor->s->capacity);
+}
+
+void set_cursor_next(set_cursor cursor)
+{
+	++cursor->pair;
+
+	set_cursor_seek(cursor);
+}
+
+set_key set_cursor_key(set_cursor cursor)
+{
+	return cursor->s->buckets[cursor->bucket].pairs[cursor->pair].key;
+}
+
+set_value set_cursor_value(set_cursor cursor)
+{
+	return cursor->s->buckets[cursor->bucket].pairs[cursor->pair].value;
+}
+
 int set_iterator_end(set_iterator *it)
 {
 	if (it != NULL && *it != NULL)
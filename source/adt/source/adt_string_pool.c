@@ -0,0 +1,197 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <adt/adt_hashmap.h>
+#include <adt/adt_string_pool.h>
+
+#include <threading/threading_mutex.h>
+
+#include <log/log.h>
+
+#include <string.h>
+
+/* -- Member Data -- */
+
+/* Interning maps each distinct string to one stable canonical copy,
+so two interned strings are equal if and only if their pointers are
+equal and maps can use pointer hashing instead of hashing the bytes */
+struct string_pool_type
+{
+	hashmap map;			/* Maps the canonical copy keyed by its own characters */
+	threading_mutex mutex;	/* Guards the map, interning must be usable from loader initialization threads */
+};
+
+/* Process wide pool behind string_intern, created on first use */
+static string_pool string_pool_instance = NULL;
+
+/* -- Methods -- */
+
+string_pool string_pool_create()
+{
+	string_pool pool = malloc(sizeof(struct string_pool_type));
+
+	if (pool == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad string pool allocation");
+
+		return NULL;
+	}
+
+	pool->map = hashmap_create(&hash_callback_str_fast, &comparable_callback_str);
+
+	if (pool->map == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad string pool map creation");
+
+		free(pool);
+
+		return NULL;
+	}
+
+	pool->mutex = threading_mutex_create();
+
+	if (pool->mutex == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad string pool mutex creation");
+
+		hashmap_destroy(pool->map);
+
+		free(pool);
+
+		return NULL;
+	}
+
+	return pool;
+}
+
+const char *string_pool_intern(string_pool pool, const char *str)
+{
+	char *canonical;
+
+	size_t size;
+
+	if (pool == NULL || str == NULL)
+	{
+		return NULL;
+	}
+
+	threading_mutex_lock(pool->mutex);
+
+	canonical = hashmap_get(pool->map, (hashmap_key)str);
+
+	if (canonical != NULL)
+	{
+		threading_mutex_unlock(pool->mutex);
+
+		return canonical;
+	}
+
+	size = strlen(str) + 1;
+
+	canonical = malloc(sizeof(char) * size);
+
+	if (canonical == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad string pool intern allocation");
+
+		threading_mutex_unlock(pool->mutex);
+
+		return NULL;
+	}
+
+	memcpy(canonical, str, size);
+
+	if (hashmap_insert(pool->map, (hashmap_key)canonical, (hashmap_value)canonical) != 0)
+	{
+		free(canonical);
+
+		threading_mutex_unlock(pool->mutex);
+
+		return NULL;
+	}
+
+	threading_mutex_unlock(pool->mutex);
+
+	return canonical;
+}
+
+size_t string_pool_size(string_pool pool)
+{
+	if (pool != NULL)
+	{
+		return hashmap_size(pool->map);
+	}
+
+	return 0;
+}
+
+static int string_pool_destroy_cb_iterate(hashmap map, hashmap_key key, hashmap_value value, hashmap_cb_iterate_args args)
+{
+	(void)map;
+	(void)key;
+	(void)args;
+
+	free(value);
+
+	return 0;
+}
+
+void string_pool_destroy(string_pool pool)
+{
+	if (pool == NULL)
+	{
+		return;
+	}
+
+	hashmap_iterate(pool->map, &string_pool_destroy_cb_iterate, NULL);
+
+	hashmap_destroy(pool->map);
+
+	threading_mutex_destroy(pool->mutex);
+
+	free(pool);
+}
+
+const char *string_intern(const char *str)
+{
+	if (string_pool_instance == NULL)
+	{
+		string_pool_instance = string_pool_create();
+
+		if (string_pool_instance == NULL)
+		{
+			return NULL;
+		}
+	}
+
+	return string_pool_intern(string_pool_instance, str);
+}
+
+void string_intern_clear()
+{
+	if (string_pool_instance != NULL)
+	{
+		string_pool_destroy(string_pool_instance);
+
+		string_pool_instance = NULL;
+	}
+}
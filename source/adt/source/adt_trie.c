@@ -642,6 +642,13 @@ int trie_node_clear(trie t, trie_node n)
 
 				t->free_node_list = free_node;
 
+				/* Mark the slot as dead so flat traversals skip it */
+				back->parent_index = 0;
+				back->self_index = 0;
+				back->key = NULL;
+				back->value = NULL;
+				back->childs = NULL;
+
 				--t->size;
 			}
 		}
@@ -800,6 +807,56 @@ trie trie_suffixes(trie t, trie_key key)
 	return NULL;
 }
 
+static void trie_cursor_seek(trie_cursor cursor)
+{
+	/* The root lives at slot zero and freed slots have a null key,
+	both are skipped; every live slot below capacity is visited */
+	for (; cursor->index < cursor->t->capacity; ++cursor->index)
+	{
+		if (cursor->t->node_list[cursor->index].key != NULL)
+		{
+			return;
+		}
+	}
+}
+
+void trie_cursor_begin(trie t, trie_cursor cursor)
+{
+	cursor->t = t;
+	cursor->index = 1;
+
+	if (t != NULL && t->node_list != NULL)
+	{
+		trie_cursor_seek(cursor);
+	}
+	else
+	{
+		cursor->index = (t != NULL) ? t->capacity : 0;
+	}
+}
+
+int trie_cursor_end(trie_cursor cursor)
+{
+	return (cursor->t != NULL && cursor->index < cursor->t->capacity);
+}
+
+void trie_cursor_next(trie_cursor cursor)
+{
+	++cursor->index;
+
+	trie_cursor_seek(cursor);
+}
+
+trie_key trie_cursor_key(trie_cursor cursor)
+{
+	return cursor->t->node_list[cursor->index].key;
+}
+
+trie_value trie_cursor_value(trie_cursor cursor)
+{
+	return cursor->t->node_list[cursor->index].value;
+}
+
 void trie_destroy(trie t)
 {
 	if (t != NULL)
@@ -32,6 +32,8 @@
 #define VECTOR_CAPACITY_MIN		  16 /**< Minimum capacity */
 #define VECTOR_CAPACITY_MIN_USED  8	 /**< Max unused capacity since free memory */
 
+#define VECTOR_INLINE_BUFFER_SIZE ((size_t)0x20) /**< Bytes stored inline in the vector struct */
+
 /* -- Member Data -- */
 
 struct vector_type
@@ -39,7 +41,9 @@ struct vector_type
 	size_t type_size; /**< Size of element type */
 	size_t capacity;  /**< Allocated capacity of the vector */
 	size_t size;	  /**< Amount of actual elements cointained in vector */
-	void *data;		  /**< Pointer to memory block */
+	void *data;		  /**< Pointer to memory block, may point to @buffer */
+
+	unsigned char buffer[VECTOR_INLINE_BUFFER_SIZE]; /**< Small buffer storing the elements inline while they fit */
 };
 
 /* -- Private Methods -- */
@@ -59,6 +63,18 @@ struct vector_type
 */
 static void *vector_data_offset_bytes(vector v, size_t bytes);
 
+/**
+*  @brief
+*    Check if the vector data lives in the inline buffer
+*
+*  @param[in] v
+*    Vector pointer
+*
+*  @return
+*    Different from zero when the data is stored inline
+*/
+static int vector_data_is_inline(vector v);
+
 /* -- Methods -- */
 
 void *vector_data_offset_bytes(vector v, size_t bytes)
@@ -71,9 +87,14 @@ void *vector_data_offset_bytes(vector v, size_t bytes)
 	return NULL;
 }
 
+int vector_data_is_inline(vector v)
+{
+	return (v->data == (void *)v->buffer);
+}
+
 vector vector_create(size_t type_size)
 {
-	return vector_create_reserve(type_size, VECTOR_CAPACITY_MIN);
+	return vector_create_reserve(type_size, 0);
 }
 
 vector vector_create_reserve(size_t type_size, size_t capacity)
@@ -89,9 +110,22 @@ vector vector_create_reserve(size_t type_size, size_t capacity)
 			return NULL;
 		}
 
+		size_t inline_capacity = VECTOR_INLINE_BUFFER_SIZE / type_size;
+
 		v->type_size = type_size;
-		v->capacity = (capacity < VECTOR_CAPACITY_MIN) ? VECTOR_CAPACITY_MIN : capacity;
 		v->size = 0;
+
+		/* Small vectors live in the inline buffer, the data block
+		is only allocated once the elements outgrow it */
+		if (inline_capacity > 0 && capacity <= inline_capacity)
+		{
+			v->capacity = inline_capacity;
+			v->data = (void *)v->buffer;
+
+			return v;
+		}
+
+		v->capacity = (capacity < VECTOR_CAPACITY_MIN) ? VECTOR_CAPACITY_MIN : capacity;
 		v->data = malloc(v->capacity * v->type_size);
 
 		if (v->data == NULL)
@@ -115,29 +149,14 @@ vector vector_copy(vector v)
 {
 	if (v != NULL)
 	{
-		vector dest = malloc(sizeof(struct vector_type));
+		vector dest = vector_create_reserve(v->type_size, v->size);
 
 		if (dest == NULL)
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Vector allocation error");
-
 			return NULL;
 		}
 
-		dest->data = malloc(v->type_size * v->capacity);
-
-		if (dest->data == NULL)
-		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Vector internal allocation error");
-
-			free(dest);
-
-			return NULL;
-		}
-
-		dest->capacity = v->capacity;
 		dest->size = v->size;
-		dest->type_size = v->type_size;
 
 		memcpy(dest->data, v->data, dest->size * dest->type_size);
 
@@ -151,20 +170,64 @@ int vector_reserve(vector v, size_t capacity)
 {
 	if (v != NULL && capacity != v->capacity)
 	{
+		size_t inline_capacity = VECTOR_INLINE_BUFFER_SIZE / v->type_size;
+
 		register void *data;
 
+		/* The requested capacity fits inline, move the elements
+		back into the buffer and release the heap block if any */
+		if (inline_capacity > 0 && capacity <= inline_capacity)
+		{
+			if (vector_data_is_inline(v) == 0)
+			{
+				size_t size = (v->size < inline_capacity) ? v->size : inline_capacity;
+
+				memcpy(v->buffer, v->data, size * v->type_size);
+
+				free(v->data);
+
+				v->data = (void *)v->buffer;
+				v->size = size;
+			}
+
+			v->capacity = inline_capacity;
+
+			return 0;
+		}
+
 		if (capacity < VECTOR_CAPACITY_MIN)
 		{
 			capacity = VECTOR_CAPACITY_MIN;
 		}
 
-		data = realloc(v->data, capacity * v->type_size);
+		if (capacity == v->capacity)
+		{
+			return 0;
+		}
 
-		if (data == NULL)
+		if (vector_data_is_inline(v))
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Vector reallocation error");
+			data = malloc(capacity * v->type_size);
 
-			return 1;
+			if (data == NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Vector allocation error");
+
+				return 1;
+			}
+
+			memcpy(data, v->buffer, v->size * v->type_size);
+		}
+		else
+		{
+			data = realloc(v->data, capacity * v->type_size);
+
+			if (data == NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Vector reallocation error");
+
+				return 1;
+			}
 		}
 
 		if (capacity < v->size)
@@ -182,6 +245,48 @@ int vector_reserve(vector v, size_t capacity)
 	return 1;
 }
 
+int vector_shrink(vector v)
+{
+	if (v != NULL)
+	{
+		size_t inline_capacity = VECTOR_INLINE_BUFFER_SIZE / v->type_size;
+
+		register void *data;
+
+		if (vector_data_is_inline(v))
+		{
+			return 0;
+		}
+
+		if (inline_capacity > 0 && v->size <= inline_capacity)
+		{
+			return vector_reserve(v, v->size);
+		}
+
+		if (v->size == v->capacity)
+		{
+			return 0;
+		}
+
+		data = realloc(v->data, v->size * v->type_size);
+
+		if (data == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Vector reallocation error");
+
+			return 1;
+		}
+
+		v->data = data;
+
+		v->capacity = v->size;
+
+		return 0;
+	}
+
+	return 1;
+}
+
 int vector_resize(vector v, size_t size)
 {
 	if (v != NULL)
@@ -471,7 +576,7 @@ void vector_destroy(vector v)
 {
 	if (v != NULL)
 	{
-		if (v->data != NULL)
+		if (v->data != NULL && vector_data_is_inline(v) == 0)
 		{
 			free(v->data);
 		}
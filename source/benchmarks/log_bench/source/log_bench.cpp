@@ -23,6 +23,10 @@
 #include <log/log.h>
 #include <metacall/metacall_loaders.h>
 
+#include <cstdlib>
+#include <mutex>
+#include <string>
+
 static int stream_write(void *, const char *, const size_t)
 {
 	// Disable stream write so we do not count stdout on the benchmark
@@ -101,4 +105,145 @@ BENCHMARK_REGISTER_F(log_bench, call_va)
 	->Iterations(1)
 	->Repetitions(3);
 
+/* Multi-producer contention scenarios: the same record is written from
+a growing number of threads through the sync and the async schedule
+policies so producer side blocking shows up directly as a throughput
+drop. Results are machine readable through the standard benchmark
+flags (--benchmark_format=json --benchmark_out=<file>) for tracking
+regressions per commit */
+
+static void log_bench_contention_configure(const char *name, log_policy schedule)
+{
+	if (log_configure_impl(name, 4,
+			log_policy_format_text(),
+			schedule,
+			log_policy_storage_sequential(),
+			log_policy_stream_custom(NULL, &stream_write, &stream_flush)) != 0)
+	{
+		abort();
+	}
+}
+
+class log_bench_contention : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &)
+	{
+		/* SetUp runs on every producer thread, configure each logger once */
+		static std::once_flag once;
+
+		std::call_once(once, []() {
+			log_bench_contention_configure("bench_sync", log_policy_schedule_sync());
+			log_bench_contention_configure("bench_async", log_policy_schedule_async());
+		});
+	}
+
+	void TearDown(benchmark::State &)
+	{
+	}
+};
+
+static const char *log_bench_large_message()
+{
+	static const std::string large(448, 'x');
+
+	return large.c_str();
+}
+
+BENCHMARK_DEFINE_F(log_bench_contention, sync_small)
+(benchmark::State &state)
+{
+	const int64_t call_count = 10000;
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			benchmark::DoNotOptimize(log_write("bench_sync", LOG_LEVEL_ERROR, "Message"));
+		}
+	}
+
+	state.SetLabel("Log Benchmark - Contention Sync Small Record");
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(log_bench_contention, sync_small)
+	->ThreadRange(1, 64)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(log_bench_contention, sync_large)
+(benchmark::State &state)
+{
+	const int64_t call_count = 10000;
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			benchmark::DoNotOptimize(log_write("bench_sync", LOG_LEVEL_ERROR, "%s", log_bench_large_message()));
+		}
+	}
+
+	state.SetLabel("Log Benchmark - Contention Sync Large Record");
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(log_bench_contention, sync_large)
+	->ThreadRange(1, 64)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(log_bench_contention, async_small)
+(benchmark::State &state)
+{
+	const int64_t call_count = 10000;
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			benchmark::DoNotOptimize(log_write("bench_async", LOG_LEVEL_ERROR, "Message"));
+		}
+	}
+
+	state.SetLabel("Log Benchmark - Contention Async Small Record");
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(log_bench_contention, async_small)
+	->ThreadRange(1, 64)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(log_bench_contention, async_large)
+(benchmark::State &state)
+{
+	const int64_t call_count = 10000;
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			benchmark::DoNotOptimize(log_write("bench_async", LOG_LEVEL_ERROR, "%s", log_bench_large_message()));
+		}
+	}
+
+	state.SetLabel("Log Benchmark - Contention Async Large Record");
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(log_bench_contention, async_large)
+	->ThreadRange(1, 64)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
 BENCHMARK_MAIN();
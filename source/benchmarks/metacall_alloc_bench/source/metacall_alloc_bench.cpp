@@ -0,0 +1,226 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_loaders.h>
+
+#include <memory/memory_allocator_trace.h>
+
+#include <cstdlib>
+
+#if !defined(_WIN32)
+	#include <sys/resource.h>
+#endif
+
+#define ALLOC_BENCH_ARRAY_SIZE ((size_t)10000)
+
+class metacall_alloc_bench : public benchmark::Fixture
+{
+public:
+};
+
+/* Peak resident set size of the process in kilobytes, reported next to
+*  the allocator counters so native heap growth outside the interposed
+*  layer still shows up in the results */
+static double alloc_bench_peak_rss_kb(void)
+{
+#if !defined(_WIN32)
+	struct rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+	{
+		return (double)usage.ru_maxrss;
+	}
+#endif
+
+	return 0.0;
+}
+
+/* Publish the per call allocation profile of the traced section */
+static void alloc_bench_report(benchmark::State &state, memory_allocator allocator, int64_t call_count)
+{
+	struct memory_allocator_trace_stats_type stats;
+
+	memory_allocator_trace_stats_snapshot(allocator, &stats);
+
+	state.counters["allocs_per_call"] = benchmark::Counter((double)stats.allocations / (double)call_count);
+	state.counters["bytes_per_call"] = benchmark::Counter((double)stats.bytes_allocated / (double)call_count);
+	state.counters["bytes_peak"] = benchmark::Counter((double)stats.bytes_peak);
+	state.counters["peak_rss_kb"] = benchmark::Counter(alloc_bench_peak_rss_kb());
+
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_DEFINE_F(metacall_alloc_bench, inspect)
+(benchmark::State &state)
+{
+	const int64_t call_count = 1000;
+
+	memory_allocator allocator = memory_allocator_trace(&std::malloc, &std::realloc, &std::free);
+
+	if (allocator == NULL)
+	{
+		state.SkipWithError("Error creating trace allocator");
+	}
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			size_t size = 0;
+
+			char *inspect_str;
+
+			benchmark::DoNotOptimize(inspect_str = metacall_inspect(&size, allocator));
+
+			state.PauseTiming();
+
+			if (inspect_str == NULL)
+			{
+				state.SkipWithError("Null return value from inspect");
+			}
+
+			metacall_allocator_free(allocator, inspect_str);
+
+			state.ResumeTiming();
+		}
+	}
+
+	alloc_bench_report(state, allocator, call_count);
+
+	state.SetLabel("MetaCall Allocation Benchmark - Inspect");
+
+	memory_allocator_destroy(allocator);
+}
+
+BENCHMARK_REGISTER_F(metacall_alloc_bench, inspect)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_alloc_bench, serialize_array_10k)
+(benchmark::State &state)
+{
+	const int64_t call_count = 100;
+
+	memory_allocator allocator = memory_allocator_trace(&std::malloc, &std::realloc, &std::free);
+
+	if (allocator == NULL)
+	{
+		state.SkipWithError("Error creating trace allocator");
+	}
+
+	void **elements = static_cast<void **>(std::malloc(sizeof(void *) * ALLOC_BENCH_ARRAY_SIZE));
+
+	for (size_t it = 0; it < ALLOC_BENCH_ARRAY_SIZE; ++it)
+	{
+		elements[it] = metacall_value_create_long((long)it);
+	}
+
+	void *v = metacall_value_create_array((const void **)elements, ALLOC_BENCH_ARRAY_SIZE);
+
+	for (size_t it = 0; it < ALLOC_BENCH_ARRAY_SIZE; ++it)
+	{
+		metacall_value_destroy(elements[it]);
+	}
+
+	std::free(elements);
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			size_t size = 0;
+
+			char *buffer;
+
+			benchmark::DoNotOptimize(buffer = metacall_serialize(metacall_serial(), v, &size, allocator));
+
+			state.PauseTiming();
+
+			if (buffer == NULL)
+			{
+				state.SkipWithError("Null return value from serialize");
+			}
+
+			metacall_allocator_free(allocator, buffer);
+
+			state.ResumeTiming();
+		}
+	}
+
+	alloc_bench_report(state, allocator, call_count);
+
+	state.SetLabel("MetaCall Allocation Benchmark - Serialize 10k Array");
+
+	metacall_value_destroy(v);
+
+	memory_allocator_destroy(allocator);
+}
+
+BENCHMARK_REGISTER_F(metacall_alloc_bench, serialize_array_10k)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+int main(int argc, char **argv)
+{
+	::benchmark::Initialize(&argc, argv);
+
+	if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 1;
+	}
+
+	metacall_print_info();
+
+	metacall_log_null();
+
+	if (metacall_initialize() != 0)
+	{
+		return 1;
+	}
+
+/* Python */
+#if defined(OPTION_BUILD_LOADERS_PY)
+	{
+		static const char tag[] = "py";
+
+		static const char py_echo[] =
+			"#!/usr/bin/env python3\n"
+			"def py_alloc_echo(value):\n"
+			"\treturn value;";
+
+		if (metacall_load_from_memory(tag, py_echo, sizeof(py_echo), NULL) != 0)
+		{
+			metacall_destroy();
+			return 1;
+		}
+	}
+#endif /* OPTION_BUILD_LOADERS_PY */
+
+	::benchmark::RunSpecifiedBenchmarks();
+
+	return metacall_destroy();
+}
@@ -0,0 +1,399 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_loaders.h>
+
+#include <cstring>
+
+/* Payload shapes shared by every cell of the matrix */
+#define CALL_MATRIX_STRING_SIZE 0x400	  /* 1KB string */
+#define CALL_MATRIX_BUFFER_SIZE 0x100000  /* 1MB buffer */
+#define CALL_MATRIX_ARRAY_SIZE	((size_t)10000) /* 10k element array */
+
+class metacall_call_matrix_bench : public benchmark::Fixture
+{
+public:
+};
+
+/* Each cell of the matrix calls the echo function of one runtime with
+*  one payload shape, measuring the marshaling round trip host -> runtime
+*  -> host; the argument is created once so the timing covers calls only */
+static void call_matrix_echo(benchmark::State &state, const char *name, void *arg, int64_t payload_size)
+{
+	const int64_t call_count = 10000;
+
+	void *args[1] = { arg };
+
+	for (auto _ : state)
+	{
+		void *ret;
+
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			benchmark::DoNotOptimize(ret = metacallv(name, args));
+
+			state.PauseTiming();
+
+			if (ret == NULL)
+			{
+				state.SkipWithError("Null return value from echo function");
+			}
+
+			metacall_value_destroy(ret);
+
+			state.ResumeTiming();
+		}
+	}
+
+	state.SetBytesProcessed(payload_size * call_count);
+	state.SetItemsProcessed(call_count);
+
+	metacall_value_destroy(arg);
+}
+
+static void *call_matrix_string_create(void)
+{
+	char str[CALL_MATRIX_STRING_SIZE + 1];
+
+	memset(str, 'a', CALL_MATRIX_STRING_SIZE);
+
+	str[CALL_MATRIX_STRING_SIZE] = '\0';
+
+	return metacall_value_create_string(str, CALL_MATRIX_STRING_SIZE);
+}
+
+static void *call_matrix_buffer_create(void)
+{
+	static unsigned char buffer[CALL_MATRIX_BUFFER_SIZE];
+
+	memset(buffer, 0xA5, CALL_MATRIX_BUFFER_SIZE);
+
+	return metacall_value_create_buffer(buffer, CALL_MATRIX_BUFFER_SIZE);
+}
+
+static void *call_matrix_array_create(void)
+{
+	static void *elements[CALL_MATRIX_ARRAY_SIZE];
+
+	for (size_t it = 0; it < CALL_MATRIX_ARRAY_SIZE; ++it)
+	{
+		elements[it] = metacall_value_create_long((long)it);
+	}
+
+	void *v = metacall_value_create_array((const void **)elements, CALL_MATRIX_ARRAY_SIZE);
+
+	for (size_t it = 0; it < CALL_MATRIX_ARRAY_SIZE; ++it)
+	{
+		metacall_value_destroy(elements[it]);
+	}
+
+	return v;
+}
+
+/* Python */
+#if defined(OPTION_BUILD_LOADERS_PY)
+
+BENCHMARK_DEFINE_F(metacall_call_matrix_bench, py_echo_scalar)
+(benchmark::State &state)
+{
+	call_matrix_echo(state, "py_echo", metacall_value_create_long(0L), sizeof(long) * 2);
+	state.SetLabel("MetaCall Call Matrix Benchmark - Python Scalar");
+}
+
+BENCHMARK_REGISTER_F(metacall_call_matrix_bench, py_echo_scalar)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_call_matrix_bench, py_echo_string_1kb)
+(benchmark::State &state)
+{
+	call_matrix_echo(state, "py_echo", call_matrix_string_create(), CALL_MATRIX_STRING_SIZE * 2);
+	state.SetLabel("MetaCall Call Matrix Benchmark - Python 1KB String");
+}
+
+BENCHMARK_REGISTER_F(metacall_call_matrix_bench, py_echo_string_1kb)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_call_matrix_bench, py_echo_buffer_1mb)
+(benchmark::State &state)
+{
+	call_matrix_echo(state, "py_echo", call_matrix_buffer_create(), CALL_MATRIX_BUFFER_SIZE * 2);
+	state.SetLabel("MetaCall Call Matrix Benchmark - Python 1MB Buffer");
+}
+
+BENCHMARK_REGISTER_F(metacall_call_matrix_bench, py_echo_buffer_1mb)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_call_matrix_bench, py_echo_array_10k)
+(benchmark::State &state)
+{
+	call_matrix_echo(state, "py_echo", call_matrix_array_create(), (int64_t)(CALL_MATRIX_ARRAY_SIZE * sizeof(long) * 2));
+	state.SetLabel("MetaCall Call Matrix Benchmark - Python 10k Array");
+}
+
+BENCHMARK_REGISTER_F(metacall_call_matrix_bench, py_echo_array_10k)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+#endif /* OPTION_BUILD_LOADERS_PY */
+
+/* NodeJS */
+#if defined(OPTION_BUILD_LOADERS_NODE)
+
+BENCHMARK_DEFINE_F(metacall_call_matrix_bench, node_echo_scalar)
+(benchmark::State &state)
+{
+	call_matrix_echo(state, "node_echo", metacall_value_create_double(0.0), sizeof(double) * 2);
+	state.SetLabel("MetaCall Call Matrix Benchmark - NodeJS Scalar");
+}
+
+BENCHMARK_REGISTER_F(metacall_call_matrix_bench, node_echo_scalar)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_call_matrix_bench, node_echo_string_1kb)
+(benchmark::State &state)
+{
+	call_matrix_echo(state, "node_echo", call_matrix_string_create(), CALL_MATRIX_STRING_SIZE * 2);
+	state.SetLabel("MetaCall Call Matrix Benchmark - NodeJS 1KB String");
+}
+
+BENCHMARK_REGISTER_F(metacall_call_matrix_bench, node_echo_string_1kb)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_call_matrix_bench, node_echo_buffer_1mb)
+(benchmark::State &state)
+{
+	call_matrix_echo(state, "node_echo", call_matrix_buffer_create(), CALL_MATRIX_BUFFER_SIZE * 2);
+	state.SetLabel("MetaCall Call Matrix Benchmark - NodeJS 1MB Buffer");
+}
+
+BENCHMARK_REGISTER_F(metacall_call_matrix_bench, node_echo_buffer_1mb)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_call_matrix_bench, node_echo_array_10k)
+(benchmark::State &state)
+{
+	call_matrix_echo(state, "node_echo", call_matrix_array_create(), (int64_t)(CALL_MATRIX_ARRAY_SIZE * sizeof(long) * 2));
+	state.SetLabel("MetaCall Call Matrix Benchmark - NodeJS 10k Array");
+}
+
+BENCHMARK_REGISTER_F(metacall_call_matrix_bench, node_echo_array_10k)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+#endif /* OPTION_BUILD_LOADERS_NODE */
+
+/* Ruby */
+#if defined(OPTION_BUILD_LOADERS_RB)
+
+BENCHMARK_DEFINE_F(metacall_call_matrix_bench, rb_echo_scalar)
+(benchmark::State &state)
+{
+	call_matrix_echo(state, "rb_echo_int", metacall_value_create_int(0), sizeof(int) * 2);
+	state.SetLabel("MetaCall Call Matrix Benchmark - Ruby Scalar");
+}
+
+BENCHMARK_REGISTER_F(metacall_call_matrix_bench, rb_echo_scalar)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_call_matrix_bench, rb_echo_string_1kb)
+(benchmark::State &state)
+{
+	call_matrix_echo(state, "rb_echo_str", call_matrix_string_create(), CALL_MATRIX_STRING_SIZE * 2);
+	state.SetLabel("MetaCall Call Matrix Benchmark - Ruby 1KB String");
+}
+
+BENCHMARK_REGISTER_F(metacall_call_matrix_bench, rb_echo_string_1kb)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+#endif /* OPTION_BUILD_LOADERS_RB */
+
+/* CSharp */
+#if defined(OPTION_BUILD_LOADERS_CS)
+
+BENCHMARK_DEFINE_F(metacall_call_matrix_bench, cs_echo_scalar)
+(benchmark::State &state)
+{
+	call_matrix_echo(state, "cs_echo", metacall_value_create_int(0), sizeof(int) * 2);
+	state.SetLabel("MetaCall Call Matrix Benchmark - CSharp Scalar");
+}
+
+BENCHMARK_REGISTER_F(metacall_call_matrix_bench, cs_echo_scalar)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_call_matrix_bench, cs_echo_string_1kb)
+(benchmark::State &state)
+{
+	call_matrix_echo(state, "cs_echo_str", call_matrix_string_create(), CALL_MATRIX_STRING_SIZE * 2);
+	state.SetLabel("MetaCall Call Matrix Benchmark - CSharp 1KB String");
+}
+
+BENCHMARK_REGISTER_F(metacall_call_matrix_bench, cs_echo_string_1kb)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+#endif /* OPTION_BUILD_LOADERS_CS */
+
+int main(int argc, char **argv)
+{
+	::benchmark::Initialize(&argc, argv);
+
+	if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 1;
+	}
+
+	/* TODO: MetaCall NodeJS Loader does not work with re-initalization */
+	/* Maybe the bug cannot be solved, but if it is eventually solved, */
+	/* use SetUp and TearDown in the Fixture instead of this */
+
+	metacall_print_info();
+
+	metacall_log_null();
+
+	if (metacall_initialize() != 0)
+	{
+		return 1;
+	}
+
+/* Python */
+#if defined(OPTION_BUILD_LOADERS_PY)
+	{
+		static const char tag[] = "py";
+
+		static const char py_echo[] =
+			"#!/usr/bin/env python3\n"
+			"def py_echo(value):\n"
+			"\treturn value;";
+
+		if (metacall_load_from_memory(tag, py_echo, sizeof(py_echo), NULL) != 0)
+		{
+			metacall_destroy();
+			return 1;
+		}
+	}
+#endif /* OPTION_BUILD_LOADERS_PY */
+
+/* NodeJS */
+#if defined(OPTION_BUILD_LOADERS_NODE)
+	{
+		static const char tag[] = "node";
+
+		static const char node_echo[] =
+			"#!/usr/bin/env node\n"
+			"module.exports = {\n"
+			"	node_echo: (value) => value,\n"
+			"};\n";
+
+		if (metacall_load_from_memory(tag, node_echo, sizeof(node_echo), NULL) != 0)
+		{
+			metacall_destroy();
+			return 1;
+		}
+	}
+#endif /* OPTION_BUILD_LOADERS_NODE */
+
+/* Ruby */
+#if defined(OPTION_BUILD_LOADERS_RB)
+	{
+		static const char tag[] = "rb";
+
+		static const char rb_echo[] =
+			"#!/usr/bin/env ruby\n"
+			"def rb_echo_int(value: Fixnum)\n"
+			"\treturn value\n"
+			"end\n"
+			"def rb_echo_str(value: String)\n"
+			"\treturn value\n"
+			"end\n";
+
+		if (metacall_load_from_memory(tag, rb_echo, sizeof(rb_echo), NULL) != 0)
+		{
+			metacall_destroy();
+			return 1;
+		}
+	}
+#endif /* OPTION_BUILD_LOADERS_RB */
+
+/* CSharp */
+#if defined(OPTION_BUILD_LOADERS_CS)
+	{
+		static const char tag[] = "cs";
+
+		static const char cs_echo[] =
+			"using System;\n"
+			"namespace Scripts {\n"
+			"\tpublic class Program {\n"
+			"\t\tpublic static int cs_echo(int value) {\n"
+			"\t\t\treturn value;\n"
+			"\t\t}\n"
+			"\t\tpublic static string cs_echo_str(string value) {\n"
+			"\t\t\treturn value;\n"
+			"\t\t}\n"
+			"\t}\n"
+			"}\n";
+
+		if (metacall_load_from_memory(tag, cs_echo, sizeof(cs_echo), NULL) != 0)
+		{
+			metacall_destroy();
+			return 1;
+		}
+	}
+#endif /* OPTION_BUILD_LOADERS_CS */
+
+	::benchmark::RunSpecifiedBenchmarks();
+
+	return metacall_destroy();
+}
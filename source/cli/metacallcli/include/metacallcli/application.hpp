@@ -14,6 +14,7 @@
 #include <metacall/metacall.h>
 
 #include <condition_variable>
+#include <istream>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -95,12 +96,48 @@ public:
 	*/
 	bool clear(const std::string &tag, const std::string &script);
 
+	/**
+	*  @brief
+	*    Execute a stream of calls in batch mode, one JSON object per
+	*    line ({"name":"concat","args":["a","b"]}); each function is
+	*    resolved once and reused across the whole stream, results are
+	*    written to stdout one line per call and diagnostics to stderr
+
+	*  @param[in] stream
+	*    Input stream with one call per line
+
+	*  @return
+	*    Return true on success, false otherwhise
+	*/
+	bool batch(std::istream &stream);
+
 	/**
 	*  @brief
 	*    Application main entry point
 	*/
 	void run(void);
 
+	/**
+	*  @brief
+	*    Serve commands from other CLI invocations over a local IPC
+	*    endpoint, keeping the initialized runtimes resident until an
+	*    exit command is received
+	*/
+	void run_daemon(void);
+
+	/**
+	*  @brief
+	*    Dispatch the command @command to a resident daemon and print
+	*    its response, the core is not initialized in this mode
+
+	*  @param[in] command
+	*    Command line to be executed by the daemon
+
+	*  @return
+	*    Return true on success, false otherwhise
+	*/
+	bool client(const std::string &command);
+
 	/**
 	*  @brief
 	*    Shutdown main application loop
@@ -286,6 +323,7 @@ private:
 	/* -- Private Member Data -- */
 
 	bool exit_condition;				/**< Condition for main loop */
+	bool daemon_mode;					/**< Serve commands over IPC instead of the prompt */
 	arg_list arguments;					/**< Vector containing a list of arguments */
 	script_list scripts;				/**< Vector containing a list of script names */
 	command_table commands;				/**< Hash table from command strings to command handlers */
@@ -12,9 +12,14 @@
 #include <metacallcli/parser.hpp>
 #include <metacallcli/tokenizer.hpp>
 
+#include <portability/portability_ipc.h>
+
 #include <algorithm>
+#include <cstdint>
+#include <fstream>
 #include <functional>
 #include <iostream>
+#include <sstream>
 
 /* TODO: Windows special characters not working properly */
 /* Set UTF-16 mode for stdout in Windows for the lambda character */
@@ -34,6 +39,46 @@ using namespace metacallcli;
 
 /* -- Private Methods -- */
 
+/* Endpoint shared by the daemon and the connecting invocations */
+static const char daemon_endpoint_name[] = "metacallcli";
+
+void value_map_for_each(void *v, const std::function<void(const char *, void *)> &lambda);
+
+std::string tag_from_extension(const std::string &script)
+{
+	/* List of file extensions mapped into loader tags */
+	static std::unordered_map<std::string, std::string> extension_to_tag = {
+		/* Mock Loader */
+		{ "mock", "mock" },
+		/* Python Loader */
+		{ "py", "py" },
+		/* Ruby Loader */
+		{ "rb", "rb" },
+		/* C# Loader */
+		{ "cs", "cs" },
+		{ "dll", "cs" },
+		{ "vb", "cs" },
+		/* Cobol Loader */
+		{ "cob", "cob" },
+		{ "cbl", "cob" },
+		{ "cpy", "cob" },
+		/* NodeJS Loader */
+		{ "js", "node" },
+		{ "node", "node" },
+		/* TypeScript Loader */
+		{ "ts", "ts" },
+		{ "jsx", "ts" },
+		{ "tsx", "ts" }
+
+		/* Note: By default js extension uses NodeJS loader instead of JavaScript V8 */
+		/* Probably in the future we can differenciate between them, but it is not trivial */
+	};
+
+	const std::string tag = extension_to_tag[script.substr(script.find_last_of(".") + 1)];
+
+	return tag != "" ? tag : "file"; /* Use File Loader if the tag is not found */
+}
+
 bool command_cb_help(application & /*app*/, tokenizer & /*t*/)
 {
 	std::cout << "MetaCall Command Line Interface by Parra Studios" << std::endl;
@@ -64,6 +109,7 @@ bool command_cb_help(application & /*app*/, tokenizer & /*t*/)
 	std::cout << "\t│                            js   - V8 JavaScript Engine                                 │" << std::endl;
 	std::cout << "\t│                            file - Files (for handling file systems)                    │" << std::endl;
 	std::cout << "\t│    <script0> <script1> ... <scriptN> : relative or absolute path to the script(s)      │" << std::endl;
+	std::cout << "\t│    the tag can be omitted, then it is inferred from each script file extension         │" << std::endl;
 	std::cout << "\t│                                                                                        │" << std::endl;
 	std::cout << "\t│ Example:                                                                               │" << std::endl;
 	std::cout << "\t│ load node concat.js                                                                    │" << std::endl;
@@ -75,6 +121,39 @@ bool command_cb_help(application & /*app*/, tokenizer & /*t*/)
 	std::cout << "\t└────────────────────────────────────────────────────────────────────────────────────────┘" << std::endl
 			  << std::endl;
 
+	/* Preload command */
+	std::cout << "\t┌────────────────────────────────────────────────────────────────────────────────────────┐" << std::endl;
+	std::cout << "\t│ Warm up one or more runtimes in the background without loading any script              │" << std::endl;
+	std::cout << "\t│────────────────────────────────────────────────────────────────────────────────────────│" << std::endl;
+	std::cout << "\t│ Usage:                                                                                 │" << std::endl;
+	std::cout << "\t│ preload <runtime tag0> <runtime tag1> ... <runtime tagN>                               │" << std::endl;
+	std::cout << "\t│    <runtime tag> : identifier to the type of runtime (same options as load)            │" << std::endl;
+	std::cout << "\t│                                                                                        │" << std::endl;
+	std::cout << "\t│ Example:                                                                               │" << std::endl;
+	std::cout << "\t│ preload node py                                                                        │" << std::endl;
+	std::cout << "\t│                                                                                        │" << std::endl;
+	std::cout << "\t│ Result:                                                                                │" << std::endl;
+	std::cout << "\t│ Warming up runtime(s) in background ...                                                │" << std::endl;
+	std::cout << "\t└────────────────────────────────────────────────────────────────────────────────────────┘" << std::endl
+			  << std::endl;
+
+	/* Batch command */
+	std::cout << "\t┌────────────────────────────────────────────────────────────────────────────────────────┐" << std::endl;
+	std::cout << "\t│ Execute a stream of calls in batch mode, resolving each function only once             │" << std::endl;
+	std::cout << "\t│────────────────────────────────────────────────────────────────────────────────────────│" << std::endl;
+	std::cout << "\t│ Usage:                                                                                 │" << std::endl;
+	std::cout << "\t│ batch [<file>]                                                                         │" << std::endl;
+	std::cout << "\t│    <file> : path to a file with one call per line, stdin is read when omitted          │" << std::endl;
+	std::cout << "\t│    each line is a JSON object: {\"name\":\"<function name>\",\"args\":[<arg0>, ...]}         │" << std::endl;
+	std::cout << "\t│                                                                                        │" << std::endl;
+	std::cout << "\t│ Example:                                                                               │" << std::endl;
+	std::cout << "\t│ batch calls.jsonl                                                                      │" << std::endl;
+	std::cout << "\t│                                                                                        │" << std::endl;
+	std::cout << "\t│ Result:                                                                                │" << std::endl;
+	std::cout << "\t│ \"hello world\"                                                                          │" << std::endl;
+	std::cout << "\t└────────────────────────────────────────────────────────────────────────────────────────┘" << std::endl
+			  << std::endl;
+
 	/* Inspect command */
 	std::cout << "\t┌────────────────────────────────────────────────────────────────────────────────────────┐" << std::endl;
 	std::cout << "\t│ Show all runtimes, modules and functions (with their signature) loaded into MetaCall   │" << std::endl;
@@ -399,7 +478,18 @@ bool command_cb_load(application &app, tokenizer &t)
 	// check if invalid loader tag
 	if (std::find(std::begin(loaders), std::end(loaders), loader_tag) == std::end(loaders))
 	{
-		return false;
+		/* Allow omitting the tag (load a.py b.js), inferring it from each script extension */
+		if (loader_tag.find_last_of(".") == std::string::npos)
+		{
+			return false;
+		}
+
+		while (it != t.end() && p.is<std::string>() && app.load(tag_from_extension(*it), *it))
+		{
+			++it;
+		}
+
+		return true;
 	}
 
 	do
@@ -435,6 +525,68 @@ bool command_cb_clear(application &app, tokenizer &t)
 	return true;
 }
 
+bool command_cb_preload(application & /*app*/, tokenizer &t)
+{
+	tokenizer::iterator it = t.begin();
+
+	parser p(it);
+
+	std::vector<std::string> tags;
+
+	for (++it; it != t.end() && p.is<std::string>(); ++it)
+	{
+		tags.push_back(*it);
+	}
+
+	if (tags.empty())
+	{
+		return false;
+	}
+
+	std::vector<const char *> tag_ptrs(tags.size());
+
+	std::transform(tags.begin(), tags.end(), tag_ptrs.begin(), [](const std::string &tag) {
+		return tag.c_str();
+	});
+
+	if (metacall_preload(tag_ptrs.data(), tag_ptrs.size()) != 0)
+	{
+		std::cout << "Runtime warm up could not be started" << std::endl;
+
+		return false;
+	}
+
+	std::cout << "Warming up runtime(s) in background ..." << std::endl;
+
+	return true;
+}
+
+bool command_cb_batch(application &app, tokenizer &t)
+{
+	tokenizer::iterator it = t.begin();
+
+	parser p(it);
+
+	++it;
+
+	/* Read the calls from a file when given, from stdin otherwise */
+	if (it != t.end() && p.is<std::string>())
+	{
+		std::ifstream file(*it);
+
+		if (!file.is_open())
+		{
+			std::cout << "Batch file (" << *it << ") could not be opened" << std::endl;
+
+			return false;
+		}
+
+		return app.batch(file);
+	}
+
+	return app.batch(std::cin);
+}
+
 bool command_cb_exit(application &app, tokenizer & /*t*/)
 {
 	std::cout << "Exiting ..." << std::endl;
@@ -459,38 +611,7 @@ void application::parameter_iterator::operator()(const char *parameter)
 {
 	std::string script(parameter);
 
-	/* List of file extensions mapped into loader tags */
-	static std::unordered_map<std::string, std::string> extension_to_tag = {
-		/* Mock Loader */
-		{ "mock", "mock" },
-		/* Python Loader */
-		{ "py", "py" },
-		/* Ruby Loader */
-		{ "rb", "rb" },
-		/* C# Loader */
-		{ "cs", "cs" },
-		{ "dll", "cs" },
-		{ "vb", "cs" },
-		/* Cobol Loader */
-		{ "cob", "cob" },
-		{ "cbl", "cob" },
-		{ "cpy", "cob" },
-		/* NodeJS Loader */
-		{ "js", "node" },
-		{ "node", "node" },
-		/* TypeScript Loader */
-		{ "ts", "ts" },
-		{ "jsx", "ts" },
-		{ "tsx", "ts" }
-
-		/* Note: By default js extension uses NodeJS loader instead of JavaScript V8 */
-		/* Probably in the future we can differenciate between them, but it is not trivial */
-	};
-
-	const std::string tag = extension_to_tag[script.substr(script.find_last_of(".") + 1)];
-	const std::string safeTag = tag != "" ? tag : "file"; /* Use File Loader if the tag is not found */
-
-	app.load(safeTag, script);
+	app.load(tag_from_extension(script), script);
 	app.shutdown();
 }
 
@@ -544,8 +665,127 @@ bool application::clear(const std::string &tag, const std::string &script)
 	return true;
 }
 
+bool application::batch(std::istream &stream)
+{
+	struct metacall_allocator_std_type std_ctx = { &std::malloc, &std::realloc, &std::free };
+
+	void *allocator = metacall_allocator_create(METACALL_ALLOCATOR_STD, (void *)&std_ctx);
+
+	/* Function handles resolved once and reused across the whole stream */
+	std::unordered_map<std::string, void *> functions;
+
+	std::string line;
+
+	size_t line_number = 0;
+
+	bool result = true;
+
+	while (std::getline(stream, line))
+	{
+		++line_number;
+
+		if (line.empty())
+		{
+			continue;
+		}
+
+		void *v = metacall_deserialize(metacall_serial(), line.c_str(), line.length() + 1, allocator);
+
+		if (v == NULL || metacall_value_id(v) != METACALL_MAP)
+		{
+			std::cerr << "Batch line " << line_number << ": invalid call, expected {\"name\":...,\"args\":[...]}" << std::endl;
+
+			if (v != NULL)
+			{
+				metacall_value_destroy(v);
+			}
+
+			std::cout << "(null)" << std::endl;
+
+			result = false;
+
+			continue;
+		}
+
+		/* Extract the name and args fields from the call object */
+		const char *name = NULL;
+
+		void *args = NULL;
+
+		value_map_for_each(v, [&name, &args](const char *key, void *element) {
+			if (std::string(key) == "name" && metacall_value_id(element) == METACALL_STRING)
+			{
+				name = metacall_value_to_string(element);
+			}
+			else if (std::string(key) == "args" && metacall_value_id(element) == METACALL_ARRAY)
+			{
+				args = element;
+			}
+		});
+
+		void *func = NULL;
+
+		if (name != NULL)
+		{
+			std::unordered_map<std::string, void *>::iterator it = functions.find(name);
+
+			if (it != functions.end())
+			{
+				func = it->second;
+			}
+			else
+			{
+				func = metacall_function(name);
+
+				if (func != NULL)
+				{
+					functions.insert({ name, func });
+				}
+			}
+		}
+
+		if (func == NULL || args == NULL)
+		{
+			std::cerr << "Batch line " << line_number << ": could not resolve function" << std::endl;
+
+			std::cout << "(null)" << std::endl;
+
+			result = false;
+		}
+		else
+		{
+			/* The deserialized argument values are passed as the call
+			frame directly, without going through the string API again */
+			void *call_result = metacallfv_s(func, metacall_value_to_array(args), metacall_value_count(args));
+
+			if (call_result != NULL)
+			{
+				size_t size = 0;
+
+				char *value_str = metacall_serialize(metacall_serial(), call_result, &size, allocator);
+
+				std::cout << value_str << std::endl;
+
+				metacall_allocator_free(allocator, value_str);
+
+				metacall_value_destroy(call_result);
+			}
+			else
+			{
+				std::cout << "(null)" << std::endl;
+			}
+		}
+
+		metacall_value_destroy(v);
+	}
+
+	metacall_allocator_destroy(allocator);
+
+	return result;
+}
+
 application::application(int argc, char *argv[]) :
-	exit_condition(false)
+	exit_condition(false), daemon_mode(false)
 {
 	/* Set locale */
 	setlocale(LC_CTYPE, "C");
@@ -567,6 +807,33 @@ application::application(int argc, char *argv[]) :
 	#endif
 	*/
 
+	/* Client mode ships the command to a resident daemon without
+	initializing the core, so shell scripted usage pays an IPC round
+	trip instead of a full runtime boot per invocation */
+	if (argc > 2 && std::string(argv[1]) == "--connect")
+	{
+		std::string command(argv[2]);
+
+		for (int arg = 3; arg < argc; ++arg)
+		{
+			command += " ";
+			command += argv[arg];
+		}
+
+		client(command);
+
+		shutdown();
+
+		return;
+	}
+
+	/* Daemon mode keeps the initialized runtimes resident and serves
+	commands over IPC instead of reading the prompt */
+	if (argc > 1 && std::string(argv[1]) == "--daemon")
+	{
+		daemon_mode = true;
+	}
+
 	/* Initialize MetaCall */
 	if (metacall_initialize() != 0)
 	{
@@ -578,8 +845,33 @@ application::application(int argc, char *argv[]) :
 	metacall_print_info();
 
 	/* Parse program arguments if any (e.g metacall (0) a.py (1) b.js (2) c.rb (3)) */
-	if (argc > 1)
+	if (daemon_mode == false && argc > 1)
 	{
+		/* Warm up the runtimes required by the scripts in the background, so
+		when several runtimes are involved their boot cost overlaps instead
+		of being paid serially by each load; loaders not listed here stay
+		unloaded, runtime activation is driven by the scripts alone */
+		std::vector<std::string> tags;
+
+		for (int arg = 1; arg < argc; ++arg)
+		{
+			const std::string tag = tag_from_extension(argv[arg]);
+
+			if (std::find(tags.begin(), tags.end(), tag) == tags.end())
+			{
+				tags.push_back(tag);
+			}
+		}
+
+		std::vector<const char *> tag_ptrs(tags.size());
+
+		std::transform(tags.begin(), tags.end(), tag_ptrs.begin(), [](const std::string &tag) {
+			return tag.c_str();
+		});
+
+		/* On error fall through, the loads below boot the runtimes inline */
+		metacall_preload(tag_ptrs.data(), tag_ptrs.size());
+
 		parameter_iterator param_it(*this);
 
 		/* Parse program parameters */
@@ -599,6 +891,10 @@ application::application(int argc, char *argv[]) :
 
 	define("load", &command_cb_load);
 
+	define("preload", &command_cb_preload);
+
+	define("batch", &command_cb_batch);
+
 	define("clear", &command_cb_clear);
 
 	define("exit", &command_cb_exit);
@@ -614,6 +910,13 @@ application::~application()
 
 void application::run()
 {
+	if (daemon_mode == true)
+	{
+		run_daemon();
+
+		return;
+	}
+
 	/* Show welcome message  */
 	if (exit_condition != true)
 	{
@@ -654,6 +957,103 @@ void application::run()
 	}
 }
 
+void application::run_daemon()
+{
+	portability_ipc server = portability_ipc_server_create(daemon_endpoint_name);
+
+	if (server == NULL)
+	{
+		std::cout << "Daemon endpoint could not be created" << std::endl;
+
+		return;
+	}
+
+	std::cout << "Daemon ready, dispatch commands with: metacallcli --connect <command>" << std::endl;
+
+	while (exit_condition != true)
+	{
+		portability_ipc connection = portability_ipc_server_accept(server);
+
+		if (connection == NULL)
+		{
+			break;
+		}
+
+		uint32_t size = 0;
+
+		if (portability_ipc_read(connection, &size, sizeof(size)) == 0 && size > 0)
+		{
+			std::string input(size, '\0');
+
+			if (portability_ipc_read(connection, &input[0], size) == 0)
+			{
+				/* Capture the command output and ship it back to the client */
+				std::ostringstream output;
+
+				std::streambuf *previous = std::cout.rdbuf(output.rdbuf());
+
+				tokenizer t(input);
+
+				execute(t);
+
+				std::cout.rdbuf(previous);
+
+				const std::string &result = output.str();
+
+				uint32_t result_size = (uint32_t)result.length();
+
+				if (portability_ipc_write(connection, &result_size, sizeof(result_size)) == 0 && result_size > 0)
+				{
+					portability_ipc_write(connection, result.c_str(), result_size);
+				}
+			}
+		}
+
+		portability_ipc_close(connection);
+	}
+
+	portability_ipc_server_destroy(server);
+}
+
+bool application::client(const std::string &command)
+{
+	portability_ipc connection = portability_ipc_client_connect(daemon_endpoint_name);
+
+	if (connection == NULL)
+	{
+		std::cout << "Could not connect to the daemon, start it with: metacallcli --daemon" << std::endl;
+
+		return false;
+	}
+
+	uint32_t size = (uint32_t)command.length();
+
+	if (portability_ipc_write(connection, &size, sizeof(size)) != 0 || portability_ipc_write(connection, command.c_str(), size) != 0)
+	{
+		std::cout << "Command could not be delivered to the daemon" << std::endl;
+
+		portability_ipc_close(connection);
+
+		return false;
+	}
+
+	uint32_t result_size = 0;
+
+	if (portability_ipc_read(connection, &result_size, sizeof(result_size)) == 0 && result_size > 0)
+	{
+		std::string result(result_size, '\0');
+
+		if (portability_ipc_read(connection, &result[0], result_size) == 0)
+		{
+			std::cout << result;
+		}
+	}
+
+	portability_ipc_close(connection);
+
+	return true;
+}
+
 void application::shutdown()
 {
 	exit_condition = true;
@@ -0,0 +1,80 @@
+/*
+ *	Configuration Library by Parra Studios
+ *	A cross-platform library for managing multiple configuration formats.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef CONFIGURATION_BLOB_H
+#define CONFIGURATION_BLOB_H 1
+
+/* -- Headers -- */
+
+#include <configuration/configuration_api.h>
+
+#include <configuration/configuration_object_handle.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Flatten every registered configuration scope into one relocatable
+*    binary blob at @path; the value encoding follows the binary serial
+*    layout with the string terminators stored, so a later load can
+*    borrow strings and keys straight from the mapped file. Deferred
+*    scopes are resolved before they are written
+*
+*  @param[in] path
+*    Path of the blob file to be written
+*
+*  @return
+*    Returns zero on correct blob compilation, distinct from zero otherwise
+*/
+CONFIGURATION_API int configuration_blob_compile(const char *path);
+
+/**
+*  @brief
+*    Load the whole configuration tree from the blob at @path with a
+*    single read-only mapping, initializing the singleton with the
+*    global scope and registering the remaining scopes; strings become
+*    static values borrowing the mapped bytes and map keys are used in
+*    place, so no string data is duplicated and forked workers share
+*    the pages. Must be called before the singleton is initialized
+*
+*  @param[in] path
+*    Path of the blob file to be loaded
+*
+*  @return
+*    Returns zero on correct blob load, distinct from zero otherwise
+*/
+CONFIGURATION_API int configuration_blob_load(const char *path);
+
+/**
+*  @brief
+*    Release the blob mapping, to be called only after every
+*    configuration borrowing it has been destroyed
+*/
+CONFIGURATION_API void configuration_blob_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIGURATION_BLOB_H */
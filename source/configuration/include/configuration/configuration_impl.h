@@ -72,6 +72,19 @@ CONFIGURATION_API int configuration_impl_initialize(const char *name);
 */
 CONFIGURATION_API int configuration_impl_load(configuration config, void *allocator);
 
+/**
+*  @brief
+*    Resolve a deferred configuration object @config, parsing it on demand
+*
+*  @param[in] config
+*    Pointer to the config object to be resolved
+*
+*  @return
+*    Returns zero if @config is already loaded or was correctly resolved, distinct from zero otherwise
+*
+*/
+CONFIGURATION_API int configuration_impl_resolve(configuration config);
+
 /**
 *  @brief
 *    Destroy configuration object implementation
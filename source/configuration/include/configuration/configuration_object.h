@@ -141,6 +141,19 @@ CONFIGURATION_API configuration configuration_object_parent(configuration config
 */
 CONFIGURATION_API const char *configuration_object_source(configuration config);
 
+/**
+*  @brief
+*    Retrieve the size of the source of configuration object @config
+*
+*  @param[in] config
+*    Pointer to configuration object
+*
+*  @return
+*    Returns size of the source of configuration object @config, including the null terminator
+*
+*/
+CONFIGURATION_API size_t configuration_object_source_size(configuration config);
+
 /**
 *  @brief
 *    Retrieve the value of configuration object @config
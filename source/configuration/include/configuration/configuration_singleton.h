@@ -78,6 +78,19 @@ CONFIGURATION_API int configuration_singleton_register(configuration config);
 */
 CONFIGURATION_API configuration configuration_singleton_get(const char *name);
 
+/**
+*  @brief
+*    Iterate over every configuration object registered in the scope map
+*
+*  @param[in] iterate_cb
+*    Callback invoked with each (name, configuration) pair
+*
+*  @param[in] args
+*    Reference to additional data passed to the callback
+*
+*/
+CONFIGURATION_API void configuration_singleton_iterate(set_cb_iterate iterate_cb, set_cb_iterate_args args);
+
 /**
 *  @brief
 *    Remove configuration object from scope map
@@ -11,6 +11,7 @@
 #include <metacall/metacall_version.h>
 
 #include <configuration/configuration.h>
+#include <configuration/configuration_blob.h>
 #include <configuration/configuration_impl.h>
 #include <configuration/configuration_singleton.h>
 
@@ -24,6 +25,7 @@
 /* -- Definitions -- */
 
 #define CONFIGURATION_PATH		   "CONFIGURATION_PATH"
+#define CONFIGURATION_BLOB_PATH	   "CONFIGURATION_BLOB_PATH"
 #define CONFIGURATION_DEFAULT_PATH "configurations" ENVIRONMENT_VARIABLE_PATH_SEPARATOR_STR CONFIGURATION_GLOBAL_SCOPE ".json"
 
 /* -- Methods -- */
@@ -39,6 +41,30 @@ int configuration_initialize(const char *reader, const char *path, void *allocat
 		return 1;
 	}
 
+	/* A precompiled blob replaces the whole JSON tree with a single
+	mapped file, falling back to the per file parse when it is absent
+	or invalid */
+	if (path == NULL)
+	{
+		const char *blob_path = environment_variable_get(CONFIGURATION_BLOB_PATH, NULL);
+
+		if (blob_path != NULL && configuration_blob_load(blob_path) == 0)
+		{
+			if (configuration_impl_initialize(reader) != 0)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation initialization");
+
+				configuration_destroy();
+
+				return 1;
+			}
+
+			log_write("metacall", LOG_LEVEL_DEBUG, "Global configuration loaded from blob %s", blob_path);
+
+			return 0;
+		}
+	}
+
 	if (path == NULL)
 	{
 		static const char configuration_path[] = CONFIGURATION_PATH;
@@ -165,6 +191,14 @@ value configuration_value(configuration config, const char *key)
 		return NULL;
 	}
 
+	/* Deferred configurations are parsed on first access */
+	if (configuration_impl_resolve(config) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration resolution (%s)", configuration_object_name(config));
+
+		return NULL;
+	}
+
 	return configuration_object_get(config, key);
 }
 
@@ -194,6 +228,9 @@ void configuration_destroy()
 	configuration_impl_destroy();
 
 	serial_destroy();
+
+	/* After every configuration borrowing the mapping has been destroyed */
+	configuration_blob_destroy();
 }
 
 const char *configuration_print_info()
@@ -0,0 +1,886 @@
+/*
+*	Configuration Library by Parra Studios
+*	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+*
+*	A cross-platform library for managing multiple configuration formats.
+*
+*/
+
+/* -- Headers -- */
+
+#include <configuration/configuration.h>
+#include <configuration/configuration_blob.h>
+#include <configuration/configuration_impl.h>
+#include <configuration/configuration_object.h>
+#include <configuration/configuration_singleton.h>
+
+#include <adt/adt_vector.h>
+
+#include <reflect/reflect_value_type.h>
+#include <reflect/reflect_value_type_id_size.h>
+
+#include <format/format_specifier.h>
+
+#include <log/log.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(unix) || defined(__unix__) || defined(__unix) ||                            \
+	defined(linux) || defined(__linux__) || defined(__linux) || defined(__gnu_linux) || \
+	defined(__CYGWIN__) || defined(__CYGWIN32__) ||                                     \
+	(defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+	#define CONFIGURATION_BLOB_MMAP 1
+
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+/* -- Definitions -- */
+
+/*
+	Blob layout (all integers little endian, read through memcpy):
+
+	header := uint32 magic, uint32 version, uint64 size, uint64 count
+	scope  := uint64 name length, name bytes, NUL, value
+	value  := binary serial encoding, except strings store their
+	          terminator after the characters so the mapped bytes are
+	          borrowable in place as C strings
+
+	The encoding carries no pointers, only sizes and counts that the
+	decoder walks sequentially, so the blob needs no fixups and maps
+	anywhere
+*/
+
+#define CONFIGURATION_BLOB_MAGIC   ((uint32_t)0x4243434D) /* 'MCCB' */
+#define CONFIGURATION_BLOB_VERSION ((uint32_t)0x00000001)
+
+#define CONFIGURATION_BLOB_HEADER_SIZE (sizeof(uint32_t) * 2 + sizeof(uint64_t) * 2)
+
+/* -- Private Variables -- */
+
+static char *configuration_blob_data = NULL;
+
+static size_t configuration_blob_size = 0;
+
+static int configuration_blob_map = 0;
+
+/* -- Private Methods -- */
+
+static int configuration_blob_size_value(value v, size_t *size);
+
+static void configuration_blob_write_value(value v, char **cursor);
+
+static value configuration_blob_read_value(const char **cursor, size_t *remaining);
+
+static int configuration_blob_compile_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args);
+
+static char *configuration_blob_read_file(const char *path, size_t *size, int *map);
+
+/* -- Methods -- */
+
+int configuration_blob_size_value(value v, size_t *size)
+{
+	type_id id = value_type_id(v);
+
+	*size += sizeof(uint8_t);
+
+	switch (id)
+	{
+		case TYPE_BOOL:
+		case TYPE_CHAR:
+		case TYPE_SHORT:
+		case TYPE_INT:
+		case TYPE_LONG:
+		case TYPE_FLOAT:
+		case TYPE_DOUBLE:
+		case TYPE_PTR: {
+			*size += value_type_id_size(id);
+
+			break;
+		}
+
+		case TYPE_STRING: {
+			/* The terminator travels with the characters so the
+			loader can borrow them in place */
+			*size += sizeof(uint64_t) + value_type_size(v);
+
+			break;
+		}
+
+		case TYPE_BUFFER: {
+			*size += sizeof(uint64_t) + value_type_size(v);
+
+			break;
+		}
+
+		case TYPE_ARRAY:
+		case TYPE_MAP: {
+			value *values = (id == TYPE_ARRAY) ? value_to_array(v) : value_to_map(v);
+
+			size_t iterator, count = value_type_count(v);
+
+			*size += sizeof(uint64_t);
+
+			for (iterator = 0; iterator < count; ++iterator)
+			{
+				if (configuration_blob_size_value(values[iterator], size) != 0)
+				{
+					return 1;
+				}
+			}
+
+			break;
+		}
+
+		case TYPE_TYPED_ARRAY: {
+			*size += sizeof(uint8_t) + sizeof(uint64_t) + value_typed_array_count(v) * value_type_id_size(value_typed_array_type_id(v));
+
+			break;
+		}
+
+		case TYPE_NULL: {
+			break;
+		}
+
+		default: {
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration blob value type (%d), only data values can be compiled", (int)id);
+
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+void configuration_blob_write_value(value v, char **cursor)
+{
+	type_id id = value_type_id(v);
+
+	uint8_t tag = (uint8_t)id;
+
+	uint64_t length;
+
+	size_t iterator, count;
+
+	memcpy(*cursor, &tag, sizeof(uint8_t));
+
+	*cursor += sizeof(uint8_t);
+
+	switch (id)
+	{
+		case TYPE_BOOL:
+		case TYPE_CHAR:
+		case TYPE_SHORT:
+		case TYPE_INT:
+		case TYPE_LONG:
+		case TYPE_FLOAT:
+		case TYPE_DOUBLE:
+		case TYPE_PTR: {
+			size_t bytes = value_type_id_size(id);
+
+			/* Copy through value_to so inline values encoded into the
+			handle serialize like the heap allocated ones */
+			value_to(v, *cursor, bytes);
+
+			*cursor += bytes;
+
+			break;
+		}
+
+		case TYPE_STRING: {
+			length = (uint64_t)(value_type_size(v) - 1);
+
+			memcpy(*cursor, &length, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+
+			memcpy(*cursor, value_to_string(v), (size_t)length);
+
+			*cursor += (size_t)length;
+
+			**cursor = '\0';
+
+			*cursor += 1;
+
+			break;
+		}
+
+		case TYPE_BUFFER: {
+			length = (uint64_t)value_type_size(v);
+
+			memcpy(*cursor, &length, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+
+			memcpy(*cursor, value_to_buffer(v), (size_t)length);
+
+			*cursor += (size_t)length;
+
+			break;
+		}
+
+		case TYPE_ARRAY:
+		case TYPE_MAP: {
+			value *values = (id == TYPE_ARRAY) ? value_to_array(v) : value_to_map(v);
+
+			count = value_type_count(v);
+
+			length = (uint64_t)count;
+
+			memcpy(*cursor, &length, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+
+			for (iterator = 0; iterator < count; ++iterator)
+			{
+				configuration_blob_write_value(values[iterator], cursor);
+			}
+
+			break;
+		}
+
+		case TYPE_TYPED_ARRAY: {
+			uint8_t element_tag = (uint8_t)value_typed_array_type_id(v);
+
+			size_t block_size;
+
+			count = value_typed_array_count(v);
+
+			block_size = count * value_type_id_size((type_id)element_tag);
+
+			memcpy(*cursor, &element_tag, sizeof(uint8_t));
+
+			*cursor += sizeof(uint8_t);
+
+			length = (uint64_t)count;
+
+			memcpy(*cursor, &length, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+
+			memcpy(*cursor, value_to_typed_array(v), block_size);
+
+			*cursor += block_size;
+
+			break;
+		}
+
+		case TYPE_NULL:
+		default: {
+			break;
+		}
+	}
+}
+
+value configuration_blob_read_value(const char **cursor, size_t *remaining)
+{
+	uint8_t tag;
+
+	uint64_t length;
+
+	type_id id;
+
+	if (*remaining < sizeof(uint8_t))
+	{
+		return NULL;
+	}
+
+	memcpy(&tag, *cursor, sizeof(uint8_t));
+
+	*cursor += sizeof(uint8_t);
+	*remaining -= sizeof(uint8_t);
+
+	id = (type_id)tag;
+
+	switch (id)
+	{
+		case TYPE_BOOL:
+		case TYPE_CHAR:
+		case TYPE_SHORT:
+		case TYPE_INT:
+		case TYPE_LONG:
+		case TYPE_FLOAT:
+		case TYPE_DOUBLE:
+		case TYPE_PTR: {
+			size_t bytes = value_type_id_size(id);
+
+			value v;
+
+			if (*remaining < bytes)
+			{
+				return NULL;
+			}
+
+			v = value_type_create(*cursor, bytes, id);
+
+			*cursor += bytes;
+			*remaining -= bytes;
+
+			return v;
+		}
+
+		case TYPE_STRING: {
+			value v;
+
+			if (*remaining < sizeof(uint64_t))
+			{
+				return NULL;
+			}
+
+			memcpy(&length, *cursor, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+			*remaining -= sizeof(uint64_t);
+
+			if (*remaining < (size_t)length + 1 || (*cursor)[length] != '\0')
+			{
+				return NULL;
+			}
+
+			/* The mapping lives for the rest of the process, the
+			value borrows the characters without copy */
+			v = value_create_string_static(*cursor, (size_t)length);
+
+			*cursor += (size_t)length + 1;
+			*remaining -= (size_t)length + 1;
+
+			return v;
+		}
+
+		case TYPE_BUFFER: {
+			value v;
+
+			if (*remaining < sizeof(uint64_t))
+			{
+				return NULL;
+			}
+
+			memcpy(&length, *cursor, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+			*remaining -= sizeof(uint64_t);
+
+			if (*remaining < (size_t)length)
+			{
+				return NULL;
+			}
+
+			v = value_create_buffer_view((void *)*cursor, (size_t)length);
+
+			*cursor += (size_t)length;
+			*remaining -= (size_t)length;
+
+			return v;
+		}
+
+		case TYPE_ARRAY:
+		case TYPE_MAP: {
+			value v, *values;
+
+			size_t iterator, count;
+
+			if (*remaining < sizeof(uint64_t))
+			{
+				return NULL;
+			}
+
+			memcpy(&length, *cursor, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+			*remaining -= sizeof(uint64_t);
+
+			count = (size_t)length;
+
+			/* Each element costs at least its tag byte */
+			if (*remaining < count)
+			{
+				return NULL;
+			}
+
+			v = (id == TYPE_ARRAY) ? value_create_array(NULL, count) : value_create_map(NULL, count);
+
+			if (v == NULL)
+			{
+				return NULL;
+			}
+
+			values = (id == TYPE_ARRAY) ? value_to_array(v) : value_to_map(v);
+
+			for (iterator = 0; iterator < count; ++iterator)
+			{
+				values[iterator] = configuration_blob_read_value(cursor, remaining);
+
+				if (values[iterator] == NULL)
+				{
+					size_t inner;
+
+					for (inner = 0; inner < iterator; ++inner)
+					{
+						value_type_destroy(values[inner]);
+					}
+
+					value_destroy(v);
+
+					return NULL;
+				}
+			}
+
+			return v;
+		}
+
+		case TYPE_TYPED_ARRAY: {
+			uint8_t element_tag;
+
+			size_t count, block_size;
+
+			value v;
+
+			if (*remaining < sizeof(uint8_t) + sizeof(uint64_t))
+			{
+				return NULL;
+			}
+
+			memcpy(&element_tag, *cursor, sizeof(uint8_t));
+
+			*cursor += sizeof(uint8_t);
+			*remaining -= sizeof(uint8_t);
+
+			memcpy(&length, *cursor, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+			*remaining -= sizeof(uint64_t);
+
+			count = (size_t)length;
+
+			block_size = count * value_type_id_size((type_id)element_tag);
+
+			if (*remaining < block_size)
+			{
+				return NULL;
+			}
+
+			v = value_create_typed_array(*cursor, count, (type_id)element_tag);
+
+			*cursor += block_size;
+			*remaining -= block_size;
+
+			return v;
+		}
+
+		case TYPE_NULL: {
+			return value_create_null();
+		}
+
+		default: {
+			return NULL;
+		}
+	}
+}
+
+int configuration_blob_compile_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args)
+{
+	vector scopes = args;
+
+	(void)s;
+	(void)key;
+
+	if (val != NULL)
+	{
+		configuration config = val;
+
+		/* The global scope is written first by the caller */
+		if (config != configuration_singleton_get(CONFIGURATION_GLOBAL_SCOPE))
+		{
+			vector_push_back(scopes, &config);
+		}
+	}
+
+	return 0;
+}
+
+int configuration_blob_compile(const char *path)
+{
+	configuration global = configuration_singleton_get(CONFIGURATION_GLOBAL_SCOPE);
+
+	vector scopes;
+
+	size_t iterator, size = CONFIGURATION_BLOB_HEADER_SIZE;
+
+	uint64_t count;
+
+	char *buffer, *cursor;
+
+	FILE *file;
+
+	if (path == NULL || global == NULL)
+	{
+		return 1;
+	}
+
+	scopes = vector_create(sizeof(configuration));
+
+	if (scopes == NULL)
+	{
+		return 1;
+	}
+
+	vector_push_back(scopes, &global);
+
+	configuration_singleton_iterate(&configuration_blob_compile_cb_iterate, scopes);
+
+	/* Deferred scopes parse now so the blob carries the whole tree */
+	for (iterator = 0; iterator < vector_size(scopes); ++iterator)
+	{
+		configuration config = *((configuration *)vector_at(scopes, iterator));
+
+		value v;
+
+		if (configuration_impl_resolve(config) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration blob resolution (%s)", configuration_object_name(config));
+
+			vector_destroy(scopes);
+
+			return 1;
+		}
+
+		v = configuration_object_value(config);
+
+		size += sizeof(uint64_t) + strlen(configuration_object_name(config)) + 1;
+
+		if (configuration_blob_size_value(v, &size) != 0)
+		{
+			vector_destroy(scopes);
+
+			return 1;
+		}
+	}
+
+	buffer = malloc(size);
+
+	if (buffer == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration blob buffer allocation");
+
+		vector_destroy(scopes);
+
+		return 1;
+	}
+
+	cursor = buffer;
+
+	{
+		uint32_t magic = CONFIGURATION_BLOB_MAGIC, version = CONFIGURATION_BLOB_VERSION;
+
+		uint64_t total = (uint64_t)size;
+
+		count = (uint64_t)vector_size(scopes);
+
+		memcpy(cursor, &magic, sizeof(uint32_t));
+		cursor += sizeof(uint32_t);
+
+		memcpy(cursor, &version, sizeof(uint32_t));
+		cursor += sizeof(uint32_t);
+
+		memcpy(cursor, &total, sizeof(uint64_t));
+		cursor += sizeof(uint64_t);
+
+		memcpy(cursor, &count, sizeof(uint64_t));
+		cursor += sizeof(uint64_t);
+	}
+
+	for (iterator = 0; iterator < vector_size(scopes); ++iterator)
+	{
+		configuration config = *((configuration *)vector_at(scopes, iterator));
+
+		const char *name = configuration_object_name(config);
+
+		uint64_t name_length = (uint64_t)strlen(name);
+
+		memcpy(cursor, &name_length, sizeof(uint64_t));
+		cursor += sizeof(uint64_t);
+
+		memcpy(cursor, name, (size_t)name_length + 1);
+		cursor += (size_t)name_length + 1;
+
+		configuration_blob_write_value(configuration_object_value(config), &cursor);
+	}
+
+	vector_destroy(scopes);
+
+	file = fopen(path, "wb");
+
+	if (file == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration blob file path (%s)", path);
+
+		free(buffer);
+
+		return 1;
+	}
+
+	if (fwrite(buffer, 1, size, file) != size)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration blob file write (%s)", path);
+
+		fclose(file);
+
+		free(buffer);
+
+		return 1;
+	}
+
+	fclose(file);
+
+	free(buffer);
+
+	log_write("metacall", LOG_LEVEL_DEBUG, "Configuration blob compiled into %s (%" PRIuS " scopes, %" PRIuS " bytes)", path, (size_t)count, size);
+
+	return 0;
+}
+
+char *configuration_blob_read_file(const char *path, size_t *size, int *map)
+{
+	FILE *file;
+
+	size_t file_size, size_read;
+
+	char *buffer;
+
+#if defined(CONFIGURATION_BLOB_MMAP)
+	{
+		int fd = open(path, O_RDONLY);
+
+		if (fd != -1)
+		{
+			struct stat st;
+
+			if (fstat(fd, &st) == 0 && st.st_size > 0)
+			{
+				void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+				if (data != MAP_FAILED)
+				{
+					close(fd);
+
+					*size = (size_t)st.st_size;
+
+					*map = 1;
+
+					return data;
+				}
+			}
+
+			close(fd);
+		}
+	}
+#endif
+
+	file = fopen(path, "rb");
+
+	if (file == NULL)
+	{
+		return NULL;
+	}
+
+	fseek(file, 0, SEEK_END);
+
+	file_size = ftell(file);
+
+	fseek(file, 0, SEEK_SET);
+
+	buffer = malloc(file_size);
+
+	if (buffer == NULL)
+	{
+		fclose(file);
+
+		return NULL;
+	}
+
+	size_read = fread(buffer, 1, file_size, file);
+
+	fclose(file);
+
+	if (size_read != file_size)
+	{
+		free(buffer);
+
+		return NULL;
+	}
+
+	*size = file_size;
+
+	*map = 0;
+
+	return buffer;
+}
+
+int configuration_blob_load(const char *path)
+{
+	const char *cursor;
+
+	size_t remaining;
+
+	uint32_t magic, version;
+
+	uint64_t total, count, index;
+
+	int singleton_initialized = 0;
+
+	if (path == NULL || configuration_blob_data != NULL)
+	{
+		return 1;
+	}
+
+	configuration_blob_data = configuration_blob_read_file(path, &configuration_blob_size, &configuration_blob_map);
+
+	if (configuration_blob_data == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration blob file path (%s)", path);
+
+		return 1;
+	}
+
+	cursor = configuration_blob_data;
+	remaining = configuration_blob_size;
+
+	if (remaining < CONFIGURATION_BLOB_HEADER_SIZE)
+	{
+		goto error_blob;
+	}
+
+	memcpy(&magic, cursor, sizeof(uint32_t));
+	cursor += sizeof(uint32_t);
+
+	memcpy(&version, cursor, sizeof(uint32_t));
+	cursor += sizeof(uint32_t);
+
+	memcpy(&total, cursor, sizeof(uint64_t));
+	cursor += sizeof(uint64_t);
+
+	memcpy(&count, cursor, sizeof(uint64_t));
+	cursor += sizeof(uint64_t);
+
+	remaining -= CONFIGURATION_BLOB_HEADER_SIZE;
+
+	if (magic != CONFIGURATION_BLOB_MAGIC || version != CONFIGURATION_BLOB_VERSION || (size_t)total != configuration_blob_size || count == 0)
+	{
+		goto error_blob;
+	}
+
+	for (index = 0; index < count; ++index)
+	{
+		uint64_t name_length;
+
+		const char *name;
+
+		value v;
+
+		configuration config;
+
+		if (remaining < sizeof(uint64_t))
+		{
+			goto error_scopes;
+		}
+
+		memcpy(&name_length, cursor, sizeof(uint64_t));
+		cursor += sizeof(uint64_t);
+		remaining -= sizeof(uint64_t);
+
+		if (remaining < (size_t)name_length + 1 || cursor[name_length] != '\0')
+		{
+			goto error_scopes;
+		}
+
+		name = cursor;
+		cursor += (size_t)name_length + 1;
+		remaining -= (size_t)name_length + 1;
+
+		/* The global scope leads the blob by construction */
+		if (index == 0 && strcmp(name, CONFIGURATION_GLOBAL_SCOPE) != 0)
+		{
+			goto error_scopes;
+		}
+
+		v = configuration_blob_read_value(&cursor, &remaining);
+
+		if (v == NULL)
+		{
+			goto error_scopes;
+		}
+
+		config = configuration_object_initialize(name, NULL, NULL);
+
+		if (config == NULL)
+		{
+			value_type_destroy(v);
+
+			goto error_scopes;
+		}
+
+		configuration_object_instantiate(config, v);
+
+		if (index == 0)
+		{
+			if (configuration_singleton_initialize(config) != 0)
+			{
+				configuration_object_destroy(config);
+
+				goto error_scopes;
+			}
+
+			singleton_initialized = 1;
+		}
+		else if (configuration_singleton_register(config) != 0)
+		{
+			configuration_object_destroy(config);
+
+			goto error_scopes;
+		}
+	}
+
+	log_write("metacall", LOG_LEVEL_DEBUG, "Configuration blob loaded from %s (%" PRIuS " scopes, %" PRIuS " bytes)", path, (size_t)count, configuration_blob_size);
+
+	return 0;
+
+error_scopes:
+	if (singleton_initialized != 0)
+	{
+		configuration_singleton_destroy();
+	}
+error_blob:
+	log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration blob contents (%s)", path);
+
+	configuration_blob_destroy();
+
+	return 1;
+}
+
+void configuration_blob_destroy(void)
+{
+	if (configuration_blob_data != NULL)
+	{
+#if defined(CONFIGURATION_BLOB_MMAP)
+		if (configuration_blob_map != 0)
+		{
+			munmap(configuration_blob_data, configuration_blob_size);
+		}
+		else
+#endif
+		{
+			free(configuration_blob_data);
+		}
+
+		configuration_blob_data = NULL;
+
+		configuration_blob_size = 0;
+
+		configuration_blob_map = 0;
+	}
+}
@@ -33,6 +33,7 @@ typedef struct configuration_impl_singleton_type *configuration_impl_singleton;
 struct configuration_impl_singleton_type
 {
 	serial s;
+	void *allocator;
 };
 
 /* -- Private Methods -- */
@@ -45,6 +46,7 @@ configuration_impl_singleton configuration_impl_singleton_instance()
 {
 	static struct configuration_impl_singleton_type instance = {
 		NULL,
+		NULL,
 	};
 
 	return &instance;
@@ -70,131 +72,108 @@ int configuration_impl_load(configuration config, void *allocator)
 {
 	configuration_impl_singleton singleton = configuration_impl_singleton_instance();
 
+	const char *source = configuration_object_source(config);
+
 	set storage;
 
-	vector queue, childs;
+	vector childs;
 
-	storage = set_create(&hash_callback_str, &comparable_callback_str);
+	value v;
 
-	if (storage == NULL)
+	/* Keep the allocator so deferred childs can be deserialized on first access */
+	singleton->allocator = allocator;
+
+	if (source == NULL)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation load set allocation");
+		v = value_create_map(NULL, 0);
+	}
+	else
+	{
+		v = serial_deserialize(singleton->s, source, configuration_object_source_size(config), (memory_allocator)allocator);
 
-		return 1;
+		if (v == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation load <%p>", config);
+
+			return 1;
+		}
 	}
 
-	queue = vector_create(sizeof(configuration));
+	configuration_object_instantiate(config, v);
 
-	if (queue == NULL)
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation load queue allocation");
+	storage = set_create(&hash_callback_str, &comparable_callback_str);
 
-		set_destroy(storage);
+	if (storage == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation load set allocation");
 
 		return 1;
 	}
 
 	childs = vector_create(sizeof(configuration));
 
-	if (queue == NULL)
+	if (childs == NULL)
 	{
 		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation load childs allocation");
 
 		set_destroy(storage);
 
-		vector_destroy(queue);
-
 		return 1;
 	}
 
-	vector_push_back(queue, &config);
-
-	while (vector_size(queue) > 0)
+	/* Childs are registered so they can be found by scope, but they stay
+	unparsed until the first value access resolves them */
+	if (configuration_object_childs(config, childs, storage) == 0 && vector_size(childs) > 0)
 	{
-		configuration current = *((configuration *)vector_front(queue));
-
-		const char *source = configuration_object_source(current);
+		size_t iterator;
 
-		value v;
+		for (iterator = 0; iterator < vector_size(childs); ++iterator)
+		{
+			configuration child = *((configuration *)vector_at(childs, iterator));
 
-		vector_pop_front(queue);
+			if (configuration_singleton_get(configuration_object_name(child)) != NULL)
+			{
+				configuration_object_destroy(child);
 
-		if (source == NULL)
-		{
-			v = value_create_map(NULL, 0);
-		}
-		else
-		{
-			v = serial_deserialize(singleton->s, source, strlen(source) + 1, (memory_allocator)allocator);
+				continue;
+			}
 
-			if (v == NULL)
+			if (configuration_singleton_register(child) != 0)
 			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation load (childs) <%p>", current);
+				log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation child singleton insertion (%s, %s)",
+					configuration_object_name(child), configuration_object_path(child));
 
 				set_destroy(storage);
 
-				vector_destroy(queue);
-
 				vector_destroy(childs);
 
 				return 1;
 			}
 		}
+	}
 
-		configuration_object_instantiate(current, v);
-
-		vector_clear(childs);
-
-		if (configuration_object_childs(current, childs, storage) == 0 && vector_size(childs) > 0)
-		{
-			size_t iterator;
-
-			for (iterator = 0; iterator < vector_size(childs); ++iterator)
-			{
-				configuration child = *((configuration *)vector_at(childs, iterator));
-
-				if (set_get(storage, (set_key)configuration_object_name(child)) == NULL)
-				{
-					if (configuration_singleton_register(child) != 0)
-					{
-						log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation child singleton insertion (%s, %s)",
-							configuration_object_name(child), configuration_object_path(child));
-
-						set_destroy(storage);
-
-						vector_destroy(queue);
-
-						vector_destroy(childs);
-
-						return 1;
-					}
-
-					vector_push_back(queue, &child);
-				}
-
-				if (set_insert(storage, (set_key)configuration_object_name(child), child) != 0)
-				{
-					log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation child set insertion");
+	set_destroy(storage);
 
-					set_destroy(storage);
+	vector_destroy(childs);
 
-					vector_destroy(queue);
+	return 0;
+}
 
-					vector_destroy(childs);
+int configuration_impl_resolve(configuration config)
+{
+	configuration_impl_singleton singleton = configuration_impl_singleton_instance();
 
-					return 1;
-				}
-			}
-		}
+	if (config == NULL)
+	{
+		return 1;
 	}
 
-	set_destroy(storage);
-
-	vector_destroy(queue);
-
-	vector_destroy(childs);
+	if (configuration_object_value(config) != NULL)
+	{
+		return 0;
+	}
 
-	return 0;
+	return configuration_impl_load(config, singleton->allocator);
 }
 
 int configuration_impl_destroy()
@@ -11,10 +11,24 @@
 #include <configuration/configuration_impl.h>
 #include <configuration/configuration_object.h>
 
+#include <adt/adt_string_pool.h>
+
 #include <log/log.h>
 
 #include <string.h>
 
+#if defined(unix) || defined(__unix__) || defined(__unix) ||                            \
+	defined(linux) || defined(__linux__) || defined(__linux) || defined(__gnu_linux) || \
+	defined(__CYGWIN__) || defined(__CYGWIN32__) ||                                     \
+	(defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+	#define CONFIGURATION_OBJECT_MMAP 1
+
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
 /* -- Forward Declarations -- */
 
 struct configuration_childs_cb_iterator_type;
@@ -40,6 +54,8 @@ struct configuration_type
 	set map;
 	configuration parent;
 	char *source;
+	size_t source_size; /**< Size of source including the null terminator */
+	int source_map;		/**< Non-zero when source is a read-only file mapping */
 	value v;
 };
 
@@ -47,7 +63,7 @@ struct configuration_type
 
 static int configuration_object_initialize_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args);
 
-static char *configuration_object_read(const char *path);
+static char *configuration_object_read(const char *path, size_t *size, int *map);
 
 static int configuration_object_childs_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args);
 
@@ -67,14 +83,50 @@ int configuration_object_initialize_cb_iterate(set s, set_key key, set_value val
 	return 0;
 }
 
-char *configuration_object_read(const char *path)
+char *configuration_object_read(const char *path, size_t *size, int *map)
 {
-	FILE *file = fopen(path, "rb");
+	FILE *file;
 
-	size_t size, size_read;
+	size_t file_size, size_read;
 
 	char *buffer;
 
+#if defined(CONFIGURATION_OBJECT_MMAP)
+	{
+		int fd = open(path, O_RDONLY);
+
+		if (fd != -1)
+		{
+			struct stat st;
+
+			long page_size = sysconf(_SC_PAGESIZE);
+
+			/* Map the file only when its size is not a multiple of the page size,
+			so the zero filled tail of the last page acts as the null terminator
+			the deserializer expects, otherwise fall through to the buffered read */
+			if (fstat(fd, &st) == 0 && st.st_size > 0 && page_size > 0 && (st.st_size % page_size) != 0)
+			{
+				void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+				if (data != MAP_FAILED)
+				{
+					close(fd);
+
+					*size = (size_t)st.st_size + 1;
+
+					*map = 1;
+
+					return data;
+				}
+			}
+
+			close(fd);
+		}
+	}
+#endif
+
+	file = fopen(path, "rb");
+
 	if (file == NULL)
 	{
 		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration file path (%s)", path);
@@ -84,11 +136,11 @@ char *configuration_object_read(const char *path)
 
 	fseek(file, 0, SEEK_END);
 
-	size = ftell(file);
+	file_size = ftell(file);
 
 	fseek(file, 0, SEEK_SET);
 
-	buffer = malloc(sizeof(char) * (size + 1));
+	buffer = malloc(sizeof(char) * (file_size + 1));
 
 	if (buffer == NULL)
 	{
@@ -99,13 +151,13 @@ char *configuration_object_read(const char *path)
 		return NULL;
 	}
 
-	size_read = fread(buffer, sizeof(char), size, file);
+	size_read = fread(buffer, sizeof(char), file_size, file);
 
 	fclose(file);
 
-	if (size_read != size)
+	if (size_read != file_size)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration file size read (%u != %u)", size_read, size);
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration file size read (%u != %u)", size_read, file_size);
 
 		free(buffer);
 
@@ -114,6 +166,10 @@ char *configuration_object_read(const char *path)
 
 	buffer[size_read] = '\0';
 
+	*size = size_read + 1;
+
+	*map = 0;
+
 	return buffer;
 }
 
@@ -130,9 +186,13 @@ configuration configuration_object_initialize(const char *name, const char *path
 		return NULL;
 	}
 
+	config->source_size = 0;
+
+	config->source_map = 0;
+
 	if (path != NULL)
 	{
-		config->source = configuration_object_read(path);
+		config->source = configuration_object_read(path, &config->source_size, &config->source_map);
 
 		if (config->source == NULL)
 		{
@@ -305,6 +365,19 @@ void configuration_object_instantiate(configuration config, value v)
 
 		const char *key = value_to_string(tupla[0]);
 
+		/* Blob keys already live in immortal mapped memory and act as
+		their own interned copy, any other key repeats across
+		configurations so interning shares a single copy */
+		if (value_immortal(tupla[0]) == 0)
+		{
+			const char *key_interned = string_intern(key);
+
+			if (key_interned != NULL)
+			{
+				key = key_interned;
+			}
+		}
+
 		configuration_object_set(config, key, tupla[1]);
 	}
 
@@ -331,6 +404,11 @@ const char *configuration_object_source(configuration config)
 	return config->source;
 }
 
+size_t configuration_object_source_size(configuration config)
+{
+	return config->source_size;
+}
+
 value configuration_object_value(configuration config)
 {
 	return config->v;
@@ -365,7 +443,16 @@ void configuration_object_destroy(configuration config)
 
 	if (config->source != NULL)
 	{
-		free(config->source);
+#if defined(CONFIGURATION_OBJECT_MMAP)
+		if (config->source_map != 0)
+		{
+			munmap(config->source, config->source_size - 1);
+		}
+		else
+#endif
+		{
+			free(config->source);
+		}
 	}
 
 	set_destroy(config->map);
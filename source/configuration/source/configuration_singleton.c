@@ -100,6 +100,16 @@ configuration configuration_singleton_get(const char *name)
 	return set_get(singleton->scopes, (const set_key)name);
 }
 
+void configuration_singleton_iterate(set_cb_iterate iterate_cb, set_cb_iterate_args args)
+{
+	configuration_singleton singleton = configuration_singleton_instance();
+
+	if (singleton->scopes != NULL)
+	{
+		set_iterate(singleton->scopes, iterate_cb, args);
+	}
+}
+
 int configuration_singleton_clear(configuration config)
 {
 	configuration_singleton singleton = configuration_singleton_instance();
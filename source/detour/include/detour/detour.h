@@ -99,6 +99,80 @@ DETOUR_API void (*detour_trampoline(detour_handle handle))(void);
 */
 DETOUR_API detour_handle detour_install(detour d, void (*target)(void), void (*hook)(void));
 
+/**
+*  @brief
+*    Begin a hook transaction; hooks queued on the returned handle
+*    through @detour_transaction_queue apply in one batch when
+*    @detour_transaction_commit runs, paying a single page protection
+*    and instruction cache flush cycle instead of one per hook
+*
+*  @param[in] d
+*    Reference to the detour
+*
+*  @return
+*    Pointer to the transaction handle, null otherwise
+*
+*/
+DETOUR_API detour_handle detour_transaction_begin(detour d);
+
+/**
+*  @brief
+*    Queue a hook from @target to @hook on the transaction, the
+*    pointed target is rewritten to the trampoline of the hook
+*
+*  @param[in] d
+*    Reference to the detour
+*
+*  @param[in] handle
+*    Reference to the transaction handle
+*
+*  @param[in,out] target
+*    Reference to the function to be hooked, rewritten to the trampoline
+*
+*  @param[in] hook
+*    Reference to the function will be called instead of @target
+*
+*  @return
+*    Return zero if success, different from zero otherwise
+*
+*/
+DETOUR_API int detour_transaction_queue(detour d, detour_handle handle, void (**target)(void), void (*hook)(void));
+
+/**
+*  @brief
+*    Apply all queued hooks of the transaction in one batch; on
+*    failure the handle is destroyed and must not be reused, the
+*    committed handle uninstalls as a whole through @detour_uninstall
+*
+*  @param[in] d
+*    Reference to the detour
+*
+*  @param[in] handle
+*    Reference to the transaction handle
+*
+*  @return
+*    Return zero if success, different from zero otherwise
+*
+*/
+DETOUR_API int detour_transaction_commit(detour d, detour_handle handle);
+
+/**
+*  @brief
+*    Discard an uncommitted transaction, the queued hooks are dropped
+*    without ever being applied and the handle is destroyed
+*
+*  @param[in] d
+*    Reference to the detour
+*
+*  @param[in] handle
+*    Reference to the transaction handle
+*
+*  @return
+*    Return zero if success, different from zero otherwise
+*
+*/
+DETOUR_API int detour_transaction_rollback(detour d, detour_handle handle);
+
 /**
 *  @brief
 *    Install detour from @target to @hook
@@ -89,6 +89,75 @@ DETOUR_API int detour_impl_load(detour_impl impl, const char *path, const char *
 */
 DETOUR_API detour_impl_handle detour_impl_install(detour_impl impl, void (**target)(void), void (*hook)(void));
 
+/**
+*  @brief
+*    Begin a hook transaction, returns an empty handle hooks can
+*    be queued on through @detour_impl_prepare
+*
+*  @param[in] impl
+*    Pointer to the detour hook implementation
+*
+*  @return
+*    Return pointer to the detour handle on success, null otherwise
+*
+*/
+DETOUR_API detour_impl_handle detour_impl_prepare_begin(detour_impl impl);
+
+/**
+*  @brief
+*    Queue a hook on the transaction handle without applying it,
+*    plugins without transaction support install it immediately
+*
+*  @param[in] impl
+*    Pointer to the detour hook implementation
+*
+*  @param[in] handle
+*    Pointer to the detour hook handle
+*
+*  @param[in,out] target
+*    Pointer to the function to be intercepted, rewritten to the trampoline
+*
+*  @param[in] hook
+*    Function will be called instead of target
+*
+*  @return
+*    Return zero on success, different from zero otherwise
+*
+*/
+DETOUR_API int detour_impl_prepare(detour_impl impl, detour_impl_handle handle, void (**target)(void), void (*hook)(void));
+
+/**
+*  @brief
+*    Apply all queued hooks of the transaction in one batch
+*
+*  @param[in] impl
+*    Pointer to the detour hook implementation
+*
+*  @param[in] handle
+*    Pointer to the detour hook handle
+*
+*  @return
+*    Return zero on success, different from zero otherwise
+*
+*/
+DETOUR_API int detour_impl_commit(detour_impl impl, detour_impl_handle handle);
+
+/**
+*  @brief
+*    Discard a transaction handle without applying the queued hooks
+*
+*  @param[in] impl
+*    Pointer to the detour hook implementation
+*
+*  @param[in] handle
+*    Pointer to the detour hook handle
+*
+*  @return
+*    Return zero on success, different from zero otherwise
+*
+*/
+DETOUR_API int detour_impl_discard(detour_impl impl, detour_impl_handle handle);
+
 /**
 *  @brief
 *    Uninstall detour implementation
@@ -45,6 +45,10 @@ typedef int (*detour_interface_uninstall)(detour_impl_handle);
 
 typedef int (*detour_interface_destroy)(detour_impl_handle);
 
+typedef int (*detour_interface_prepare)(detour_impl_handle, void (**)(void), void (*)(void));
+
+typedef int (*detour_interface_commit)(detour_impl_handle);
+
 typedef struct detour_interface_type *detour_interface;
 
 typedef detour_interface (*detour_interface_singleton)(void);
@@ -57,6 +61,13 @@ struct detour_interface_type
 	detour_interface_install install;
 	detour_interface_uninstall uninstall;
 	detour_interface_destroy destroy;
+
+	/* Optional transaction entries, plugins implementing them queue
+	multiple hooks on one handle (prepare) and apply them in a single
+	protection and cache flush cycle (commit); plugins without them
+	fall back to immediate installation per queued hook */
+	detour_interface_prepare prepare;
+	detour_interface_commit commit;
 };
 
 #ifdef __cplusplus
@@ -195,6 +195,117 @@ detour_handle detour_install(detour d, void (*target)(void), void (*hook)(void))
 	return handle;
 }
 
+detour_handle detour_transaction_begin(detour d)
+{
+	detour_handle handle;
+
+	if (d == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid transaction arguments");
+
+		return NULL;
+	}
+
+	handle = malloc(sizeof(struct detour_handle_type));
+
+	if (handle == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid transaction handle allocation");
+
+		return NULL;
+	}
+
+	handle->target = NULL;
+
+	handle->impl = detour_impl_prepare_begin(d->impl);
+
+	if (handle->impl == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid transaction implementation");
+
+		free(handle);
+
+		return NULL;
+	}
+
+	return handle;
+}
+
+int detour_transaction_queue(detour d, detour_handle handle, void (**target)(void), void (*hook)(void))
+{
+	if (d == NULL || handle == NULL || target == NULL || *target == NULL || hook == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid transaction queue arguments");
+
+		return 1;
+	}
+
+	if (detour_impl_prepare(d->impl, handle->impl, target, hook) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid transaction queue implementation");
+
+		return 1;
+	}
+
+	/* The first queued trampoline backs detour_trampoline, matching
+	the handle returned by a plain detour_install */
+	if (handle->target == NULL)
+	{
+		handle->target = *target;
+	}
+
+	return 0;
+}
+
+int detour_transaction_commit(detour d, detour_handle handle)
+{
+	if (d == NULL || handle == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid transaction commit arguments");
+
+		return 1;
+	}
+
+	if (detour_impl_commit(d->impl, handle->impl) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid transaction commit implementation");
+
+		if (detour_impl_discard(d->impl, handle->impl) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid transaction discard implementation");
+		}
+
+		free(handle);
+
+		return 1;
+	}
+
+	return 0;
+}
+
+int detour_transaction_rollback(detour d, detour_handle handle)
+{
+	int result = 0;
+
+	if (d == NULL || handle == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid transaction rollback arguments");
+
+		return 1;
+	}
+
+	if (detour_impl_discard(d->impl, handle->impl) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid transaction discard implementation");
+
+		result = 1;
+	}
+
+	free(handle);
+
+	return result;
+}
+
 int detour_uninstall(detour d, detour_handle handle)
 {
 	if (d == NULL || handle == NULL)
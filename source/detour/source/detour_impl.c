@@ -177,6 +177,45 @@ detour_impl_handle detour_impl_install(detour_impl impl, void (**target)(void),
 	return handle;
 }
 
+detour_impl_handle detour_impl_prepare_begin(detour_impl impl)
+{
+	detour_impl_handle handle = impl->iface->initialize();
+
+	if (handle == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid detour implementation handle initialization");
+	}
+
+	return handle;
+}
+
+int detour_impl_prepare(detour_impl impl, detour_impl_handle handle, void (**target)(void), void (*hook)(void))
+{
+	/* Plugins without transaction support install immediately, the
+	transaction degrades to one protection cycle per hook */
+	if (impl->iface->prepare == NULL)
+	{
+		return impl->iface->install(handle, target, hook);
+	}
+
+	return impl->iface->prepare(handle, target, hook);
+}
+
+int detour_impl_commit(detour_impl impl, detour_impl_handle handle)
+{
+	if (impl->iface->commit == NULL)
+	{
+		return 0;
+	}
+
+	return impl->iface->commit(handle);
+}
+
+int detour_impl_discard(detour_impl impl, detour_impl_handle handle)
+{
+	return impl->iface->destroy(handle);
+}
+
 int detour_impl_uninstall(detour_impl impl, detour_impl_handle handle)
 {
 	if (impl->iface->uninstall(handle) != 0)
@@ -62,6 +62,39 @@ FUNCHOOK_DETOUR_API detour_impl_handle funchook_detour_impl_initialize(void);
 */
 FUNCHOOK_DETOUR_API int funchook_detour_impl_install(detour_impl_handle handle, void (**target)(void), void (*hook)(void));
 
+/**
+*  @brief
+*    Queue a hook on the handle without installing it, part of the
+*    transactional batch installation
+*
+*  @param[in] handle
+*    Pointer to the detour hook implementation
+*
+*  @param[in,out] target
+*    Pointer to the function to be intercepted, rewritten to the trampoline
+*
+*  @param[in] hook
+*    Function will be called instead of target
+*
+*  @return
+*    Return zero on success, different from zero otherwise
+*
+*/
+FUNCHOOK_DETOUR_API int funchook_detour_impl_prepare(detour_impl_handle handle, void (**target)(void), void (*hook)(void));
+
+/**
+*  @brief
+*    Install all hooks queued on the handle in one batch
+*
+*  @param[in] handle
+*    Pointer to the detour hook implementation
+*
+*  @return
+*    Return zero on success, different from zero otherwise
+*
+*/
+FUNCHOOK_DETOUR_API int funchook_detour_impl_commit(detour_impl_handle handle);
+
 /**
 *  @brief
 *    Uninstall FuncHook detour implementation
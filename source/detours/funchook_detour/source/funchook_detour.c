@@ -21,7 +21,9 @@ detour_interface funchook_detour_impl_interface_singleton()
 		&funchook_detour_impl_initialize,
 		&funchook_detour_impl_install,
 		&funchook_detour_impl_uninstall,
-		&funchook_detour_impl_destroy
+		&funchook_detour_impl_destroy,
+		&funchook_detour_impl_prepare,
+		&funchook_detour_impl_commit
 	};
 
 	return &interface_instance_funchook;
@@ -71,6 +71,34 @@ int funchook_detour_impl_install(detour_impl_handle handle, void (**target)(void
 	return 1;
 }
 
+int funchook_detour_impl_prepare(detour_impl_handle handle, void (**target)(void), void (*hook)(void))
+{
+	detour_impl_funchook handle_impl = handle;
+
+	if (handle_impl != NULL && handle_impl->funchook != NULL && target != NULL && hook != NULL)
+	{
+		void **hook_ptr = (void **)&hook;
+
+		return !(funchook_prepare(handle_impl->funchook, (void **)target, (void *)*hook_ptr) == FUNCHOOK_ERROR_SUCCESS);
+	}
+
+	return 1;
+}
+
+int funchook_detour_impl_commit(detour_impl_handle handle)
+{
+	detour_impl_funchook handle_impl = handle;
+
+	if (handle_impl != NULL && handle_impl->funchook != NULL)
+	{
+		/* All hooks prepared on the handle install in one call, funchook
+		flips page protections and flushes the instruction cache once */
+		return !(funchook_install(handle_impl->funchook, 0) == FUNCHOOK_ERROR_SUCCESS);
+	}
+
+	return 1;
+}
+
 int funchook_detour_impl_uninstall(detour_impl_handle handle)
 {
 	detour_impl_funchook handle_impl = handle;
@@ -30,6 +30,8 @@
 #include <dynlink/dynlink_symbol.h>
 #include <dynlink/dynlink_type.h>
 
+#include <stdlib.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -117,6 +119,27 @@ DYNLINK_API dynlink_flags dynlink_get_flags(dynlink handle);
 */
 DYNLINK_API int dynlink_symbol(dynlink handle, dynlink_symbol_name symbol_name, dynlink_symbol_addr *symbol_address);
 
+/**
+*  @brief
+*    Get multiple symbol addresses of dynamically linked shared object by name in a single pass
+*
+*  @param[in] handle
+*    Handle of dynamically linked shared object
+*
+*  @param[in] symbol_names
+*    Array of names of the dynamically linked shared object symbols
+*
+*  @param[out] symbol_addresses
+*    Array to be filled with the addresses of the dynamically linked shared object symbols (unresolved entries are set to NULL)
+*
+*  @param[in] size
+*    Number of symbols to be resolved
+*
+*  @return
+*    Returns zero if all symbols were correctly resolved, distinct from zero otherwise
+*/
+DYNLINK_API int dynlink_symbol_bulk(dynlink handle, const dynlink_symbol_name symbol_names[], dynlink_symbol_addr symbol_addresses[], size_t size);
+
 /**
 *  @brief
 *    Unloads a dynamically linked shared object by its handle
@@ -28,16 +28,40 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* -- Definitions -- */
+
+#define DYNLINK_SYMBOL_CACHE_CAPACITY 0x10
+
 /* -- Member data -- */
 
+struct dynlink_symbol_cache_entry_type
+{
+	dynlink_symbol_name_man name; /**< Resolved symbol name */
+	dynlink_symbol_addr address;  /**< Resolved symbol address */
+};
+
+struct dynlink_symbol_cache_type
+{
+	struct dynlink_symbol_cache_entry_type *entries; /**< Array of resolved symbol entries */
+	size_t count;									 /**< Number of resolved symbol entries */
+	size_t capacity;								 /**< Allocated capacity of resolved symbol entries */
+};
+
 struct dynlink_type
 {
-	dynlink_name_impl name;		 /**< Dynamically linked shared object name */
-	dynlink_name_impl name_impl; /**< Dynamically linked shared object file name */
-	dynlink_flags flags;		 /**< Dynamically linked shared object flags */
-	dynlink_impl impl;			 /**< Dynamically linked shared object loader implementation */
+	dynlink_name_impl name;				   /**< Dynamically linked shared object name */
+	dynlink_name_impl name_impl;		   /**< Dynamically linked shared object file name */
+	dynlink_flags flags;				   /**< Dynamically linked shared object flags */
+	dynlink_impl impl;					   /**< Dynamically linked shared object loader implementation */
+	struct dynlink_symbol_cache_type cache; /**< Resolved symbol cache */
 };
 
+/* -- Private Methods -- */
+
+static dynlink_symbol_addr dynlink_symbol_cache_get(dynlink handle, dynlink_symbol_name symbol_name);
+
+static void dynlink_symbol_cache_set(dynlink handle, dynlink_symbol_name symbol_name, dynlink_symbol_addr symbol_address);
+
 /* -- Methods -- */
 
 const char *dynlink_extension()
@@ -68,6 +92,10 @@ dynlink dynlink_load(dynlink_path path, dynlink_name name, dynlink_flags flags)
 
 			handle->flags = flags;
 
+			handle->cache.entries = NULL;
+			handle->cache.count = 0;
+			handle->cache.capacity = 0;
+
 			handle->impl = dynlink_impl_load(handle);
 
 			if (handle->impl != NULL)
@@ -112,22 +140,110 @@ dynlink_flags dynlink_get_flags(dynlink handle)
 	return 0;
 }
 
+dynlink_symbol_addr dynlink_symbol_cache_get(dynlink handle, dynlink_symbol_name symbol_name)
+{
+	size_t iterator;
+
+	for (iterator = 0; iterator < handle->cache.count; ++iterator)
+	{
+		if (strncmp(handle->cache.entries[iterator].name, symbol_name, DYNLINK_SYMBOL_NAME_SIZE) == 0)
+		{
+			return handle->cache.entries[iterator].address;
+		}
+	}
+
+	return NULL;
+}
+
+void dynlink_symbol_cache_set(dynlink handle, dynlink_symbol_name symbol_name, dynlink_symbol_addr symbol_address)
+{
+	if (strlen(symbol_name) >= DYNLINK_SYMBOL_NAME_SIZE)
+	{
+		return;
+	}
+
+	if (handle->cache.count == handle->cache.capacity)
+	{
+		size_t capacity = handle->cache.capacity == 0 ? DYNLINK_SYMBOL_CACHE_CAPACITY : handle->cache.capacity << 1;
+
+		struct dynlink_symbol_cache_entry_type *entries = realloc(handle->cache.entries, sizeof(struct dynlink_symbol_cache_entry_type) * capacity);
+
+		if (entries == NULL)
+		{
+			/* The cache is an optimization, resolution still works without it */
+			return;
+		}
+
+		handle->cache.entries = entries;
+		handle->cache.capacity = capacity;
+	}
+
+	strncpy(handle->cache.entries[handle->cache.count].name, symbol_name, DYNLINK_SYMBOL_NAME_SIZE);
+
+	handle->cache.entries[handle->cache.count].address = symbol_address;
+
+	++handle->cache.count;
+}
+
 int dynlink_symbol(dynlink handle, dynlink_symbol_name symbol_name, dynlink_symbol_addr *symbol_address)
 {
 	if (handle != NULL && handle->impl != NULL && symbol_name != NULL && symbol_address != NULL)
 	{
-		return dynlink_impl_symbol(handle, handle->impl, symbol_name, symbol_address);
+		dynlink_symbol_addr address = dynlink_symbol_cache_get(handle, symbol_name);
+
+		if (address != NULL)
+		{
+			*symbol_address = address;
+
+			return 0;
+		}
+
+		if (dynlink_impl_symbol(handle, handle->impl, symbol_name, symbol_address) == 0)
+		{
+			dynlink_symbol_cache_set(handle, symbol_name, *symbol_address);
+
+			return 0;
+		}
 	}
 
 	return 1;
 }
 
+int dynlink_symbol_bulk(dynlink handle, const dynlink_symbol_name symbol_names[], dynlink_symbol_addr symbol_addresses[], size_t size)
+{
+	size_t iterator;
+
+	int result = 0;
+
+	if (handle == NULL || handle->impl == NULL || symbol_names == NULL || symbol_addresses == NULL)
+	{
+		return 1;
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		if (dynlink_symbol(handle, symbol_names[iterator], &symbol_addresses[iterator]) != 0)
+		{
+			symbol_addresses[iterator] = NULL;
+
+			result = 1;
+		}
+	}
+
+	return result;
+}
+
 void dynlink_unload(dynlink handle)
 {
 	if (handle != NULL)
 	{
 		dynlink_impl_unload(handle, handle->impl);
 
+		if (handle->cache.entries != NULL)
+		{
+			free(handle->cache.entries);
+		}
+
 		free(handle);
 	}
 }
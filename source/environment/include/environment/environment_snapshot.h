@@ -0,0 +1,79 @@
+/*
+ *	Environment Library by Parra Studios
+ *	A cross-platform library for supporting platform specific environment features.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef ENVIRONMENT_SNAPSHOT_H
+#define ENVIRONMENT_SNAPSHOT_H 1
+
+/* -- Headers -- */
+
+#include <environment/environment_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Take a snapshot of the process environment, the whole environ
+*    block is copied once so later reads are plain lookups that do
+*    not touch the libc environment lock; taken lazily by the first
+*    read when not called explicitly
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+ENVIRONMENT_API int environment_snapshot_initialize(void);
+
+/**
+*  @brief
+*    Read the variable @name from the snapshot
+*
+*  @param[in] name
+*    Name of the environment variable
+*
+*  @param[in] default_value
+*    Value returned when the variable was not set at snapshot time
+*
+*  @return
+*    Value of the variable, owned by the snapshot, or @default_value
+*/
+ENVIRONMENT_API const char *environment_snapshot_get(const char *name, const char *default_value);
+
+/**
+*  @brief
+*    Drop the snapshot and take a fresh one, variables modified since
+*    the previous snapshot become visible; pointers returned by
+*    previous reads are invalidated
+*/
+ENVIRONMENT_API void environment_snapshot_refresh(void);
+
+/**
+*  @brief
+*    Destroy the snapshot, the next read falls back to a new one
+*/
+ENVIRONMENT_API void environment_snapshot_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENVIRONMENT_SNAPSHOT_H */
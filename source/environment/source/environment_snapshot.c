@@ -0,0 +1,207 @@
+/*
+ *	Environment Library by Parra Studios
+ *	A cross-platform library for supporting platform specific environment features.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <environment/environment_snapshot.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+#if defined(WIN32) || defined(_WIN32)
+	#define ENVIRONMENT_SNAPSHOT_ENVIRON _environ
+#else
+extern char **environ;
+	#define ENVIRONMENT_SNAPSHOT_ENVIRON environ
+#endif
+
+/* -- Private Variables -- */
+
+/* Sorted copies of the "NAME=value" entries, immutable once taken so
+concurrent reads need no synchronization; refresh and destroy must not
+race against readers, callers serialize them around initialization */
+static char **environment_snapshot_entries = NULL;
+
+static size_t environment_snapshot_count = 0;
+
+/* -- Private Methods -- */
+
+/**
+*  @brief
+*    Compare two "NAME=value" entries by their name part
+*/
+static int environment_snapshot_compare(const void *left, const void *right)
+{
+	const char *left_entry = *(const char *const *)left;
+	const char *right_entry = *(const char *const *)right;
+
+	while (*left_entry != '\0' && *left_entry != '=' && *left_entry == *right_entry)
+	{
+		++left_entry;
+		++right_entry;
+	}
+
+	{
+		unsigned char left_chr = (*left_entry == '=') ? 0 : (unsigned char)*left_entry;
+		unsigned char right_chr = (*right_entry == '=') ? 0 : (unsigned char)*right_entry;
+
+		return (int)left_chr - (int)right_chr;
+	}
+}
+
+/* -- Methods -- */
+
+int environment_snapshot_initialize(void)
+{
+	char **environ_ptr = ENVIRONMENT_SNAPSHOT_ENVIRON;
+
+	size_t count = 0, iterator;
+
+	if (environment_snapshot_entries != NULL)
+	{
+		return 0;
+	}
+
+	if (environ_ptr != NULL)
+	{
+		while (environ_ptr[count] != NULL)
+		{
+			++count;
+		}
+	}
+
+	environment_snapshot_entries = malloc(sizeof(char *) * (count + 1));
+
+	if (environment_snapshot_entries == NULL)
+	{
+		return 1;
+	}
+
+	for (iterator = 0; iterator < count; ++iterator)
+	{
+		size_t length = strlen(environ_ptr[iterator]);
+
+		environment_snapshot_entries[iterator] = malloc(sizeof(char) * (length + 1));
+
+		if (environment_snapshot_entries[iterator] == NULL)
+		{
+			environment_snapshot_count = iterator;
+
+			environment_snapshot_destroy();
+
+			return 1;
+		}
+
+		memcpy(environment_snapshot_entries[iterator], environ_ptr[iterator], length + 1);
+	}
+
+	environment_snapshot_entries[count] = NULL;
+
+	environment_snapshot_count = count;
+
+	qsort(environment_snapshot_entries, count, sizeof(char *), &environment_snapshot_compare);
+
+	return 0;
+}
+
+const char *environment_snapshot_get(const char *name, const char *default_value)
+{
+	size_t begin, end;
+
+	if (name == NULL)
+	{
+		return default_value;
+	}
+
+	if (environment_snapshot_entries == NULL && environment_snapshot_initialize() != 0)
+	{
+		/* Snapshot allocation failure falls back to the direct read */
+		const char *variable = getenv(name);
+
+		return (variable != NULL) ? variable : default_value;
+	}
+
+	/* Binary search by the name part of the sorted entries */
+	begin = 0;
+	end = environment_snapshot_count;
+
+	while (begin < end)
+	{
+		size_t middle = begin + ((end - begin) >> 1);
+
+		const char *entry = environment_snapshot_entries[middle];
+
+		const char *name_ptr = name;
+
+		int comparison;
+
+		while (*entry != '\0' && *entry != '=' && *name_ptr != '\0' && *entry == *name_ptr)
+		{
+			++entry;
+			++name_ptr;
+		}
+
+		comparison = (int)((*entry == '=') ? 0 : (unsigned char)*entry) - (int)(unsigned char)*name_ptr;
+
+		if (comparison == 0)
+		{
+			return (*entry == '=') ? entry + 1 : "";
+		}
+
+		if (comparison < 0)
+		{
+			begin = middle + 1;
+		}
+		else
+		{
+			end = middle;
+		}
+	}
+
+	return default_value;
+}
+
+void environment_snapshot_refresh(void)
+{
+	environment_snapshot_destroy();
+
+	(void)environment_snapshot_initialize();
+}
+
+void environment_snapshot_destroy(void)
+{
+	if (environment_snapshot_entries != NULL)
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < environment_snapshot_count; ++iterator)
+		{
+			free(environment_snapshot_entries[iterator]);
+		}
+
+		free(environment_snapshot_entries);
+
+		environment_snapshot_entries = NULL;
+
+		environment_snapshot_count = 0;
+	}
+}
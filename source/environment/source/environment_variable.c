@@ -20,6 +20,7 @@
 
 /* -- Headers -- */
 
+#include <environment/environment_snapshot.h>
 #include <environment/environment_variable.h>
 
 #include <stdlib.h>
@@ -29,7 +30,10 @@
 
 char *environment_variable_create(const char *name, const char *default_value)
 {
-	const char *variable_ptr = getenv(name);
+	/* Reads go through the environment snapshot, each variable costs
+	the libc environment lock and scan only once per process (use
+	environment_snapshot_refresh to observe later modifications) */
+	const char *variable_ptr = environment_snapshot_get(name, NULL);
 
 	char *variable;
 
@@ -65,14 +69,7 @@ char *environment_variable_create(const char *name, const char *default_value)
 
 const char *environment_variable_get(const char *name, const char *default_value)
 {
-	const char *variable = getenv(name);
-
-	if (variable != NULL)
-	{
-		return variable;
-	}
-
-	return default_value;
+	return environment_snapshot_get(name, default_value);
 }
 
 void environment_variable_destroy(char *variable)
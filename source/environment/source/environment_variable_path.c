@@ -20,6 +20,7 @@
 
 /* -- Headers -- */
 
+#include <environment/environment_snapshot.h>
 #include <environment/environment_variable_path.h>
 
 #include <stdlib.h>
@@ -45,7 +46,7 @@
 
 char *environment_variable_path_create(const char *name, const char *default_path)
 {
-	const char *path_ptr = getenv(name);
+	const char *path_ptr = environment_snapshot_get(name, NULL);
 
 	char *path;
 
@@ -0,0 +1,102 @@
+/*
+ *	File System Library by Parra Studios
+ *	A cross-platform library for managing file system, paths and files.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef FILESYSTEM_READAHEAD_H
+#define FILESYSTEM_READAHEAD_H 1
+
+/* -- Headers -- */
+
+#include <filesystem/filesystem_api.h>
+
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Definitions -- */
+
+#define FILESYSTEM_READAHEAD_POOL_SIZE ((size_t)0x04)
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Issue asynchronous reads for a batch of files so their content is
+*    resident before a loader asks for it, overlapping disk latency with
+*    whatever the caller does next (typically runtime initialization).
+*    The contents are read into memory by a background worker pool and
+*    retained until claimed with filesystem_readahead_acquire or dropped
+*    with filesystem_readahead_destroy. The first call initializes the
+*    pool lazily and is expected to happen before worker threads exist
+*
+*  @param[in] paths
+*    Array of absolute paths to the files to be prefetched
+*
+*  @param[in] size
+*    Number of paths contained in @paths
+*
+*  @return
+*    Number of files successfully queued for prefetch
+*/
+FILESYSTEM_API size_t filesystem_readahead_submit(const char *const paths[], size_t size);
+
+/**
+*  @brief
+*    Claim the prefetched content of @path, blocking only if the
+*    background read has not finished yet. On success the buffer
+*    ownership is transferred to the caller, who must release it with
+*    free. A path can be acquired at most once; a miss (never submitted,
+*    already claimed or failed read) leaves the output parameters
+*    untouched so the caller can fall back to a synchronous read
+*
+*  @param[in] path
+*    Absolute path to the file previously submitted
+*
+*  @param[out] buffer
+*    Pointer to the file content, null terminated
+*
+*  @param[out] length
+*    Size of the content in bytes, without the null terminator
+*
+*  @return
+*    Returns zero on success, different from zero otherwise
+*/
+FILESYSTEM_API int filesystem_readahead_acquire(const char *path, char **buffer, size_t *length);
+
+/**
+*  @brief
+*    Block until every submitted read has completed, leaving the
+*    buffers retained for later acquisition
+*/
+FILESYSTEM_API void filesystem_readahead_await(void);
+
+/**
+*  @brief
+*    Wait for outstanding reads, release all unclaimed buffers and
+*    destroy the worker pool
+*/
+FILESYSTEM_API void filesystem_readahead_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FILESYSTEM_READAHEAD_H */
@@ -12,7 +12,7 @@
 
 #include <filesystem/filesystem.h>
 
-#include <adt/adt_trie.h>
+#include <adt/adt_radix_tree.h>
 
 #include <log/log.h>
 
@@ -24,7 +24,7 @@ struct filesystem_type
 {
 	filesystem_flags flags; /**< File system configuration flags */
 	const char *root;		/**< Root path where file system will be mounted */
-	trie storage;			/**< Trie containing whole file system directories and files */
+	radix_tree storage;		/**< Radix tree containing whole file system directories and files */
 };
 
 /* -- Methods -- */
@@ -42,7 +42,7 @@ filesystem filesystem_create(const char *root, filesystem_flags flags)
 			return NULL;
 		}
 
-		fs->storage = trie_create(&hash_callback_str, &comparable_callback_str);
+		fs->storage = radix_tree_create();
 
 		if (fs->storage == NULL)
 		{
@@ -143,7 +143,7 @@ void filesystem_destroy(filesystem fs)
 	{
 		if (fs->storage != NULL)
 		{
-			trie_destroy(fs->storage);
+			radix_tree_destroy(fs->storage);
 		}
 
 		free(fs);
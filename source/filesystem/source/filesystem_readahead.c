@@ -0,0 +1,388 @@
+/*
+ *	File System Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing file system, paths and files.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <filesystem/filesystem_readahead.h>
+
+#include <adt/adt_set.h>
+
+#include <threading/threading_mutex.h>
+#include <threading/threading_pool.h>
+
+#include <log/log.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(unix) || defined(__unix__) || defined(__unix) || \
+	defined(linux) || defined(__linux__) || defined(__linux) || defined(__gnu_linux)
+	#include <fcntl.h>
+#endif
+
+/* -- Member Data -- */
+
+struct filesystem_readahead_entry_type
+{
+	char *path;					   /**< Owned copy of the submitted path, used as set key */
+	char *buffer;				   /**< File content, null if the read failed or is in flight */
+	size_t length;				   /**< Content size in bytes without the null terminator */
+	threading_pool_future future;  /**< Pending read, null once awaited */
+};
+
+typedef struct filesystem_readahead_entry_type *filesystem_readahead_entry;
+
+static threading_pool filesystem_readahead_pool = NULL;
+
+static set filesystem_readahead_map = NULL;
+
+static threading_mutex filesystem_readahead_mutex = NULL;
+
+/* -- Private Methods -- */
+
+static void *filesystem_readahead_task(void *data)
+{
+	filesystem_readahead_entry entry = data;
+
+	FILE *file = fopen(entry->path, "rb");
+
+	long length;
+
+	if (file == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_WARNING, "File system readahead cannot open file %s", entry->path);
+
+		return entry;
+	}
+
+#if defined(POSIX_FADV_WILLNEED)
+	/* Start the kernel readahead for the whole file so the copy
+	below overlaps with the disk instead of faulting page by page */
+	posix_fadvise(fileno(file), 0, 0, POSIX_FADV_WILLNEED);
+#endif
+
+	if (fseek(file, 0, SEEK_END) != 0 || (length = ftell(file)) < 0 || fseek(file, 0, SEEK_SET) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_WARNING, "File system readahead cannot size file %s", entry->path);
+
+		fclose(file);
+
+		return entry;
+	}
+
+	entry->buffer = malloc(sizeof(char) * ((size_t)length + 1));
+
+	if (entry->buffer == NULL)
+	{
+		fclose(file);
+
+		return entry;
+	}
+
+	if (fread(entry->buffer, sizeof(char), (size_t)length, file) != (size_t)length)
+	{
+		log_write("metacall", LOG_LEVEL_WARNING, "File system readahead cannot read file %s", entry->path);
+
+		free(entry->buffer);
+
+		entry->buffer = NULL;
+
+		fclose(file);
+
+		return entry;
+	}
+
+	entry->buffer[length] = '\0';
+
+	entry->length = (size_t)length;
+
+	fclose(file);
+
+	return entry;
+}
+
+static void filesystem_readahead_entry_destroy(filesystem_readahead_entry entry)
+{
+	if (entry != NULL)
+	{
+		if (entry->future != NULL)
+		{
+			threading_pool_await(entry->future);
+
+			threading_pool_future_destroy(entry->future);
+		}
+
+		if (entry->buffer != NULL)
+		{
+			free(entry->buffer);
+		}
+
+		free(entry->path);
+
+		free(entry);
+	}
+}
+
+static int filesystem_readahead_initialize(void)
+{
+	/* Lazy initialization, the first submit is expected to come from the
+	boot path before any concurrent caller exists */
+	if (filesystem_readahead_pool != NULL)
+	{
+		return 0;
+	}
+
+	filesystem_readahead_mutex = threading_mutex_create();
+
+	if (filesystem_readahead_mutex == NULL)
+	{
+		return 1;
+	}
+
+	filesystem_readahead_map = set_create(&hash_callback_str, &comparable_callback_str);
+
+	if (filesystem_readahead_map == NULL)
+	{
+		threading_mutex_destroy(filesystem_readahead_mutex);
+
+		filesystem_readahead_mutex = NULL;
+
+		return 1;
+	}
+
+	filesystem_readahead_pool = threading_pool_create(FILESYSTEM_READAHEAD_POOL_SIZE);
+
+	if (filesystem_readahead_pool == NULL)
+	{
+		set_destroy(filesystem_readahead_map);
+
+		threading_mutex_destroy(filesystem_readahead_mutex);
+
+		filesystem_readahead_map = NULL;
+
+		filesystem_readahead_mutex = NULL;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+static int filesystem_readahead_await_cb(set s, set_key key, set_value value, set_cb_iterate_args args)
+{
+	filesystem_readahead_entry entry = value;
+
+	(void)s;
+	(void)key;
+	(void)args;
+
+	if (entry->future != NULL)
+	{
+		threading_pool_await(entry->future);
+
+		threading_pool_future_destroy(entry->future);
+
+		entry->future = NULL;
+	}
+
+	return 0;
+}
+
+static int filesystem_readahead_destroy_cb(set s, set_key key, set_value value, set_cb_iterate_args args)
+{
+	(void)s;
+	(void)key;
+	(void)args;
+
+	filesystem_readahead_entry_destroy(value);
+
+	return 0;
+}
+
+/* -- Methods -- */
+
+size_t filesystem_readahead_submit(const char *const paths[], size_t size)
+{
+	size_t iterator, count = 0;
+
+	if (paths == NULL || size == 0)
+	{
+		return 0;
+	}
+
+	if (filesystem_readahead_initialize() != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "File system readahead invalid initialization");
+
+		return 0;
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		filesystem_readahead_entry entry;
+
+		size_t length;
+
+		if (paths[iterator] == NULL)
+		{
+			continue;
+		}
+
+		threading_mutex_lock(filesystem_readahead_mutex);
+
+		if (set_get(filesystem_readahead_map, (set_key)paths[iterator]) != NULL)
+		{
+			threading_mutex_unlock(filesystem_readahead_mutex);
+
+			continue;
+		}
+
+		threading_mutex_unlock(filesystem_readahead_mutex);
+
+		entry = malloc(sizeof(struct filesystem_readahead_entry_type));
+
+		if (entry == NULL)
+		{
+			continue;
+		}
+
+		length = strlen(paths[iterator]);
+
+		entry->path = malloc(sizeof(char) * (length + 1));
+
+		if (entry->path == NULL)
+		{
+			free(entry);
+
+			continue;
+		}
+
+		memcpy(entry->path, paths[iterator], length + 1);
+
+		entry->buffer = NULL;
+
+		entry->length = 0;
+
+		entry->future = threading_pool_submit(filesystem_readahead_pool, &filesystem_readahead_task, entry);
+
+		if (entry->future == NULL)
+		{
+			free(entry->path);
+
+			free(entry);
+
+			continue;
+		}
+
+		threading_mutex_lock(filesystem_readahead_mutex);
+
+		if (set_insert(filesystem_readahead_map, (set_key)entry->path, entry) != 0)
+		{
+			threading_mutex_unlock(filesystem_readahead_mutex);
+
+			filesystem_readahead_entry_destroy(entry);
+
+			continue;
+		}
+
+		threading_mutex_unlock(filesystem_readahead_mutex);
+
+		++count;
+	}
+
+	return count;
+}
+
+int filesystem_readahead_acquire(const char *path, char **buffer, size_t *length)
+{
+	filesystem_readahead_entry entry;
+
+	if (path == NULL || buffer == NULL || length == NULL || filesystem_readahead_pool == NULL)
+	{
+		return 1;
+	}
+
+	threading_mutex_lock(filesystem_readahead_mutex);
+
+	/* Detach the entry so the blocking await happens outside the lock
+	and a concurrent acquire of the same path misses instead of racing */
+	entry = set_remove(filesystem_readahead_map, (set_key)path);
+
+	threading_mutex_unlock(filesystem_readahead_mutex);
+
+	if (entry == NULL)
+	{
+		return 1;
+	}
+
+	if (entry->future != NULL)
+	{
+		threading_pool_await(entry->future);
+
+		threading_pool_future_destroy(entry->future);
+
+		entry->future = NULL;
+	}
+
+	if (entry->buffer == NULL)
+	{
+		filesystem_readahead_entry_destroy(entry);
+
+		return 1;
+	}
+
+	*buffer = entry->buffer;
+
+	*length = entry->length;
+
+	free(entry->path);
+
+	free(entry);
+
+	return 0;
+}
+
+void filesystem_readahead_await(void)
+{
+	if (filesystem_readahead_pool == NULL)
+	{
+		return;
+	}
+
+	threading_mutex_lock(filesystem_readahead_mutex);
+
+	set_iterate(filesystem_readahead_map, &filesystem_readahead_await_cb, NULL);
+
+	threading_mutex_unlock(filesystem_readahead_mutex);
+}
+
+void filesystem_readahead_destroy(void)
+{
+	if (filesystem_readahead_pool == NULL)
+	{
+		return;
+	}
+
+	threading_mutex_lock(filesystem_readahead_mutex);
+
+	set_iterate(filesystem_readahead_map, &filesystem_readahead_destroy_cb, NULL);
+
+	set_destroy(filesystem_readahead_map);
+
+	filesystem_readahead_map = NULL;
+
+	threading_mutex_unlock(filesystem_readahead_mutex);
+
+	threading_pool_destroy(filesystem_readahead_pool);
+
+	filesystem_readahead_pool = NULL;
+
+	threading_mutex_destroy(filesystem_readahead_mutex);
+
+	filesystem_readahead_mutex = NULL;
+}
@@ -0,0 +1,86 @@
+/*
+ *	Format Library by Parra Studios
+ *	A cross-platform library for supporting formatted input / output.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef FORMAT_NUMBER_H
+#define FORMAT_NUMBER_H 1
+
+/* -- Headers -- */
+
+#include <format/format_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Headers -- */
+
+#include <stdlib.h>
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Format a signed integer in decimal, equivalent to snprintf with
+*    "%ld" but an order of magnitude faster thanks to a two digit
+*    lookup table and no format string parsing
+*
+*  @param[in] value
+*    Integer to be formatted
+*
+*  @param[out] dest
+*    Destination buffer, pass null to measure only
+*
+*  @param[in] size
+*    Capacity of @dest in bytes including the null terminator
+*
+*  @return
+*    Length of the representation without the null terminator,
+*    the string is written only if it fits in @size
+*/
+FORMAT_API size_t format_number_ltoa(long value, char *dest, size_t size);
+
+/**
+*  @brief
+*    Format a double in fixed notation with six decimals, byte
+*    identical to snprintf with "%.6f". The scaled fraction is computed
+*    with exact integer arithmetic where 128 bit integers are
+*    available; otherwise, and for huge or non finite values, it
+*    falls back to snprintf
+*
+*  @param[in] value
+*    Double to be formatted
+*
+*  @param[out] dest
+*    Destination buffer, pass null to measure only
+*
+*  @param[in] size
+*    Capacity of @dest in bytes including the null terminator
+*
+*  @return
+*    Length of the representation without the null terminator,
+*    the string is written only if it fits in @size
+*/
+FORMAT_API size_t format_number_dtoa(double value, char *dest, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FORMAT_NUMBER_H */
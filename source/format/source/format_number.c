@@ -0,0 +1,280 @@
+/*
+ *	Format Library by Parra Studios
+ *	A cross-platform library for supporting formatted input / output.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <format/format_number.h>
+#include <format/format_print.h>
+
+#include <stdint.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+/* Worst cases: 20 digits plus sign for the integer, 17 integer digits
+plus dot plus 6 decimals plus sign for the fast double path */
+#define FORMAT_NUMBER_BUFFER_SIZE ((size_t)0x20)
+
+#define FORMAT_NUMBER_FRACTION_SCALE 1000000ULL
+
+/* Integer parts at or beyond this bound do not fit the fast path,
+snprintf handles them (the output has 16 or more integer digits) */
+#define FORMAT_NUMBER_DTOA_BOUND 1e15
+
+/* The 128 bit scaling below needs the extension keyword so a strictly
+conforming (pedantic) build does not warn on the __int128 type */
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 format_number_uint128;
+#endif
+
+/* -- Private Data -- */
+
+static const char format_number_digit_pairs[201] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+/* -- Private Methods -- */
+
+static size_t format_number_utoa_impl(uint64_t value, char *digits)
+{
+	char buffer[FORMAT_NUMBER_BUFFER_SIZE];
+
+	char *iterator = &buffer[FORMAT_NUMBER_BUFFER_SIZE];
+
+	size_t length;
+
+	/* Emit two digits per division from the lookup table */
+	while (value >= 100)
+	{
+		const char *pair = &format_number_digit_pairs[(value % 100) << 1];
+
+		value /= 100;
+
+		*(--iterator) = pair[1];
+		*(--iterator) = pair[0];
+	}
+
+	if (value >= 10)
+	{
+		const char *pair = &format_number_digit_pairs[value << 1];
+
+		*(--iterator) = pair[1];
+		*(--iterator) = pair[0];
+	}
+	else
+	{
+		*(--iterator) = (char)('0' + value);
+	}
+
+	length = (size_t)(&buffer[FORMAT_NUMBER_BUFFER_SIZE] - iterator);
+
+	memcpy(digits, iterator, length);
+
+	return length;
+}
+
+static size_t format_number_copy(const char *buffer, size_t length, char *dest, size_t size)
+{
+	/* Mirror the snprintf measuring convention so two pass callers
+	(measure with a null destination, then write) keep working */
+	if (dest != NULL && size > length)
+	{
+		memcpy(dest, buffer, length);
+
+		dest[length] = '\0';
+	}
+
+	return length;
+}
+
+/* -- Methods -- */
+
+size_t format_number_ltoa(long value, char *dest, size_t size)
+{
+	char buffer[FORMAT_NUMBER_BUFFER_SIZE];
+
+	size_t length = 0;
+
+	uint64_t magnitude;
+
+	if (value < 0)
+	{
+		/* Negation over the unsigned magnitude is defined for LONG_MIN */
+		magnitude = ~(uint64_t)value + 1;
+
+		buffer[length++] = '-';
+	}
+	else
+	{
+		magnitude = (uint64_t)value;
+	}
+
+	length += format_number_utoa_impl(magnitude, &buffer[length]);
+
+	return format_number_copy(buffer, length, dest, size);
+}
+
+size_t format_number_dtoa(double value, char *dest, size_t size)
+{
+#if defined(__SIZEOF_INT128__)
+	union
+	{
+		double d;
+		uint64_t u;
+	} bits;
+
+	char buffer[FORMAT_NUMBER_BUFFER_SIZE];
+
+	size_t length = 0;
+
+	double magnitude;
+
+	uint64_t integer_part, scaled;
+
+	double fraction;
+
+	bits.d = value;
+
+	/* Non finite values and huge magnitudes take the slow path */
+	if ((bits.u & 0x7FF0000000000000ULL) == 0x7FF0000000000000ULL)
+	{
+		goto fallback;
+	}
+
+	magnitude = (bits.u >> 63) ? -value : value;
+
+	if (magnitude >= FORMAT_NUMBER_DTOA_BOUND)
+	{
+		goto fallback;
+	}
+
+	if (bits.u >> 63)
+	{
+		buffer[length++] = '-';
+	}
+
+	integer_part = (uint64_t)magnitude;
+
+	fraction = magnitude - (double)integer_part; /* Exact, both operands share the exponent range */
+
+	if (fraction == 0.0)
+	{
+		scaled = 0;
+	}
+	else
+	{
+		/* Decompose the fraction into mantissa * 2^exponent and scale it
+		by 10^6 with exact 128 bit arithmetic, rounding half to even on
+		exact ties, so the result matches the correctly rounded decimal
+		output of the libc in every case */
+		uint64_t mantissa;
+
+		unsigned int exponent, shift;
+
+		format_number_uint128 numerator, denominator, remainder;
+
+		bits.d = fraction;
+
+		exponent = (unsigned int)((bits.u >> 52) & 0x7FF);
+
+		/* The fraction is below one so the unbiased exponent is negative,
+		track its magnitude as the unsigned denominator shift instead so
+		the comparisons below stay free of signed overflow assumptions */
+		if (exponent == 0)
+		{
+			mantissa = bits.u & 0x000FFFFFFFFFFFFFULL;
+
+			shift = 1023U + 52U - 1U;
+		}
+		else
+		{
+			mantissa = (bits.u & 0x000FFFFFFFFFFFFFULL) | 0x0010000000000000ULL;
+
+			shift = 1023U + 52U - exponent;
+		}
+
+		if (shift >= 127U)
+		{
+			/* The fraction is below half of 10^-6, it rounds to zero */
+			scaled = 0;
+		}
+		else
+		{
+			numerator = (format_number_uint128)mantissa * FORMAT_NUMBER_FRACTION_SCALE;
+
+			denominator = (format_number_uint128)1 << shift;
+
+			scaled = (uint64_t)(numerator / denominator);
+
+			remainder = numerator % denominator;
+
+			if (remainder > denominator - remainder)
+			{
+				++scaled;
+			}
+			else if (remainder == denominator - remainder && (scaled & 1))
+			{
+				++scaled;
+			}
+		}
+
+		if (scaled >= FORMAT_NUMBER_FRACTION_SCALE)
+		{
+			scaled -= FORMAT_NUMBER_FRACTION_SCALE;
+
+			++integer_part;
+		}
+	}
+
+	length += format_number_utoa_impl(integer_part, &buffer[length]);
+
+	buffer[length++] = '.';
+
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < 6; ++iterator)
+		{
+			buffer[length + 5 - iterator] = (char)('0' + (scaled % 10));
+
+			scaled /= 10;
+		}
+
+		length += 6;
+	}
+
+	return format_number_copy(buffer, length, dest, size);
+
+fallback:
+#endif
+	{
+		int result = snprintf(dest, dest == NULL ? 0 : size, "%.6f", value);
+
+		return result < 0 ? 0 : (size_t)result;
+	}
+}
@@ -29,6 +29,8 @@
 #include <loader/loader_impl_interface.h>
 #include <loader/loader_naming.h>
 
+#include <memory/memory_allocator.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -37,6 +39,10 @@ extern "C" {
 
 #include <stdlib.h>
 
+/* -- Definitions -- */
+
+#define LOADER_TAG_INVALID ((size_t)~0)
+
 /* -- Forward Declarations -- */
 
 struct loader_type;
@@ -45,6 +51,13 @@ struct loader_type;
 
 typedef value (*loader_register_invoke)(size_t, void *[], void *);
 
+/* Completion callbacks of the asynchronous load APIs, following the
+same resolve / reject convention as function_await; resolve receives
+the loaded handle, reject receives null */
+typedef void *(*loader_await_resolve_callback)(void *, void *);
+
+typedef void *(*loader_await_reject_callback)(void *, void *);
+
 typedef void *loader_data;
 
 typedef struct loader_type *loader;
@@ -53,14 +66,46 @@ typedef struct loader_type *loader;
 
 LOADER_API loader loader_singleton(void);
 
+/* Resolve the tag @tag to its small stable registry id, assigning one
+on first sight; returns LOADER_TAG_INVALID if the registry is full.
+Callers that route by tag repeatedly can resolve once and dispatch
+through loader_get_impl_id, skipping the string comparison entirely */
+LOADER_API size_t loader_tag_id(const loader_naming_tag tag);
+
+LOADER_API loader_impl loader_get_impl_id(size_t id);
+
 LOADER_API void loader_initialization_register(loader_impl impl);
 
+/* Reassign the loaders owned by other threads to the calling thread,
+used by the asynchronous destruction path so a background thread can
+tear them down; the usual thread affinity caveats of the runtimes apply */
+LOADER_API void loader_initialization_adopt(void);
+
 LOADER_API void loader_initialize(void);
 
+LOADER_API int loader_initialize_parallel(const char *tags[], size_t size);
+
+LOADER_API int loader_preload(const char *tags[], size_t size);
+
+LOADER_API int loader_preload_await(void);
+
+/* Load @size files in one batch, entry @i loads paths[i] with loader
+tags[i] into handles[i] (handles may be null); the files are grouped by
+tag with one worker per loader so independent runtimes overlap their
+discovery, and loaders that declare parallel capable discovery fan the
+files of their group out across threads; returns zero when every file
+loaded, non zero if any of them failed */
+LOADER_API int loader_load_from_file_bulk(const loader_naming_tag tags[], const loader_naming_path paths[], size_t size, void *handles[]);
+
 LOADER_API int loader_is_initialized(const loader_naming_tag tag);
 
 LOADER_API int loader_register(const char *name, loader_register_invoke invoke, function *func, type_id return_type, size_t arg_size, type_id args_type_id[]);
 
+/* Obtain the raw registered pointer of a host function created through
+@loader_register (null for any other function), so C API callers can
+dispatch to it directly without the proxy call machinery */
+LOADER_API loader_register_invoke loader_register_function_invoke(function func, void **closure);
+
 LOADER_API int loader_load_path(const loader_naming_path path);
 
 LOADER_API int loader_execution_path(const loader_naming_tag tag, const loader_naming_path path);
@@ -69,6 +114,10 @@ LOADER_API int loader_load_from_file(const loader_naming_tag tag, const loader_n
 
 LOADER_API int loader_load_from_memory(const loader_naming_tag tag, const char *buffer, size_t size, void **handle);
 
+LOADER_API int loader_load_from_file_await(const loader_naming_tag tag, const loader_naming_path paths[], size_t size, loader_await_resolve_callback resolve, loader_await_reject_callback reject, void *data);
+
+LOADER_API int loader_load_from_memory_await(const loader_naming_tag tag, const char *buffer, size_t size, loader_await_resolve_callback resolve, loader_await_reject_callback reject, void *data);
+
 LOADER_API int loader_load_from_package(const loader_naming_tag tag, const loader_naming_path path, void **handle);
 
 LOADER_API int loader_load_from_configuration(const loader_naming_path path, void **handle, void *allocator);
@@ -77,6 +126,20 @@ LOADER_API loader_impl loader_get_impl(const loader_naming_tag tag);
 
 LOADER_API loader_data loader_get(const char *name);
 
+/* Native callable address of @func when its owning loader guarantees
+C ABI compatibility, null otherwise; stable only until the owning
+handle is cleared or reloaded */
+LOADER_API void *loader_function_pointer(function func);
+
+/* Garbage collection coordination across loaders; a null @tag targets
+every initialized loader, a named tag must resolve to a loader which
+registered GC callbacks or the operation fails */
+LOADER_API int loader_gc_collect(const loader_naming_tag tag);
+
+LOADER_API int loader_gc_hint(const loader_naming_tag tag, int defer);
+
+LOADER_API int loader_gc_stats(const loader_naming_tag tag, struct loader_impl_gc_stats_type *stats);
+
 LOADER_API void *loader_get_handle(const loader_naming_tag tag, const char *name);
 
 LOADER_API void loader_set_options(const loader_naming_tag tag, void *options);
@@ -89,8 +152,25 @@ LOADER_API void *loader_handle_export(void *handle);
 
 LOADER_API loader_data loader_handle_get(void *handle, const char *name);
 
+LOADER_API memory_allocator loader_call_allocator_acquire(void);
+
+LOADER_API void loader_call_allocator_release(memory_allocator allocator);
+
 LOADER_API value loader_metadata(void);
 
+/* Like loader_metadata but building only the requested subtree: @tag
+restricts the query to one loader, @handle_name to one of its handles
+and @name_prefix to the scope objects whose name starts with it (every
+parameter is optional, NULL means no restriction); the result is owned
+by the caller and never stored in the metadata cache */
+LOADER_API value loader_metadata_filter(const char *tag, const char *handle_name, const char *name_prefix);
+
+LOADER_API value loader_metadata_cached(void);
+
+LOADER_API void loader_metadata_invalidate(void);
+
+LOADER_API int loader_reload(void *handle);
+
 LOADER_API int loader_clear(void *handle);
 
 LOADER_API void loader_unload_children(loader_impl impl);
@@ -0,0 +1,91 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A library for loading executable code at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef LOADER_DISCOVERY_CACHE_H
+#define LOADER_DISCOVERY_CACHE_H 1
+
+#include <loader/loader_api.h>
+
+#include <loader/loader_naming.h>
+
+#include <reflect/reflect_value.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Content hash of the scripts @paths, used as the discovery cache
+*    key so the cache survives reboots but never serves stale entries
+*    for an edited script
+*
+*  @param[in] paths
+*    Array of script paths to be hashed
+*
+*  @param[in] size
+*    Number of elements of @paths
+*
+*  @return
+*    Non zero hash of the script contents, zero when the cache is
+*    disabled or a path could not be read
+*/
+LOADER_API uint64_t loader_discovery_cache_hash(const loader_naming_path paths[], size_t size);
+
+/**
+*  @brief
+*    Load the discovery metadata stored for @h in a previous boot
+*
+*  @param[in] h
+*    Content hash returned by @loader_discovery_cache_hash
+*
+*  @return
+*    Owned value with the cached discovery, null on cache miss
+*/
+LOADER_API value loader_discovery_cache_fetch(uint64_t h);
+
+/**
+*  @brief
+*    Persist the discovery metadata @discovery keyed by @h so later
+*    boots of an unchanged script can skip runtime introspection
+*
+*  @param[in] h
+*    Content hash returned by @loader_discovery_cache_hash
+*
+*  @param[in] discovery
+*    Value with the discovery metadata, ownership is not taken
+*
+*  @return
+*    Zero if the entry was written, different from zero otherwise
+*/
+LOADER_API int loader_discovery_cache_store(uint64_t h, value discovery);
+
+LOADER_API void loader_discovery_cache_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOADER_DISCOVERY_CACHE_H */
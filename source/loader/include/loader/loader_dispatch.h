@@ -0,0 +1,135 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A library for loading executable code at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef LOADER_DISPATCH_H
+#define LOADER_DISPATCH_H 1
+
+#include <loader/loader_api.h>
+
+#include <loader/loader_naming.h>
+
+#include <reflect/reflect_function.h>
+
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+*	Cross-thread call router. Runtimes whose calls are pinned to the
+*	thread that initialized them (Node and its event loop, single
+*	threaded interpreters) register a router owned by that thread;
+*	calls arriving from any other thread are enqueued and the caller
+*	parks on a futex based event until the owner drains the queue.
+*	Draining processes the whole backlog in one sweep, so one owner
+*	wakeup serves every caller that queued up meanwhile, and the wake
+*	callback lets the runtime poke its own event loop (for example
+*	through uv_async_send) instead of polling.
+*/
+
+/* -- Type Definitions -- */
+
+/* Invoked once when the queue transitions from empty to populated,
+subsequent enqueues piggyback on the pending wakeup */
+typedef void (*loader_dispatch_wake_cb)(void *data);
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Register a call router for the runtime @tag, owned by the calling
+*    thread; only the owner may drain it
+*
+*  @param[in] tag
+*    Extension of the loader the router belongs to
+*
+*  @param[in] wake
+*    Callback notifying the owner that the queue became non empty,
+*    null for owners that drain on their own schedule
+*
+*  @param[in] wake_data
+*    Reference to additional data passed to the wake callback
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+LOADER_API int loader_dispatch_register(const loader_naming_tag tag, loader_dispatch_wake_cb wake, void *wake_data);
+
+/**
+*  @brief
+*    Unregister the call router of @tag, callers still parked on the
+*    queue are woken with a null result
+*
+*  @param[in] tag
+*    Extension of the loader the router belongs to
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+LOADER_API int loader_dispatch_unregister(const loader_naming_tag tag);
+
+/**
+*  @brief
+*    Invoke @func through the router of @tag; on the owner thread the
+*    call executes directly, on any other thread it is enqueued and
+*    the caller parks until the owner drains it
+*
+*  @param[in] tag
+*    Extension of the loader the router belongs to
+*
+*  @param[in] func
+*    Function to be invoked
+*
+*  @param[in] args
+*    Array of pointers to the values to be passed to the function
+*
+*  @param[in] size
+*    Number of values in @args
+*
+*  @return
+*    Result of the call, null on error
+*/
+LOADER_API void *loader_dispatch_invoke(const loader_naming_tag tag, function func, void *args[], size_t size);
+
+/**
+*  @brief
+*    Execute every call queued on the router of @tag in one sweep,
+*    must be invoked from the owner thread
+*
+*  @param[in] tag
+*    Extension of the loader the router belongs to
+*
+*  @return
+*    Number of calls executed
+*/
+LOADER_API size_t loader_dispatch_drain(const loader_naming_tag tag);
+
+/**
+*  @brief
+*    Destroy every registered router
+*/
+LOADER_API void loader_dispatch_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOADER_DISPATCH_H */
@@ -0,0 +1,74 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A library for loading executable code at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef LOADER_FORK_H
+#define LOADER_FORK_H 1
+
+#include <loader/loader_api.h>
+
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Type Definitions -- */
+
+/* Fork coordination callbacks registered by loader plugins whose
+runtime can survive a fork in place: @prepare quiesces the runtime in
+the parent before the fork, @parent resumes it in the parent after the
+fork and @child repairs and resumes it in the child (for example
+through uv_loop_fork); they allow the fork detour to keep the warm
+runtime state instead of tearing every loader down and rebooting it */
+
+typedef int (*loader_fork_prepare_cb)(void *data);
+
+typedef int (*loader_fork_parent_cb)(void *data);
+
+typedef int (*loader_fork_child_cb)(void *data);
+
+/* Invoked when the registry transitions from empty to populated, the
+fork layer uses it to install its detours lazily so processes without
+fork participants keep pristine code paths */
+typedef int (*loader_fork_activate_cb)(void);
+
+/* -- Methods -- */
+
+LOADER_API void loader_fork_activation(loader_fork_activate_cb callback);
+
+LOADER_API int loader_fork_register(loader_fork_prepare_cb prepare, loader_fork_parent_cb parent, loader_fork_child_cb child, void *data);
+
+LOADER_API int loader_fork_unregister(void *data);
+
+LOADER_API size_t loader_fork_count(void);
+
+LOADER_API int loader_fork_prepare(void);
+
+LOADER_API int loader_fork_parent(void);
+
+LOADER_API int loader_fork_child(void);
+
+LOADER_API void loader_fork_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOADER_FORK_H */
@@ -26,6 +26,9 @@
 #include <loader/loader_impl_interface.h>
 #include <loader/loader_path.h>
 
+#include <reflect/reflect_function.h>
+#include <reflect/reflect_type_id.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -38,18 +41,34 @@ extern "C" {
 
 LOADER_API int loader_impl_is_initialized(loader_impl impl);
 
+LOADER_API int loader_impl_initialize(loader_impl impl);
+
 LOADER_API loader_impl loader_impl_create(const char *path, const loader_naming_tag tag);
 
 LOADER_API loader_impl_data loader_impl_get(loader_impl impl);
 
 LOADER_API loader_impl_interface loader_impl_symbol(loader_impl impl);
 
+/* Non zero when the loader declares @func safe for concurrent invocation
+from any thread, zero (the default) when calls must be serialized; a null
+@func probes the loader as a whole (e.g. for parallel discovery) */
+LOADER_API int loader_impl_parallel(loader_impl impl, function func);
+
+/* Native callable address of @func when the loader guarantees C ABI
+compatibility for it, null otherwise; only valid until the owning
+handle is cleared or reloaded */
+LOADER_API void *loader_impl_address(loader_impl impl, function func);
+
 LOADER_API loader_naming_tag *loader_impl_tag(loader_impl impl);
 
 LOADER_API context loader_impl_context(loader_impl impl);
 
 LOADER_API type loader_impl_type(loader_impl impl, const char *name);
 
+/* Resolve the canonical runtime type of builtin type id @id by array
+indexing, the name keyed hash path is only needed for dynamic types */
+LOADER_API type loader_impl_type_builtin(loader_impl impl, type_id id);
+
 LOADER_API int loader_impl_type_define(loader_impl impl, const char *name, type t);
 
 LOADER_API int loader_impl_execution_path(loader_impl impl, const loader_naming_path path);
@@ -70,10 +89,21 @@ LOADER_API const char *loader_impl_handle_id(void *handle);
 
 LOADER_API value loader_impl_handle_export(void *handle);
 
+LOADER_API value loader_impl_handle_discovery(void *handle);
+
+LOADER_API value loader_impl_handle_get(void *handle, const char *name);
+
 LOADER_API context loader_impl_handle_context(void *handle);
 
 LOADER_API value loader_impl_metadata(loader_impl impl);
 
+/* Like loader_impl_metadata but restricted to the handle named
+@handle_name (NULL for all handles) and to the scope objects whose
+name starts with @name_prefix (NULL for all of them) */
+LOADER_API value loader_impl_metadata_filter(loader_impl impl, const char *handle_name, const char *name_prefix);
+
+LOADER_API int loader_impl_handle_reload(void *handle);
+
 LOADER_API int loader_impl_clear(void *handle);
 
 LOADER_API void loader_impl_destroy_objects(loader_impl impl);
@@ -82,6 +112,204 @@ LOADER_API void loader_impl_destroy(loader_impl impl);
 
 LOADER_API loader_impl loader_impl_create_proxy(void);
 
+/* -- Conversion Registry -- */
+
+/**
+*  @brief
+*    Direct converter callback between a pair of loaders, it receives
+*    the native representation of a value in the source runtime and
+*    returns the native representation in the destination runtime,
+*    bypassing the boxed value intermediate
+*
+*  @param[in] native
+*    Native representation of the value in the source runtime
+*
+*  @param[in] context
+*    Context registered along with the converter
+*
+*  @return
+*    Native representation in the destination runtime, null on error
+*/
+typedef void *(*loader_impl_converter)(void *native, void *context);
+
+/**
+*  @brief
+*    Register a direct converter for values of type @id travelling
+*    from the loader tagged @src to the loader tagged @dst, ports and
+*    loaders negotiate the pairs they support at load time
+*
+*  @param[in] src
+*    Tag of the source loader
+*
+*  @param[in] dst
+*    Tag of the destination loader
+*
+*  @param[in] id
+*    Type id of the values the converter handles
+*
+*  @param[in] converter
+*    Converter callback, a null converter unregisters the entry
+*
+*  @param[in] context
+*    Context passed to the converter on each conversion
+*
+*  @return
+*    Zero if the converter was registered, different from zero otherwise
+*/
+LOADER_API int loader_impl_converter_register(const loader_naming_tag src, const loader_naming_tag dst, type_id id, loader_impl_converter converter, void *context);
+
+/**
+*  @brief
+*    Retrieve the direct converter registered for values of type @id
+*    travelling from the loader tagged @src to the loader tagged @dst
+*
+*  @param[in] src
+*    Tag of the source loader
+*
+*  @param[in] dst
+*    Tag of the destination loader
+*
+*  @param[in] id
+*    Type id of the values to be converted
+*
+*  @param[out] context
+*    Context registered along with the converter
+*
+*  @return
+*    Converter callback, null when the pair did not register one
+*/
+LOADER_API loader_impl_converter loader_impl_converter_get(const loader_naming_tag src, const loader_naming_tag dst, type_id id, void **context);
+
+LOADER_API void loader_impl_converter_registry_destroy(void);
+
+/* -- Profile Warming -- */
+
+/**
+*  @brief
+*    Warm callback fired once per hot function right after discovery,
+*    the loader pre-builds the call-site stubs and conversion caches
+*    it would otherwise populate lazily on the first calls
+*
+*  @param[in] impl
+*    Implementation of the loader the function belongs to
+*
+*  @param[in] func
+*    Function recorded as hot by the profile of a previous run
+*
+*  @param[in] data
+*    Data registered along with the callback
+*/
+typedef void (*loader_impl_profile_warm_cb)(loader_impl impl, function func, void *data);
+
+/**
+*  @brief
+*    Register the warm callback of @impl, invoked during discovery
+*    for every function the persisted profile recorded as hot
+*
+*  @param[in] impl
+*    Implementation of the loader to be warmed
+*
+*  @param[in] warm
+*    Warm callback, a null callback unregisters it
+*
+*  @param[in] data
+*    Data passed to the callback on each warm
+*
+*  @return
+*    Zero if the callback was registered, different from zero otherwise
+*/
+LOADER_API int loader_impl_profile_register(loader_impl impl, loader_impl_profile_warm_cb warm, void *data);
+
+/* -- Garbage Collection Coordination -- */
+
+/**
+*  @brief
+*    Snapshot of the garbage collector of a runtime, filled by
+*    @loader_impl_gc_stats with whatever the runtime can report;
+*    fields the runtime cannot measure stay zero
+*/
+struct loader_impl_gc_stats_type
+{
+	size_t heap_size;		 /* Bytes (or runtime blocks) currently held by the managed heap */
+	size_t collection_count; /* Collections run since the loader initialized */
+};
+
+/**
+*  @brief
+*    Trigger a full collection of the runtime of @impl
+*/
+typedef int (*loader_impl_gc_collect_cb)(loader_impl impl, void *data);
+
+/**
+*  @brief
+*    Hint the runtime of @impl to defer (@defer non zero) or resume
+*    (@defer zero) automatic collections; deferring never forbids a
+*    collection, the runtime may still collect under memory pressure
+*/
+typedef int (*loader_impl_gc_hint_cb)(loader_impl impl, int defer, void *data);
+
+/**
+*  @brief
+*    Fill @stats with the current collector counters of @impl
+*/
+typedef int (*loader_impl_gc_stats_cb)(loader_impl impl, struct loader_impl_gc_stats_type *stats, void *data);
+
+/**
+*  @brief
+*    Register the garbage collection callbacks of @impl, loaders call
+*    this during initialize mapping each callback to the native
+*    mechanism of their runtime; null callbacks mean unsupported and
+*    the corresponding operation reports failure for this loader
+*
+*  @param[in] impl
+*    Implementation of the loader
+*
+*  @param[in] collect
+*    Explicit collection trigger
+*
+*  @param[in] hint
+*    Defer / resume hint
+*
+*  @param[in] stats
+*    Collector counters query
+*
+*  @param[in] data
+*    Data passed to every callback
+*
+*  @return
+*    Zero if the callbacks were registered, different from zero otherwise
+*/
+LOADER_API int loader_impl_gc_register(loader_impl impl, loader_impl_gc_collect_cb collect, loader_impl_gc_hint_cb hint, loader_impl_gc_stats_cb stats, void *data);
+
+/**
+*  @brief
+*    Run a full collection on the runtime of @impl
+*
+*  @return
+*    Zero on success, different from zero when the loader does not
+*    support explicit collection or the collection failed
+*/
+LOADER_API int loader_impl_gc_collect(loader_impl impl);
+
+/**
+*  @brief
+*    Forward the defer (@defer non zero) or resume hint to the
+*    runtime of @impl
+*
+*  @return
+*    Zero on success, different from zero when unsupported
+*/
+LOADER_API int loader_impl_gc_hint(loader_impl impl, int defer);
+
+/**
+*  @brief
+*    Fill @stats with the collector counters of the runtime of @impl
+*
+*  @return
+*    Zero on success, different from zero when unsupported
+*/
+LOADER_API int loader_impl_gc_stats(loader_impl impl, struct loader_impl_gc_stats_type *stats);
+
 #ifdef __cplusplus
 }
 #endif
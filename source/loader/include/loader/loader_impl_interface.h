@@ -28,6 +28,7 @@
 #include <loader/loader_naming.h>
 
 #include <reflect/reflect_context.h>
+#include <reflect/reflect_function.h>
 
 #include <configuration/configuration.h>
 
@@ -57,6 +58,10 @@ typedef int (*loader_impl_interface_discover)(loader_impl, loader_handle, contex
 
 typedef int (*loader_impl_interface_destroy)(loader_impl);
 
+typedef int (*loader_impl_interface_parallel)(loader_impl, function);
+
+typedef void *(*loader_impl_interface_address)(loader_impl, function);
+
 typedef struct loader_impl_interface_type
 {
 	loader_impl_interface_initialize initialize;
@@ -68,6 +73,24 @@ typedef struct loader_impl_interface_type
 	loader_impl_interface_discover discover;
 	loader_impl_interface_destroy destroy;
 
+	/* Capability query, appended last so the positional initializers of
+	existing loader plugins keep working (the member zero initializes).
+	A loader returning non zero declares the function safe to invoke from
+	any thread concurrently, letting the call path skip the cross thread
+	dispatch router. NULL or zero means calls must be serialized, which
+	is the right default for runtimes with an event loop or a GIL */
+	loader_impl_interface_parallel parallel;
+
+	/* Raw address query, appended last for the same positional initializer
+	compatibility. A loader owning C ABI compatible functions returns the
+	native callable address of @function here (a pinned JIT symbol, a
+	symbol of a shared object), so embedders can call the target at
+	indirect call cost bypassing the invoke marshaling; the address is
+	only stable until the owning handle is cleared or reloaded, callers
+	revalidate against the function generation counter. NULL or a null
+	return means no C ABI guarantee can be made for the function */
+	loader_impl_interface_address address;
+
 } * loader_impl_interface;
 
 typedef loader_impl_interface (*loader_impl_interface_singleton)(void);
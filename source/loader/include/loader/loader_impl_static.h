@@ -0,0 +1,96 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A library for loading executable code at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef LOADER_IMPL_STATIC_H
+#define LOADER_IMPL_STATIC_H 1
+
+/* -- Headers -- */
+
+#include <loader/loader_api.h>
+
+#include <loader/loader_impl_interface.h>
+#include <loader/loader_naming.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Definitions -- */
+
+#define LOADER_IMPL_STATIC_SIZE 0x20
+
+/* -- Macros -- */
+
+/* Registration hook for loaders compiled into the process (monolithic
+builds), expands to a constructor that runs before main so the registry
+is populated by the time the first loader initializes; registered tags
+take precedence over dynlink resolution */
+#if defined(_MSC_VER)
+	#define LOADER_IMPL_STATIC_REGISTER(tag, singleton) \
+		static void loader_impl_static_ctor_##tag(void) \
+		{ \
+			(void)loader_impl_static_register(#tag, singleton); \
+		} \
+		__pragma(section(".CRT$XCU", read)); \
+		__declspec(allocate(".CRT$XCU")) static void (*loader_impl_static_ctor_##tag##_ptr)(void) = &loader_impl_static_ctor_##tag
+#else
+	#define LOADER_IMPL_STATIC_REGISTER(tag, singleton) \
+		__attribute__((constructor)) static void loader_impl_static_ctor_##tag(void) \
+		{ \
+			(void)loader_impl_static_register(#tag, singleton); \
+		}
+#endif
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Register a loader compiled into the process, normally through
+*    the constructor emitted by @LOADER_IMPL_STATIC_REGISTER; runs
+*    before main so it must not depend on any initialized subsystem
+*
+*  @param[in] tag
+*    Extension tag of the loader
+*
+*  @param[in] singleton
+*    Interface singleton of the loader
+*
+*  @return
+*    Zero on success, different from zero when the registry is full
+*/
+LOADER_API int loader_impl_static_register(const loader_naming_tag tag, loader_impl_interface_singleton singleton);
+
+/**
+*  @brief
+*    Resolve the interface singleton of a loader linked in-process
+*
+*  @param[in] tag
+*    Extension tag of the loader
+*
+*  @return
+*    Interface singleton, null when @tag was not compiled in
+*/
+LOADER_API loader_impl_interface_singleton loader_impl_static_get(const loader_naming_tag tag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOADER_IMPL_STATIC_H */
@@ -35,6 +35,10 @@ typedef char loader_naming_path[LOADER_NAMING_PATH_SIZE];
 typedef char loader_naming_name[LOADER_NAMING_NAME_SIZE];
 typedef char loader_naming_tag[LOADER_NAMING_TAG_SIZE];
 
+/* Resolve a file extension to the tag of the loader handling it
+through a perfect hash dispatch table, null when unknown */
+LOADER_API const char *loader_naming_tag_from_extension(const char *extension);
+
 #ifdef __cplusplus
 }
 #endif
@@ -47,8 +47,14 @@ LOADER_API int loader_path_is_absolute(const loader_naming_path path);
 
 LOADER_API size_t loader_path_join(const loader_naming_path left_path, size_t left_path_size, const loader_naming_path right_path, size_t right_path_size, loader_naming_path join_path);
 
+LOADER_API size_t loader_path_join_buffer(const char *left_path, size_t left_path_size, const char *right_path, size_t right_path_size, char *join_path, size_t join_size);
+
 LOADER_API size_t loader_path_canonical(const loader_naming_path path, size_t size, loader_naming_path canonical);
 
+LOADER_API size_t loader_path_canonical_cached(const loader_naming_path path, size_t size, loader_naming_path canonical);
+
+LOADER_API void loader_path_cache_clear(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,104 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A library for loading executable code at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef LOADER_PATH_INDEX_H
+#define LOADER_PATH_INDEX_H 1
+
+#include <loader/loader_api.h>
+
+#include <loader/loader_naming.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Index of the execution path directories, each directory is enumerated
+*  once into a hash of the file names it contains so resolving a script
+*  is a memory lookup instead of a filesystem probe per candidate */
+typedef struct loader_path_index_type *loader_path_index;
+
+/**
+*  @brief
+*    Create an empty execution path index
+*
+*  @return
+*    Pointer to the index on success, null otherwise
+*/
+LOADER_API loader_path_index loader_path_index_create(void);
+
+/**
+*  @brief
+*    Register the directory @path into the index @index, enumerating
+*    its contents; registering an already indexed directory is a no-op
+*
+*  @param[in] index
+*    Pointer to the index
+*
+*  @param[in] path
+*    Path to the directory to be indexed
+*
+*  @return
+*    Zero if the directory was indexed, different from zero otherwise
+*/
+LOADER_API int loader_path_index_register(loader_path_index index, const loader_naming_path path);
+
+/**
+*  @brief
+*    Resolve the file @name against the indexed directories, in the
+*    order they were registered
+*
+*  @param[in] index
+*    Pointer to the index
+*
+*  @param[in] name
+*    File name to be resolved (without directory components)
+*
+*  @param[out] resolved
+*    Absolute path of the file when found
+*
+*  @return
+*    Zero if the file was found, different from zero otherwise
+*/
+LOADER_API int loader_path_index_resolve(loader_path_index index, const loader_naming_path name, loader_naming_path resolved);
+
+/**
+*  @brief
+*    Re-enumerate every indexed directory, picking up files created
+*    after the directories were registered
+*
+*  @param[in] index
+*    Pointer to the index
+*/
+LOADER_API void loader_path_index_refresh(loader_path_index index);
+
+/**
+*  @brief
+*    Destroy the index @index and the cached directory listings
+*
+*  @param[in] index
+*    Pointer to the index
+*/
+LOADER_API void loader_path_index_destroy(loader_path_index index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOADER_PATH_INDEX_H */
@@ -0,0 +1,108 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A library for loading executable code at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef LOADER_PROFILE_H
+#define LOADER_PROFILE_H 1
+
+#include <loader/loader_api.h>
+
+#include <loader/loader_naming.h>
+
+#include <reflect/reflect_scope.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+
+/*
+*	Call profile persisted across restarts. When LOADER_PROFILE_PATH
+*	points to a writable file the runtime enables function stats, and
+*	at shutdown records every (loader tag, function name, arity) whose
+*	call count crossed the hot threshold. The next boot loads the file
+*	before any script does, so discovery can pre-build conversion
+*	plans and call-site stubs for the recorded hot set instead of
+*	paying the gradual warm-up on live traffic.
+*/
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Read LOADER_PROFILE_PATH and load the profile of the previous
+*    run, enabling function stats when profiling is requested; the
+*    profile stays disabled when the variable is unset
+*/
+LOADER_API void loader_profile_initialize(void);
+
+/**
+*  @brief
+*    Check whether profile driven warming is active
+*
+*  @return
+*    Non zero when a profile path has been configured
+*/
+LOADER_API int loader_profile_enabled(void);
+
+/**
+*  @brief
+*    Check whether a previous run recorded the function as hot
+*
+*  @param[in] tag
+*    Extension of the loader the function belongs to
+*
+*  @param[in] name
+*    Name of the function
+*
+*  @param[in] arity
+*    Number of arguments of the function signature
+*
+*  @return
+*    Non zero when the loaded profile records the triple as hot
+*/
+LOADER_API int loader_profile_hot(const loader_naming_tag tag, const char *name, size_t arity);
+
+/**
+*  @brief
+*    Merge the call counts of the functions of @sp into the profile,
+*    invoked when a handle is torn down so the counts of the whole
+*    run are captured
+*
+*  @param[in] tag
+*    Extension of the loader the scope belongs to
+*
+*  @param[in] sp
+*    Scope holding the functions to be recorded
+*/
+LOADER_API void loader_profile_harvest(const loader_naming_tag tag, scope sp);
+
+/**
+*  @brief
+*    Write the merged profile back to LOADER_PROFILE_PATH and release
+*    the in memory table
+*/
+LOADER_API void loader_profile_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOADER_PROFILE_H */
@@ -11,34 +11,62 @@
 #include <metacall/metacall_version.h>
 
 #include <loader/loader.h>
+#include <loader/loader_discovery_cache.h>
 #include <loader/loader_env.h>
+#include <loader/loader_dispatch.h>
+#include <loader/loader_fork.h>
+#include <loader/loader_profile.h>
 
 #include <reflect/reflect_context.h>
 #include <reflect/reflect_scope.h>
 
-#include <adt/adt_set.h>
+#include <adt/adt_hashmap.h>
+#include <adt/adt_string_pool.h>
 #include <adt/adt_vector.h>
 
+#include <filesystem/filesystem_readahead.h>
+
 #include <serial/serial.h>
 
 #include <detour/detour.h>
 
 #include <log/log.h>
 
+#include <memory/memory.h>
+
+#include <portability/portability_probe.h>
+
+#include <threading/threading_atomic.h>
+#include <threading/threading_mutex.h>
 #include <threading/threading_thread_id.h>
 
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#include <windows.h>
+#else
+	#include <pthread.h>
+#endif
+
+/* -- Definitions -- */
+
+#define LOADER_CALL_ALLOCATOR_BLOCK_SIZE ((size_t)0x1000)
+
+#define LOADER_TAG_REGISTRY_SIZE ((size_t)0x20)
+
 /* -- Forward Declarations -- */
 
 struct loader_initialization_order_type;
 
 struct loader_get_iterator_args_type;
 
-struct loader_host_invoke_type;
+struct loader_address_iterator_args_type;
 
-struct loader_metadata_cb_iterator_type;
+struct loader_host_invoke_type;
 
 /* -- Type Definitions -- */
 
@@ -46,9 +74,9 @@ typedef struct loader_initialization_order_type *loader_initialization_order;
 
 typedef struct loader_get_iterator_args_type *loader_get_iterator_args;
 
-typedef struct loader_host_invoke_type *loader_host_invoke;
+typedef struct loader_address_iterator_args_type *loader_address_iterator_args;
 
-typedef struct loader_metadata_cb_iterator_type *loader_metadata_cb_iterator;
+typedef struct loader_host_invoke_type *loader_host_invoke;
 
 /* -- Member Data -- */
 
@@ -62,15 +90,93 @@ struct loader_initialization_order_type
 struct loader_type
 {
 	loader_impl proxy;			 /* Points to the internal proxy loader */
-	set impl_map;				 /* Maps the loader implementations by tag */
+	hashmap impl_map;				 /* Maps the loader implementations by tag */
 	vector initialization_order; /* Stores the loader implementations by order of initialization (used for destruction) */
 	uint64_t init_thread_id;	 /* Stores the thread id of the thread that initialized metacall */
+	value metadata_cache;		 /* Caches the metadata tree served by loader_metadata_cached */
+	memory_allocator call_allocator; /* Arena reused by the call path for per call temporaries */
+	threading_mutex mutex;			 /* Guards impl_map and initialization_order during parallel initialization */
+	struct loader_preload_type *preload; /* In flight background warm up, joined on await or unload */
 };
 
-struct loader_metadata_cb_iterator_type
+/* Tags form a tiny closed set known at build time, so instead of
+hashing the tag characters on every lookup each tag is assigned a
+small stable id on first sight and the implementations are published
+into a direct indexed table; readers resolve with one acquire load per
+slot, wait free. The ids survive unload, only the slots are cleared */
+struct loader_tag_registry_type
 {
-	size_t iterator;
-	value *values;
+	loader_naming_tag tags[LOADER_TAG_REGISTRY_SIZE]; /* Append only, indexed by id */
+	void *impls[LOADER_TAG_REGISTRY_SIZE];			  /* Published with release stores */
+	size_t size;									  /* Read with acquire, written under the loader mutex */
+};
+
+struct loader_initialize_parallel_thread_type
+{
+	const char *tag;
+	int result;
+#if defined(_WIN32)
+	HANDLE thread;
+#else
+	pthread_t thread;
+#endif
+};
+
+struct loader_preload_type
+{
+	char **tags; /* Owned copy, the caller array may not outlive the warm up */
+	size_t size;
+	int result;
+#if defined(_WIN32)
+	HANDLE thread;
+#else
+	pthread_t thread;
+#endif
+};
+
+/* One file of a bulk load fanned out on its own thread, the loader
+declared that its discovery tolerates concurrency */
+struct loader_bulk_file_type
+{
+	const char *tag;
+	const loader_naming_path *path;
+	void **handle;
+	int result;
+#if defined(_WIN32)
+	HANDLE thread;
+#else
+	pthread_t thread;
+#endif
+};
+
+/* All the files of a bulk load that share one loader, processed by a
+single worker so independent runtimes overlap their discovery */
+struct loader_bulk_group_type
+{
+	const char *tag;
+	const loader_naming_path *paths; /* Caller array, indexed through entries */
+	void **handles;					 /* Caller array, may be null */
+	size_t *entries;				 /* Indices of this group within the caller arrays */
+	size_t count;
+	int result;
+#if defined(_WIN32)
+	HANDLE thread;
+#else
+	pthread_t thread;
+#endif
+};
+
+/* Background load task, owns copies of the inputs since the caller
+buffers may not outlive the load */
+struct loader_load_await_type
+{
+	loader_naming_tag tag;
+	loader_naming_path *paths; /* Set for the file variant */
+	char *buffer;			   /* Set for the memory variant */
+	size_t size;
+	loader_await_resolve_callback resolve;
+	loader_await_reject_callback reject;
+	void *data;
 };
 
 struct loader_get_iterator_args_type
@@ -79,6 +185,12 @@ struct loader_get_iterator_args_type
 	value obj; // scope_object
 };
 
+struct loader_address_iterator_args_type
+{
+	function func;
+	void *address;
+};
+
 struct loader_host_invoke_type
 {
 	loader_register_invoke invoke;
@@ -98,20 +210,54 @@ static void loader_register_destroy_proxy(function func, function_impl func_impl
 
 static loader_impl loader_create_impl(const loader_naming_tag tag);
 
-static int loader_get_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args);
+static int loader_get_cb_iterate(hashmap s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args);
 
 static value loader_metadata_impl(loader_impl impl);
 
-static int loader_metadata_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args);
+static value loader_metadata_impl_filter(loader_impl impl, const char *handle_name, const char *name_prefix);
+
+static void loader_lock(loader l);
+
+static void loader_unlock(loader l);
+
+static size_t loader_tag_id_locked(const loader_naming_tag tag);
+
+static void loader_tag_publish(const loader_naming_tag tag, loader_impl impl);
+
+static void loader_tag_registry_clear(void);
+
+#if defined(_WIN32)
+static DWORD WINAPI loader_initialize_parallel_thread(LPVOID data);
+
+static DWORD WINAPI loader_preload_thread(LPVOID data);
+#else
+static void *loader_initialize_parallel_thread(void *data);
+
+static void *loader_preload_thread(void *data);
+#endif
+
+static void loader_preload_destroy(struct loader_preload_type *preload);
+
+#if defined(_WIN32)
+static DWORD WINAPI loader_load_await_thread(LPVOID data);
+#else
+static void *loader_load_await_thread(void *data);
+#endif
+
+static int loader_load_await_schedule(struct loader_load_await_type *task);
+
+static void loader_load_await_destroy(struct loader_load_await_type *task);
 
 /* -- Member Data -- */
 
 static struct loader_type loader_instance_default = {
-	NULL, NULL, NULL, THREAD_ID_INVALID
+	NULL, NULL, NULL, THREAD_ID_INVALID, NULL, NULL, NULL, NULL
 };
 
 static loader loader_instance_ptr = &loader_instance_default;
 
+static struct loader_tag_registry_type loader_tag_registry = { { { 0 } }, { NULL }, 0 };
+
 /* -- Methods -- */
 
 loader loader_singleton()
@@ -131,21 +277,52 @@ void loader_initialization_register(loader_impl impl)
 		initialization_order.impl = impl;
 		initialization_order.being_deleted = 1;
 
+		loader_lock(l);
+
 		vector_push_back(l->initialization_order, &initialization_order);
+
+		loader_unlock(l);
+	}
+}
+
+void loader_initialization_adopt()
+{
+	loader l = loader_singleton();
+
+	uint64_t current = thread_id_get_current();
+
+	if (l->initialization_order != NULL)
+	{
+		size_t iterator, size;
+
+		loader_lock(l);
+
+		size = vector_size(l->initialization_order);
+
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			loader_initialization_order order = vector_at(l->initialization_order, iterator);
+
+			order->id = current;
+		}
+
+		loader_unlock(l);
 	}
+
+	l->init_thread_id = current;
 }
 
 void loader_initialize_proxy()
 {
 	loader l = loader_singleton();
 
-	if (set_get(l->impl_map, (set_key)LOADER_HOST_PROXY_NAME) == NULL)
+	if (hashmap_get(l->impl_map, (hashmap_key)string_intern(LOADER_HOST_PROXY_NAME)) == NULL)
 	{
 		l->proxy = loader_impl_create_proxy();
 
 		if (l->proxy != NULL)
 		{
-			if (set_insert(l->impl_map, (set_key)loader_impl_tag(l->proxy), l->proxy) != 0)
+			if (hashmap_insert(l->impl_map, (hashmap_key)string_intern((const char *)loader_impl_tag(l->proxy)), l->proxy) != 0)
 			{
 				log_write("metacall", LOG_LEVEL_ERROR, "Loader invalid proxy insertion <%p>", (void *)l->proxy);
 
@@ -155,6 +332,12 @@ void loader_initialize_proxy()
 			/* Insert into destruction list */
 			loader_initialization_register(l->proxy);
 
+			loader_lock(l);
+
+			loader_tag_publish((const char *)loader_impl_tag(l->proxy), l->proxy);
+
+			loader_unlock(l);
+
 			log_write("metacall", LOG_LEVEL_DEBUG, "Loader proxy initialized");
 		}
 		else
@@ -171,16 +354,28 @@ void loader_initialize()
 	/* Initialize environment variables */
 	loader_env_initialize();
 
+	/* Load the call profile of the previous run so discovery can warm
+	the recorded hot set */
+	loader_profile_initialize();
+
 	/* Initialize current thread id */
 	if (l->init_thread_id == THREAD_ID_INVALID)
 	{
 		l->init_thread_id = thread_id_get_current();
 	}
 
+	/* Initialize the mutex protecting the shared loader state */
+	if (l->mutex == NULL)
+	{
+		l->mutex = threading_mutex_create();
+	}
+
 	/* Initialize implementation map */
 	if (l->impl_map == NULL)
 	{
-		l->impl_map = set_create(&hash_callback_str, &comparable_callback_str);
+		/* Tags are interned so the map hashes and compares the
+		canonical pointers instead of the tag characters */
+		l->impl_map = hashmap_create(&hash_callback_ptr, &comparable_callback_ptr);
 	}
 
 	/* Initialize implementation vector */
@@ -197,7 +392,16 @@ int loader_is_initialized(const loader_naming_tag tag)
 {
 	loader l = loader_singleton();
 
-	loader_impl impl = (loader_impl)set_get(l->impl_map, (const set_key)tag);
+	loader_impl impl = loader_get_impl_id(loader_tag_id(tag));
+
+	if (impl == NULL)
+	{
+		loader_lock(l);
+
+		impl = (loader_impl)hashmap_get(l->impl_map, (hashmap_key)string_intern(tag));
+
+		loader_unlock(l);
+	}
 
 	if (impl == NULL)
 	{
@@ -213,7 +417,41 @@ function_return loader_register_invoke_proxy(function func, function_impl func_i
 
 	void *data = function_closure(func);
 
-	return host_invoke->invoke(size, args, data);
+	function_return ret;
+
+	/* Scope the arena to the call, every temporary taken from it
+	during the invocation is given back wholesale on return */
+	memory_allocator allocator = loader_call_allocator_acquire();
+
+	PORTABILITY_PROBE_2(loader_invoke_proxy_begin, function_name(func), size);
+
+	ret = host_invoke->invoke(size, args, data);
+
+	PORTABILITY_PROBE_2(loader_invoke_proxy_end, function_name(func), ret);
+
+	loader_call_allocator_release(allocator);
+
+	return ret;
+}
+
+memory_allocator loader_call_allocator_acquire()
+{
+	loader l = loader_singleton();
+
+	if (l->call_allocator == NULL)
+	{
+		l->call_allocator = memory_allocator_arena(LOADER_CALL_ALLOCATOR_BLOCK_SIZE);
+	}
+
+	return l->call_allocator;
+}
+
+void loader_call_allocator_release(memory_allocator allocator)
+{
+	if (allocator != NULL)
+	{
+		memory_allocator_arena_reset(allocator);
+	}
 }
 
 function_return loader_register_await_proxy(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
@@ -247,19 +485,41 @@ function_interface loader_register_interface_proxy(void)
 		NULL,
 		&loader_register_invoke_proxy,
 		&loader_register_await_proxy,
-		&loader_register_destroy_proxy
+		&loader_register_destroy_proxy,
+		NULL
 	};
 
 	return &interface;
 }
 
+loader_register_invoke loader_register_function_invoke(function func, void **closure)
+{
+	/* Only functions created through loader_register carry the proxy
+	interface, anything else must go through the regular call path */
+	if (func == NULL || function_interface_get(func) != loader_register_interface_proxy())
+	{
+		return NULL;
+	}
+
+	if (closure != NULL)
+	{
+		*closure = function_closure(func);
+	}
+
+	return ((loader_host_invoke)function_impl_get(func))->invoke;
+}
+
 int loader_register(const char *name, loader_register_invoke invoke, function *func, type_id return_type, size_t arg_size, type_id args_type_id[])
 {
 	static const char register_holder_str[] = "__metacall_register__";
 
+	/* A full size tag buffer, passing the short literal into the
+	array typed parameter trips -Wstringop-overread */
+	static const loader_naming_tag host_proxy_tag = LOADER_HOST_PROXY_NAME;
+
 	function f = NULL;
 
-	loader_impl loader = loader_get_impl(LOADER_HOST_PROXY_NAME);
+	loader_impl loader = loader_get_impl(host_proxy_tag);
 
 	context ctx = loader_impl_context(loader);
 
@@ -297,6 +557,8 @@ int loader_register(const char *name, loader_register_invoke invoke, function *f
 	if (name != NULL)
 	{
 		scope_define(sp, name, value_create_function(f));
+
+		loader_metadata_invalidate();
 	}
 
 	if (func != NULL)
@@ -311,12 +573,32 @@ loader_impl loader_create_impl(const loader_naming_tag tag)
 {
 	loader l = loader_singleton();
 
+	/* The plugin load is done outside of the lock so slow dynlink
+	resolution of independent loaders can overlap, the map is
+	re-checked under the lock in case another thread won the race */
 	loader_impl impl = loader_impl_create(loader_env_library_path(), tag);
 
 	if (impl != NULL)
 	{
-		if (set_insert(l->impl_map, (set_key)loader_impl_tag(impl), impl) != 0)
+		loader_impl existing;
+
+		loader_lock(l);
+
+		existing = (loader_impl)hashmap_get(l->impl_map, (hashmap_key)string_intern(tag));
+
+		if (existing != NULL)
+		{
+			loader_unlock(l);
+
+			loader_impl_destroy(impl);
+
+			return existing;
+		}
+
+		if (hashmap_insert(l->impl_map, (hashmap_key)string_intern((const char *)loader_impl_tag(impl)), impl) != 0)
 		{
+			loader_unlock(l);
+
 			log_write("metacall", LOG_LEVEL_ERROR, "Loader implementation insertion error (%s)", tag);
 
 			loader_impl_destroy(impl);
@@ -324,6 +606,10 @@ loader_impl loader_create_impl(const loader_naming_tag tag)
 			return NULL;
 		}
 
+		loader_tag_publish((const char *)loader_impl_tag(impl), impl);
+
+		loader_unlock(l);
+
 		return impl;
 	}
 
@@ -334,7 +620,20 @@ loader_impl loader_get_impl(const loader_naming_tag tag)
 {
 	loader l = loader_singleton();
 
-	loader_impl impl = (loader_impl)set_get(l->impl_map, (const set_key)tag);
+	/* Wait free fast path, the tag resolves to its registry id
+	without hashing and the implementation is one acquire load away */
+	loader_impl impl = loader_get_impl_id(loader_tag_id(tag));
+
+	if (impl != NULL)
+	{
+		return impl;
+	}
+
+	loader_lock(l);
+
+	impl = (loader_impl)hashmap_get(l->impl_map, (hashmap_key)string_intern(tag));
+
+	loader_unlock(l);
 
 	if (impl == NULL)
 	{
@@ -346,111 +645,962 @@ loader_impl loader_get_impl(const loader_naming_tag tag)
 	return impl;
 }
 
-int loader_load_path(const loader_naming_path path)
+void loader_lock(loader l)
 {
-	loader l = loader_singleton();
-
-	loader_initialize();
-
-	if (l->impl_map != NULL)
+	if (l->mutex != NULL)
 	{
-		(void)path;
-
-		/* ... */
+		threading_mutex_lock(l->mutex);
 	}
-
-	return 1;
 }
 
-int loader_execution_path(const loader_naming_tag tag, const loader_naming_path path)
+void loader_unlock(loader l)
 {
-	loader l = loader_singleton();
-
-	loader_initialize();
-
-	if (l->impl_map != NULL)
+	if (l->mutex != NULL)
 	{
-		/* If loader is initialized, load the execution path */
-		loader_impl impl = loader_get_impl(tag);
+		threading_mutex_unlock(l->mutex);
+	}
+}
 
-		log_write("metacall", LOG_LEVEL_DEBUG, "Loader (%s) implementation <%p>", tag, (void *)impl);
+size_t loader_tag_id_locked(const loader_naming_tag tag)
+{
+	/* Must be called with the mutex held, the scan below and the
+	append are consistent only against concurrent registrations */
+	size_t iterator, size = loader_tag_registry.size;
 
-		if (impl == NULL)
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		if (strcmp(loader_tag_registry.tags[iterator], tag) == 0)
 		{
-			return 1;
+			return iterator;
 		}
+	}
 
-		return loader_impl_execution_path(impl, path);
+	if (size == LOADER_TAG_REGISTRY_SIZE)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Loader tag registry exhausted registering (%s)", tag);
+
+		return LOADER_TAG_INVALID;
 	}
 
-	return 1;
+	strncpy(loader_tag_registry.tags[size], tag, LOADER_NAMING_TAG_SIZE - 1);
+
+	loader_tag_registry.tags[size][LOADER_NAMING_TAG_SIZE - 1] = '\0';
+
+	/* The release store makes the tag characters visible before the
+	new size, so lock free readers never scan an unwritten entry */
+	threading_atomic_store(&loader_tag_registry.size, size + 1);
+
+	return size;
 }
 
-int loader_load_from_file(const loader_naming_tag tag, const loader_naming_path paths[], size_t size, void **handle)
+size_t loader_tag_id(const loader_naming_tag tag)
 {
 	loader l = loader_singleton();
 
-	loader_initialize();
+	size_t iterator, size = threading_atomic_load(&loader_tag_registry.size);
 
-	if (l->impl_map != NULL)
+	/* The registry is append only so the lock free scan can miss at
+	most the tags registered concurrently, handled under the lock */
+	for (iterator = 0; iterator < size; ++iterator)
 	{
-		if (tag != NULL)
+		if (strcmp(loader_tag_registry.tags[iterator], tag) == 0)
 		{
-			loader_impl impl = loader_get_impl(tag);
+			return iterator;
+		}
+	}
 
-			log_write("metacall", LOG_LEVEL_DEBUG, "Loader (%s) implementation <%p>", tag, (void *)impl);
+	loader_lock(l);
 
-			if (impl != NULL)
-			{
-				return loader_impl_load_from_file(impl, paths, size, handle);
-			}
-		}
+	iterator = loader_tag_id_locked(tag);
+
+	loader_unlock(l);
+
+	return iterator;
+}
+
+loader_impl loader_get_impl_id(size_t id)
+{
+	if (id >= LOADER_TAG_REGISTRY_SIZE)
+	{
+		return NULL;
 	}
 
-	return 1;
+	return (loader_impl)threading_atomic_load(&loader_tag_registry.impls[id]);
 }
 
-int loader_load_from_memory(const loader_naming_tag tag, const char *buffer, size_t size, void **handle)
+void loader_tag_publish(const loader_naming_tag tag, loader_impl impl)
 {
-	loader l = loader_singleton();
+	/* Must be called with the mutex held */
+	size_t id = loader_tag_id_locked(tag);
 
-	loader_initialize();
+	if (id != LOADER_TAG_INVALID)
+	{
+		threading_atomic_store(&loader_tag_registry.impls[id], (void *)impl);
+	}
+}
 
-	if (l->impl_map != NULL)
+void loader_tag_registry_clear()
+{
+	/* The tags and their ids survive the unload, only the published
+	implementations are withdrawn so no reader can reach a dead one */
+	size_t iterator;
+
+	for (iterator = 0; iterator < LOADER_TAG_REGISTRY_SIZE; ++iterator)
 	{
-		loader_impl impl = loader_get_impl(tag);
+		threading_atomic_store(&loader_tag_registry.impls[iterator], (void *)NULL);
+	}
+}
 
-		log_write("metacall", LOG_LEVEL_DEBUG, "Loader (%s) implementation <%p>", tag, (void *)impl);
+#if defined(_WIN32)
+DWORD WINAPI loader_initialize_parallel_thread(LPVOID data)
+#else
+void *loader_initialize_parallel_thread(void *data)
+#endif
+{
+	struct loader_initialize_parallel_thread_type *parallel = data;
 
-		if (impl == NULL)
-		{
-			return 1;
-		}
+	loader_impl impl = loader_get_impl(parallel->tag);
+
+	if (impl == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid loader (%s) parallel creation", parallel->tag);
 
-		return loader_impl_load_from_memory(impl, buffer, size, handle);
+		parallel->result = 1;
+	}
+	else
+	{
+		parallel->result = loader_impl_initialize(impl);
 	}
 
-	return 1;
+#if defined(_WIN32)
+	return 0;
+#else
+	return NULL;
+#endif
 }
 
-int loader_load_from_package(const loader_naming_tag extension, const loader_naming_path path, void **handle)
+int loader_initialize_parallel(const char *tags[], size_t size)
 {
-	loader l = loader_singleton();
+	struct loader_initialize_parallel_thread_type *parallel_list;
+
+	size_t iterator;
+
+	int result = 0;
 
 	loader_initialize();
 
-	if (l->impl_map != NULL)
+	if (tags == NULL || size == 0)
 	{
-		loader_impl impl = loader_get_impl(extension);
+		return 0;
+	}
 
-		log_write("metacall", LOG_LEVEL_DEBUG, "Loader (%s) implementation <%p>", extension, (void *)impl);
+	parallel_list = malloc(sizeof(struct loader_initialize_parallel_thread_type) * size);
+
+	if (parallel_list == NULL)
+	{
+		return 1;
+	}
+
+	/* One thread per tag, each one loads the plugin and forces the
+	runtime startup that is otherwise deferred until the first load;
+	tags in a single call must be independent, dependent runtimes
+	belong in a later sequential call once this one has joined */
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		parallel_list[iterator].tag = tags[iterator];
+		parallel_list[iterator].result = 1;
+
+#if defined(_WIN32)
+		parallel_list[iterator].thread = CreateThread(NULL, 0, &loader_initialize_parallel_thread, &parallel_list[iterator], 0, NULL);
+
+		if (parallel_list[iterator].thread == NULL)
+		{
+			loader_initialize_parallel_thread(&parallel_list[iterator]);
+		}
+#else
+		if (pthread_create(&parallel_list[iterator].thread, NULL, &loader_initialize_parallel_thread, &parallel_list[iterator]) != 0)
+		{
+			/* Fall back to initializing on the calling thread */
+			parallel_list[iterator].thread = pthread_self();
+
+			loader_initialize_parallel_thread(&parallel_list[iterator]);
+		}
+#endif
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+#if defined(_WIN32)
+		if (parallel_list[iterator].thread != NULL)
+		{
+			WaitForSingleObject(parallel_list[iterator].thread, INFINITE);
+
+			CloseHandle(parallel_list[iterator].thread);
+		}
+#else
+		if (pthread_equal(parallel_list[iterator].thread, pthread_self()) == 0)
+		{
+			pthread_join(parallel_list[iterator].thread, NULL);
+		}
+#endif
+
+		result |= parallel_list[iterator].result;
+	}
+
+	free(parallel_list);
+
+	return result;
+}
+
+#if defined(_WIN32)
+DWORD WINAPI loader_preload_thread(LPVOID data)
+#else
+void *loader_preload_thread(void *data)
+#endif
+{
+	struct loader_preload_type *preload = data;
+
+	preload->result = loader_initialize_parallel((const char **)preload->tags, preload->size);
+
+#if defined(_WIN32)
+	return 0;
+#else
+	return NULL;
+#endif
+}
+
+void loader_preload_destroy(struct loader_preload_type *preload)
+{
+	size_t iterator;
+
+	for (iterator = 0; iterator < preload->size; ++iterator)
+	{
+		free(preload->tags[iterator]);
+	}
+
+	free(preload->tags);
+
+	free(preload);
+}
+
+int loader_preload(const char *tags[], size_t size)
+{
+	loader l = loader_singleton();
+
+	struct loader_preload_type *preload;
+
+	size_t iterator;
+
+	loader_initialize();
+
+	if (tags == NULL || size == 0)
+	{
+		return 0;
+	}
+
+	/* Only one warm up may be in flight, chaining a second one waits
+	for the previous batch so the threads never overlap */
+	if (l->preload != NULL && loader_preload_await() != 0)
+	{
+		return 1;
+	}
+
+	preload = malloc(sizeof(struct loader_preload_type));
+
+	if (preload == NULL)
+	{
+		return 1;
+	}
+
+	preload->tags = malloc(sizeof(char *) * size);
+
+	if (preload->tags == NULL)
+	{
+		free(preload);
+
+		return 1;
+	}
+
+	preload->size = size;
+	preload->result = 1;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		size_t length = strlen(tags[iterator]) + 1;
+
+		preload->tags[iterator] = malloc(sizeof(char) * length);
+
+		if (preload->tags[iterator] == NULL)
+		{
+			preload->size = iterator;
+
+			loader_preload_destroy(preload);
+
+			return 1;
+		}
+
+		memcpy(preload->tags[iterator], tags[iterator], length);
+	}
+
+#if defined(_WIN32)
+	preload->thread = CreateThread(NULL, 0, &loader_preload_thread, preload, 0, NULL);
+
+	if (preload->thread == NULL)
+	{
+		loader_preload_destroy(preload);
+
+		return 1;
+	}
+#else
+	if (pthread_create(&preload->thread, NULL, &loader_preload_thread, preload) != 0)
+	{
+		loader_preload_destroy(preload);
+
+		return 1;
+	}
+#endif
+
+	l->preload = preload;
+
+	return 0;
+}
+
+int loader_preload_await(void)
+{
+	loader l = loader_singleton();
+
+	struct loader_preload_type *preload = l->preload;
+
+	int result;
+
+	if (preload == NULL)
+	{
+		return 0;
+	}
+
+#if defined(_WIN32)
+	WaitForSingleObject(preload->thread, INFINITE);
+
+	CloseHandle(preload->thread);
+#else
+	pthread_join(preload->thread, NULL);
+#endif
+
+	result = preload->result;
+
+	l->preload = NULL;
+
+	loader_preload_destroy(preload);
+
+	return result;
+}
+
+#if defined(_WIN32)
+DWORD WINAPI loader_bulk_file_thread(LPVOID data)
+#else
+void *loader_bulk_file_thread(void *data)
+#endif
+{
+	struct loader_bulk_file_type *file = data;
+
+	file->result = loader_load_from_file(file->tag, file->path, 1, file->handle);
+
+#if defined(_WIN32)
+	return 0;
+#else
+	return NULL;
+#endif
+}
+
+#if defined(_WIN32)
+DWORD WINAPI loader_bulk_group_thread(LPVOID data)
+#else
+void *loader_bulk_group_thread(void *data)
+#endif
+{
+	struct loader_bulk_group_type *group = data;
+
+	loader_impl impl;
+
+	size_t iterator = 1;
+
+	/* The first file runs alone, it pays the (possibly first) runtime
+	initialization and lets the loader implementation come up before
+	its parallelism capability is probed */
+	group->result = loader_load_from_file(group->tag, &group->paths[group->entries[0]], 1,
+		group->handles != NULL ? &group->handles[group->entries[0]] : NULL);
+
+	impl = loader_get_impl_id(loader_tag_id(group->tag));
+
+	if (iterator < group->count && impl != NULL && loader_impl_parallel(impl, NULL) != 0)
+	{
+		/* The loader declared thread safe discovery, fan the remaining
+		files out on their own threads and join the whole batch */
+		struct loader_bulk_file_type *files = malloc(sizeof(struct loader_bulk_file_type) * (group->count - 1));
+
+		if (files != NULL)
+		{
+			size_t file_count = 0, file_iterator;
+
+			for (; iterator < group->count; ++iterator)
+			{
+				struct loader_bulk_file_type *file = &files[file_count++];
+
+				file->tag = group->tag;
+				file->path = &group->paths[group->entries[iterator]];
+				file->handle = group->handles != NULL ? &group->handles[group->entries[iterator]] : NULL;
+				file->result = 1;
+
+#if defined(_WIN32)
+				file->thread = CreateThread(NULL, 0, &loader_bulk_file_thread, file, 0, NULL);
+
+				if (file->thread == NULL)
+				{
+					loader_bulk_file_thread(file);
+				}
+#else
+				if (pthread_create(&file->thread, NULL, &loader_bulk_file_thread, file) != 0)
+				{
+					/* Fall back to loading on the worker thread */
+					file->thread = pthread_self();
+
+					loader_bulk_file_thread(file);
+				}
+#endif
+			}
+
+			for (file_iterator = 0; file_iterator < file_count; ++file_iterator)
+			{
+#if defined(_WIN32)
+				if (files[file_iterator].thread != NULL)
+				{
+					WaitForSingleObject(files[file_iterator].thread, INFINITE);
+
+					CloseHandle(files[file_iterator].thread);
+				}
+#else
+				if (pthread_equal(files[file_iterator].thread, pthread_self()) == 0)
+				{
+					pthread_join(files[file_iterator].thread, NULL);
+				}
+#endif
+
+				group->result |= files[file_iterator].result;
+			}
+
+			free(files);
+		}
+	}
+
+	/* Serialized discovery (or the fan out allocation failed), the
+	remaining files load in order on this worker so the runtime still
+	overlaps with the other groups */
+	for (; iterator < group->count; ++iterator)
+	{
+		group->result |= loader_load_from_file(group->tag, &group->paths[group->entries[iterator]], 1,
+			group->handles != NULL ? &group->handles[group->entries[iterator]] : NULL);
+	}
+
+#if defined(_WIN32)
+	return 0;
+#else
+	return NULL;
+#endif
+}
+
+int loader_load_from_file_bulk(const loader_naming_tag tags[], const loader_naming_path paths[], size_t size, void *handles[])
+{
+	struct loader_bulk_group_type *groups;
+
+	size_t *entries;
+
+	size_t iterator, group_iterator, group_count = 0, offset = 0;
+
+	int result = 0;
+
+	loader_initialize();
+
+	if (tags == NULL || paths == NULL || size == 0)
+	{
+		return 1;
+	}
+
+	groups = malloc(sizeof(struct loader_bulk_group_type) * size);
+
+	entries = malloc(sizeof(size_t) * size);
+
+	if (groups == NULL || entries == NULL)
+	{
+		free(groups);
+
+		free(entries);
+
+		return 1;
+	}
+
+	/* Group the files by tag, the distinct runtimes of a boot are few
+	so the quadratic scan over the group list stays cheap */
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		for (group_iterator = 0; group_iterator < group_count; ++group_iterator)
+		{
+			if (strncmp(groups[group_iterator].tag, tags[iterator], LOADER_NAMING_TAG_SIZE) == 0)
+			{
+				break;
+			}
+		}
+
+		if (group_iterator == group_count)
+		{
+			groups[group_count].tag = tags[iterator];
+			groups[group_count].paths = paths;
+			groups[group_count].handles = handles;
+			groups[group_count].entries = NULL;
+			groups[group_count].count = 0;
+			groups[group_count].result = 1;
+
+			++group_count;
+		}
+
+		++groups[group_iterator].count;
+	}
+
+	/* Carve per group index lists out of the single entries block and
+	refill the counts while distributing the files */
+	for (group_iterator = 0; group_iterator < group_count; ++group_iterator)
+	{
+		groups[group_iterator].entries = &entries[offset];
+
+		offset += groups[group_iterator].count;
+
+		groups[group_iterator].count = 0;
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		for (group_iterator = 0; group_iterator < group_count; ++group_iterator)
+		{
+			if (strncmp(groups[group_iterator].tag, tags[iterator], LOADER_NAMING_TAG_SIZE) == 0)
+			{
+				groups[group_iterator].entries[groups[group_iterator].count++] = iterator;
+
+				break;
+			}
+		}
+	}
+
+	/* One worker per loader, runtimes with serialized discovery (the
+	interpreter lock bound ones) overlap with the parallel capable
+	compilations and the file readahead instead of gating them */
+	for (group_iterator = 0; group_iterator < group_count; ++group_iterator)
+	{
+#if defined(_WIN32)
+		groups[group_iterator].thread = CreateThread(NULL, 0, &loader_bulk_group_thread, &groups[group_iterator], 0, NULL);
+
+		if (groups[group_iterator].thread == NULL)
+		{
+			loader_bulk_group_thread(&groups[group_iterator]);
+		}
+#else
+		if (pthread_create(&groups[group_iterator].thread, NULL, &loader_bulk_group_thread, &groups[group_iterator]) != 0)
+		{
+			/* Fall back to loading on the calling thread */
+			groups[group_iterator].thread = pthread_self();
+
+			loader_bulk_group_thread(&groups[group_iterator]);
+		}
+#endif
+	}
+
+	for (group_iterator = 0; group_iterator < group_count; ++group_iterator)
+	{
+#if defined(_WIN32)
+		if (groups[group_iterator].thread != NULL)
+		{
+			WaitForSingleObject(groups[group_iterator].thread, INFINITE);
+
+			CloseHandle(groups[group_iterator].thread);
+		}
+#else
+		if (pthread_equal(groups[group_iterator].thread, pthread_self()) == 0)
+		{
+			pthread_join(groups[group_iterator].thread, NULL);
+		}
+#endif
+
+		result |= groups[group_iterator].result;
+	}
+
+	free(groups);
+
+	free(entries);
+
+	return result;
+}
+
+#if defined(_WIN32)
+DWORD WINAPI loader_load_await_thread(LPVOID data)
+#else
+void *loader_load_await_thread(void *data)
+#endif
+{
+	struct loader_load_await_type *task = data;
+
+	void *handle = NULL;
+
+	int result;
+
+	if (task->paths != NULL)
+	{
+		result = loader_load_from_file(task->tag, (const loader_naming_path *)task->paths, task->size, &handle);
+	}
+	else
+	{
+		result = loader_load_from_memory(task->tag, task->buffer, task->size, &handle);
+	}
+
+	if (result == 0)
+	{
+		if (task->resolve != NULL)
+		{
+			task->resolve(handle, task->data);
+		}
+	}
+	else
+	{
+		if (task->reject != NULL)
+		{
+			task->reject(NULL, task->data);
+		}
+	}
+
+	loader_load_await_destroy(task);
+
+#if defined(_WIN32)
+	return 0;
+#else
+	return NULL;
+#endif
+}
+
+void loader_load_await_destroy(struct loader_load_await_type *task)
+{
+	if (task->paths != NULL)
+	{
+		free(task->paths);
+	}
+
+	if (task->buffer != NULL)
+	{
+		free(task->buffer);
+	}
+
+	free(task);
+}
+
+int loader_load_await_schedule(struct loader_load_await_type *task)
+{
+#if defined(_WIN32)
+	HANDLE thread = CreateThread(NULL, 0, &loader_load_await_thread, task, 0, NULL);
+
+	if (thread == NULL)
+	{
+		loader_load_await_destroy(task);
+
+		return 1;
+	}
+
+	CloseHandle(thread);
+#else
+	pthread_t thread;
+
+	if (pthread_create(&thread, NULL, &loader_load_await_thread, task) != 0)
+	{
+		loader_load_await_destroy(task);
+
+		return 1;
+	}
+
+	pthread_detach(thread);
+#endif
+
+	return 0;
+}
+
+int loader_load_from_file_await(const loader_naming_tag tag, const loader_naming_path paths[], size_t size, loader_await_resolve_callback resolve, loader_await_reject_callback reject, void *data)
+{
+	struct loader_load_await_type *task;
+
+	size_t iterator;
+
+	if (tag == NULL || paths == NULL || size == 0)
+	{
+		return 1;
+	}
+
+	loader_initialize();
+
+	task = malloc(sizeof(struct loader_load_await_type));
+
+	if (task == NULL)
+	{
+		return 1;
+	}
+
+	strncpy(task->tag, tag, LOADER_NAMING_TAG_SIZE);
+
+	task->paths = malloc(sizeof(loader_naming_path) * size);
+
+	if (task->paths == NULL)
+	{
+		free(task);
+
+		return 1;
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		strncpy(task->paths[iterator], paths[iterator], LOADER_NAMING_PATH_SIZE);
+	}
+
+	task->buffer = NULL;
+	task->size = size;
+	task->resolve = resolve;
+	task->reject = reject;
+	task->data = data;
+
+	return loader_load_await_schedule(task);
+}
+
+int loader_load_from_memory_await(const loader_naming_tag tag, const char *buffer, size_t size, loader_await_resolve_callback resolve, loader_await_reject_callback reject, void *data)
+{
+	struct loader_load_await_type *task;
+
+	if (tag == NULL || buffer == NULL || size == 0)
+	{
+		return 1;
+	}
+
+	loader_initialize();
+
+	task = malloc(sizeof(struct loader_load_await_type));
+
+	if (task == NULL)
+	{
+		return 1;
+	}
+
+	strncpy(task->tag, tag, LOADER_NAMING_TAG_SIZE);
+
+	task->buffer = malloc(size);
+
+	if (task->buffer == NULL)
+	{
+		free(task);
+
+		return 1;
+	}
+
+	memcpy(task->buffer, buffer, size);
+
+	task->paths = NULL;
+	task->size = size;
+	task->resolve = resolve;
+	task->reject = reject;
+	task->data = data;
+
+	return loader_load_await_schedule(task);
+}
+
+int loader_load_path(const loader_naming_path path)
+{
+	loader l = loader_singleton();
+
+	loader_initialize();
+
+	if (l->impl_map != NULL)
+	{
+		(void)path;
+
+		/* ... */
+	}
+
+	return 1;
+}
+
+int loader_execution_path(const loader_naming_tag tag, const loader_naming_path path)
+{
+	loader l = loader_singleton();
+
+	loader_initialize();
+
+	if (l->impl_map != NULL)
+	{
+		/* If loader is initialized, load the execution path */
+		loader_impl impl = loader_get_impl(tag);
+
+		log_write("metacall", LOG_LEVEL_DEBUG, "Loader (%s) implementation <%p>", tag, (void *)impl);
+
+		if (impl == NULL)
+		{
+			return 1;
+		}
+
+		return loader_impl_execution_path(impl, path);
+	}
+
+	return 1;
+}
+
+int loader_load_from_file(const loader_naming_tag tag, const loader_naming_path paths[], size_t size, void **handle)
+{
+	loader l = loader_singleton();
+
+	loader_initialize();
+
+	if (l->impl_map != NULL)
+	{
+		if (tag != NULL)
+		{
+			loader_impl impl;
+
+			const char **prefetch = NULL;
+
+			size_t prefetch_size = 0;
+
+			/* Start pulling the script contents into the page cache while the
+			loader below performs its (possibly first) runtime initialization,
+			relative paths are resolved by each loader against its execution
+			paths so only the absolute ones can be prefetched here */
+			if (size > 0)
+			{
+				prefetch = malloc(sizeof(const char *) * size);
+
+				if (prefetch != NULL)
+				{
+					size_t iterator;
+
+					for (iterator = 0; iterator < size; ++iterator)
+					{
+						if (loader_path_is_absolute(paths[iterator]) == 0)
+						{
+							prefetch[prefetch_size++] = paths[iterator];
+						}
+					}
+
+					if (prefetch_size > 0)
+					{
+						filesystem_readahead_submit(prefetch, prefetch_size);
+					}
+				}
+			}
+
+			impl = loader_get_impl(tag);
+
+			log_write("metacall", LOG_LEVEL_DEBUG, "Loader (%s) implementation <%p>", tag, (void *)impl);
+
+			if (impl != NULL)
+			{
+				int result = loader_impl_load_from_file(impl, paths, size, handle);
+
+				if (result == 0)
+				{
+					loader_metadata_invalidate();
+				}
+
+				/* The loader has consumed the batch, release the prefetched
+				buffers so the memory cost is bounded to the load in flight */
+				if (prefetch != NULL)
+				{
+					size_t iterator;
+
+					for (iterator = 0; iterator < prefetch_size; ++iterator)
+					{
+						char *buffer;
+
+						size_t length;
+
+						if (filesystem_readahead_acquire(prefetch[iterator], &buffer, &length) == 0)
+						{
+							free(buffer);
+						}
+					}
+
+					free(prefetch);
+				}
+
+				return result;
+			}
+
+			if (prefetch != NULL)
+			{
+				free(prefetch);
+			}
+		}
+	}
+
+	return 1;
+}
+
+int loader_load_from_memory(const loader_naming_tag tag, const char *buffer, size_t size, void **handle)
+{
+	loader l = loader_singleton();
+
+	loader_initialize();
+
+	if (l->impl_map != NULL)
+	{
+		loader_impl impl = loader_get_impl(tag);
+
+		log_write("metacall", LOG_LEVEL_DEBUG, "Loader (%s) implementation <%p>", tag, (void *)impl);
+
+		if (impl == NULL)
+		{
+			return 1;
+		}
+
+		{
+			int result = loader_impl_load_from_memory(impl, buffer, size, handle);
+
+			if (result == 0)
+			{
+				loader_metadata_invalidate();
+			}
+
+			return result;
+		}
+	}
+
+	return 1;
+}
+
+int loader_load_from_package(const loader_naming_tag extension, const loader_naming_path path, void **handle)
+{
+	loader l = loader_singleton();
+
+	loader_initialize();
+
+	if (l->impl_map != NULL)
+	{
+		loader_impl impl = loader_get_impl(extension);
+
+		log_write("metacall", LOG_LEVEL_DEBUG, "Loader (%s) implementation <%p>", extension, (void *)impl);
+
+		if (impl == NULL)
+		{
+			return 1;
+		}
+
+		{
+			int result = loader_impl_load_from_package(impl, path, handle);
+
+			if (result == 0)
+			{
+				loader_metadata_invalidate();
+			}
 
-		if (impl == NULL)
-		{
-			return 1;
+			return result;
 		}
-
-		return loader_impl_load_from_package(impl, path, handle);
 	}
 
 	return 1;
@@ -548,7 +1698,7 @@ int loader_load_from_configuration(const loader_naming_path path, void **handle,
 
 		size_t join_path_size = loader_path_join(path_base, path_base_size, str, str_size, join_path);
 
-		context_path_size = loader_path_canonical(join_path, join_path_size, context_path_str);
+		context_path_size = loader_path_canonical_cached(join_path, join_path_size, context_path_str);
 	}
 
 	scripts_array = value_to_array(scripts);
@@ -563,7 +1713,7 @@ int loader_load_from_configuration(const loader_naming_path path, void **handle,
 
 			if (context_path == NULL)
 			{
-				(void)loader_path_canonical(str, str_size, paths[iterator]);
+				(void)loader_path_canonical_cached(str, str_size, paths[iterator]);
 			}
 			else
 			{
@@ -571,7 +1721,7 @@ int loader_load_from_configuration(const loader_naming_path path, void **handle,
 
 				size_t join_path_size = loader_path_join(context_path_str, context_path_size, str, str_size, join_path);
 
-				(void)loader_path_canonical(join_path, join_path_size, paths[iterator]);
+				(void)loader_path_canonical_cached(join_path, join_path_size, paths[iterator]);
 			}
 		}
 	}
@@ -594,7 +1744,7 @@ int loader_load_from_configuration(const loader_naming_path path, void **handle,
 	return 0;
 }
 
-int loader_get_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args)
+int loader_get_cb_iterate(hashmap s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args)
 {
 	(void)s;
 	(void)key;
@@ -626,6 +1776,14 @@ loader_data loader_get(const char *name)
 {
 	loader l = loader_singleton();
 
+	/* Names defined in no scope are rejected by the filter before
+	probing the scope of every loader, duck typed dispatch intentionally
+	asks for names that often do not exist */
+	if (scope_filter_probe(name) != 0)
+	{
+		return NULL;
+	}
+
 	if (l->impl_map != NULL)
 	{
 		struct loader_get_iterator_args_type get_args;
@@ -633,7 +1791,7 @@ loader_data loader_get(const char *name)
 		get_args.name = name;
 		get_args.obj = NULL;
 
-		set_iterate(l->impl_map, &loader_get_cb_iterate, (set_cb_iterate_args)&get_args);
+		hashmap_iterate(l->impl_map, &loader_get_cb_iterate, (hashmap_cb_iterate_args)&get_args);
 
 		if (get_args.obj != NULL)
 		{
@@ -644,6 +1802,204 @@ loader_data loader_get(const char *name)
 	return NULL;
 }
 
+int loader_address_cb_iterate(hashmap s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args)
+{
+	(void)s;
+	(void)key;
+
+	if (val != NULL && args != NULL)
+	{
+		loader_impl impl = val;
+
+		loader_address_iterator_args address_args = args;
+
+		/* Loaders only answer for functions they own (they recognize
+		them by the function interface), so probing every loader is safe */
+		address_args->address = loader_impl_address(impl, address_args->func);
+
+		if (address_args->address != NULL)
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+void *loader_function_pointer(function func)
+{
+	loader l = loader_singleton();
+
+	if (func == NULL || l->impl_map == NULL)
+	{
+		return NULL;
+	}
+
+	{
+		struct loader_address_iterator_args_type address_args;
+
+		address_args.func = func;
+		address_args.address = NULL;
+
+		hashmap_iterate(l->impl_map, &loader_address_cb_iterate, (hashmap_cb_iterate_args)&address_args);
+
+		return address_args.address;
+	}
+}
+
+/* Resolve a loader by tag without instantiating it, GC coordination
+against an unloaded runtime is a failure and not a reason to start it */
+static loader_impl loader_gc_resolve(const loader_naming_tag tag)
+{
+	loader l = loader_singleton();
+
+	loader_impl impl = loader_get_impl_id(loader_tag_id(tag));
+
+	if (impl != NULL)
+	{
+		return impl;
+	}
+
+	if (l->impl_map == NULL)
+	{
+		return NULL;
+	}
+
+	loader_lock(l);
+
+	impl = (loader_impl)hashmap_get(l->impl_map, (hashmap_key)string_intern(tag));
+
+	loader_unlock(l);
+
+	return impl;
+}
+
+static int loader_gc_collect_cb_iterate(hashmap s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args)
+{
+	(void)s;
+	(void)key;
+	(void)args;
+
+	if (val != NULL)
+	{
+		/* Loaders without GC support are simply skipped on a broadcast */
+		loader_impl_gc_collect((loader_impl)val);
+	}
+
+	return 0;
+}
+
+struct loader_gc_hint_iterate_args_type
+{
+	int defer;
+};
+
+static int loader_gc_hint_cb_iterate(hashmap s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args)
+{
+	struct loader_gc_hint_iterate_args_type *hint_args = args;
+
+	(void)s;
+	(void)key;
+
+	if (val != NULL)
+	{
+		loader_impl_gc_hint((loader_impl)val, hint_args->defer);
+	}
+
+	return 0;
+}
+
+static int loader_gc_stats_cb_iterate(hashmap s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args)
+{
+	struct loader_impl_gc_stats_type *total = args;
+
+	struct loader_impl_gc_stats_type stats;
+
+	(void)s;
+	(void)key;
+
+	if (val != NULL && loader_impl_gc_stats((loader_impl)val, &stats) == 0)
+	{
+		total->heap_size += stats.heap_size;
+
+		total->collection_count += stats.collection_count;
+	}
+
+	return 0;
+}
+
+int loader_gc_collect(const loader_naming_tag tag)
+{
+	loader l = loader_singleton();
+
+	if (tag != NULL)
+	{
+		return loader_impl_gc_collect(loader_gc_resolve(tag));
+	}
+
+	if (l->impl_map == NULL)
+	{
+		return 1;
+	}
+
+	hashmap_iterate(l->impl_map, &loader_gc_collect_cb_iterate, NULL);
+
+	return 0;
+}
+
+int loader_gc_hint(const loader_naming_tag tag, int defer)
+{
+	loader l = loader_singleton();
+
+	if (tag != NULL)
+	{
+		return loader_impl_gc_hint(loader_gc_resolve(tag), defer);
+	}
+
+	if (l->impl_map == NULL)
+	{
+		return 1;
+	}
+
+	{
+		struct loader_gc_hint_iterate_args_type hint_args;
+
+		hint_args.defer = defer;
+
+		hashmap_iterate(l->impl_map, &loader_gc_hint_cb_iterate, (hashmap_cb_iterate_args)&hint_args);
+	}
+
+	return 0;
+}
+
+int loader_gc_stats(const loader_naming_tag tag, struct loader_impl_gc_stats_type *stats)
+{
+	loader l = loader_singleton();
+
+	if (stats == NULL)
+	{
+		return 1;
+	}
+
+	if (tag != NULL)
+	{
+		return loader_impl_gc_stats(loader_gc_resolve(tag), stats);
+	}
+
+	if (l->impl_map == NULL)
+	{
+		return 1;
+	}
+
+	stats->heap_size = 0;
+
+	stats->collection_count = 0;
+
+	hashmap_iterate(l->impl_map, &loader_gc_stats_cb_iterate, (hashmap_cb_iterate_args)stats);
+
+	return 0;
+}
+
 void *loader_get_handle(const loader_naming_tag tag, const char *name)
 {
 	return loader_impl_get_handle(loader_get_impl(tag), name);
@@ -673,17 +2029,18 @@ loader_data loader_handle_get(void *handle, const char *name)
 {
 	if (handle != NULL)
 	{
-		context ctx = loader_impl_handle_context(handle);
-
-		scope sp = context_scope(ctx);
-
-		return scope_get(sp, name);
+		return loader_impl_handle_get(handle, name);
 	}
 
 	return NULL;
 }
 
 value loader_metadata_impl(loader_impl impl)
+{
+	return loader_metadata_impl_filter(impl, NULL, NULL);
+}
+
+value loader_metadata_impl_filter(loader_impl impl, const char *handle_name, const char *name_prefix)
 {
 	loader_naming_tag *tag_ptr = loader_impl_tag(impl);
 
@@ -705,7 +2062,7 @@ value loader_metadata_impl(loader_impl impl)
 		return NULL;
 	}
 
-	v_ptr[1] = loader_impl_metadata(impl);
+	v_ptr[1] = loader_impl_metadata_filter(impl, handle_name, name_prefix);
 
 	if (v_ptr[1] == NULL)
 	{
@@ -717,54 +2074,162 @@ value loader_metadata_impl(loader_impl impl)
 	return v;
 }
 
-int loader_metadata_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args)
+value loader_metadata()
 {
-	loader_metadata_cb_iterator metadata_iterator = (loader_metadata_cb_iterator)args;
+	loader l = loader_singleton();
 
-	(void)s;
-	(void)key;
+	struct hashmap_cursor_type cursor;
+
+	value *values, v;
 
-	metadata_iterator->values[metadata_iterator->iterator] = loader_metadata_impl((loader_impl)val);
+	size_t iterator = 0;
 
-	if (metadata_iterator->values[metadata_iterator->iterator] != NULL)
+	if (l->impl_map == NULL)
 	{
-		++metadata_iterator->iterator;
+		return NULL;
 	}
 
-	return 0;
+	v = value_create_map(NULL, hashmap_size(l->impl_map));
+
+	if (v == NULL)
+	{
+		return NULL;
+	}
+
+	values = value_to_map(v);
+
+	for (hashmap_cursor_begin(l->impl_map, &cursor); hashmap_cursor_end(&cursor) != 0; hashmap_cursor_next(&cursor))
+	{
+		values[iterator] = loader_metadata_impl((loader_impl)hashmap_cursor_value(&cursor));
+
+		if (values[iterator] != NULL)
+		{
+			++iterator;
+		}
+	}
+
+	return v;
 }
 
-value loader_metadata()
+value loader_metadata_filter(const char *tag, const char *handle_name, const char *name_prefix)
 {
 	loader l = loader_singleton();
 
-	struct loader_metadata_cb_iterator_type metadata_iterator;
+	struct hashmap_cursor_type cursor;
 
-	value v;
+	value *values, v;
+
+	size_t iterator = 0;
 
 	if (l->impl_map == NULL)
 	{
 		return NULL;
 	}
 
-	v = value_create_map(NULL, set_size(l->impl_map));
+	if (tag != NULL)
+	{
+		loader_impl impl;
+
+		/* Resolve the tag without loader_get_impl, a query over a
+		loader that never initialized must not boot it */
+		loader_lock(l);
+
+		impl = (loader_impl)hashmap_get(l->impl_map, (hashmap_key)string_intern(tag));
+
+		loader_unlock(l);
+
+		if (impl == NULL)
+		{
+			return value_create_map(NULL, 0);
+		}
+
+		v = value_create_map(NULL, 1);
+
+		if (v == NULL)
+		{
+			return NULL;
+		}
+
+		value_to_map(v)[0] = loader_metadata_impl_filter(impl, handle_name, name_prefix);
+
+		if (value_to_map(v)[0] == NULL)
+		{
+			value_type_destroy(v);
+
+			return NULL;
+		}
+
+		return v;
+	}
+
+	v = value_create_map(NULL, hashmap_size(l->impl_map));
 
 	if (v == NULL)
 	{
 		return NULL;
 	}
 
-	metadata_iterator.iterator = 0;
-	metadata_iterator.values = value_to_map(v);
+	values = value_to_map(v);
+
+	for (hashmap_cursor_begin(l->impl_map, &cursor); hashmap_cursor_end(&cursor) != 0; hashmap_cursor_next(&cursor))
+	{
+		values[iterator] = loader_metadata_impl_filter((loader_impl)hashmap_cursor_value(&cursor), handle_name, name_prefix);
 
-	set_iterate(l->impl_map, &loader_metadata_cb_iterate, (set_cb_iterate_args)&metadata_iterator);
+		if (values[iterator] != NULL)
+		{
+			++iterator;
+		}
+	}
 
 	return v;
 }
 
+value loader_metadata_cached()
+{
+	loader l = loader_singleton();
+
+	if (l->metadata_cache == NULL)
+	{
+		l->metadata_cache = loader_metadata();
+	}
+
+	return l->metadata_cache;
+}
+
+void loader_metadata_invalidate()
+{
+	loader l = loader_singleton();
+
+	if (l->metadata_cache != NULL)
+	{
+		value_type_destroy(l->metadata_cache);
+
+		l->metadata_cache = NULL;
+	}
+}
+
+int loader_reload(void *handle)
+{
+	int result = loader_impl_handle_reload(handle);
+
+	if (result == 0)
+	{
+		loader_metadata_invalidate();
+	}
+
+	return result;
+}
+
 int loader_clear(void *handle)
 {
-	return loader_impl_clear(handle);
+	int result = loader_impl_clear(handle);
+
+	if (result == 0)
+	{
+		loader_metadata_invalidate();
+	}
+
+	return result;
 }
 
 void loader_unload_children(loader_impl impl)
@@ -825,6 +2290,11 @@ int loader_unload()
 
 	log_write("metacall", LOG_LEVEL_DEBUG, "Loader begin unload");
 
+	/* A warm up still running would race the destruction below */
+	loader_preload_await();
+
+	loader_metadata_invalidate();
+
 	/* Delete loaders in inverse order */
 	if (l->initialization_order != NULL)
 	{
@@ -854,12 +2324,15 @@ int loader_unload()
 	/* Clear the implementation tag map */
 	if (l->impl_map != NULL)
 	{
-		if (set_clear(l->impl_map) != 0)
+		if (hashmap_clear(l->impl_map) != 0)
 		{
 			loader_destroy();
 
 			return 1;
 		}
+
+		/* Withdraw the published implementations so no reader can reach a destroyed one */
+		loader_tag_registry_clear();
 	}
 
 	loader_destroy();
@@ -880,13 +2353,46 @@ void loader_destroy()
 
 	if (l->impl_map != NULL)
 	{
-		set_destroy(l->impl_map);
+		hashmap_destroy(l->impl_map);
 
 		l->impl_map = NULL;
 	}
 
+	loader_tag_registry_clear();
+
+	if (l->call_allocator != NULL)
+	{
+		memory_allocator_destroy(l->call_allocator);
+
+		l->call_allocator = NULL;
+	}
+
+	/* Drop any prefetched script content that was never claimed */
+	filesystem_readahead_destroy();
+
+	loader_path_cache_clear();
+
+	if (l->mutex != NULL)
+	{
+		threading_mutex_destroy(l->mutex);
+
+		l->mutex = NULL;
+	}
+
 	l->init_thread_id = THREAD_ID_INVALID;
 
+	/* The harvest of the destroyed implementations is complete, persist
+	the profile for the next boot */
+	loader_profile_destroy();
+
+	loader_discovery_cache_destroy();
+
+	loader_impl_converter_registry_destroy();
+
+	loader_dispatch_destroy();
+
+	loader_fork_destroy();
+
 	loader_env_destroy();
 }
 
@@ -0,0 +1,270 @@
+/*
+ *	Loader Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A library for loading executable code at run-time into a process.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <loader/loader_discovery_cache.h>
+
+#include <environment/environment_variable.h>
+
+#include <serial/serial.h>
+
+#include <memory/memory.h>
+
+#include <log/log.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+/* The cache is opt-in, it stays disabled unless the variable points
+to a writable directory so no service writes to disk by surprise */
+#define LOADER_DISCOVERY_CACHE_PATH "LOADER_DISCOVERY_CACHE_PATH"
+
+/* Matches the default metacall serial, the loader library sits below
+the metacall frontend so it cannot ask for the configured name */
+#define LOADER_DISCOVERY_CACHE_SERIAL "rapid_json"
+
+#define LOADER_DISCOVERY_CACHE_HASH_OFFSET 0xCBF29CE484222325ULL
+#define LOADER_DISCOVERY_CACHE_HASH_PRIME  0x00000100000001B3ULL
+
+#define LOADER_DISCOVERY_CACHE_BLOCK_SIZE ((size_t)0x1000)
+
+/* -- Private Data -- */
+
+static char *cache_path = NULL;
+static serial cache_serial = NULL;
+static memory_allocator cache_allocator = NULL;
+static int cache_initialized = 1;
+
+/* -- Private Methods -- */
+
+static int loader_discovery_cache_initialize(void);
+
+static int loader_discovery_cache_entry_path(uint64_t h, loader_naming_path entry_path);
+
+/* -- Methods -- */
+
+int loader_discovery_cache_initialize(void)
+{
+	if (cache_initialized == 0)
+	{
+		return cache_path[0] == '\0';
+	}
+
+	cache_path = environment_variable_create(LOADER_DISCOVERY_CACHE_PATH, NULL);
+
+	if (cache_path == NULL)
+	{
+		return 1;
+	}
+
+	cache_initialized = 0;
+
+	if (cache_path[0] == '\0')
+	{
+		return 1;
+	}
+
+	if (serial_initialize() != 0)
+	{
+		cache_path[0] = '\0';
+
+		return 1;
+	}
+
+	cache_serial = serial_create(LOADER_DISCOVERY_CACHE_SERIAL);
+
+	if (cache_serial == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid discovery cache serial (%s), the cache is disabled", LOADER_DISCOVERY_CACHE_SERIAL);
+
+		cache_path[0] = '\0';
+
+		return 1;
+	}
+
+	cache_allocator = memory_allocator_std(&malloc, &realloc, &free);
+
+	if (cache_allocator == NULL)
+	{
+		cache_path[0] = '\0';
+
+		return 1;
+	}
+
+	log_write("metacall", LOG_LEVEL_DEBUG, "Loader discovery cache path: %s", cache_path);
+
+	return 0;
+}
+
+int loader_discovery_cache_entry_path(uint64_t h, loader_naming_path entry_path)
+{
+	int result = snprintf(entry_path, LOADER_NAMING_PATH_SIZE, "%s/%016" PRIx64 ".%s", cache_path, h, serial_extension(cache_serial));
+
+	return !(result > 0 && (size_t)result < LOADER_NAMING_PATH_SIZE);
+}
+
+uint64_t loader_discovery_cache_hash(const loader_naming_path paths[], size_t size)
+{
+	uint64_t h = LOADER_DISCOVERY_CACHE_HASH_OFFSET;
+
+	size_t iterator;
+
+	if (loader_discovery_cache_initialize() != 0)
+	{
+		return 0;
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		char block[LOADER_DISCOVERY_CACHE_BLOCK_SIZE];
+
+		size_t length, position;
+
+		FILE *file = fopen(paths[iterator], "rb");
+
+		if (file == NULL)
+		{
+			return 0;
+		}
+
+		while ((length = fread(block, 1, sizeof(block), file)) > 0)
+		{
+			for (position = 0; position < length; ++position)
+			{
+				h ^= (uint64_t)(unsigned char)block[position];
+				h *= LOADER_DISCOVERY_CACHE_HASH_PRIME;
+			}
+		}
+
+		fclose(file);
+	}
+
+	/* Zero is the disabled sentinel, remap the (unlikely) collision */
+	return h == 0 ? LOADER_DISCOVERY_CACHE_HASH_OFFSET : h;
+}
+
+value loader_discovery_cache_fetch(uint64_t h)
+{
+	loader_naming_path entry_path;
+
+	FILE *file;
+
+	char *buffer;
+
+	long length;
+
+	value discovery = NULL;
+
+	if (h == 0 || loader_discovery_cache_initialize() != 0)
+	{
+		return NULL;
+	}
+
+	if (loader_discovery_cache_entry_path(h, entry_path) != 0)
+	{
+		return NULL;
+	}
+
+	file = fopen(entry_path, "rb");
+
+	if (file == NULL)
+	{
+		return NULL;
+	}
+
+	if (fseek(file, 0, SEEK_END) != 0 || (length = ftell(file)) <= 0 || fseek(file, 0, SEEK_SET) != 0)
+	{
+		fclose(file);
+
+		return NULL;
+	}
+
+	buffer = malloc(sizeof(char) * (size_t)length);
+
+	if (buffer != NULL)
+	{
+		if (fread(buffer, 1, (size_t)length, file) == (size_t)length)
+		{
+			discovery = serial_deserialize(cache_serial, buffer, (size_t)length, cache_allocator);
+		}
+
+		free(buffer);
+	}
+
+	fclose(file);
+
+	return discovery;
+}
+
+int loader_discovery_cache_store(uint64_t h, value discovery)
+{
+	loader_naming_path entry_path;
+
+	FILE *file;
+
+	char *buffer;
+
+	size_t size = 0;
+
+	int result = 1;
+
+	if (h == 0 || discovery == NULL || loader_discovery_cache_initialize() != 0)
+	{
+		return 1;
+	}
+
+	if (loader_discovery_cache_entry_path(h, entry_path) != 0)
+	{
+		return 1;
+	}
+
+	buffer = serial_serialize(cache_serial, discovery, &size, cache_allocator);
+
+	if (buffer == NULL)
+	{
+		return 1;
+	}
+
+	file = fopen(entry_path, "wb");
+
+	if (file != NULL)
+	{
+		result = !(fwrite(buffer, 1, size, file) == size);
+
+		fclose(file);
+	}
+
+	memory_allocator_deallocate(cache_allocator, buffer);
+
+	return result;
+}
+
+void loader_discovery_cache_destroy(void)
+{
+	if (cache_allocator != NULL)
+	{
+		memory_allocator_destroy(cache_allocator);
+
+		cache_allocator = NULL;
+	}
+
+	if (cache_path != NULL)
+	{
+		environment_variable_destroy(cache_path);
+
+		cache_path = NULL;
+	}
+
+	cache_serial = NULL;
+
+	cache_initialized = 1;
+}
@@ -0,0 +1,449 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A library for loading executable code at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <loader/loader.h>
+#include <loader/loader_dispatch.h>
+#include <loader/loader_impl.h>
+
+#include <adt/adt_string_pool.h>
+#include <adt/adt_vector.h>
+
+#include <threading/threading_event.h>
+#include <threading/threading_mutex.h>
+#include <threading/threading_thread_id.h>
+
+#include <log/log.h>
+
+#include <stdlib.h>
+
+/* -- Member Data -- */
+
+/* One parked cross-thread call, it lives on the caller stack while the
+caller waits so the queue only stores the pointer */
+struct loader_dispatch_entry_type
+{
+	function func;
+	void **args;
+	size_t size;
+	value result;
+	struct threading_event_type event;
+};
+
+struct loader_dispatch_router_type
+{
+	const char *tag; /* Interned, lookups compare the canonical pointers */
+	uint64_t owner;
+	threading_mutex mutex;
+	vector queue; /* struct loader_dispatch_entry_type * */
+	loader_dispatch_wake_cb wake;
+	void *wake_data;
+};
+
+/* -- Private Variables -- */
+
+static vector dispatch_routers = NULL;
+
+static threading_mutex dispatch_routers_mutex = NULL;
+
+/* -- Private Methods -- */
+
+static int loader_dispatch_initialize(void)
+{
+	if (dispatch_routers != NULL)
+	{
+		return 0;
+	}
+
+	dispatch_routers = vector_create(sizeof(struct loader_dispatch_router_type *));
+
+	if (dispatch_routers == NULL)
+	{
+		return 1;
+	}
+
+	dispatch_routers_mutex = threading_mutex_create();
+
+	if (dispatch_routers_mutex == NULL)
+	{
+		vector_destroy(dispatch_routers);
+
+		dispatch_routers = NULL;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+/* The routers vector is append mostly and tiny (one entry per pinned
+runtime), a linear scan over interned tags is cheaper than a map */
+static struct loader_dispatch_router_type *loader_dispatch_find(const char *tag_interned)
+{
+	size_t iterator, size = vector_size(dispatch_routers);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_dispatch_router_type *router = *(struct loader_dispatch_router_type **)vector_at(dispatch_routers, iterator);
+
+		if (router->tag == tag_interned)
+		{
+			return router;
+		}
+	}
+
+	return NULL;
+}
+
+static void loader_dispatch_router_destroy(struct loader_dispatch_router_type *router)
+{
+	size_t iterator, size;
+
+	/* Callers parked on the queue must not hang on a vanished owner,
+	wake them with a null result */
+	threading_mutex_lock(router->mutex);
+
+	size = vector_size(router->queue);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_dispatch_entry_type *entry = *(struct loader_dispatch_entry_type **)vector_at(router->queue, iterator);
+
+		entry->result = NULL;
+
+		threading_event_signal(&entry->event);
+	}
+
+	vector_resize(router->queue, 0);
+
+	threading_mutex_unlock(router->mutex);
+
+	threading_mutex_destroy(router->mutex);
+
+	vector_destroy(router->queue);
+
+	free(router);
+}
+
+/* -- Methods -- */
+
+int loader_dispatch_register(const loader_naming_tag tag, loader_dispatch_wake_cb wake, void *wake_data)
+{
+	struct loader_dispatch_router_type *router;
+
+	const char *tag_interned;
+
+	if (tag == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid dispatch router registration parameters");
+
+		return 1;
+	}
+
+	tag_interned = string_intern(tag);
+
+	if (tag_interned == NULL || loader_dispatch_initialize() != 0)
+	{
+		return 1;
+	}
+
+	threading_mutex_lock(dispatch_routers_mutex);
+
+	if (loader_dispatch_find(tag_interned) != NULL)
+	{
+		threading_mutex_unlock(dispatch_routers_mutex);
+
+		log_write("metacall", LOG_LEVEL_ERROR, "Dispatch router (%s) already registered", tag);
+
+		return 1;
+	}
+
+	router = malloc(sizeof(struct loader_dispatch_router_type));
+
+	if (router == NULL)
+	{
+		threading_mutex_unlock(dispatch_routers_mutex);
+
+		return 1;
+	}
+
+	router->queue = vector_create(sizeof(struct loader_dispatch_entry_type *));
+
+	if (router->queue == NULL)
+	{
+		threading_mutex_unlock(dispatch_routers_mutex);
+
+		free(router);
+
+		return 1;
+	}
+
+	router->mutex = threading_mutex_create();
+
+	if (router->mutex == NULL)
+	{
+		threading_mutex_unlock(dispatch_routers_mutex);
+
+		vector_destroy(router->queue);
+
+		free(router);
+
+		return 1;
+	}
+
+	router->tag = tag_interned;
+
+	router->owner = thread_id_get_current();
+
+	router->wake = wake;
+
+	router->wake_data = wake_data;
+
+	vector_push_back(dispatch_routers, &router);
+
+	threading_mutex_unlock(dispatch_routers_mutex);
+
+	return 0;
+}
+
+int loader_dispatch_unregister(const loader_naming_tag tag)
+{
+	struct loader_dispatch_router_type *router = NULL;
+
+	const char *tag_interned;
+
+	size_t iterator, size;
+
+	if (tag == NULL || dispatch_routers == NULL)
+	{
+		return 1;
+	}
+
+	tag_interned = string_intern(tag);
+
+	threading_mutex_lock(dispatch_routers_mutex);
+
+	size = vector_size(dispatch_routers);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_dispatch_router_type *current = *(struct loader_dispatch_router_type **)vector_at(dispatch_routers, iterator);
+
+		if (current->tag == tag_interned)
+		{
+			router = current;
+
+			vector_set(dispatch_routers, iterator, vector_back(dispatch_routers));
+
+			vector_pop_back(dispatch_routers);
+
+			break;
+		}
+	}
+
+	threading_mutex_unlock(dispatch_routers_mutex);
+
+	if (router == NULL)
+	{
+		return 1;
+	}
+
+	loader_dispatch_router_destroy(router);
+
+	return 0;
+}
+
+void *loader_dispatch_invoke(const loader_naming_tag tag, function func, void *args[], size_t size)
+{
+	struct loader_dispatch_router_type *router;
+
+	struct loader_dispatch_entry_type entry;
+
+	struct loader_dispatch_entry_type *entry_ptr = &entry;
+
+	int notify;
+
+	if (tag == NULL || func == NULL || dispatch_routers == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid dispatch invoke parameters");
+
+		return NULL;
+	}
+
+	/* Reentrant runtimes declare parallel invoke safety through the loader
+	interface, those calls skip the queue round trip entirely and run on
+	the caller thread. The registry fast path never instantiates a loader,
+	an unloaded tag simply falls through to the router */
+	{
+		loader_impl impl = loader_get_impl_id(loader_tag_id(tag));
+
+		if (impl != NULL && loader_impl_parallel(impl, func) != 0)
+		{
+			return function_call(func, args, size);
+		}
+	}
+
+	threading_mutex_lock(dispatch_routers_mutex);
+
+	router = loader_dispatch_find(string_intern(tag));
+
+	threading_mutex_unlock(dispatch_routers_mutex);
+
+	if (router == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Dispatch router (%s) not registered", tag);
+
+		return NULL;
+	}
+
+	/* Owner thread fast path, no queue round trip */
+	if (router->owner == thread_id_get_current())
+	{
+		return function_call(func, args, size);
+	}
+
+	entry.func = func;
+
+	entry.args = args;
+
+	entry.size = size;
+
+	entry.result = NULL;
+
+	threading_event_initialize(&entry.event);
+
+	threading_mutex_lock(router->mutex);
+
+	notify = (vector_size(router->queue) == 0);
+
+	vector_push_back(router->queue, &entry_ptr);
+
+	threading_mutex_unlock(router->mutex);
+
+	/* Only the empty to non empty transition wakes the owner, the
+	calls queued meanwhile ride on the pending drain */
+	if (notify != 0 && router->wake != NULL)
+	{
+		router->wake(router->wake_data);
+	}
+
+	threading_event_wait(&entry.event);
+
+	return entry.result;
+}
+
+size_t loader_dispatch_drain(const loader_naming_tag tag)
+{
+	struct loader_dispatch_router_type *router;
+
+	vector batch;
+
+	size_t iterator, size;
+
+	if (tag == NULL || dispatch_routers == NULL)
+	{
+		return 0;
+	}
+
+	threading_mutex_lock(dispatch_routers_mutex);
+
+	router = loader_dispatch_find(string_intern(tag));
+
+	threading_mutex_unlock(dispatch_routers_mutex);
+
+	if (router == NULL)
+	{
+		return 0;
+	}
+
+	if (router->owner != thread_id_get_current())
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Dispatch router (%s) drained from a thread that does not own it", tag);
+
+		return 0;
+	}
+
+	/* Steal the whole backlog in one critical section, the calls
+	execute outside the lock so new callers can keep queueing */
+	threading_mutex_lock(router->mutex);
+
+	size = vector_size(router->queue);
+
+	if (size == 0)
+	{
+		threading_mutex_unlock(router->mutex);
+
+		return 0;
+	}
+
+	batch = vector_copy(router->queue);
+
+	vector_resize(router->queue, 0);
+
+	threading_mutex_unlock(router->mutex);
+
+	if (batch == NULL)
+	{
+		return 0;
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_dispatch_entry_type *entry = *(struct loader_dispatch_entry_type **)vector_at(batch, iterator);
+
+		entry->result = function_call(entry->func, entry->args, entry->size);
+
+		threading_event_signal(&entry->event);
+	}
+
+	vector_destroy(batch);
+
+	return size;
+}
+
+void loader_dispatch_destroy(void)
+{
+	size_t iterator, size;
+
+	if (dispatch_routers == NULL)
+	{
+		return;
+	}
+
+	threading_mutex_lock(dispatch_routers_mutex);
+
+	size = vector_size(dispatch_routers);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		loader_dispatch_router_destroy(*(struct loader_dispatch_router_type **)vector_at(dispatch_routers, iterator));
+	}
+
+	vector_destroy(dispatch_routers);
+
+	dispatch_routers = NULL;
+
+	threading_mutex_unlock(dispatch_routers_mutex);
+
+	threading_mutex_destroy(dispatch_routers_mutex);
+
+	dispatch_routers_mutex = NULL;
+}
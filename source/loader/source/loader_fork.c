@@ -0,0 +1,201 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A library for loading executable code at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <loader/loader_fork.h>
+
+#include <log/log.h>
+
+#include <stdlib.h>
+
+/* -- Member Data -- */
+
+struct loader_fork_entry_type
+{
+	loader_fork_prepare_cb prepare;
+	loader_fork_parent_cb parent;
+	loader_fork_child_cb child;
+	void *data;
+	struct loader_fork_entry_type *next;
+};
+
+/* -- Private Variables -- */
+
+static struct loader_fork_entry_type *loader_fork_entries = NULL;
+
+static size_t loader_fork_entry_count = 0;
+
+static loader_fork_activate_cb loader_fork_activate = NULL;
+
+/* -- Methods -- */
+
+void loader_fork_activation(loader_fork_activate_cb callback)
+{
+	loader_fork_activate = callback;
+}
+
+int loader_fork_register(loader_fork_prepare_cb prepare, loader_fork_parent_cb parent, loader_fork_child_cb child, void *data)
+{
+	struct loader_fork_entry_type *entry;
+
+	if (prepare == NULL || parent == NULL || child == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid loader fork registration parameters");
+
+		return 1;
+	}
+
+	entry = malloc(sizeof(struct loader_fork_entry_type));
+
+	if (entry == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad loader fork entry allocation");
+
+		return 1;
+	}
+
+	entry->prepare = prepare;
+	entry->parent = parent;
+	entry->child = child;
+	entry->data = data;
+	entry->next = loader_fork_entries;
+
+	loader_fork_entries = entry;
+
+	++loader_fork_entry_count;
+
+	/* The first participant pulls the fork machinery in, processes
+	that never register one never pay for the detours */
+	if (loader_fork_entry_count == 1 && loader_fork_activate != NULL)
+	{
+		if (loader_fork_activate() != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid loader fork activation");
+		}
+	}
+
+	return 0;
+}
+
+int loader_fork_unregister(void *data)
+{
+	struct loader_fork_entry_type **entry_ptr;
+
+	for (entry_ptr = &loader_fork_entries; *entry_ptr != NULL; entry_ptr = &(*entry_ptr)->next)
+	{
+		if ((*entry_ptr)->data == data)
+		{
+			struct loader_fork_entry_type *entry = *entry_ptr;
+
+			*entry_ptr = entry->next;
+
+			free(entry);
+
+			--loader_fork_entry_count;
+
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+size_t loader_fork_count(void)
+{
+	return loader_fork_entry_count;
+}
+
+int loader_fork_prepare(void)
+{
+	struct loader_fork_entry_type *entry;
+
+	int result = 0;
+
+	for (entry = loader_fork_entries; entry != NULL; entry = entry->next)
+	{
+		if (entry->prepare(entry->data) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid loader fork prepare callback invocation");
+
+			result = 1;
+		}
+	}
+
+	return result;
+}
+
+int loader_fork_parent(void)
+{
+	struct loader_fork_entry_type *entry;
+
+	int result = 0;
+
+	for (entry = loader_fork_entries; entry != NULL; entry = entry->next)
+	{
+		if (entry->parent(entry->data) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid loader fork parent callback invocation");
+
+			result = 1;
+		}
+	}
+
+	return result;
+}
+
+int loader_fork_child(void)
+{
+	struct loader_fork_entry_type *entry;
+
+	int result = 0;
+
+	for (entry = loader_fork_entries; entry != NULL; entry = entry->next)
+	{
+		if (entry->child(entry->data) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid loader fork child callback invocation");
+
+			result = 1;
+		}
+	}
+
+	return result;
+}
+
+void loader_fork_destroy(void)
+{
+	struct loader_fork_entry_type *entry = loader_fork_entries;
+
+	while (entry != NULL)
+	{
+		struct loader_fork_entry_type *next = entry->next;
+
+		free(entry);
+
+		entry = next;
+	}
+
+	loader_fork_entries = NULL;
+
+	loader_fork_entry_count = 0;
+
+	loader_fork_activate = NULL;
+}
@@ -8,32 +8,57 @@
 
 /* -- Headers -- */
 
+#include <loader/loader_discovery_cache.h>
 #include <loader/loader_env.h>
 #include <loader/loader_impl.h>
+#include <loader/loader_impl_static.h>
+#include <loader/loader_path_index.h>
+#include <loader/loader_profile.h>
 
 #include <reflect/reflect_context.h>
 #include <reflect/reflect_type.h>
 
 #include <adt/adt_hash.h>
-#include <adt/adt_set.h>
+#include <adt/adt_hashmap.h>
+#include <adt/adt_string_pool.h>
+#include <adt/adt_hashmap_concurrent.h>
 #include <adt/adt_vector.h>
 
+#include <threading/threading_mutex.h>
+
 #include <dynlink/dynlink.h>
 
+#include <environment/environment_variable.h>
+
 #include <format/format_print.h>
 
 #include <log/log.h>
 
 #include <configuration/configuration.h>
+#include <configuration/configuration_object.h>
+#include <configuration/configuration_singleton.h>
 
+#include <inttypes.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#include <windows.h>
+#else
+	#include <sys/stat.h>
+#endif
+
 /* -- Definitions -- */
 
 #define LOADER_IMPL_FUNCTION_INIT "__metacall_initialize__"
 #define LOADER_IMPL_FUNCTION_FINI "__metacall_finalize__"
 
+#define LOADER_IMPL_IDENTITY_SIZE ((size_t)0x20)
+
 /* -- Forward Declarations -- */
 
 struct loader_handle_impl_type;
@@ -54,12 +79,21 @@ struct loader_impl_type
 	loader_naming_tag tag;
 	dynlink handle;
 	loader_impl_interface_singleton singleton;
-	set handle_impl_map;
+	hashmap_concurrent handle_impl_map;
+	hashmap_concurrent identity_map; /* Handles indexed by canonical identity (device and inode for files, content hash for memory) for O(1) duplicate detection immune to path aliasing */
 	loader_impl_data data;
 	context ctx;
-	set type_info_map;
+	hashmap_concurrent type_info_map;
+	type builtin_types[TYPE_SIZE]; /* Builtin type ids resolve by array indexing, only dynamic class types hit the hash path */
 	void *options;
-	set exec_path_map;
+	loader_impl_profile_warm_cb profile_warm; /* Pre-builds lazy call-site state for profiled hot functions */
+	void *profile_warm_data;
+	loader_impl_gc_collect_cb gc_collect; /* Runtime garbage collector bridge, registered at initialize */
+	loader_impl_gc_hint_cb gc_hint;
+	loader_impl_gc_stats_cb gc_stats;
+	void *gc_data;
+	hashmap exec_path_map;
+	loader_path_index path_index; /* Execution path directories enumerated once for in memory resolution */
 };
 
 struct loader_handle_impl_type
@@ -69,17 +103,46 @@ struct loader_handle_impl_type
 	loader_handle module;
 	context ctx;
 	int populated;
+	value discovery;	/* Discovery metadata recovered from the cache, null on cache miss */
+	vector index;		/* Dense (interned name, value) pairs sorted by name pointer for O(log n) resolution without hashing */
+	value export_cache; /* Export map built once per handle, it only dies with the handle */
+	loader_naming_path *paths; /* Owned copy of the source paths, set for file handles so they can be reloaded */
+	size_t paths_size;
+	char *identity; /* Owned canonical identity key, set when the handle is indexed in the identity map */
+};
+
+struct loader_handle_index_entry_type
+{
+	const char *name; /* Interned, lookups compare the canonical pointers */
+	value val;
 };
 
 struct loader_impl_metadata_cb_iterator_type
 {
 	size_t iterator;
 	value *values;
+	const char *name_prefix;
+};
+
+/* Conversion registry entry, tags are interned so lookups compare the
+canonical pointers instead of the strings */
+struct loader_impl_converter_entry_type
+{
+	const char *src;
+	const char *dst;
+	type_id id;
+	loader_impl_converter converter;
+	void *context;
 };
 
+
 /* -- Private Methods -- */
 
-static int loader_impl_initialize(loader_impl impl);
+static int loader_impl_handle_index_build_cb(scope sp, const char *key, value v, void *data);
+
+static int loader_impl_handle_index_compare(const void *left, const void *right);
+
+static void loader_impl_handle_index_build(loader_handle_impl handle_impl);
 
 static dynlink loader_impl_dynlink_load(const char *path, const loader_naming_tag tag);
 
@@ -97,22 +160,185 @@ static int loader_impl_handle_register(loader_impl impl, char *name, loader_hand
 
 static int loader_impl_function_hook_call(context ctx, const char func_name[]);
 
+static int loader_impl_profile_warm_cb_iterate(scope sp, const char *key, value v, void *data);
+
+static void loader_impl_profile_warm_handle(loader_impl impl, loader_handle_impl handle_impl);
+
 static value loader_impl_metadata_handle_name(loader_handle_impl handle_impl);
 
-static value loader_impl_metadata_handle_context(loader_handle_impl handle_impl);
+static value loader_impl_metadata_handle_context(loader_handle_impl handle_impl, const char *name_prefix);
+
+static value loader_impl_metadata_handle(loader_handle_impl handle_impl, const char *name_prefix);
+
+static int loader_impl_metadata_cb_iterate(hashmap_concurrent s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args);
+
+static uint64_t loader_impl_identity_hash(uint64_t h, const void *data, size_t size);
 
-static value loader_impl_metadata_handle(loader_handle_impl handle_impl);
+static int loader_impl_identity_file(const loader_naming_path paths[], size_t size, char identity[LOADER_IMPL_IDENTITY_SIZE]);
 
-static int loader_impl_metadata_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args);
+static void loader_impl_identity_memory(const char *buffer, size_t size, char identity[LOADER_IMPL_IDENTITY_SIZE]);
+
+static loader_handle_impl loader_impl_identity_get(loader_impl impl, const char identity[LOADER_IMPL_IDENTITY_SIZE]);
+
+static void loader_impl_identity_register(loader_impl impl, loader_handle_impl handle_impl, const char identity[LOADER_IMPL_IDENTITY_SIZE]);
 
 static void loader_impl_destroy_handle(loader_handle_impl handle_impl);
 
-static int loader_impl_destroy_type_map_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args);
+static int loader_impl_destroy_type_map_cb_iterate(hashmap_concurrent s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args);
 
-static int loader_impl_destroy_handle_map_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args);
+static int loader_impl_destroy_handle_map_cb_iterate(hashmap_concurrent s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args);
 
 /* -- Methods -- */
 
+/* -- Loader Pinning -- */
+
+/* With LOADER_PIN set in the environment, loader shared objects and
+their resolved interface singletons stay resident across
+loader_destroy / loader_initialize cycles: re-initializing embedders
+and test harnesses skip the dlopen and symbol resolution cost and only
+rebuild runtime state. Pinned libraries stay mapped for the rest of
+the process on purpose, so the registry is never torn down */
+
+struct loader_impl_pin_entry_type
+{
+	loader_naming_tag tag;
+	dynlink handle;
+	loader_impl_interface_singleton singleton;
+};
+
+static vector loader_impl_pin_registry = NULL;
+static threading_mutex loader_impl_pin_mutex = NULL;
+
+static int loader_impl_pin_enabled(void)
+{
+	static int enabled = -1;
+
+	if (enabled == -1)
+	{
+		enabled = environment_variable_get("LOADER_PIN", NULL) != NULL;
+	}
+
+	return enabled;
+}
+
+static int loader_impl_pin_initialize(void)
+{
+	if (loader_impl_pin_registry != NULL)
+	{
+		return 0;
+	}
+
+	loader_impl_pin_registry = vector_create(sizeof(struct loader_impl_pin_entry_type));
+
+	if (loader_impl_pin_registry == NULL)
+	{
+		return 1;
+	}
+
+	loader_impl_pin_mutex = threading_mutex_create();
+
+	if (loader_impl_pin_mutex == NULL)
+	{
+		vector_destroy(loader_impl_pin_registry);
+
+		loader_impl_pin_registry = NULL;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+static int loader_impl_pin_get(const loader_naming_tag tag, dynlink *handle, loader_impl_interface_singleton *singleton)
+{
+	size_t iterator, size;
+
+	int found = 1;
+
+	if (loader_impl_pin_registry == NULL)
+	{
+		return 1;
+	}
+
+	threading_mutex_lock(loader_impl_pin_mutex);
+
+	size = vector_size(loader_impl_pin_registry);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_impl_pin_entry_type *entry = vector_at(loader_impl_pin_registry, iterator);
+
+		if (strncmp(entry->tag, tag, LOADER_NAMING_TAG_SIZE) == 0)
+		{
+			*handle = entry->handle;
+			*singleton = entry->singleton;
+
+			found = 0;
+
+			break;
+		}
+	}
+
+	threading_mutex_unlock(loader_impl_pin_mutex);
+
+	return found;
+}
+
+static void loader_impl_pin_register(const loader_naming_tag tag, dynlink handle, loader_impl_interface_singleton singleton)
+{
+	struct loader_impl_pin_entry_type entry;
+
+	if (loader_impl_pin_initialize() != 0)
+	{
+		return;
+	}
+
+	strncpy(entry.tag, tag, LOADER_NAMING_TAG_SIZE - 1);
+
+	entry.tag[LOADER_NAMING_TAG_SIZE - 1] = '\0';
+
+	entry.handle = handle;
+	entry.singleton = singleton;
+
+	threading_mutex_lock(loader_impl_pin_mutex);
+
+	vector_push_back(loader_impl_pin_registry, &entry);
+
+	threading_mutex_unlock(loader_impl_pin_mutex);
+}
+
+static int loader_impl_pin_pinned(dynlink handle)
+{
+	size_t iterator, size;
+
+	int pinned = 0;
+
+	if (loader_impl_pin_registry == NULL)
+	{
+		return 0;
+	}
+
+	threading_mutex_lock(loader_impl_pin_mutex);
+
+	size = vector_size(loader_impl_pin_registry);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_impl_pin_entry_type *entry = vector_at(loader_impl_pin_registry, iterator);
+
+		if (entry->handle == handle)
+		{
+			pinned = 1;
+
+			break;
+		}
+	}
+
+	threading_mutex_unlock(loader_impl_pin_mutex);
+
+	return pinned;
+}
+
 dynlink loader_impl_dynlink_load(const char *path, const loader_naming_tag tag)
 {
 #if (!defined(NDEBUG) || defined(DEBUG) || defined(_DEBUG) || defined(__DEBUG) || defined(__DEBUG__))
@@ -165,11 +391,35 @@ int loader_impl_dynlink_symbol(loader_impl impl, const loader_naming_tag tag, dy
 
 void loader_impl_dynlink_destroy(loader_impl impl)
 {
-	dynlink_unload(impl->handle);
+	/* Loaders linked in-process carry no dynlink handle, pinned
+	libraries stay resident for the next initialize cycle */
+	if (impl->handle != NULL && loader_impl_pin_pinned(impl->handle) == 0)
+	{
+		dynlink_unload(impl->handle);
+	}
 }
 
 int loader_impl_create_singleton(loader_impl impl, const char *path, const loader_naming_tag tag)
 {
+	/* Loaders compiled into the process (monolithic builds) register
+	through constructor tables, they take precedence and skip the
+	dlopen and symbol resolution cost entirely */
+	impl->singleton = loader_impl_static_get(tag);
+
+	if (impl->singleton != NULL)
+	{
+		impl->handle = NULL;
+
+		return 0;
+	}
+
+	/* A pinned library from a previous initialize cycle resolves
+	without touching the dynamic linker */
+	if (loader_impl_pin_enabled() != 0 && loader_impl_pin_get(tag, &impl->handle, &impl->singleton) == 0)
+	{
+		return 0;
+	}
+
 	impl->handle = loader_impl_dynlink_load(path, tag);
 
 	if (impl->handle != NULL)
@@ -182,6 +432,11 @@ int loader_impl_create_singleton(loader_impl impl, const char *path, const loade
 
 			if (impl->singleton != NULL)
 			{
+				if (loader_impl_pin_enabled() != 0)
+				{
+					loader_impl_pin_register(tag, impl->handle, impl->singleton);
+				}
+
 				return 0;
 			}
 		}
@@ -203,29 +458,36 @@ loader_impl loader_impl_create_proxy()
 
 	if (impl != NULL)
 	{
-		impl->handle_impl_map = set_create(&hash_callback_str, &comparable_callback_str);
+		impl->handle_impl_map = hashmap_concurrent_create(&hash_callback_str, &comparable_callback_str);
 
 		if (impl->handle_impl_map != NULL)
 		{
-			impl->type_info_map = set_create(&hash_callback_str, &comparable_callback_str);
+			impl->identity_map = hashmap_concurrent_create(&hash_callback_str, &comparable_callback_str);
 
-			if (impl->type_info_map != NULL)
+			if (impl->identity_map != NULL)
 			{
-				static char loader_host_proxy_name[] = LOADER_HOST_PROXY_NAME;
+				impl->type_info_map = hashmap_concurrent_create(&hash_callback_str, &comparable_callback_str);
 
-				impl->ctx = context_create(loader_host_proxy_name);
-
-				if (impl->ctx != NULL)
+				if (impl->type_info_map != NULL)
 				{
-					strncpy(impl->tag, loader_host_proxy_name, LOADER_NAMING_TAG_SIZE);
+					static char loader_host_proxy_name[] = LOADER_HOST_PROXY_NAME;
+
+					impl->ctx = context_create(loader_host_proxy_name);
+
+					if (impl->ctx != NULL)
+					{
+						strncpy(impl->tag, loader_host_proxy_name, LOADER_NAMING_TAG_SIZE);
+
+						return impl;
+					}
 
-					return impl;
+					hashmap_concurrent_destroy(impl->type_info_map);
 				}
 
-				set_destroy(impl->type_info_map);
+				hashmap_concurrent_destroy(impl->identity_map);
 			}
 
-			set_destroy(impl->handle_impl_map);
+			hashmap_concurrent_destroy(impl->handle_impl_map);
 		}
 	}
 
@@ -288,6 +550,50 @@ int loader_impl_initialize(loader_impl impl)
 
 	config = configuration_scope(configuration_key);
 
+	/* Overlay the options given at initialization over the configuration
+	scope, so runtime knobs (heap sizes, garbage collection modes, pool
+	widths) are tunable per deployment without recompiling; an option
+	takes precedence over the same key in the configuration file. The
+	options value is owned by the embedder and must outlive the loader */
+	if (impl->options != NULL && value_type_id(impl->options) == TYPE_MAP)
+	{
+		if (config == NULL)
+		{
+			/* There is no configuration file for this loader, create an
+			empty scope to carry the options and register it so it is
+			reclaimed with the rest of the configurations */
+			config = configuration_create(configuration_key, NULL, NULL, NULL);
+
+			if (config != NULL && configuration_singleton_register(config) != 0)
+			{
+				configuration_object_destroy(config);
+
+				config = NULL;
+			}
+		}
+
+		if (config != NULL)
+		{
+			value *options_map = value_to_map(impl->options);
+
+			size_t iterator, size = value_type_count(impl->options);
+
+			for (iterator = 0; iterator < size; ++iterator)
+			{
+				value *tuple = value_to_array(options_map[iterator]);
+
+				if (value_type_id(tuple[0]) == TYPE_STRING)
+				{
+					configuration_define(config, value_to_string(tuple[0]), tuple[1]);
+				}
+			}
+		}
+		else
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Loader (%s) options could not be applied, invalid configuration scope", impl->tag);
+		}
+	}
+
 	impl->data = impl->singleton()->initialize(impl, config);
 
 	if (impl->data == NULL)
@@ -324,7 +630,7 @@ int loader_impl_initialize(loader_impl impl)
 		}
 	}
 
-	paths = set_get(impl->exec_path_map, (const set_key)impl->tag);
+	paths = hashmap_get(impl->exec_path_map, (const hashmap_key)impl->tag);
 
 	/* Load all execution paths */
 	if (paths != NULL)
@@ -363,37 +669,55 @@ loader_impl loader_impl_create(const char *path, const loader_naming_tag tag)
 
 		impl->init = 1;
 		impl->options = NULL;
+		impl->profile_warm = NULL;
+		impl->profile_warm_data = NULL;
+
+		memset(impl->builtin_types, 0, sizeof(impl->builtin_types));
 
 		if (loader_impl_create_singleton(impl, path, tag) == 0)
 		{
-			impl->handle_impl_map = set_create(&hash_callback_str, &comparable_callback_str);
+			impl->handle_impl_map = hashmap_concurrent_create(&hash_callback_str, &comparable_callback_str);
 
 			if (impl->handle_impl_map != NULL)
 			{
-				impl->type_info_map = set_create(&hash_callback_str, &comparable_callback_str);
+				impl->identity_map = hashmap_concurrent_create(&hash_callback_str, &comparable_callback_str);
 
-				if (impl->type_info_map != NULL)
+				if (impl->identity_map != NULL)
 				{
-					impl->ctx = context_create(tag);
+					impl->type_info_map = hashmap_concurrent_create(&hash_callback_str, &comparable_callback_str);
 
-					if (impl->ctx != NULL)
+					if (impl->type_info_map != NULL)
 					{
-						strncpy(impl->tag, tag, LOADER_NAMING_TAG_SIZE);
+						impl->ctx = context_create(tag);
 
-						impl->exec_path_map = set_create(&hash_callback_str, &comparable_callback_str);
-
-						if (impl->exec_path_map != NULL)
+						if (impl->ctx != NULL)
 						{
-							return impl;
+							strncpy(impl->tag, tag, LOADER_NAMING_TAG_SIZE);
+
+							impl->exec_path_map = hashmap_create(&hash_callback_str, &comparable_callback_str);
+
+							if (impl->exec_path_map != NULL)
+							{
+								impl->path_index = loader_path_index_create();
+
+								if (impl->path_index != NULL)
+								{
+									return impl;
+								}
+
+								hashmap_destroy(impl->exec_path_map);
+							}
+
+							context_destroy(impl->ctx);
 						}
 
-						context_destroy(impl->ctx);
+						hashmap_concurrent_destroy(impl->type_info_map);
 					}
 
-					set_destroy(impl->type_info_map);
+					hashmap_concurrent_destroy(impl->identity_map);
 				}
 
-				set_destroy(impl->handle_impl_map);
+				hashmap_concurrent_destroy(impl->handle_impl_map);
 			}
 		}
 
@@ -423,6 +747,30 @@ loader_impl_interface loader_impl_symbol(loader_impl impl)
 	return NULL;
 }
 
+int loader_impl_parallel(loader_impl impl, function func)
+{
+	loader_impl_interface interface_impl = loader_impl_symbol(impl);
+
+	if (interface_impl == NULL || interface_impl->parallel == NULL)
+	{
+		return 0;
+	}
+
+	return interface_impl->parallel(impl, func);
+}
+
+void *loader_impl_address(loader_impl impl, function func)
+{
+	loader_impl_interface interface_impl = loader_impl_symbol(impl);
+
+	if (interface_impl == NULL || interface_impl->address == NULL)
+	{
+		return NULL;
+	}
+
+	return interface_impl->address(impl, func);
+}
+
 loader_naming_tag *loader_impl_tag(loader_impl impl)
 {
 	if (impl != NULL)
@@ -447,7 +795,17 @@ type loader_impl_type(loader_impl impl, const char *name)
 {
 	if (impl != NULL && impl->type_info_map != NULL && name != NULL)
 	{
-		return (type)set_get(impl->type_info_map, (const set_key)name);
+		return (type)hashmap_concurrent_get(impl->type_info_map, (const hashmap_key)name);
+	}
+
+	return NULL;
+}
+
+type loader_impl_type_builtin(loader_impl impl, type_id id)
+{
+	if (impl != NULL && id >= 0 && id < TYPE_SIZE)
+	{
+		return impl->builtin_types[id];
 	}
 
 	return NULL;
@@ -457,7 +815,20 @@ int loader_impl_type_define(loader_impl impl, const char *name, type t)
 {
 	if (impl != NULL && impl->type_info_map != NULL && name != NULL)
 	{
-		return set_insert(impl->type_info_map, (const set_key)name, (set_value)t);
+		if (t != NULL)
+		{
+			type_id id = type_index(t);
+
+			/* The first name defined for a builtin id becomes its canonical
+			runtime type, value_type_id driven conversions resolve it by
+			array indexing instead of hashing the name */
+			if (id >= 0 && id < TYPE_SIZE && impl->builtin_types[id] == NULL)
+			{
+				impl->builtin_types[id] = t;
+			}
+		}
+
+		return hashmap_concurrent_insert(impl->type_info_map, (const hashmap_key)name, (hashmap_value)t);
 	}
 
 	return 1;
@@ -477,6 +848,13 @@ loader_handle_impl loader_impl_load_handle(loader_impl impl, loader_handle modul
 
 		handle_impl->ctx = context_create(handle_impl->name);
 
+		handle_impl->discovery = NULL;
+		handle_impl->index = NULL;
+		handle_impl->export_cache = NULL;
+		handle_impl->paths = NULL;
+		handle_impl->paths_size = 0;
+		handle_impl->identity = NULL;
+
 		if (handle_impl->ctx != NULL)
 		{
 			return handle_impl;
@@ -511,11 +889,41 @@ void loader_impl_destroy_handle(loader_handle_impl handle_impl)
 			}
 		}
 
+		/* Capture the call counts of the run before the functions die */
+		loader_profile_harvest(handle_impl->impl->tag, context_scope(handle_impl->ctx));
+
 		if (handle_impl->populated == 0)
 		{
 			context_remove(handle_impl->impl->ctx, handle_impl->ctx);
 		}
 
+		if (handle_impl->discovery != NULL)
+		{
+			value_type_destroy(handle_impl->discovery);
+		}
+
+		if (handle_impl->index != NULL)
+		{
+			vector_destroy(handle_impl->index);
+		}
+
+		if (handle_impl->export_cache != NULL)
+		{
+			value_type_destroy(handle_impl->export_cache);
+		}
+
+		if (handle_impl->paths != NULL)
+		{
+			free(handle_impl->paths);
+		}
+
+		if (handle_impl->identity != NULL)
+		{
+			hashmap_concurrent_remove(handle_impl->impl->identity_map, handle_impl->identity);
+
+			free(handle_impl->identity);
+		}
+
 		context_destroy(handle_impl->ctx);
 
 		free(handle_impl);
@@ -533,13 +941,16 @@ int loader_impl_execution_path(loader_impl impl, const loader_naming_path path)
 
 			if (interface_impl != NULL)
 			{
+				/* Enumerate the directory once so later loads resolve scripts in memory */
+				loader_path_index_register(impl->path_index, path);
+
 				return interface_impl->execution_path(impl, path);
 			}
 		}
 		else
 		{
 			/* If loader is not initialized, store the execution path for later use */
-			vector paths = set_get(impl->exec_path_map, (set_key)impl->tag);
+			vector paths = hashmap_get(impl->exec_path_map, (hashmap_key)impl->tag);
 
 			if (paths == NULL)
 			{
@@ -550,7 +961,7 @@ int loader_impl_execution_path(loader_impl impl, const loader_naming_path path)
 					return 1;
 				}
 
-				if (set_insert(impl->exec_path_map, (set_key)impl->tag, paths) != 0)
+				if (hashmap_insert(impl->exec_path_map, (hashmap_key)impl->tag, paths) != 0)
 				{
 					vector_destroy(paths);
 
@@ -558,7 +969,503 @@ int loader_impl_execution_path(loader_impl impl, const loader_naming_path path)
 				}
 			}
 
-			vector_push_back(paths, (void *)path);
+			vector_push_back(paths, (void *)path);
+
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+static int loader_impl_handle_reload_snapshot_cb(scope sp, const char *key, value v, void *data)
+{
+	struct loader_handle_index_entry_type entry;
+
+	vector snapshot = data;
+
+	(void)sp;
+
+	entry.name = key;
+	entry.val = v;
+
+	vector_push_back(snapshot, &entry);
+
+	return 0;
+}
+
+int loader_impl_handle_reload(void *handle)
+{
+	loader_handle_impl handle_impl = handle;
+
+	loader_impl impl;
+
+	loader_impl_interface interface_impl;
+
+	loader_handle module;
+
+	context ctx_new;
+
+	scope sp_old, sp_new, sp_global = NULL;
+
+	vector snapshot;
+
+	size_t iterator, size;
+
+	if (handle_impl == NULL || handle_impl->paths == NULL || handle_impl->paths_size == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid handle for incremental reload, only handles loaded from file can be reloaded");
+
+		return 1;
+	}
+
+	impl = handle_impl->impl;
+
+	interface_impl = loader_impl_symbol(impl);
+
+	if (interface_impl == NULL)
+	{
+		return 1;
+	}
+
+	/* Parse the sources again into a fresh module and discover it into
+	a temporary context, the live one stays untouched on failure */
+	module = interface_impl->load_from_file(impl, (const loader_naming_path *)handle_impl->paths, handle_impl->paths_size);
+
+	if (module == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Reload of handle %s failed to load the sources", handle_impl->name);
+
+		return 1;
+	}
+
+	ctx_new = context_create(handle_impl->name);
+
+	if (ctx_new == NULL)
+	{
+		interface_impl->clear(impl, module);
+
+		return 1;
+	}
+
+	if (interface_impl->discover(impl, module, ctx_new) != 0)
+	{
+		context_destroy(ctx_new);
+
+		interface_impl->clear(impl, module);
+
+		return 1;
+	}
+
+	sp_old = context_scope(handle_impl->ctx);
+	sp_new = context_scope(ctx_new);
+
+	if (handle_impl->populated == 0)
+	{
+		/* The handle was appended to the global scope, keep it in sync */
+		sp_global = context_scope(impl->ctx);
+	}
+
+	/* Snapshot the discovered symbols, the scopes are mutated while diffing */
+	snapshot = vector_create_reserve(sizeof(struct loader_handle_index_entry_type), scope_size(sp_new));
+
+	if (snapshot == NULL)
+	{
+		context_destroy(ctx_new);
+
+		interface_impl->clear(impl, module);
+
+		return 1;
+	}
+
+	scope_iterate(sp_new, &loader_impl_handle_reload_snapshot_cb, snapshot);
+
+	size = vector_size(snapshot);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_handle_index_entry_type *entry = vector_at(snapshot, iterator);
+
+		value old_val = scope_get(sp_old, entry->name);
+
+		if (old_val != NULL && value_type_id(old_val) == TYPE_FUNCTION && value_type_id(entry->val) == TYPE_FUNCTION)
+		{
+			/* The symbol exists on both sides, swap the implementation
+			inside the live function object so cached pointers stay
+			valid; the old implementation leaves with the new shell */
+			function_rebind(value_to_function(old_val), value_to_function(entry->val));
+		}
+		else
+		{
+			/* New symbol, move it into the live scope */
+			value moved = scope_undef(sp_new, entry->name);
+
+			if (moved != NULL)
+			{
+				if (old_val != NULL)
+				{
+					value removed = scope_undef(sp_old, entry->name);
+
+					if (removed != NULL)
+					{
+						value_type_destroy(removed);
+					}
+				}
+
+				scope_define(sp_old, entry->name, moved);
+
+				if (sp_global != NULL)
+				{
+					scope_define(sp_global, entry->name, moved);
+				}
+			}
+		}
+	}
+
+	vector_clear(snapshot);
+
+	/* Symbols no longer discovered are removed from the live scope */
+	scope_iterate(sp_old, &loader_impl_handle_reload_snapshot_cb, snapshot);
+
+	size = vector_size(snapshot);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_handle_index_entry_type *entry = vector_at(snapshot, iterator);
+
+		if (scope_get(sp_new, entry->name) == NULL)
+		{
+			value removed = scope_undef(sp_old, entry->name);
+
+			if (sp_global != NULL)
+			{
+				scope_undef(sp_global, entry->name);
+			}
+
+			if (removed != NULL)
+			{
+				value_type_destroy(removed);
+			}
+		}
+	}
+
+	vector_destroy(snapshot);
+
+	/* Rebuild the resolution index and drop memoized exports */
+	if (handle_impl->index != NULL)
+	{
+		vector_destroy(handle_impl->index);
+
+		handle_impl->index = NULL;
+	}
+
+	loader_impl_handle_index_build(handle_impl);
+
+	if (handle_impl->export_cache != NULL)
+	{
+		value_type_destroy(handle_impl->export_cache);
+
+		handle_impl->export_cache = NULL;
+	}
+
+	/* The temporary context now owns the swapped out implementations */
+	context_destroy(ctx_new);
+
+	if (interface_impl->clear(impl, handle_impl->module) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Reload of handle %s could not clear the previous module", handle_impl->name);
+	}
+
+	handle_impl->module = module;
+
+	return 0;
+}
+
+int loader_impl_function_hook_call(context ctx, const char func_name[])
+{
+	scope sp = context_scope(ctx);
+
+	value val = scope_get(sp, func_name);
+
+	function func_init = NULL;
+
+	if (val != NULL)
+	{
+		func_init = value_to_function(val);
+	}
+
+	if (func_init != NULL)
+	{
+		void *null_args[1] = { NULL };
+
+		function_return ret = function_call(func_init, null_args, 0);
+
+		if (ret != NULL)
+		{
+			int result = value_to_int(ret);
+
+			value_destroy(ret);
+
+			return result;
+		}
+	}
+
+	return 0;
+}
+
+int loader_impl_handle_index_build_cb(scope sp, const char *key, value v, void *data)
+{
+	struct loader_handle_index_entry_type entry;
+
+	vector index = data;
+
+	(void)sp;
+
+	entry.name = key;
+	entry.val = v;
+
+	vector_push_back(index, &entry);
+
+	return 0;
+}
+
+int loader_impl_handle_index_compare(const void *left, const void *right)
+{
+	const struct loader_handle_index_entry_type *left_entry = left;
+	const struct loader_handle_index_entry_type *right_entry = right;
+
+	if (left_entry->name < right_entry->name)
+	{
+		return -1;
+	}
+
+	return left_entry->name > right_entry->name;
+}
+
+void loader_impl_handle_index_build(loader_handle_impl handle_impl)
+{
+	scope sp = context_scope(handle_impl->ctx);
+
+	vector index = vector_create_reserve(sizeof(struct loader_handle_index_entry_type), scope_size(sp));
+
+	if (index == NULL)
+	{
+		return;
+	}
+
+	if (scope_iterate(sp, &loader_impl_handle_index_build_cb, index) != 0)
+	{
+		vector_destroy(index);
+
+		return;
+	}
+
+	qsort(vector_front(index), vector_size(index), sizeof(struct loader_handle_index_entry_type), &loader_impl_handle_index_compare);
+
+	handle_impl->index = index;
+}
+
+value loader_impl_handle_get(void *handle, const char *name)
+{
+	loader_handle_impl handle_impl = handle;
+
+	const char *interned = string_intern(name);
+
+	if (handle_impl->index != NULL && interned != NULL)
+	{
+		struct loader_handle_index_entry_type *entries = vector_front(handle_impl->index);
+
+		size_t begin = 0, end = vector_size(handle_impl->index);
+
+		while (begin < end)
+		{
+			size_t middle = begin + ((end - begin) >> 1);
+
+			if (entries[middle].name < interned)
+			{
+				begin = middle + 1;
+			}
+			else if (entries[middle].name > interned)
+			{
+				end = middle;
+			}
+			else
+			{
+				return entries[middle].val;
+			}
+		}
+	}
+
+	/* The index is a snapshot taken when the handle finished loading,
+	fall back to the scope in case it could not be built */
+	if (handle_impl->index == NULL)
+	{
+		return scope_get(context_scope(handle_impl->ctx), name);
+	}
+
+	return NULL;
+}
+
+int loader_impl_handle_init(loader_impl impl, char *name, loader_handle_impl handle_impl, void **handle_ptr, int populated)
+{
+	static const char func_init_name[] = LOADER_IMPL_FUNCTION_INIT;
+
+	int result = loader_impl_function_hook_call(impl->ctx, func_init_name);
+
+	handle_impl->populated = populated;
+
+	loader_impl_handle_index_build(handle_impl);
+
+	if (result != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Error when calling to init hook function (" LOADER_IMPL_FUNCTION_INIT ") of handle: %s", name);
+	}
+
+	if (handle_ptr != NULL)
+	{
+		*handle_ptr = handle_impl;
+	}
+
+	return result;
+}
+
+int loader_impl_profile_warm_cb_iterate(scope sp, const char *key, value v, void *data)
+{
+	loader_impl impl = data;
+
+	function func;
+
+	(void)sp;
+
+	if (value_type_id(v) != TYPE_FUNCTION)
+	{
+		return 0;
+	}
+
+	func = value_to_function(v);
+
+	if (loader_profile_hot(impl->tag, key, signature_count(function_signature(func))) == 0)
+	{
+		return 0;
+	}
+
+	/* Build the cached metadata now, inspection of a hot function
+	after boot resolves without touching the runtime */
+	{
+		value metadata = function_metadata(func);
+
+		if (metadata != NULL)
+		{
+			value_type_destroy(metadata);
+		}
+	}
+
+	if (impl->profile_warm != NULL)
+	{
+		impl->profile_warm(impl, func, impl->profile_warm_data);
+	}
+
+	return 0;
+}
+
+void loader_impl_profile_warm_handle(loader_impl impl, loader_handle_impl handle_impl)
+{
+	if (loader_profile_enabled() != 0)
+	{
+		scope_iterate(context_scope(handle_impl->ctx), &loader_impl_profile_warm_cb_iterate, impl);
+	}
+}
+
+int loader_impl_profile_register(loader_impl impl, loader_impl_profile_warm_cb warm, void *data)
+{
+	if (impl == NULL)
+	{
+		return 1;
+	}
+
+	impl->profile_warm = warm;
+
+	impl->profile_warm_data = data;
+
+	return 0;
+}
+
+int loader_impl_gc_register(loader_impl impl, loader_impl_gc_collect_cb collect, loader_impl_gc_hint_cb hint, loader_impl_gc_stats_cb stats, void *data)
+{
+	if (impl == NULL)
+	{
+		return 1;
+	}
+
+	impl->gc_collect = collect;
+
+	impl->gc_hint = hint;
+
+	impl->gc_stats = stats;
+
+	impl->gc_data = data;
+
+	return 0;
+}
+
+int loader_impl_gc_collect(loader_impl impl)
+{
+	if (impl == NULL || impl->gc_collect == NULL)
+	{
+		return 1;
+	}
+
+	return impl->gc_collect(impl, impl->gc_data);
+}
+
+int loader_impl_gc_hint(loader_impl impl, int defer)
+{
+	if (impl == NULL || impl->gc_hint == NULL)
+	{
+		return 1;
+	}
+
+	return impl->gc_hint(impl, defer, impl->gc_data);
+}
+
+int loader_impl_gc_stats(loader_impl impl, struct loader_impl_gc_stats_type *stats)
+{
+	if (impl == NULL || impl->gc_stats == NULL || stats == NULL)
+	{
+		return 1;
+	}
+
+	stats->heap_size = 0;
+
+	stats->collection_count = 0;
+
+	return impl->gc_stats(impl, stats, impl->gc_data);
+}
+
+int loader_impl_handle_register(loader_impl impl, char *name, loader_handle_impl handle_impl, void **handle_ptr)
+{
+	if (handle_ptr == NULL)
+	{
+		if (context_contains(impl->ctx, handle_impl->ctx) == 0)
+		{
+			/* TODO: This still does not protect duplicated names between different loaders global scope */
+			log_write("metacall", LOG_LEVEL_ERROR, "There are duplicated symbols already loaded in the global scope conflicting with handle: %s", name);
+		}
+		else if (context_append(impl->ctx, handle_impl->ctx) == 0)
+		{
+			if (loader_impl_handle_init(impl, name, handle_impl, handle_ptr, 0) == 0)
+			{
+				loader_impl_profile_warm_handle(impl, handle_impl);
+
+				return 0;
+			}
+		}
+	}
+	else
+	{
+		if (loader_impl_handle_init(impl, name, handle_impl, handle_ptr, 1) == 0)
+		{
+			loader_impl_profile_warm_handle(impl, handle_impl);
 
 			return 0;
 		}
@@ -567,79 +1474,129 @@ int loader_impl_execution_path(loader_impl impl, const loader_naming_path path)
 	return 1;
 }
 
-int loader_impl_function_hook_call(context ctx, const char func_name[])
-{
-	scope sp = context_scope(ctx);
+/* -- Canonical Identity Index -- */
 
-	value val = scope_get(sp, func_name);
+/* Duplicate loads are detected through a canonical identity instead
+of comparing paths: files resolve to their device and inode pair
+(volume serial and file index on win32) so a symlink or relative alias
+of an already loaded script hits the index in O(1), and memory loads
+resolve to a hash of their content */
 
-	function func_init = NULL;
+uint64_t loader_impl_identity_hash(uint64_t h, const void *data, size_t size)
+{
+	const unsigned char *bytes = data;
 
-	if (val != NULL)
+	size_t iterator;
+
+	for (iterator = 0; iterator < size; ++iterator)
 	{
-		func_init = value_to_function(val);
+		h ^= (uint64_t)bytes[iterator];
+		h *= 0x00000100000001B3ULL;
 	}
 
-	if (func_init != NULL)
+	return h;
+}
+
+int loader_impl_identity_file(const loader_naming_path paths[], size_t size, char identity[LOADER_IMPL_IDENTITY_SIZE])
+{
+	uint64_t h = 0xCBF29CE484222325ULL;
+
+	size_t iterator;
+
+	identity[0] = '\0';
+
+	for (iterator = 0; iterator < size; ++iterator)
 	{
-		void *null_args[1] = { NULL };
+		uint64_t index[2];
 
-		function_return ret = function_call(func_init, null_args, 0);
+#if defined(_WIN32)
+		BY_HANDLE_FILE_INFORMATION info;
 
-		if (ret != NULL)
+		HANDLE file = CreateFileA(paths[iterator], 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, NULL);
+
+		if (file == INVALID_HANDLE_VALUE)
 		{
-			int result = value_to_int(ret);
+			return 1;
+		}
 
-			value_destroy(ret);
+		if (GetFileInformationByHandle(file, &info) == 0)
+		{
+			CloseHandle(file);
 
-			return result;
+			return 1;
+		}
+
+		CloseHandle(file);
+
+		index[0] = (uint64_t)info.dwVolumeSerialNumber;
+		index[1] = (((uint64_t)info.nFileIndexHigh) << 32) | (uint64_t)info.nFileIndexLow;
+#else
+		struct stat info;
+
+		if (stat(paths[iterator], &info) != 0)
+		{
+			/* Paths a runtime resolves through its own mechanisms stay
+			out of the index, the name based detection still covers them */
+			return 1;
 		}
+
+		index[0] = (uint64_t)info.st_dev;
+		index[1] = (uint64_t)info.st_ino;
+#endif
+
+		h = loader_impl_identity_hash(h, index, sizeof(index));
 	}
 
+	snprintf(identity, LOADER_IMPL_IDENTITY_SIZE, "f:%016" PRIx64, h);
+
 	return 0;
 }
 
-int loader_impl_handle_init(loader_impl impl, char *name, loader_handle_impl handle_impl, void **handle_ptr, int populated)
+void loader_impl_identity_memory(const char *buffer, size_t size, char identity[LOADER_IMPL_IDENTITY_SIZE])
 {
-	static const char func_init_name[] = LOADER_IMPL_FUNCTION_INIT;
-
-	int result = loader_impl_function_hook_call(impl->ctx, func_init_name);
-
-	handle_impl->populated = populated;
+	uint64_t h = loader_impl_identity_hash(0xCBF29CE484222325ULL, buffer, size);
 
-	if (result != 0)
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Error when calling to init hook function (" LOADER_IMPL_FUNCTION_INIT ") of handle: %s", name);
-	}
+	snprintf(identity, LOADER_IMPL_IDENTITY_SIZE, "m:%016" PRIx64, h);
+}
 
-	if (handle_ptr != NULL)
+loader_handle_impl loader_impl_identity_get(loader_impl impl, const char identity[LOADER_IMPL_IDENTITY_SIZE])
+{
+	if (impl->identity_map == NULL || identity[0] == '\0')
 	{
-		*handle_ptr = handle_impl;
+		return NULL;
 	}
 
-	return result;
+	return (loader_handle_impl)hashmap_concurrent_get(impl->identity_map, (hashmap_key)identity);
 }
 
-int loader_impl_handle_register(loader_impl impl, char *name, loader_handle_impl handle_impl, void **handle_ptr)
+void loader_impl_identity_register(loader_impl impl, loader_handle_impl handle_impl, const char identity[LOADER_IMPL_IDENTITY_SIZE])
 {
-	if (handle_ptr == NULL)
+	size_t length;
+
+	/* A handle without identity (unresolvable paths) is only findable
+	by name, loading an alias of it again falls back to the old cost */
+	if (impl->identity_map == NULL || identity[0] == '\0')
 	{
-		if (context_contains(impl->ctx, handle_impl->ctx) == 0)
-		{
-			/* TODO: This still does not protect duplicated names between different loaders global scope */
-			log_write("metacall", LOG_LEVEL_ERROR, "There are duplicated symbols already loaded in the global scope conflicting with handle: %s", name);
-		}
-		else if (context_append(impl->ctx, handle_impl->ctx) == 0)
-		{
-			return loader_impl_handle_init(impl, name, handle_impl, handle_ptr, 0);
-		}
+		return;
 	}
-	else
+
+	length = strlen(identity) + 1;
+
+	handle_impl->identity = malloc(length);
+
+	if (handle_impl->identity == NULL)
 	{
-		return loader_impl_handle_init(impl, name, handle_impl, handle_ptr, 1);
+		return;
 	}
 
-	return 1;
+	memcpy(handle_impl->identity, identity, length);
+
+	if (hashmap_concurrent_insert(impl->identity_map, handle_impl->identity, handle_impl) != 0)
+	{
+		free(handle_impl->identity);
+
+		handle_impl->identity = NULL;
+	}
 }
 
 int loader_impl_load_from_file(loader_impl impl, const loader_naming_path paths[], size_t size, void **handle_ptr)
@@ -674,7 +1631,53 @@ int loader_impl_load_from_file(loader_impl impl, const loader_naming_path paths[
 				return 1;
 			}
 
-			handle = interface_impl->load_from_file(impl, paths, size);
+			uint64_t discovery_hash = loader_discovery_cache_hash(paths, size);
+
+			/* Resolve bare script names against the execution path index, the
+			loader plugin receives absolute paths instead of probing each
+			execution path on the filesystem; unresolved paths pass through
+			unchanged so runtime specific resolution still applies */
+			loader_naming_path *resolved_paths = malloc(sizeof(loader_naming_path) * size);
+
+			if (resolved_paths != NULL)
+			{
+				for (iterator = 0; iterator < size; ++iterator)
+				{
+					if (loader_path_is_absolute(paths[iterator]) == 0 || loader_path_index_resolve(impl->path_index, paths[iterator], resolved_paths[iterator]) != 0)
+					{
+						strncpy(resolved_paths[iterator], paths[iterator], LOADER_NAMING_PATH_SIZE);
+					}
+				}
+			}
+
+			/* The canonical identity catches reloads of the same files
+			through a different spelling (symlinks, relative aliases)
+			that the name comparison above cannot see */
+			char identity[LOADER_IMPL_IDENTITY_SIZE] = { 0 };
+
+			if (loader_impl_identity_file(resolved_paths != NULL ? (const loader_naming_path *)resolved_paths : paths, size, identity) == 0)
+			{
+				loader_handle_impl duplicated = loader_impl_identity_get(impl, identity);
+
+				if (duplicated != NULL)
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "Load from file handle failed, the files are already loaded as handle %s", duplicated->name);
+
+					if (resolved_paths != NULL)
+					{
+						free(resolved_paths);
+					}
+
+					return 1;
+				}
+			}
+
+			handle = interface_impl->load_from_file(impl, resolved_paths != NULL ? (const loader_naming_path *)resolved_paths : paths, size);
+
+			if (resolved_paths != NULL)
+			{
+				free(resolved_paths);
+			}
 
 			log_write("metacall", LOG_LEVEL_DEBUG, "Loader interface: %p; Loader handle: %p", (void *)interface_impl, (void *)handle);
 
@@ -688,17 +1691,49 @@ int loader_impl_load_from_file(loader_impl impl, const loader_naming_path paths[
 				{
 					handle_impl->populated = 1;
 
-					if (set_insert(impl->handle_impl_map, handle_impl->name, handle_impl) == 0)
+					/* Keep a copy of the paths so the handle can be reloaded incrementally */
+					handle_impl->paths = malloc(sizeof(loader_naming_path) * size);
+
+					if (handle_impl->paths != NULL)
+					{
+						for (iterator = 0; iterator < size; ++iterator)
+						{
+							strncpy(handle_impl->paths[iterator], paths[iterator], LOADER_NAMING_PATH_SIZE);
+						}
+
+						handle_impl->paths_size = size;
+					}
+
+					/* A hit exposes the signatures of the previous boot through
+					loader_impl_handle_discovery so the loader plugin can skip
+					per function introspection while it binds the entry points */
+					handle_impl->discovery = loader_discovery_cache_fetch(discovery_hash);
+
+					if (hashmap_concurrent_insert(impl->handle_impl_map, handle_impl->name, handle_impl) == 0)
 					{
 						if (interface_impl->discover(impl, handle_impl->module, handle_impl->ctx) == 0)
 						{
+							if (handle_impl->discovery == NULL)
+							{
+								value discovery = scope_metadata(context_scope(handle_impl->ctx));
+
+								if (discovery != NULL)
+								{
+									loader_discovery_cache_store(discovery_hash, discovery);
+
+									handle_impl->discovery = discovery;
+								}
+							}
+
 							if (loader_impl_handle_register(impl, module_name, handle_impl, handle_ptr) == 0)
 							{
+								loader_impl_identity_register(impl, handle_impl, identity);
+
 								return 0;
 							}
 						}
 
-						set_remove(impl->handle_impl_map, handle_impl->name);
+						hashmap_concurrent_remove(impl->handle_impl_map, handle_impl->name);
 					}
 
 					log_write("metacall", LOG_LEVEL_ERROR, "Error when loading handle: %s", module_name);
@@ -767,6 +1802,23 @@ int loader_impl_load_from_memory(loader_impl impl, const char *buffer, size_t si
 				return 1;
 			}
 
+			/* The content hash catches the same buffer loaded again from
+			a different address, which the generated name cannot see */
+			char identity[LOADER_IMPL_IDENTITY_SIZE] = { 0 };
+
+			loader_impl_identity_memory(buffer, size, identity);
+
+			{
+				loader_handle_impl duplicated = loader_impl_identity_get(impl, identity);
+
+				if (duplicated != NULL)
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "Load from memory handle failed, the buffer is already loaded as handle %s", duplicated->name);
+
+					return 1;
+				}
+			}
+
 			handle = interface_impl->load_from_memory(impl, name, buffer, size);
 
 			log_write("metacall", LOG_LEVEL_DEBUG, "Loader interface: %p\nLoader handle: %p", (void *)interface_impl, (void *)handle);
@@ -779,17 +1831,19 @@ int loader_impl_load_from_memory(loader_impl impl, const char *buffer, size_t si
 				{
 					handle_impl->populated = 1;
 
-					if (set_insert(impl->handle_impl_map, handle_impl->name, handle_impl) == 0)
+					if (hashmap_concurrent_insert(impl->handle_impl_map, handle_impl->name, handle_impl) == 0)
 					{
 						if (interface_impl->discover(impl, handle_impl->module, handle_impl->ctx) == 0)
 						{
 							if (loader_impl_handle_register(impl, name, handle_impl, handle_ptr) == 0)
 							{
+								loader_impl_identity_register(impl, handle_impl, identity);
+
 								return 0;
 							}
 						}
 
-						set_remove(impl->handle_impl_map, handle_impl->name);
+						hashmap_concurrent_remove(impl->handle_impl_map, handle_impl->name);
 					}
 
 					log_write("metacall", LOG_LEVEL_ERROR, "Error when loading handle: %s", name);
@@ -827,6 +1881,20 @@ int loader_impl_load_from_package(loader_impl impl, const loader_naming_path pat
 				return 1;
 			}
 
+			char identity[LOADER_IMPL_IDENTITY_SIZE] = { 0 };
+
+			if (loader_impl_identity_file((const loader_naming_path *)path, 1, identity) == 0)
+			{
+				loader_handle_impl duplicated = loader_impl_identity_get(impl, identity);
+
+				if (duplicated != NULL)
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "Load from package handle failed, the package is already loaded as handle %s", duplicated->name);
+
+					return 1;
+				}
+			}
+
 			handle = interface_impl->load_from_package(impl, path);
 
 			log_write("metacall", LOG_LEVEL_DEBUG, "Loader interface: %p\nLoader handle: %p", (void *)interface_impl, (void *)handle);
@@ -839,17 +1907,19 @@ int loader_impl_load_from_package(loader_impl impl, const loader_naming_path pat
 				{
 					handle_impl->populated = 1;
 
-					if (set_insert(impl->handle_impl_map, handle_impl->name, handle_impl) == 0)
+					if (hashmap_concurrent_insert(impl->handle_impl_map, handle_impl->name, handle_impl) == 0)
 					{
 						if (interface_impl->discover(impl, handle_impl->module, handle_impl->ctx) == 0)
 						{
 							if (loader_impl_handle_register(impl, package_name, handle_impl, handle_ptr) == 0)
 							{
+								loader_impl_identity_register(impl, handle_impl, identity);
+
 								return 0;
 							}
 						}
 
-						set_remove(impl->handle_impl_map, handle_impl->name);
+						hashmap_concurrent_remove(impl->handle_impl_map, handle_impl->name);
 					}
 
 					log_write("metacall", LOG_LEVEL_ERROR, "Error when loading handle: %s", (void *)package_name);
@@ -867,7 +1937,7 @@ void *loader_impl_get_handle(loader_impl impl, const char *name)
 {
 	if (impl != NULL && name != NULL)
 	{
-		return (void *)set_get(impl->handle_impl_map, (set_key)name);
+		return (void *)hashmap_concurrent_get(impl->handle_impl_map, (hashmap_key)name);
 	}
 
 	return NULL;
@@ -902,7 +1972,21 @@ value loader_impl_handle_export(void *handle)
 {
 	loader_handle_impl handle_impl = handle;
 
-	return scope_export(context_scope(handle_impl->ctx));
+	if (handle_impl->export_cache == NULL)
+	{
+		handle_impl->export_cache = scope_export(context_scope(handle_impl->ctx));
+	}
+
+	/* The caller owns the result, hand out a copy of the cached map so
+	the walk over the scope hashmap happens at most once per handle */
+	return value_type_copy(handle_impl->export_cache);
+}
+
+value loader_impl_handle_discovery(void *handle)
+{
+	loader_handle_impl handle_impl = handle;
+
+	return handle_impl->discovery;
 }
 
 context loader_impl_handle_context(void *handle)
@@ -946,7 +2030,7 @@ value loader_impl_metadata_handle_name(loader_handle_impl handle_impl)
 	return v;
 }
 
-value loader_impl_metadata_handle_context(loader_handle_impl handle_impl)
+value loader_impl_metadata_handle_context(loader_handle_impl handle_impl, const char *name_prefix)
 {
 	static const char name[] = "scope";
 
@@ -968,7 +2052,7 @@ value loader_impl_metadata_handle_context(loader_handle_impl handle_impl)
 		return NULL;
 	}
 
-	v_ptr[1] = scope_metadata(context_scope(handle_impl->ctx));
+	v_ptr[1] = scope_metadata_filter(context_scope(handle_impl->ctx), name_prefix);
 
 	if (v_ptr[1] == NULL)
 	{
@@ -980,7 +2064,7 @@ value loader_impl_metadata_handle_context(loader_handle_impl handle_impl)
 	return v;
 }
 
-value loader_impl_metadata_handle(loader_handle_impl handle_impl)
+value loader_impl_metadata_handle(loader_handle_impl handle_impl, const char *name_prefix)
 {
 	value *v_ptr, v = value_create_map(NULL, 2);
 
@@ -1000,7 +2084,7 @@ value loader_impl_metadata_handle(loader_handle_impl handle_impl)
 		return NULL;
 	}
 
-	v_ptr[1] = loader_impl_metadata_handle_context(handle_impl);
+	v_ptr[1] = loader_impl_metadata_handle_context(handle_impl, name_prefix);
 
 	if (v_ptr[1] == NULL)
 	{
@@ -1012,14 +2096,14 @@ value loader_impl_metadata_handle(loader_handle_impl handle_impl)
 	return v;
 }
 
-int loader_impl_metadata_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args)
+int loader_impl_metadata_cb_iterate(hashmap_concurrent s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args)
 {
 	loader_impl_metadata_cb_iterator metadata_iterator = (loader_impl_metadata_cb_iterator)args;
 
 	(void)s;
 	(void)key;
 
-	metadata_iterator->values[metadata_iterator->iterator] = loader_impl_metadata_handle((loader_handle_impl)val);
+	metadata_iterator->values[metadata_iterator->iterator] = loader_impl_metadata_handle((loader_handle_impl)val, metadata_iterator->name_prefix);
 
 	if (metadata_iterator->values[metadata_iterator->iterator] != NULL)
 	{
@@ -1030,10 +2114,45 @@ int loader_impl_metadata_cb_iterate(set s, set_key key, set_value val, set_cb_it
 }
 
 value loader_impl_metadata(loader_impl impl)
+{
+	return loader_impl_metadata_filter(impl, NULL, NULL);
+}
+
+value loader_impl_metadata_filter(loader_impl impl, const char *handle_name, const char *name_prefix)
 {
 	struct loader_impl_metadata_cb_iterator_type metadata_iterator;
 
-	value v = value_create_array(NULL, set_size(impl->handle_impl_map));
+	value v;
+
+	if (handle_name != NULL)
+	{
+		loader_handle_impl handle_impl = (loader_handle_impl)hashmap_concurrent_get(impl->handle_impl_map, (hashmap_key)handle_name);
+
+		if (handle_impl == NULL)
+		{
+			return value_create_array(NULL, 0);
+		}
+
+		v = value_create_array(NULL, 1);
+
+		if (v == NULL)
+		{
+			return NULL;
+		}
+
+		value_to_array(v)[0] = loader_impl_metadata_handle(handle_impl, name_prefix);
+
+		if (value_to_array(v)[0] == NULL)
+		{
+			value_type_destroy(v);
+
+			return NULL;
+		}
+
+		return v;
+	}
+
+	v = value_create_array(NULL, hashmap_concurrent_size(impl->handle_impl_map));
 
 	if (v == NULL)
 	{
@@ -1042,8 +2161,9 @@ value loader_impl_metadata(loader_impl impl)
 
 	metadata_iterator.iterator = 0;
 	metadata_iterator.values = value_to_array(v);
+	metadata_iterator.name_prefix = name_prefix;
 
-	set_iterate(impl->handle_impl_map, &loader_impl_metadata_cb_iterate, (set_cb_iterate_args)&metadata_iterator);
+	hashmap_concurrent_iterate(impl->handle_impl_map, &loader_impl_metadata_cb_iterate, (hashmap_cb_iterate_args)&metadata_iterator);
 
 	return v;
 }
@@ -1056,7 +2176,7 @@ int loader_impl_clear(void *handle)
 
 		loader_impl impl = handle_impl->impl;
 
-		int result = !(set_remove(impl->handle_impl_map, (set_key)(handle_impl->name)) == handle_impl);
+		int result = !(hashmap_concurrent_remove(impl->handle_impl_map, (hashmap_key)(handle_impl->name)) == handle_impl);
 
 		loader_impl_destroy_handle(handle_impl);
 
@@ -1066,7 +2186,7 @@ int loader_impl_clear(void *handle)
 	return 1;
 }
 
-int loader_impl_destroy_type_map_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args)
+int loader_impl_destroy_type_map_cb_iterate(hashmap_concurrent s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args)
 {
 	(void)s;
 	(void)key;
@@ -1084,7 +2204,7 @@ int loader_impl_destroy_type_map_cb_iterate(set s, set_key key, set_value val, s
 	return 1;
 }
 
-int loader_impl_destroy_handle_map_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args)
+int loader_impl_destroy_handle_map_cb_iterate(hashmap_concurrent s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args)
 {
 	(void)s;
 	(void)key;
@@ -1102,7 +2222,7 @@ int loader_impl_destroy_handle_map_cb_iterate(set s, set_key key, set_value val,
 	return 1;
 }
 
-int loader_impl_destroy_exec_path_map_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args)
+int loader_impl_destroy_exec_path_map_cb_iterate(hashmap s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args)
 {
 	(void)s;
 	(void)key;
@@ -1129,13 +2249,16 @@ void loader_impl_destroy_objects(loader_impl impl)
 	*/
 	if (impl != NULL)
 	{
-		set_iterate(impl->handle_impl_map, &loader_impl_destroy_handle_map_cb_iterate, NULL);
+		hashmap_concurrent_iterate(impl->handle_impl_map, &loader_impl_destroy_handle_map_cb_iterate, NULL);
 
-		set_destroy(impl->handle_impl_map);
+		hashmap_concurrent_destroy(impl->handle_impl_map);
 
-		set_iterate(impl->type_info_map, &loader_impl_destroy_type_map_cb_iterate, NULL);
+		/* The handles removed their identity entries while dying */
+		hashmap_concurrent_destroy(impl->identity_map);
 
-		set_destroy(impl->type_info_map);
+		hashmap_concurrent_iterate(impl->type_info_map, &loader_impl_destroy_type_map_cb_iterate, NULL);
+
+		hashmap_concurrent_destroy(impl->type_info_map);
 	}
 }
 
@@ -1157,9 +2280,11 @@ void loader_impl_destroy(loader_impl impl)
 			impl->init = 1;
 		}
 
-		set_iterate(impl->exec_path_map, &loader_impl_destroy_exec_path_map_cb_iterate, NULL);
+		hashmap_iterate(impl->exec_path_map, &loader_impl_destroy_exec_path_map_cb_iterate, NULL);
+
+		hashmap_destroy(impl->exec_path_map);
 
-		set_destroy(impl->exec_path_map);
+		loader_path_index_destroy(impl->path_index);
 
 		context_destroy(impl->ctx);
 
@@ -1168,3 +2293,144 @@ void loader_impl_destroy(loader_impl impl)
 		free(impl);
 	}
 }
+
+/* -- Conversion Registry -- */
+
+static vector converter_registry = NULL;
+static threading_mutex converter_registry_mutex = NULL;
+
+static int loader_impl_converter_registry_initialize(void)
+{
+	if (converter_registry != NULL)
+	{
+		return 0;
+	}
+
+	converter_registry = vector_create(sizeof(struct loader_impl_converter_entry_type));
+
+	if (converter_registry == NULL)
+	{
+		return 1;
+	}
+
+	converter_registry_mutex = threading_mutex_create();
+
+	if (converter_registry_mutex == NULL)
+	{
+		vector_destroy(converter_registry);
+
+		converter_registry = NULL;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+int loader_impl_converter_register(const loader_naming_tag src, const loader_naming_tag dst, type_id id, loader_impl_converter converter, void *context)
+{
+	struct loader_impl_converter_entry_type entry;
+
+	size_t iterator, size;
+
+	if (src == NULL || dst == NULL || loader_impl_converter_registry_initialize() != 0)
+	{
+		return 1;
+	}
+
+	entry.src = string_intern(src);
+	entry.dst = string_intern(dst);
+	entry.id = id;
+	entry.converter = converter;
+	entry.context = context;
+
+	if (entry.src == NULL || entry.dst == NULL)
+	{
+		return 1;
+	}
+
+	threading_mutex_lock(converter_registry_mutex);
+
+	size = vector_size(converter_registry);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_impl_converter_entry_type *current = vector_at(converter_registry, iterator);
+
+		if (current->src == entry.src && current->dst == entry.dst && current->id == entry.id)
+		{
+			/* A null converter unregisters the pair */
+			current->converter = converter;
+			current->context = context;
+
+			threading_mutex_unlock(converter_registry_mutex);
+
+			return 0;
+		}
+	}
+
+	vector_push_back(converter_registry, &entry);
+
+	threading_mutex_unlock(converter_registry_mutex);
+
+	return 0;
+}
+
+loader_impl_converter loader_impl_converter_get(const loader_naming_tag src, const loader_naming_tag dst, type_id id, void **context)
+{
+	loader_impl_converter converter = NULL;
+
+	const char *src_interned, *dst_interned;
+
+	size_t iterator, size;
+
+	if (src == NULL || dst == NULL || converter_registry == NULL)
+	{
+		return NULL;
+	}
+
+	src_interned = string_intern(src);
+	dst_interned = string_intern(dst);
+
+	threading_mutex_lock(converter_registry_mutex);
+
+	size = vector_size(converter_registry);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_impl_converter_entry_type *current = vector_at(converter_registry, iterator);
+
+		if (current->src == src_interned && current->dst == dst_interned && current->id == id)
+		{
+			converter = current->converter;
+
+			if (context != NULL)
+			{
+				*context = current->context;
+			}
+
+			break;
+		}
+	}
+
+	threading_mutex_unlock(converter_registry_mutex);
+
+	return converter;
+}
+
+void loader_impl_converter_registry_destroy(void)
+{
+	if (converter_registry != NULL)
+	{
+		vector_destroy(converter_registry);
+
+		converter_registry = NULL;
+	}
+
+	if (converter_registry_mutex != NULL)
+	{
+		threading_mutex_destroy(converter_registry_mutex);
+
+		converter_registry_mutex = NULL;
+	}
+}
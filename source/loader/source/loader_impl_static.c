@@ -0,0 +1,82 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A library for loading executable code at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <loader/loader_impl_static.h>
+
+#include <string.h>
+
+/* -- Type Definitions -- */
+
+struct loader_impl_static_entry_type
+{
+	loader_naming_tag tag;
+	loader_impl_interface_singleton singleton;
+};
+
+/* -- Private Variables -- */
+
+/* Populated by constructors before main, single threaded by then, so
+the table needs no synchronization and must not touch the log or any
+other subsystem that requires initialization */
+static struct loader_impl_static_entry_type loader_impl_static_registry[LOADER_IMPL_STATIC_SIZE];
+
+static size_t loader_impl_static_count = 0;
+
+/* -- Methods -- */
+
+int loader_impl_static_register(const loader_naming_tag tag, loader_impl_interface_singleton singleton)
+{
+	if (tag == NULL || singleton == NULL || loader_impl_static_count >= LOADER_IMPL_STATIC_SIZE)
+	{
+		return 1;
+	}
+
+	strncpy(loader_impl_static_registry[loader_impl_static_count].tag, tag, LOADER_NAMING_TAG_SIZE - 1);
+
+	loader_impl_static_registry[loader_impl_static_count].tag[LOADER_NAMING_TAG_SIZE - 1] = '\0';
+
+	loader_impl_static_registry[loader_impl_static_count].singleton = singleton;
+
+	++loader_impl_static_count;
+
+	return 0;
+}
+
+loader_impl_interface_singleton loader_impl_static_get(const loader_naming_tag tag)
+{
+	size_t iterator;
+
+	if (tag == NULL)
+	{
+		return NULL;
+	}
+
+	for (iterator = 0; iterator < loader_impl_static_count; ++iterator)
+	{
+		if (strncmp(loader_impl_static_registry[iterator].tag, tag, LOADER_NAMING_TAG_SIZE) == 0)
+		{
+			return loader_impl_static_registry[iterator].singleton;
+		}
+	}
+
+	return NULL;
+}
@@ -0,0 +1,105 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A library for loading executable code at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <loader/loader_naming.h>
+
+#include <string.h>
+
+/* -- Definitions -- */
+
+#define LOADER_NAMING_DISPATCH_SIZE ((size_t)0x40)
+
+/* -- Member Data -- */
+
+struct loader_naming_dispatch_entry_type
+{
+	const char *extension;
+	const char *tag;
+};
+
+/* Extension dispatch table laid out by a perfect hash
+(ext[0] + 19 * ext[len - 1] + 44 * len, modulo the table size), chosen
+so every known extension lands in its own slot and resolution is one
+probe plus one confirming comparison, no scanning */
+static const struct loader_naming_dispatch_entry_type loader_naming_dispatch[LOADER_NAMING_DISPATCH_SIZE] = {
+	[3] = { "py", "py" },
+	[4] = { "cs", "cs" },
+	[6] = { "jl", "jl" },
+	[8] = { "ll", "llvm" },
+	[11] = { "js", "node" }, /* By default js uses the NodeJS loader instead of the V8 loader */
+	[13] = { "java", "java" },
+	[14] = { "mock", "mock" },
+	[15] = { "rpc", "rpc" },
+	[16] = { "rb", "rb" },
+	[19] = { "bc", "llvm" },
+	[20] = { "vb", "cs" },
+	[21] = { "ts", "ts" },
+	[22] = { "jsx", "ts" },
+	[23] = { "wat", "wasm" },
+	[29] = { "node", "node" },
+	[32] = { "tsx", "ts" },
+	[34] = { "cpy", "cob" },
+	[35] = { "lua", "lua" },
+	[36] = { "jar", "java" },
+	[40] = { "c", "c" },
+	[43] = { "cbl", "cob" },
+	[44] = { "dll", "cs" },
+	[45] = { "cob", "cob" },
+	[48] = { "dart", "dart" },
+	[49] = { "cr", "cr" },
+	[62] = { "wasm", "wasm" }
+};
+
+/* -- Private Methods -- */
+
+static size_t loader_naming_dispatch_hash(const char *extension, size_t length)
+{
+	return ((size_t)(unsigned char)extension[0] +
+			   19 * (size_t)(unsigned char)extension[length - 1] +
+			   44 * length) &
+		   (LOADER_NAMING_DISPATCH_SIZE - 1);
+}
+
+/* -- Methods -- */
+
+const char *loader_naming_tag_from_extension(const char *extension)
+{
+	size_t length;
+
+	const struct loader_naming_dispatch_entry_type *entry;
+
+	if (extension == NULL || extension[0] == '\0')
+	{
+		return NULL;
+	}
+
+	length = strlen(extension);
+
+	entry = &loader_naming_dispatch[loader_naming_dispatch_hash(extension, length)];
+
+	if (entry->extension != NULL && strcmp(entry->extension, extension) == 0)
+	{
+		return entry->tag;
+	}
+
+	return NULL;
+}
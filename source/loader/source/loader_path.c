@@ -8,6 +8,11 @@
 
 #include <loader/loader_path.h>
 
+#include <adt/adt_set.h>
+
+#include <threading/threading_mutex.h>
+
+#include <stdlib.h>
 #include <string.h>
 
 #if defined(WIN32) || defined(_WIN32) ||            \
@@ -192,9 +197,20 @@ int loader_path_is_absolute(const loader_naming_path path)
 }
 
 size_t loader_path_join(const loader_naming_path left_path, size_t left_path_size, const loader_naming_path right_path, size_t right_path_size, loader_naming_path join_path)
+{
+	return loader_path_join_buffer(left_path, left_path_size, right_path, right_path_size, join_path, LOADER_NAMING_PATH_SIZE);
+}
+
+size_t loader_path_join_buffer(const char *left_path, size_t left_path_size, const char *right_path, size_t right_path_size, char *join_path, size_t join_size)
 {
 	size_t size = 0;
 
+	/* Reject instead of truncating, a truncated path would be looked up */
+	if (left_path_size + right_path_size > join_size)
+	{
+		return 0;
+	}
+
 	if (left_path_size > 1)
 	{
 		size_t trailing_size = LOADER_PATH_SEPARATOR(left_path[left_path_size - 2]) + LOADER_PATH_SEPARATOR(right_path[0]);
@@ -329,3 +345,170 @@ size_t loader_path_canonical(const loader_naming_path path, size_t size, loader_
 
 	return canonical_size;
 }
+
+/* -- Canonical Path Cache -- */
+
+struct loader_path_cache_entry_type
+{
+	char *canonical; /**< Canonicalized path bytes including the null terminator */
+	size_t size;	 /**< Size returned by loader_path_canonical for this input */
+};
+
+typedef struct loader_path_cache_entry_type *loader_path_cache_entry;
+
+static set loader_path_cache_map = NULL;
+
+static threading_mutex loader_path_cache_mutex = NULL;
+
+static int loader_path_cache_initialize(void)
+{
+	/* Lazy initialization, the first canonicalization comes from the
+	boot path before concurrent loads exist */
+	if (loader_path_cache_map != NULL)
+	{
+		return 0;
+	}
+
+	loader_path_cache_mutex = threading_mutex_create();
+
+	if (loader_path_cache_mutex == NULL)
+	{
+		return 1;
+	}
+
+	loader_path_cache_map = set_create(&hash_callback_str, &comparable_callback_str);
+
+	if (loader_path_cache_map == NULL)
+	{
+		threading_mutex_destroy(loader_path_cache_mutex);
+
+		loader_path_cache_mutex = NULL;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+static int loader_path_cache_clear_cb(set s, set_key key, set_value value, set_cb_iterate_args args)
+{
+	loader_path_cache_entry entry = value;
+
+	(void)s;
+	(void)args;
+
+	free(entry->canonical);
+
+	free(entry);
+
+	free(key);
+
+	return 0;
+}
+
+size_t loader_path_canonical_cached(const loader_naming_path path, size_t size, loader_naming_path canonical)
+{
+	loader_path_cache_entry entry;
+
+	char *key;
+
+	size_t canonical_size;
+
+	if (size == 0 || size > LOADER_NAMING_PATH_SIZE || loader_path_cache_initialize() != 0)
+	{
+		return loader_path_canonical(path, size, canonical);
+	}
+
+	threading_mutex_lock(loader_path_cache_mutex);
+
+	entry = set_get(loader_path_cache_map, (set_key)path);
+
+	if (entry != NULL)
+	{
+		memcpy(canonical, entry->canonical, entry->size);
+
+		canonical_size = entry->size;
+
+		threading_mutex_unlock(loader_path_cache_mutex);
+
+		return canonical_size;
+	}
+
+	threading_mutex_unlock(loader_path_cache_mutex);
+
+	canonical_size = loader_path_canonical(path, size, canonical);
+
+	/* Memoize the result, a failed insertion only costs the next
+	lookup recomputing the same canonicalization */
+	entry = malloc(sizeof(struct loader_path_cache_entry_type));
+
+	if (entry == NULL)
+	{
+		return canonical_size;
+	}
+
+	entry->canonical = malloc(sizeof(char) * canonical_size);
+
+	if (entry->canonical == NULL)
+	{
+		free(entry);
+
+		return canonical_size;
+	}
+
+	memcpy(entry->canonical, canonical, canonical_size);
+
+	entry->size = canonical_size;
+
+	key = malloc(sizeof(char) * (size + 1));
+
+	if (key == NULL)
+	{
+		free(entry->canonical);
+
+		free(entry);
+
+		return canonical_size;
+	}
+
+	memcpy(key, path, size);
+
+	key[size] = '\0';
+
+	threading_mutex_lock(loader_path_cache_mutex);
+
+	if (set_get(loader_path_cache_map, (set_key)key) != NULL || set_insert(loader_path_cache_map, (set_key)key, entry) != 0)
+	{
+		free(entry->canonical);
+
+		free(entry);
+
+		free(key);
+	}
+
+	threading_mutex_unlock(loader_path_cache_mutex);
+
+	return canonical_size;
+}
+
+void loader_path_cache_clear(void)
+{
+	if (loader_path_cache_map == NULL)
+	{
+		return;
+	}
+
+	threading_mutex_lock(loader_path_cache_mutex);
+
+	set_iterate(loader_path_cache_map, &loader_path_cache_clear_cb, NULL);
+
+	set_destroy(loader_path_cache_map);
+
+	loader_path_cache_map = NULL;
+
+	threading_mutex_unlock(loader_path_cache_mutex);
+
+	threading_mutex_destroy(loader_path_cache_mutex);
+
+	loader_path_cache_mutex = NULL;
+}
@@ -0,0 +1,301 @@
+/*
+ *	Loader Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A library for loading executable code at run-time into a process.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <loader/loader_path.h>
+#include <loader/loader_path_index.h>
+
+#include <adt/adt_set.h>
+#include <adt/adt_vector.h>
+
+#include <log/log.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(WIN32) || defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+#else
+	#include <dirent.h>
+#endif
+
+/* -- Member Data -- */
+
+struct loader_path_index_directory_type
+{
+	loader_naming_path path;
+	set files; /* File name (owned copy) -> file name, used as a hash set */
+};
+
+struct loader_path_index_type
+{
+	vector directories; /* Vector of struct loader_path_index_directory_type */
+};
+
+/* -- Private Methods -- */
+
+static int loader_path_index_files_free_cb_iterate(set s, set_key key, set_value value, set_cb_iterate_args args)
+{
+	(void)s;
+	(void)value;
+	(void)args;
+
+	free(key);
+
+	return 0;
+}
+
+static void loader_path_index_directory_clear(struct loader_path_index_directory_type *directory)
+{
+	set_iterate(directory->files, &loader_path_index_files_free_cb_iterate, NULL);
+
+	set_clear(directory->files);
+}
+
+static int loader_path_index_directory_insert(struct loader_path_index_directory_type *directory, const char *name)
+{
+	char *copy = malloc(strlen(name) + 1);
+
+	if (copy == NULL)
+	{
+		return 1;
+	}
+
+	strcpy(copy, name);
+
+	if (set_insert(directory->files, (set_key)copy, (set_value)copy) != 0)
+	{
+		free(copy);
+
+		return 1;
+	}
+
+	return 0;
+}
+
+static int loader_path_index_directory_scan(struct loader_path_index_directory_type *directory)
+{
+#if defined(WIN32) || defined(_WIN32)
+	{
+		loader_naming_path pattern;
+
+		WIN32_FIND_DATAA data;
+
+		HANDLE find;
+
+		size_t length = strlen(directory->path);
+
+		if (length + 3 > LOADER_NAMING_PATH_SIZE)
+		{
+			return 1;
+		}
+
+		memcpy(pattern, directory->path, length);
+
+		pattern[length] = '\\';
+		pattern[length + 1] = '*';
+		pattern[length + 2] = '\0';
+
+		find = FindFirstFileA(pattern, &data);
+
+		if (find == INVALID_HANDLE_VALUE)
+		{
+			return 1;
+		}
+
+		do
+		{
+			if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+			{
+				loader_path_index_directory_insert(directory, data.cFileName);
+			}
+
+		} while (FindNextFileA(find, &data) != 0);
+
+		FindClose(find);
+
+		return 0;
+	}
+#else
+	{
+		DIR *d = opendir(directory->path);
+
+		struct dirent *entry;
+
+		if (d == NULL)
+		{
+			return 1;
+		}
+
+		while ((entry = readdir(d)) != NULL)
+		{
+			if (entry->d_type != DT_DIR)
+			{
+				loader_path_index_directory_insert(directory, entry->d_name);
+			}
+		}
+
+		closedir(d);
+
+		return 0;
+	}
+#endif
+}
+
+/* -- Methods -- */
+
+loader_path_index loader_path_index_create(void)
+{
+	loader_path_index index = malloc(sizeof(struct loader_path_index_type));
+
+	if (index == NULL)
+	{
+		return NULL;
+	}
+
+	index->directories = vector_create(sizeof(struct loader_path_index_directory_type));
+
+	if (index->directories == NULL)
+	{
+		free(index);
+
+		return NULL;
+	}
+
+	return index;
+}
+
+int loader_path_index_register(loader_path_index index, const loader_naming_path path)
+{
+	struct loader_path_index_directory_type directory;
+
+	size_t iterator, size;
+
+	if (index == NULL || path == NULL)
+	{
+		return 1;
+	}
+
+	size = vector_size(index->directories);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_path_index_directory_type *current = vector_at(index->directories, iterator);
+
+		if (strncmp(current->path, path, LOADER_NAMING_PATH_SIZE) == 0)
+		{
+			return 0;
+		}
+	}
+
+	strncpy(directory.path, path, LOADER_NAMING_PATH_SIZE - 1);
+
+	directory.path[LOADER_NAMING_PATH_SIZE - 1] = '\0';
+
+	directory.files = set_create(&hash_callback_str, &comparable_callback_str);
+
+	if (directory.files == NULL)
+	{
+		return 1;
+	}
+
+	if (loader_path_index_directory_scan(&directory) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_DEBUG, "Execution path (%s) could not be enumerated for the index", path);
+
+		set_destroy(directory.files);
+
+		return 1;
+	}
+
+	vector_push_back(index->directories, &directory);
+
+	return 0;
+}
+
+int loader_path_index_resolve(loader_path_index index, const loader_naming_path name, loader_naming_path resolved)
+{
+	size_t iterator, size;
+
+	if (index == NULL || name == NULL || resolved == NULL)
+	{
+		return 1;
+	}
+
+	size = vector_size(index->directories);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_path_index_directory_type *directory = vector_at(index->directories, iterator);
+
+		if (set_get(directory->files, (set_key)name) != NULL)
+		{
+			if (loader_path_join(directory->path, strlen(directory->path) + 1, name, strlen(name) + 1, resolved) > 1)
+			{
+				return 0;
+			}
+		}
+	}
+
+	return 1;
+}
+
+void loader_path_index_refresh(loader_path_index index)
+{
+	size_t iterator, size;
+
+	if (index == NULL)
+	{
+		return;
+	}
+
+	size = vector_size(index->directories);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_path_index_directory_type *directory = vector_at(index->directories, iterator);
+
+		loader_path_index_directory_clear(directory);
+
+		loader_path_index_directory_scan(directory);
+	}
+}
+
+void loader_path_index_destroy(loader_path_index index)
+{
+	size_t iterator, size;
+
+	if (index == NULL)
+	{
+		return;
+	}
+
+	size = vector_size(index->directories);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_path_index_directory_type *directory = vector_at(index->directories, iterator);
+
+		set_iterate(directory->files, &loader_path_index_files_free_cb_iterate, NULL);
+
+		set_destroy(directory->files);
+	}
+
+	vector_destroy(index->directories);
+
+	free(index);
+}
@@ -0,0 +1,274 @@
+/*
+ *	Loader Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A library for loading executable code at run-time into a process.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <loader/loader_profile.h>
+
+#include <adt/adt_string_pool.h>
+#include <adt/adt_vector.h>
+
+#include <reflect/reflect_function.h>
+#include <reflect/reflect_value_type.h>
+
+#include <environment/environment_variable.h>
+
+#include <log/log.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+/* -- Definitions -- */
+
+/* The profile is opt-in, it stays disabled unless the variable points
+to a writable file so no service writes to disk by surprise */
+#define LOADER_PROFILE_PATH "LOADER_PROFILE_PATH"
+
+/* Calls a function must accumulate during one run before it enters
+the persisted hot set */
+#define LOADER_PROFILE_HOT_THRESHOLD ((size_t)128)
+
+/* -- Member Data -- */
+
+struct loader_profile_entry_type
+{
+	const char *tag;  /* Interned, lookups compare the canonical pointers */
+	const char *name; /* Interned */
+	size_t arity;
+	uint64_t count;
+};
+
+/* -- Private Data -- */
+
+static char *profile_path = NULL;
+static vector profile_entries = NULL;
+static int profile_initialized = 1;
+
+/* -- Private Methods -- */
+
+static struct loader_profile_entry_type *loader_profile_find(const char *tag_interned, const char *name_interned, size_t arity)
+{
+	size_t iterator, size = vector_size(profile_entries);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_profile_entry_type *entry = vector_at(profile_entries, iterator);
+
+		if (entry->tag == tag_interned && entry->name == name_interned && entry->arity == arity)
+		{
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static void loader_profile_merge(const char *tag_interned, const char *name_interned, size_t arity, uint64_t count)
+{
+	struct loader_profile_entry_type *entry = loader_profile_find(tag_interned, name_interned, arity);
+
+	if (entry != NULL)
+	{
+		/* Counts of the previous run are replaced, not summed, so the
+		profile tracks the traffic of one run instead of growing forever */
+		if (count > entry->count)
+		{
+			entry->count = count;
+		}
+
+		return;
+	}
+
+	{
+		struct loader_profile_entry_type new_entry;
+
+		new_entry.tag = tag_interned;
+		new_entry.name = name_interned;
+		new_entry.arity = arity;
+		new_entry.count = count;
+
+		vector_push_back(profile_entries, &new_entry);
+	}
+}
+
+static void loader_profile_load(void)
+{
+	FILE *file = fopen(profile_path, "r");
+
+	char tag[LOADER_NAMING_TAG_SIZE];
+	char name[LOADER_NAMING_NAME_SIZE];
+
+	unsigned long arity;
+	unsigned long long count;
+
+	if (file == NULL)
+	{
+		return;
+	}
+
+	while (fscanf(file, "%63s %lu %llu %255s", tag, &arity, &count, name) == 4)
+	{
+		const char *tag_interned = string_intern(tag);
+		const char *name_interned = string_intern(name);
+
+		if (tag_interned != NULL && name_interned != NULL)
+		{
+			loader_profile_merge(tag_interned, name_interned, (size_t)arity, (uint64_t)count);
+		}
+	}
+
+	fclose(file);
+
+	log_write("metacall", LOG_LEVEL_DEBUG, "Loader profile loaded (%s)", profile_path);
+}
+
+static int loader_profile_harvest_cb_iterate(scope sp, const char *key, value v, void *data)
+{
+	const char *tag_interned = data;
+
+	function func;
+
+	struct function_stats_type stats;
+
+	(void)sp;
+
+	if (value_type_id(v) != TYPE_FUNCTION)
+	{
+		return 0;
+	}
+
+	func = value_to_function(v);
+
+	if (function_stats(func, &stats) != 0 || stats.count < LOADER_PROFILE_HOT_THRESHOLD)
+	{
+		return 0;
+	}
+
+	{
+		const char *name_interned = string_intern(key);
+
+		signature s = function_signature(func);
+
+		if (name_interned != NULL)
+		{
+			loader_profile_merge(tag_interned, name_interned, signature_count(s), (uint64_t)stats.count);
+		}
+	}
+
+	return 0;
+}
+
+/* -- Methods -- */
+
+void loader_profile_initialize(void)
+{
+	if (profile_initialized == 0)
+	{
+		return;
+	}
+
+	profile_path = environment_variable_create(LOADER_PROFILE_PATH, NULL);
+
+	if (profile_path == NULL)
+	{
+		return;
+	}
+
+	profile_initialized = 0;
+
+	if (profile_path[0] == '\0')
+	{
+		return;
+	}
+
+	profile_entries = vector_create(sizeof(struct loader_profile_entry_type));
+
+	if (profile_entries == NULL)
+	{
+		profile_path[0] = '\0';
+
+		return;
+	}
+
+	/* Stats drive the harvest at shutdown, the profile cannot be
+	recorded without them */
+	function_stats_enable(1);
+
+	loader_profile_load();
+}
+
+int loader_profile_enabled(void)
+{
+	return (profile_initialized == 0 && profile_path != NULL && profile_path[0] != '\0');
+}
+
+int loader_profile_hot(const loader_naming_tag tag, const char *name, size_t arity)
+{
+	if (loader_profile_enabled() == 0 || tag == NULL || name == NULL)
+	{
+		return 0;
+	}
+
+	return (loader_profile_find(string_intern(tag), string_intern(name), arity) != NULL);
+}
+
+void loader_profile_harvest(const loader_naming_tag tag, scope sp)
+{
+	const char *tag_interned;
+
+	if (loader_profile_enabled() == 0 || tag == NULL || sp == NULL)
+	{
+		return;
+	}
+
+	tag_interned = string_intern(tag);
+
+	if (tag_interned != NULL)
+	{
+		scope_iterate(sp, &loader_profile_harvest_cb_iterate, (void *)tag_interned);
+	}
+}
+
+void loader_profile_destroy(void)
+{
+	if (profile_entries != NULL)
+	{
+		FILE *file = fopen(profile_path, "w");
+
+		if (file != NULL)
+		{
+			size_t iterator, size = vector_size(profile_entries);
+
+			for (iterator = 0; iterator < size; ++iterator)
+			{
+				struct loader_profile_entry_type *entry = vector_at(profile_entries, iterator);
+
+				fprintf(file, "%s %lu %llu %s\n", entry->tag, (unsigned long)entry->arity, (unsigned long long)entry->count, entry->name);
+			}
+
+			fclose(file);
+		}
+		else
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Loader profile could not be written (%s)", profile_path);
+		}
+
+		vector_destroy(profile_entries);
+
+		profile_entries = NULL;
+	}
+
+	if (profile_path != NULL)
+	{
+		environment_variable_destroy(profile_path);
+
+		profile_path = NULL;
+	}
+
+	profile_initialized = 1;
+}
@@ -23,13 +23,15 @@
 #include <loader/loader.h>
 #include <loader/loader_impl.h>
 
-#include <reflect/context.h>
-#include <reflect/function.h>
-#include <reflect/scope.h>
-#include <reflect/type.h>
+#include <reflect/reflect_context.h>
+#include <reflect/reflect_function.h>
+#include <reflect/reflect_scope.h>
+#include <reflect/reflect_type.h>
+#include <reflect/reflect_value_type.h>
 
 #include <log/log.h>
 
+#include <cstring>
 #include <new>
 
 #include <ffi.h>
@@ -64,30 +66,219 @@ typedef struct loader_impl_c_handle_type
 
 } * loader_impl_c_handle;
 
+/* Native representation of a single argument, the invoke scratch
+arrays point libffi at these slots */
+union loader_impl_c_arg_storage
+{
+	boolean b;
+	char c;
+	short s;
+	int i;
+	long l;
+	float f;
+	double d;
+	void *p;
+};
+
 typedef struct loader_impl_c_function_type
 {
-	void *todo;
+	void (*address)(void);						 /* Address of the loaded C symbol */
+	ffi_cif cif;								 /* Call interface, prepared once at discovery */
+	ffi_type **arg_types;						 /* FFI argument types backing the cif */
+	void **arg_values;							 /* Per-call argument pointer scratch */
+	union loader_impl_c_arg_storage *arg_storage; /* Per-call native argument scratch */
+	int prepared;								 /* Nonzero once the cif has been prepared */
 
 } * loader_impl_c_function;
 
+/* Map a reflect type id to the libffi type used to pass it natively,
+null for types the C loader does not dispatch directly */
+static ffi_type *c_loader_impl_ffi_type(type_id id)
+{
+	switch (id)
+	{
+		case TYPE_BOOL:
+			return &ffi_type_uchar;
+		case TYPE_CHAR:
+			return &ffi_type_schar;
+		case TYPE_SHORT:
+			return &ffi_type_sshort;
+		case TYPE_INT:
+			return &ffi_type_sint;
+		case TYPE_LONG:
+			return &ffi_type_slong;
+		case TYPE_FLOAT:
+			return &ffi_type_float;
+		case TYPE_DOUBLE:
+			return &ffi_type_double;
+		case TYPE_STRING:
+		case TYPE_PTR:
+			return &ffi_type_pointer;
+		case TYPE_NULL:
+			return &ffi_type_void;
+		default:
+			return NULL;
+	}
+}
+
 int function_c_interface_create(function func, function_impl impl)
 {
-	(void)func;
-	(void)impl;
+	loader_impl_c_function c_function = static_cast<loader_impl_c_function>(impl);
+
+	signature s = function_signature(func);
+
+	const size_t args_size = signature_count(s);
+
+	type ret_type = signature_get_return(s);
+
+	ffi_type *ret_ffi_type;
+
+	size_t args_count;
+
+	if (c_function == NULL)
+	{
+		return 1;
+	}
+
+	c_function->prepared = 0;
+	c_function->arg_types = NULL;
+	c_function->arg_values = NULL;
+	c_function->arg_storage = NULL;
+
+	/* Prepare the call interface once here instead of re-deriving it
+	on every invocation, unsupported signatures leave the function
+	unprepared and the invoke rejects the call */
+	ret_ffi_type = c_loader_impl_ffi_type(ret_type == NULL ? TYPE_NULL : type_index(ret_type));
+
+	if (ret_ffi_type == NULL)
+	{
+		return 0;
+	}
+
+	c_function->arg_types = new (std::nothrow) ffi_type *[args_size];
+	c_function->arg_values = new (std::nothrow) void *[args_size];
+	c_function->arg_storage = new (std::nothrow) union loader_impl_c_arg_storage[args_size];
+
+	if (c_function->arg_types == NULL || c_function->arg_values == NULL || c_function->arg_storage == NULL)
+	{
+		return 1;
+	}
+
+	for (args_count = 0; args_count < args_size; ++args_count)
+	{
+		type t = signature_get_type(s, args_count);
+
+		ffi_type *arg_ffi_type = c_loader_impl_ffi_type(t == NULL ? TYPE_INVALID : type_index(t));
+
+		if (arg_ffi_type == NULL || arg_ffi_type == &ffi_type_void)
+		{
+			return 0;
+		}
+
+		c_function->arg_types[args_count] = arg_ffi_type;
+		c_function->arg_values[args_count] = &c_function->arg_storage[args_count];
+	}
+
+	if (ffi_prep_cif(&c_function->cif, FFI_DEFAULT_ABI, (unsigned int)args_size, ret_ffi_type, c_function->arg_types) != FFI_OK)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid FFI call interface preparation in C loader function %s", function_name(func));
+
+		return 0;
+	}
+
+	c_function->prepared = 1;
 
 	return 0;
 }
 
 function_return function_c_interface_invoke(function func, function_impl impl, function_args args, size_t size)
 {
-	/* TODO */
+	loader_impl_c_function c_function = static_cast<loader_impl_c_function>(impl);
 
-	(void)func;
-	(void)impl;
-	(void)args;
-	(void)size;
+	signature s = function_signature(func);
 
-	return NULL;
+	union loader_impl_c_arg_storage ret_storage;
+
+	type ret_type;
+
+	size_t args_count;
+
+	if (c_function == NULL || c_function->prepared == 0 || c_function->address == NULL || size != (size_t)c_function->cif.nargs)
+	{
+		return NULL;
+	}
+
+	/* Unbox the arguments into the pre-bound native slots the cif
+	already points at, no per-call interface derivation happens here */
+	for (args_count = 0; args_count < size; ++args_count)
+	{
+		type t = signature_get_type(s, args_count);
+
+		union loader_impl_c_arg_storage *slot = &c_function->arg_storage[args_count];
+
+		switch (type_index(t))
+		{
+			case TYPE_BOOL:
+				slot->b = value_to_bool(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_CHAR:
+				slot->c = value_to_char(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_SHORT:
+				slot->s = value_to_short(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_INT:
+				slot->i = value_to_int(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_LONG:
+				slot->l = value_to_long(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_FLOAT:
+				slot->f = value_to_float(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_DOUBLE:
+				slot->d = value_to_double(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_STRING:
+				slot->p = static_cast<void *>(value_to_string(static_cast<value>(args[args_count])));
+				break;
+			case TYPE_PTR:
+				slot->p = value_to_ptr(static_cast<value>(args[args_count]));
+				break;
+			default:
+				return NULL;
+		}
+	}
+
+	ffi_call(&c_function->cif, c_function->address, &ret_storage, c_function->arg_values);
+
+	ret_type = signature_get_return(s);
+
+	switch (ret_type == NULL ? TYPE_NULL : type_index(ret_type))
+	{
+		case TYPE_BOOL:
+			return value_create_bool(ret_storage.b);
+		case TYPE_CHAR:
+			return value_create_char(ret_storage.c);
+		case TYPE_SHORT:
+			return value_create_short(ret_storage.s);
+		case TYPE_INT:
+			return value_create_int(ret_storage.i);
+		case TYPE_LONG:
+			return value_create_long(ret_storage.l);
+		case TYPE_FLOAT:
+			return value_create_float(ret_storage.f);
+		case TYPE_DOUBLE:
+			return value_create_double(ret_storage.d);
+		case TYPE_STRING:
+			return ret_storage.p == NULL ? NULL : value_create_string(static_cast<const char *>(ret_storage.p), strlen(static_cast<const char *>(ret_storage.p)));
+		case TYPE_PTR:
+			return value_create_ptr(ret_storage.p);
+		case TYPE_NULL:
+			return value_create_null();
+		default:
+			return NULL;
+	}
 }
 
 function_return function_c_interface_await(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
@@ -113,6 +304,10 @@ void function_c_interface_destroy(function func, function_impl impl)
 
 	if (c_function != NULL)
 	{
+		delete[] c_function->arg_types;
+		delete[] c_function->arg_values;
+		delete[] c_function->arg_storage;
+
 		delete c_function;
 	}
 }
@@ -123,7 +318,8 @@ function_interface function_c_singleton()
 		&function_c_interface_create,
 		&function_c_interface_invoke,
 		&function_c_interface_await,
-		&function_c_interface_destroy
+		&function_c_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &c_interface;
@@ -28,6 +28,10 @@
 #include <reflect/reflect_scope.h>
 #include <reflect/reflect_type.h>
 
+#include <environment/environment_variable.h>
+
+#include <format/format_specifier.h>
+
 #include <log/log.h>
 
 #include <stdlib.h>
@@ -35,8 +39,29 @@
 #include <libcob.h>
 
 #include <map>
+#include <new>
 #include <string>
 
+/* Upper bound of linkage section parameters dispatched directly,
+matches the fixed argument list of the entry point cast below */
+#define COB_LOADER_CALL_MAX_PARAMS ((size_t)16)
+
+/* COBOL program entry points share a C calling convention where the
+callee reads only as many pointers as its linkage section declares,
+the count travels in the runtime global, so calling with the full
+argument list is safe (same technique libcob itself uses) */
+typedef int (*loader_impl_cob_entry)(void *, void *, void *, void *,
+	void *, void *, void *, void *,
+	void *, void *, void *, void *,
+	void *, void *, void *, void *);
+
+typedef struct loader_impl_cob_function_type
+{
+	loader_impl_cob_entry address;			 /* Entry point resolved once at load */
+	void *args[COB_LOADER_CALL_MAX_PARAMS];	 /* Preallocated working storage for call arguments */
+
+} * loader_impl_cob_function;
+
 typedef struct loader_impl_cob_handle_type
 {
 	std::map<std::string, void *> funcs;
@@ -55,34 +80,39 @@ int function_cob_interface_create(function func, function_impl impl)
 
 function_return function_cob_interface_invoke(function func, function_impl impl, function_args args, size_t size)
 {
-	const char *name = function_name(func);
-
-	(void)impl;
+	loader_impl_cob_function cob_function = static_cast<loader_impl_cob_function>(impl);
 
-	if (size == 0)
+	if (cob_function == NULL || cob_function->address == NULL)
 	{
-		return value_create_int(cobcall(name, 0, NULL));
+		return NULL;
 	}
-	else
+
+	if (size > COB_LOADER_CALL_MAX_PARAMS)
 	{
-		void **cob_args = static_cast<void **>(malloc(sizeof(void *) * size));
+		log_write("metacall", LOG_LEVEL_ERROR, "COBOL function %s invoked with %" PRIuS " arguments, the limit is %" PRIuS,
+			function_name(func), size, COB_LOADER_CALL_MAX_PARAMS);
 
-		if (cob_args == NULL)
-		{
-			return NULL;
-		}
+		return NULL;
+	}
 
-		for (size_t arg_count = 0; arg_count < size; ++arg_count)
-		{
-			cob_args[arg_count] = value_data(args[arg_count]);
-		}
+	/* Unbox into the preallocated slots, no per call allocation */
+	for (size_t arg_count = 0; arg_count < size; ++arg_count)
+	{
+		cob_function->args[arg_count] = value_data(args[arg_count]);
+	}
 
-		int result = cobcall(name, size, cob_args);
+	/* The callee reads the parameter count from the runtime global,
+	then the call is a direct jump through the pinned entry point
+	instead of a per call symbol resolution */
+	cob_get_global_ptr()->cob_call_params = (int)size;
 
-		free(cob_args);
+	int result = cob_function->address(
+		cob_function->args[0], cob_function->args[1], cob_function->args[2], cob_function->args[3],
+		cob_function->args[4], cob_function->args[5], cob_function->args[6], cob_function->args[7],
+		cob_function->args[8], cob_function->args[9], cob_function->args[10], cob_function->args[11],
+		cob_function->args[12], cob_function->args[13], cob_function->args[14], cob_function->args[15]);
 
-		return value_create_int(result);
-	}
+	return value_create_int(result);
 }
 
 function_return function_cob_interface_await(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
@@ -102,8 +132,11 @@ function_return function_cob_interface_await(function func, function_impl impl,
 
 void function_cob_interface_destroy(function func, function_impl impl)
 {
+	loader_impl_cob_function cob_function = static_cast<loader_impl_cob_function>(impl);
+
 	(void)func;
-	(void)impl;
+
+	delete cob_function;
 }
 
 function_interface function_cob_singleton(void)
@@ -112,7 +145,8 @@ function_interface function_cob_singleton(void)
 		&function_cob_interface_create,
 		&function_cob_interface_invoke,
 		&function_cob_interface_await,
-		&function_cob_interface_destroy
+		&function_cob_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &cob_interface;
@@ -128,7 +162,7 @@ loader_impl_data cob_loader_impl_initialize(loader_impl impl, configuration conf
 	// Remove this once we implement this properly (if needed)
 
 	// Copy environment variables in order to resolve properly the scripts
-	const char *scripts_path = getenv("LOADER_SCRIPT_PATH");
+	const char *scripts_path = environment_variable_get("LOADER_SCRIPT_PATH", NULL);
 
 	if (scripts_path != NULL)
 	{
@@ -250,7 +284,24 @@ int cob_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx
 
 	for (const auto &func : cob_handle->funcs)
 	{
-		function f = function_create(func.first.c_str(), 0, func.second, &function_cob_singleton);
+		/* Pin the entry point resolved at load into the function impl
+		so the invoke path never resolves the symbol again */
+		loader_impl_cob_function cob_function = new (std::nothrow) loader_impl_cob_function_type();
+
+		if (cob_function == nullptr)
+		{
+			return 1;
+		}
+
+		cob_function->address = reinterpret_cast<loader_impl_cob_entry>(func.second);
+
+		function f = function_create(func.first.c_str(), 0, cob_function, &function_cob_singleton);
+
+		if (f == NULL)
+		{
+			delete cob_function;
+			return 1;
+		}
 
 		scope_define(sp, function_name(f), value_create_function(f));
 	}
@@ -33,7 +33,9 @@ loader_impl_interface cr_loader_impl_interface_singleton()
 		&cr_loader_impl_load_from_package,
 		&cr_loader_impl_clear,
 		&cr_loader_impl_discover,
-		&cr_loader_impl_destroy
+		&cr_loader_impl_destroy,
+		NULL /* parallel */,
+		NULL /* address */
 	};
 
 	return &loader_impl_interface_cr;
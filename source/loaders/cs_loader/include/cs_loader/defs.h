@@ -70,6 +70,7 @@ typedef execution_result *(execute_function_w)(const wchar_t *function);
 typedef execution_result *(execute_function_with_params_w)(const wchar_t *function, parameters *);
 typedef execution_result *(execute_function_with_params_c)(const char *function, parameters *);
 typedef void(get_loaded_functions)(int *, reflect_function *);
+typedef void(warmup_functions)(void);
 
 #if defined(__linux) | defined(linux)
 
@@ -51,6 +51,7 @@ public:
 	execute_function_with_params_c *execute_with_params_c;
 	get_loaded_functions *core_get_functions;
 	corefunction_destroy_execution_result *core_destroy_execution_result;
+	warmup_functions *core_warmup;
 
 	const CHARSTRING *loader_dll = W("CSLoader.dll");
 	const CHARSTRING *class_name = W("CSLoader.MetacallEntryPoint");
@@ -74,6 +75,7 @@ public:
 	const CHARSTRING *delegate_execute_with_params_c = W("ExecuteWithParamsC");
 	const CHARSTRING *delegate_get_functions = W("GetFunctions");
 	const CHARSTRING *delegate_destroy_execution_result = W("DestroyExecutionResult");
+	const CHARSTRING *delegate_warmup = W("Warmup");
 
 	explicit netcore(char *dotnet_root, char *dotnet_loader_assembly_path);
 	virtual ~netcore();
@@ -104,6 +106,7 @@ public:
 	virtual bool create_delegate(const CHARSTRING *delegate_name, void **func) = 0;
 
 	reflect_function *get_functions(int *count);
+	void warmup();
 	void destroy_execution_result(execution_result *er);
 };
 
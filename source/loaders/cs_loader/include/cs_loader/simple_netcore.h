@@ -48,6 +48,8 @@ int simple_netcore_load_script_from_memory(netcore_handle handle, const char *bu
 
 execution_result *simple_netcore_invoke(netcore_handle handle, const char *func);
 
+void simple_netcore_warmup(netcore_handle handle);
+
 void simple_netcore_destroy(netcore_handle handle);
 
 execution_result *simple_netcore_invoke_with_params(netcore_handle handle, const char *func, parameters *params);
@@ -85,6 +85,11 @@ namespace CSLoader
             }
         }
 
+        public static void Warmup()
+        {
+            loader.WarmUp();
+        }
+
         public static ReflectFunction[] GetFunctionsInternal()
         {
             return loader.Functions();
@@ -8,7 +8,9 @@ using System.IO;
 using Microsoft.CodeAnalysis.Emit;
 using static CSLoader.MetacallDef;
 using CSLoader.Contracts;
+using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
+using System.Threading.Tasks;
 
 namespace CSLoader.Providers
 {
@@ -38,6 +40,28 @@ namespace CSLoader.Providers
             return false;
         }
 
+        // Force JIT compilation of every discovered function on a background
+        // thread so steady-state calls never pay the first-invocation stall
+        public void WarmUp()
+        {
+            var methods = this.functions.Values.Select(x => x.Method).ToArray();
+
+            Task.Run(() =>
+            {
+                foreach (var method in methods)
+                {
+                    try
+                    {
+                        RuntimeHelpers.PrepareMethod(method.MethodHandle);
+                    }
+                    catch (Exception ex)
+                    {
+                        this.log.Error("CSLoader warm-up error: " + ex.Message);
+                    }
+                }
+            });
+        }
+
         public ReflectFunction[] Functions()
         {
             return this.functions.Select(x => x.Value.GetReflectFunction()).ToArray();
@@ -157,7 +157,8 @@ function_interface function_cs_singleton(void)
 		&function_cs_interface_create,
 		&function_cs_interface_invoke,
 		&function_cs_interface_await,
-		&function_cs_interface_destroy
+		&function_cs_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &cs_interface;
@@ -388,6 +389,10 @@ int cs_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx)
 		scope_define(sp, functions[i].name, value_create_function(f));
 	}
 
+	/* Kick the JIT over the discovered functions on a background thread,
+	so the first invocation of each one does not pay the compilation */
+	simple_netcore_warmup(nhandle);
+
 	return 0;
 }
 
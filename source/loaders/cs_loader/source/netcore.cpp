@@ -115,6 +115,11 @@ bool netcore::create_delegates()
 		return false;
 	}
 
+	if (!this->create_delegate(this->delegate_warmup, (void **)&this->core_warmup))
+	{
+		return false;
+	}
+
 	return true;
 }
 
@@ -284,6 +289,18 @@ execution_result *netcore::execute_with_params(const wchar_t *function, paramete
 	return NULL;
 }
 
+void netcore::warmup()
+{
+	try
+	{
+		this->core_warmup();
+	}
+	catch (const std::exception &ex)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Exception caught: %s", ex.what());
+	}
+}
+
 void netcore::destroy_execution_result(execution_result *er)
 {
 	try
@@ -98,6 +98,13 @@ execution_result *simple_netcore_invoke_with_params(netcore_handle handle, const
 	return core->execute_with_params((char *)func, params);
 }
 
+void simple_netcore_warmup(netcore_handle handle)
+{
+	netcore *core = (netcore *)handle;
+
+	core->warmup();
+}
+
 void simple_netcore_destroy_execution_result(netcore_handle handle, execution_result *er)
 {
 	netcore *core = (netcore *)handle;
@@ -33,7 +33,9 @@ loader_impl_interface dart_loader_impl_interface_singleton()
 		&dart_loader_impl_load_from_package,
 		&dart_loader_impl_clear,
 		&dart_loader_impl_discover,
-		&dart_loader_impl_destroy
+		&dart_loader_impl_destroy,
+		NULL /* parallel */,
+		NULL /* address */
 	};
 
 	return &loader_impl_interface_dart;
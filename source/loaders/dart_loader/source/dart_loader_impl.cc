@@ -27,30 +27,65 @@
 #include <reflect/reflect_function.h>
 #include <reflect/reflect_scope.h>
 #include <reflect/reflect_type.h>
+#include <reflect/reflect_value_type.h>
+
+#include <configuration/configuration.h>
+
+#include <format/format_specifier.h>
 
 #include <log/log.h>
 
-#include <stdlib.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <string>
+#include <vector>
+
+#include <dart_api.h>
+
+/* Kernel (dill) files start with this magic number, anything else
+handed to the loader is assumed to be an isolate data snapshot */
+#define DART_LOADER_KERNEL_MAGIC_SIZE ((size_t)4)
+
+static const unsigned char dart_loader_kernel_magic[DART_LOADER_KERNEL_MAGIC_SIZE] = { 0x90, 0xAB, 0xCD, 0xEF };
 
 typedef struct loader_impl_dart_type
 {
-	void *impl_dart_data;
+	uint8_t *vm_snapshot_data;
+	uint8_t *vm_snapshot_instructions;
+	std::vector<std::pair<std::string, size_t>> entry_points; /* Name and arity pairs from the configuration */
+	int vm_initialized;
 
 } * loader_impl_dart;
 
 typedef struct loader_impl_dart_handle_type
 {
-	void *handle_dart_data;
+	Dart_Isolate isolate;
+	Dart_PersistentHandle library;			/* Root library pinned for the handle lifetime */
+	std::vector<uint8_t *> kernel_buffers;	/* Kernel buffers must outlive the isolate */
+	std::vector<uint8_t *> snapshot_buffers;
 
 } * loader_impl_dart_handle;
 
 typedef struct loader_impl_dart_function_type
 {
 	loader_impl_dart_handle dart_handle;
-	void *function_dart_data;
+	Dart_PersistentHandle closure; /* Tear-off resolved once at discovery */
 
 } * loader_impl_dart_function;
 
+/* -- Private Methods -- */
+
+static uint8_t *dart_loader_impl_read_file(const char *path, size_t *size);
+
+static int dart_loader_impl_is_kernel(const uint8_t *buffer, size_t size);
+
+static Dart_Handle dart_loader_impl_value_to_dart(value v);
+
+static value dart_loader_impl_dart_to_value(Dart_Handle handle);
+
 int function_dart_interface_create(function func, function_impl impl)
 {
 	(void)func;
@@ -63,150 +98,48 @@ function_return function_dart_interface_invoke(function func, function_impl impl
 {
 	loader_impl_dart_function dart_function = (loader_impl_dart_function)impl;
 
-	signature s = function_signature(func);
-
-	const char *name = function_name(func);
+	Dart_Handle dart_args[0x10];
 
-	type ret_type = signature_get_return(s);
+	Dart_Handle result;
 
-	(void)dart_function;
+	function_return ret = NULL;
 
-	log_write("metacall", LOG_LEVEL_DEBUG, "Invoking dart function %s", name);
+	size_t args_count;
 
-	if (size > 0)
+	if (size > sizeof(dart_args) / sizeof(dart_args[0]))
 	{
-		size_t args_count;
-
-		for (args_count = 0; args_count < size; ++args_count)
-		{
-			type t = signature_get_type(s, args_count);
-
-			type_id id = type_index(t);
-
-			log_write("metacall", LOG_LEVEL_DEBUG, "Type %p, %d", (void *)t, id);
-
-			if (id == TYPE_BOOL)
-			{
-				boolean *value_ptr = (boolean *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "Boolean value: %d", *value_ptr);
-			}
-			else if (id == TYPE_CHAR)
-			{
-				char *value_ptr = (char *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "Char value: %c", *value_ptr);
-			}
-			else if (id == TYPE_SHORT)
-			{
-				short *value_ptr = (short *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "Short value: %d", *value_ptr);
-			}
-			else if (id == TYPE_INT)
-			{
-				int *value_ptr = (int *)(args[args_count]);
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid number of arguments in dart function %s (%" PRIuS ")", function_name(func), size);
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Int value: %d", *value_ptr);
-			}
-			else if (id == TYPE_LONG)
-			{
-				long *value_ptr = (long *)(args[args_count]);
+		return NULL;
+	}
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Long value: %ld", *value_ptr);
-			}
-			else if (id == TYPE_FLOAT)
-			{
-				float *value_ptr = (float *)(args[args_count]);
+	Dart_EnterIsolate(dart_function->dart_handle->isolate);
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Float value: %f", *value_ptr);
-			}
-			else if (id == TYPE_DOUBLE)
-			{
-				double *value_ptr = (double *)(args[args_count]);
+	Dart_EnterScope();
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Double value: %f", *value_ptr);
-			}
-			else if (id == TYPE_STRING)
-			{
-				const char *value_ptr = (const char *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "String value: %s", value_ptr);
-			}
-			else if (id == TYPE_PTR)
-			{
-				void *value_ptr = (void *)(args[args_count]);
+	for (args_count = 0; args_count < size; ++args_count)
+	{
+		dart_args[args_count] = dart_loader_impl_value_to_dart((value)args[args_count]);
+	}
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Pointer value: %p", value_ptr);
-			}
-			else
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Unrecognized value: %p", args[args_count]);
-			}
-		}
+	/* The closure was pinned at discovery so the call resolves
+	nothing, it goes straight through the persistent handle */
+	result = Dart_InvokeClosure(Dart_HandleFromPersistent(dart_function->closure), (int)size, dart_args);
 
-		log_write("metacall", LOG_LEVEL_DEBUG, "Calling dart function with arguments (%lu)", size);
+	if (Dart_IsError(result))
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid dart function %s invocation: %s", function_name(func), Dart_GetError(result));
 	}
 	else
 	{
-		log_write("metacall", LOG_LEVEL_DEBUG, "Calling dart function without arguments");
+		ret = dart_loader_impl_dart_to_value(result);
 	}
 
-	if (ret_type != NULL)
-	{
-		type_id id = type_index(ret_type);
-
-		log_write("metacall", LOG_LEVEL_DEBUG, "Return type %p, %d", (void *)ret_type, id);
+	Dart_ExitScope();
 
-		if (id == TYPE_BOOL)
-		{
-			boolean b = 1;
+	Dart_ExitIsolate();
 
-			return value_create_bool(b);
-		}
-		else if (id == TYPE_CHAR)
-		{
-			return value_create_char('A');
-		}
-		else if (id == TYPE_SHORT)
-		{
-			return value_create_short(124);
-		}
-		else if (id == TYPE_INT)
-		{
-			return value_create_int(1234);
-		}
-		else if (id == TYPE_LONG)
-		{
-			return value_create_long(90000L);
-		}
-		else if (id == TYPE_FLOAT)
-		{
-			return value_create_float(0.2f);
-		}
-		else if (id == TYPE_DOUBLE)
-		{
-			return value_create_double(3.1416);
-		}
-		else if (id == TYPE_STRING)
-		{
-			static const char str[] = "Hello World";
-
-			return value_create_string(str, sizeof(str) - 1);
-		}
-		else if (id == TYPE_PTR)
-		{
-			static int int_val = 15;
-
-			return value_create_ptr(&int_val);
-		}
-		else
-		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Unrecognized return type");
-		}
-	}
-
-	return NULL;
+	return ret;
 }
 
 function_return function_dart_interface_await(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
@@ -232,6 +165,15 @@ void function_dart_interface_destroy(function func, function_impl impl)
 
 	if (dart_function != nullptr)
 	{
+		if (dart_function->closure != nullptr && dart_function->dart_handle->isolate != nullptr)
+		{
+			Dart_EnterIsolate(dart_function->dart_handle->isolate);
+
+			Dart_DeletePersistentHandle(dart_function->closure);
+
+			Dart_ExitIsolate();
+		}
+
 		delete dart_function;
 	}
 }
@@ -242,7 +184,8 @@ function_interface function_dart_singleton(void)
 		&function_dart_interface_create,
 		&function_dart_interface_invoke,
 		&function_dart_interface_await,
-		&function_dart_interface_destroy
+		&function_dart_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &dart_interface;
@@ -289,278 +232,606 @@ int dart_loader_impl_initialize_types(loader_impl impl)
 	return 0;
 }
 
-loader_impl_data dart_loader_impl_initialize(loader_impl impl, configuration config)
+static uint8_t *dart_loader_impl_read_file(const char *path, size_t *size)
 {
-	loader_impl_dart dart_impl;
+	FILE *file = fopen(path, "rb");
 
-	(void)impl;
-	(void)config;
+	uint8_t *buffer;
 
-	dart_impl = new loader_impl_dart_type();
+	long length;
 
-	if (dart_impl == nullptr)
+	if (file == NULL)
 	{
 		return NULL;
 	}
 
-	if (dart_loader_impl_initialize_types(impl) != 0)
+	fseek(file, 0, SEEK_END);
+
+	length = ftell(file);
+
+	fseek(file, 0, SEEK_SET);
+
+	if (length <= 0)
 	{
-		delete dart_impl;
+		fclose(file);
 
 		return NULL;
 	}
 
-	dart_impl->impl_dart_data = nullptr;
+	buffer = (uint8_t *)malloc((size_t)length);
 
-	/* Register initialization */
-	loader_initialization_register(impl);
+	if (buffer == NULL)
+	{
+		fclose(file);
 
-	return dart_impl;
-}
+		return NULL;
+	}
 
-int dart_loader_impl_execution_path(loader_impl impl, const loader_naming_path path)
-{
-	(void)impl;
-	(void)path;
+	if (fread(buffer, 1, (size_t)length, file) != (size_t)length)
+	{
+		free(buffer);
 
-	return 0;
+		fclose(file);
+
+		return NULL;
+	}
+
+	fclose(file);
+
+	*size = (size_t)length;
+
+	return buffer;
 }
 
-loader_handle dart_loader_impl_load_from_file(loader_impl impl, const loader_naming_path paths[], size_t size)
+static int dart_loader_impl_is_kernel(const uint8_t *buffer, size_t size)
 {
-	loader_impl_dart_handle handle = new loader_impl_dart_handle_type();
+	return size >= DART_LOADER_KERNEL_MAGIC_SIZE &&
+		   memcmp(buffer, dart_loader_kernel_magic, DART_LOADER_KERNEL_MAGIC_SIZE) == 0;
+}
 
-	(void)impl;
+static Dart_Handle dart_loader_impl_value_to_dart(value v)
+{
+	type_id id = value_type_id(v);
 
-	if (handle != nullptr)
+	switch (id)
 	{
-		size_t iterator;
+		case TYPE_BOOL:
+			return Dart_NewBoolean(value_to_bool(v) == 1L);
 
-		for (iterator = 0; iterator < size; ++iterator)
-		{
-			log_write("metacall", LOG_LEVEL_DEBUG, "Mock module %s loaded from file", paths[iterator]);
-		}
+		case TYPE_CHAR:
+			return Dart_NewInteger((int64_t)value_to_char(v));
 
-		handle->handle_dart_data = nullptr;
+		case TYPE_SHORT:
+			return Dart_NewInteger((int64_t)value_to_short(v));
 
-		return (loader_handle)handle;
-	}
+		case TYPE_INT:
+			return Dart_NewInteger((int64_t)value_to_int(v));
 
-	return NULL;
+		case TYPE_LONG:
+			return Dart_NewInteger((int64_t)value_to_long(v));
+
+		case TYPE_FLOAT:
+			return Dart_NewDouble((double)value_to_float(v));
+
+		case TYPE_DOUBLE:
+			return Dart_NewDouble(value_to_double(v));
+
+		case TYPE_STRING:
+			return Dart_NewStringFromCString(value_to_string(v));
+
+		default:
+			log_write("metacall", LOG_LEVEL_ERROR, "Unsupported dart argument type (%d)", (int)id);
+
+			return Dart_Null();
+	}
 }
 
-loader_handle dart_loader_impl_load_from_memory(loader_impl impl, const loader_naming_name name, const char *buffer, size_t size)
+static value dart_loader_impl_dart_to_value(Dart_Handle handle)
 {
-	loader_impl_dart_handle handle = new loader_impl_dart_handle_type();
+	if (Dart_IsNull(handle))
+	{
+		return value_create_null();
+	}
+	else if (Dart_IsBoolean(handle))
+	{
+		bool b = false;
 
-	(void)impl;
-	(void)buffer;
-	(void)size;
+		Dart_BooleanValue(handle, &b);
 
-	if (handle != nullptr)
+		return value_create_bool(b == true ? 1L : 0L);
+	}
+	else if (Dart_IsInteger(handle))
 	{
-		log_write("metacall", LOG_LEVEL_DEBUG, "Mock module %s. loaded from memory", name);
+		int64_t i = 0;
 
-		handle->handle_dart_data = nullptr;
+		Dart_IntegerToInt64(handle, &i);
 
-		return (loader_handle)handle;
+		return value_create_long((long)i);
 	}
+	else if (Dart_IsDouble(handle))
+	{
+		double d = 0.0;
+
+		Dart_DoubleValue(handle, &d);
+
+		return value_create_double(d);
+	}
+	else if (Dart_IsString(handle))
+	{
+		const char *str = NULL;
+
+		Dart_StringToCString(handle, &str);
+
+		return value_create_string(str, strlen(str));
+	}
+
+	log_write("metacall", LOG_LEVEL_ERROR, "Unsupported dart return type");
 
 	return NULL;
 }
 
-loader_handle dart_loader_impl_load_from_package(loader_impl impl, const loader_naming_path path)
+static void dart_loader_impl_entry_points(loader_impl_dart dart_impl, configuration config)
 {
-	loader_impl_dart_handle handle = new loader_impl_dart_handle_type();
+	value functions_value, *functions_map;
 
-	(void)impl;
+	size_t iterator, size;
 
-	if (handle != nullptr)
+	if (config == NULL)
 	{
-		log_write("metacall", LOG_LEVEL_DEBUG, "Mock module %s loaded from package", path);
+		return;
+	}
 
-		handle->handle_dart_data = nullptr;
+	/* The embedding API cannot enumerate the members of a kernel, so
+	the dispatchable entry points come from the configuration as a map
+	of function name to arity */
+	functions_value = configuration_value(config, (char *)"functions");
 
-		return (loader_handle)handle;
+	if (functions_value == NULL || value_type_id(functions_value) != TYPE_MAP)
+	{
+		return;
 	}
 
-	return NULL;
+	functions_map = value_to_map(functions_value);
+
+	size = value_type_count(functions_value);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		value *tuple = value_to_array(functions_map[iterator]);
+
+		if (value_type_id(tuple[0]) == TYPE_STRING)
+		{
+			long arity = -1L;
+
+			if (value_type_id(tuple[1]) == TYPE_INT)
+			{
+				arity = (long)value_to_int(tuple[1]);
+			}
+			else if (value_type_id(tuple[1]) == TYPE_LONG)
+			{
+				arity = value_to_long(tuple[1]);
+			}
+
+			if (arity >= 0L)
+			{
+				dart_impl->entry_points.push_back(std::make_pair(std::string(value_to_string(tuple[0])), (size_t)arity));
+			}
+		}
+	}
 }
 
-int dart_loader_impl_clear(loader_impl impl, loader_handle handle)
+loader_impl_data dart_loader_impl_initialize(loader_impl impl, configuration config)
 {
-	loader_impl_dart_handle dart_handle = (loader_impl_dart_handle)handle;
+	loader_impl_dart dart_impl;
 
-	(void)impl;
+	Dart_InitializeParams params;
+
+	char *error;
 
-	if (dart_handle != nullptr)
+	dart_impl = new loader_impl_dart_type();
+
+	if (dart_impl == nullptr)
 	{
-		delete dart_handle;
+		return NULL;
+	}
 
-		return 0;
+	if (dart_loader_impl_initialize_types(impl) != 0)
+	{
+		delete dart_impl;
+
+		return NULL;
 	}
 
-	return 1;
-}
+	dart_impl->vm_snapshot_data = nullptr;
+	dart_impl->vm_snapshot_instructions = nullptr;
+	dart_impl->vm_initialized = 0;
 
-loader_impl_dart_function dart_function_create(loader_impl_dart_handle dart_handle)
-{
-	loader_impl_dart_function dart_function = new loader_impl_dart_function_type();
+	/* Optional precompiled VM snapshot, booting from it skips the
+	core library parse and warm up entirely */
+	if (config != NULL)
+	{
+		value vm_data_path = configuration_value(config, (char *)"vm_snapshot_data_path");
+		value vm_instr_path = configuration_value(config, (char *)"vm_snapshot_instructions_path");
 
-	if (dart_function != nullptr)
+		size_t size = 0;
+
+		if (vm_data_path != NULL && value_type_id(vm_data_path) == TYPE_STRING)
+		{
+			dart_impl->vm_snapshot_data = dart_loader_impl_read_file(value_to_string(vm_data_path), &size);
+		}
+
+		if (vm_instr_path != NULL && value_type_id(vm_instr_path) == TYPE_STRING)
+		{
+			dart_impl->vm_snapshot_instructions = dart_loader_impl_read_file(value_to_string(vm_instr_path), &size);
+		}
+	}
+
+	dart_loader_impl_entry_points(dart_impl, config);
+
+	memset(&params, 0, sizeof(params));
+
+	params.version = DART_INITIALIZE_PARAMS_CURRENT_VERSION;
+	params.vm_snapshot_data = dart_impl->vm_snapshot_data;
+	params.vm_snapshot_instructions = dart_impl->vm_snapshot_instructions;
+
+	error = Dart_Initialize(&params);
+
+	if (error != NULL)
 	{
-		dart_function->dart_handle = dart_handle;
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid dart VM initialization: %s", error);
 
-		dart_function->function_dart_data = nullptr;
+		free(error);
 
-		return dart_function;
+		free(dart_impl->vm_snapshot_data);
+
+		free(dart_impl->vm_snapshot_instructions);
+
+		delete dart_impl;
+
+		return NULL;
 	}
 
-	return nullptr;
+	dart_impl->vm_initialized = 1;
+
+	/* Register initialization */
+	loader_initialization_register(impl);
+
+	return dart_impl;
 }
 
-int dart_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx)
+int dart_loader_impl_execution_path(loader_impl impl, const loader_naming_path path)
 {
-	loader_impl_dart dart_impl = static_cast<loader_impl_dart>(loader_impl_get(impl));
+	(void)impl;
+	(void)path;
 
-	loader_impl_dart_handle dart_handle = (loader_impl_dart_handle)handle;
+	return 0;
+}
 
-	loader_impl_dart_function dart_function = dart_function_create(dart_handle);
+static loader_handle dart_loader_impl_load_buffers(loader_impl impl, const char *name, std::vector<std::pair<uint8_t *, size_t>> &buffers)
+{
+	loader_impl_dart_handle handle;
 
-	scope sp = context_scope(ctx);
+	Dart_Isolate isolate = nullptr;
 
-	(void)dart_impl;
+	Dart_Handle library;
 
-	log_write("metacall", LOG_LEVEL_DEBUG, "Mock module %p discovering", handle);
+	char *error = nullptr;
 
-	if (dart_function != nullptr)
-	{
-		function f = function_create("my_empty_func", 0, dart_function, &function_dart_singleton);
+	size_t iterator;
 
-		signature s = function_signature(f);
+	(void)impl;
 
-		signature_set_return(s, loader_impl_type(impl, "Integer"));
+	if (buffers.empty())
+	{
+		return NULL;
+	}
 
-		scope_define(sp, function_name(f), value_create_function(f));
+	handle = new loader_impl_dart_handle_type();
+
+	if (handle == nullptr)
+	{
+		return NULL;
 	}
 
-	dart_function = dart_function_create(dart_handle);
+	handle->isolate = nullptr;
+	handle->library = nullptr;
 
-	if (dart_function != nullptr)
+	/* The first buffer defines the isolate, a kernel creates it from
+	the dill directly and a snapshot boots it from precompiled data,
+	both paths avoid compiling anything at load time */
+	if (dart_loader_impl_is_kernel(buffers[0].first, buffers[0].second))
 	{
-		function f = function_create("two_doubles", 2, dart_function, &function_dart_singleton);
+		isolate = Dart_CreateIsolateGroupFromKernel(name, "main", buffers[0].first, buffers[0].second, nullptr, handle, handle, &error);
+	}
+	else
+	{
+		isolate = Dart_CreateIsolateGroup(name, "main", buffers[0].first, nullptr, nullptr, handle, handle, &error);
+	}
+
+	if (isolate == nullptr)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid dart isolate creation: %s", error == nullptr ? "unknown error" : error);
+
+		free(error);
 
-		signature s = function_signature(f);
+		delete handle;
 
-		signature_set_return(s, loader_impl_type(impl, "Double"));
+		return NULL;
+	}
+
+	handle->isolate = isolate;
 
-		signature_set(s, 0, "first_parameter", loader_impl_type(impl, "Double"));
+	Dart_EnterScope();
 
-		signature_set(s, 1, "second_parameter", loader_impl_type(impl, "Double"));
+	if (dart_loader_impl_is_kernel(buffers[0].first, buffers[0].second))
+	{
+		library = Dart_LoadScriptFromKernel(buffers[0].first, (intptr_t)buffers[0].second);
 
-		scope_define(sp, function_name(f), value_create_function(f));
+		handle->kernel_buffers.push_back(buffers[0].first);
 	}
+	else
+	{
+		library = Dart_RootLibrary();
 
-	dart_function = dart_function_create(dart_handle);
+		handle->snapshot_buffers.push_back(buffers[0].first);
+	}
 
-	if (dart_function != nullptr)
+	if (Dart_IsError(library))
 	{
-		function f = function_create("mixed_args", 5, dart_function, &function_dart_singleton);
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid dart script load: %s", Dart_GetError(library));
 
-		signature s = function_signature(f);
+		Dart_ExitScope();
 
-		signature_set_return(s, loader_impl_type(impl, "Char"));
+		Dart_ShutdownIsolate();
 
-		signature_set(s, 0, "a_char", loader_impl_type(impl, "Char"));
+		delete handle;
 
-		signature_set(s, 1, "b_int", loader_impl_type(impl, "Integer"));
+		return NULL;
+	}
 
-		signature_set(s, 2, "c_long", loader_impl_type(impl, "Long"));
+	/* Additional kernels are loaded as libraries into the same isolate */
+	for (iterator = 1; iterator < buffers.size(); ++iterator)
+	{
+		if (dart_loader_impl_is_kernel(buffers[iterator].first, buffers[iterator].second))
+		{
+			Dart_Handle result = Dart_LoadLibraryFromKernel(buffers[iterator].first, (intptr_t)buffers[iterator].second);
 
-		signature_set(s, 3, "d_double", loader_impl_type(impl, "Double"));
+			if (Dart_IsError(result))
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Invalid dart kernel load: %s", Dart_GetError(result));
+			}
 
-		signature_set(s, 4, "e_ptr", loader_impl_type(impl, "Ptr"));
+			handle->kernel_buffers.push_back(buffers[iterator].first);
+		}
+		else
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid dart buffer, only the first module of a handle can be a snapshot");
 
-		scope_define(sp, function_name(f), value_create_function(f));
+			free(buffers[iterator].first);
+		}
 	}
 
-	dart_function = dart_function_create(dart_handle);
+	Dart_FinalizeLoading(false);
 
-	if (dart_function != nullptr)
+	handle->library = Dart_NewPersistentHandle(library);
+
+	Dart_ExitScope();
+
+	Dart_ExitIsolate();
+
+	return (loader_handle)handle;
+}
+
+loader_handle dart_loader_impl_load_from_file(loader_impl impl, const loader_naming_path paths[], size_t size)
+{
+	std::vector<std::pair<uint8_t *, size_t>> buffers;
+
+	size_t iterator;
+
+	for (iterator = 0; iterator < size; ++iterator)
 	{
-		function f = function_create("new_args", 1, dart_function, &function_dart_singleton);
+		size_t buffer_size = 0;
 
-		signature s = function_signature(f);
+		uint8_t *buffer = dart_loader_impl_read_file(paths[iterator], &buffer_size);
 
-		signature_set_return(s, loader_impl_type(impl, "String"));
+		if (buffer == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid dart file: %s", paths[iterator]);
 
-		signature_set(s, 0, "a_str", loader_impl_type(impl, "String"));
+			continue;
+		}
 
-		scope_define(sp, function_name(f), value_create_function(f));
+		if (iterator == 0 || dart_loader_impl_is_kernel(buffer, buffer_size))
+		{
+			buffers.push_back(std::make_pair(buffer, buffer_size));
+		}
+		else
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid dart file %s, compile it offline into a kernel (dill)", paths[iterator]);
+
+			free(buffer);
+		}
 	}
 
-	dart_function = dart_function_create(dart_handle);
+	return dart_loader_impl_load_buffers(impl, size > 0 ? paths[0] : "main", buffers);
+}
 
-	if (dart_function != nullptr)
-	{
-		function f = function_create("two_str", 2, dart_function, &function_dart_singleton);
+loader_handle dart_loader_impl_load_from_memory(loader_impl impl, const loader_naming_name name, const char *buffer, size_t size)
+{
+	std::vector<std::pair<uint8_t *, size_t>> buffers;
 
-		signature s = function_signature(f);
+	uint8_t *copy;
 
-		signature_set_return(s, loader_impl_type(impl, "String"));
+	if (!dart_loader_impl_is_kernel((const uint8_t *)buffer, size))
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid dart buffer %s, only precompiled kernels can be loaded from memory", name);
 
-		signature_set(s, 0, "a_str", loader_impl_type(impl, "String"));
+		return NULL;
+	}
 
-		signature_set(s, 1, "b_str", loader_impl_type(impl, "String"));
+	/* The kernel must outlive the isolate so a copy is owned by the handle */
+	copy = (uint8_t *)malloc(size);
 
-		scope_define(sp, function_name(f), value_create_function(f));
+	if (copy == NULL)
+	{
+		return NULL;
 	}
 
-	dart_function = dart_function_create(dart_handle);
+	memcpy(copy, buffer, size);
 
-	if (dart_function != nullptr)
+	buffers.push_back(std::make_pair(copy, size));
+
+	return dart_loader_impl_load_buffers(impl, name, buffers);
+}
+
+loader_handle dart_loader_impl_load_from_package(loader_impl impl, const loader_naming_path path)
+{
+	/* Packages are isolate data snapshots (AppJIT or AppAOT data),
+	they boot without touching the compiler at all */
+	std::vector<std::pair<uint8_t *, size_t>> buffers;
+
+	size_t buffer_size = 0;
+
+	uint8_t *buffer = dart_loader_impl_read_file(path, &buffer_size);
+
+	if (buffer == NULL)
 	{
-		function f = function_create("three_str", 3, dart_function, &function_dart_singleton);
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid dart package: %s", path);
 
-		signature s = function_signature(f);
+		return NULL;
+	}
 
-		signature_set_return(s, loader_impl_type(impl, "String"));
+	buffers.push_back(std::make_pair(buffer, buffer_size));
 
-		signature_set(s, 0, "a_str", loader_impl_type(impl, "String"));
+	return dart_loader_impl_load_buffers(impl, path, buffers);
+}
 
-		signature_set(s, 1, "b_str", loader_impl_type(impl, "String"));
+int dart_loader_impl_clear(loader_impl impl, loader_handle handle)
+{
+	loader_impl_dart_handle dart_handle = (loader_impl_dart_handle)handle;
 
-		signature_set(s, 2, "c_str", loader_impl_type(impl, "String"));
+	size_t iterator;
 
-		scope_define(sp, function_name(f), value_create_function(f));
+	(void)impl;
+
+	if (dart_handle == nullptr)
+	{
+		return 1;
+	}
+
+	if (dart_handle->isolate != nullptr)
+	{
+		Dart_EnterIsolate(dart_handle->isolate);
+
+		if (dart_handle->library != nullptr)
+		{
+			Dart_DeletePersistentHandle(dart_handle->library);
+		}
+
+		Dart_ShutdownIsolate();
+	}
+
+	for (iterator = 0; iterator < dart_handle->kernel_buffers.size(); ++iterator)
+	{
+		free(dart_handle->kernel_buffers[iterator]);
+	}
+
+	for (iterator = 0; iterator < dart_handle->snapshot_buffers.size(); ++iterator)
+	{
+		free(dart_handle->snapshot_buffers[iterator]);
 	}
 
-	dart_function = dart_function_create(dart_handle);
+	delete dart_handle;
+
+	return 0;
+}
+
+loader_impl_dart_function dart_function_create(loader_impl_dart_handle dart_handle, Dart_Handle closure)
+{
+	loader_impl_dart_function dart_function = new loader_impl_dart_function_type();
 
 	if (dart_function != nullptr)
 	{
-		function f = function_create("my_empty_func_str", 0, dart_function, &function_dart_singleton);
+		dart_function->dart_handle = dart_handle;
 
-		signature s = function_signature(f);
+		dart_function->closure = Dart_NewPersistentHandle(closure);
 
-		signature_set_return(s, loader_impl_type(impl, "String"));
+		return dart_function;
+	}
+
+	return nullptr;
+}
+
+int dart_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx)
+{
+	loader_impl_dart dart_impl = static_cast<loader_impl_dart>(loader_impl_get(impl));
 
-		scope_define(sp, function_name(f), value_create_function(f));
+	loader_impl_dart_handle dart_handle = (loader_impl_dart_handle)handle;
+
+	scope sp = context_scope(ctx);
+
+	Dart_Handle library;
+
+	size_t iterator;
+
+	if (dart_handle->isolate == nullptr)
+	{
+		return 1;
 	}
 
-	dart_function = dart_function_create(dart_handle);
+	Dart_EnterIsolate(dart_handle->isolate);
 
-	if (dart_function != nullptr)
+	Dart_EnterScope();
+
+	library = Dart_HandleFromPersistent(dart_handle->library);
+
+	/* Each entry point is resolved exactly once, the tear-off closure
+	is pinned in a persistent handle so invokes skip library and
+	function lookup completely */
+	for (iterator = 0; iterator < dart_impl->entry_points.size(); ++iterator)
 	{
-		function f = function_create("my_empty_func_int", 0, dart_function, &function_dart_singleton);
+		const std::string &name = dart_impl->entry_points[iterator].first;
+
+		size_t arity = dart_impl->entry_points[iterator].second;
 
-		signature s = function_signature(f);
+		Dart_Handle closure = Dart_GetField(library, Dart_NewStringFromCString(name.c_str()));
 
-		signature_set_return(s, loader_impl_type(impl, "Integer"));
+		if (Dart_IsError(closure) || !Dart_IsClosure(closure))
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid dart entry point %s: %s", name.c_str(), Dart_IsError(closure) ? Dart_GetError(closure) : "not a function");
+
+			continue;
+		}
 
-		scope_define(sp, function_name(f), value_create_function(f));
+		loader_impl_dart_function dart_function = dart_function_create(dart_handle, closure);
+
+		if (dart_function != nullptr)
+		{
+			function f = function_create(name.c_str(), arity, dart_function, &function_dart_singleton);
+
+			signature s = function_signature(f);
+
+			size_t args_count;
+
+			/* Kernel metadata does not surface parameter types through
+			the embedding API so signatures stay dynamically typed */
+			for (args_count = 0; args_count < arity; ++args_count)
+			{
+				char arg_name[0x20];
+
+				snprintf(arg_name, sizeof(arg_name), "arg%" PRIuS, args_count);
+
+				signature_set(s, args_count, arg_name, NULL);
+			}
+
+			scope_define(sp, function_name(f), value_create_function(f));
+		}
 	}
 
+	Dart_ExitScope();
+
+	Dart_ExitIsolate();
+
 	return 0;
 }
 
@@ -573,6 +844,22 @@ int dart_loader_impl_destroy(loader_impl impl)
 		/* Destroy children loaders */
 		loader_unload_children(impl);
 
+		if (dart_impl->vm_initialized == 1)
+		{
+			char *error = Dart_Cleanup();
+
+			if (error != NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Invalid dart VM destruction: %s", error);
+
+				free(error);
+			}
+		}
+
+		free(dart_impl->vm_snapshot_data);
+
+		free(dart_impl->vm_snapshot_instructions);
+
 		delete dart_impl;
 
 		return 0;
@@ -1,4 +1,13 @@
 fn main() {
+    // Share the compilation cache directory with the node loader so V8
+    // artifacts for identical sources are reused host wide, without
+    // overriding an explicitly configured deno cache
+    if let Ok(cache_path) = std::env::var("METACALL_CODE_CACHE_PATH") {
+        if !cache_path.is_empty() && std::env::var("DENO_DIR").is_err() {
+            std::env::set_var("DENO_DIR", cache_path);
+        }
+    }
+
     match tokio::runtime::Runtime::new()
         .expect("meme")
         .block_on(deno::run_command(
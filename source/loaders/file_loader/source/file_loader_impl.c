@@ -31,6 +31,8 @@
 
 #include <adt/adt_vector.h>
 
+#include <environment/environment_variable.h>
+
 #include <log/log.h>
 
 #include <stdlib.h>
@@ -60,7 +62,9 @@ typedef struct _stat file_stat_type;
 	defined(__MINGW32__) || defined(__MINGW64__) ||                                     \
 	(defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
 
+	#include <fcntl.h>
 	#include <limits.h>
+	#include <sys/mman.h>
 	#include <unistd.h>
 
 	#define LOADER_IMPL_FILE_SIZE PATH_MAX
@@ -98,9 +102,144 @@ typedef struct loader_impl_file_function_type
 
 } * loader_impl_file_function;
 
+typedef struct loader_impl_file_map_type
+{
+	void *data;
+	size_t size;
+
+#if defined(WIN32) || defined(_WIN32)
+	HANDLE file;
+	HANDLE mapping;
+#endif
+
+} * loader_impl_file_map;
+
+static loader_impl_file_map file_loader_impl_map(const char *path);
+static void file_loader_impl_map_destroy(loader_impl_file_map map);
+static void file_loader_impl_map_finalize(value v, void *data);
 static int file_loader_impl_load_path(loader_impl_file_handle handle, const loader_naming_name path);
 static void file_loader_impl_load_execution_path(loader_impl_file file_impl, loader_impl_file_handle handle, const loader_naming_name path);
 
+loader_impl_file_map file_loader_impl_map(const char *path)
+{
+	loader_impl_file_map map = malloc(sizeof(struct loader_impl_file_map_type));
+
+	if (map == NULL)
+	{
+		return NULL;
+	}
+
+#if defined(WIN32) || defined(_WIN32)
+	{
+		LARGE_INTEGER length;
+
+		map->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+		if (map->file == INVALID_HANDLE_VALUE)
+		{
+			free(map);
+
+			return NULL;
+		}
+
+		if (GetFileSizeEx(map->file, &length) == FALSE || length.QuadPart <= 0)
+		{
+			CloseHandle(map->file);
+
+			free(map);
+
+			return NULL;
+		}
+
+		map->mapping = CreateFileMappingA(map->file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+		if (map->mapping == NULL)
+		{
+			CloseHandle(map->file);
+
+			free(map);
+
+			return NULL;
+		}
+
+		map->data = MapViewOfFile(map->mapping, FILE_MAP_READ, 0, 0, 0);
+
+		if (map->data == NULL)
+		{
+			CloseHandle(map->mapping);
+
+			CloseHandle(map->file);
+
+			free(map);
+
+			return NULL;
+		}
+
+		map->size = (size_t)length.QuadPart;
+	}
+#else
+	{
+		file_stat_type fs;
+
+		int fd = open(path, O_RDONLY);
+
+		if (fd == -1)
+		{
+			free(map);
+
+			return NULL;
+		}
+
+		if (fstat(fd, &fs) != 0 || fs.st_size <= 0)
+		{
+			close(fd);
+
+			free(map);
+
+			return NULL;
+		}
+
+		map->data = mmap(NULL, (size_t)fs.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		/* The mapping holds its own reference to the file */
+		close(fd);
+
+		if (map->data == MAP_FAILED)
+		{
+			free(map);
+
+			return NULL;
+		}
+
+		map->size = (size_t)fs.st_size;
+	}
+#endif
+
+	return map;
+}
+
+void file_loader_impl_map_destroy(loader_impl_file_map map)
+{
+#if defined(WIN32) || defined(_WIN32)
+	UnmapViewOfFile(map->data);
+
+	CloseHandle(map->mapping);
+
+	CloseHandle(map->file);
+#else
+	munmap(map->data, map->size);
+#endif
+
+	free(map);
+}
+
+void file_loader_impl_map_finalize(value v, void *data)
+{
+	(void)v;
+
+	file_loader_impl_map_destroy(data);
+}
+
 int function_file_interface_create(function func, function_impl impl)
 {
 	(void)func;
@@ -113,10 +252,29 @@ function_return function_file_interface_invoke(function func, function_impl impl
 {
 	loader_impl_file_function file_function = (loader_impl_file_function)impl;
 
+	/* Map the file and return a buffer aliasing the mapping, loading
+	an asset is a page table operation instead of a copy through stdio */
+	loader_impl_file_map map = file_loader_impl_map(file_function->descriptor->path);
+
 	(void)func;
 	(void)args;
 	(void)size;
 
+	if (map != NULL)
+	{
+		value v = value_create_buffer_view(map->data, map->size);
+
+		if (v != NULL)
+		{
+			value_finalizer(v, &file_loader_impl_map_finalize, map);
+
+			return v;
+		}
+
+		file_loader_impl_map_destroy(map);
+	}
+
+	/* Fall back to the path when the file cannot be mapped */
 	return value_create_string(file_function->descriptor->path, file_function->descriptor->length);
 }
 
@@ -153,7 +311,8 @@ function_interface function_file_singleton(void)
 		&function_file_interface_create,
 		&function_file_interface_invoke,
 		&function_file_interface_await,
-		&function_file_interface_destroy
+		&function_file_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &file_interface;
@@ -454,7 +613,9 @@ int file_loader_impl_discover(loader_impl impl, loader_handle handle, context ct
 
 		if (file_function != NULL)
 		{
-			const char *script_path = getenv("LOADER_SCRIPT_PATH");
+			/* Snapshot backed read, this runs once per discovered file
+			so it must not pay the libc environment scan every time */
+			const char *script_path = environment_variable_get("LOADER_SCRIPT_PATH", NULL);
 
 			function f;
 
@@ -33,7 +33,9 @@ loader_impl_interface java_loader_impl_interface_singleton(void)
 		&java_loader_impl_load_from_package,
 		&java_loader_impl_clear,
 		&java_loader_impl_discover,
-		&java_loader_impl_destroy
+		&java_loader_impl_destroy,
+		NULL /* parallel */,
+		NULL /* address */
 	};
 
 	return &loader_impl_interface_java;
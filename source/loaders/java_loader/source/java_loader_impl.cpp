@@ -27,10 +27,14 @@
 #include <reflect/reflect_function.h>
 #include <reflect/reflect_scope.h>
 #include <reflect/reflect_type.h>
+#include <reflect/reflect_value_type.h>
 
 #include <log/log.h>
 
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <new>
 
 #include <jni.h>
 
@@ -49,30 +53,239 @@ typedef struct loader_impl_java_handle_type
 
 typedef struct loader_impl_java_function_type
 {
-	void *todo;
+	loader_impl_java java_impl;
+	jclass cls;		  // Global reference, resolved once at discovery
+	jobject object;	  // Global reference, null for static methods
+	jmethodID method; // Method IDs stay valid while the class is loaded
+	jvalue *args;	  // Preallocated argument slots, one per signature index
+	size_t args_size;
 
 } * loader_impl_java_function;
 
 //static void java_loader_impl_exception()
 
+// Convert a metacall value into the preallocated jvalue slot, object
+// arguments become local references released when the frame is popped
+static int java_loader_impl_jvalue(JNIEnv *env, value v, jvalue *j)
+{
+	switch (value_type_id(v))
+	{
+		case TYPE_BOOL:
+			j->z = value_to_bool(v) == 0L ? JNI_FALSE : JNI_TRUE;
+			return 0;
+
+		case TYPE_CHAR:
+			j->c = (jchar)value_to_char(v);
+			return 0;
+
+		case TYPE_SHORT:
+			j->s = (jshort)value_to_short(v);
+			return 0;
+
+		case TYPE_INT:
+			j->i = (jint)value_to_int(v);
+			return 0;
+
+		case TYPE_LONG:
+			j->j = (jlong)value_to_long(v);
+			return 0;
+
+		case TYPE_FLOAT:
+			j->f = (jfloat)value_to_float(v);
+			return 0;
+
+		case TYPE_DOUBLE:
+			j->d = (jdouble)value_to_double(v);
+			return 0;
+
+		case TYPE_STRING:
+			j->l = env->NewStringUTF(value_to_string(v));
+			return j->l == nullptr;
+
+		case TYPE_PTR:
+			j->j = (jlong)(intptr_t)value_to_ptr(v);
+			return 0;
+
+		default:
+			return 1;
+	}
+}
+
 int function_java_interface_create(function func, function_impl impl)
 {
-	(void)func;
-	(void)impl;
+	loader_impl_java_function java_function = static_cast<loader_impl_java_function>(impl);
+
+	signature s = function_signature(func);
+
+	// Allocate the argument slots once, calls only fill them in
+	java_function->args_size = signature_count(s);
+
+	if (java_function->args_size > 0)
+	{
+		java_function->args = new (std::nothrow) jvalue[java_function->args_size];
+
+		if (java_function->args == nullptr)
+		{
+			return 1;
+		}
+	}
+	else
+	{
+		java_function->args = nullptr;
+	}
 
 	return 0;
 }
 
 function_return function_java_interface_invoke(function func, function_impl impl, function_args args, size_t size)
 {
-	/* TODO */
+	loader_impl_java_function java_function = static_cast<loader_impl_java_function>(impl);
 
-	(void)func;
-	(void)impl;
-	(void)args;
-	(void)size;
+	if (java_function->method == nullptr || size != java_function->args_size)
+	{
+		return NULL;
+	}
 
-	return NULL;
+	loader_impl_java java_impl = java_function->java_impl;
+
+	JNIEnv *env;
+
+	if (java_impl->jvm->AttachCurrentThread((void **)&env, NULL) != JNI_OK)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Could not attach the invoke thread to the JVM");
+		return NULL;
+	}
+
+	// Size the local frame to the signature plus the slots the call
+	// itself needs, references never accumulate past the invocation
+	if (env->PushLocalFrame((jint)(size + 4)) != JNI_OK)
+	{
+		return NULL;
+	}
+
+	for (size_t iterator = 0; iterator < size; ++iterator)
+	{
+		if (java_loader_impl_jvalue(env, args[iterator], &java_function->args[iterator]) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid argument conversion at position %" PRIuS " in java function invocation", iterator);
+			env->PopLocalFrame(nullptr);
+			return NULL;
+		}
+	}
+
+	signature s = function_signature(func);
+
+	type ret_type = signature_get_return(s);
+
+	type_id ret_id = ret_type == NULL ? TYPE_NULL : type_index(ret_type);
+
+	const bool is_static = java_function->object == nullptr;
+
+	value ret = NULL;
+
+	switch (ret_id)
+	{
+		case TYPE_BOOL: {
+			jboolean z = is_static ? env->CallStaticBooleanMethodA(java_function->cls, java_function->method, java_function->args) :
+									 env->CallBooleanMethodA(java_function->object, java_function->method, java_function->args);
+			ret = value_create_bool(z == JNI_FALSE ? 0L : 1L);
+			break;
+		}
+
+		case TYPE_CHAR: {
+			jchar c = is_static ? env->CallStaticCharMethodA(java_function->cls, java_function->method, java_function->args) :
+								  env->CallCharMethodA(java_function->object, java_function->method, java_function->args);
+			ret = value_create_char((char)c);
+			break;
+		}
+
+		case TYPE_SHORT: {
+			jshort sh = is_static ? env->CallStaticShortMethodA(java_function->cls, java_function->method, java_function->args) :
+									env->CallShortMethodA(java_function->object, java_function->method, java_function->args);
+			ret = value_create_short((short)sh);
+			break;
+		}
+
+		case TYPE_INT: {
+			jint i = is_static ? env->CallStaticIntMethodA(java_function->cls, java_function->method, java_function->args) :
+								 env->CallIntMethodA(java_function->object, java_function->method, java_function->args);
+			ret = value_create_int((int)i);
+			break;
+		}
+
+		case TYPE_LONG: {
+			jlong l = is_static ? env->CallStaticLongMethodA(java_function->cls, java_function->method, java_function->args) :
+								  env->CallLongMethodA(java_function->object, java_function->method, java_function->args);
+			ret = value_create_long((long)l);
+			break;
+		}
+
+		case TYPE_FLOAT: {
+			jfloat f = is_static ? env->CallStaticFloatMethodA(java_function->cls, java_function->method, java_function->args) :
+								   env->CallFloatMethodA(java_function->object, java_function->method, java_function->args);
+			ret = value_create_float((float)f);
+			break;
+		}
+
+		case TYPE_DOUBLE: {
+			jdouble d = is_static ? env->CallStaticDoubleMethodA(java_function->cls, java_function->method, java_function->args) :
+									env->CallDoubleMethodA(java_function->object, java_function->method, java_function->args);
+			ret = value_create_double((double)d);
+			break;
+		}
+
+		case TYPE_STRING: {
+			jobject str = is_static ? env->CallStaticObjectMethodA(java_function->cls, java_function->method, java_function->args) :
+									  env->CallObjectMethodA(java_function->object, java_function->method, java_function->args);
+
+			if (str != nullptr)
+			{
+				const char *utf = env->GetStringUTFChars(static_cast<jstring>(str), nullptr);
+
+				if (utf != nullptr)
+				{
+					ret = value_create_string(utf, strlen(utf));
+
+					env->ReleaseStringUTFChars(static_cast<jstring>(str), utf);
+				}
+			}
+			break;
+		}
+
+		case TYPE_NULL: {
+			if (is_static)
+			{
+				env->CallStaticVoidMethodA(java_function->cls, java_function->method, java_function->args);
+			}
+			else
+			{
+				env->CallVoidMethodA(java_function->object, java_function->method, java_function->args);
+			}
+			ret = value_create_null();
+			break;
+		}
+
+		default: {
+			log_write("metacall", LOG_LEVEL_ERROR, "Unsupported return type in java function invocation");
+			break;
+		}
+	}
+
+	if (env->ExceptionCheck() == JNI_TRUE)
+	{
+		env->ExceptionClear();
+
+		if (ret != NULL)
+		{
+			value_type_destroy(ret);
+
+			ret = NULL;
+		}
+	}
+
+	env->PopLocalFrame(nullptr);
+
+	return ret;
 }
 
 function_return function_java_interface_await(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
@@ -98,6 +311,24 @@ void function_java_interface_destroy(function func, function_impl impl)
 
 	if (java_function != NULL)
 	{
+		JNIEnv *env;
+
+		if (java_function->java_impl != NULL &&
+			java_function->java_impl->jvm->AttachCurrentThread((void **)&env, NULL) == JNI_OK)
+		{
+			if (java_function->cls != nullptr)
+			{
+				env->DeleteGlobalRef(java_function->cls);
+			}
+
+			if (java_function->object != nullptr)
+			{
+				env->DeleteGlobalRef(java_function->object);
+			}
+		}
+
+		delete[] java_function->args;
+
 		delete java_function;
 	}
 }
@@ -108,7 +339,8 @@ function_interface function_java_singleton()
 		&function_java_interface_create,
 		&function_java_interface_invoke,
 		&function_java_interface_await,
-		&function_java_interface_destroy
+		&function_java_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &java_interface;
@@ -33,7 +33,9 @@ loader_impl_interface jl_loader_impl_interface_singleton(void)
 		&jl_loader_impl_load_from_package,
 		&jl_loader_impl_clear,
 		&jl_loader_impl_discover,
-		&jl_loader_impl_destroy
+		&jl_loader_impl_destroy,
+		NULL /* parallel */,
+		NULL /* address */
 	};
 
 	return &loader_impl_interface_jl;
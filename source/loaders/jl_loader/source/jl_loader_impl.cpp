@@ -31,29 +31,40 @@
 
 #include <log/log.h>
 
-// TODO: Add Julia headers here
+#include <configuration/configuration.h>
+
 #include <julia.h>
 
+#include <cstring>
+
+#define JL_LOADER_IMPL_ARGS_SIZE 0x10
+
 typedef struct loader_impl_jl_function_type
 {
-	// TODO: The reference to Julia function must be stored here
-	void *todo;
+	jl_function_t *func; /* Rooted through the global binding, modules are never unloaded */
+
+	/* Specialization cache: when the argument types or the world age
+	of a call differ from the cached ones, the specialization for the
+	new signature is compiled once through precompile; repeat calls
+	with identical types then dispatch through the method table cache
+	without hitting the compiler */
+	size_t world;
+	type_id arg_types[JL_LOADER_IMPL_ARGS_SIZE];
+	size_t args_size;
+	int specialized;
 
 } * loader_impl_jl_function;
 
 typedef struct loader_impl_jl_handle_type
 {
-	// TODO: The references to Julia scripts must be stored here
-	// This should contain a vector with all Julia scripts loaded
-	void *todo;
+	/* Scripts evaluate into Main, the handle itself carries no state */
+	void *handle_jl_data;
 
 } * loader_impl_jl_handle;
 
 typedef struct loader_impl_jl_type
 {
-	// TODO: The reference to Julia runtime instance must be stored here
-	// This structure holds any data that must live between initialize and destroy
-	void *todo;
+	int precompile; /* Precompile the discovered methods at load time */
 
 } * loader_impl_jl;
 
@@ -85,10 +96,118 @@ type_interface type_jl_singleton(void)
 	return &jl_type_interface;
 }
 
-int function_jl_interface_create(function func, function_impl impl)
+static jl_value_t *jl_loader_impl_exception(const char *what)
 {
-	/* TODO */
+	jl_value_t *ex = jl_exception_occurred();
+
+	if (ex != NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Julia exception (%s): %s", what, jl_typeof_str(ex));
+
+		jl_exception_clear();
+	}
+
+	return ex;
+}
+
+static jl_value_t *jl_loader_impl_value_to_jl(value v)
+{
+	switch (value_type_id(v))
+	{
+		case TYPE_BOOL:
+			return jl_box_bool(value_to_bool(v) == 1L);
+
+		case TYPE_CHAR:
+			return jl_box_int8((int8_t)value_to_char(v));
+
+		case TYPE_SHORT:
+			return jl_box_int16((int16_t)value_to_short(v));
+
+		case TYPE_INT:
+			return jl_box_int32((int32_t)value_to_int(v));
+
+		case TYPE_LONG:
+			return jl_box_int64((int64_t)value_to_long(v));
 
+		case TYPE_FLOAT:
+			return jl_box_float32(value_to_float(v));
+
+		case TYPE_DOUBLE:
+			return jl_box_float64(value_to_double(v));
+
+		case TYPE_STRING:
+			return jl_cstr_to_string(value_to_string(v));
+
+		case TYPE_PTR:
+			return jl_box_voidpointer(value_to_ptr(v));
+
+		case TYPE_NULL:
+			return jl_nothing;
+
+		default:
+			return NULL;
+	}
+}
+
+static value jl_loader_impl_jl_to_value(jl_value_t *v)
+{
+	if (v == NULL || jl_is_nothing(v))
+	{
+		return value_create_null();
+	}
+
+	if (jl_is_bool(v))
+	{
+		return value_create_bool(jl_unbox_bool(v) != 0 ? 1L : 0L);
+	}
+
+	if (jl_typeis(v, jl_int8_type))
+	{
+		return value_create_char((char)jl_unbox_int8(v));
+	}
+
+	if (jl_typeis(v, jl_int16_type))
+	{
+		return value_create_short((short)jl_unbox_int16(v));
+	}
+
+	if (jl_typeis(v, jl_int32_type))
+	{
+		return value_create_int((int)jl_unbox_int32(v));
+	}
+
+	if (jl_typeis(v, jl_int64_type))
+	{
+		return value_create_long((long)jl_unbox_int64(v));
+	}
+
+	if (jl_typeis(v, jl_float32_type))
+	{
+		return value_create_float(jl_unbox_float32(v));
+	}
+
+	if (jl_typeis(v, jl_float64_type))
+	{
+		return value_create_double(jl_unbox_float64(v));
+	}
+
+	if (jl_is_string(v))
+	{
+		return value_create_string(jl_string_ptr(v), jl_string_len(v));
+	}
+
+	if (jl_typeis(v, jl_voidpointer_type))
+	{
+		return value_create_ptr(jl_unbox_voidpointer(v));
+	}
+
+	log_write("metacall", LOG_LEVEL_WARNING, "Unsupported Julia return type (%s)", jl_typeof_str(v));
+
+	return NULL;
+}
+
+int function_jl_interface_create(function func, function_impl impl)
+{
 	(void)func;
 	(void)impl;
 
@@ -97,14 +216,98 @@ int function_jl_interface_create(function func, function_impl impl)
 
 function_return function_jl_interface_invoke(function func, function_impl impl, function_args args, size_t size)
 {
-	/* TODO */
+	loader_impl_jl_function jl_func = (loader_impl_jl_function)impl;
 
-	(void)func;
-	(void)impl;
-	(void)args;
-	(void)size;
+	jl_value_t **argv;
 
-	return NULL;
+	jl_value_t *result;
+
+	function_return ret;
+
+	size_t iterator, world;
+
+	int hit;
+
+	JL_GC_PUSHARGS(argv, size + 1);
+
+	argv[0] = (jl_value_t *)jl_func->func;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		argv[iterator + 1] = jl_loader_impl_value_to_jl((value)args[iterator]);
+
+		if (argv[iterator + 1] == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Unsupported argument type (%d) invoking Julia function %s", value_type_id((value)args[iterator]), function_name(func));
+
+			JL_GC_POP();
+
+			return NULL;
+		}
+	}
+
+	world = jl_get_world_counter();
+
+	/* Check the specialization cache against the argument types and
+	the world age of this call */
+	hit = (jl_func->specialized != 0 && jl_func->world == world && jl_func->args_size == size);
+
+	for (iterator = 0; hit != 0 && iterator < size; ++iterator)
+	{
+		hit = (jl_func->arg_types[iterator] == value_type_id((value)args[iterator]));
+	}
+
+	if (hit == 0 && size <= JL_LOADER_IMPL_ARGS_SIZE)
+	{
+		/* New signature or a method redefinition moved the world age,
+		compile the specialization once so the call below and every
+		repeat with these types run the cached native code */
+		jl_function_t *precompile_func = jl_get_function(jl_base_module, "precompile");
+
+		if (precompile_func != NULL)
+		{
+			jl_value_t **type_params;
+
+			JL_GC_PUSHARGS(type_params, size + 1);
+
+			for (iterator = 0; iterator < size; ++iterator)
+			{
+				type_params[iterator] = jl_typeof(argv[iterator + 1]);
+			}
+
+			type_params[size] = (jl_value_t *)jl_apply_tuple_type_v(type_params, size);
+
+			jl_call2(precompile_func, argv[0], type_params[size]);
+
+			JL_GC_POP();
+
+			jl_exception_clear();
+		}
+
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			jl_func->arg_types[iterator] = value_type_id((value)args[iterator]);
+		}
+
+		jl_func->args_size = size;
+		jl_func->world = world;
+		jl_func->specialized = 1;
+	}
+
+	result = jl_call(jl_func->func, &argv[1], (uint32_t)size);
+
+	if (jl_loader_impl_exception(function_name(func)) != NULL)
+	{
+		JL_GC_POP();
+
+		return NULL;
+	}
+
+	ret = jl_loader_impl_jl_to_value(result);
+
+	JL_GC_POP();
+
+	return ret;
 }
 
 function_return function_jl_interface_await(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
@@ -124,10 +327,14 @@ function_return function_jl_interface_await(function func, function_impl impl, f
 
 void function_jl_interface_destroy(function func, function_impl impl)
 {
-	/* TODO */
+	loader_impl_jl_function jl_func = (loader_impl_jl_function)impl;
 
 	(void)func;
-	(void)impl;
+
+	if (jl_func != NULL)
+	{
+		delete jl_func;
+	}
 }
 
 function_interface function_jl_singleton(void)
@@ -136,7 +343,8 @@ function_interface function_jl_singleton(void)
 		&function_jl_interface_create,
 		&function_jl_interface_invoke,
 		&function_jl_interface_await,
-		&function_jl_interface_destroy
+		&function_jl_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &jl_function_interface;
@@ -166,8 +374,10 @@ int jl_loader_impl_register_types(loader_impl impl)
 		// { TYPE_LONG_LONG, "Int128" },
 		// { TYPE_LONG_LONG, "UInt128" },
 		// TODO: We don't support 16 bits floating point (yet?)
-		{ TYPE_FLOAT, "Float32" } { TYPE_DOUBLE, "Float64" }
-		// TODO: String
+		{ TYPE_FLOAT, "Float32" },
+		{ TYPE_DOUBLE, "Float64" },
+		{ TYPE_STRING, "String" },
+		{ TYPE_BOOL, "Bool" }
 
 	};
 
@@ -198,24 +408,40 @@ loader_impl_data jl_loader_impl_initialize(loader_impl impl, configuration confi
 
 	if (jl_impl == nullptr)
 	{
-		// TODO: Emit exception when exception handling is implemented
 		return NULL;
 	}
 
-	// TODO:
-	// Initialize Julia runtime here
+	if (jl_is_initialized() == 0)
+	{
+		/* A cached sysimage configured through jl_loader (sysimage)
+		skips the bootstrap compilation of the base library */
+		value sysimage = config != NULL ? configuration_value(config, "sysimage") : NULL;
+
+		if (sysimage != NULL && value_type_id(sysimage) == TYPE_STRING)
+		{
+			jl_init_with_image(NULL, value_to_string(sysimage));
+		}
+		else
+		{
+			jl_init();
+		}
+	}
+
+	{
+		/* Precompilation of the discovered methods at load time is the
+		default, it can be disabled through the configuration */
+		value precompile = config != NULL ? configuration_value(config, "precompile") : NULL;
+
+		jl_impl->precompile = (precompile == NULL || (value_type_id(precompile) == TYPE_BOOL && value_to_bool(precompile) == 1L));
+	}
 
 	/* Register the types */
 	if (jl_loader_impl_register_types(impl) != 0)
 	{
-		// TODO: Emit exception when exception handling is implemented
 		delete jl_impl;
 		return NULL;
 	}
 
-	// TODO: Handle something with the configuration?
-	(void)config;
-
 	/* Register initialization */
 	loader_initialization_register(impl);
 
@@ -247,13 +473,24 @@ loader_handle jl_loader_impl_load_from_file(loader_impl impl, const loader_namin
 		return NULL;
 	}
 
-	// TODO: Load here the list of paths of files and then store them into loader_impl_jl_handle_type
-
 	(void)jl_impl;
-	(void)paths;
-	(void)size;
 
-	// TODO: Return here the pointer to loader_impl_jl_handle_type
+	for (size_t iterator = 0; iterator < size; ++iterator)
+	{
+		jl_load(jl_main_module, paths[iterator]);
+
+		if (jl_loader_impl_exception(paths[iterator]) != NULL)
+		{
+			delete jl_handle;
+
+			return NULL;
+		}
+
+		log_write("metacall", LOG_LEVEL_DEBUG, "Julia module %s loaded from file", paths[iterator]);
+	}
+
+	jl_handle->handle_jl_data = NULL;
+
 	return static_cast<loader_handle>(jl_handle);
 }
 
@@ -268,38 +505,33 @@ loader_handle jl_loader_impl_load_from_memory(loader_impl impl, const loader_nam
 		return NULL;
 	}
 
-	// TODO: The same load_from_file but you have to load from the string buffer instead of from file
-	// This is similar to an eval in JavaScript
-
 	(void)jl_impl;
-	(void)name;
-	(void)buffer;
 	(void)size;
 
-	// TODO: Return here the pointer to loader_impl_jl_handle_type
-	return static_cast<loader_handle>(jl_handle);
-}
-
-loader_handle jl_loader_impl_load_from_package(loader_impl impl, const loader_naming_path path)
-{
-	loader_impl_jl jl_impl = static_cast<loader_impl_jl>(loader_impl_get(impl));
-	loader_impl_jl_handle jl_handle = new loader_impl_jl_handle_type();
+	jl_eval_string(buffer);
 
-	if (jl_handle == nullptr)
+	if (jl_loader_impl_exception(name) != NULL)
 	{
-		// TODO: Emit exception when exception handling is implemented
+		delete jl_handle;
+
 		return NULL;
 	}
 
-	// TODO: The same as load_from_file but this should load from binary format instead of readable format
-	// Usually this is for loading DLLs or precompiled binaries, not sure if Julia supports this
-	// If Julia does not support this feature, just leave it empty and return NULL
+	log_write("metacall", LOG_LEVEL_DEBUG, "Julia module %s loaded from memory", name);
+
+	jl_handle->handle_jl_data = NULL;
+
+	return static_cast<loader_handle>(jl_handle);
+}
 
+loader_handle jl_loader_impl_load_from_package(loader_impl impl, const loader_naming_path path)
+{
+	/* Julia has no binary handle format of its own, precompiled code
+	is carried by the sysimage selected at initialization */
 	(void)impl;
 	(void)path;
 
-	// TODO: Return here the pointer to loader_impl_jl_handle_type
-	return static_cast<loader_handle>(jl_handle);
+	return NULL;
 }
 
 int jl_loader_impl_clear(loader_impl impl, loader_handle handle)
@@ -307,10 +539,9 @@ int jl_loader_impl_clear(loader_impl impl, loader_handle handle)
 	loader_impl_jl jl_impl = static_cast<loader_impl_jl>(loader_impl_get(impl));
 	loader_impl_jl_handle jl_handle = static_cast<loader_impl_jl_handle>(handle);
 
-	// TODO: Clear the array of modules from the jl_handle and free all the memory related to it
+	/* The definitions stay in Main, only the handle itself goes away */
 	(void)jl_impl;
 
-	// Then delete the Julia handle itself
 	delete jl_handle;
 
 	return 0;
@@ -319,15 +550,90 @@ int jl_loader_impl_clear(loader_impl impl, loader_handle handle)
 int jl_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx)
 {
 	loader_impl_jl jl_impl = static_cast<loader_impl_jl>(loader_impl_get(impl));
-	loader_impl_jl_handle jl_handle = static_cast<loader_impl_jl_handle>(handle);
 
-	// TODO:
-	// Iterate all the modules loaded by this jl_handle,
-	// introspect the functions and structs and store them into ctx
+	scope sp = context_scope(ctx);
 
-	(void)jl_impl;
-	(void)jl_handle;
-	(void)ctx;
+	/* Previously discovered handles already own their globals, skip them */
+	scope sp_global = context_scope(loader_impl_context(impl));
+
+	jl_value_t *names;
+
+	(void)handle;
+
+	/* Scripts evaluate into Main, enumerate the functions defined there */
+	names = jl_eval_string(
+		"String.(filter(n -> isdefined(Main, n) &&"
+		" getfield(Main, n) isa Function &&"
+		" !startswith(String(n), \"#\") &&"
+		" !(n in (:eval, :include)), names(Main; all = true)))");
+
+	if (jl_loader_impl_exception("discover") != NULL || names == NULL)
+	{
+		return 1;
+	}
+
+	JL_GC_PUSH1(&names);
+
+	for (size_t iterator = 0, size = jl_array_len(names); iterator < size; ++iterator)
+	{
+		jl_value_t *name_str = jl_arrayref((jl_array_t *)names, iterator);
+
+		const char *name = jl_string_ptr(name_str);
+
+		if (scope_get(sp, name) == NULL && scope_get(sp_global, name) == NULL)
+		{
+			jl_function_t *jl_f = jl_get_function(jl_main_module, name);
+
+			if (jl_f != NULL)
+			{
+				loader_impl_jl_function jl_func = new loader_impl_jl_function_type();
+
+				if (jl_func != nullptr)
+				{
+					jl_func->func = jl_f;
+					jl_func->world = 0;
+					jl_func->args_size = 0;
+					jl_func->specialized = 0;
+
+					function f = function_create(name, 0, jl_func, &function_jl_singleton);
+
+					if (f != NULL)
+					{
+						scope_define(sp, function_name(f), value_create_function(f));
+					}
+					else
+					{
+						delete jl_func;
+					}
+				}
+			}
+		}
+	}
+
+	JL_GC_POP();
+
+	if (jl_impl->precompile != 0)
+	{
+		/* Compile the specializations of every method signature of the
+		discovered functions now, so the workers do not pay the first
+		call compilation latency at request time */
+		static const char precompile_script[] =
+			"for n in names(Main; all = true)\n"
+			"    isdefined(Main, n) || continue\n"
+			"    f = getfield(Main, n)\n"
+			"    f isa Function || continue\n"
+			"    for m in methods(f)\n"
+			"        try\n"
+			"            precompile(f, Tuple{m.sig.parameters[2:end]...})\n"
+			"        catch\n"
+			"        end\n"
+			"    end\n"
+			"end\n";
+
+		jl_eval_string(precompile_script);
+
+		jl_loader_impl_exception("precompile");
+	}
 
 	return 0;
 }
@@ -339,11 +645,11 @@ int jl_loader_impl_destroy(loader_impl impl)
 	/* Destroy children loaders */
 	loader_unload_children(impl);
 
-	/* TODO */
-	// Clear here the resources, it must free all memory related to jl_impl.
-	// The destruction of the jl_impl contents must be done always after loader_unload_children
+	if (jl_is_initialized() != 0)
+	{
+		jl_atexit_hook(0);
+	}
 
-	// Then delete the Julia loader itself
 	delete jl_impl;
 
 	return 0;
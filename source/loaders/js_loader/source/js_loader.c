@@ -33,7 +33,9 @@ loader_impl_interface js_loader_impl_interface_singleton(void)
 		&js_loader_impl_load_from_package,
 		&js_loader_impl_clear,
 		&js_loader_impl_discover,
-		&js_loader_impl_destroy
+		&js_loader_impl_destroy,
+		NULL /* parallel */,
+		NULL /* address */
 	};
 
 	return &loader_impl_interface_js;
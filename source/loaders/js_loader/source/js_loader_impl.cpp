@@ -29,8 +29,12 @@
 #include <reflect/reflect_scope.h>
 #include <reflect/reflect_type.h>
 
+#include <configuration/configuration.h>
+
 #include <log/log.h>
 
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 
@@ -54,6 +58,8 @@ MaybeLocal<String> js_loader_impl_read_script(Isolate *isolate, const char *buff
 
 void js_loader_impl_obj_to_string(Handle<Value> object, std::string &str);
 
+void js_loader_impl_read_file(const loader_naming_path path, std::string &source);
+
 function_interface function_js_singleton();
 
 class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator
@@ -89,9 +95,13 @@ typedef struct loader_impl_js_type
 	Isolate::CreateParams isolate_create_params;
 	Isolate::Scope *isolate_scope;
 	ArrayBufferAllocator allocator;
+	StartupData snapshot_blob;	 /* Custom startup snapshot the isolate boots from, data owned here */
+	std::string code_cache_path; /* Directory for code cache artifacts, empty disables caching */
 
 } * loader_impl_js;
 
+Local<Script> js_loader_impl_compile_cached(loader_impl_js js_impl, Local<Context> &ctx_impl, Local<String> source_str, const char *buffer, size_t size);
+
 typedef class loader_impl_js_function_type
 {
 public:
@@ -167,7 +177,7 @@ public:
 	{
 		Local<String> source = js_loader_impl_read_script(js_impl->isolate, buffer, size, functions).ToLocalChecked();
 
-		script = Script::Compile(ctx_impl, source).ToLocalChecked();
+		script = js_loader_impl_compile_cached(js_impl, ctx_impl, source, buffer, size);
 
 		Local<Value> result = script->Run(ctx_impl).ToLocalChecked();
 
@@ -559,12 +569,192 @@ function_interface function_js_singleton(void)
 		&function_js_interface_create,
 		&function_js_interface_invoke,
 		&function_js_interface_await,
-		&function_js_interface_destroy
+		&function_js_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &js_interface;
 }
 
+/* Stable identity of a script buffer (FNV-1a), names its cached
+code artifact on disk */
+uint64_t js_loader_impl_buffer_hash(const char *buffer, size_t size)
+{
+	uint64_t hash = 0xcbf29ce484222325ull;
+
+	size_t iterator;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		hash ^= (uint64_t)(unsigned char)buffer[iterator];
+		hash *= 0x100000001b3ull;
+	}
+
+	return hash;
+}
+
+bool js_loader_impl_read_blob(const char *path, std::string &blob)
+{
+	std::ifstream file(path, std::ios::binary);
+
+	if (!file)
+	{
+		return false;
+	}
+
+	blob.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+	return !blob.empty();
+}
+
+bool js_loader_impl_write_blob(const char *path, const char *data, size_t size)
+{
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+	if (!file)
+	{
+		return false;
+	}
+
+	file.write(data, size);
+
+	return file.good();
+}
+
+/* Compile a script consuming the cached code artifact when one exists
+for this buffer, producing and persisting it otherwise, so repeated
+loads of the same source skip parsing and compilation */
+Local<Script> js_loader_impl_compile_cached(loader_impl_js js_impl, Local<Context> &ctx_impl, Local<String> source_str, const char *buffer, size_t size)
+{
+	if (js_impl->code_cache_path.empty())
+	{
+		return Script::Compile(ctx_impl, source_str).ToLocalChecked();
+	}
+
+	char hash_str[32];
+
+	snprintf(hash_str, sizeof(hash_str), "%016llx", (unsigned long long)js_loader_impl_buffer_hash(buffer, size));
+
+	std::string cache_file = js_impl->code_cache_path + "/" + hash_str + ".v8c";
+
+	std::string cached;
+
+	if (js_loader_impl_read_blob(cache_file.c_str(), cached) == true)
+	{
+		/* The source takes ownership of the cached data wrapper, the
+		backing buffer stays alive in this scope */
+		ScriptCompiler::CachedData *cached_data = new ScriptCompiler::CachedData(
+			reinterpret_cast<const uint8_t *>(cached.data()), (int)cached.size(),
+			ScriptCompiler::CachedData::BufferNotOwned);
+
+		ScriptCompiler::Source source(source_str, cached_data);
+
+		MaybeLocal<Script> compiled = ScriptCompiler::Compile(ctx_impl, &source, ScriptCompiler::kConsumeCodeCache);
+
+		if (!compiled.IsEmpty() && cached_data->rejected == false)
+		{
+			return compiled.ToLocalChecked();
+		}
+
+		/* Rejected caches (version or flag mismatch) fall through and
+		get regenerated below */
+		log_write("metacall", LOG_LEVEL_DEBUG, "JS code cache %s rejected, regenerating", cache_file.c_str());
+	}
+
+	ScriptCompiler::Source source(source_str);
+
+	Local<Script> compiled = ScriptCompiler::Compile(ctx_impl, &source, ScriptCompiler::kProduceCodeCache).ToLocalChecked();
+
+	const ScriptCompiler::CachedData *produced = source.GetCachedData();
+
+	if (produced != NULL && produced->data != NULL)
+	{
+		if (js_loader_impl_write_blob(cache_file.c_str(), reinterpret_cast<const char *>(produced->data), (size_t)produced->length) == false)
+		{
+			log_write("metacall", LOG_LEVEL_WARNING, "JS code cache %s could not be persisted", cache_file.c_str());
+		}
+	}
+
+	return compiled;
+}
+
+/* Boot the isolate from a custom startup snapshot when configured,
+preferring the blob cached on disk and baking it from the configured
+script only when the cache is missing */
+void js_loader_impl_initialize_snapshot(loader_impl_js js_impl, configuration config)
+{
+	const char *blob_path = NULL;
+
+	js_impl->snapshot_blob.data = NULL;
+	js_impl->snapshot_blob.raw_size = 0;
+
+	if (config == NULL)
+	{
+		return;
+	}
+
+	value blob_path_value = configuration_value(config, "snapshot_blob_path");
+
+	if (blob_path_value != NULL && value_type_id(blob_path_value) == TYPE_STRING)
+	{
+		std::string blob;
+
+		blob_path = value_to_string(blob_path_value);
+
+		if (js_loader_impl_read_blob(blob_path, blob) == true)
+		{
+			char *data = new (std::nothrow) char[blob.size()];
+
+			if (data != NULL)
+			{
+				memcpy(data, blob.data(), blob.size());
+
+				js_impl->snapshot_blob.data = data;
+				js_impl->snapshot_blob.raw_size = (int)blob.size();
+
+				log_write("metacall", LOG_LEVEL_DEBUG, "JS startup snapshot loaded from %s", blob_path);
+
+				return;
+			}
+		}
+	}
+
+	value source_value = configuration_value(config, "snapshot_source");
+
+	if (source_value != NULL && value_type_id(source_value) == TYPE_STRING)
+	{
+		std::string source;
+
+		js_loader_impl_read_file(value_to_string(source_value), source);
+
+		if (source.empty())
+		{
+			log_write("metacall", LOG_LEVEL_WARNING, "JS snapshot source %s could not be read", value_to_string(source_value));
+
+			return;
+		}
+
+		StartupData blob = V8::CreateSnapshotDataBlob(source.c_str());
+
+		if (blob.data == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_WARNING, "JS snapshot creation failed for source %s", value_to_string(source_value));
+
+			return;
+		}
+
+		js_impl->snapshot_blob = blob;
+
+		if (blob_path != NULL)
+		{
+			if (js_loader_impl_write_blob(blob_path, blob.data, (size_t)blob.raw_size) == false)
+			{
+				log_write("metacall", LOG_LEVEL_WARNING, "JS startup snapshot could not be cached at %s", blob_path);
+			}
+		}
+	}
+}
+
 void js_loader_impl_read_file(const loader_naming_path path, std::string &source)
 {
 	std::ifstream file(path);
@@ -729,6 +919,25 @@ loader_impl_data js_loader_impl_initialize(loader_impl impl, configuration confi
 				{
 					js_impl->isolate_create_params.array_buffer_allocator = &js_impl->allocator;
 
+					/* Boot from the custom snapshot when one is configured so
+					the isolate starts with the baked scripts already compiled */
+					js_loader_impl_initialize_snapshot(js_impl, config);
+
+					if (js_impl->snapshot_blob.data != NULL)
+					{
+						js_impl->isolate_create_params.snapshot_blob = &js_impl->snapshot_blob;
+					}
+
+					if (config != NULL)
+					{
+						value code_cache = configuration_value(config, "code_cache_path");
+
+						if (code_cache != NULL && value_type_id(code_cache) == TYPE_STRING)
+						{
+							js_impl->code_cache_path = value_to_string(code_cache);
+						}
+					}
+
 					js_impl->isolate = Isolate::New(js_impl->isolate_create_params);
 
 					js_impl->isolate_scope = new Isolate::Scope(js_impl->isolate);
@@ -869,6 +1078,15 @@ int js_loader_impl_destroy(loader_impl impl)
 
 		V8::ShutdownPlatform();
 
+		/* The snapshot blob must outlive the isolate booted from it */
+		if (js_impl->snapshot_blob.data != nullptr)
+		{
+			delete[] const_cast<char *>(js_impl->snapshot_blob.data);
+
+			js_impl->snapshot_blob.data = nullptr;
+			js_impl->snapshot_blob.raw_size = 0;
+		}
+
 		if (js_impl->platform != nullptr)
 		{
 			delete js_impl->platform;
@@ -106,7 +106,8 @@ function_interface function_jsm_singleton()
 		&function_jsm_interface_create,
 		&function_jsm_interface_invoke,
 		&function_jsm_interface_await,
-		&function_jsm_interface_destroy
+		&function_jsm_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &jsm_interface;
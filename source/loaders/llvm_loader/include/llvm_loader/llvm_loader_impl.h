@@ -47,6 +47,10 @@ LLVM_LOADER_API int llvm_loader_impl_discover(loader_impl impl, loader_handle ha
 
 LLVM_LOADER_API int llvm_loader_impl_destroy(loader_impl impl);
 
+LLVM_LOADER_API int llvm_loader_impl_parallel(loader_impl impl, function func);
+
+LLVM_LOADER_API void *llvm_loader_impl_address(loader_impl impl, function func);
+
 #ifdef __cplusplus
 }
 #endif
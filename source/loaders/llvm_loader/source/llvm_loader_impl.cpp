@@ -28,9 +28,21 @@
 #include <reflect/reflect_function.h>
 #include <reflect/reflect_scope.h>
 #include <reflect/reflect_type.h>
+#include <reflect/reflect_value_type.h>
+
+#include <configuration/configuration.h>
 
 #include <log/log.h>
 
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <ffi.h>
+
 /* Disable warnings from LLVM */
 #if defined(_MSC_VER) || defined(__clang__)
 	#pragma warning(push)
@@ -42,21 +54,22 @@
 #endif
 
 // LLVM
-#include <llvm/ExecutionEngine/ExecutionEngine.h>
-#include <llvm/ExecutionEngine/GenericValue.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
 #include <llvm/ExecutionEngine/Orc/CompileUtils.h>
-#include <llvm/ExecutionEngine/SectionMemoryManager.h>
-#include <llvm/IR/IRBuilder.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
-#include <llvm/IR/Verifier.h>
 #include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
 #include <llvm/Support/SourceMgr.h>
 #include <llvm/Support/TargetSelect.h>
-
-// Optimizations
-#include <llvm/Analysis/BasicAliasAnalysis.h>
-#include <llvm/Transforms/Scalar.h>
+#include <llvm/Support/raw_ostream.h>
 
 /* Disable warnings from LLVM */
 #if defined(_MSC_VER) || defined(__clang__)
@@ -65,33 +78,255 @@
 	#pragma GCC diagnostic pop
 #endif
 
+/* Objects compiled by the JIT are persisted here keyed by a hash of the
+IR that produced them, so a restart with the same modules skips
+compilation entirely and relocates the cached objects instead */
+class llvm_loader_impl_object_cache : public llvm::ObjectCache
+{
+public:
+	llvm_loader_impl_object_cache() {}
+
+	void set_path(std::string cache_path)
+	{
+		path = std::move(cache_path);
+	}
+
+	void notifyObjectCompiled(const llvm::Module *m, llvm::MemoryBufferRef obj) override
+	{
+		if (path.empty())
+		{
+			return;
+		}
+
+		std::error_code ec = llvm::sys::fs::create_directories(path);
+
+		if (ec)
+		{
+			log_write("metacall", LOG_LEVEL_WARNING, "LLVM loader could not create the object cache directory %s (%s)", path.c_str(), ec.message().c_str());
+			return;
+		}
+
+		llvm::SmallString<256> file(path);
+
+		llvm::sys::path::append(file, key(m) + ".o");
+
+		llvm::raw_fd_ostream stream(file, ec, llvm::sys::fs::OF_None);
+
+		if (ec)
+		{
+			log_write("metacall", LOG_LEVEL_WARNING, "LLVM loader could not persist the cached object %s (%s)", file.c_str(), ec.message().c_str());
+			return;
+		}
+
+		stream.write(obj.getBufferStart(), obj.getBufferSize());
+	}
+
+	std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module *m) override
+	{
+		if (path.empty())
+		{
+			return nullptr;
+		}
+
+		llvm::SmallString<256> file(path);
+
+		llvm::sys::path::append(file, key(m) + ".o");
+
+		auto buffer = llvm::MemoryBuffer::getFile(file);
+
+		if (!buffer)
+		{
+			return nullptr;
+		}
+
+		return std::move(*buffer);
+	}
+
+private:
+	/* The module identifier is the content hash assigned at load time,
+	lazily extracted submodules derive their identifier from it so the
+	key stays deterministic across restarts, sanitized for the filesystem */
+	static std::string key(const llvm::Module *m)
+	{
+		std::string id = m->getModuleIdentifier();
+
+		for (char &c : id)
+		{
+			if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '.' || c == '-'))
+			{
+				c = '_';
+			}
+		}
+
+		return id;
+	}
+
+	std::string path;
+};
+
+/* Native representation of a single argument, the invoke scratch
+arrays point libffi at these slots */
+union loader_impl_llvm_arg_storage
+{
+	boolean b;
+	char c;
+	short s;
+	int i;
+	long l;
+	float f;
+	double d;
+	void *p;
+};
+
 typedef struct loader_impl_llvm_function_type
 {
-	// TODO: The reference to LLVM function must be stored here
-	void *todo;
+	void (*address)(void);						   /* Pinned JIT address, a lazy stub until first call */
+	ffi_cif cif;								   /* Call interface, prepared once at discovery */
+	ffi_type **arg_types;						   /* FFI argument types backing the cif */
+	void **arg_values;							   /* Per-call argument pointer scratch */
+	union loader_impl_llvm_arg_storage *arg_storage; /* Per-call native argument scratch */
+	int prepared;								   /* Nonzero once the cif has been prepared */
 
 } * loader_impl_llvm_function;
 
+/* Signature of a discovered function, recorded before the module is
+moved into the JIT because it cannot be introspected afterwards */
+struct loader_impl_llvm_function_decl_type
+{
+	std::string name;
+	type_id ret;
+	std::vector<type_id> args;
+};
+
 typedef struct loader_impl_llvm_handle_type
 {
-	// TODO: The references to LLVM modules must be stored here
-	// This should contain a vector with all LLVM modules loaded (input.ll)
-	void *todo;
+	llvm::orc::JITDylib *dylib; /* Owned by the execution session, resident until destroy */
+	std::vector<loader_impl_llvm_function_decl_type> functions;
 
 } * loader_impl_llvm_handle;
 
 typedef struct loader_impl_llvm_type
 {
-	// TODO: The reference to LLVM interpreter must be stored here (Is this correct?)
-	llvm::LLVMContext context;
-	llvm::SMDiagnostic error;
+	llvm::orc::ThreadSafeContext context;
+	std::unique_ptr<llvm_loader_impl_object_cache> cache; /* Must outlive the JIT, declared first */
+	std::unique_ptr<llvm::orc::LLLazyJIT> jit;
+	int lazy;			/* Nonzero when functions materialize on first call */
+	size_t dylib_count; /* Monotonic counter naming per handle dylibs */
 
 } * loader_impl_llvm;
 
-int type_llvm_interface_create(type t, type_impl impl)
+/* Map a reflect type id to the libffi type used to pass it natively,
+null for types the LLVM loader does not dispatch directly */
+static ffi_type *llvm_loader_impl_ffi_type(type_id id)
 {
-	/* TODO */
+	switch (id)
+	{
+		case TYPE_BOOL:
+			return &ffi_type_uchar;
+		case TYPE_CHAR:
+			return &ffi_type_schar;
+		case TYPE_SHORT:
+			return &ffi_type_sshort;
+		case TYPE_INT:
+			return &ffi_type_sint;
+		case TYPE_LONG:
+			return &ffi_type_slong;
+		case TYPE_FLOAT:
+			return &ffi_type_float;
+		case TYPE_DOUBLE:
+			return &ffi_type_double;
+		case TYPE_STRING:
+		case TYPE_PTR:
+			return &ffi_type_pointer;
+		case TYPE_NULL:
+			return &ffi_type_void;
+		default:
+			return NULL;
+	}
+}
+
+/* Map an LLVM IR type to the reflect type id it is exposed as,
+TYPE_INVALID for types the loader does not dispatch */
+static type_id llvm_loader_impl_type_id(llvm::Type *t)
+{
+	if (t->isVoidTy())
+	{
+		return TYPE_NULL;
+	}
+
+	if (t->isIntegerTy(1))
+	{
+		return TYPE_BOOL;
+	}
+
+	if (t->isIntegerTy(8))
+	{
+		return TYPE_CHAR;
+	}
+
+	if (t->isIntegerTy(16))
+	{
+		return TYPE_SHORT;
+	}
+
+	if (t->isIntegerTy(32))
+	{
+		return TYPE_INT;
+	}
+
+	if (t->isIntegerTy(64))
+	{
+		return TYPE_LONG;
+	}
+
+	if (t->isFloatTy())
+	{
+		return TYPE_FLOAT;
+	}
+
+	if (t->isDoubleTy())
+	{
+		return TYPE_DOUBLE;
+	}
+
+	if (t->isPointerTy())
+	{
+		return t->getPointerElementType()->isIntegerTy(8) ? TYPE_STRING : TYPE_PTR;
+	}
+
+	return TYPE_INVALID;
+}
+
+/* Name under which a reflect type id was registered in the type table */
+static const char *llvm_loader_impl_type_id_name(type_id id)
+{
+	switch (id)
+	{
+		case TYPE_BOOL:
+			return "i1";
+		case TYPE_CHAR:
+			return "i8";
+		case TYPE_SHORT:
+			return "i16";
+		case TYPE_INT:
+			return "i32";
+		case TYPE_LONG:
+			return "i64";
+		case TYPE_FLOAT:
+			return "float";
+		case TYPE_DOUBLE:
+			return "double";
+		case TYPE_STRING:
+			return "i8*";
+		case TYPE_PTR:
+			return "Ptr";
+		default:
+			return NULL;
+	}
+}
 
+int type_llvm_interface_create(type t, type_impl impl)
+{
 	(void)t;
 	(void)impl;
 
@@ -100,8 +335,6 @@ int type_llvm_interface_create(type t, type_impl impl)
 
 void type_llvm_interface_destroy(type t, type_impl impl)
 {
-	/* TODO */
-
 	(void)t;
 	(void)impl;
 }
@@ -118,24 +351,171 @@ type_interface type_llvm_singleton(void)
 
 int function_llvm_interface_create(function func, function_impl impl)
 {
-	/* TODO */
+	loader_impl_llvm_function llvm_function = static_cast<loader_impl_llvm_function>(impl);
 
 	(void)func;
-	(void)impl;
+
+	if (llvm_function == NULL)
+	{
+		return 1;
+	}
+
+	/* The cif is prepared at discovery once the signature types are
+	defined, creation only leaves the function in a rejectable state */
+	llvm_function->prepared = 0;
+	llvm_function->arg_types = NULL;
+	llvm_function->arg_values = NULL;
+	llvm_function->arg_storage = NULL;
+
+	return 0;
+}
+
+/* Prepare the call interface once against the discovered signature so
+the invoke path is a direct jump through the pinned address */
+static int llvm_loader_impl_function_prepare(function func, loader_impl_llvm_function llvm_function)
+{
+	signature s = function_signature(func);
+
+	const size_t args_size = signature_count(s);
+
+	type ret_type = signature_get_return(s);
+
+	ffi_type *ret_ffi_type = llvm_loader_impl_ffi_type(ret_type == NULL ? TYPE_NULL : type_index(ret_type));
+
+	size_t args_count;
+
+	if (ret_ffi_type == NULL)
+	{
+		return 1;
+	}
+
+	llvm_function->arg_types = new (std::nothrow) ffi_type *[args_size];
+	llvm_function->arg_values = new (std::nothrow) void *[args_size];
+	llvm_function->arg_storage = new (std::nothrow) union loader_impl_llvm_arg_storage[args_size];
+
+	if (llvm_function->arg_types == NULL || llvm_function->arg_values == NULL || llvm_function->arg_storage == NULL)
+	{
+		return 1;
+	}
+
+	for (args_count = 0; args_count < args_size; ++args_count)
+	{
+		type t = signature_get_type(s, args_count);
+
+		ffi_type *arg_ffi_type = llvm_loader_impl_ffi_type(t == NULL ? TYPE_INVALID : type_index(t));
+
+		if (arg_ffi_type == NULL || arg_ffi_type == &ffi_type_void)
+		{
+			return 1;
+		}
+
+		llvm_function->arg_types[args_count] = arg_ffi_type;
+		llvm_function->arg_values[args_count] = &llvm_function->arg_storage[args_count];
+	}
+
+	if (ffi_prep_cif(&llvm_function->cif, FFI_DEFAULT_ABI, (unsigned int)args_size, ret_ffi_type, llvm_function->arg_types) != FFI_OK)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid FFI call interface preparation in LLVM loader function %s", function_name(func));
+
+		return 1;
+	}
+
+	llvm_function->prepared = 1;
 
 	return 0;
 }
 
 function_return function_llvm_interface_invoke(function func, function_impl impl, function_args args, size_t size)
 {
-	/* TODO */
+	loader_impl_llvm_function llvm_function = static_cast<loader_impl_llvm_function>(impl);
 
-	(void)func;
-	(void)impl;
-	(void)args;
-	(void)size;
+	signature s = function_signature(func);
 
-	return NULL;
+	union loader_impl_llvm_arg_storage ret_storage;
+
+	type ret_type;
+
+	size_t args_count;
+
+	if (llvm_function == NULL || llvm_function->prepared == 0 || llvm_function->address == NULL || size != (size_t)llvm_function->cif.nargs)
+	{
+		return NULL;
+	}
+
+	/* Unbox the arguments into the pre-bound native slots the cif
+	already points at, no per-call interface derivation happens here */
+	for (args_count = 0; args_count < size; ++args_count)
+	{
+		type t = signature_get_type(s, args_count);
+
+		union loader_impl_llvm_arg_storage *slot = &llvm_function->arg_storage[args_count];
+
+		switch (type_index(t))
+		{
+			case TYPE_BOOL:
+				slot->b = value_to_bool(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_CHAR:
+				slot->c = value_to_char(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_SHORT:
+				slot->s = value_to_short(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_INT:
+				slot->i = value_to_int(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_LONG:
+				slot->l = value_to_long(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_FLOAT:
+				slot->f = value_to_float(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_DOUBLE:
+				slot->d = value_to_double(static_cast<value>(args[args_count]));
+				break;
+			case TYPE_STRING:
+				slot->p = static_cast<void *>(value_to_string(static_cast<value>(args[args_count])));
+				break;
+			case TYPE_PTR:
+				slot->p = value_to_ptr(static_cast<value>(args[args_count]));
+				break;
+			default:
+				return NULL;
+		}
+	}
+
+	/* The first call through a lazily materialized function lands on
+	the compile-on-demand stub, subsequent calls jump straight into the
+	compiled body through the same pinned address */
+	ffi_call(&llvm_function->cif, llvm_function->address, &ret_storage, llvm_function->arg_values);
+
+	ret_type = signature_get_return(s);
+
+	switch (ret_type == NULL ? TYPE_NULL : type_index(ret_type))
+	{
+		case TYPE_BOOL:
+			return value_create_bool(ret_storage.b);
+		case TYPE_CHAR:
+			return value_create_char(ret_storage.c);
+		case TYPE_SHORT:
+			return value_create_short(ret_storage.s);
+		case TYPE_INT:
+			return value_create_int(ret_storage.i);
+		case TYPE_LONG:
+			return value_create_long(ret_storage.l);
+		case TYPE_FLOAT:
+			return value_create_float(ret_storage.f);
+		case TYPE_DOUBLE:
+			return value_create_double(ret_storage.d);
+		case TYPE_STRING:
+			return ret_storage.p == NULL ? NULL : value_create_string(static_cast<const char *>(ret_storage.p), strlen(static_cast<const char *>(ret_storage.p)));
+		case TYPE_PTR:
+			return value_create_ptr(ret_storage.p);
+		case TYPE_NULL:
+			return value_create_null();
+		default:
+			return NULL;
+	}
 }
 
 function_return function_llvm_interface_await(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
@@ -155,10 +535,18 @@ function_return function_llvm_interface_await(function func, function_impl impl,
 
 void function_llvm_interface_destroy(function func, function_impl impl)
 {
-	/* TODO */
+	loader_impl_llvm_function llvm_function = static_cast<loader_impl_llvm_function>(impl);
 
 	(void)func;
-	(void)impl;
+
+	if (llvm_function != NULL)
+	{
+		delete[] llvm_function->arg_types;
+		delete[] llvm_function->arg_values;
+		delete[] llvm_function->arg_storage;
+
+		delete llvm_function;
+	}
 }
 
 function_interface function_llvm_singleton(void)
@@ -167,7 +555,8 @@ function_interface function_llvm_singleton(void)
 		&function_llvm_interface_create,
 		&function_llvm_interface_invoke,
 		&function_llvm_interface_await,
-		&function_llvm_interface_destroy
+		&function_llvm_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &llvm_function_interface;
@@ -188,27 +577,20 @@ int llvm_loader_impl_register_types(loader_impl impl)
 		{ TYPE_FLOAT, "float" },
 		{ TYPE_DOUBLE, "double" },
 		{ TYPE_STRING, "i8*" },
-
-		// TODO: Implement the rest of the types (Buffer and pointer remaining)
-		{ TYPE_BUFFER, "Buffer" }, // TODO
-		{ TYPE_PTR, "Ptr" }		   // TODO
-
+		{ TYPE_PTR, "Ptr" } /* Any non i8 pointer is exposed opaquely */
 	};
 
 	for (auto &pair : type_id_name_pair)
 	{
-		// TODO: Do we need to pass the builtin?
 		type builtin_type = type_create(pair.id, pair.name, /* builtin */ NULL, &type_llvm_singleton);
 
 		if (builtin_type == NULL)
 		{
-			// TODO: Emit exception when exception handling is implemented
 			return 1;
 		}
 
 		if (loader_impl_type_define(impl, type_name(builtin_type), builtin_type) != 0)
 		{
-			// TODO: Emit exception when exception handling is implemented
 			return 1;
 		}
 	}
@@ -218,30 +600,70 @@ int llvm_loader_impl_register_types(loader_impl impl)
 
 loader_impl_data llvm_loader_impl_initialize(loader_impl impl, configuration config)
 {
-	loader_impl_llvm llvm_impl = new loader_impl_llvm_type();
+	loader_impl_llvm llvm_impl = new (std::nothrow) loader_impl_llvm_type();
 
 	if (llvm_impl == nullptr)
 	{
-		// TODO: Emit exception when exception handling is implemented
 		return NULL;
 	}
 
-	/* TODO */
-	// Initialize here all the fields of llvm_impl if any is required,
-	// it is possible to initialize it in the constructor of the struct loader_impl_llvm_type,
-	// or class if you refactor it
+	llvm::InitializeNativeTarget();
+	llvm::InitializeNativeTargetAsmPrinter();
+	llvm::InitializeNativeTargetAsmParser();
+
+	llvm_impl->context = llvm::orc::ThreadSafeContext(std::make_unique<llvm::LLVMContext>());
+	llvm_impl->cache = std::make_unique<llvm_loader_impl_object_cache>();
+	llvm_impl->lazy = 1;
+	llvm_impl->dylib_count = 0;
+
+	/* The object cache is disabled unless a directory is configured,
+	the cached objects are only valid for the host triple they were
+	compiled for so the path should not be shared across machines */
+	if (config != NULL)
+	{
+		value cache_path = configuration_value(config, "object_cache_path");
+
+		if (cache_path != NULL && value_type_id(cache_path) == TYPE_STRING)
+		{
+			llvm_impl->cache->set_path(value_to_string(cache_path));
+		}
+
+		value lazy = configuration_value(config, "lazy");
+
+		if (lazy != NULL && value_type_id(lazy) == TYPE_BOOL)
+		{
+			llvm_impl->lazy = value_to_bool(lazy) == 1L ? 1 : 0;
+		}
+	}
+
+	llvm_loader_impl_object_cache *cache = llvm_impl->cache.get();
+
+	llvm::orc::LLLazyJITBuilder builder;
+
+	builder.setCompileFunctionCreator([cache](llvm::orc::JITTargetMachineBuilder jtmb)
+			-> llvm::Expected<std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>> {
+		return std::make_unique<llvm::orc::ConcurrentIRCompiler>(std::move(jtmb), cache);
+	});
+
+	auto jit = builder.create();
+
+	if (!jit)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "LLVM loader could not create the JIT (%s)", llvm::toString(jit.takeError()).c_str());
+
+		delete llvm_impl;
+		return NULL;
+	}
+
+	llvm_impl->jit = std::move(*jit);
 
 	/* Register the types */
 	if (llvm_loader_impl_register_types(impl) != 0)
 	{
-		// TODO: Emit exception when exception handling is implemented
 		delete llvm_impl;
 		return NULL;
 	}
 
-	// TODO: Handle something with the configuration?
-	(void)config;
-
 	/* Register initialization */
 	loader_initialization_register(impl);
 
@@ -250,19 +672,128 @@ loader_impl_data llvm_loader_impl_initialize(loader_impl impl, configuration con
 
 int llvm_loader_impl_execution_path(loader_impl impl, const loader_naming_path path)
 {
-	loader_impl_llvm llvm_impl = static_cast<loader_impl_llvm>(loader_impl_get(impl));
-	loader_impl_llvm_handle llvm_handle = new loader_impl_llvm_handle_type();
+	/* Modules are referenced by explicit path, nothing to index here */
+	(void)impl;
+	(void)path;
+
+	return 0;
+}
+
+/* Create the per handle dylib the modules of one load are added to,
+with the process symbols visible so the IR can call into libc */
+static loader_impl_llvm_handle llvm_loader_impl_handle_create(loader_impl_llvm llvm_impl)
+{
+	loader_impl_llvm_handle llvm_handle = new (std::nothrow) loader_impl_llvm_handle_type();
 
 	if (llvm_handle == nullptr)
 	{
-		// TODO: Emit exception when exception handling is implemented
+		return NULL;
+	}
+
+	std::string name = "llvm_loader_handle_" + std::to_string(llvm_impl->dylib_count++);
+
+	auto dylib = llvm_impl->jit->createJITDylib(std::move(name));
+
+	if (!dylib)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "LLVM loader could not create the handle dylib (%s)", llvm::toString(dylib.takeError()).c_str());
+
+		delete llvm_handle;
+		return NULL;
+	}
+
+	llvm_handle->dylib = &*dylib;
+
+	auto generator = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(llvm_impl->jit->getDataLayout().getGlobalPrefix());
+
+	if (generator)
+	{
+		llvm_handle->dylib->addGenerator(std::move(*generator));
+	}
+	else
+	{
+		log_write("metacall", LOG_LEVEL_WARNING, "LLVM loader could not expose the process symbols (%s)", llvm::toString(generator.takeError()).c_str());
+	}
+
+	return llvm_handle;
+}
+
+/* Parse one IR buffer (textual or bitcode), record the signatures of
+its dispatchable functions and hand the module to the JIT, lazily when
+configured so bodies compile on first call instead of at load */
+static int llvm_loader_impl_load_module(loader_impl_llvm llvm_impl, loader_impl_llvm_handle llvm_handle, std::unique_ptr<llvm::MemoryBuffer> buffer)
+{
+	llvm::MD5 hash;
+	llvm::MD5::MD5Result hash_result;
+	llvm::SmallString<32> digest;
+	llvm::SMDiagnostic error;
+
+	hash.update(buffer->getBuffer());
+	hash.final(hash_result);
+	llvm::MD5::stringifyResult(hash_result, digest);
+
+	std::unique_ptr<llvm::Module> module = llvm::parseIR(buffer->getMemBufferRef(), error, *llvm_impl->context.getContext());
+
+	if (module == nullptr)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "LLVM loader failed to parse module %s (%s)", buffer->getBufferIdentifier().str().c_str(), error.getMessage().str().c_str());
+
 		return 1;
 	}
 
-	/* TODO */
+	/* The content hash becomes the module identifier so the object
+	cache key survives restarts regardless of where the IR came from */
+	module->setModuleIdentifier(digest.str().str());
 
-	(void)llvm_impl;
-	(void)path;
+	for (llvm::Function &f : *module)
+	{
+		if (f.isDeclaration() || !f.hasExternalLinkage() || f.isVarArg())
+		{
+			continue;
+		}
+
+		loader_impl_llvm_function_decl_type decl;
+
+		decl.name = f.getName().str();
+		decl.ret = llvm_loader_impl_type_id(f.getReturnType());
+
+		bool supported = decl.ret != TYPE_INVALID;
+
+		for (llvm::Argument &arg : f.args())
+		{
+			type_id id = llvm_loader_impl_type_id(arg.getType());
+
+			if (id == TYPE_INVALID || id == TYPE_NULL)
+			{
+				supported = false;
+				break;
+			}
+
+			decl.args.push_back(id);
+		}
+
+		if (!supported)
+		{
+			log_write("metacall", LOG_LEVEL_DEBUG, "LLVM loader skipping function %s with unsupported signature", decl.name.c_str());
+
+			continue;
+		}
+
+		llvm_handle->functions.push_back(std::move(decl));
+	}
+
+	llvm::orc::ThreadSafeModule ts_module(std::move(module), llvm_impl->context);
+
+	llvm::Error err = llvm_impl->lazy != 0 ?
+						  llvm_impl->jit->addLazyIRModule(*llvm_handle->dylib, std::move(ts_module)) :
+						  llvm_impl->jit->addIRModule(*llvm_handle->dylib, std::move(ts_module));
+
+	if (err)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "LLVM loader failed to add the module to the JIT (%s)", llvm::toString(std::move(err)).c_str());
+
+		return 1;
+	}
 
 	return 0;
 }
@@ -270,79 +801,103 @@ int llvm_loader_impl_execution_path(loader_impl impl, const loader_naming_path p
 loader_handle llvm_loader_impl_load_from_file(loader_impl impl, const loader_naming_path paths[], size_t size)
 {
 	loader_impl_llvm llvm_impl = static_cast<loader_impl_llvm>(loader_impl_get(impl));
-	loader_impl_llvm_handle llvm_handle = new loader_impl_llvm_handle_type();
+	loader_impl_llvm_handle llvm_handle = llvm_loader_impl_handle_create(llvm_impl);
 
-	if (llvm_handle == nullptr)
+	size_t iterator;
+
+	if (llvm_handle == NULL)
 	{
-		// TODO: Emit exception when exception handling is implemented
 		return NULL;
 	}
 
-	/* TODO */
-	// Load here the list of paths using modules to store them into loader_impl_llvm_handle_type
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		auto buffer = llvm::MemoryBuffer::getFile(paths[iterator]);
 
-	(void)llvm_impl;
-	(void)paths;
-	(void)size;
+		if (!buffer)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "LLVM loader could not read module %s (%s)", paths[iterator], buffer.getError().message().c_str());
+
+			delete llvm_handle;
+			return NULL;
+		}
+
+		if (llvm_loader_impl_load_module(llvm_impl, llvm_handle, std::move(*buffer)) != 0)
+		{
+			delete llvm_handle;
+			return NULL;
+		}
+	}
 
-	// TODO: Return here the pointer to loader_impl_llvm_handle_type
 	return static_cast<loader_handle>(llvm_handle);
 }
 
 loader_handle llvm_loader_impl_load_from_memory(loader_impl impl, const loader_naming_name name, const char *buffer, size_t size)
 {
 	loader_impl_llvm llvm_impl = static_cast<loader_impl_llvm>(loader_impl_get(impl));
-	loader_impl_llvm_handle llvm_handle = new loader_impl_llvm_handle_type();
+	loader_impl_llvm_handle llvm_handle = llvm_loader_impl_handle_create(llvm_impl);
 
-	if (llvm_handle == nullptr)
+	if (llvm_handle == NULL)
 	{
-		// TODO: Emit exception when exception handling is implemented
 		return NULL;
 	}
 
-	/* TODO */
-	// The same as previous module but you have to load from the string buffer instead of from file
+	/* The loader appends a null terminator to the buffer, exclude it */
+	auto memory = llvm::MemoryBuffer::getMemBufferCopy(llvm::StringRef(buffer, size > 0 ? size - 1 : 0), name);
 
-	(void)llvm_impl;
-	(void)name;
-	(void)buffer;
-	(void)size;
+	if (llvm_loader_impl_load_module(llvm_impl, llvm_handle, std::move(memory)) != 0)
+	{
+		delete llvm_handle;
+		return NULL;
+	}
 
-	// TODO: Return here the pointer to loader_impl_llvm_handle_type
 	return static_cast<loader_handle>(llvm_handle);
 }
 
 loader_handle llvm_loader_impl_load_from_package(loader_impl impl, const loader_naming_path path)
 {
 	loader_impl_llvm llvm_impl = static_cast<loader_impl_llvm>(loader_impl_get(impl));
-	loader_impl_llvm_handle llvm_handle = new loader_impl_llvm_handle_type();
+	loader_impl_llvm_handle llvm_handle = llvm_loader_impl_handle_create(llvm_impl);
 
-	if (llvm_handle == nullptr)
+	if (llvm_handle == NULL)
 	{
-		// TODO: Emit exception when exception handling is implemented
 		return NULL;
 	}
 
-	/* TODO */
-	// The same as load_from_file but this should load from binary format instead of readable format (input.ll)
+	/* parseIR detects the bitcode magic, so binary modules share the
+	textual load path */
+	auto buffer = llvm::MemoryBuffer::getFile(path);
 
-	(void)llvm_impl;
-	(void)path;
+	if (!buffer)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "LLVM loader could not read package %s (%s)", path, buffer.getError().message().c_str());
+
+		delete llvm_handle;
+		return NULL;
+	}
+
+	if (llvm_loader_impl_load_module(llvm_impl, llvm_handle, std::move(*buffer)) != 0)
+	{
+		delete llvm_handle;
+		return NULL;
+	}
 
-	// TODO: Return here the pointer to loader_impl_llvm_handle_type
 	return static_cast<loader_handle>(llvm_handle);
 }
 
 int llvm_loader_impl_clear(loader_impl impl, loader_handle handle)
 {
-	loader_impl_llvm llvm_impl = static_cast<loader_impl_llvm>(loader_impl_get(impl));
 	loader_impl_llvm_handle llvm_handle = static_cast<loader_impl_llvm_handle>(handle);
 
-	/* TODO */
-	// Clear the array of modules from the llvm_handle and free all the memory related to it
-	(void)llvm_impl;
+	(void)impl;
+
+	if (llvm_handle == NULL)
+	{
+		return 1;
+	}
 
-	// Then delete the LLVM handle itself
+	/* The dylib and any materialized code stay resident in the
+	execution session until the loader is destroyed */
 	delete llvm_handle;
 
 	return 0;
@@ -353,13 +908,63 @@ int llvm_loader_impl_discover(loader_impl impl, loader_handle handle, context ct
 	loader_impl_llvm llvm_impl = static_cast<loader_impl_llvm>(loader_impl_get(impl));
 	loader_impl_llvm_handle llvm_handle = static_cast<loader_impl_llvm_handle>(handle);
 
-	/* TODO */
-	// Iterate all the modules loaded by this llvm_handle,
-	// introspect the functions and structs and store them in ctx
+	scope sp = context_scope(ctx);
+
+	if (llvm_handle == NULL)
+	{
+		return 1;
+	}
 
-	(void)llvm_impl;
-	(void)llvm_handle;
-	(void)ctx;
+	for (const loader_impl_llvm_function_decl_type &decl : llvm_handle->functions)
+	{
+		/* With lazy materialization the lookup resolves to the
+		compile-on-demand stub without compiling the body, the address
+		is pinned here so the call path never goes through the JIT
+		symbol tables again */
+		auto address = llvm_impl->jit->lookup(*llvm_handle->dylib, decl.name);
+
+		if (!address)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "LLVM loader could not resolve function %s (%s)", decl.name.c_str(), llvm::toString(address.takeError()).c_str());
+
+			continue;
+		}
+
+		loader_impl_llvm_function llvm_function = new (std::nothrow) loader_impl_llvm_function_type();
+
+		if (llvm_function == nullptr)
+		{
+			return 1;
+		}
+
+		llvm_function->address = reinterpret_cast<void (*)(void)>(static_cast<uintptr_t>(address->getAddress()));
+
+		function f = function_create(decl.name.c_str(), decl.args.size(), llvm_function, &function_llvm_singleton);
+
+		if (f == NULL)
+		{
+			delete llvm_function;
+			return 1;
+		}
+
+		signature s = function_signature(f);
+
+		signature_set_return(s, decl.ret == TYPE_NULL ? NULL : loader_impl_type(impl, llvm_loader_impl_type_id_name(decl.ret)));
+
+		for (size_t index = 0; index < decl.args.size(); ++index)
+		{
+			std::string arg_name = "arg" + std::to_string(index);
+
+			signature_set(s, index, arg_name.c_str(), loader_impl_type(impl, llvm_loader_impl_type_id_name(decl.args[index])));
+		}
+
+		if (llvm_loader_impl_function_prepare(f, llvm_function) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "LLVM loader could not prepare the call interface of function %s", decl.name.c_str());
+		}
+
+		scope_define(sp, function_name(f), value_create_function(f));
+	}
 
 	return 0;
 }
@@ -368,16 +973,51 @@ int llvm_loader_impl_destroy(loader_impl impl)
 {
 	loader_impl_llvm llvm_impl = static_cast<loader_impl_llvm>(loader_impl_get(impl));
 
+	if (llvm_impl == NULL)
+	{
+		return 1;
+	}
+
 	/* Destroy children loaders */
 	loader_unload_children(impl);
 
-	/* TODO */
-	// Clear here the resources, it must free all memory related to llvm_impl.
-	// The destruction of the llvm_impl contents (the bytecode interpreter for example),
-	// must be done always after loader_unload_children
+	/* Tear down the JIT before the object cache it compiles through */
+	llvm_impl->jit.reset();
 
-	// Then delete the LLVM loader itself
 	delete llvm_impl;
 
 	return 0;
 }
+
+int llvm_loader_impl_parallel(loader_impl impl, function func)
+{
+	/* JITed symbols are plain native code once materialized, calling
+	them needs no lock, only materialization itself is synchronized */
+	(void)impl;
+	(void)func;
+
+	return 1;
+}
+
+void *llvm_loader_impl_address(loader_impl impl, function func)
+{
+	(void)impl;
+
+	/* Functions from other loaders are recognized by the interface
+	singleton, the probe must answer null for them */
+	if (func == NULL || function_interface_get(func) != function_llvm_singleton())
+	{
+		return NULL;
+	}
+
+	loader_impl_llvm_function llvm_function = static_cast<loader_impl_llvm_function>(function_impl_get(func));
+
+	if (llvm_function == NULL)
+	{
+		return NULL;
+	}
+
+	/* The pinned JIT address follows the C ABI directly, the signature
+	discovered from the IR is the native one with no marshaling layer */
+	return reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(llvm_function->address));
+}
@@ -36,9 +36,25 @@
 	Note that the expected include convention is #include "lua.h"
 	and not #include <lua/lua.h>. This is because, the lua location is not
 	standardized and may exist in locations other than lua/
+
+	The loader is backend agnostic: LuaJIT exposes the same lua 5.1 C API,
+	so selecting it is a configure time switch (OPTION_BUILD_LOADERS_LUA_JIT)
 */
 #include "lua.h"
 
+#include "lauxlib.h"
+#include "lualib.h"
+
+#if LUA_VERSION_NUM >= 502
+	#define lua_loader_impl_globals(vm) lua_pushglobaltable(vm)
+#else
+	#define lua_loader_impl_globals(vm) lua_pushvalue((vm), LUA_GLOBALSINDEX)
+#endif
+
+/* Stack slots preallocated at initialization, calls up to this width
+never touch the stack allocator on the invoke path */
+#define LUA_LOADER_IMPL_STACK_SLOTS 0x20
+
 typedef struct loader_impl_lua_type
 {
 	lua_State *vm;
@@ -47,9 +63,9 @@ typedef struct loader_impl_lua_type
 
 typedef struct loader_impl_lua_handle_type
 {
-	/* TODO: This probably won't be needed as Lua does not use any
-		descriptor for the handles (aka scripts), all of them are loaded
-		into global scope and they do not have references
+	/* Lua does not use any descriptor for the handles (aka scripts),
+		all of them are loaded into global scope and they do not have
+		references
 	*/
 	void *handle_lua_data;
 
@@ -57,9 +73,9 @@ typedef struct loader_impl_lua_handle_type
 
 typedef struct loader_impl_lua_function_type
 {
-	/* TODO */
-	loader_impl_lua_handle lua_handle;
-	void *function_lua_data;
+	loader_impl_lua lua_impl;
+	int ref; /* Registry reference to the function, fetched per call
+				without a global table lookup */
 
 } * loader_impl_lua_function;
 
@@ -75,164 +91,157 @@ function_return function_lua_interface_invoke(function func, function_impl impl,
 {
 	loader_impl_lua_function lua_function = (loader_impl_lua_function)impl;
 
-	signature s = function_signature(func);
-
-	const char *name = function_name(func);
+	lua_State *vm = lua_function->lua_impl->vm;
 
-	type ret_type = signature_get_return(s);
+	function_return ret = NULL;
 
-	(void)lua_function;
+	int nargs = 0;
 
-	log_write("metacall", LOG_LEVEL_DEBUG, "Invoking lua function %s", name);
+	size_t args_count;
 
-	/* TODO: Convert properly the arguments */
-	if (size > 0)
+	/* The common widths are preallocated at initialization, only
+	oversized calls grow the stack here (buffers expand to two slots) */
+	if (size * 2 + 2 > LUA_LOADER_IMPL_STACK_SLOTS && lua_checkstack(vm, (int)(size * 2 + 2)) == 0)
 	{
-		size_t args_count;
-
-		for (args_count = 0; args_count < size; ++args_count)
-		{
-			/* This is only in case Lua adds types in the signature */
-			type t = signature_get_type(s, args_count);
-
-			type_id id = TYPE_INVALID;
-
-			if (t == NULL)
-			{
-				id = value_type_id((value)args[args_count]);
-			}
-			else
-			{
-				id = type_index(t);
-			}
-
-			log_write("metacall", LOG_LEVEL_DEBUG, "Type %p, %d", (void *)t, id);
-
-			if (id == TYPE_BOOL)
-			{
-				boolean *value_ptr = (boolean *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "Boolean value: %d", *value_ptr);
-			}
-			else if (id == TYPE_CHAR)
-			{
-				char *value_ptr = (char *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "Char value: %c", *value_ptr);
-			}
-			else if (id == TYPE_SHORT)
-			{
-				short *value_ptr = (short *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "Short value: %d", *value_ptr);
-			}
-			else if (id == TYPE_INT)
-			{
-				int *value_ptr = (int *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "Int value: %d", *value_ptr);
-			}
-			else if (id == TYPE_LONG)
-			{
-				long *value_ptr = (long *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "Long value: %ld", *value_ptr);
-			}
-			else if (id == TYPE_FLOAT)
-			{
-				float *value_ptr = (float *)(args[args_count]);
+		log_write("metacall", LOG_LEVEL_ERROR, "Lua stack overflow invoking function %s", function_name(func));
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Float value: %f", *value_ptr);
-			}
-			else if (id == TYPE_DOUBLE)
-			{
-				double *value_ptr = (double *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "Double value: %f", *value_ptr);
-			}
-			else if (id == TYPE_STRING)
-			{
-				const char *value_ptr = (const char *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "String value: %s", value_ptr);
-			}
-			else if (id == TYPE_PTR)
-			{
-				void *value_ptr = (void *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "Pointer value: %p", value_ptr);
-			}
-			else
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Unrecognized value: %p", args[args_count]);
-			}
-		}
-
-		log_write("metacall", LOG_LEVEL_DEBUG, "Calling lua function with arguments (%lu)", size);
-	}
-	else
-	{
-		log_write("metacall", LOG_LEVEL_DEBUG, "Calling lua function without arguments");
+		return NULL;
 	}
 
-	/* TODO: Execute the call */
+	/* Fetch the function through its cached registry reference */
+	lua_rawgeti(vm, LUA_REGISTRYINDEX, lua_function->ref);
 
-	/* TODO: Convert properly the return value */
-	if (ret_type != NULL)
+	for (args_count = 0; args_count < size; ++args_count)
 	{
-		type_id id = type_index(ret_type);
+		value v = (value)args[args_count];
 
-		log_write("metacall", LOG_LEVEL_DEBUG, "Return type %p, %d", (void *)ret_type, id);
+		type_id id = value_type_id(v);
 
 		if (id == TYPE_BOOL)
 		{
-			boolean b = 1;
-
-			return value_create_bool(b);
+			lua_pushboolean(vm, value_to_bool(v) == 1L);
 		}
 		else if (id == TYPE_CHAR)
 		{
-			return value_create_char('A');
+			char c = value_to_char(v);
+
+			lua_pushlstring(vm, &c, 1);
 		}
 		else if (id == TYPE_SHORT)
 		{
-			return value_create_short(124);
+			lua_pushinteger(vm, (lua_Integer)value_to_short(v));
 		}
 		else if (id == TYPE_INT)
 		{
-			return value_create_int(1234);
+			lua_pushinteger(vm, (lua_Integer)value_to_int(v));
 		}
 		else if (id == TYPE_LONG)
 		{
-			return value_create_long(90000L);
+			lua_pushinteger(vm, (lua_Integer)value_to_long(v));
 		}
 		else if (id == TYPE_FLOAT)
 		{
-			return value_create_float(0.2f);
+			lua_pushnumber(vm, (lua_Number)value_to_float(v));
 		}
 		else if (id == TYPE_DOUBLE)
 		{
-			return value_create_double(3.1416);
+			lua_pushnumber(vm, (lua_Number)value_to_double(v));
 		}
 		else if (id == TYPE_STRING)
 		{
-			static const char str[] = "Hello World";
+			lua_pushlstring(vm, value_to_string(v), value_type_size(v) - 1);
+		}
+		else if (id == TYPE_BUFFER)
+		{
+			/* Zero copy: the pointer and the length are pushed as a
+			pair of arguments; under LuaJIT the pointer is meant to be
+			cast with ffi.cast so filters read the payload in place */
+			lua_pushlightuserdata(vm, value_to_buffer(v));
+			lua_pushinteger(vm, (lua_Integer)value_type_size(v));
 
-			return value_create_string(str, sizeof(str) - 1);
+			++nargs;
 		}
 		else if (id == TYPE_PTR)
 		{
-			static int int_val = 15;
-
-			return value_create_ptr(&int_val);
+			lua_pushlightuserdata(vm, value_to_ptr(v));
+		}
+		else if (id == TYPE_NULL)
+		{
+			lua_pushnil(vm);
 		}
 		else
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Unrecognized return type");
+			log_write("metacall", LOG_LEVEL_WARNING, "Unsupported argument type (%d) invoking lua function %s", id, function_name(func));
+
+			lua_pushnil(vm);
 		}
+
+		++nargs;
 	}
 
-	return NULL;
+	if (lua_pcall(vm, nargs, 1, 0) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Lua function %s invocation error: %s", function_name(func), lua_tostring(vm, -1));
+
+		lua_pop(vm, 1);
+
+		return NULL;
+	}
+
+	switch (lua_type(vm, -1))
+	{
+		case LUA_TNIL: {
+			ret = value_create_null();
+
+			break;
+		}
+
+		case LUA_TBOOLEAN: {
+			ret = value_create_bool(lua_toboolean(vm, -1) != 0 ? 1L : 0L);
+
+			break;
+		}
+
+		case LUA_TNUMBER: {
+#if LUA_VERSION_NUM >= 503
+			if (lua_isinteger(vm, -1))
+			{
+				ret = value_create_long((long)lua_tointeger(vm, -1));
+
+				break;
+			}
+#endif
+			ret = value_create_double((double)lua_tonumber(vm, -1));
+
+			break;
+		}
+
+		case LUA_TSTRING: {
+			size_t length = 0;
+
+			const char *str = lua_tolstring(vm, -1, &length);
+
+			ret = value_create_string(str, length);
+
+			break;
+		}
+
+		case LUA_TLIGHTUSERDATA: {
+			ret = value_create_ptr(lua_touserdata(vm, -1));
+
+			break;
+		}
+
+		default: {
+			log_write("metacall", LOG_LEVEL_WARNING, "Unsupported return type (%s) from lua function %s", lua_typename(vm, lua_type(vm, -1)), function_name(func));
+
+			break;
+		}
+	}
+
+	lua_pop(vm, 1);
+
+	return ret;
 }
 
 function_return function_lua_interface_await(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
@@ -258,6 +267,8 @@ void function_lua_interface_destroy(function func, function_impl impl)
 
 	if (lua_function != NULL)
 	{
+		luaL_unref(lua_function->lua_impl->vm, LUA_REGISTRYINDEX, lua_function->ref);
+
 		free(lua_function);
 	}
 }
@@ -268,7 +279,8 @@ function_interface function_lua_singleton(void)
 		&function_lua_interface_create,
 		&function_lua_interface_invoke,
 		&function_lua_interface_await,
-		&function_lua_interface_destroy
+		&function_lua_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &lua_interface;
@@ -349,6 +361,9 @@ loader_impl_data lua_loader_impl_initialize(loader_impl impl, configuration conf
 	/* Open all standard libraries into current Lua state */
 	luaL_openlibs(lua_impl->vm);
 
+	/* Preallocate the stack slots the invoke path relies on */
+	lua_checkstack(lua_impl->vm, LUA_LOADER_IMPL_STACK_SLOTS);
+
 	/* Register initialization */
 	loader_initialization_register(impl);
 
@@ -366,18 +381,26 @@ int lua_loader_impl_execution_path(loader_impl impl, const loader_naming_path pa
 
 loader_handle lua_loader_impl_load_from_file(loader_impl impl, const loader_naming_path paths[], size_t size)
 {
+	loader_impl_lua lua_impl = loader_impl_get(impl);
 	loader_impl_lua_handle handle = malloc(sizeof(struct loader_impl_lua_handle_type));
 
-	(void)impl;
-
 	if (handle != NULL)
 	{
 		size_t iterator;
 
-		/* TODO */
-
 		for (iterator = 0; iterator < size; ++iterator)
 		{
+			if (luaL_loadfile(lua_impl->vm, paths[iterator]) != 0 || lua_pcall(lua_impl->vm, 0, 0, 0) != 0)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Lua module %s failed to load: %s", paths[iterator], lua_tostring(lua_impl->vm, -1));
+
+				lua_pop(lua_impl->vm, 1);
+
+				free(handle);
+
+				return NULL;
+			}
+
 			log_write("metacall", LOG_LEVEL_DEBUG, "Lua module %s loaded from file", paths[iterator]);
 		}
 
@@ -396,14 +419,21 @@ loader_handle lua_loader_impl_load_from_memory(loader_impl impl, const loader_na
 
 	if (handle != NULL)
 	{
-		if (luaL_loadbuffer(lua_impl->vm, buffer, size, name) != 0)
+		/* The buffer size accounts for the null terminator, the chunk must not */
+		if (luaL_loadbuffer(lua_impl->vm, buffer, size > 0 ? size - 1 : 0, name) != 0 || lua_pcall(lua_impl->vm, 0, 0, 0) != 0)
 		{
-			log_write("metacall", LOG_LEVEL_Error, "Lua module %s failed to load: %s", name, lua_tostring(lua_impl->vm, -1));
+			log_write("metacall", LOG_LEVEL_ERROR, "Lua module %s failed to load: %s", name, lua_tostring(lua_impl->vm, -1));
+
+			lua_pop(lua_impl->vm, 1);
+
 			free(handle);
+
 			return NULL;
 		}
 
-		log_write("metacall", LOG_LEVEL_DEBUG, "Lua module %s. loaded from memory", name);
+		log_write("metacall", LOG_LEVEL_DEBUG, "Lua module %s loaded from memory", name);
+
+		handle->handle_lua_data = NULL;
 
 		return (loader_handle)handle;
 	}
@@ -449,17 +479,15 @@ int lua_loader_impl_clear(loader_impl impl, loader_handle handle)
 	return 1;
 }
 
-loader_impl_lua_function lua_function_create(loader_impl_lua_handle lua_handle)
+loader_impl_lua_function lua_function_create(loader_impl_lua lua_impl, int ref)
 {
 	loader_impl_lua_function lua_function = malloc(sizeof(struct loader_impl_lua_function_type));
 
 	if (lua_function != NULL)
 	{
-		/* TODO */
+		lua_function->lua_impl = lua_impl;
 
-		lua_function->lua_handle = lua_handle;
-
-		lua_function->function_lua_data = NULL;
+		lua_function->ref = ref;
 
 		return lua_function;
 	}
@@ -471,32 +499,87 @@ int lua_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx
 {
 	loader_impl_lua lua_impl = loader_impl_get(impl);
 
-	loader_impl_lua_handle lua_handle = (loader_impl_lua_handle)handle;
-
-	loader_impl_lua_function lua_function;
+	lua_State *vm = lua_impl->vm;
 
 	scope sp = context_scope(ctx);
 
-	(void)lua_impl;
+	/* Previously discovered handles already own their globals, skip them */
+	scope sp_global = context_scope(loader_impl_context(impl));
+
+	(void)handle;
 
 	log_write("metacall", LOG_LEVEL_DEBUG, "Lua module %p discovering", handle);
 
-	/* TODO: Introspect all functions */
+	/* The chunks define their functions in the global table, walk it
+	and register each lua function (the C functions of the standard
+	libraries are skipped) caching a registry reference so the invoke
+	path never performs a global lookup */
+	lua_loader_impl_globals(vm);
 
-	/* This is an example of how to create a function */
-	lua_function = lua_function_create(lua_handle);
+	lua_pushnil(vm);
 
-	if (lua_function != NULL)
+	while (lua_next(vm, -2) != 0)
 	{
-		function f = function_create("my_empty_func", 0, lua_function, &function_lua_singleton);
+		if (lua_type(vm, -1) == LUA_TFUNCTION && lua_iscfunction(vm, -1) == 0 && lua_type(vm, -2) == LUA_TSTRING)
+		{
+			const char *name = lua_tostring(vm, -2);
+
+			if (scope_get(sp, name) == NULL && scope_get(sp_global, name) == NULL)
+			{
+				size_t args_size = 0;
+
+				loader_impl_lua_function lua_function;
+
+				int ref;
+
+#if LUA_VERSION_NUM >= 502
+				{
+					/* The 5.1 debug API does not expose the parameter
+					count, those builds register a variadic signature */
+					lua_Debug info;
+
+					lua_pushvalue(vm, -1);
 
-		signature s = function_signature(f);
+					if (lua_getinfo(vm, ">u", &info) != 0)
+					{
+						args_size = (size_t)info.nparams;
+					}
+				}
+#endif
 
-		signature_set_return(s, loader_impl_type(impl, "Integer"));
+				lua_pushvalue(vm, -1);
 
-		scope_define(sp, function_name(f), value_create_function(f));
+				ref = luaL_ref(vm, LUA_REGISTRYINDEX);
+
+				lua_function = lua_function_create(lua_impl, ref);
+
+				if (lua_function != NULL)
+				{
+					function f = function_create(name, args_size, lua_function, &function_lua_singleton);
+
+					if (f != NULL)
+					{
+						scope_define(sp, function_name(f), value_create_function(f));
+					}
+					else
+					{
+						luaL_unref(vm, LUA_REGISTRYINDEX, ref);
+
+						free(lua_function);
+					}
+				}
+				else
+				{
+					luaL_unref(vm, LUA_REGISTRYINDEX, ref);
+				}
+			}
+		}
+
+		lua_pop(vm, 1);
 	}
 
+	lua_pop(vm, 1);
+
 	return 0;
 }
 
@@ -23,6 +23,10 @@
 #include <mock_loader/mock_loader.h>
 #include <mock_loader/mock_loader_impl.h>
 
+#if defined(MOCK_LOADER_STATIC_REGISTRATION)
+	#include <loader/loader_impl_static.h>
+#endif
+
 loader_impl_interface mock_loader_impl_interface_singleton()
 {
 	static struct loader_impl_interface_type loader_impl_interface_mock = {
@@ -33,7 +37,9 @@ loader_impl_interface mock_loader_impl_interface_singleton()
 		&mock_loader_impl_load_from_package,
 		&mock_loader_impl_clear,
 		&mock_loader_impl_discover,
-		&mock_loader_impl_destroy
+		&mock_loader_impl_destroy,
+		NULL /* parallel */,
+		NULL /* address */
 	};
 
 	return &loader_impl_interface_mock;
@@ -55,3 +61,9 @@ const char *mock_loader_print_info()
 
 	return mock_loader_info;
 }
+
+#if defined(MOCK_LOADER_STATIC_REGISTRATION)
+/* Monolithic build, the loader links into the MetaCall library and
+registers itself before main instead of being resolved through dynlink */
+LOADER_IMPL_STATIC_REGISTER(mock, &mock_loader_impl_interface_singleton)
+#endif
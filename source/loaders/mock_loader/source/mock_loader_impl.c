@@ -27,17 +27,42 @@
 #include <reflect/reflect_function.h>
 #include <reflect/reflect_scope.h>
 #include <reflect/reflect_type.h>
+#include <reflect/reflect_value_type.h>
+
+#include <configuration/configuration.h>
+
+#include <format/format_specifier.h>
 
 #include <log/log.h>
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+/* Synthetic benchmark function kinds, they exercise the core
+marshaling paths with parameterized value shapes and no runtime
+behind them, so measurements isolate reflect and serialization cost */
+#define MOCK_LOADER_BENCH_SINK	 1 /* Accepts any value, returns null */
+#define MOCK_LOADER_BENCH_ECHO	 2 /* Returns a copy of its argument */
+#define MOCK_LOADER_BENCH_STRING 3 /* Returns a string of configured length */
+#define MOCK_LOADER_BENCH_ARRAY	 4 /* Returns an array of configured width */
+#define MOCK_LOADER_BENCH_MAP	 5 /* Returns a map of configured depth and width */
 
 typedef struct loader_impl_mock_type
 {
 	void *impl_mock_data;
+	value bench_string; /* Template values built once from the configuration, */
+	value bench_array;	/* invokes return copies so each call pays exactly */
+	value bench_map;	/* the core allocation and marshaling cost */
 
 } * loader_impl_mock;
 
+struct loader_impl_mock_bench_type
+{
+	int kind;
+	loader_impl_mock mock_impl;
+};
+
 typedef struct loader_impl_mock_handle_type
 {
 	void *handle_mock_data;
@@ -69,7 +94,28 @@ function_return function_mock_interface_invoke(function func, function_impl impl
 
 	type ret_type = signature_get_return(s);
 
-	(void)mock_function;
+	/* Benchmark functions skip the logging below so the measured path
+	contains nothing but the marshal itself */
+	if (mock_function->function_mock_data != NULL)
+	{
+		struct loader_impl_mock_bench_type *bench = (struct loader_impl_mock_bench_type *)mock_function->function_mock_data;
+
+		switch (bench->kind)
+		{
+			case MOCK_LOADER_BENCH_SINK:
+				return value_create_null();
+			case MOCK_LOADER_BENCH_ECHO:
+				return size > 0 ? value_type_copy(args[0]) : value_create_null();
+			case MOCK_LOADER_BENCH_STRING:
+				return value_type_copy(bench->mock_impl->bench_string);
+			case MOCK_LOADER_BENCH_ARRAY:
+				return value_type_copy(bench->mock_impl->bench_array);
+			case MOCK_LOADER_BENCH_MAP:
+				return value_type_copy(bench->mock_impl->bench_map);
+			default:
+				return NULL;
+		}
+	}
 
 	log_write("metacall", LOG_LEVEL_DEBUG, "Invoking mock function %s", name);
 
@@ -232,6 +278,11 @@ void function_mock_interface_destroy(function func, function_impl impl)
 
 	if (mock_function != NULL)
 	{
+		if (mock_function->function_mock_data != NULL)
+		{
+			free(mock_function->function_mock_data);
+		}
+
 		free(mock_function);
 	}
 }
@@ -242,7 +293,8 @@ function_interface function_mock_singleton(void)
 		&function_mock_interface_create,
 		&function_mock_interface_invoke,
 		&function_mock_interface_await,
-		&function_mock_interface_destroy
+		&function_mock_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &mock_interface;
@@ -289,12 +341,145 @@ int mock_loader_impl_initialize_types(loader_impl impl)
 	return 0;
 }
 
+static long mock_loader_impl_config_long(configuration config, const char *key, long default_value)
+{
+	value v;
+
+	if (config == NULL)
+	{
+		return default_value;
+	}
+
+	v = configuration_value(config, key);
+
+	if (v == NULL)
+	{
+		return default_value;
+	}
+
+	if (value_type_id(v) == TYPE_INT)
+	{
+		return (long)value_to_int(v);
+	}
+
+	if (value_type_id(v) == TYPE_LONG)
+	{
+		return value_to_long(v);
+	}
+
+	return default_value;
+}
+
+static value mock_loader_impl_bench_string_create(size_t length)
+{
+	value v;
+
+	char *buffer = malloc(sizeof(char) * (length + 1));
+
+	if (buffer == NULL)
+	{
+		return NULL;
+	}
+
+	memset(buffer, 'x', length);
+
+	buffer[length] = '\0';
+
+	v = value_create_string(buffer, length);
+
+	free(buffer);
+
+	return v;
+}
+
+static value mock_loader_impl_bench_array_create(size_t width)
+{
+	size_t iterator;
+
+	value v = value_create_array(NULL, width);
+
+	value *array;
+
+	if (v == NULL)
+	{
+		return NULL;
+	}
+
+	array = value_to_array(v);
+
+	for (iterator = 0; iterator < width; ++iterator)
+	{
+		array[iterator] = value_create_long((long)iterator);
+	}
+
+	return v;
+}
+
+static value mock_loader_impl_bench_map_create(size_t depth, size_t width)
+{
+	size_t iterator;
+
+	value v = value_create_map(NULL, width);
+
+	value *map;
+
+	if (v == NULL)
+	{
+		return NULL;
+	}
+
+	map = value_to_map(v);
+
+	for (iterator = 0; iterator < width; ++iterator)
+	{
+		char key[0x20];
+
+		value *tuple;
+
+		map[iterator] = value_create_array(NULL, 2);
+
+		if (map[iterator] == NULL)
+		{
+			value_type_destroy(v);
+
+			return NULL;
+		}
+
+		tuple = value_to_array(map[iterator]);
+
+		snprintf(key, sizeof(key), "k%" PRIuS, iterator);
+
+		tuple[0] = value_create_string(key, strlen(key));
+
+		/* The first entry of each level nests the next level so the
+		shape is deep and wide at the same time */
+		if (iterator == 0 && depth > 1)
+		{
+			tuple[1] = mock_loader_impl_bench_map_create(depth - 1, width);
+		}
+		else
+		{
+			tuple[1] = value_create_long((long)iterator);
+		}
+
+		if (tuple[0] == NULL || tuple[1] == NULL)
+		{
+			value_type_destroy(v);
+
+			return NULL;
+		}
+	}
+
+	return v;
+}
+
 loader_impl_data mock_loader_impl_initialize(loader_impl impl, configuration config)
 {
 	loader_impl_mock mock_impl;
 
+	long string_length, array_width, map_depth, map_width;
+
 	(void)impl;
-	(void)config;
 
 	mock_impl = malloc(sizeof(struct loader_impl_mock_type));
 
@@ -312,6 +497,17 @@ loader_impl_data mock_loader_impl_initialize(loader_impl impl, configuration con
 
 	mock_impl->impl_mock_data = NULL;
 
+	/* Build the benchmark value templates once from the configuration
+	so invokes only pay the copy being measured */
+	string_length = mock_loader_impl_config_long(config, "bench_string_length", 1024L);
+	array_width = mock_loader_impl_config_long(config, "bench_array_width", 64L);
+	map_depth = mock_loader_impl_config_long(config, "bench_map_depth", 4L);
+	map_width = mock_loader_impl_config_long(config, "bench_map_width", 8L);
+
+	mock_impl->bench_string = mock_loader_impl_bench_string_create(string_length > 0 ? (size_t)string_length : 0);
+	mock_impl->bench_array = mock_loader_impl_bench_array_create(array_width > 0 ? (size_t)array_width : 0);
+	mock_impl->bench_map = mock_loader_impl_bench_map_create(map_depth > 0 ? (size_t)map_depth : 1, map_width > 0 ? (size_t)map_width : 1);
+
 	/* Register initialization */
 	loader_initialization_register(impl);
 
@@ -419,6 +615,79 @@ loader_impl_mock_function mock_function_create(loader_impl_mock_handle mock_hand
 	return NULL;
 }
 
+static loader_impl_mock_function mock_function_create_bench(loader_impl_mock_handle mock_handle, loader_impl_mock mock_impl, int kind)
+{
+	loader_impl_mock_function mock_function = mock_function_create(mock_handle);
+
+	struct loader_impl_mock_bench_type *bench;
+
+	if (mock_function == NULL)
+	{
+		return NULL;
+	}
+
+	bench = malloc(sizeof(struct loader_impl_mock_bench_type));
+
+	if (bench == NULL)
+	{
+		free(mock_function);
+
+		return NULL;
+	}
+
+	bench->kind = kind;
+	bench->mock_impl = mock_impl;
+
+	mock_function->function_mock_data = bench;
+
+	return mock_function;
+}
+
+/* Register the synthetic benchmark functions, signatures are left
+dynamically typed except where the shape fixes the type */
+static void mock_loader_impl_discover_bench(loader_impl impl, loader_impl_mock mock_impl, loader_impl_mock_handle mock_handle, scope sp)
+{
+	static struct
+	{
+		const char *name;
+		int kind;
+		size_t arity;
+		const char *ret;
+	} bench_functions[] = {
+		{ "bench_sink", MOCK_LOADER_BENCH_SINK, 1, NULL },
+		{ "bench_echo", MOCK_LOADER_BENCH_ECHO, 1, NULL },
+		{ "bench_string", MOCK_LOADER_BENCH_STRING, 0, "String" },
+		{ "bench_array", MOCK_LOADER_BENCH_ARRAY, 0, NULL },
+		{ "bench_map", MOCK_LOADER_BENCH_MAP, 0, NULL }
+	};
+
+	size_t index, size = sizeof(bench_functions) / sizeof(bench_functions[0]);
+
+	for (index = 0; index < size; ++index)
+	{
+		loader_impl_mock_function mock_function = mock_function_create_bench(mock_handle, mock_impl, bench_functions[index].kind);
+
+		if (mock_function != NULL)
+		{
+			function f = function_create(bench_functions[index].name, bench_functions[index].arity, mock_function, &function_mock_singleton);
+
+			signature s = function_signature(f);
+
+			if (bench_functions[index].ret != NULL)
+			{
+				signature_set_return(s, loader_impl_type(impl, bench_functions[index].ret));
+			}
+
+			if (bench_functions[index].arity > 0)
+			{
+				signature_set(s, 0, "input", NULL);
+			}
+
+			scope_define(sp, function_name(f), value_create_function(f));
+		}
+	}
+}
+
 int mock_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx)
 {
 	loader_impl_mock mock_impl = loader_impl_get(impl);
@@ -429,8 +698,6 @@ int mock_loader_impl_discover(loader_impl impl, loader_handle handle, context ct
 
 	scope sp = context_scope(ctx);
 
-	(void)mock_impl;
-
 	log_write("metacall", LOG_LEVEL_DEBUG, "Mock module %p discovering", handle);
 
 	if (mock_function != NULL)
@@ -561,6 +828,8 @@ int mock_loader_impl_discover(loader_impl impl, loader_handle handle, context ct
 		scope_define(sp, function_name(f), value_create_function(f));
 	}
 
+	mock_loader_impl_discover_bench(impl, mock_impl, mock_handle, sp);
+
 	return 0;
 }
 
@@ -573,6 +842,22 @@ int mock_loader_impl_destroy(loader_impl impl)
 		/* Destroy children loaders */
 		loader_unload_children(impl);
 
+		/* Destroy benchmark value templates */
+		if (mock_impl->bench_string != NULL)
+		{
+			value_type_destroy(mock_impl->bench_string);
+		}
+
+		if (mock_impl->bench_array != NULL)
+		{
+			value_type_destroy(mock_impl->bench_array);
+		}
+
+		if (mock_impl->bench_map != NULL)
+		{
+			value_type_destroy(mock_impl->bench_map);
+		}
+
 		/* Destroy Mock */
 		free(mock_impl);
 
@@ -18,7 +18,209 @@ Module.prototype.node_require = node_require;
 Module.prototype.node_resolve = node_resolve;
 Module.prototype.node_cache = node_cache;
 
-function node_loader_trampoline_initialize() {
+/* Worker thread pool for CPU-bound calls, opt-in through the loader
+configuration (worker_pool_size), disabled while size is zero */
+const worker_pool = {
+	size: 0,
+	workers: [],
+	paths: [],
+	sequence: 0,
+};
+
+/* Shared on-disk compilation cache, enabled through the
+METACALL_CODE_CACHE_PATH environment variable so every process on the
+host (and derived loaders going through require) reuses the same
+artifacts. Keys include the V8 version so engine upgrades never consume
+stale bytecode. */
+const code_cache_path = process.env['METACALL_CODE_CACHE_PATH'] || '';
+
+function node_loader_trampoline_code_cache_hash(content) {
+	/* FNV-1a over the source, length appended to spread collisions */
+	let h = 0x811c9dc5 >>> 0;
+
+	for (let i = 0; i < content.length; ++i) {
+		h = Math.imul(h ^ content.charCodeAt(i), 0x01000193) >>> 0;
+	}
+
+	return h.toString(16).padStart(8, '0') + '-' + content.length.toString(16);
+}
+
+function node_loader_trampoline_code_cache_install() {
+	if (code_cache_path === '') {
+		return;
+	}
+
+	try {
+		fs.mkdirSync(code_cache_path, { recursive: true });
+	} catch (ex) {
+		console.log('NodeJS Warning: code cache directory could not be created:', ex.message);
+		return;
+	}
+
+	const vm = require('vm');
+	// eslint-disable-next-line no-underscore-dangle
+	const node_compile = Module.prototype._compile;
+
+	// eslint-disable-next-line no-underscore-dangle
+	Module.prototype._compile = function (content, filename) {
+		/* Only file backed modules are cached, memory buffers keep the stock path */
+		if (typeof filename !== 'string' || !path.isAbsolute(filename)) {
+			return node_compile.call(this, content, filename);
+		}
+
+		const file = path.join(code_cache_path,
+			`${node_loader_trampoline_code_cache_hash(content)}-v8-${process.versions.v8}.blob`);
+
+		let cached = null;
+
+		try {
+			cached = fs.readFileSync(file);
+		} catch (_) {}
+
+		let script;
+
+		try {
+			script = new vm.Script(Module.wrap(content), {
+				filename,
+				cachedData: cached || undefined,
+				produceCachedData: cached === null,
+			});
+		} catch (_) {
+			/* Parse errors surface through the stock path with proper diagnostics */
+			return node_compile.call(this, content, filename);
+		}
+
+		if (cached === null && script.cachedData) {
+			try {
+				fs.writeFileSync(file, script.cachedData);
+			} catch (_) {}
+		} else if (cached !== null && script.cachedDataRejected) {
+			/* Stale artifact (flag or build mismatch), drop it so the
+			next load regenerates the cache */
+			try {
+				fs.unlinkSync(file);
+			} catch (_) {}
+		}
+
+		const self = this;
+		const compiledWrapper = script.runInThisContext();
+
+		function require(id) {
+			return self.require(id);
+		}
+
+		require.resolve = function (request, options) {
+			// eslint-disable-next-line no-underscore-dangle
+			return Module._resolveFilename(request, self, false, options);
+		};
+
+		require.main = process.mainModule;
+		// eslint-disable-next-line no-underscore-dangle
+		require.extensions = Module._extensions;
+		// eslint-disable-next-line no-underscore-dangle
+		require.cache = Module._cache;
+
+		return compiledWrapper.call(self.exports,
+			self.exports, require, self, filename, path.dirname(filename));
+	};
+}
+
+node_loader_trampoline_code_cache_install();
+
+function node_loader_trampoline_pool_worker(index) {
+	let entry = worker_pool.workers[index];
+
+	if (entry !== undefined) {
+		return entry;
+	}
+
+	const { Worker } = require('worker_threads');
+
+	/* Each worker loads the same scripts that were loaded in the main
+	thread and serves { id, name, args } call messages */
+	const source = `
+		const { parentPort, workerData } = require('worker_threads');
+		const handles = {};
+		for (const p of workerData.paths) {
+			try {
+				Object.assign(handles, require(p));
+			} catch (e) {
+				console.error('NodeJS worker load error:', e);
+			}
+		}
+		parentPort.on('message', (msg) => {
+			try {
+				const func = handles[msg.name];
+				if (typeof func !== 'function') {
+					throw new Error('Function ' + msg.name + ' not found in worker');
+				}
+				Promise.resolve(func(...msg.args)).then(
+					ret => parentPort.postMessage({ id: msg.id, ret }),
+					err => parentPort.postMessage({ id: msg.id, err: String(err) })
+				);
+			} catch (err) {
+				parentPort.postMessage({ id: msg.id, err: String(err) });
+			}
+		});
+	`;
+
+	entry = {
+		worker: new Worker(source, { eval: true, workerData: { paths: worker_pool.paths.slice() } }),
+		pending: new Map(),
+	};
+
+	entry.worker.on('message', (msg) => {
+		const callback = entry.pending.get(msg.id);
+
+		if (callback !== undefined) {
+			entry.pending.delete(msg.id);
+			callback(msg);
+		}
+	});
+
+	/* Do not keep the event loop alive because of idle workers */
+	entry.worker.unref();
+
+	worker_pool.workers[index] = entry;
+
+	return entry;
+}
+
+function node_loader_trampoline_pool_invoke(func, args) {
+	if (worker_pool.size <= 0 || typeof func.name !== 'string' || func.name === '') {
+		return null;
+	}
+
+	/* Sticky routing: the same function always runs in the same worker
+	so any module state it touches stays in one place */
+	let hash = 0;
+
+	for (let i = 0; i < func.name.length; ++i) {
+		hash = ((hash * 31) + func.name.charCodeAt(i)) >>> 0;
+	}
+
+	const entry = node_loader_trampoline_pool_worker(hash % worker_pool.size);
+	const id = worker_pool.sequence++;
+
+	return new Promise((resolve, reject) => {
+		entry.pending.set(id, (msg) => {
+			if (msg.err !== undefined) {
+				reject(new Error(msg.err));
+			} else {
+				resolve(msg.ret);
+			}
+		});
+
+		entry.worker.postMessage({ id, name: func.name, args });
+	});
+}
+
+function node_loader_trampoline_initialize(pool_size) {
+	// Set up the worker thread pool size (zero or undefined disables it)
+	if (typeof pool_size === 'number' && pool_size > 0) {
+		worker_pool.size = pool_size;
+	}
+
 	// Add current execution directory to the execution paths
 	node_loader_trampoline_execution_path(process.cwd());
 
@@ -125,6 +327,9 @@ function node_loader_trampoline_load_from_file(paths) {
 			const m = node_loader_trampoline_import(node_require, p);
 
 			handle[p] = node_loader_trampoline_module(m);
+
+			// Remember the path so pool workers can load the same scripts
+			worker_pool.paths.push(p);
 		}
 
 		return handle;
@@ -329,8 +534,12 @@ function node_loader_trampoline_await_function(trampoline) {
 			throw new Error('Await trampoline_ptr must be an object, not ' + typeof trampoline_ptr);
 		}
 
+		/* CPU-bound functions run in a pool worker when the pool is
+		enabled, falling back to the event loop thread otherwise */
+		const result = node_loader_trampoline_pool_invoke(func, args) || func(...args);
+
 		return new Promise((resolve, reject) =>
-			func(...args).then(
+			result.then(
 				x => resolve(trampoline.resolve(trampoline_ptr, x)),
 				x => reject(trampoline.reject(trampoline_ptr, x))
 			).catch(
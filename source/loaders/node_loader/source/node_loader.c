@@ -33,7 +33,9 @@ loader_impl_interface node_loader_impl_interface_singleton(void)
 		&node_loader_impl_load_from_package,
 		&node_loader_impl_clear,
 		&node_loader_impl_discover,
-		&node_loader_impl_destroy
+		&node_loader_impl_destroy,
+		NULL /* parallel */,
+		NULL /* address */
 	};
 
 	return &loader_impl_interface_node;
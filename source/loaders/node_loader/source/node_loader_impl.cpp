@@ -49,6 +49,7 @@ extern char **environ;
 #include <node_loader/node_loader_trampoline.h>
 
 #include <loader/loader.h>
+#include <loader/loader_fork.h>
 #include <loader/loader_impl.h>
 
 #include <reflect/reflect_context.h>
@@ -56,10 +57,13 @@ extern char **environ;
 #include <reflect/reflect_future.h>
 #include <reflect/reflect_scope.h>
 #include <reflect/reflect_type.h>
+#include <reflect/reflect_value_type_id_size.h>
 
 /* TODO: Make logs thread safe */
 #include <log/log.h>
 
+#include <threading/threading_event.h>
+
 #include <metacall/metacall.h>
 
 #include <cstdio>
@@ -72,6 +76,7 @@ extern char **environ;
 #include <streambuf>
 #include <string>
 #include <thread>
+#include <vector>
 
 /* Disable warnings from V8 and NodeJS */
 #if defined(_MSC_VER) || defined(__clang__)
@@ -123,10 +128,10 @@ extern char **environ;
 	Detour method is not valid because of NodeJS cannot be reinitialized, platform pointer already initialized in CHECK macro
 */
 
-/* TODO: (3.0)
-
-	Use uv_loop_fork if available to fork and avoid reinitializing
-*/
+/* The fork detour coordinates with this loader through the callbacks
+registered in loader_fork: the call paths are quiesced before the fork
+and the event loop backend is repaired in the child with uv_loop_fork,
+avoiding the teardown and reboot of the whole NodeJS instance */
 
 namespace node
 {
@@ -167,6 +172,12 @@ typedef struct loader_impl_async_discover_safe_type *loader_impl_async_discover_
 struct loader_impl_async_func_call_safe_type;
 typedef struct loader_impl_async_func_call_safe_type *loader_impl_async_func_call_safe;
 
+struct loader_impl_async_func_call_entry_type;
+typedef struct loader_impl_async_func_call_entry_type *loader_impl_async_func_call_entry;
+
+struct loader_impl_async_func_call_batch_safe_type;
+typedef struct loader_impl_async_func_call_batch_safe_type *loader_impl_async_func_call_batch_safe;
+
 struct loader_impl_async_func_await_safe_type;
 typedef struct loader_impl_async_func_await_safe_type *loader_impl_async_func_await_safe;
 
@@ -188,6 +199,10 @@ struct loader_impl_node_type
 	napi_env env;						/* Used for storing environment for reentrant calls */
 	napi_ref global_ref;				/* Store global reference */
 	napi_ref function_table_object_ref; /* Store function table reference registered by the trampoline */
+	napi_ref function_await_ref;		/* Cached await_function trampoline, resolved once at register */
+	napi_ref future_await_ref;			/* Cached await_future trampoline, resolved once at register */
+
+	int worker_pool_size; /* Worker thread pool size requested by configuration, zero disables the pool */
 
 	napi_value initialize_safe_ptr;
 	loader_impl_async_initialize_safe initialize_safe;
@@ -217,6 +232,10 @@ struct loader_impl_node_type
 	loader_impl_async_func_call_safe func_call_safe;
 	napi_threadsafe_function threadsafe_func_call;
 
+	napi_value func_call_batch_safe_ptr;
+	loader_impl_async_func_call_batch_safe func_call_batch_safe;
+	napi_threadsafe_function threadsafe_func_call_batch;
+
 	napi_value func_await_safe_ptr;
 	loader_impl_async_func_await_safe func_await_safe;
 	napi_threadsafe_function threadsafe_func_await;
@@ -244,6 +263,10 @@ struct loader_impl_node_type
 	uv_cond_t cond;
 	std::atomic_bool locked;
 
+	/* Pending host to JS calls, drained in a single event loop tick */
+	uv_mutex_t call_queue_mutex;
+	std::vector<loader_impl_async_func_call_entry> call_queue;
+
 	int stdin_copy;
 	int stdout_copy;
 	int stderr_copy;
@@ -266,11 +289,20 @@ struct loader_impl_node_type
 	loader_impl impl;
 };
 
+/* Direct converter compiled into the per parameter conversion plan of
+a function, resolved once from the signature declared at discovery */
+typedef napi_value (*node_loader_impl_converter)(napi_env env, value v);
+
 typedef struct loader_impl_node_function_type
 {
 	loader_impl_node node_impl;
 	napi_ref func_ref;
 	napi_value *argv;
+	size_t argv_size;
+	/* Conversion plan, one direct converter per typed parameter (null
+	entries and arguments beyond the plan fall back to the type switch) */
+	node_loader_impl_converter *converters;
+	size_t converters_size;
 
 } * loader_impl_node_function;
 
@@ -340,6 +372,23 @@ struct loader_impl_async_func_call_safe_type
 	function_return ret;
 };
 
+/* Stack allocated by the calling host thread, completed by the batch
+drain which publishes the result and signals the futex backed event */
+struct loader_impl_async_func_call_entry_type
+{
+	function func;
+	loader_impl_node_function node_func;
+	void **args;
+	size_t size;
+	function_return ret;
+	struct threading_event_type event;
+};
+
+struct loader_impl_async_func_call_batch_safe_type
+{
+	loader_impl_node node_impl;
+};
+
 struct loader_impl_async_func_await_safe_type
 {
 	loader_impl_node node_impl;
@@ -448,6 +497,8 @@ static napi_value node_loader_impl_async_execution_path_safe(napi_env env, napi_
 
 static void node_loader_impl_func_call_safe(napi_env env, loader_impl_async_func_call_safe func_call_safe);
 
+static napi_value node_loader_impl_async_func_call_batch_safe(napi_env env, napi_callback_info info);
+
 static napi_value node_loader_impl_async_func_call_safe(napi_env env, napi_callback_info info);
 
 static void node_loader_impl_func_await_safe(napi_env env, loader_impl_async_func_await_safe func_await_safe);
@@ -712,7 +763,66 @@ value node_loader_impl_napi_to_value(loader_impl_node node_impl, napi_env env, n
 	{
 		bool result = false;
 
-		if (napi_is_array(env, v, &result) == napi_ok && result == true)
+		bool is_typedarray = false;
+
+		if (napi_is_typedarray(env, v, &is_typedarray) == napi_ok && is_typedarray == true)
+		{
+			napi_typedarray_type array_type;
+
+			size_t length = 0, byte_offset = 0;
+
+			void *data = NULL;
+
+			napi_value arraybuffer;
+
+			type_id element_id = TYPE_INVALID;
+
+			status = napi_get_typedarray_info(env, v, &array_type, &length, &data, &arraybuffer, &byte_offset);
+
+			node_loader_impl_exception(env, status);
+
+			switch (array_type)
+			{
+				case napi_int8_array:
+				case napi_uint8_array:
+				case napi_uint8_clamped_array:
+					element_id = TYPE_CHAR;
+					break;
+
+				case napi_int16_array:
+				case napi_uint16_array:
+					element_id = TYPE_SHORT;
+					break;
+
+				case napi_int32_array:
+				case napi_uint32_array:
+					element_id = TYPE_INT;
+					break;
+
+				case napi_float32_array:
+					element_id = TYPE_FLOAT;
+					break;
+
+				case napi_float64_array:
+					element_id = TYPE_DOUBLE;
+					break;
+
+				default:
+					break;
+			}
+
+			if (element_id != TYPE_INVALID)
+			{
+				/* The TypedArray memory is borrowed zero copy, so the
+				value must not outlive the backing ArrayBuffer */
+				ret = value_create_typed_array_view(data, length, element_id);
+			}
+			else
+			{
+				napi_throw_error(env, NULL, "NodeJS Loader typed array element type is not supported");
+			}
+		}
+		else if (napi_is_array(env, v, &result) == napi_ok && result == true)
 		{
 			uint32_t iterator, length = 0;
 
@@ -934,6 +1044,51 @@ napi_value node_loader_impl_napi_to_value_callback(napi_env env, napi_callback_i
 	return result;
 }
 
+static napi_value node_loader_impl_string_to_napi(napi_env env, value v)
+{
+	const char *str = value_to_string(v);
+
+	size_t length = value_type_size(v) - 1;
+
+	napi_value n = nullptr;
+
+	napi_status status;
+
+#if defined(NODE_API_EXPERIMENTAL) || (defined(NAPI_VERSION) && NAPI_VERSION >= 10)
+	/* ASCII content is one byte clean in V8, so a string tagged ASCII at
+	creation can be wrapped as an external string instead of copied and
+	revalidated; the value is retained until NodeJS collects the string,
+	mirroring the external buffer path. Short strings stay on the copying
+	path where the external bookkeeping costs more than the copy */
+	if (length >= 0x40 && value_type_string_ascii(v) != 0)
+	{
+		auto finalizer = [](napi_env, void *, void *finalize_hint) {
+			value_type_destroy(finalize_hint);
+		};
+
+		bool copied = false;
+
+		value_ref_inc(v);
+
+		status = node_api_create_external_string_latin1(env, const_cast<char *>(str), length, finalizer, v, &n, &copied);
+
+		if (status == napi_ok)
+		{
+			/* When the runtime copied anyway it already ran the finalizer */
+			return n;
+		}
+
+		value_type_destroy(v);
+	}
+#endif
+
+	status = napi_create_string_utf8(env, str, length, &n);
+
+	node_loader_impl_exception(env, status);
+
+	return n;
+}
+
 napi_value node_loader_impl_value_to_napi(loader_impl_node node_impl, napi_env env, value arg)
 {
 	value arg_value = static_cast<value>(arg);
@@ -1004,13 +1159,7 @@ napi_value node_loader_impl_value_to_napi(loader_impl_node node_impl, napi_env e
 	}
 	else if (id == TYPE_STRING)
 	{
-		const char *str_value = value_to_string(arg_value);
-
-		size_t length = value_type_size(arg_value) - 1;
-
-		status = napi_create_string_utf8(env, str_value, length, &v);
-
-		node_loader_impl_exception(env, status);
+		v = node_loader_impl_string_to_napi(env, arg_value);
 	}
 	else if (id == TYPE_BUFFER)
 	{
@@ -1018,10 +1167,87 @@ napi_value node_loader_impl_value_to_napi(loader_impl_node node_impl, napi_env e
 
 		size_t size = value_type_size(arg_value);
 
-		status = napi_create_buffer(env, size, &buff_value, &v);
+		/* The external buffer borrows the value storage instead of copying
+		it, the value is retained until NodeJS collects the buffer */
+		auto finalizer = [](napi_env, void *, void *finalize_hint) {
+			value_type_destroy(finalize_hint);
+		};
+
+		value_ref_inc(arg_value);
+
+		status = napi_create_external_buffer(env, size, buff_value, finalizer, arg_value, &v);
+
+		if (status != napi_ok)
+		{
+			/* Environments which forbid external buffers get a copy */
+			value_type_destroy(arg_value);
+
+			status = napi_create_buffer_copy(env, size, buff_value, NULL, &v);
+		}
 
 		node_loader_impl_exception(env, status);
 	}
+	else if (id == TYPE_TYPED_ARRAY)
+	{
+		void *data = value_to_typed_array(arg_value);
+
+		size_t count = value_typed_array_count(arg_value);
+
+		type_id element_id = value_typed_array_type_id(arg_value);
+
+		size_t element_size = value_type_id_size(element_id);
+
+		napi_typedarray_type array_type;
+
+		napi_value arraybuffer;
+
+		bool supported = true;
+
+		switch (element_id)
+		{
+			case TYPE_BOOL:
+			case TYPE_CHAR:
+				array_type = napi_int8_array;
+				break;
+
+			case TYPE_SHORT:
+				array_type = napi_int16_array;
+				break;
+
+			case TYPE_INT:
+				array_type = napi_int32_array;
+				break;
+
+			case TYPE_FLOAT:
+				array_type = napi_float32_array;
+				break;
+
+			case TYPE_DOUBLE:
+				array_type = napi_float64_array;
+				break;
+
+			default:
+				supported = false;
+				break;
+		}
+
+		if (supported == true)
+		{
+			/* The ArrayBuffer wraps the value memory without copying,
+			so the TypedArray must not outlive the value */
+			status = napi_create_external_arraybuffer(env, data, count * element_size, NULL, NULL, &arraybuffer);
+
+			node_loader_impl_exception(env, status);
+
+			status = napi_create_typedarray(env, array_type, count, arraybuffer, 0, &v);
+
+			node_loader_impl_exception(env, status);
+		}
+		else
+		{
+			napi_throw_error(env, NULL, "NodeJS Loader typed array element type is not supported");
+		}
+	}
 	else if (id == TYPE_ARRAY)
 	{
 		value *array_value = value_to_array(arg_value);
@@ -1132,6 +1358,115 @@ void node_loader_impl_env(loader_impl_node node_impl, napi_env env)
 	node_impl->env = env;
 }
 
+static napi_value node_loader_impl_converter_bool(napi_env env, value v)
+{
+	napi_value n = nullptr;
+
+	napi_status status = napi_get_boolean(env, (value_to_bool(v) == 0) ? false : true, &n);
+
+	node_loader_impl_exception(env, status);
+
+	return n;
+}
+
+static napi_value node_loader_impl_converter_char(napi_env env, value v)
+{
+	napi_value n = nullptr;
+
+	napi_status status = napi_create_int32(env, static_cast<int32_t>(value_to_char(v)), &n);
+
+	node_loader_impl_exception(env, status);
+
+	return n;
+}
+
+static napi_value node_loader_impl_converter_short(napi_env env, value v)
+{
+	napi_value n = nullptr;
+
+	napi_status status = napi_create_int32(env, static_cast<int32_t>(value_to_short(v)), &n);
+
+	node_loader_impl_exception(env, status);
+
+	return n;
+}
+
+static napi_value node_loader_impl_converter_int(napi_env env, value v)
+{
+	napi_value n = nullptr;
+
+	napi_status status = napi_create_int32(env, static_cast<int32_t>(value_to_int(v)), &n);
+
+	node_loader_impl_exception(env, status);
+
+	return n;
+}
+
+static napi_value node_loader_impl_converter_long(napi_env env, value v)
+{
+	napi_value n = nullptr;
+
+	napi_status status = napi_create_int64(env, static_cast<int64_t>(value_to_long(v)), &n);
+
+	node_loader_impl_exception(env, status);
+
+	return n;
+}
+
+static napi_value node_loader_impl_converter_float(napi_env env, value v)
+{
+	napi_value n = nullptr;
+
+	napi_status status = napi_create_double(env, static_cast<double>(value_to_float(v)), &n);
+
+	node_loader_impl_exception(env, status);
+
+	return n;
+}
+
+static napi_value node_loader_impl_converter_double(napi_env env, value v)
+{
+	napi_value n = nullptr;
+
+	napi_status status = napi_create_double(env, value_to_double(v), &n);
+
+	node_loader_impl_exception(env, status);
+
+	return n;
+}
+
+static napi_value node_loader_impl_converter_string(napi_env env, value v)
+{
+	return node_loader_impl_string_to_napi(env, v);
+}
+
+/* Resolve the direct converter of a declared parameter type, types
+whose conversion depends on the runtime value stay on the type switch */
+static node_loader_impl_converter node_loader_impl_converter_resolve(type_id id)
+{
+	switch (id)
+	{
+		case TYPE_BOOL:
+			return &node_loader_impl_converter_bool;
+		case TYPE_CHAR:
+			return &node_loader_impl_converter_char;
+		case TYPE_SHORT:
+			return &node_loader_impl_converter_short;
+		case TYPE_INT:
+			return &node_loader_impl_converter_int;
+		case TYPE_LONG:
+			return &node_loader_impl_converter_long;
+		case TYPE_FLOAT:
+			return &node_loader_impl_converter_float;
+		case TYPE_DOUBLE:
+			return &node_loader_impl_converter_double;
+		case TYPE_STRING:
+			return &node_loader_impl_converter_string;
+		default:
+			return NULL;
+	}
+}
+
 int function_node_interface_create(function func, function_impl impl)
 {
 	loader_impl_node_function node_func = (loader_impl_node_function)impl;
@@ -1142,6 +1477,46 @@ int function_node_interface_create(function func, function_impl impl)
 
 	node_func->argv = static_cast<napi_value *>(malloc(sizeof(napi_value) * args_size));
 
+	node_func->argv_size = args_size;
+
+	node_func->converters = NULL;
+	node_func->converters_size = 0;
+
+	/* Compile the conversion plan, the signature is fixed at discovery
+	so per argument dispatch resolves here instead of on every call;
+	untyped signatures (the common case for plain JavaScript) skip it */
+	if (args_size > 0 && node_func->argv != NULL)
+	{
+		size_t compiled = 0;
+
+		node_loader_impl_converter *converters = static_cast<node_loader_impl_converter *>(malloc(sizeof(node_loader_impl_converter) * args_size));
+
+		if (converters != NULL)
+		{
+			for (size_t iterator = 0; iterator < args_size; ++iterator)
+			{
+				type t = signature_get_type(s, iterator);
+
+				converters[iterator] = t != NULL ? node_loader_impl_converter_resolve(type_index(t)) : NULL;
+
+				if (converters[iterator] != NULL)
+				{
+					++compiled;
+				}
+			}
+
+			if (compiled > 0)
+			{
+				node_func->converters = converters;
+				node_func->converters_size = args_size;
+			}
+			else
+			{
+				free(converters);
+			}
+		}
+	}
+
 	return (node_func->argv == NULL);
 }
 
@@ -1153,69 +1528,84 @@ function_return function_node_interface_invoke(function func, function_impl impl
 	{
 		loader_impl_node node_impl = node_func->node_impl;
 		function_return ret = NULL;
-		napi_status status;
-
-		/* Set up call safe arguments */
-		node_impl->func_call_safe->node_impl = node_impl;
-		node_impl->func_call_safe->func = func;
-		node_impl->func_call_safe->node_func = node_func;
-		node_impl->func_call_safe->args = static_cast<void **>(args);
-		node_impl->func_call_safe->size = size;
-		node_impl->func_call_safe->recv = NULL;
-		node_impl->func_call_safe->ret = NULL;
 
 		/* Check if we are in the JavaScript thread */
 		if (node_impl->js_thread_id == std::this_thread::get_id())
 		{
+			/* Set up call safe arguments */
+			node_impl->func_call_safe->node_impl = node_impl;
+			node_impl->func_call_safe->func = func;
+			node_impl->func_call_safe->node_func = node_func;
+			node_impl->func_call_safe->args = static_cast<void **>(args);
+			node_impl->func_call_safe->size = size;
+			node_impl->func_call_safe->recv = NULL;
+			node_impl->func_call_safe->ret = NULL;
+
 			/* We are already in the V8 thread, we can call safely */
 			node_loader_impl_func_call_safe(node_impl->env, node_impl->func_call_safe);
 
 			/* Set up return of the function call */
 			ret = node_impl->func_call_safe->ret;
 		}
-		/* Lock the mutex and set the parameters */
-		else if (node_impl->locked.load() == false && uv_mutex_trylock(&node_impl->mutex) == 0)
+		else
 		{
-			node_impl->locked.store(true);
+			struct loader_impl_async_func_call_entry_type entry;
+			napi_status status;
+			bool notify;
 
-			/* Acquire the thread safe function in order to do the call */
-			status = napi_acquire_threadsafe_function(node_impl->threadsafe_func_call);
+			entry.func = func;
+			entry.node_func = node_func;
+			entry.args = static_cast<void **>(args);
+			entry.size = size;
+			entry.ret = NULL;
 
-			if (status != napi_ok)
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid to aquire thread safe function invoke function in NodeJS loader");
-			}
+			threading_event_initialize(&entry.event);
 
-			/* Execute the thread safe call in a nonblocking manner */
-			status = napi_call_threadsafe_function(node_impl->threadsafe_func_call, nullptr, napi_tsfn_nonblocking);
+			/* Enqueue the call, only the call that makes the queue non
+			empty wakes up the event loop, the calls enqueued while the
+			drain is pending are executed in the same loop tick */
+			uv_mutex_lock(&node_impl->call_queue_mutex);
 
-			if (status != napi_ok)
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid to call to thread safe function invoke function in NodeJS loader");
-			}
+			notify = node_impl->call_queue.empty();
 
-			/* Release call safe function */
-			status = napi_release_threadsafe_function(node_impl->threadsafe_func_call, napi_tsfn_release);
+			node_impl->call_queue.push_back(&entry);
 
-			if (status != napi_ok)
+			uv_mutex_unlock(&node_impl->call_queue_mutex);
+
+			if (notify == true)
 			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid to release thread safe function invoke function in NodeJS loader");
-			}
+				/* Acquire the thread safe function in order to do the call */
+				status = napi_acquire_threadsafe_function(node_impl->threadsafe_func_call_batch);
 
-			/* Wait for the execution of the safe call */
-			uv_cond_wait(&node_impl->cond, &node_impl->mutex);
+				if (status != napi_ok)
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "Invalid to aquire thread safe function invoke function in NodeJS loader");
+				}
 
-			/* Set up return of the function call */
-			ret = node_impl->func_call_safe->ret;
+				/* Execute the thread safe call in a nonblocking manner */
+				status = napi_call_threadsafe_function(node_impl->threadsafe_func_call_batch, nullptr, napi_tsfn_nonblocking);
 
-			node_impl->locked.store(false);
+				if (status != napi_ok)
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "Invalid to call to thread safe function invoke function in NodeJS loader");
+				}
 
-			/* Unlock the mutex */
-			uv_mutex_unlock(&node_impl->mutex);
-		}
-		else
-		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Potential deadlock detected in function_node_interface_invoke, the call has not been executed in order to avoid the deadlock");
+				/* Release call safe function */
+				status = napi_release_threadsafe_function(node_impl->threadsafe_func_call_batch, napi_tsfn_release);
+
+				if (status != napi_ok)
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "Invalid to release thread safe function invoke function in NodeJS loader");
+				}
+			}
+
+			/* Wait until the batch drain publishes the result, the
+			event spins briefly before parking on the futex so short
+			calls are collected without any system call round trip */
+			threading_event_wait(&entry.event);
+
+			/* Set up return of the function call */
+			ret = entry.ret;
 		}
 
 		return ret;
@@ -1372,6 +1762,8 @@ void function_node_interface_destroy(function func, function_impl impl)
 		/* Free node function arguments */
 		free(node_func->argv);
 
+		free(node_func->converters);
+
 		/* Free node function */
 		free(node_func);
 	}
@@ -1383,7 +1775,8 @@ function_interface function_node_singleton()
 		&function_node_interface_create,
 		&function_node_interface_invoke,
 		&function_node_interface_await,
-		&function_node_interface_destroy
+		&function_node_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &node_function_interface;
@@ -1603,13 +1996,17 @@ void node_loader_impl_initialize_safe(napi_env env, loader_impl_async_initialize
 		}
 
 		/* Call to load from file function */
-		napi_value global, return_value;
+		napi_value global, return_value, pool_size;
+
+		status = napi_create_int32(env, (int32_t)node_impl->worker_pool_size, &pool_size);
+
+		node_loader_impl_exception(env, status);
 
 		status = napi_get_reference_value(env, node_impl->global_ref, &global);
 
 		node_loader_impl_exception(env, status);
 
-		status = napi_call_function(env, global, function_trampoline_initialize, 0, nullptr, &return_value);
+		status = napi_call_function(env, global, function_trampoline_initialize, 1, &pool_size, &return_value);
 
 		node_loader_impl_exception(env, status);
 	}
@@ -1755,27 +2152,48 @@ void node_loader_impl_func_call_safe(napi_env env, loader_impl_async_func_call_s
 	napi_value *argv;
 	loader_impl_node_function node_func;
 	size_t args_count;
-	signature s = function_signature(func_call_safe->func);
-	const size_t signature_args_size = signature_count(s);
 
 	/* Get function data */
 	args_size = func_call_safe->size;
 	node_func = func_call_safe->node_func;
 	args = func_call_safe->args;
 
-	/* Allocate dynamically more space for values in case of variable arguments */
-	argv = args_size > signature_args_size ? static_cast<napi_value *>(malloc(sizeof(napi_value) * args_size)) : node_func->argv;
+	/* Grow the pre-bound scratch array in case of variable arguments,
+	the grown capacity is kept by the function for later calls */
+	if (args_size > node_func->argv_size)
+	{
+		argv = static_cast<napi_value *>(realloc(node_func->argv, sizeof(napi_value) * args_size));
+
+		if (argv == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid scratch array allocation in NodeJS loader function call");
+
+			return;
+		}
+
+		node_func->argv = argv;
+		node_func->argv_size = args_size;
+	}
+
+	argv = node_func->argv;
 
 	/* Create scope */
 	napi_status status = napi_open_handle_scope(env, &handle_scope);
 
 	node_loader_impl_exception(env, status);
 
-	/* Build parameters */
+	/* Build parameters, compiled plan first (one predictable indirect
+	call per typed parameter), the type switch covers the rest */
 	for (args_count = 0; args_count < args_size; ++args_count)
 	{
-		/* Define parameter */
-		argv[args_count] = node_loader_impl_value_to_napi(func_call_safe->node_impl, env, args[args_count]);
+		if (args_count < node_func->converters_size && node_func->converters[args_count] != NULL)
+		{
+			argv[args_count] = node_func->converters[args_count](env, args[args_count]);
+		}
+		else
+		{
+			argv[args_count] = node_loader_impl_value_to_napi(func_call_safe->node_impl, env, args[args_count]);
+		}
 	}
 
 	/* Get function reference */
@@ -1806,11 +2224,6 @@ void node_loader_impl_func_call_safe(napi_env env, loader_impl_async_func_call_s
 	status = napi_close_handle_scope(env, handle_scope);
 
 	node_loader_impl_exception(env, status);
-
-	if (args_size > signature_args_size)
-	{
-		free(argv);
-	}
 }
 
 napi_value node_loader_impl_async_func_call_safe(napi_env env, napi_callback_info info)
@@ -1846,6 +2259,69 @@ napi_value node_loader_impl_async_func_call_safe(napi_env env, napi_callback_inf
 	return nullptr;
 }
 
+napi_value node_loader_impl_async_func_call_batch_safe(napi_env env, napi_callback_info info)
+{
+	loader_impl_async_func_call_batch_safe batch_safe = NULL;
+	napi_status status;
+	napi_value recv;
+	std::vector<loader_impl_async_func_call_entry> pending;
+	size_t iterator;
+
+	status = napi_get_cb_info(env, info, nullptr, nullptr, &recv, (void **)&batch_safe);
+
+	node_loader_impl_exception(env, status);
+
+	loader_impl_node node_impl = batch_safe->node_impl;
+
+	/* Store environment for reentrant calls */
+	node_impl->env = env;
+
+	for (;;)
+	{
+		/* Steal every pending call so they all run in this loop tick,
+		including the ones enqueued while the previous round executed */
+		uv_mutex_lock(&node_impl->call_queue_mutex);
+
+		pending.swap(node_impl->call_queue);
+
+		uv_mutex_unlock(&node_impl->call_queue_mutex);
+
+		if (pending.empty())
+		{
+			break;
+		}
+
+		for (iterator = 0; iterator < pending.size(); ++iterator)
+		{
+			loader_impl_async_func_call_entry entry = pending[iterator];
+
+			struct loader_impl_async_func_call_safe_type call_safe = {
+				node_impl,
+				entry->func,
+				entry->node_func,
+				entry->args,
+				entry->size,
+				recv,
+				NULL
+			};
+
+			/* Call to the implementation function */
+			node_loader_impl_func_call_safe(env, &call_safe);
+
+			entry->ret = call_safe.ret;
+
+			/* Publish the result and wake the calling thread, the
+			entry lives on the caller stack and must not be accessed
+			once it has been signaled */
+			threading_event_signal(&entry->event);
+		}
+
+		pending.clear();
+	}
+
+	return nullptr;
+}
+
 void node_loader_impl_async_func_await_finalize(napi_env, void *finalize_data, void *)
 {
 	loader_impl_async_func_await_trampoline trampoline = static_cast<loader_impl_async_func_await_trampoline>(finalize_data);
@@ -1939,11 +2415,7 @@ napi_value node_loader_impl_async_func_reject(loader_impl_node node_impl, napi_e
 
 void node_loader_impl_func_await_safe(napi_env env, loader_impl_async_func_await_safe func_await_safe)
 {
-	static const char await_str[] = "await_function";
-	napi_value await_str_value;
-	napi_value function_table_object;
-	napi_value function_await;
-	bool result = false;
+	napi_value function_await = nullptr;
 	napi_value argv[3];
 	napi_handle_scope handle_scope;
 
@@ -1952,35 +2424,16 @@ void node_loader_impl_func_await_safe(napi_env env, loader_impl_async_func_await
 
 	node_loader_impl_exception(env, status);
 
-	/* Get function table object from reference */
-	status = napi_get_reference_value(env, func_await_safe->node_impl->function_table_object_ref, &function_table_object);
-
-	node_loader_impl_exception(env, status);
-
-	/* Retrieve resolve function from object table */
-	status = napi_create_string_utf8(env, await_str, sizeof(await_str) - 1, &await_str_value);
+	/* Get the await trampoline from the reference cached at register
+	time, avoiding the function table property lookup per call */
+	status = napi_get_reference_value(env, func_await_safe->node_impl->function_await_ref, &function_await);
 
 	node_loader_impl_exception(env, status);
 
-	status = napi_has_own_property(env, function_table_object, await_str_value, &result);
-
-	node_loader_impl_exception(env, status);
-
-	if (result == true)
 	{
-		napi_valuetype valuetype;
-
-		status = napi_get_named_property(env, function_table_object, await_str, &function_await);
-
-		node_loader_impl_exception(env, status);
-
-		status = napi_typeof(env, function_await, &valuetype);
-
-		node_loader_impl_exception(env, status);
-
-		if (valuetype != napi_function)
+		if (function_await == nullptr)
 		{
-			napi_throw_type_error(env, nullptr, "Invalid function test in function table object");
+			napi_throw_type_error(env, nullptr, "Invalid function await_function in function table object");
 		}
 		else
 		{
@@ -1995,8 +2448,6 @@ void node_loader_impl_func_await_safe(napi_env env, loader_impl_async_func_await
 				loader_impl_node_function node_func;
 				size_t args_count;
 				napi_value *func_argv;
-				signature s = function_signature(func_await_safe->func);
-				const size_t signature_args_size = signature_count(s);
 
 				/* Get function reference */
 				status = napi_get_reference_value(env, func_await_safe->node_func->func_ref, &argv[0]);
@@ -2020,8 +2471,30 @@ void node_loader_impl_func_await_safe(napi_env env, loader_impl_async_func_await
 				args = static_cast<value *>(func_await_safe->args);
 				node_func = func_await_safe->node_func;
 
-				/* Allocate dynamically more space for values in case of variable arguments */
-				func_argv = args_size > signature_args_size ? static_cast<napi_value *>(malloc(sizeof(napi_value) * args_size)) : node_func->argv;
+				/* Grow the pre-bound scratch array in case of variable arguments,
+				the grown capacity is kept by the function for later calls */
+				if (args_size > node_func->argv_size)
+				{
+					func_argv = static_cast<napi_value *>(realloc(node_func->argv, sizeof(napi_value) * args_size));
+
+					if (func_argv == NULL)
+					{
+						napi_throw_error(env, nullptr, "Invalid scratch array allocation in NodeJS loader function await");
+
+						free(trampoline);
+
+						status = napi_close_handle_scope(env, handle_scope);
+
+						node_loader_impl_exception(env, status);
+
+						return;
+					}
+
+					node_func->argv = func_argv;
+					node_func->argv_size = args_size;
+				}
+
+				func_argv = node_func->argv;
 
 				/* Build parameters */
 				for (args_count = 0; args_count < args_size; ++args_count)
@@ -2071,10 +2544,6 @@ void node_loader_impl_func_await_safe(napi_env env, loader_impl_async_func_await
 				/* Proccess the await return */
 				func_await_safe->ret = node_loader_impl_napi_to_value(func_await_safe->node_impl, env, func_await_safe->recv, await_return);
 
-				if (args_size > signature_args_size)
-				{
-					free(func_argv);
-				}
 			}
 		}
 	}
@@ -2177,11 +2646,7 @@ napi_value node_loader_impl_async_func_destroy_safe(napi_env env, napi_callback_
 
 void node_loader_impl_future_await_safe(napi_env env, loader_impl_async_future_await_safe future_await_safe)
 {
-	static const char await_str[] = "await_future";
-	napi_value await_str_value;
-	napi_value function_table_object;
-	napi_value future_await;
-	bool result = false;
+	napi_value future_await = nullptr;
 	napi_value argv[2];
 	napi_handle_scope handle_scope;
 
@@ -2190,33 +2655,14 @@ void node_loader_impl_future_await_safe(napi_env env, loader_impl_async_future_a
 
 	node_loader_impl_exception(env, status);
 
-	/* Get function table object from reference */
-	status = napi_get_reference_value(env, future_await_safe->node_impl->function_table_object_ref, &function_table_object);
-
-	node_loader_impl_exception(env, status);
-
-	/* Retrieve resolve function from object table */
-	status = napi_create_string_utf8(env, await_str, sizeof(await_str) - 1, &await_str_value);
+	/* Get the await trampoline from the reference cached at register
+	time, avoiding the function table property lookup per call */
+	status = napi_get_reference_value(env, future_await_safe->node_impl->future_await_ref, &future_await);
 
 	node_loader_impl_exception(env, status);
 
-	status = napi_has_own_property(env, function_table_object, await_str_value, &result);
-
-	node_loader_impl_exception(env, status);
-
-	if (result == true)
 	{
-		napi_valuetype valuetype;
-
-		status = napi_get_named_property(env, function_table_object, await_str, &future_await);
-
-		node_loader_impl_exception(env, status);
-
-		status = napi_typeof(env, future_await, &valuetype);
-
-		node_loader_impl_exception(env, status);
-
-		if (valuetype != napi_function)
+		if (future_await == nullptr)
 		{
 			napi_throw_type_error(env, nullptr, "Invalid function await_future in function table object");
 		}
@@ -3534,6 +3980,31 @@ void *node_loader_impl_register(void *node_impl_ptr, void *env_ptr, void *functi
 
 	node_loader_impl_exception(env, status);
 
+	/* Cache the trampoline functions used by the per call hot paths so
+	the call sites skip the function table property lookup */
+	{
+		static const char await_function_str[] = "await_function";
+		static const char await_future_str[] = "await_future";
+
+		napi_value function_await, future_await;
+
+		status = napi_get_named_property(env, function_table_object, await_function_str, &function_await);
+
+		node_loader_impl_exception(env, status);
+
+		status = napi_create_reference(env, function_await, 1, &node_impl->function_await_ref);
+
+		node_loader_impl_exception(env, status);
+
+		status = napi_get_named_property(env, function_table_object, await_future_str, &future_await);
+
+		node_loader_impl_exception(env, status);
+
+		status = napi_create_reference(env, future_await, 1, &node_impl->future_await_ref);
+
+		node_loader_impl_exception(env, status);
+	}
+
 	/* Initialize thread safe functions */
 	{
 		/* Safe initialize */
@@ -3627,6 +4098,21 @@ void *node_loader_impl_register(void *node_impl_ptr, void *env_ptr, void *functi
 				&node_impl->threadsafe_func_call);
 		}
 
+		/* Safe function call batch */
+		{
+			static const char threadsafe_func_name_str[] = "node_loader_impl_async_func_call_batch_safe";
+
+			node_loader_impl_thread_safe_function_initialize<loader_impl_async_func_call_batch_safe_type>(
+				env,
+				threadsafe_func_name_str, sizeof(threadsafe_func_name_str),
+				&node_loader_impl_async_func_call_batch_safe,
+				(loader_impl_async_func_call_batch_safe_type **)(&node_impl->func_call_batch_safe),
+				&node_impl->func_call_batch_safe_ptr,
+				&node_impl->threadsafe_func_call_batch);
+
+			node_impl->func_call_batch_safe->node_impl = node_impl;
+		}
+
 		/* Safe function await */
 		{
 			static const char threadsafe_func_name_str[] = "node_loader_impl_async_func_await_safe";
@@ -4027,6 +4513,51 @@ void node_loader_impl_thread_log(void *data)
 }
 #endif
 
+#if !defined(_WIN32)
+static int node_loader_impl_fork_prepare(void *data)
+{
+	loader_impl_node node_impl = static_cast<loader_impl_node>(data);
+
+	/* Quiesce the host to JS call paths so no call is in flight
+	while the process forks */
+	uv_mutex_lock(&node_impl->call_queue_mutex);
+	uv_mutex_lock(&node_impl->mutex);
+
+	return 0;
+}
+
+static int node_loader_impl_fork_parent(void *data)
+{
+	loader_impl_node node_impl = static_cast<loader_impl_node>(data);
+
+	/* Resume the call paths in the parent */
+	uv_mutex_unlock(&node_impl->mutex);
+	uv_mutex_unlock(&node_impl->call_queue_mutex);
+
+	return 0;
+}
+
+static int node_loader_impl_fork_child(void *data)
+{
+	loader_impl_node node_impl = static_cast<loader_impl_node>(data);
+	int result = 0;
+
+	/* Repair the event loop backend so the inherited NodeJS instance
+	can keep running in the child without a reboot */
+	if (node_impl->thread_loop != NULL && uv_loop_fork(node_impl->thread_loop) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid event loop fork in NodeJS loader");
+
+		result = 1;
+	}
+
+	uv_mutex_unlock(&node_impl->mutex);
+	uv_mutex_unlock(&node_impl->call_queue_mutex);
+
+	return result;
+}
+#endif
+
 loader_impl_data node_loader_impl_initialize(loader_impl impl, configuration config)
 {
 	loader_impl_node node_impl;
@@ -4124,6 +4655,17 @@ loader_impl_data node_loader_impl_initialize(loader_impl impl, configuration con
 		return NULL;
 	}
 
+	if (uv_mutex_init(&node_impl->call_queue_mutex) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid NodeJS call queue mutex creation");
+
+		/* TODO: Clear resources */
+
+		delete node_impl;
+
+		return NULL;
+	}
+
 	/* Initialize lock info */
 	node_impl->locked.store(false);
 
@@ -4150,6 +4692,20 @@ loader_impl_data node_loader_impl_initialize(loader_impl impl, configuration con
 	}
 #endif
 
+	/* Read the worker thread pool size (opt-in, zero keeps the single
+	event loop mode), the value is handed to the bootstrap at initialize */
+	node_impl->worker_pool_size = 0;
+
+	if (config != NULL)
+	{
+		value pool_size = configuration_value(config, "worker_pool_size");
+
+		if (pool_size != NULL && value_type_id(pool_size) == TYPE_INT && value_to_int(pool_size) > 0)
+		{
+			node_impl->worker_pool_size = value_to_int(pool_size);
+		}
+	}
+
 	struct loader_impl_thread_type thread_data = {
 		node_impl,
 		config
@@ -4259,6 +4815,15 @@ loader_impl_data node_loader_impl_initialize(loader_impl impl, configuration con
 	/* Register initialization */
 	loader_initialization_register(impl);
 
+#if !defined(_WIN32)
+	/* Register fork coordination so the fork detour keeps the NodeJS
+	instance alive across a fork instead of rebooting it */
+	if (loader_fork_register(&node_loader_impl_fork_prepare, &node_loader_impl_fork_parent, &node_loader_impl_fork_child, node_impl) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid fork coordination registration in NodeJS loader");
+	}
+#endif
+
 	return node_impl;
 }
 
@@ -4818,6 +5383,14 @@ void node_loader_impl_destroy_safe_impl(loader_impl_node node_impl, napi_env env
 				&node_impl->threadsafe_func_call);
 		}
 
+		/* Safe function call batch */
+		{
+			node_loader_impl_thread_safe_function_destroy<loader_impl_async_func_call_batch_safe_type>(
+				env,
+				(loader_impl_async_func_call_batch_safe_type **)(&node_impl->func_call_batch_safe),
+				&node_impl->threadsafe_func_call_batch);
+		}
+
 		/* Safe function await */
 		{
 			node_loader_impl_thread_safe_function_destroy<loader_impl_async_func_await_safe_type>(
@@ -4873,6 +5446,14 @@ void node_loader_impl_destroy_safe_impl(loader_impl_node node_impl, napi_env env
 
 	node_loader_impl_exception(env, status);
 
+	status = napi_delete_reference(env, node_impl->function_await_ref);
+
+	node_loader_impl_exception(env, status);
+
+	status = napi_delete_reference(env, node_impl->future_await_ref);
+
+	node_loader_impl_exception(env, status);
+
 	status = napi_reference_unref(env, node_impl->function_table_object_ref, &ref_count);
 
 	node_loader_impl_exception(env, status);
@@ -4986,6 +5567,11 @@ int node_loader_impl_destroy(loader_impl impl)
 		return 1;
 	}
 
+#if !defined(_WIN32)
+	/* The runtime is going away, stop coordinating with the fork detour */
+	loader_fork_unregister(node_impl);
+#endif
+
 	/* Call destroy function with thread safe */
 	node_loader_impl_try_destroy(node_impl);
 
@@ -4998,6 +5584,9 @@ int node_loader_impl_destroy(loader_impl impl)
 	/* Clear mutex syncronization object */
 	uv_mutex_destroy(&node_impl->mutex);
 
+	/* Clear call queue syncronization object */
+	uv_mutex_destroy(&node_impl->call_queue_mutex);
+
 #ifdef __ANDROID__
 	/* Close file descriptors */
 	close(node_impl->pfd[0]);
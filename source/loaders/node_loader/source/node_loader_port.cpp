@@ -104,6 +104,130 @@ napi_value node_loader_port_call(napi_env env, napi_callback_info info)
 	return result;
 }
 
+/* Resolves a function by name once and hands the pointer back as an
+external, so repeated calls through the stub skip the name marshalling
+and the by-name lookup of the core */
+napi_value node_loader_port_function(napi_env env, napi_callback_info info)
+{
+	size_t argc = 1;
+
+	napi_value argv[1];
+
+	napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+
+	if (argc != 1)
+	{
+		napi_throw_error(env, NULL, "Invalid number of arguments");
+
+		return nullptr;
+	}
+
+	size_t name_length;
+
+	napi_status status = napi_get_value_string_utf8(env, argv[0], NULL, 0, &name_length);
+
+	char *name = new char[name_length + 1];
+
+	if (name == nullptr)
+	{
+		napi_throw_error(env, NULL, "Invalid function name allocation");
+
+		return nullptr;
+	}
+
+	status = napi_get_value_string_utf8(env, argv[0], name, name_length + 1, &name_length);
+
+	name[name_length] = '\0';
+
+	node_loader_impl_exception(env, status);
+
+	void *func = metacall_function(name);
+
+	delete[] name;
+
+	napi_value result;
+
+	if (func == NULL)
+	{
+		status = napi_get_null(env, &result);
+
+		node_loader_impl_exception(env, status);
+
+		return result;
+	}
+
+	status = napi_create_external(env, func, nullptr, nullptr, &result);
+
+	node_loader_impl_exception(env, status);
+
+	return result;
+}
+
+/* Invokes a function through the external stub created by
+node_loader_port_function instead of resolving it by name */
+napi_value node_loader_port_function_invoke(napi_env env, napi_callback_info info)
+{
+	size_t argc = 0;
+
+	napi_get_cb_info(env, info, &argc, NULL, NULL, NULL);
+
+	if (argc == 0)
+	{
+		napi_throw_error(env, NULL, "Invalid number of arguments");
+
+		return nullptr;
+	}
+
+	napi_value *argv = new napi_value[argc];
+	void **args = new void *[argc - 1];
+	napi_value recv;
+
+	napi_get_cb_info(env, info, &argc, argv, &recv, NULL);
+
+	void *func = NULL;
+
+	napi_status status = napi_get_value_external(env, argv[0], &func);
+
+	if (status != napi_ok || func == NULL)
+	{
+		napi_throw_error(env, NULL, "Invalid function stub");
+
+		delete[] argv;
+		delete[] args;
+
+		return nullptr;
+	}
+
+	/* Obtain NodeJS loader implementation */
+	loader_impl impl = loader_get_impl("node");
+	loader_impl_node node_impl = (loader_impl_node)loader_impl_get(impl);
+
+	/* Store current reference of the environment */
+	node_loader_impl_env(node_impl, env);
+
+	for (size_t args_count = 1; args_count < argc; ++args_count)
+	{
+		args[args_count - 1] = node_loader_impl_napi_to_value(node_impl, env, recv, argv[args_count]);
+	}
+
+	/* Call to the function */
+	void *ret = metacallfv_s(func, args, argc - 1);
+
+	napi_value result = node_loader_impl_value_to_napi(node_impl, env, ret);
+
+	for (size_t args_count = 0; args_count < argc - 1; ++args_count)
+	{
+		metacall_value_destroy(args[args_count]);
+	}
+
+	metacall_value_destroy(ret);
+
+	delete[] argv;
+	delete[] args;
+
+	return result;
+}
+
 napi_value node_loader_port_load_from_file(napi_env env, napi_callback_info info)
 {
 	/* TODO: Detect if input argument types are valid */
@@ -498,6 +622,8 @@ napi_value node_loader_port_logs(napi_env env, napi_callback_info)
 void node_loader_port_exports(napi_env env, napi_value exports)
 {
 	const char function_metacall_str[] = "metacall";
+	const char function_function_str[] = "metacall_function";
+	const char function_function_invoke_str[] = "metacall_function_invoke";
 	const char function_load_from_file_str[] = "metacall_load_from_file";
 	const char function_load_from_file_export_str[] = "metacall_load_from_file_export";
 	const char function_load_from_memory_str[] = "metacall_load_from_memory";
@@ -505,9 +631,11 @@ void node_loader_port_exports(napi_env env, napi_value exports)
 	const char function_inspect_str[] = "metacall_inspect";
 	const char function_logs_str[] = "metacall_logs";
 
-	napi_value function_metacall, function_load_from_file, function_load_from_file_export, function_load_from_memory, function_load_from_memory_export, function_inspect, function_logs;
+	napi_value function_metacall, function_function, function_function_invoke, function_load_from_file, function_load_from_file_export, function_load_from_memory, function_load_from_memory_export, function_inspect, function_logs;
 
 	napi_create_function(env, function_metacall_str, sizeof(function_metacall_str) - 1, node_loader_port_call, NULL, &function_metacall);
+	napi_create_function(env, function_function_str, sizeof(function_function_str) - 1, node_loader_port_function, NULL, &function_function);
+	napi_create_function(env, function_function_invoke_str, sizeof(function_function_invoke_str) - 1, node_loader_port_function_invoke, NULL, &function_function_invoke);
 	napi_create_function(env, function_load_from_file_str, sizeof(function_load_from_file_str) - 1, node_loader_port_load_from_file, NULL, &function_load_from_file);
 	napi_create_function(env, function_load_from_file_export_str, sizeof(function_load_from_file_export_str) - 1, node_loader_port_load_from_file_export, NULL, &function_load_from_file_export);
 	napi_create_function(env, function_load_from_memory_str, sizeof(function_load_from_memory_str) - 1, node_loader_port_load_from_memory, NULL, &function_load_from_memory);
@@ -516,6 +644,8 @@ void node_loader_port_exports(napi_env env, napi_value exports)
 	napi_create_function(env, function_logs_str, sizeof(function_logs_str) - 1, node_loader_port_logs, NULL, &function_logs);
 
 	napi_set_named_property(env, exports, function_metacall_str, function_metacall);
+	napi_set_named_property(env, exports, function_function_str, function_function);
+	napi_set_named_property(env, exports, function_function_invoke_str, function_function_invoke);
 	napi_set_named_property(env, exports, function_load_from_file_str, function_load_from_file);
 	napi_set_named_property(env, exports, function_load_from_file_export_str, function_load_from_file_export);
 	napi_set_named_property(env, exports, function_load_from_memory_str, function_load_from_memory);
@@ -28,28 +28,62 @@
 #include <reflect/reflect_context.h>
 #include <reflect/reflect_function.h>
 #include <reflect/reflect_scope.h>
+#include <reflect/reflect_stream.h>
 #include <reflect/reflect_type.h>
+#include <reflect/reflect_value_type_id_size.h>
 
 #include <log/log.h>
 
+#include <environment/environment_variable.h>
+
+#include <portability/portability_probe.h>
+
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <Python.h>
 
+#include <marshal.h>
+
 #define PY_LOADER_IMPL_FUNCTION_TYPE_INVOKE_FUNC "__py_loader_impl_function_type_invoke__"
+
+/* Strings of at least this many bytes are borrowed from the unicode
+object instead of copied, keeping the object alive through the value
+finalizer; below it a copy is cheaper than retaining the object */
+#define PY_LOADER_IMPL_STRING_VIEW_THRESHOLD 0x400
 #if (!defined(NDEBUG) || defined(DEBUG) || defined(_DEBUG) || defined(__DEBUG) || defined(__DEBUG__))
 	#define DEBUG_ENABLED 1
 #else
 	#define DEBUG_ENABLED 0
 #endif
 
+/* Per-interpreter GIL support is required for the pool to scale,
+older interpreters keep the single interpreter behavior */
+#if PY_VERSION_HEX >= 0x030C0000
+	#define PY_LOADER_SUBINTERP_POOL 1
+#endif
+
+/* Direct converter compiled into the per parameter conversion plan,
+resolved once from the signature type instead of re-deriving the
+conversion from a type switch on every call */
+typedef PyObject *(*loader_impl_py_converter)(loader_impl impl, value v);
+
 typedef struct loader_impl_py_function_type
 {
 	PyObject *func;
 	// Cache and re-use the values array
 	PyObject **values;
+	// Conversion plan, one direct converter per typed parameter (null entries fall back to the type switch)
+	loader_impl_py_converter *converters;
 	loader_impl impl;
+#if defined(PY_LOADER_SUBINTERP_POOL)
+	// Import coordinates so the function can be resolved again inside a subinterpreter
+	char *module_name;
+	char *qualname;
+#endif
 } * loader_impl_py_function;
 
 typedef struct loader_impl_py_class_type
@@ -67,6 +101,13 @@ typedef struct loader_impl_py_object_type
 
 } * loader_impl_py_object;
 
+typedef struct loader_impl_py_stream_type
+{
+	PyObject *iterator;
+	loader_impl impl;
+
+} * loader_impl_py_stream;
+
 typedef struct loader_impl_py_handle_module_type
 {
 	PyObject *instance;
@@ -81,6 +122,17 @@ typedef struct loader_impl_py_handle_type
 
 } * loader_impl_py_handle;
 
+#if defined(PY_LOADER_SUBINTERP_POOL)
+typedef struct loader_impl_py_interp_type
+{
+	PyInterpreterState *interp;
+	PyThreadState *tstate; /* Creation thread state, kept for Py_EndInterpreter */
+	int busy;
+	int prepared; /* Execution paths already replicated into sys.path */
+
+} * loader_impl_py_interp;
+#endif
+
 struct loader_impl_py_type
 {
 	PyObject *inspect_module;
@@ -97,6 +149,14 @@ struct loader_impl_py_type
 	PyObject *gc_debug_leak;
 	PyObject *gc_debug_stats;
 #endif
+
+#if defined(PY_LOADER_SUBINTERP_POOL)
+	struct loader_impl_py_interp_type *pool;
+	size_t pool_size;
+	PyThread_type_lock pool_lock;
+	char **pool_paths; /* Execution paths to replicate into each subinterpreter */
+	size_t pool_paths_size;
+#endif
 };
 
 typedef struct loader_impl_py_function_type_invoke_state_type
@@ -109,6 +169,22 @@ typedef struct loader_impl_py_function_type_invoke_state_type
 
 static void py_loader_impl_error_print(loader_impl_py py_impl);
 
+#if defined(PY_LOADER_SUBINTERP_POOL)
+static char *py_loader_impl_str_copy(const char *str);
+
+static int py_loader_impl_pool_initialize(loader_impl_py py_impl, configuration config);
+
+static void py_loader_impl_pool_destroy(loader_impl_py py_impl);
+
+static int py_loader_impl_pool_path(loader_impl_py py_impl, const loader_naming_path path);
+
+static int py_loader_impl_pool_invoke(function func, loader_impl_py_function py_func, loader_impl_py py_impl, function_args args, size_t args_size, function_return *ret);
+#endif
+
+#if PY_MAJOR_VERSION == 3
+static void py_loader_impl_typed_array_finalizer(value v, void *data);
+#endif
+
 #if DEBUG_ENABLED
 static void py_loader_impl_gc_print(loader_impl_py py_impl);
 #endif
@@ -125,6 +201,8 @@ static object_interface py_object_interface_singleton(void);
 
 static class_interface py_class_interface_singleton(void);
 
+static stream_interface py_stream_interface_singleton(void);
+
 static int py_loader_impl_discover_func_args_count(PyObject *func);
 
 static int py_loader_impl_discover_func(loader_impl impl, PyObject *func, function f);
@@ -133,6 +211,8 @@ static int py_loader_impl_discover_class(loader_impl impl, PyObject *read_only_d
 
 static void py_loader_impl_value_invoke_state_finalize(value v, void *data);
 
+static void py_loader_impl_function_bridge_finalize(function func, void *bridge);
+
 static void py_loader_impl_value_ptr_finalize(value v, void *data);
 
 static int py_loader_impl_finalize(loader_impl_py py_impl);
@@ -156,11 +236,24 @@ void py_loader_impl_value_invoke_state_finalize(value v, void *data)
 	free(invoke_state);
 }
 
+void py_loader_impl_function_bridge_finalize(function func, void *bridge)
+{
+	PyGILState_STATE gstate = PyGILState_Ensure();
+
+	(void)func;
+
+	Py_DECREF((PyObject *)bridge);
+
+	PyGILState_Release(gstate);
+}
+
 void py_loader_impl_value_ptr_finalize(value v, void *data)
 {
 	type_id id = value_type_id(v);
 
-	if (id == TYPE_PTR)
+	/* Buffer and string views borrow the storage of a Python object,
+	releasing the value drops the reference that kept it alive */
+	if (id == TYPE_PTR || id == TYPE_BUFFER || id == TYPE_STRING)
 	{
 		if (data != NULL)
 		{
@@ -197,274 +290,886 @@ type_interface type_py_singleton(void)
 	return &py_type_interface;
 }
 
-int function_py_interface_create(function func, function_impl impl)
-{
-	loader_impl_py_function py_func = (loader_impl_py_function)impl;
+/* -- Conversion Plan -- */
 
-	signature s = function_signature(func);
+static PyObject *py_loader_impl_converter_bool(loader_impl impl, value v)
+{
+	(void)impl;
 
-	const size_t args_size = signature_count(s);
+	return PyBool_FromLong(value_to_bool(v) == 0 ? 0L : 1L);
+}
 
-	if (args_size > 0)
-	{
-		py_func->values = malloc(sizeof(PyObject *) * args_size);
+static PyObject *py_loader_impl_converter_char(loader_impl impl, value v)
+{
+	(void)impl;
 
-		if (py_func->values == NULL)
-		{
-			return 1;
-		}
+	return PyLong_FromLong((long)value_to_char(v));
+}
 
-		for (size_t iterator = 0; iterator < args_size; ++iterator)
-		{
-			py_func->values[iterator] = NULL;
-		}
-	}
-	else
-	{
-		py_func->values = NULL;
-	}
+static PyObject *py_loader_impl_converter_short(loader_impl impl, value v)
+{
+	(void)impl;
 
-	return 0;
+	return PyLong_FromLong((long)value_to_short(v));
 }
 
-int py_object_interface_create(object obj, object_impl impl)
+static PyObject *py_loader_impl_converter_int(loader_impl impl, value v)
 {
-	(void)obj;
+	(void)impl;
 
-	loader_impl_py_object py_obj = impl;
+#if PY_MAJOR_VERSION == 2
+	return PyInt_FromLong(value_to_int(v));
+#elif PY_MAJOR_VERSION == 3
+	return PyLong_FromLong((long)value_to_int(v));
+#endif
+}
 
-	py_obj->object = NULL;
-	py_obj->object_class = NULL;
+static PyObject *py_loader_impl_converter_long(loader_impl impl, value v)
+{
+	(void)impl;
 
-	return 0;
+	return PyLong_FromLong(value_to_long(v));
 }
 
-/* TODO: get and set is actually the same as static_get and static_set but applied to an object instead of a class */
-value py_object_interface_get(object obj, object_impl impl, const char *key)
+static PyObject *py_loader_impl_converter_float(loader_impl impl, value v)
 {
-	(void)obj;
-
-	loader_impl_py_object py_object = (loader_impl_py_object)impl;
+	(void)impl;
 
-	PyObject *pyobject_object = py_object->object;
+	return PyFloat_FromDouble((double)value_to_float(v));
+}
 
-	PyObject *key_py_str = PyUnicode_FromString(key);
-	PyObject *generic_attr = PyObject_GenericGetAttr(pyobject_object, key_py_str);
-	Py_DECREF(key_py_str);
+static PyObject *py_loader_impl_converter_double(loader_impl impl, value v)
+{
+	(void)impl;
 
-	return py_loader_impl_capi_to_value(impl, generic_attr, py_loader_impl_capi_to_value_type(generic_attr));
+	return PyFloat_FromDouble(value_to_double(v));
 }
 
-int py_object_interface_set(object obj, object_impl impl, const char *key, value v)
-{
-	(void)obj;
+/* Bounded direct mapped cache of interned Python strings, the same few
+short keys dominate map payloads so repeated conversions reuse one
+object with a reference count bump instead of allocating a fresh
+unicode object; interned keys also hash faster in PyDict_SetItem. All
+mutations run under the GIL so the table needs no extra locking */
+#define PY_LOADER_IMPL_STRING_CACHE_SIZE   0x200
+#define PY_LOADER_IMPL_STRING_CACHE_LENGTH 0x40
 
-	loader_impl_py_object py_object = (loader_impl_py_object)impl;
+#define PY_LOADER_IMPL_CODE_CACHE_PATH_SIZE 0x400
 
-	PyObject *pyobject_object = py_object->object;
+struct py_loader_impl_string_cache_entry_type
+{
+	char key[PY_LOADER_IMPL_STRING_CACHE_LENGTH];
+	PyObject *obj;
+};
 
-	PyObject *key_py_str = PyUnicode_FromString(key);
+static struct py_loader_impl_string_cache_entry_type py_loader_impl_string_cache[PY_LOADER_IMPL_STRING_CACHE_SIZE];
 
-	PyObject *pyvalue = py_loader_impl_value_to_capi(py_object->impl, value_type_id(v), v);
+static PyObject *py_loader_impl_string_from(const char *str)
+{
+#if PY_MAJOR_VERSION == 2
+	return PyString_FromString(str);
+#elif PY_MAJOR_VERSION == 3
+	size_t length = strlen(str);
 
-	int retval = PyObject_GenericSetAttr(pyobject_object, key_py_str, pyvalue);
+	size_t hash = (size_t)0x811C9DC5;
 
-	Py_DECREF(key_py_str);
+	size_t iterator;
 
-	return retval;
-}
+	struct py_loader_impl_string_cache_entry_type *entry;
 
-value py_object_interface_method_invoke(object obj, object_impl impl, const char *method_name, object_args args, size_t argc)
-{
-	(void)obj;
+	PyObject *obj;
 
-	loader_impl_py_object obj_impl = (loader_impl_py_object)impl;
+	/* Long or empty strings bypass the cache, they are unlikely to be
+	repeated keys and would monopolize the slots */
+	if (length == 0 || length >= PY_LOADER_IMPL_STRING_CACHE_LENGTH)
+	{
+		return PyUnicode_FromString(str);
+	}
 
-	if (obj_impl == NULL || obj_impl->object == NULL)
+	for (iterator = 0; iterator < length; ++iterator)
 	{
-		return NULL;
+		hash = (hash ^ (size_t)(unsigned char)str[iterator]) * (size_t)0x01000193;
 	}
 
-	PyObject *method = PyObject_GetAttrString(obj_impl->object, method_name);
+	entry = &py_loader_impl_string_cache[hash & (PY_LOADER_IMPL_STRING_CACHE_SIZE - 1)];
 
-	if (method == NULL)
+	if (entry->obj != NULL && strcmp(entry->key, str) == 0)
 	{
-		return NULL;
+		Py_INCREF(entry->obj);
+
+		return entry->obj;
 	}
 
-	PyObject *args_tuple = PyTuple_New(argc);
+	obj = PyUnicode_InternFromString(str);
 
-	if (args_tuple == NULL)
+	if (obj == NULL)
 	{
 		return NULL;
 	}
 
-	for (size_t i = 0; i < argc; i++)
+	/* Direct mapped eviction keeps the cache bounded, the colliding
+	entry simply gives up its slot */
+	if (entry->obj != NULL)
 	{
-		PyTuple_SET_ITEM(args_tuple, i, py_loader_impl_value_to_capi(obj_impl->impl, value_type_id(args[i]), args[i]));
+		Py_DECREF(entry->obj);
 	}
 
-	PyObject *python_object = PyObject_Call(method, args_tuple, NULL);
+	memcpy(entry->key, str, length + 1);
 
-	Py_DECREF(args_tuple);
-	Py_DECREF(method);
+	entry->obj = obj;
 
-	if (python_object == NULL)
-	{
-		return NULL;
-	}
+	Py_INCREF(obj);
 
-	return py_loader_impl_capi_to_value(impl, python_object, py_loader_impl_capi_to_value_type(python_object));
+	return obj;
+#endif
 }
 
-value py_object_interface_method_await(object obj, object_impl impl, const char *key, object_args args, size_t size, object_resolve_callback resolve, object_reject_callback reject, void *ctx)
+static void py_loader_impl_string_cache_clear(void)
 {
-	// TODO
-	(void)obj;
-	(void)impl;
-	(void)key;
-	(void)args;
-	(void)size;
-	(void)resolve;
-	(void)reject;
-	(void)ctx;
-
-	return NULL;
-}
+	size_t iterator;
 
-int py_object_interface_destructor(object obj, object_impl impl)
-{
-	(void)obj;
-	(void)impl;
+	for (iterator = 0; iterator < PY_LOADER_IMPL_STRING_CACHE_SIZE; ++iterator)
+	{
+		struct py_loader_impl_string_cache_entry_type *entry = &py_loader_impl_string_cache[iterator];
 
-	/* Python destructors are automatically called when ref count is zero and GC happens */
+		if (entry->obj != NULL)
+		{
+			Py_DECREF(entry->obj);
 
-	return 0;
+			entry->obj = NULL;
+			entry->key[0] = '\0';
+		}
+	}
 }
 
-void py_object_interface_destroy(object obj, object_impl impl)
+/* In-process cache of compiled code objects keyed by the hash of the
+source buffer, so repeated loads of identical memory snippets skip
+Py_CompileString and cost a hash plus a dict hit. An optional on-disk
+layer replaces the __pycache__ that in-memory snippets never get; it
+stays disabled unless PY_LOADER_CODE_CACHE_PATH points to a writable
+directory */
+static PyObject *py_loader_impl_code_cache = NULL;
+
+static uint64_t py_loader_impl_code_cache_hash(const char *buffer)
 {
-	(void)obj;
+	uint64_t hash = 0xCBF29CE484222325ULL;
 
-	loader_impl_py_object py_object = (loader_impl_py_object)impl;
+	size_t iterator;
 
-	if (py_object != NULL)
+	for (iterator = 0; buffer[iterator] != '\0'; ++iterator)
 	{
-		Py_XDECREF(py_object->object);
-
-		Py_XDECREF(py_object->object_class);
-
-		free(py_object);
+		hash = (hash ^ (uint64_t)(unsigned char)buffer[iterator]) * 0x00000100000001B3ULL;
 	}
+
+	return hash;
 }
 
-object_interface py_object_interface_singleton(void)
+static const char *py_loader_impl_code_cache_dir(void)
 {
-	static struct object_interface_type py_object_interface = {
-		&py_object_interface_create,
-		&py_object_interface_get,
-		&py_object_interface_set,
-		&py_object_interface_method_invoke,
-		&py_object_interface_method_await,
-		&py_object_interface_destructor,
-		&py_object_interface_destroy
-	};
-
-	return &py_object_interface;
+	return environment_variable_get("PY_LOADER_CODE_CACHE_PATH", NULL);
 }
 
-int py_class_interface_create(klass cls, class_impl impl)
+static void py_loader_impl_code_cache_file(char *path, size_t size, const char *dir, uint64_t hash)
 {
-	(void)cls;
-
-	loader_impl_py_class py_cls = impl;
-
-	py_cls->class = NULL;
-
-	return 0;
+	/* The interpreter version tags the file name so bytecode marshalled
+	by another Python silently misses instead of failing to load */
+	snprintf(path, size, "%s/%08lx_%016llx.pyc", dir, (unsigned long)PY_VERSION_HEX, (unsigned long long)hash);
 }
 
-object py_class_interface_constructor(klass cls, class_impl impl, const char *name, class_args args, size_t argc)
+static PyObject *py_loader_impl_code_cache_disk_read(uint64_t hash)
 {
-	(void)cls;
+	const char *dir = py_loader_impl_code_cache_dir();
 
-	loader_impl_py_class py_cls = impl;
+	char path[PY_LOADER_IMPL_CODE_CACHE_PATH_SIZE];
 
-	loader_impl_py_object py_obj = malloc(sizeof(struct loader_impl_py_object_type));
+	FILE *file;
 
-	object obj = object_create(name, py_obj, &py_object_interface_singleton, cls);
+	long size;
 
-	if (obj == NULL)
+	char *data;
+
+	PyObject *code = NULL;
+
+	if (dir == NULL)
 	{
 		return NULL;
 	}
 
-	/* Get loader implementation from class */
-	py_obj->impl = py_cls->impl;
+	py_loader_impl_code_cache_file(path, sizeof(path), dir, hash);
 
-	PyObject *args_tuple = PyTuple_New(argc);
+	file = fopen(path, "rb");
 
-	if (args_tuple == NULL)
+	if (file == NULL)
+	{
 		return NULL;
+	}
 
-	for (size_t i = 0; i < argc; i++)
+	if (fseek(file, 0, SEEK_END) != 0 || (size = ftell(file)) <= 0 || fseek(file, 0, SEEK_SET) != 0)
 	{
-		PyTuple_SET_ITEM(args_tuple, i, py_loader_impl_value_to_capi(py_cls->impl, value_type_id(args[i]), args[i]));
+		fclose(file);
+		return NULL;
 	}
 
-	/* Calling the class will create an instance (object) */
-	PyObject *python_object = PyObject_CallObject(py_cls->class, args_tuple);
-
-	Py_DECREF(args_tuple);
+	data = malloc((size_t)size);
 
-	if (python_object == NULL)
+	if (data == NULL)
 	{
-		object_destroy(obj);
+		fclose(file);
 		return NULL;
 	}
 
-	Py_INCREF(py_cls->class);
-	py_obj->object = python_object;
-	py_obj->object_class = Py_TYPE(py_cls->class);
+	if (fread(data, 1, (size_t)size, file) == (size_t)size)
+	{
+		code = PyMarshal_ReadObjectFromString(data, (Py_ssize_t)size);
 
-	return obj;
+		/* A truncated or corrupted file deserializes into garbage or
+		raises, either way the compile path takes over */
+		if (code != NULL && PyCode_Check(code) == 0)
+		{
+			Py_DECREF(code);
+			code = NULL;
+		}
+
+		if (code == NULL)
+		{
+			PyErr_Clear();
+		}
+	}
+
+	free(data);
+	fclose(file);
+
+	return code;
 }
 
-value py_class_interface_static_get(klass cls, class_impl impl, const char *key)
+static void py_loader_impl_code_cache_disk_write(uint64_t hash, PyObject *code)
 {
-	(void)cls;
-
-	loader_impl_py_class py_class = (loader_impl_py_class)impl;
+	const char *dir = py_loader_impl_code_cache_dir();
 
-	PyObject *pyobject_class = py_class->class;
+	char path[PY_LOADER_IMPL_CODE_CACHE_PATH_SIZE];
 
-	PyObject *key_py_str = PyUnicode_FromString(key);
-	PyObject *generic_attr = PyObject_GenericGetAttr(pyobject_class, key_py_str);
-	Py_DECREF(key_py_str);
+	FILE *file;
 
-	return py_loader_impl_capi_to_value(impl, generic_attr, py_loader_impl_capi_to_value_type(generic_attr));
-}
+	PyObject *bytes;
 
-int py_class_interface_static_set(klass cls, class_impl impl, const char *key, value v)
-{
-	(void)cls;
+	if (dir == NULL)
+	{
+		return;
+	}
 
-	loader_impl_py_class py_class = (loader_impl_py_class)impl;
+	bytes = PyMarshal_WriteObjectToString(code, Py_MARSHAL_VERSION);
 
-	PyObject *pyobject_class = py_class->class;
+	if (bytes == NULL)
+	{
+		PyErr_Clear();
+		return;
+	}
 
-	PyObject *pyvalue = py_loader_impl_value_to_capi(py_class->impl, value_type_id(v), v);
+	py_loader_impl_code_cache_file(path, sizeof(path), dir, hash);
 
-	PyObject *key_py_str = PyUnicode_FromString(key);
+	file = fopen(path, "wb");
 
-	int retval = PyObject_GenericSetAttr(pyobject_class, key_py_str, pyvalue);
+	if (file != NULL)
+	{
+		if (fwrite(PyBytes_AS_STRING(bytes), 1, (size_t)PyBytes_GET_SIZE(bytes), file) != (size_t)PyBytes_GET_SIZE(bytes))
+		{
+			log_write("metacall", LOG_LEVEL_DEBUG, "Invalid write into Python code cache file %s", path);
+		}
 
-	Py_DECREF(key_py_str);
+		fclose(file);
+	}
 
-	return retval;
+	Py_DECREF(bytes);
 }
 
-value py_class_interface_static_invoke(klass cls, class_impl impl, const char *static_method_name, class_args args, size_t argc)
+static PyObject *py_loader_impl_code_cache_get(uint64_t hash)
+{
+	PyObject *key, *code;
+
+	if (py_loader_impl_code_cache == NULL)
+	{
+		py_loader_impl_code_cache = PyDict_New();
+
+		if (py_loader_impl_code_cache == NULL)
+		{
+			PyErr_Clear();
+			return NULL;
+		}
+	}
+
+	key = PyLong_FromUnsignedLongLong(hash);
+
+	if (key == NULL)
+	{
+		PyErr_Clear();
+		return NULL;
+	}
+
+	code = PyDict_GetItem(py_loader_impl_code_cache, key);
+
+	if (code != NULL)
+	{
+		Py_INCREF(code);
+		Py_DECREF(key);
+		return code;
+	}
+
+	code = py_loader_impl_code_cache_disk_read(hash);
+
+	if (code != NULL && PyDict_SetItem(py_loader_impl_code_cache, key, code) != 0)
+	{
+		PyErr_Clear();
+	}
+
+	Py_DECREF(key);
+
+	return code;
+}
+
+static void py_loader_impl_code_cache_put(uint64_t hash, PyObject *code)
+{
+	PyObject *key;
+
+	if (py_loader_impl_code_cache == NULL)
+	{
+		return;
+	}
+
+	key = PyLong_FromUnsignedLongLong(hash);
+
+	if (key == NULL)
+	{
+		PyErr_Clear();
+		return;
+	}
+
+	if (PyDict_SetItem(py_loader_impl_code_cache, key, code) != 0)
+	{
+		PyErr_Clear();
+	}
+
+	Py_DECREF(key);
+
+	py_loader_impl_code_cache_disk_write(hash, code);
+}
+
+static void py_loader_impl_code_cache_clear(void)
+{
+	Py_CLEAR(py_loader_impl_code_cache);
+}
+
+static PyObject *py_loader_impl_converter_string(loader_impl impl, value v)
+{
+	(void)impl;
+
+	return py_loader_impl_string_from(value_to_string(v));
+}
+
+/**
+*  @brief
+*    Resolve the direct converter of a parameter type, types whose
+*    conversion depends on the runtime value (composites, functions,
+*    objects) stay on the type switch and resolve to null
+*
+*  @param[in] id
+*    Declared type of the parameter
+*
+*  @return
+*    Converter function, null when the type has no direct converter
+*/
+static loader_impl_py_converter py_loader_impl_converter_resolve(type_id id)
+{
+	switch (id)
+	{
+		case TYPE_BOOL:
+			return &py_loader_impl_converter_bool;
+		case TYPE_CHAR:
+			return &py_loader_impl_converter_char;
+		case TYPE_SHORT:
+			return &py_loader_impl_converter_short;
+		case TYPE_INT:
+			return &py_loader_impl_converter_int;
+		case TYPE_LONG:
+			return &py_loader_impl_converter_long;
+		case TYPE_FLOAT:
+			return &py_loader_impl_converter_float;
+		case TYPE_DOUBLE:
+			return &py_loader_impl_converter_double;
+		case TYPE_STRING:
+			return &py_loader_impl_converter_string;
+		default:
+			return NULL;
+	}
+}
+
+int function_py_interface_create(function func, function_impl impl)
+{
+	loader_impl_py_function py_func = (loader_impl_py_function)impl;
+
+	signature s = function_signature(func);
+
+	const size_t args_size = signature_count(s);
+
+	py_func->converters = NULL;
+
+#if defined(PY_LOADER_SUBINTERP_POOL)
+	{
+		loader_impl_py py_impl = loader_impl_get(py_func->impl);
+
+		py_func->module_name = NULL;
+		py_func->qualname = NULL;
+
+		/* Remember where the function can be imported from so the
+		pool can resolve a twin of it inside a subinterpreter */
+		if (py_impl != NULL && py_impl->pool_size > 0)
+		{
+			PyGILState_STATE gstate = PyGILState_Ensure();
+
+			PyObject *module_name = PyObject_GetAttrString(py_func->func, "__module__");
+			PyObject *qualname = PyObject_GetAttrString(py_func->func, "__qualname__");
+
+			if (module_name != NULL && qualname != NULL && PyUnicode_Check(module_name) && PyUnicode_Check(qualname))
+			{
+				const char *module_name_str = PyUnicode_AsUTF8(module_name);
+				const char *qualname_str = PyUnicode_AsUTF8(qualname);
+
+				/* Nested definitions cannot be reached by attribute walk */
+				if (module_name_str != NULL && qualname_str != NULL && strchr(qualname_str, '<') == NULL)
+				{
+					py_func->module_name = py_loader_impl_str_copy(module_name_str);
+					py_func->qualname = py_loader_impl_str_copy(qualname_str);
+				}
+			}
+
+			PyErr_Clear();
+
+			Py_XDECREF(module_name);
+			Py_XDECREF(qualname);
+
+			PyGILState_Release(gstate);
+		}
+	}
+#endif
+
+	if (args_size > 0)
+	{
+		py_func->values = malloc(sizeof(PyObject *) * args_size);
+
+		if (py_func->values == NULL)
+		{
+			return 1;
+		}
+
+		for (size_t iterator = 0; iterator < args_size; ++iterator)
+		{
+			py_func->values[iterator] = NULL;
+		}
+
+		/* Compile the conversion plan from the signature, it is fixed at
+		discovery so the per argument dispatch is resolved once here and
+		the call path runs a flat loop of direct converters; allocation
+		failure is non fatal, the call path falls back to the type switch */
+		py_func->converters = malloc(sizeof(loader_impl_py_converter) * args_size);
+
+		if (py_func->converters != NULL)
+		{
+			size_t compiled = 0;
+
+			for (size_t iterator = 0; iterator < args_size; ++iterator)
+			{
+				type t = signature_get_type(s, iterator);
+
+				py_func->converters[iterator] = t != NULL ? py_loader_impl_converter_resolve(type_index(t)) : NULL;
+
+				if (py_func->converters[iterator] != NULL)
+				{
+					++compiled;
+				}
+			}
+
+			/* A plan without a single direct converter is dead weight */
+			if (compiled == 0)
+			{
+				free(py_func->converters);
+
+				py_func->converters = NULL;
+			}
+		}
+	}
+	else
+	{
+		py_func->values = NULL;
+	}
+
+	return 0;
+}
+
+int py_object_interface_create(object obj, object_impl impl)
+{
+	(void)obj;
+
+	loader_impl_py_object py_obj = impl;
+
+	py_obj->object = NULL;
+	py_obj->object_class = NULL;
+
+	return 0;
+}
+
+/* TODO: get and set is actually the same as static_get and static_set but applied to an object instead of a class */
+value py_object_interface_get(object obj, object_impl impl, const char *key)
+{
+	(void)obj;
+
+	loader_impl_py_object py_object = (loader_impl_py_object)impl;
+
+	PyObject *pyobject_object = py_object->object;
+
+	PyObject *key_py_str = py_loader_impl_string_from(key);
+	PyObject *generic_attr = PyObject_GenericGetAttr(pyobject_object, key_py_str);
+	Py_DECREF(key_py_str);
+
+	return py_loader_impl_capi_to_value(impl, generic_attr, py_loader_impl_capi_to_value_type(generic_attr));
+}
+
+int py_object_interface_set(object obj, object_impl impl, const char *key, value v)
+{
+	(void)obj;
+
+	loader_impl_py_object py_object = (loader_impl_py_object)impl;
+
+	PyObject *pyobject_object = py_object->object;
+
+	PyObject *key_py_str = py_loader_impl_string_from(key);
+
+	PyObject *pyvalue = py_loader_impl_value_to_capi(py_object->impl, value_type_id(v), v);
+
+	int retval = PyObject_GenericSetAttr(pyobject_object, key_py_str, pyvalue);
+
+	Py_DECREF(key_py_str);
+
+	return retval;
+}
+
+int py_object_interface_attribute_resolve(object obj, object_impl impl, const char *key, object_attribute_impl *attr_impl)
+{
+	(void)obj;
+	(void)impl;
+
+	/* The interned unicode key is built once per handle so the hot
+	get and set path skips the string decoding on every access */
+	PyObject *key_py_str = PyUnicode_InternFromString(key);
+
+	if (key_py_str == NULL)
+	{
+		PyErr_Clear();
+
+		return 1;
+	}
+
+	*attr_impl = key_py_str;
+
+	return 0;
+}
+
+value py_object_interface_attribute_get(object obj, object_impl impl, object_attribute_impl attr_impl)
+{
+	(void)obj;
+
+	loader_impl_py_object py_object = (loader_impl_py_object)impl;
+
+	PyObject *generic_attr = PyObject_GenericGetAttr(py_object->object, (PyObject *)attr_impl);
+
+	return py_loader_impl_capi_to_value(impl, generic_attr, py_loader_impl_capi_to_value_type(generic_attr));
+}
+
+int py_object_interface_attribute_set(object obj, object_impl impl, object_attribute_impl attr_impl, value v)
+{
+	(void)obj;
+
+	loader_impl_py_object py_object = (loader_impl_py_object)impl;
+
+	PyObject *pyvalue = py_loader_impl_value_to_capi(py_object->impl, value_type_id(v), v);
+
+	return PyObject_GenericSetAttr(py_object->object, (PyObject *)attr_impl, pyvalue);
+}
+
+void py_object_interface_attribute_destroy(object obj, object_impl impl, object_attribute_impl attr_impl)
+{
+	(void)obj;
+	(void)impl;
+
+	Py_XDECREF((PyObject *)attr_impl);
+}
+
+value py_object_interface_method_invoke(object obj, object_impl impl, const char *method_name, object_args args, size_t argc)
+{
+	(void)obj;
+
+	loader_impl_py_object obj_impl = (loader_impl_py_object)impl;
+
+	if (obj_impl == NULL || obj_impl->object == NULL)
+	{
+		return NULL;
+	}
+
+	PyObject *method = PyObject_GetAttrString(obj_impl->object, method_name);
+
+	if (method == NULL)
+	{
+		return NULL;
+	}
+
+	PyObject *args_tuple = PyTuple_New(argc);
+
+	if (args_tuple == NULL)
+	{
+		return NULL;
+	}
+
+	for (size_t i = 0; i < argc; i++)
+	{
+		PyTuple_SET_ITEM(args_tuple, i, py_loader_impl_value_to_capi(obj_impl->impl, value_type_id(args[i]), args[i]));
+	}
+
+	PyObject *python_object = PyObject_Call(method, args_tuple, NULL);
+
+	Py_DECREF(args_tuple);
+	Py_DECREF(method);
+
+	if (python_object == NULL)
+	{
+		return NULL;
+	}
+
+	return py_loader_impl_capi_to_value(impl, python_object, py_loader_impl_capi_to_value_type(python_object));
+}
+
+value py_object_interface_method_await(object obj, object_impl impl, const char *key, object_args args, size_t size, object_resolve_callback resolve, object_reject_callback reject, void *ctx)
+{
+	// TODO
+	(void)obj;
+	(void)impl;
+	(void)key;
+	(void)args;
+	(void)size;
+	(void)resolve;
+	(void)reject;
+	(void)ctx;
+
+	return NULL;
+}
+
+int py_object_interface_method_resolve(object obj, object_impl impl, const char *name, object_method_impl *method_impl)
+{
+	(void)obj;
+
+	loader_impl_py_object obj_impl = (loader_impl_py_object)impl;
+
+	PyObject *method;
+
+	if (obj_impl == NULL || obj_impl->object == NULL)
+	{
+		return 1;
+	}
+
+	/* The bound method is resolved once per handle, calls through it
+	skip the attribute lookup py_object_interface_method_invoke repeats */
+	method = PyObject_GetAttrString(obj_impl->object, name);
+
+	if (method == NULL)
+	{
+		PyErr_Clear();
+
+		return 1;
+	}
+
+	*method_impl = method;
+
+	return 0;
+}
+
+value py_object_interface_method_invoke_handle(object obj, object_impl impl, object_method_impl method_impl, object_args args, size_t argc)
+{
+	(void)obj;
+
+	loader_impl_py_object obj_impl = (loader_impl_py_object)impl;
+
+	PyObject *method = (PyObject *)method_impl;
+
+	PyObject *args_tuple = PyTuple_New(argc);
+
+	PyObject *python_object;
+
+	if (args_tuple == NULL)
+	{
+		return NULL;
+	}
+
+	for (size_t i = 0; i < argc; i++)
+	{
+		PyTuple_SET_ITEM(args_tuple, i, py_loader_impl_value_to_capi(obj_impl->impl, value_type_id(args[i]), args[i]));
+	}
+
+	python_object = PyObject_Call(method, args_tuple, NULL);
+
+	Py_DECREF(args_tuple);
+
+	if (python_object == NULL)
+	{
+		return NULL;
+	}
+
+	return py_loader_impl_capi_to_value(impl, python_object, py_loader_impl_capi_to_value_type(python_object));
+}
+
+void py_object_interface_method_destroy(object obj, object_impl impl, object_method_impl method_impl)
+{
+	(void)obj;
+	(void)impl;
+
+	Py_XDECREF((PyObject *)method_impl);
+}
+
+int py_object_interface_destructor(object obj, object_impl impl)
+{
+	(void)obj;
+	(void)impl;
+
+	/* Python destructors are automatically called when ref count is zero and GC happens */
+
+	return 0;
+}
+
+void py_object_interface_destroy(object obj, object_impl impl)
+{
+	(void)obj;
+
+	loader_impl_py_object py_object = (loader_impl_py_object)impl;
+
+	if (py_object != NULL)
+	{
+		Py_XDECREF(py_object->object);
+
+		Py_XDECREF(py_object->object_class);
+
+		free(py_object);
+	}
+}
+
+object_interface py_object_interface_singleton(void)
+{
+	static struct object_interface_type py_object_interface = {
+		&py_object_interface_create,
+		&py_object_interface_get,
+		&py_object_interface_set,
+		&py_object_interface_method_invoke,
+		&py_object_interface_method_await,
+		&py_object_interface_destructor,
+		&py_object_interface_destroy,
+		&py_object_interface_attribute_resolve,
+		&py_object_interface_attribute_get,
+		&py_object_interface_attribute_set,
+		&py_object_interface_attribute_destroy,
+		&py_object_interface_method_resolve,
+		&py_object_interface_method_invoke_handle,
+		&py_object_interface_method_destroy
+	};
+
+	return &py_object_interface;
+}
+
+int py_class_interface_create(klass cls, class_impl impl)
+{
+	(void)cls;
+
+	loader_impl_py_class py_cls = impl;
+
+	py_cls->class = NULL;
+
+	return 0;
+}
+
+object py_class_interface_constructor(klass cls, class_impl impl, const char *name, class_args args, size_t argc)
+{
+	(void)cls;
+
+	loader_impl_py_class py_cls = impl;
+
+	loader_impl_py_object py_obj = malloc(sizeof(struct loader_impl_py_object_type));
+
+	object obj = object_create(name, py_obj, &py_object_interface_singleton, cls);
+
+	if (obj == NULL)
+	{
+		return NULL;
+	}
+
+	/* Get loader implementation from class */
+	py_obj->impl = py_cls->impl;
+
+	PyObject *args_tuple = PyTuple_New(argc);
+
+	if (args_tuple == NULL)
+		return NULL;
+
+	for (size_t i = 0; i < argc; i++)
+	{
+		PyTuple_SET_ITEM(args_tuple, i, py_loader_impl_value_to_capi(py_cls->impl, value_type_id(args[i]), args[i]));
+	}
+
+	/* Calling the class will create an instance (object) */
+	PyObject *python_object = PyObject_CallObject(py_cls->class, args_tuple);
+
+	Py_DECREF(args_tuple);
+
+	if (python_object == NULL)
+	{
+		object_destroy(obj);
+		return NULL;
+	}
+
+	Py_INCREF(py_cls->class);
+	py_obj->object = python_object;
+	py_obj->object_class = Py_TYPE(py_cls->class);
+
+	return obj;
+}
+
+value py_class_interface_static_get(klass cls, class_impl impl, const char *key)
+{
+	(void)cls;
+
+	loader_impl_py_class py_class = (loader_impl_py_class)impl;
+
+	PyObject *pyobject_class = py_class->class;
+
+	PyObject *key_py_str = py_loader_impl_string_from(key);
+	PyObject *generic_attr = PyObject_GenericGetAttr(pyobject_class, key_py_str);
+	Py_DECREF(key_py_str);
+
+	return py_loader_impl_capi_to_value(impl, generic_attr, py_loader_impl_capi_to_value_type(generic_attr));
+}
+
+int py_class_interface_static_set(klass cls, class_impl impl, const char *key, value v)
+{
+	(void)cls;
+
+	loader_impl_py_class py_class = (loader_impl_py_class)impl;
+
+	PyObject *pyobject_class = py_class->class;
+
+	PyObject *pyvalue = py_loader_impl_value_to_capi(py_class->impl, value_type_id(v), v);
+
+	PyObject *key_py_str = py_loader_impl_string_from(key);
+
+	int retval = PyObject_GenericSetAttr(pyobject_class, key_py_str, pyvalue);
+
+	Py_DECREF(key_py_str);
+
+	return retval;
+}
+
+value py_class_interface_static_invoke(klass cls, class_impl impl, const char *static_method_name, class_args args, size_t argc)
 {
 	// TODO
 	(void)cls;
@@ -554,6 +1259,89 @@ class_interface py_class_interface_singleton(void)
 	return &py_class_interface;
 }
 
+int py_stream_interface_create(stream s, stream_impl impl)
+{
+	(void)s;
+	(void)impl;
+
+	return 0;
+}
+
+value py_stream_interface_next(stream s, stream_impl impl)
+{
+	loader_impl_py_stream py_stream = (loader_impl_py_stream)impl;
+
+	PyGILState_STATE gstate;
+
+	PyObject *item;
+
+	value v = NULL;
+
+	(void)s;
+
+	if (py_stream == NULL)
+	{
+		return NULL;
+	}
+
+	gstate = PyGILState_Ensure();
+
+	item = PyIter_Next(py_stream->iterator);
+
+	if (item != NULL)
+	{
+		v = py_loader_impl_capi_to_value(py_stream->impl, item, py_loader_impl_capi_to_value_type(item));
+
+		Py_DECREF(item);
+	}
+	else if (PyErr_Occurred() != NULL)
+	{
+		/* StopIteration is the regular end of the generator, anything
+		else is a runtime error raised by the generator body */
+		if (PyErr_ExceptionMatches(PyExc_StopIteration) == 0)
+		{
+			loader_impl_py py_impl = loader_impl_get(py_stream->impl);
+
+			py_loader_impl_error_print(py_impl);
+		}
+
+		PyErr_Clear();
+	}
+
+	PyGILState_Release(gstate);
+
+	return v;
+}
+
+void py_stream_interface_destroy(stream s, stream_impl impl)
+{
+	loader_impl_py_stream py_stream = (loader_impl_py_stream)impl;
+
+	(void)s;
+
+	if (py_stream != NULL)
+	{
+		PyGILState_STATE gstate = PyGILState_Ensure();
+
+		Py_XDECREF(py_stream->iterator);
+
+		PyGILState_Release(gstate);
+
+		free(py_stream);
+	}
+}
+
+stream_interface py_stream_interface_singleton(void)
+{
+	static struct stream_interface_type py_stream_interface = {
+		&py_stream_interface_create,
+		&py_stream_interface_next,
+		&py_stream_interface_destroy
+	};
+
+	return &py_stream_interface;
+}
+
 type_id py_loader_impl_capi_to_value_type(PyObject *obj)
 {
 	if (PyBool_Check(obj))
@@ -586,7 +1374,7 @@ type_id py_loader_impl_capi_to_value_type(PyObject *obj)
 		return TYPE_STRING;
 	}
 #endif
-	else if (PyBytes_Check(obj))
+	else if (PyBytes_Check(obj) || PyByteArray_Check(obj))
 	{
 		return TYPE_BUFFER;
 	}
@@ -602,6 +1390,21 @@ type_id py_loader_impl_capi_to_value_type(PyObject *obj)
 	{
 		return TYPE_PTR;
 	}
+#if PY_MAJOR_VERSION == 3
+	else if (PyObject_CheckBuffer(obj))
+	{
+		/* NumPy arrays, memoryviews and any other object exposing
+		the buffer protocol map to a zero copy typed array */
+		return TYPE_TYPED_ARRAY;
+	}
+#endif
+	else if (PyGen_Check(obj))
+	{
+		/* Generators stay lazy, the host pulls them item by item
+		through the stream value instead of materializing the whole
+		sequence into an array */
+		return TYPE_STREAM;
+	}
 	else if (PyFunction_Check(obj) || PyCFunction_Check(obj))
 	{
 		return TYPE_FUNCTION;
@@ -636,7 +1439,20 @@ type_id py_loader_impl_capi_to_value_type(PyObject *obj)
 	return TYPE_INVALID;
 }
 
-value py_loader_impl_capi_to_value(loader_impl impl, PyObject *obj, type_id id)
+#if PY_MAJOR_VERSION == 3
+void py_loader_impl_typed_array_finalizer(value v, void *data)
+{
+	Py_buffer *view = data;
+
+	(void)v;
+
+	PyBuffer_Release(view);
+
+	free(view);
+}
+#endif
+
+static value py_loader_impl_capi_to_value_body(loader_impl impl, PyObject *obj, type_id id)
 {
 	value v = NULL;
 
@@ -697,7 +1513,28 @@ value py_loader_impl_capi_to_value(loader_impl impl, PyObject *obj, type_id id)
 		str = PyUnicode_AsUTF8AndSize(obj, &length);
 #endif
 
-		v = value_create_string(str, (size_t)length);
+		if (str != NULL && (size_t)length >= PY_LOADER_IMPL_STRING_VIEW_THRESHOLD)
+		{
+			/* Large strings reach the caller without a copy, the UTF8
+			buffer is owned by the unicode object which stays alive
+			until the value releases it through the finalizer */
+			v = value_create_string_view(str, (size_t)length);
+
+			if (v != NULL)
+			{
+				Py_INCREF(obj);
+
+				value_finalizer(v, &py_loader_impl_value_ptr_finalize, obj);
+			}
+			else
+			{
+				v = value_create_string(str, (size_t)length);
+			}
+		}
+		else
+		{
+			v = value_create_string(str, (size_t)length);
+		}
 	}
 	else if (id == TYPE_BUFFER)
 	{
@@ -710,9 +1547,118 @@ value py_loader_impl_capi_to_value(loader_impl impl, PyObject *obj, type_id id)
 		/* TODO */
 
 #elif PY_MAJOR_VERSION == 3
-		if (PyBytes_AsStringAndSize(obj, &str, &length) != -1)
+		if (PyByteArray_Check(obj))
+		{
+			str = PyByteArray_AsString(obj);
+			length = PyByteArray_Size(obj);
+		}
+		else if (PyBytes_AsStringAndSize(obj, &str, &length) == -1)
+		{
+			str = NULL;
+		}
+
+		if (str != NULL)
+		{
+			/* Borrow the object storage instead of copying it, the value
+			keeps the object alive through the finalizer; the trailing
+			nul written by CPython is included like the copying path did */
+			v = value_create_buffer_view((void *)str, (size_t)length + 1);
+
+			if (v != NULL)
+			{
+				Py_INCREF(obj);
+
+				value_finalizer(v, &py_loader_impl_value_ptr_finalize, obj);
+			}
+			else
+			{
+				v = value_create_buffer((const void *)str, (size_t)length + 1);
+			}
+		}
+#endif
+	}
+	else if (id == TYPE_TYPED_ARRAY)
+	{
+#if PY_MAJOR_VERSION == 3
+		Py_buffer *view = malloc(sizeof(Py_buffer));
+
+		type_id element_id = TYPE_INVALID;
+
+		if (view == NULL)
+		{
+			return NULL;
+		}
+
+		if (PyObject_GetBuffer(obj, view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0)
+		{
+			loader_impl_py py_impl = loader_impl_get(impl);
+
+			py_loader_impl_error_print(py_impl);
+
+			free(view);
+
+			return NULL;
+		}
+
+		if (view->format != NULL)
+		{
+			switch (view->format[0])
+			{
+				case '?':
+					element_id = TYPE_BOOL;
+					break;
+				case 'b':
+				case 'B':
+				case 'c':
+					element_id = TYPE_CHAR;
+					break;
+				case 'h':
+				case 'H':
+					element_id = TYPE_SHORT;
+					break;
+				case 'i':
+				case 'I':
+					element_id = TYPE_INT;
+					break;
+				case 'l':
+				case 'L':
+				case 'q':
+				case 'Q':
+					element_id = TYPE_LONG;
+					break;
+				case 'f':
+					element_id = TYPE_FLOAT;
+					break;
+				case 'd':
+					element_id = TYPE_DOUBLE;
+					break;
+				default:
+					break;
+			}
+		}
+
+		if (element_id == TYPE_INVALID || view->itemsize != (Py_ssize_t)value_type_id_size(element_id))
+		{
+			PyBuffer_Release(view);
+
+			free(view);
+		}
+		else
 		{
-			v = value_create_buffer((const void *)str, (size_t)length + 1);
+			/* The buffer memory is borrowed zero copy, the view is
+			released when the value is destroyed */
+			v = value_create_typed_array_view(view->buf, (size_t)(view->len / view->itemsize), element_id);
+
+			if (v == NULL)
+			{
+				PyBuffer_Release(view);
+
+				free(view);
+			}
+			else
+			{
+				value_finalizer(v, &py_loader_impl_typed_array_finalizer, view);
+			}
 		}
 #endif
 	}
@@ -887,6 +1833,35 @@ value py_loader_impl_capi_to_value(loader_impl impl, PyObject *obj, type_id id)
 			return value_create_function(f);
 		}
 	}
+	else if (id == TYPE_STREAM)
+	{
+		loader_impl_py_stream py_stream = malloc(sizeof(struct loader_impl_py_stream_type));
+
+		stream st;
+
+		if (py_stream == NULL)
+		{
+			return NULL;
+		}
+
+		Py_INCREF(obj);
+
+		py_stream->iterator = obj;
+		py_stream->impl = impl;
+
+		st = stream_create(py_stream, &py_stream_interface_singleton);
+
+		if (st == NULL)
+		{
+			Py_DECREF(obj);
+
+			free(py_stream);
+
+			return NULL;
+		}
+
+		v = value_create_stream(st);
+	}
 	else if (id == TYPE_NULL)
 	{
 		v = value_create_null();
@@ -958,7 +1933,20 @@ value py_loader_impl_capi_to_value(loader_impl impl, PyObject *obj, type_id id)
 	return v;
 }
 
-PyObject *py_loader_impl_value_to_capi(loader_impl impl, type_id id, value v)
+value py_loader_impl_capi_to_value(loader_impl impl, PyObject *obj, type_id id)
+{
+	value v;
+
+	PORTABILITY_PROBE_1(py_capi_to_value_begin, id);
+
+	v = py_loader_impl_capi_to_value_body(impl, obj, id);
+
+	PORTABILITY_PROBE_2(py_capi_to_value_end, id, v);
+
+	return v;
+}
+
+static PyObject *py_loader_impl_value_to_capi_body(loader_impl impl, type_id id, value v)
 {
 	if (id == TYPE_BOOL)
 	{
@@ -1014,28 +2002,40 @@ PyObject *py_loader_impl_value_to_capi(loader_impl impl, type_id id, value v)
 	}
 	else if (id == TYPE_STRING)
 	{
-		const char *str = value_to_string(v);
+		return py_loader_impl_string_from(value_to_string(v));
+	}
+	else if (id == TYPE_BUFFER)
+	{
+		/* This forces that you wont never be able to pass a buffer as a pointer to metacall without be wrapped into a value type */
+		/* If a pointer is passed this will produce a garbage read from outside of the memory range of the parameter */
+		size_t size = value_type_size(v);
+
+		char *buffer = value_to_buffer(v);
+
+#if PY_MAJOR_VERSION == 2
+
+		/* TODO */
 
-#if PY_MAJOR_VERSION == 2
-		return PyString_FromString(str);
 #elif PY_MAJOR_VERSION == 3
-		return PyUnicode_FromString(str);
+		/* Zero copy view over the value memory, mirrors the typed array
+		path so consumers can mutate the buffer in place */
+		return PyMemoryView_FromMemory(buffer, (Py_ssize_t)size, PyBUF_WRITE);
 #endif
 	}
-	else if (id == TYPE_BUFFER)
+	else if (id == TYPE_TYPED_ARRAY)
 	{
-		/* This forces that you wont never be able to pass a buffer as a pointer to metacall without be wrapped into a value type */
-		/* If a pointer is passed this will produce a garbage read from outside of the memory range of the parameter */
-		size_t size = value_type_size(v);
+		void *data = value_to_typed_array(v);
 
-		const char *buffer = value_to_buffer(v);
+		size_t size = value_typed_array_count(v) * value_type_id_size(value_typed_array_type_id(v));
 
 #if PY_MAJOR_VERSION == 2
 
 		/* TODO */
 
 #elif PY_MAJOR_VERSION == 3
-		return PyBytes_FromStringAndSize(buffer, (Py_ssize_t)size);
+		/* Zero copy view over the value memory, NumPy consumers can
+		wrap it without copying through numpy.frombuffer */
+		return PyMemoryView_FromMemory(data, (Py_ssize_t)size, PyBUF_WRITE);
 #endif
 	}
 	else if (id == TYPE_ARRAY)
@@ -1100,9 +2100,24 @@ PyObject *py_loader_impl_value_to_capi(loader_impl impl, type_id id, value v)
 	}
 	else if (id == TYPE_FUNCTION)
 	{
-		loader_impl_py_function_type_invoke_state invoke_state = malloc(sizeof(struct loader_impl_py_function_type_invoke_state_type));
+		function callback_func = value_to_function(v);
+
+		loader_impl_py_function_type_invoke_state invoke_state;
 
-		PyObject *invoke_state_capsule;
+		PyObject *invoke_state_capsule, *py_callback;
+
+		/* Reuse the trampoline built by a previous crossing of this
+		callback into Python instead of rebuilding the bridge per call */
+		py_callback = function_bridge_get(callback_func, (const void *)&function_py_singleton);
+
+		if (py_callback != NULL)
+		{
+			Py_INCREF(py_callback);
+
+			return py_callback;
+		}
+
+		invoke_state = malloc(sizeof(struct loader_impl_py_function_type_invoke_state_type));
 
 		if (invoke_state == NULL)
 		{
@@ -1120,7 +2135,18 @@ PyObject *py_loader_impl_value_to_capi(loader_impl impl, type_id id, value v)
 
 		Py_XINCREF(invoke_state_capsule);
 
-		return PyCFunction_New(py_loader_impl_function_type_invoke_defs, invoke_state_capsule);
+		py_callback = PyCFunction_New(py_loader_impl_function_type_invoke_defs, invoke_state_capsule);
+
+		if (py_callback != NULL)
+		{
+			if (function_bridge_set(callback_func, (const void *)&function_py_singleton, py_callback, &py_loader_impl_function_bridge_finalize) == 0)
+			{
+				/* Reference owned by the cache */
+				Py_INCREF(py_callback);
+			}
+		}
+
+		return py_callback;
 	}
 	else if (id == TYPE_NULL)
 	{
@@ -1148,49 +2174,493 @@ PyObject *py_loader_impl_value_to_capi(loader_impl impl, type_id id, value v)
 		/* TODO: The return value of object_impl_get may not be a loader_impl_py_object, it can be a loader_impl_node_node too */
 		loader_impl_py_object obj_impl = object_impl_get(obj);
 
-		if (obj_impl == NULL)
+		if (obj_impl == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_WARNING, "Cannot retrieve loader_impl_py_object when converting value to python capi");
+			return NULL;
+		}
+
+		return obj_impl->object;
+	}
+	else
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Unrecognized value type: %d", id);
+	}
+
+	return NULL;
+}
+
+PyObject *py_loader_impl_value_to_capi(loader_impl impl, type_id id, value v)
+{
+	PyObject *obj;
+
+	PORTABILITY_PROBE_1(py_value_to_capi_begin, id);
+
+	obj = py_loader_impl_value_to_capi_body(impl, id, v);
+
+	PORTABILITY_PROBE_2(py_value_to_capi_end, id, obj);
+
+	return obj;
+}
+
+#if defined(PY_LOADER_SUBINTERP_POOL)
+char *py_loader_impl_str_copy(const char *str)
+{
+	size_t size = strlen(str) + 1;
+
+	char *copy = malloc(sizeof(char) * size);
+
+	if (copy == NULL)
+	{
+		return NULL;
+	}
+
+	memcpy(copy, str, size);
+
+	return copy;
+}
+
+int py_loader_impl_pool_initialize(loader_impl_py py_impl, configuration config)
+{
+	/* Isolated configuration, each member owns its GIL so pure Python
+	execution scales across cores */
+	PyInterpreterConfig interp_config = {
+		.use_main_obmalloc = 0,
+		.allow_fork = 0,
+		.allow_exec = 0,
+		.allow_threads = 1,
+		.allow_daemon_threads = 0,
+		.check_multi_interp_extensions = 1,
+		.gil = PyInterpreterConfig_OWN_GIL,
+	};
+
+	PyThreadState *main_tstate;
+
+	size_t size = 0, iterator;
+
+	if (config != NULL)
+	{
+		value pool_size = configuration_value(config, "subinterpreter_pool");
+
+		if (pool_size != NULL && value_type_id(pool_size) == TYPE_INT && value_to_int(pool_size) > 0)
+		{
+			size = (size_t)value_to_int(pool_size);
+		}
+	}
+
+	if (size == 0)
+	{
+		return 0;
+	}
+
+	py_impl->pool = malloc(sizeof(struct loader_impl_py_interp_type) * size);
+
+	if (py_impl->pool == NULL)
+	{
+		return 1;
+	}
+
+	py_impl->pool_lock = PyThread_allocate_lock();
+
+	if (py_impl->pool_lock == NULL)
+	{
+		free(py_impl->pool);
+
+		py_impl->pool = NULL;
+
+		return 1;
+	}
+
+	main_tstate = PyThreadState_Get();
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		PyThreadState *tstate = NULL;
+
+		PyStatus status = Py_NewInterpreterFromConfig(&tstate, &interp_config);
+
+		if (PyStatus_Exception(status) || tstate == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid Python subinterpreter creation (member %" PRIuS " of %" PRIuS ")", iterator, size);
+
+			break;
+		}
+
+		py_impl->pool[iterator].interp = PyThreadState_GetInterpreter(tstate);
+		py_impl->pool[iterator].tstate = tstate;
+		py_impl->pool[iterator].busy = 0;
+		py_impl->pool[iterator].prepared = 0;
+	}
+
+	py_impl->pool_size = iterator;
+
+	PyThreadState_Swap(main_tstate);
+
+	log_write("metacall", LOG_LEVEL_DEBUG, "Python subinterpreter pool initialized with %" PRIuS " members", py_impl->pool_size);
+
+	return 0;
+}
+
+void py_loader_impl_pool_destroy(loader_impl_py py_impl)
+{
+	size_t iterator;
+
+	if (py_impl->pool_size > 0)
+	{
+		PyThreadState *main_tstate = PyThreadState_Get();
+
+		for (iterator = 0; iterator < py_impl->pool_size; ++iterator)
+		{
+			PyThreadState_Swap(py_impl->pool[iterator].tstate);
+
+			Py_EndInterpreter(py_impl->pool[iterator].tstate);
+		}
+
+		PyThreadState_Swap(main_tstate);
+
+		py_impl->pool_size = 0;
+	}
+
+	if (py_impl->pool != NULL)
+	{
+		free(py_impl->pool);
+
+		py_impl->pool = NULL;
+	}
+
+	if (py_impl->pool_lock != NULL)
+	{
+		PyThread_free_lock(py_impl->pool_lock);
+
+		py_impl->pool_lock = NULL;
+	}
+
+	for (iterator = 0; iterator < py_impl->pool_paths_size; ++iterator)
+	{
+		free(py_impl->pool_paths[iterator]);
+	}
+
+	free(py_impl->pool_paths);
+
+	py_impl->pool_paths = NULL;
+	py_impl->pool_paths_size = 0;
+}
+
+int py_loader_impl_pool_path(loader_impl_py py_impl, const loader_naming_path path)
+{
+	char **paths;
+
+	char *copy = py_loader_impl_str_copy(path);
+
+	if (copy == NULL)
+	{
+		return 1;
+	}
+
+	PyThread_acquire_lock(py_impl->pool_lock, WAIT_LOCK);
+
+	paths = realloc(py_impl->pool_paths, sizeof(char *) * (py_impl->pool_paths_size + 1));
+
+	if (paths == NULL)
+	{
+		PyThread_release_lock(py_impl->pool_lock);
+
+		free(copy);
+
+		return 1;
+	}
+
+	paths[py_impl->pool_paths_size++] = copy;
+
+	py_impl->pool_paths = paths;
+
+	/* Members prepared before this path arrived pick it up lazily */
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < py_impl->pool_size; ++iterator)
+		{
+			py_impl->pool[iterator].prepared = 0;
+		}
+	}
+
+	PyThread_release_lock(py_impl->pool_lock);
+
+	return 0;
+}
+
+static int py_loader_impl_pool_prepare(loader_impl_py py_impl, loader_impl_py_interp member)
+{
+	PyObject *system_paths = PySys_GetObject("path");
+
+	size_t iterator;
+
+	if (system_paths == NULL)
+	{
+		return 1;
+	}
+
+	for (iterator = 0; iterator < py_impl->pool_paths_size; ++iterator)
+	{
+		PyObject *current_path = PyUnicode_DecodeFSDefault(py_impl->pool_paths[iterator]);
+
+		Py_ssize_t index, size = PyList_Size(system_paths);
+
+		int found = 0;
+
+		if (current_path == NULL)
+		{
+			return 1;
+		}
+
+		for (index = 0; index < size; ++index)
+		{
+			if (PyObject_RichCompareBool(PyList_GetItem(system_paths, index), current_path, Py_EQ) == 1)
+			{
+				found = 1;
+
+				break;
+			}
+		}
+
+		if (found == 0 && PyList_Insert(system_paths, 0, current_path) != 0)
+		{
+			Py_DECREF(current_path);
+
+			return 1;
+		}
+
+		Py_DECREF(current_path);
+	}
+
+	member->prepared = 1;
+
+	return 0;
+}
+
+int py_loader_impl_pool_invoke(function func, loader_impl_py_function py_func, loader_impl_py py_impl, function_args args, size_t args_size, function_return *ret)
+{
+	signature s = function_signature(func);
+	const size_t signature_args_size = signature_count(s);
+	type ret_type = signature_get_return(s);
+
+	loader_impl_py_interp member = NULL;
+
+	PyThreadState *tstate;
+
+	PyObject *module, *callable, **values;
+
+	size_t iterator;
+
+	value v = NULL;
+
+	/* Take an idle member, a saturated pool falls back to the caller */
+	PyThread_acquire_lock(py_impl->pool_lock, WAIT_LOCK);
+
+	for (iterator = 0; iterator < py_impl->pool_size; ++iterator)
+	{
+		if (py_impl->pool[iterator].busy == 0)
+		{
+			member = &py_impl->pool[iterator];
+
+			member->busy = 1;
+
+			break;
+		}
+	}
+
+	PyThread_release_lock(py_impl->pool_lock);
+
+	if (member == NULL)
+	{
+		return 1;
+	}
+
+	values = args_size > 0 ? malloc(sizeof(PyObject *) * args_size) : NULL;
+
+	if (values == NULL && args_size > 0)
+	{
+		goto error_release_member;
+	}
+
+	/* Enter the subinterpreter with a thread state of our own, its
+	GIL is independent from the main interpreter one */
+	tstate = PyThreadState_New(member->interp);
+
+	if (tstate == NULL)
+	{
+		free(values);
+
+		goto error_release_member;
+	}
+
+	PyEval_RestoreThread(tstate);
+
+	if (member->prepared == 0 && py_loader_impl_pool_prepare(py_impl, member) != 0)
+	{
+		goto error_leave_interp;
+	}
+
+	/* Resolve the twin of the function inside this interpreter, the
+	import system caches the module once per member */
+	module = PyImport_ImportModule(py_func->module_name);
+
+	if (module == NULL)
+	{
+		PyErr_Print();
+
+		goto error_leave_interp;
+	}
+
+	/* Walk the qualified name so methods (Class.method) resolve too */
+	{
+		const char *begin = py_func->qualname;
+
+		callable = module;
+
+		while (callable != NULL && begin != NULL)
+		{
+			const char *end = strchr(begin, '.');
+
+			PyObject *segment = end == NULL ? PyUnicode_FromString(begin) : PyUnicode_FromStringAndSize(begin, (Py_ssize_t)(end - begin));
+
+			PyObject *next = segment == NULL ? NULL : PyObject_GetAttr(callable, segment);
+
+			Py_XDECREF(segment);
+			Py_DECREF(callable);
+
+			callable = next;
+
+			begin = end == NULL ? NULL : end + 1;
+		}
+	}
+
+	if (callable == NULL)
+	{
+		PyErr_Print();
+
+		goto error_leave_interp;
+	}
+
+	for (iterator = 0; iterator < args_size; ++iterator)
+	{
+		type t = iterator < signature_args_size ? signature_get_type(s, iterator) : NULL;
+		type_id id = t == NULL ? value_type_id((value)args[iterator]) : type_index(t);
+
+		values[iterator] = py_loader_impl_value_to_capi(py_func->impl, id, args[iterator]);
+	}
+
+	{
+		PyObject *result = PyObject_Vectorcall(callable, values, args_size, NULL);
+
+		if (PyErr_Occurred() != NULL)
+		{
+			PyErr_Print();
+		}
+
+		for (iterator = 0; iterator < args_size; ++iterator)
 		{
-			log_write("metacall", LOG_LEVEL_WARNING, "Cannot retrieve loader_impl_py_object when converting value to python capi");
-			return NULL;
+			Py_XDECREF(values[iterator]);
 		}
 
-		return obj_impl->object;
-	}
-	else
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Unrecognized value type: %d", id);
+		if (result != NULL)
+		{
+			type_id id = ret_type == NULL ? py_loader_impl_capi_to_value_type(result) : type_index(ret_type);
+
+			v = py_loader_impl_capi_to_value(py_func->impl, result, id);
+
+			Py_DECREF(result);
+		}
 	}
 
-	return NULL;
+	Py_DECREF(callable);
+
+	PyThreadState_Clear(tstate);
+	PyThreadState_DeleteCurrent();
+
+	free(values);
+
+	PyThread_acquire_lock(py_impl->pool_lock, WAIT_LOCK);
+	member->busy = 0;
+	PyThread_release_lock(py_impl->pool_lock);
+
+	*ret = v;
+
+	return 0;
+
+error_leave_interp:
+	PyThreadState_Clear(tstate);
+	PyThreadState_DeleteCurrent();
+
+	free(values);
+
+error_release_member:
+	PyThread_acquire_lock(py_impl->pool_lock, WAIT_LOCK);
+	member->busy = 0;
+	PyThread_release_lock(py_impl->pool_lock);
+
+	return 1;
 }
+#endif /* PY_LOADER_SUBINTERP_POOL */
 
-function_return function_py_interface_invoke(function func, function_impl impl, function_args args, size_t args_size)
+static function_return function_py_interface_invoke_gil(function func, loader_impl_py_function py_func, loader_impl_py py_impl, function_args args, size_t args_size, PyObject **values)
 {
-	loader_impl_py_function py_func = (loader_impl_py_function)impl;
 	signature s = function_signature(func);
 	const size_t signature_args_size = signature_count(s);
 	type ret_type = signature_get_return(s);
-	loader_impl_py py_impl = loader_impl_get(py_func->impl);
-	PyGILState_STATE gstate = PyGILState_Ensure();
 
 	/* Possibly a recursive call */
 	if (Py_EnterRecursiveCall(" while executing a function in Python Loader") != 0)
 	{
-		goto error;
+		return NULL;
 	}
 
-	PyObject *tuple_args = PyTuple_New(args_size);
+	for (size_t args_count = 0; args_count < args_size; ++args_count)
+	{
+		/* Compiled plan first, one predictable indirect call per typed
+		parameter; untyped or composite parameters go through the switch */
+		if (py_func->converters != NULL && args_count < signature_args_size && py_func->converters[args_count] != NULL)
+		{
+			values[args_count] = py_func->converters[args_count](py_func->impl, args[args_count]);
+		}
+		else
+		{
+			type t = args_count < signature_args_size ? signature_get_type(s, args_count) : NULL;
+			type_id id = t == NULL ? value_type_id((value)args[args_count]) : type_index(t);
+			values[args_count] = py_loader_impl_value_to_capi(py_func->impl, id, args[args_count]);
+		}
+	}
 
-	/* Allocate dynamically more space for values in case of variable arguments */
-	bool is_var_args = args_size > signature_args_size || py_func->values == NULL;
-	PyObject **values = is_var_args ? malloc(sizeof(PyObject *) * args_size) : py_func->values;
+#if PY_VERSION_HEX >= 0x03080000
+	/* The vectorcall protocol takes the arguments straight from the
+	per function buffer, the tuple and its refcount churn disappear
+	from the call path; positional calls only, which is all this
+	invoke path ever produces (keywords would go through the tuple
+	and dict protocol instead) */
+	#if PY_VERSION_HEX >= 0x03090000
+	PyObject *result = PyObject_Vectorcall(py_func->func, values, args_size, NULL);
+	#else
+	PyObject *result = _PyObject_Vectorcall(py_func->func, values, args_size, NULL);
+	#endif
+
+	/* End of recursive call */
+	Py_LeaveRecursiveCall();
+
+	if (PyErr_Occurred() != NULL)
+	{
+		py_loader_impl_error_print(py_impl);
+	}
 
+	/* Vectorcall borrows the arguments instead of stealing them */
 	for (size_t args_count = 0; args_count < args_size; ++args_count)
 	{
-		type t = args_count < signature_args_size ? signature_get_type(s, args_count) : NULL;
-		type_id id = t == NULL ? value_type_id((value)args[args_count]) : type_index(t);
-		values[args_count] = py_loader_impl_value_to_capi(py_func->impl, id, args[args_count]);
+		Py_XDECREF(values[args_count]);
+	}
+#else
+	PyObject *tuple_args = PyTuple_New(args_size);
 
+	for (size_t args_count = 0; args_count < args_size; ++args_count)
+	{
 		if (values[args_count] != NULL)
 		{
 			PyTuple_SetItem(tuple_args, args_count, values[args_count]);
@@ -1208,28 +2678,102 @@ function_return function_py_interface_invoke(function func, function_impl impl,
 	}
 
 	Py_DECREF(tuple_args);
-
-	if (is_var_args)
-	{
-		free(values);
-	}
+#endif
 
 	if (result == NULL)
 	{
-		goto error;
+		return NULL;
 	}
 
 	type_id id = ret_type == NULL ? py_loader_impl_capi_to_value_type(result) : type_index(ret_type);
 	value v = py_loader_impl_capi_to_value(py_func->impl, result, id);
 
 	Py_DECREF(result);
+
+	return v;
+}
+
+function_return function_py_interface_invoke(function func, function_impl impl, function_args args, size_t args_size)
+{
+	loader_impl_py_function py_func = (loader_impl_py_function)impl;
+	loader_impl_py py_impl = loader_impl_get(py_func->impl);
+
+	/* Allocate dynamically more space for values in case of variable
+	arguments; the staging buffer comes from the host allocator so it
+	is taken before acquiring the GIL */
+	bool is_var_args = args_size > signature_count(function_signature(func)) || py_func->values == NULL;
+	PyObject **values = is_var_args ? malloc(sizeof(PyObject *) * args_size) : py_func->values;
+
+	if (values == NULL && args_size > 0)
+	{
+		return NULL;
+	}
+
+#if defined(PY_LOADER_SUBINTERP_POOL)
+	/* Route to an idle subinterpreter when the pool mode is on, a
+	saturated pool or an unresolvable function falls through to the
+	main interpreter */
+	if (py_impl != NULL && py_impl->pool_size > 0 && py_func->module_name != NULL && py_func->qualname != NULL)
+	{
+		function_return pool_ret;
+
+		if (py_loader_impl_pool_invoke(func, py_func, py_impl, args, args_size, &pool_ret) == 0)
+		{
+			if (is_var_args)
+			{
+				free(values);
+			}
+
+			return pool_ret;
+		}
+	}
+#endif
+
+	PyGILState_STATE gstate = PyGILState_Ensure();
+
+	function_return v = function_py_interface_invoke_gil(func, py_func, py_impl, args, args_size, values);
+
 	PyGILState_Release(gstate);
 
+	if (is_var_args)
+	{
+		free(values);
+	}
+
 	return v;
+}
+
+int function_py_interface_invoke_batch(function func, function_impl impl, void **args[], size_t size, size_t count, function_return results[])
+{
+	loader_impl_py_function py_func = (loader_impl_py_function)impl;
+	loader_impl_py py_impl = loader_impl_get(py_func->impl);
+
+	/* Host side staging happens before the interpreter lock is taken */
+	bool is_var_args = size > signature_count(function_signature(func)) || py_func->values == NULL;
+	PyObject **values = is_var_args ? malloc(sizeof(PyObject *) * size) : py_func->values;
+
+	if (values == NULL && size > 0)
+	{
+		return 1;
+	}
+
+	/* The whole batch runs under a single GIL acquisition, the lock
+	stops ping-ponging between embedder threads on every call */
+	PyGILState_STATE gstate = PyGILState_Ensure();
+
+	for (size_t iterator = 0; iterator < count; ++iterator)
+	{
+		results[iterator] = function_py_interface_invoke_gil(func, py_func, py_impl, args[iterator], size, values);
+	}
 
-error:
 	PyGILState_Release(gstate);
-	return NULL;
+
+	if (is_var_args)
+	{
+		free(values);
+	}
+
+	return 0;
 }
 
 function_return function_py_interface_await(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
@@ -1259,6 +2803,16 @@ void function_py_interface_destroy(function func, function_impl impl)
 			free(py_func->values);
 		}
 
+		if (py_func->converters != NULL)
+		{
+			free(py_func->converters);
+		}
+
+#if defined(PY_LOADER_SUBINTERP_POOL)
+		free(py_func->module_name);
+		free(py_func->qualname);
+#endif
+
 		Py_DECREF(py_func->func);
 
 		free(py_func);
@@ -1271,7 +2825,8 @@ function_interface function_py_singleton(void)
 		&function_py_interface_create,
 		&function_py_interface_invoke,
 		&function_py_interface_await,
-		&function_py_interface_destroy
+		&function_py_interface_destroy,
+		&function_py_interface_invoke_batch
 	};
 
 	return &py_function_interface;
@@ -1615,6 +3170,174 @@ error_import_compile:
 	return 1;
 }
 
+static int py_loader_impl_watchdog_pending(void *data)
+{
+	(void)data;
+
+	PyRun_SimpleString(
+		"import sys, traceback\n"
+		"for __metacall_tid, __metacall_frame in sys._current_frames().items():\n"
+		"	print('MetaCall watchdog sample of thread %d:' % __metacall_tid, file=sys.stderr)\n"
+		"	traceback.print_stack(__metacall_frame, file=sys.stderr)\n");
+
+	return 0;
+}
+
+static void py_loader_impl_watchdog_sample(function func, uint64_t elapsed, void *data)
+{
+	(void)data;
+
+	log_write("metacall", LOG_LEVEL_WARNING, "Watchdog sampling Python stacks (call to %s has been running for %lu ms)",
+		function_name(func), (unsigned long)(elapsed / 1000000ULL));
+
+	/* The dump runs inside the interpreter when it next executes
+	bytecode; if it never shows up the stall is inside a C extension
+	or waiting on the GIL rather than in Python user code */
+	if (Py_AddPendingCall(&py_loader_impl_watchdog_pending, NULL) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Watchdog could not schedule the Python stack dump");
+	}
+}
+
+/* Bridge between the metacall_gc_* coordination API and the Python
+collector, so the embedder can trigger collections in traffic troughs
+and defer the automatic ones during latency sensitive bursts */
+static int py_loader_impl_gc_collect_cb(loader_impl impl, void *data)
+{
+	PyGILState_STATE gstate = PyGILState_Ensure();
+
+	Py_ssize_t collected = PyGC_Collect();
+
+	PyGILState_Release(gstate);
+
+	(void)impl;
+	(void)data;
+
+	return collected < 0;
+}
+
+static int py_loader_impl_gc_hint_cb(loader_impl impl, int defer, void *data)
+{
+	PyGILState_STATE gstate = PyGILState_Ensure();
+
+	(void)impl;
+	(void)data;
+
+#if PY_VERSION_HEX >= 0x030A0000
+	if (defer != 0)
+	{
+		PyGC_Disable();
+	}
+	else
+	{
+		PyGC_Enable();
+	}
+#else
+	{
+		PyObject *gc_module = PyImport_ImportModule("gc");
+
+		PyObject *result = NULL;
+
+		if (gc_module != NULL)
+		{
+			result = PyObject_CallMethod(gc_module, defer != 0 ? "disable" : "enable", NULL);
+
+			Py_XDECREF(result);
+
+			Py_DECREF(gc_module);
+		}
+
+		if (result == NULL)
+		{
+			PyErr_Clear();
+
+			PyGILState_Release(gstate);
+
+			return 1;
+		}
+	}
+#endif
+
+	PyGILState_Release(gstate);
+
+	return 0;
+}
+
+static int py_loader_impl_gc_stats_cb(loader_impl impl, struct loader_impl_gc_stats_type *stats, void *data)
+{
+	PyGILState_STATE gstate = PyGILState_Ensure();
+
+	int result = 1;
+
+	(void)impl;
+	(void)data;
+
+	/* Heap occupancy in allocator blocks, the closest portable figure
+	the interpreter exposes */
+	{
+		PyObject *sys_module = PyImport_ImportModule("sys");
+
+		if (sys_module != NULL)
+		{
+			PyObject *blocks = PyObject_CallMethod(sys_module, "getallocatedblocks", NULL);
+
+			if (blocks != NULL)
+			{
+				stats->heap_size = (size_t)PyLong_AsSsize_t(blocks);
+
+				Py_DECREF(blocks);
+
+				result = 0;
+			}
+
+			Py_DECREF(sys_module);
+		}
+	}
+
+	/* Collections run, summed over the three generations */
+	{
+		PyObject *gc_module = PyImport_ImportModule("gc");
+
+		if (gc_module != NULL)
+		{
+			PyObject *gc_stats = PyObject_CallMethod(gc_module, "get_stats", NULL);
+
+			if (gc_stats != NULL && PyList_Check(gc_stats))
+			{
+				Py_ssize_t size = PyList_Size(gc_stats), iterator;
+
+				size_t collections = 0;
+
+				for (iterator = 0; iterator < size; ++iterator)
+				{
+					PyObject *generation = PyList_GetItem(gc_stats, iterator);
+
+					PyObject *count = (generation != NULL && PyDict_Check(generation)) ? PyDict_GetItemString(generation, "collections") : NULL;
+
+					if (count != NULL)
+					{
+						collections += (size_t)PyLong_AsSize_t(count);
+					}
+				}
+
+				stats->collection_count = collections;
+
+				result = 0;
+			}
+
+			Py_XDECREF(gc_stats);
+
+			Py_DECREF(gc_module);
+		}
+	}
+
+	PyErr_Clear();
+
+	PyGILState_Release(gstate);
+
+	return result;
+}
+
 loader_impl_data py_loader_impl_initialize(loader_impl impl, configuration config)
 {
 	(void)impl;
@@ -1656,14 +3379,21 @@ loader_impl_data py_loader_impl_initialize(loader_impl impl, configuration confi
 
 #if DEBUG_ENABLED
 	{
-		if (py_loader_impl_initialize_gc(py_impl) != 0)
-		{
-			PyObject_CallMethodObjArgs(py_impl->gc_module, py_impl->gc_set_debug, py_impl->gc_debug_leak /* py_impl->gc_debug_stats */);
-			gc_initialized = 0;
-		}
-		else
+		/* Debug builds set up the gc debug hooks unless the py_loader
+		configuration or the initialization options (gc_debug) disable them */
+		value gc_debug = config != NULL ? configuration_value(config, "gc_debug") : NULL;
+
+		if (gc_debug == NULL || (value_type_id(gc_debug) == TYPE_BOOL && value_to_bool(gc_debug) == 1L))
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Invalid garbage collector module creation");
+			if (py_loader_impl_initialize_gc(py_impl) != 0)
+			{
+				PyObject_CallMethodObjArgs(py_impl->gc_module, py_impl->gc_set_debug, py_impl->gc_debug_leak /* py_impl->gc_debug_stats */);
+				gc_initialized = 0;
+			}
+			else
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Invalid garbage collector module creation");
+			}
 		}
 	}
 #endif
@@ -1683,11 +3413,36 @@ loader_impl_data py_loader_impl_initialize(loader_impl impl, configuration confi
 		goto error_after_import;
 	}
 
+#if defined(PY_LOADER_SUBINTERP_POOL)
+	py_impl->pool = NULL;
+	py_impl->pool_size = 0;
+	py_impl->pool_lock = NULL;
+	py_impl->pool_paths = NULL;
+	py_impl->pool_paths_size = 0;
+
+	/* Opt-in through the py_loader configuration (subinterpreter_pool),
+	a failed pool creation degrades to the single interpreter mode */
+	if (py_loader_impl_pool_initialize(py_impl, config) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid Python subinterpreter pool initialization, falling back to the main interpreter");
+	}
+#endif
+
 	PyGILState_Release(gstate);
 
 	/* Register initialization */
 	loader_initialization_register(impl);
 
+	/* Hook the call watchdog so stalled calls get their Python stacks
+	sampled, the hook only fires when the watchdog has been enabled */
+	if (function_watchdog_register(&py_loader_impl_watchdog_sample, NULL) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_DEBUG, "Python watchdog sampler already registered or sampler table full");
+	}
+
+	/* Bridge the collector into the metacall_gc_* coordination API */
+	loader_impl_gc_register(impl, &py_loader_impl_gc_collect_cb, &py_loader_impl_gc_hint_cb, &py_loader_impl_gc_stats_cb, NULL);
+
 	log_write("metacall", LOG_LEVEL_DEBUG, "Python loader initialized correctly");
 
 	return py_impl;
@@ -1732,6 +3487,14 @@ int py_loader_impl_execution_path(loader_impl impl, const loader_naming_path pat
 	}
 
 	int result = 0;
+
+#if defined(PY_LOADER_SUBINTERP_POOL)
+	if (py_impl->pool_size > 0 && py_loader_impl_pool_path(py_impl, path) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid execution path replication into the Python subinterpreter pool");
+	}
+#endif
+
 	PyGILState_STATE gstate = PyGILState_Ensure();
 	PyObject *system_paths = PySys_GetObject("path");
 	PyObject *current_path = PyUnicode_DecodeFSDefault(path);
@@ -2045,12 +3808,24 @@ error_create_handle:
 
 PyObject *py_loader_impl_load_from_memory_compile(loader_impl_py py_impl, const loader_naming_name name, const char *buffer)
 {
-	PyObject *compiled = Py_CompileString(buffer, name, Py_file_input);
+	/* The cache key is the source text only, a hit under a different
+	module name reuses the code object (co_filename keeps the name of
+	the first load, the module name is passed per execution below) */
+	uint64_t hash = py_loader_impl_code_cache_hash(buffer);
+
+	PyObject *compiled = py_loader_impl_code_cache_get(hash);
 
 	if (compiled == NULL)
 	{
-		py_loader_impl_error_print(py_impl);
-		return NULL;
+		compiled = Py_CompileString(buffer, name, Py_file_input);
+
+		if (compiled == NULL)
+		{
+			py_loader_impl_error_print(py_impl);
+			return NULL;
+		}
+
+		py_loader_impl_code_cache_put(hash, compiled);
 	}
 
 	PyObject *instance = PyImport_ExecCodeModule(name, compiled);
@@ -2648,6 +4423,16 @@ int py_loader_impl_destroy(loader_impl impl)
 	}
 #endif
 
+#if defined(PY_LOADER_SUBINTERP_POOL)
+	/* The pool must end before the main interpreter finalizes */
+	py_loader_impl_pool_destroy(py_impl);
+#endif
+
+	/* Release the interned string and compiled code caches before the
+	interpreter goes away */
+	py_loader_impl_string_cache_clear();
+	py_loader_impl_code_cache_clear();
+
 	int result = py_loader_impl_finalize(py_impl);
 
 	free(py_impl);
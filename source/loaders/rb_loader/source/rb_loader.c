@@ -33,7 +33,9 @@ loader_impl_interface rb_loader_impl_interface_singleton(void)
 		&rb_loader_impl_load_from_package,
 		&rb_loader_impl_clear,
 		&rb_loader_impl_discover,
-		&rb_loader_impl_destroy
+		&rb_loader_impl_destroy,
+		NULL /* parallel */,
+		NULL /* address */
 	};
 
 	return &loader_impl_interface_rb;
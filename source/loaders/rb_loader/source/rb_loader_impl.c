@@ -21,8 +21,12 @@
 #include <adt/adt_set.h>
 #include <adt/adt_vector.h>
 
+#include <environment/environment_variable.h>
+
 #include <log/log.h>
 
+#include <inttypes.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -38,6 +42,7 @@
 #endif
 
 #include <ruby.h>
+#include <ruby/version.h> /* ruby_version, not pulled in by ruby.h */
 
 /* Disable warnings from Ruby */
 #if defined(__GNUC__)
@@ -47,6 +52,15 @@
 #define LOADER_IMPL_RB_FUNCTION_ARGS_SIZE 0x10
 #define LOADER_IMPL_RB_PROTECT_ARGS_SIZE  0x10
 
+/* The instruction sequence cache is opt-in, it stays disabled unless
+the variable points to a writable directory */
+#define LOADER_IMPL_RB_CACHE_PATH "RB_LOADER_CACHE_PATH"
+
+#define LOADER_IMPL_RB_CACHE_HASH_OFFSET 0xCBF29CE484222325ULL
+#define LOADER_IMPL_RB_CACHE_HASH_PRIME	 0x00000100000001B3ULL
+
+#define LOADER_IMPL_RB_CACHE_ENTRY_PATH_SIZE 0x1000
+
 typedef struct loader_impl_rb_module_type
 {
 	ID id;
@@ -66,6 +80,7 @@ typedef struct loader_impl_rb_function_type
 {
 	loader_impl_rb_module rb_module;
 	ID method_id;
+	ID args_ids[LOADER_IMPL_RB_FUNCTION_ARGS_SIZE]; /* Interned once, calls never hit the symbol table */
 	VALUE args_hash;
 	loader_impl impl;
 
@@ -93,17 +108,39 @@ typedef struct loader_impl_rb_module_eval_protect_type
 	VALUE module;
 } * loader_impl_rb_module_eval_protect;
 
+typedef struct loader_impl_rb_funcall_protect_type
+{
+	VALUE recv;
+	ID method;
+	int argc;
+	VALUE argv[2];
+} * loader_impl_rb_funcall_protect;
+
+/* Send symbol interned once at initialization */
+static ID rb_loader_impl_send_id = 0;
+
 class_interface rb_class_interface_singleton();
 object_interface rb_object_interface_singleton();
 
 int function_rb_interface_create(function func, function_impl impl)
 {
+	loader_impl_rb_function rb_function = (loader_impl_rb_function)impl;
+
 	signature s = function_signature(func);
 
+	size_t iterator, args_count = signature_count(s);
+
 	/* Set to null, deduced dynamically */
 	signature_set_return(s, NULL);
 
-	(void)impl;
+	/* Intern the named argument symbols once, the invoke path only
+	reads the cached ids instead of interning on every call */
+	for (iterator = 0; iterator < args_count && iterator < LOADER_IMPL_RB_FUNCTION_ARGS_SIZE; ++iterator)
+	{
+		const char *arg_name = signature_get_name(s, iterator);
+
+		rb_function->args_ids[iterator] = arg_name == NULL ? 0 : rb_intern(arg_name);
+	}
 
 	return 0;
 }
@@ -349,13 +386,13 @@ function_return function_rb_interface_invoke(function func, function_impl impl,
 
 			if (t != NULL)
 			{
-				rb_hash_aset(rb_function->args_hash, ID2SYM(rb_intern(signature_get_name(s, args_count))), args_value[args_count]);
+				rb_hash_aset(rb_function->args_hash, ID2SYM(rb_function->args_ids[args_count]), args_value[args_count]);
 			}
 		}
 
 		if (invoke_type == FUNCTION_RB_TYPED)
 		{
-			result_value = rb_funcall(rb_function->rb_module->instance, rb_intern("send"), 2,
+			result_value = rb_funcall(rb_function->rb_module->instance, rb_loader_impl_send_id, 2,
 				ID2SYM(rb_function->method_id), rb_function->args_hash);
 		}
 		else if (invoke_type == FUNCTION_RB_DUCKTYPED)
@@ -368,7 +405,7 @@ function_return function_rb_interface_invoke(function func, function_impl impl,
 
 			args_value[0] = ID2SYM(rb_function->method_id);
 
-			result_value = rb_funcall2(rb_function->rb_module->instance, rb_intern("send"), 1 + args_size, args_value);
+			result_value = rb_funcall2(rb_function->rb_module->instance, rb_loader_impl_send_id, 1 + args_size, args_value);
 		}
 		else if (invoke_type == FUNCTION_RB_MIXED)
 		{
@@ -382,7 +419,7 @@ function_return function_rb_interface_invoke(function func, function_impl impl,
 
 			args_value[ducktype_args_count + 1] = rb_function->args_hash;
 
-			result_value = rb_funcall2(rb_function->rb_module->instance, rb_intern("send"), 1 + ducktype_args_count + 1, args_value);
+			result_value = rb_funcall2(rb_function->rb_module->instance, rb_loader_impl_send_id, 1 + ducktype_args_count + 1, args_value);
 		}
 	}
 	else
@@ -432,7 +469,8 @@ function_interface function_rb_singleton(void)
 		&function_rb_interface_create,
 		&function_rb_interface_invoke,
 		&function_rb_interface_await,
-		&function_rb_interface_destroy
+		&function_rb_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &rb_interface;
@@ -581,7 +619,14 @@ object_interface rb_object_interface_singleton()
 		&rb_object_interface_method_invoke,
 		&rb_object_interface_method_await,
 		&rb_object_interface_destructor,
-		&rb_object_interface_destroy
+		&rb_object_interface_destroy,
+		NULL /* attribute_resolve */,
+		NULL /* attribute_get */,
+		NULL /* attribute_set */,
+		NULL /* attribute_destroy */,
+		NULL /* method_resolve */,
+		NULL /* method_invoke_handle */,
+		NULL /* method_destroy */
 	};
 
 	return &rb_object_interface;
@@ -818,6 +863,8 @@ loader_impl_data rb_loader_impl_initialize(loader_impl impl, configuration confi
 
 		ruby_init_loadpath();
 
+		rb_loader_impl_send_id = rb_intern("send");
+
 		if (rb_loader_impl_initialize_types(impl) != 0)
 		{
 			ruby_cleanup(0);
@@ -924,6 +971,181 @@ VALUE rb_loader_impl_load_data(loader_impl impl, const loader_naming_path path)
 	return Qnil;
 }
 
+static char *rb_loader_impl_cache_path = NULL;
+static int rb_loader_impl_cache_initialized = 1;
+
+static int rb_loader_impl_cache_initialize(void)
+{
+	if (rb_loader_impl_cache_initialized == 0)
+	{
+		return rb_loader_impl_cache_path[0] == '\0';
+	}
+
+	rb_loader_impl_cache_path = environment_variable_create(LOADER_IMPL_RB_CACHE_PATH, NULL);
+
+	if (rb_loader_impl_cache_path == NULL)
+	{
+		return 1;
+	}
+
+	rb_loader_impl_cache_initialized = 0;
+
+	if (rb_loader_impl_cache_path[0] == '\0')
+	{
+		return 1;
+	}
+
+	log_write("metacall", LOG_LEVEL_DEBUG, "Ruby instruction sequence cache path: %s", rb_loader_impl_cache_path);
+
+	return 0;
+}
+
+static uint64_t rb_loader_impl_cache_hash(const char *buffer, size_t size)
+{
+	uint64_t h = LOADER_IMPL_RB_CACHE_HASH_OFFSET;
+
+	size_t iterator;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		h ^= (uint64_t)(unsigned char)buffer[iterator];
+		h *= LOADER_IMPL_RB_CACHE_HASH_PRIME;
+	}
+
+	return h;
+}
+
+static VALUE rb_loader_impl_funcall_protect_invoke(VALUE args)
+{
+	loader_impl_rb_funcall_protect protect = (loader_impl_rb_funcall_protect)args;
+
+	return rb_funcallv(protect->recv, protect->method, protect->argc, protect->argv);
+}
+
+/* Protected call so a raise (stale binary, unsupported runtime, full
+disk) degrades to the uncached path instead of unwinding the loader */
+static VALUE rb_loader_impl_funcall_protect(VALUE recv, const char *method, int argc, VALUE arg0, VALUE arg1, int *error)
+{
+	struct loader_impl_rb_funcall_protect_type protect;
+
+	int state;
+
+	VALUE result;
+
+	protect.recv = recv;
+	protect.method = rb_intern(method);
+	protect.argc = argc;
+	protect.argv[0] = arg0;
+	protect.argv[1] = arg1;
+
+	result = rb_protect(rb_loader_impl_funcall_protect_invoke, (VALUE)&protect, &state);
+
+	if (error != NULL)
+	{
+		*error = state != 0;
+	}
+
+	if (state != 0)
+	{
+		rb_set_errinfo(Qnil);
+
+		return Qnil;
+	}
+
+	return result;
+}
+
+static int rb_loader_impl_cache_entry_path(uint64_t h, char entry_path[], size_t entry_path_size)
+{
+	/* The runtime version is part of the key, the binary format is not
+	stable across Ruby releases */
+	int result = snprintf(entry_path, entry_path_size, "%s/%s-%016" PRIx64 ".iseq", rb_loader_impl_cache_path, ruby_version, h);
+
+	return !(result > 0 && (size_t)result < entry_path_size);
+}
+
+/* Evaluate the module source through the instruction sequence cache,
+a warm boot deserializes the compiled artifact and skips the parser
+entirely. Returns the module on success, Qnil falls back to the
+uncached evaluation */
+static VALUE rb_loader_impl_cache_eval(VALUE module, VALUE name_capitalized, VALUE module_data)
+{
+	char entry_path[LOADER_IMPL_RB_CACHE_ENTRY_PATH_SIZE];
+
+	uint64_t h;
+
+	VALUE iseq_class, iseq = Qnil, binary, entry;
+
+	int hit = 0, error = 0;
+
+	if (rb_loader_impl_cache_initialize() != 0)
+	{
+		return Qnil;
+	}
+
+	h = rb_loader_impl_cache_hash(RSTRING_PTR(module_data), (size_t)RSTRING_LEN(module_data));
+
+	if (rb_loader_impl_cache_entry_path(h, entry_path, sizeof(entry_path)) != 0)
+	{
+		return Qnil;
+	}
+
+	iseq_class = rb_loader_impl_funcall_protect(rb_cObject, "const_get", 1, rb_str_new_cstr("RubyVM::InstructionSequence"), Qnil, NULL);
+
+	if (iseq_class == Qnil)
+	{
+		return Qnil;
+	}
+
+	entry = rb_str_new_cstr(entry_path);
+
+	if (rb_funcall(rb_cFile, rb_intern("exist?"), 1, entry) == Qtrue)
+	{
+		binary = rb_loader_impl_funcall_protect(rb_cIO, "binread", 1, entry, Qnil, NULL);
+
+		if (binary != Qnil)
+		{
+			iseq = rb_loader_impl_funcall_protect(iseq_class, "load_from_binary", 1, binary, Qnil, NULL);
+
+			hit = iseq != Qnil;
+		}
+	}
+
+	if (iseq == Qnil)
+	{
+		/* Reopen the module around the source so the evaluation below
+		defines into it, matching the module_eval of the uncached path */
+		VALUE wrapped = rb_sprintf("module %s\n%s\nend\n", RSTRING_PTR(name_capitalized), RSTRING_PTR(module_data));
+
+		iseq = rb_loader_impl_funcall_protect(iseq_class, "compile", 1, wrapped, Qnil, NULL);
+
+		if (iseq == Qnil)
+		{
+			return Qnil;
+		}
+	}
+
+	/* A module definition evaluates to nil, only a raise is a failure */
+	(void)rb_loader_impl_funcall_protect(iseq, "eval", 0, Qnil, Qnil, &error);
+
+	if (error != 0)
+	{
+		return Qnil;
+	}
+
+	if (hit == 0)
+	{
+		binary = rb_loader_impl_funcall_protect(iseq, "to_binary", 0, Qnil, Qnil, NULL);
+
+		if (binary != Qnil)
+		{
+			(void)rb_loader_impl_funcall_protect(rb_cIO, "binwrite", 2, entry, binary, NULL);
+		}
+	}
+
+	return module;
+}
+
 VALUE rb_loader_impl_module_eval_protect(VALUE args)
 {
 	/* TODO: Do this properly */
@@ -993,7 +1215,12 @@ loader_impl_rb_module rb_loader_impl_load_from_file_module(loader_impl impl, con
 
 		if (module_data != Qnil)
 		{
-			VALUE result = rb_loader_impl_module_eval(module, module_data);
+			VALUE result = rb_loader_impl_cache_eval(module, name_capitalized, module_data);
+
+			if (result == Qnil)
+			{
+				result = rb_loader_impl_module_eval(module, module_data);
+			}
 
 			if (result != Qnil)
 			{
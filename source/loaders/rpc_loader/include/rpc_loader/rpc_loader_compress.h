@@ -0,0 +1,102 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A plugin for loading rpc endpoints at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use thiz file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef RPC_LOADER_COMPRESS_H
+#define RPC_LOADER_COMPRESS_H 1
+
+#include <rpc_loader/rpc_loader_api.h>
+
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+*	Self contained LZ4 block codec for the rpc payload path. The block
+*	format is the standard one (token, literals, 16 bit offset, match)
+*	so any LZ4 implementation on the remote side can decode it; the
+*	frame layer is replaced by the HTTP envelope, which already carries
+*	the payload length and the uncompressed size header, so neither
+*	side pays for checksums the transport provides for free.
+*/
+
+/**
+*  @brief
+*    Worst case compressed size for an input of @size bytes
+*
+*  @param[in] size
+*    Size in bytes of the data to be compressed
+*
+*  @return
+*    Capacity the destination buffer must provide
+*/
+RPC_LOADER_API size_t rpc_loader_compress_bound(size_t size);
+
+/**
+*  @brief
+*    Compress @src into @dst using the LZ4 block format
+*
+*  @param[in] src
+*    Data to be compressed
+*
+*  @param[in] src_size
+*    Size in bytes of @src
+*
+*  @param[out] dst
+*    Destination buffer for the compressed block
+*
+*  @param[in] dst_capacity
+*    Size in bytes of @dst; passing less than the bound makes the
+*    call fail on incompressible data instead of expanding it
+*
+*  @return
+*    Size of the compressed block, zero when it does not fit @dst
+*/
+RPC_LOADER_API size_t rpc_loader_compress(const char *src, size_t src_size, char *dst, size_t dst_capacity);
+
+/**
+*  @brief
+*    Decompress the LZ4 block @src into @dst
+*
+*  @param[in] src
+*    Compressed block
+*
+*  @param[in] src_size
+*    Size in bytes of @src
+*
+*  @param[out] dst
+*    Destination buffer for the decompressed data
+*
+*  @param[in] dst_capacity
+*    Size in bytes of @dst, the exact uncompressed size is known
+*    from the envelope
+*
+*  @return
+*    Size of the decompressed data, zero on a corrupt block or when
+*    the output exceeds @dst_capacity
+*/
+RPC_LOADER_API size_t rpc_loader_decompress(const char *src, size_t src_size, char *dst, size_t dst_capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RPC_LOADER_COMPRESS_H */
@@ -0,0 +1,340 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A plugin for loading rpc endpoints at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use thiz file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <rpc_loader/rpc_loader_compress.h>
+
+#include <stdint.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+/* LZ4 block format constants, see the upstream specification */
+#define RPC_COMPRESS_MIN_MATCH	   4  /* Matches shorter than this are not encodable */
+#define RPC_COMPRESS_LAST_LITERALS 5  /* The block must end in at least this many literals */
+#define RPC_COMPRESS_MF_LIMIT	   12 /* No match may start closer than this to the end */
+#define RPC_COMPRESS_MAX_DISTANCE  65535
+#define RPC_COMPRESS_ML_MASK	   0x0F
+#define RPC_COMPRESS_RUN_MASK	   0x0F
+
+#define RPC_COMPRESS_HASH_LOG  12
+#define RPC_COMPRESS_HASH_SIZE (1 << RPC_COMPRESS_HASH_LOG)
+
+/* -- Private Methods -- */
+
+static uint32_t rpc_loader_compress_read32(const char *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+
+	return v;
+}
+
+static uint32_t rpc_loader_compress_hash(uint32_t sequence)
+{
+	/* Fibonacci hashing of the 4 byte sequence into the table index */
+	return (sequence * 2654435761U) >> (32 - RPC_COMPRESS_HASH_LOG);
+}
+
+/* -- Methods -- */
+
+size_t rpc_loader_compress_bound(size_t size)
+{
+	return size + (size / 255) + 16;
+}
+
+size_t rpc_loader_compress(const char *src, size_t src_size, char *dst, size_t dst_capacity)
+{
+	uint32_t table[RPC_COMPRESS_HASH_SIZE];
+
+	const char *ip = src;
+	const char *anchor = src;
+	const char *const iend = src + src_size;
+	const char *const mflimit = src_size > RPC_COMPRESS_MF_LIMIT ? iend - RPC_COMPRESS_MF_LIMIT : src;
+	const char *const matchlimit = iend - RPC_COMPRESS_LAST_LITERALS;
+
+	char *op = dst;
+	char *const oend = dst + dst_capacity;
+
+	if (src == NULL || dst == NULL || src_size == 0)
+	{
+		return 0;
+	}
+
+	memset(table, 0, sizeof(table));
+
+	if (src_size >= RPC_COMPRESS_MIN_MATCH + RPC_COMPRESS_LAST_LITERALS)
+	{
+		while (ip < mflimit)
+		{
+			uint32_t h = rpc_loader_compress_hash(rpc_loader_compress_read32(ip));
+
+			const char *match = src + table[h];
+
+			table[h] = (uint32_t)(ip - src);
+
+			if (match >= ip || (size_t)(ip - match) > RPC_COMPRESS_MAX_DISTANCE ||
+				rpc_loader_compress_read32(match) != rpc_loader_compress_read32(ip))
+			{
+				++ip;
+
+				continue;
+			}
+
+			{
+				size_t literal_length = (size_t)(ip - anchor);
+
+				size_t match_length = RPC_COMPRESS_MIN_MATCH;
+
+				char *token;
+
+				/* Extend the match as far as the format allows */
+				while (ip + match_length < matchlimit && ip[match_length] == match[match_length])
+				{
+					++match_length;
+				}
+
+				/* Token plus worst case literal length extension bytes */
+				if (op + 1 + literal_length + (literal_length / 255) + 1 + 2 > oend)
+				{
+					return 0;
+				}
+
+				token = op++;
+
+				if (literal_length >= RPC_COMPRESS_RUN_MASK)
+				{
+					size_t remaining = literal_length - RPC_COMPRESS_RUN_MASK;
+
+					*token = (char)(RPC_COMPRESS_RUN_MASK << 4);
+
+					for (; remaining >= 255; remaining -= 255)
+					{
+						*op++ = (char)255;
+					}
+
+					*op++ = (char)remaining;
+				}
+				else
+				{
+					*token = (char)(literal_length << 4);
+				}
+
+				memcpy(op, anchor, literal_length);
+
+				op += literal_length;
+
+				/* Little endian 16 bit match offset */
+				{
+					uint16_t offset = (uint16_t)(ip - match);
+
+					*op++ = (char)(offset & 0xFF);
+					*op++ = (char)(offset >> 8);
+				}
+
+				{
+					size_t encoded = match_length - RPC_COMPRESS_MIN_MATCH;
+
+					if (encoded >= RPC_COMPRESS_ML_MASK)
+					{
+						size_t remaining = encoded - RPC_COMPRESS_ML_MASK;
+
+						*token |= (char)RPC_COMPRESS_ML_MASK;
+
+						if (op + (remaining / 255) + 1 > oend)
+						{
+							return 0;
+						}
+
+						for (; remaining >= 255; remaining -= 255)
+						{
+							*op++ = (char)255;
+						}
+
+						*op++ = (char)remaining;
+					}
+					else
+					{
+						*token |= (char)encoded;
+					}
+				}
+
+				ip += match_length;
+
+				anchor = ip;
+
+				/* Index the position after the match so adjacent
+				repetitions keep chaining */
+				if (ip < mflimit)
+				{
+					table[rpc_loader_compress_hash(rpc_loader_compress_read32(ip - 2))] = (uint32_t)(ip - 2 - src);
+				}
+			}
+		}
+	}
+
+	/* Trailing literal run closing the block */
+	{
+		size_t literal_length = (size_t)(iend - anchor);
+
+		if (op + 1 + literal_length + (literal_length / 255) + 1 > oend)
+		{
+			return 0;
+		}
+
+		if (literal_length >= RPC_COMPRESS_RUN_MASK)
+		{
+			size_t remaining = literal_length - RPC_COMPRESS_RUN_MASK;
+
+			*op++ = (char)(RPC_COMPRESS_RUN_MASK << 4);
+
+			for (; remaining >= 255; remaining -= 255)
+			{
+				*op++ = (char)255;
+			}
+
+			*op++ = (char)remaining;
+		}
+		else
+		{
+			*op++ = (char)(literal_length << 4);
+		}
+
+		memcpy(op, anchor, literal_length);
+
+		op += literal_length;
+	}
+
+	return (size_t)(op - dst);
+}
+
+size_t rpc_loader_decompress(const char *src, size_t src_size, char *dst, size_t dst_capacity)
+{
+	const char *ip = src;
+	const char *const iend = src + src_size;
+
+	char *op = dst;
+	char *const oend = dst + dst_capacity;
+
+	if (src == NULL || dst == NULL || src_size == 0)
+	{
+		return 0;
+	}
+
+	while (ip < iend)
+	{
+		unsigned char token = (unsigned char)*ip++;
+
+		/* Literal run */
+		size_t length = token >> 4;
+
+		if (length == RPC_COMPRESS_RUN_MASK)
+		{
+			unsigned char byte;
+
+			do
+			{
+				if (ip >= iend)
+				{
+					return 0;
+				}
+
+				byte = (unsigned char)*ip++;
+
+				length += byte;
+			} while (byte == 255);
+		}
+
+		if (length > (size_t)(iend - ip) || length > (size_t)(oend - op))
+		{
+			return 0;
+		}
+
+		memcpy(op, ip, length);
+
+		ip += length;
+		op += length;
+
+		/* The last sequence carries literals only */
+		if (ip >= iend)
+		{
+			break;
+		}
+
+		/* Match copy */
+		if (iend - ip < 2)
+		{
+			return 0;
+		}
+
+		{
+			size_t offset = (size_t)(unsigned char)ip[0] | ((size_t)(unsigned char)ip[1] << 8);
+
+			ip += 2;
+
+			if (offset == 0 || offset > (size_t)(op - dst))
+			{
+				return 0;
+			}
+
+			length = (size_t)(token & RPC_COMPRESS_ML_MASK);
+
+			if (length == RPC_COMPRESS_ML_MASK)
+			{
+				unsigned char byte;
+
+				do
+				{
+					if (ip >= iend)
+					{
+						return 0;
+					}
+
+					byte = (unsigned char)*ip++;
+
+					length += byte;
+				} while (byte == 255);
+			}
+
+			length += RPC_COMPRESS_MIN_MATCH;
+
+			if (length > (size_t)(oend - op))
+			{
+				return 0;
+			}
+
+			/* Byte copy, matches may overlap their own output */
+			{
+				const char *match = op - offset;
+
+				size_t position;
+
+				for (position = 0; position < length; ++position)
+				{
+					op[position] = match[position];
+				}
+
+				op += length;
+			}
+		}
+	}
+
+	return (size_t)(op - dst);
+}
@@ -18,11 +18,14 @@
  *
  */
 
+#include <rpc_loader/rpc_loader_compress.h>
 #include <rpc_loader/rpc_loader_impl.h>
 
 #include <loader/loader.h>
 #include <loader/loader_impl.h>
 
+#include <portability/portability_probe.h>
+
 #include <metacall/metacall.h>
 #include <reflect/reflect_context.h>
 #include <reflect/reflect_function.h>
@@ -35,23 +38,65 @@
 #include <curl/curl.h>
 
 #include <cstdlib>
+#include <cctype>
+#include <cinttypes>
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <map>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
 #include <vector>
 
+/* Payloads below the threshold travel uncompressed, the token and
+offset overhead plus the CPU round trip is not worth a small body */
+#define RPC_LOADER_COMPRESS_THRESHOLD ((size_t)1024)
+
+/* Content coding negotiated with the remote: an 8 byte little endian
+uncompressed size followed by one LZ4 block, the HTTP envelope frames
+the compressed length so no further framing is needed */
+#define RPC_LOADER_COMPRESS_ENCODING "x-metacall-lz4"
+
+#define RPC_LOADER_COMPRESS_PREFIX_SIZE ((size_t)8)
+
+/* Upper bound accepted for a decompressed response, a corrupt or
+hostile size prefix must not turn into an allocation of that size */
+#define RPC_LOADER_COMPRESS_MAX_SIZE ((size_t)1 << 30)
+
+typedef struct loader_impl_rpc_metadata_type
+{
+	std::string etag; /* Validator sent by the remote, replayed as If-None-Match */
+	void *inspect;	  /* Parsed inspect value, copied into each rediscover */
+
+} loader_impl_rpc_metadata;
+
 typedef struct loader_impl_rpc_type
 {
 	CURL *discover_curl;
-	CURL *invoke_curl;
+	CURLSH *share;						   /* Shared connection, DNS and TLS session caches */
+	struct curl_slist *invoke_headers;	   /* Headers reused by every pooled invoke handle */
+	struct curl_slist *invoke_headers_lz4; /* Same headers plus the content coding of a compressed body */
+	std::vector<CURL *> invoke_pool;	   /* Idle invoke handles, each keeps its connections alive */
+	std::mutex invoke_pool_mutex;
 	void *allocator;
 	std::map<type_id, type> types;
 	std::set<std::string> execution_paths;
+	std::set<std::string> compress_urls;							/* Endpoints that advertised the compression coding during discover */
+	std::map<std::string, loader_impl_rpc_metadata> metadata_cache; /* Discovered inspect metadata keyed by endpoint */
+
+	/* Compression counters surfaced through the probes and the
+	shutdown summary */
+	std::atomic<uint64_t> compress_count{ 0 };
+	std::atomic<uint64_t> compress_skipped{ 0 };
+	std::atomic<uint64_t> compress_bytes_in{ 0 };
+	std::atomic<uint64_t> compress_bytes_out{ 0 };
+	std::atomic<uint64_t> decompress_count{ 0 };
+	std::atomic<uint64_t> decompress_bytes_in{ 0 };
+	std::atomic<uint64_t> decompress_bytes_out{ 0 };
 
 } * loader_impl_rpc;
 
@@ -65,6 +110,7 @@ typedef struct loader_impl_rpc_function_type
 {
 	loader_impl_rpc rpc_impl;
 	std::string url;
+	bool compress; /* The endpoint negotiated compressed request bodies */
 
 } * loader_impl_rpc_function;
 
@@ -74,8 +120,19 @@ typedef struct loader_impl_rpc_write_data_type
 
 } * loader_impl_rpc_write_data;
 
+/* Response headers of one transfer, filled by the header callback */
+typedef struct loader_impl_rpc_headers_type
+{
+	std::string etag;			  /* Validator sent by the remote, replayed as If-None-Match */
+	std::string content_encoding; /* Coding of the response body */
+	bool accept_compressed;		  /* The remote advertised the compression coding for requests */
+
+} * loader_impl_rpc_headers;
+
 static size_t rpc_loader_impl_write_data(void *buffer, size_t size, size_t nmemb, void *userp);
-static int rpc_loader_impl_discover_value(loader_impl_rpc rpc_impl, std::string &url, value v, context ctx);
+static size_t rpc_loader_impl_header_data(void *buffer, size_t size, size_t nmemb, void *userp);
+static int rpc_loader_impl_decompress_response(loader_impl_rpc rpc_impl, loader_impl_rpc_headers headers, std::string &body);
+static int rpc_loader_impl_discover_value(loader_impl_rpc rpc_impl, std::string &url, value v, context ctx, bool compress);
 static int rpc_loader_impl_initialize_types(loader_impl impl, loader_impl_rpc rpc_impl);
 
 size_t rpc_loader_impl_write_data(void *buffer, size_t size, size_t nmemb, void *userp)
@@ -93,6 +150,265 @@ size_t rpc_loader_impl_write_data(void *buffer, size_t size, size_t nmemb, void
 	return data_len;
 }
 
+/* Case insensitive match of a response header name, on a hit the
+value boundaries are returned with the surrounding whitespace and the
+line terminator trimmed */
+static bool rpc_loader_impl_header_value(const char *line, size_t data_len, const char *name, size_t name_len, size_t *value_begin, size_t *value_end)
+{
+	size_t iterator;
+
+	if (data_len <= name_len)
+	{
+		return false;
+	}
+
+	for (iterator = 0; iterator < name_len; ++iterator)
+	{
+		if (tolower(static_cast<unsigned char>(line[iterator])) != name[iterator])
+		{
+			return false;
+		}
+	}
+
+	{
+		size_t begin = name_len, end = data_len;
+
+		while (begin < end && (line[begin] == ' ' || line[begin] == '\t'))
+		{
+			++begin;
+		}
+
+		while (end > begin && (line[end - 1] == '\r' || line[end - 1] == '\n' || line[end - 1] == ' ' || line[end - 1] == '\t'))
+		{
+			--end;
+		}
+
+		*value_begin = begin;
+		*value_end = end;
+	}
+
+	return true;
+}
+
+size_t rpc_loader_impl_header_data(void *buffer, size_t size, size_t nmemb, void *userp)
+{
+	loader_impl_rpc_headers headers = static_cast<loader_impl_rpc_headers>(userp);
+	const size_t data_len = size * nmemb;
+	const char *line = static_cast<const char *>(buffer);
+
+	static const char etag_name[] = "etag:";
+	static const char encoding_name[] = "content-encoding:";
+	static const char accept_name[] = "accept-encoding:";
+
+	size_t begin, end;
+
+	try
+	{
+		/* The value is kept verbatim (including the quotes) for the
+		conditional request */
+		if (rpc_loader_impl_header_value(line, data_len, etag_name, sizeof(etag_name) - 1, &begin, &end))
+		{
+			headers->etag.assign(&line[begin], end - begin);
+		}
+		else if (rpc_loader_impl_header_value(line, data_len, encoding_name, sizeof(encoding_name) - 1, &begin, &end))
+		{
+			headers->content_encoding.assign(&line[begin], end - begin);
+		}
+		else if (rpc_loader_impl_header_value(line, data_len, accept_name, sizeof(accept_name) - 1, &begin, &end))
+		{
+			/* The remote advertising the coding in its own responses
+			means it decodes it on requests as well */
+			std::string accepted(&line[begin], end - begin);
+
+			if (accepted.find(RPC_LOADER_COMPRESS_ENCODING) != std::string::npos)
+			{
+				headers->accept_compressed = true;
+			}
+		}
+	}
+	catch (std::bad_alloc &e)
+	{
+		return 0;
+	}
+
+	return data_len;
+}
+
+/* The binary serial frames its own sizes, its buffers carry the exact
+byte count while the JSON serial keeps the trailing null convention */
+static int rpc_loader_impl_serial_binary(void)
+{
+	return strcmp(metacall_serial(), "binary") == 0;
+}
+
+/* Compress a request body into an allocator owned buffer prefixed
+with the uncompressed size, null when the body does not shrink */
+static char *rpc_loader_impl_compress_body(loader_impl_rpc rpc_impl, const char *buffer, size_t size, size_t *compressed_size)
+{
+	char *compressed = static_cast<char *>(metacall_allocator_alloc(rpc_impl->allocator, RPC_LOADER_COMPRESS_PREFIX_SIZE + rpc_loader_compress_bound(size)));
+
+	size_t block_size;
+
+	if (compressed == NULL)
+	{
+		return NULL;
+	}
+
+	/* Capping the capacity at one byte less than the input makes the
+	codec fail on incompressible bodies, which then travel raw */
+	block_size = rpc_loader_compress(buffer, size, compressed + RPC_LOADER_COMPRESS_PREFIX_SIZE, size - 1);
+
+	if (block_size == 0)
+	{
+		metacall_allocator_free(rpc_impl->allocator, compressed);
+
+		return NULL;
+	}
+
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < RPC_LOADER_COMPRESS_PREFIX_SIZE; ++iterator)
+		{
+			compressed[iterator] = (char)((static_cast<uint64_t>(size) >> (iterator * 8)) & 0xFF);
+		}
+	}
+
+	*compressed_size = RPC_LOADER_COMPRESS_PREFIX_SIZE + block_size;
+
+	rpc_impl->compress_count.fetch_add(1, std::memory_order_relaxed);
+	rpc_impl->compress_bytes_in.fetch_add(size, std::memory_order_relaxed);
+	rpc_impl->compress_bytes_out.fetch_add(*compressed_size, std::memory_order_relaxed);
+
+	PORTABILITY_PROBE_2(rpc_compress, size, *compressed_size);
+
+	return compressed;
+}
+
+/* Decode a response body in place when the remote sent it under the
+negotiated coding, bodies without the coding pass through untouched */
+int rpc_loader_impl_decompress_response(loader_impl_rpc rpc_impl, loader_impl_rpc_headers headers, std::string &body)
+{
+	uint64_t decompressed_size = 0;
+
+	if (headers->content_encoding.compare(RPC_LOADER_COMPRESS_ENCODING) != 0)
+	{
+		return 0;
+	}
+
+	if (body.length() <= RPC_LOADER_COMPRESS_PREFIX_SIZE)
+	{
+		return 1;
+	}
+
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < RPC_LOADER_COMPRESS_PREFIX_SIZE; ++iterator)
+		{
+			decompressed_size |= static_cast<uint64_t>(static_cast<unsigned char>(body[iterator])) << (iterator * 8);
+		}
+	}
+
+	if (decompressed_size == 0 || decompressed_size > RPC_LOADER_COMPRESS_MAX_SIZE)
+	{
+		return 1;
+	}
+
+	try
+	{
+		std::string decompressed(static_cast<size_t>(decompressed_size), '\0');
+
+		if (rpc_loader_decompress(body.data() + RPC_LOADER_COMPRESS_PREFIX_SIZE, body.length() - RPC_LOADER_COMPRESS_PREFIX_SIZE, &decompressed[0], static_cast<size_t>(decompressed_size)) != decompressed_size)
+		{
+			return 1;
+		}
+
+		rpc_impl->decompress_count.fetch_add(1, std::memory_order_relaxed);
+		rpc_impl->decompress_bytes_in.fetch_add(body.length(), std::memory_order_relaxed);
+		rpc_impl->decompress_bytes_out.fetch_add(static_cast<size_t>(decompressed_size), std::memory_order_relaxed);
+
+		PORTABILITY_PROBE_2(rpc_decompress, body.length(), decompressed_size);
+
+		body.swap(decompressed);
+	}
+	catch (std::bad_alloc &e)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+/* Locks protecting the shared caches, libcurl tells us which cache it
+is about to touch through the curl_lock_data enum */
+static std::mutex rpc_loader_impl_share_locks[CURL_LOCK_DATA_LAST];
+
+static void rpc_loader_impl_share_lock(CURL *handle, curl_lock_data data, curl_lock_access access, void *userptr)
+{
+	(void)handle;
+	(void)access;
+	(void)userptr;
+
+	rpc_loader_impl_share_locks[data].lock();
+}
+
+static void rpc_loader_impl_share_unlock(CURL *handle, curl_lock_data data, void *userptr)
+{
+	(void)handle;
+	(void)userptr;
+
+	rpc_loader_impl_share_locks[data].unlock();
+}
+
+/* Take an idle invoke handle from the pool or create one on demand,
+handles persist so their connections stay established across calls */
+static CURL *rpc_loader_impl_invoke_acquire(loader_impl_rpc rpc_impl)
+{
+	{
+		std::lock_guard<std::mutex> lock(rpc_impl->invoke_pool_mutex);
+
+		if (!rpc_impl->invoke_pool.empty())
+		{
+			CURL *curl = rpc_impl->invoke_pool.back();
+
+			rpc_impl->invoke_pool.pop_back();
+
+			return curl;
+		}
+	}
+
+	CURL *curl = curl_easy_init();
+
+	if (curl == NULL)
+	{
+		return NULL;
+	}
+
+	curl_easy_setopt(curl, CURLOPT_VERBOSE, 0L);
+	curl_easy_setopt(curl, CURLOPT_HEADER, 0L);
+	curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "POST");
+	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, rpc_impl->invoke_headers);
+	curl_easy_setopt(curl, CURLOPT_USERAGENT, "librpc_loader/0.1");
+	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, rpc_loader_impl_write_data);
+	curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+	curl_easy_setopt(curl, CURLOPT_SHARE, rpc_impl->share);
+#if LIBCURL_VERSION_NUM >= 0x072B00 /* 7.43.0 */
+	/* Wait for an existing connection instead of opening another one,
+	concurrent requests multiplex over it when the server speaks h2 */
+	curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+#endif
+
+	return curl;
+}
+
+static void rpc_loader_impl_invoke_release(loader_impl_rpc rpc_impl, CURL *curl)
+{
+	std::lock_guard<std::mutex> lock(rpc_impl->invoke_pool_mutex);
+
+	rpc_impl->invoke_pool.push_back(curl);
+}
+
 int type_rpc_interface_create(type t, type_impl impl)
 {
 	/* TODO */
@@ -161,17 +477,61 @@ function_return function_rpc_interface_invoke(function func, function_impl impl,
 		return NULL;
 	}
 
-	/* Execute a POST to the endpoint */
+	/* Compress the body when the endpoint negotiated the coding and
+	the payload is large enough to pay for the round trip */
+	const size_t wire_size = rpc_loader_impl_serial_binary() ? body_request_size : body_request_size - 1;
+
+	char *compressed = NULL;
+	size_t compressed_size = 0;
+
+	if (rpc_function->compress && wire_size >= RPC_LOADER_COMPRESS_THRESHOLD)
+	{
+		compressed = rpc_loader_impl_compress_body(rpc_impl, buffer, wire_size, &compressed_size);
+	}
+	else if (rpc_function->compress)
+	{
+		rpc_impl->compress_skipped.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/* Execute a POST to the endpoint through a pooled handle, calls
+	from different threads each take their own handle and the shared
+	caches keep the connections, sessions and DNS entries warm */
 	loader_impl_rpc_write_data_type write_data;
+	loader_impl_rpc_headers_type headers;
+
+	headers.accept_compressed = false;
+
+	CURL *invoke_curl = rpc_loader_impl_invoke_acquire(rpc_impl);
+
+	if (invoke_curl == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Could not acquire a CURL invoke handle for the endpoint %s", rpc_function->url.c_str());
+		if (compressed != NULL)
+		{
+			metacall_allocator_free(rpc_impl->allocator, compressed);
+		}
+		metacall_allocator_free(rpc_function->rpc_impl->allocator, buffer);
+		return NULL;
+	}
+
+	curl_easy_setopt(invoke_curl, CURLOPT_URL, rpc_function->url.c_str());
+	curl_easy_setopt(invoke_curl, CURLOPT_POSTFIELDS, compressed != NULL ? compressed : buffer);
+	curl_easy_setopt(invoke_curl, CURLOPT_POSTFIELDSIZE, compressed != NULL ? compressed_size : wire_size);
+	curl_easy_setopt(invoke_curl, CURLOPT_HTTPHEADER, compressed != NULL ? rpc_impl->invoke_headers_lz4 : rpc_impl->invoke_headers);
+	curl_easy_setopt(invoke_curl, CURLOPT_WRITEDATA, static_cast<loader_impl_rpc_write_data>(&write_data));
+	curl_easy_setopt(invoke_curl, CURLOPT_HEADERFUNCTION, rpc_loader_impl_header_data);
+	curl_easy_setopt(invoke_curl, CURLOPT_HEADERDATA, static_cast<loader_impl_rpc_headers>(&headers));
 
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_URL, rpc_function->url.c_str());
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_POSTFIELDS, buffer);
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_POSTFIELDSIZE, body_request_size - 1);
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_WRITEDATA, static_cast<loader_impl_rpc_write_data>(&write_data));
+	CURLcode res = curl_easy_perform(invoke_curl);
 
-	CURLcode res = curl_easy_perform(rpc_impl->invoke_curl);
+	rpc_loader_impl_invoke_release(rpc_impl, invoke_curl);
+
+	/* Clear the request buffers */
+	if (compressed != NULL)
+	{
+		metacall_allocator_free(rpc_impl->allocator, compressed);
+	}
 
-	/* Clear the request buffer */
 	metacall_allocator_free(rpc_function->rpc_impl->allocator, buffer);
 
 	if (res != CURLE_OK)
@@ -180,8 +540,14 @@ function_return function_rpc_interface_invoke(function func, function_impl impl,
 		return NULL;
 	}
 
+	if (rpc_loader_impl_decompress_response(rpc_impl, &headers, write_data.buffer) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Could not decompress the call result from API endpoint %s", rpc_function->url.c_str());
+		return NULL;
+	}
+
 	/* Deserialize the call result data */
-	const size_t write_data_size = write_data.buffer.length() + 1;
+	const size_t write_data_size = rpc_loader_impl_serial_binary() ? write_data.buffer.length() : write_data.buffer.length() + 1;
 
 	void *result_value = metacall_deserialize(metacall_serial(), write_data.buffer.c_str(), write_data_size, rpc_impl->allocator);
 
@@ -223,7 +589,8 @@ function_interface function_rpc_singleton(void)
 		&function_rpc_interface_create,
 		&function_rpc_interface_invoke,
 		&function_rpc_interface_await,
-		&function_rpc_interface_destroy
+		&function_rpc_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &rpc_function_interface;
@@ -319,12 +686,13 @@ loader_impl_data rpc_loader_impl_initialize(loader_impl impl, configuration conf
 	curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_HEADER, 0L);
 	curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_WRITEFUNCTION, rpc_loader_impl_write_data);
 
-	/* Initialize invoke CURL object */
-	rpc_impl->invoke_curl = curl_easy_init();
+	/* Initialize the shared caches, pooled invoke handles reuse each
+	other's established connections, DNS entries and TLS sessions */
+	rpc_impl->share = curl_share_init();
 
-	if (rpc_impl->invoke_curl == NULL)
+	if (rpc_impl->share == NULL)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Could not create CURL invoke object");
+		log_write("metacall", LOG_LEVEL_ERROR, "Could not create CURL share object");
 
 		curl_easy_cleanup(rpc_impl->discover_curl);
 
@@ -335,21 +703,65 @@ loader_impl_data rpc_loader_impl_initialize(loader_impl impl, configuration conf
 		return NULL;
 	}
 
-	static struct curl_slist *headers = NULL;
+	curl_share_setopt(rpc_impl->share, CURLSHOPT_LOCKFUNC, rpc_loader_impl_share_lock);
+	curl_share_setopt(rpc_impl->share, CURLSHOPT_UNLOCKFUNC, rpc_loader_impl_share_unlock);
+	curl_share_setopt(rpc_impl->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+	curl_share_setopt(rpc_impl->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900 /* 7.57.0 */
+	curl_share_setopt(rpc_impl->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+
+	/* The headers follow the configured serial, the binary format posts
+	raw octets while the default serial keeps the JSON content type */
+	if (rpc_loader_impl_serial_binary())
+	{
+		rpc_impl->invoke_headers = curl_slist_append(NULL, "Accept: application/octet-stream");
+		rpc_impl->invoke_headers = curl_slist_append(rpc_impl->invoke_headers, "Content-Type: application/octet-stream");
+	}
+	else
+	{
+		rpc_impl->invoke_headers = curl_slist_append(NULL, "Accept: application/json");
+		rpc_impl->invoke_headers = curl_slist_append(rpc_impl->invoke_headers, "Content-Type: application/json");
+		rpc_impl->invoke_headers = curl_slist_append(rpc_impl->invoke_headers, "charset: utf-8");
+	}
+
+	/* Advertise the compression coding so remotes may compress their
+	responses, and keep a second list carrying the content coding for
+	the requests whose body travels compressed */
+	rpc_impl->invoke_headers = curl_slist_append(rpc_impl->invoke_headers, "Accept-Encoding: " RPC_LOADER_COMPRESS_ENCODING);
+
+	rpc_impl->invoke_headers_lz4 = NULL;
 
-	if (headers == NULL)
+	for (struct curl_slist *header = rpc_impl->invoke_headers; header != NULL; header = header->next)
 	{
-		headers = curl_slist_append(headers, "Accept: application/json");
-		headers = curl_slist_append(headers, "Content-Type: application/json");
-		headers = curl_slist_append(headers, "charset: utf-8");
+		rpc_impl->invoke_headers_lz4 = curl_slist_append(rpc_impl->invoke_headers_lz4, header->data);
+	}
+
+	rpc_impl->invoke_headers_lz4 = curl_slist_append(rpc_impl->invoke_headers_lz4, "Content-Encoding: " RPC_LOADER_COMPRESS_ENCODING);
+
+	/* Warm the pool with the first invoke handle */
+	CURL *invoke_curl = rpc_loader_impl_invoke_acquire(rpc_impl);
+
+	if (invoke_curl == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Could not create CURL invoke object");
+
+		curl_slist_free_all(rpc_impl->invoke_headers_lz4);
+
+		curl_slist_free_all(rpc_impl->invoke_headers);
+
+		curl_share_cleanup(rpc_impl->share);
+
+		curl_easy_cleanup(rpc_impl->discover_curl);
+
+		metacall_allocator_destroy(rpc_impl->allocator);
+
+		delete rpc_impl;
+
+		return NULL;
 	}
 
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_VERBOSE, 0L);
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_HEADER, 0L);
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_CUSTOMREQUEST, "POST");
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_HTTPHEADER, headers);
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_USERAGENT, "librpc_loader/0.1");
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_WRITEFUNCTION, rpc_loader_impl_write_data);
+	rpc_loader_impl_invoke_release(rpc_impl, invoke_curl);
 
 	if (rpc_loader_impl_initialize_types(impl, rpc_impl) != 0)
 	{
@@ -357,7 +769,16 @@ loader_impl_data rpc_loader_impl_initialize(loader_impl impl, configuration conf
 
 		curl_easy_cleanup(rpc_impl->discover_curl);
 
-		curl_easy_cleanup(rpc_impl->invoke_curl);
+		for (CURL *curl : rpc_impl->invoke_pool)
+		{
+			curl_easy_cleanup(curl);
+		}
+
+		curl_slist_free_all(rpc_impl->invoke_headers_lz4);
+
+		curl_slist_free_all(rpc_impl->invoke_headers);
+
+		curl_share_cleanup(rpc_impl->share);
 
 		metacall_allocator_destroy(rpc_impl->allocator);
 
@@ -556,7 +977,7 @@ static std::map<std::string, void *> rpc_loader_impl_value_to_map(void *v)
 	return m;
 }
 
-int rpc_loader_impl_discover_value(loader_impl_rpc rpc_impl, std::string &url, void *v, context ctx)
+int rpc_loader_impl_discover_value(loader_impl_rpc rpc_impl, std::string &url, void *v, context ctx, bool compress)
 {
 	void **lang_map = metacall_value_to_map(v);
 
@@ -585,6 +1006,7 @@ int rpc_loader_impl_discover_value(loader_impl_rpc rpc_impl, std::string &url, v
 
 				rpc_func->url = url + (is_async ? "await/" : "call/") + func_name;
 				rpc_func->rpc_impl = rpc_impl;
+				rpc_func->compress = compress;
 
 				function f = function_create(func_name, args_count, rpc_func, &function_rpc_singleton);
 
@@ -636,30 +1058,114 @@ int rpc_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx
 
 		std::string inspect_url = rpc_handle->urls[iterator] + "inspect";
 
+		loader_impl_rpc_headers_type headers;
+
+		headers.accept_compressed = false;
+
+		/* Revalidate cached metadata with a conditional request, a
+		remote answering 304 saves the transfer and the parse of an
+		inspect body that has not changed since the last discover */
+		std::map<std::string, loader_impl_rpc_metadata>::iterator cached = rpc_impl->metadata_cache.find(inspect_url);
+
+		struct curl_slist *discover_headers = curl_slist_append(NULL, "Accept-Encoding: " RPC_LOADER_COMPRESS_ENCODING);
+
+		if (cached != rpc_impl->metadata_cache.end() && !cached->second.etag.empty())
+		{
+			std::string condition = "If-None-Match: " + cached->second.etag;
+
+			discover_headers = curl_slist_append(discover_headers, condition.c_str());
+		}
+
 		curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_URL, inspect_url.c_str());
 		curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_WRITEDATA, static_cast<loader_impl_rpc_write_data>(&write_data));
+		curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_HEADERFUNCTION, rpc_loader_impl_header_data);
+		curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_HEADERDATA, static_cast<loader_impl_rpc_headers>(&headers));
+		curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_HTTPHEADER, discover_headers);
 
 		CURLcode res = curl_easy_perform(rpc_impl->discover_curl);
 
+		curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_HTTPHEADER, NULL);
+
+		curl_slist_free_all(discover_headers);
+
 		if (res != CURLE_OK)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Could not access the API endpoint %s [%s]", rpc_handle->urls[iterator].c_str(), curl_easy_strerror(res));
 			return 1;
 		}
 
-		/* Deserialize the inspect data */
-		const size_t size = write_data.buffer.length() + 1;
+		long response_code = 0;
+
+		curl_easy_getinfo(rpc_impl->discover_curl, CURLINFO_RESPONSE_CODE, &response_code);
 
-		void *inspect_value = metacall_deserialize(metacall_serial(), write_data.buffer.c_str(), size, rpc_impl->allocator);
+		/* The advertisement seen during discover decides whether the
+		invokes of this endpoint compress their request bodies */
+		if (headers.accept_compressed)
+		{
+			rpc_impl->compress_urls.insert(rpc_handle->urls[iterator]);
+		}
+		else
+		{
+			rpc_impl->compress_urls.erase(rpc_handle->urls[iterator]);
+		}
 
-		if (inspect_value == NULL)
+		if (rpc_loader_impl_decompress_response(rpc_impl, &headers, write_data.buffer) != 0)
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Could not deserialize the inspect data from API endpoint %s", rpc_handle->urls[iterator].c_str());
+			log_write("metacall", LOG_LEVEL_ERROR, "Could not decompress the inspect data from API endpoint %s", rpc_handle->urls[iterator].c_str());
 			return 1;
 		}
 
+		void *inspect_value;
+
+		if (response_code == 304 && cached != rpc_impl->metadata_cache.end())
+		{
+			/* Not modified, the cached value stands in for the body */
+			inspect_value = metacall_value_copy(cached->second.inspect);
+		}
+		else
+		{
+			/* Deserialize the inspect data */
+			const size_t size = write_data.buffer.length() + 1;
+
+			inspect_value = metacall_deserialize(metacall_serial(), write_data.buffer.c_str(), size, rpc_impl->allocator);
+
+			if (inspect_value == NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Could not deserialize the inspect data from API endpoint %s", rpc_handle->urls[iterator].c_str());
+				return 1;
+			}
+
+			if (!headers.etag.empty())
+			{
+				/* Cache the parsed value under the fresh validator */
+				if (cached != rpc_impl->metadata_cache.end())
+				{
+					metacall_value_destroy(cached->second.inspect);
+
+					cached->second.etag = headers.etag;
+					cached->second.inspect = metacall_value_copy(inspect_value);
+				}
+				else
+				{
+					loader_impl_rpc_metadata metadata;
+
+					metadata.etag = headers.etag;
+					metadata.inspect = metacall_value_copy(inspect_value);
+
+					rpc_impl->metadata_cache[inspect_url] = metadata;
+				}
+			}
+			else if (cached != rpc_impl->metadata_cache.end())
+			{
+				/* The remote stopped sending validators, drop the entry */
+				metacall_value_destroy(cached->second.inspect);
+
+				rpc_impl->metadata_cache.erase(cached);
+			}
+		}
+
 		/* Discover the functions from the inspect value */
-		if (rpc_loader_impl_discover_value(rpc_impl, rpc_handle->urls[iterator], inspect_value, ctx) != 0)
+		if (rpc_loader_impl_discover_value(rpc_impl, rpc_handle->urls[iterator], inspect_value, ctx, headers.accept_compressed) != 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid inspect value discover from API endpoint %s", rpc_handle->urls[iterator].c_str());
 			return 1;
@@ -676,11 +1182,31 @@ int rpc_loader_impl_destroy(loader_impl impl)
 	/* Destroy children loaders */
 	loader_unload_children(impl);
 
+	for (std::map<std::string, loader_impl_rpc_metadata>::iterator it = rpc_impl->metadata_cache.begin(); it != rpc_impl->metadata_cache.end(); ++it)
+	{
+		metacall_value_destroy(it->second.inspect);
+	}
+
+	/* Compression summary of the lifetime of the loader */
+	log_write("metacall", LOG_LEVEL_DEBUG, "RPC compression: %" PRIu64 " requests compressed (%" PRIu64 " -> %" PRIu64 " bytes), %" PRIu64 " below threshold, %" PRIu64 " responses decompressed (%" PRIu64 " -> %" PRIu64 " bytes)",
+		rpc_impl->compress_count.load(), rpc_impl->compress_bytes_in.load(), rpc_impl->compress_bytes_out.load(),
+		rpc_impl->compress_skipped.load(), rpc_impl->decompress_count.load(), rpc_impl->decompress_bytes_in.load(), rpc_impl->decompress_bytes_out.load());
+
 	metacall_allocator_destroy(rpc_impl->allocator);
 
 	curl_easy_cleanup(rpc_impl->discover_curl);
 
-	curl_easy_cleanup(rpc_impl->invoke_curl);
+	/* The easy handles hold references into the share, release them first */
+	for (CURL *curl : rpc_impl->invoke_pool)
+	{
+		curl_easy_cleanup(curl);
+	}
+
+	curl_slist_free_all(rpc_impl->invoke_headers_lz4);
+
+	curl_slist_free_all(rpc_impl->invoke_headers);
+
+	curl_share_cleanup(rpc_impl->share);
 
 	curl_global_cleanup();
 
@@ -1,5 +1,6 @@
 #!/usr/bin/env node
-import { readFileSync } from 'fs';
+import { createHash } from 'crypto';
+import { mkdirSync, readFileSync, writeFileSync } from 'fs';
 import * as Module from 'module';
 import { EOL } from 'os';
 import * as path from 'path';
@@ -40,6 +41,60 @@ type MetacallHandle = Record<string, unknown>;
 
 const discoverTypes = new Map<string, MetacallExports>();
 
+/**
+ * Transpilation cache: emitted JavaScript (and source maps, when the
+ * compiler options generate them) plus the discovered export types are
+ * persisted on disk keyed by a hash of the sources, the compiler options
+ * and the TypeScript version, so reloading unchanged TypeScript skips
+ * the compiler entirely. Opt-in through TS_LOADER_CACHE_PATH.
+ */
+type CacheEntry = {
+	fileName: string;
+	data: string;
+	exports: MetacallExports;
+};
+
+const cachePath = process.env['TS_LOADER_CACHE_PATH'] || '';
+
+const cacheKey = (rootNames: readonly string[], options: ts.CompilerOptions, sources?: string[]): string | null => {
+	if (cachePath === '') {
+		return null;
+	}
+	try {
+		const hash = createHash('sha256');
+		hash.update(ts.version);
+		hash.update(JSON.stringify(options));
+		for (const name of rootNames) {
+			hash.update(name);
+			hash.update(sources ? sources.shift() ?? '' : readFileSync(name, 'utf8'));
+		}
+		return hash.digest('hex');
+	} catch (_) {
+		return null;
+	}
+};
+
+const cacheFetch = (key: string | null): CacheEntry[] | null => {
+	if (key === null) {
+		return null;
+	}
+	try {
+		return JSON.parse(readFileSync(path.join(cachePath, `${key}.json`), 'utf8'));
+	} catch (_) {
+		return null;
+	}
+};
+
+const cacheStore = (key: string | null, entries: CacheEntry[]): void => {
+	if (key === null || entries.length === 0) {
+		return;
+	}
+	try {
+		mkdirSync(cachePath, { recursive: true });
+		writeFileSync(path.join(cachePath, `${key}.json`), JSON.stringify(entries));
+	} catch (_) { /* A failed store only costs the next boot a recompile */ }
+};
+
 /** Logging util */
 const log = process.env.METACALL_DEBUG ? console.log : noop;
 
@@ -191,26 +246,51 @@ const fileResolve = (p: string): string => {
 export const load_from_file = safe(function load_from_file(paths: string[]) {
 	const result: MetacallHandle = {};
 	const options = getProgramOptions(paths.map(p => fileResolve(p)));
+
+	/* Compile the emitted JavaScript and wire the discovered export
+	types, shared between the compiler emit and the cache replay */
+	const compileEmit = (fileName: string, data: string, exportTypes: MetacallExports) => {
+		const m = new Module(fileName);
+		(m as any)._compile(data, fileName);
+		const wrappedExports = wrapFunctionExport(m.exports);
+		for (const [name, handle] of Object.entries(exportTypes)) {
+			handle.ptr = wrappedExports[name] as anyF;
+		}
+		discoverTypes.set(fileName, {
+			...(discoverTypes.get(fileName) ?? {}),
+			...exportTypes,
+		});
+		result[fileName] = wrappedExports;
+	};
+
+	const key = cacheKey(options.rootNames, options.options);
+	const cached = cacheFetch(key);
+
+	if (cached !== null) {
+		for (const entry of cached) {
+			compileEmit(entry.fileName, entry.data, entry.exports);
+		}
+		return Object.keys(result).length === 0 ? null : result;
+	}
+
+	const emitted: CacheEntry[] = [];
 	const p = ts.createProgram(options);
 	// TODO: Handle the emitSkipped?
 	const exportTypes = getMetacallExportTypes(p, (sourceFile, exportTypes) => {
 		const { diagnostics /*, emitSkipped */ } = p.emit(sourceFile, (fileName, data) => {
-			const m = new Module(fileName);
-			(m as any)._compile(data, fileName);
-			const wrappedExports = wrapFunctionExport(m.exports);
-			for (const [name, handle] of Object.entries(exportTypes)) {
-				handle.ptr = wrappedExports[name] as anyF;
-			}
-			discoverTypes.set(fileName, {
-				...(discoverTypes.get(fileName) ?? {}),
-				...exportTypes,
-			});
-			result[fileName] = wrappedExports;
+			compileEmit(fileName, data, exportTypes);
+			emitted.push({ fileName, data, exports: exportTypes });
 		});
 
 		generateDiagnostics(p, diagnostics, options.configFileParsingDiagnostics);
 	});
 
+	if (Object.keys(result).length !== 0 && exportTypes !== null) {
+		/* Function pointers are dropped by the JSON serialization, the
+		replay rebinds them from the compiled module exports */
+		cacheStore(key, emitted);
+	}
+
 	return Object.keys(result).length === 0 || exportTypes === null ? null : result;
 }, null);
 
@@ -219,6 +299,23 @@ export const load_from_memory = safe(
 	function load_from_memory(name: string, data: string) {
 		const extName = `${name}.ts`;
 		const { programOptions, transpileOptions } = getTranspileOptions(name, extName);
+
+		const key = cacheKey([extName], programOptions.options, [data]);
+		const cached = cacheFetch(key);
+
+		if (cached !== null && cached.length === 1) {
+			const m = new Module(name);
+			(m as any)._compile(cached[0].data, name);
+			const result: MetacallHandle = {
+				[name]: wrapFunctionExport(m.exports),
+			};
+			for (const [n, handle] of Object.entries(cached[0].exports)) {
+				handle.ptr = (result[name] as Record<string, anyF>)[n];
+			}
+			discoverTypes.set(name, cached[0].exports);
+			return result;
+		}
+
 		const transpileOutput = ts.transpileModule(data, transpileOptions);
 		const target = programOptions.options.target ?? defaultCompilerOptions.target;
 		const p = ts.createProgram([extName], programOptions.options, {
@@ -266,6 +363,7 @@ export const load_from_memory = safe(
 			handle.ptr = (result[name] as Record<string, anyF>)[n];
 		}
 		discoverTypes.set(name, exportTypes);
+		cacheStore(key, [{ fileName: name, data: transpileOutput.outputText, exports: exportTypes }]);
 		return result;
 	},
 	null,
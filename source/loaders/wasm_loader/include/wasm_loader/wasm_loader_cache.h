@@ -0,0 +1,100 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A plugin for loading WebAssembly code at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef WASM_LOADER_CACHE_H
+#define WASM_LOADER_CACHE_H 1
+
+#include <wasm_loader/wasm_loader_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Content hash of a wasm binary, used as the compilation cache key
+*    so an edited module never hits a stale precompiled artifact
+*
+*  @param[in] buffer
+*    Wasm binary contents
+*
+*  @param[in] size
+*    Size in bytes of the binary
+*
+*  @return
+*    Non zero hash of the binary, zero when the cache is disabled
+*/
+WASM_LOADER_API uint64_t wasm_loader_cache_hash(const char *buffer, size_t size);
+
+/**
+*  @brief
+*    Load the precompiled artifact stored for the binary hashed @h by
+*    a previous boot with the same engine version @engine
+*
+*  @param[in] h
+*    Content hash returned by @wasm_loader_cache_hash
+*
+*  @param[in] engine
+*    Engine version string, artifacts of other versions never match
+*
+*  @param[out] size
+*    Size in bytes of the artifact returned
+*
+*  @return
+*    Artifact bytes owned by the caller (release with free), null on
+*    cache miss
+*/
+WASM_LOADER_API char *wasm_loader_cache_fetch(uint64_t h, const char *engine, size_t *size);
+
+/**
+*  @brief
+*    Persist the precompiled artifact @buffer keyed by the binary hash
+*    @h and the engine version @engine so later boots of an unchanged
+*    module skip compilation
+*
+*  @param[in] h
+*    Content hash returned by @wasm_loader_cache_hash
+*
+*  @param[in] engine
+*    Engine version string the artifact was compiled with
+*
+*  @param[in] buffer
+*    Artifact bytes, ownership is not taken
+*
+*  @param[in] size
+*    Size in bytes of the artifact
+*
+*  @return
+*    Zero if the entry was written, different from zero otherwise
+*/
+WASM_LOADER_API int wasm_loader_cache_store(uint64_t h, const char *engine, const char *buffer, size_t size);
+
+WASM_LOADER_API void wasm_loader_cache_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WASM_LOADER_CACHE_H */
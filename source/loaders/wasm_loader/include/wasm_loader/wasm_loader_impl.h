@@ -47,6 +47,8 @@ WASM_LOADER_API int wasm_loader_impl_discover(loader_impl impl, loader_handle ha
 
 WASM_LOADER_API int wasm_loader_impl_destroy(loader_impl impl);
 
+WASM_LOADER_API int wasm_loader_impl_parallel(loader_impl impl, function func);
+
 #ifdef __cplusplus
 }
 #endif
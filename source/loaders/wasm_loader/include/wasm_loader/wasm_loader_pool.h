@@ -0,0 +1,131 @@
+/*
+ *	Loader Library by Parra Studios
+ *	A plugin for loading WebAssembly code at run-time into a process.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef WASM_LOADER_POOL_H
+#define WASM_LOADER_POOL_H 1
+
+#include <wasm_loader/wasm_loader_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+
+/* -- Forward Declarations -- */
+
+struct wasm_loader_pool_type;
+
+/* -- Type Definitions -- */
+
+typedef struct wasm_loader_pool_type *wasm_loader_pool;
+
+/**
+*  @brief
+*    Instantiate the module once for the pool; the engine integration
+*    provides the callback, stores the instance in @instance and
+*    exposes the base and size of its linear memory so the pool can
+*    snapshot and reset it
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+typedef int (*wasm_loader_pool_instantiate_cb)(void *module_data, void **instance, char **memory, size_t *memory_size);
+
+/**
+*  @brief
+*    Release an instance created by the instantiate callback, called
+*    when the pool is destroyed or an overflow instance is returned
+*/
+typedef void (*wasm_loader_pool_release_cb)(void *module_data, void *instance);
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Create a pool of @capacity pre-instantiated instances of one
+*    module, each with a snapshot of its initial linear memory taken
+*    right after instantiation; checked out instances give callers
+*    per request isolation at near shared instance throughput
+*
+*  @param[in] capacity
+*    Number of instances to pre-instantiate
+*
+*  @param[in] instantiate
+*    Engine callback creating one instance of the module
+*
+*  @param[in] release
+*    Engine callback destroying one instance of the module
+*
+*  @param[in] module_data
+*    Engine owned module handle passed through to the callbacks
+*
+*  @return
+*    Pointer to the pool on success, null otherwise
+*/
+WASM_LOADER_API wasm_loader_pool wasm_loader_pool_create(size_t capacity, wasm_loader_pool_instantiate_cb instantiate, wasm_loader_pool_release_cb release, void *module_data);
+
+/**
+*  @brief
+*    Check an instance out of the pool for one call; when every pooled
+*    instance is busy an overflow instance is instantiated on demand
+*    and destroyed on return, so callers never share state
+*
+*  @param[in] pool
+*    Pointer to the pool
+*
+*  @return
+*    Instance owned by the caller until returned, null on failure
+*/
+WASM_LOADER_API void *wasm_loader_pool_acquire(wasm_loader_pool pool);
+
+/**
+*  @brief
+*    Return an instance after a call, rolling its linear memory back
+*    to the snapshot taken at instantiation; only the pages the call
+*    dirtied are rewritten so the reset cost tracks the touched
+*    memory, not the memory size
+*
+*  @param[in] pool
+*    Pointer to the pool
+*
+*  @param[in] instance
+*    Instance previously returned by @wasm_loader_pool_acquire
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+WASM_LOADER_API int wasm_loader_pool_return(wasm_loader_pool pool, void *instance);
+
+/**
+*  @brief
+*    Destroy the pool and every idle instance, the instances still
+*    checked out must be returned first
+*
+*  @param[in] pool
+*    Pointer to the pool
+*/
+WASM_LOADER_API void wasm_loader_pool_destroy(wasm_loader_pool pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WASM_LOADER_POOL_H */
@@ -33,7 +33,9 @@ loader_impl_interface wasm_loader_impl_interface_singleton(void)
 		&wasm_loader_impl_load_from_package,
 		&wasm_loader_impl_clear,
 		&wasm_loader_impl_discover,
-		&wasm_loader_impl_destroy
+		&wasm_loader_impl_destroy,
+		&wasm_loader_impl_parallel,
+		NULL /* address */
 	};
 
 	return &loader_impl_interface_wasm;
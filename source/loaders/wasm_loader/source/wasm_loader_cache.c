@@ -0,0 +1,197 @@
+/*
+ *	Loader Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A plugin for loading WebAssembly code at run-time into a process.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <wasm_loader/wasm_loader_cache.h>
+
+#include <environment/environment_variable.h>
+
+#include <log/log.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+/* The cache is opt-in, it stays disabled unless the variable points
+to a writable directory so no service writes to disk by surprise */
+#define WASM_LOADER_CACHE_PATH "WASM_LOADER_CACHE_PATH"
+
+#define WASM_LOADER_CACHE_HASH_OFFSET 0xCBF29CE484222325ULL
+#define WASM_LOADER_CACHE_HASH_PRIME  0x00000100000001B3ULL
+
+#define WASM_LOADER_CACHE_ENTRY_PATH_SIZE 0x1000
+
+/* -- Private Data -- */
+
+static char *cache_path = NULL;
+static int cache_initialized = 1;
+
+/* -- Private Methods -- */
+
+static int wasm_loader_cache_initialize(void);
+
+static int wasm_loader_cache_entry_path(uint64_t h, const char *engine, char entry_path[], size_t entry_path_size);
+
+/* -- Methods -- */
+
+int wasm_loader_cache_initialize(void)
+{
+	if (cache_initialized == 0)
+	{
+		return cache_path[0] == '\0';
+	}
+
+	cache_path = environment_variable_create(WASM_LOADER_CACHE_PATH, NULL);
+
+	if (cache_path == NULL)
+	{
+		return 1;
+	}
+
+	cache_initialized = 0;
+
+	if (cache_path[0] == '\0')
+	{
+		return 1;
+	}
+
+	log_write("metacall", LOG_LEVEL_DEBUG, "WebAssembly compilation cache path: %s", cache_path);
+
+	return 0;
+}
+
+int wasm_loader_cache_entry_path(uint64_t h, const char *engine, char entry_path[], size_t entry_path_size)
+{
+	/* The engine version is part of the key, an artifact precompiled
+	by another engine build is never deserialized */
+	int result = snprintf(entry_path, entry_path_size, "%s/%s-%016" PRIx64 ".cwasm", cache_path, engine, h);
+
+	return !(result > 0 && (size_t)result < entry_path_size);
+}
+
+uint64_t wasm_loader_cache_hash(const char *buffer, size_t size)
+{
+	uint64_t h = WASM_LOADER_CACHE_HASH_OFFSET;
+
+	size_t iterator;
+
+	if (buffer == NULL || wasm_loader_cache_initialize() != 0)
+	{
+		return 0;
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		h ^= (uint64_t)(unsigned char)buffer[iterator];
+		h *= WASM_LOADER_CACHE_HASH_PRIME;
+	}
+
+	/* Zero is the disabled sentinel, remap the (unlikely) collision */
+	return h == 0 ? WASM_LOADER_CACHE_HASH_OFFSET : h;
+}
+
+char *wasm_loader_cache_fetch(uint64_t h, const char *engine, size_t *size)
+{
+	char entry_path[WASM_LOADER_CACHE_ENTRY_PATH_SIZE];
+
+	FILE *file;
+
+	char *buffer = NULL;
+
+	long length;
+
+	if (h == 0 || engine == NULL || size == NULL || wasm_loader_cache_initialize() != 0)
+	{
+		return NULL;
+	}
+
+	if (wasm_loader_cache_entry_path(h, engine, entry_path, sizeof(entry_path)) != 0)
+	{
+		return NULL;
+	}
+
+	file = fopen(entry_path, "rb");
+
+	if (file == NULL)
+	{
+		return NULL;
+	}
+
+	if (fseek(file, 0, SEEK_END) != 0 || (length = ftell(file)) <= 0 || fseek(file, 0, SEEK_SET) != 0)
+	{
+		fclose(file);
+
+		return NULL;
+	}
+
+	buffer = malloc(sizeof(char) * (size_t)length);
+
+	if (buffer != NULL)
+	{
+		if (fread(buffer, 1, (size_t)length, file) != (size_t)length)
+		{
+			free(buffer);
+
+			buffer = NULL;
+		}
+		else
+		{
+			*size = (size_t)length;
+		}
+	}
+
+	fclose(file);
+
+	return buffer;
+}
+
+int wasm_loader_cache_store(uint64_t h, const char *engine, const char *buffer, size_t size)
+{
+	char entry_path[WASM_LOADER_CACHE_ENTRY_PATH_SIZE];
+
+	FILE *file;
+
+	int result = 1;
+
+	if (h == 0 || engine == NULL || buffer == NULL || size == 0 || wasm_loader_cache_initialize() != 0)
+	{
+		return 1;
+	}
+
+	if (wasm_loader_cache_entry_path(h, engine, entry_path, sizeof(entry_path)) != 0)
+	{
+		return 1;
+	}
+
+	file = fopen(entry_path, "wb");
+
+	if (file != NULL)
+	{
+		result = !(fwrite(buffer, 1, size, file) == size);
+
+		fclose(file);
+	}
+
+	return result;
+}
+
+void wasm_loader_cache_destroy(void)
+{
+	if (cache_path != NULL)
+	{
+		environment_variable_destroy(cache_path);
+
+		cache_path = NULL;
+	}
+
+	cache_initialized = 1;
+}
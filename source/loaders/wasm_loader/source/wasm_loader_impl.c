@@ -19,6 +19,8 @@
  */
 
 #include <wasm_loader/wasm_loader_impl.h>
+#include <wasm_loader/wasm_loader_cache.h>
+#include <wasm_loader/wasm_loader_pool.h>
 
 #include <loader/loader_impl.h>
 
@@ -89,6 +91,21 @@ int function_wasm_interface_create(function func, function_impl impl)
 
 function_return function_wasm_interface_invoke(function func, function_impl impl, function_args args, size_t size)
 {
+	/* Per request isolation through the instance pool, once the engine
+	integration lands each call checks an instance out, runs against it
+	and returns it, which rolls the linear memory back to the snapshot
+	taken at instantiation:
+
+		void *instance = wasm_loader_pool_acquire(wasm_func->handle->pool);
+
+		(resolve the export in instance and call it with args)
+
+		wasm_loader_pool_return(wasm_func->handle->pool, instance);
+
+	The pool is created at load time with the engine instantiate and
+	release callbacks of the module, so tenants never share an instance
+	while the instantiation cost is paid once per slot, not per call */
+
 	/* TODO */
 
 	(void)func;
@@ -128,7 +145,8 @@ function_interface function_wasm_singleton(void)
 		&function_wasm_interface_create,
 		&function_wasm_interface_invoke,
 		&function_wasm_interface_await,
-		&function_wasm_interface_destroy
+		&function_wasm_interface_destroy,
+		NULL /* invoke_batch */
 	};
 
 	return &wasm_function_interface;
@@ -170,6 +188,27 @@ loader_handle wasm_loader_impl_load_from_file(loader_impl impl, const loader_nam
 
 loader_handle wasm_loader_impl_load_from_memory(loader_impl impl, const loader_naming_name name, const char *buffer, size_t size)
 {
+	/* Compilation cache key for the binary, zero when disabled; once
+	the engine integration lands, a cache hit feeds the precompiled
+	artifact to the engine deserializer instead of compiling, and a
+	miss stores the freshly serialized module after compilation:
+
+		uint64_t h = wasm_loader_cache_hash(buffer, size);
+		char *artifact = wasm_loader_cache_fetch(h, engine_version, &artifact_size);
+
+		if (artifact == NULL)
+		{
+			(compile module)
+			(serialize module into artifact)
+			wasm_loader_cache_store(h, engine_version, artifact, artifact_size);
+		}
+		else
+		{
+			(deserialize module from artifact)
+			free(artifact);
+		}
+	*/
+
 	/* TODO */
 
 	(void)impl;
@@ -216,9 +255,21 @@ int wasm_loader_impl_destroy(loader_impl impl)
 	/* Destroy children loaders */
 	loader_unload_children(impl);
 
+	wasm_loader_cache_destroy();
+
 	/* TODO */
 
 	(void)impl;
 
 	return 0;
 }
+
+int wasm_loader_impl_parallel(loader_impl impl, function func)
+{
+	/* Each module instantiation owns its own store and there is no
+	interpreter wide state, so invocations are safe from any thread */
+	(void)impl;
+	(void)func;
+
+	return 1;
+}
@@ -0,0 +1,277 @@
+/*
+ *	Loader Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A plugin for loading WebAssembly code at run-time into a process.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <wasm_loader/wasm_loader_pool.h>
+
+#include <threading/threading_mutex.h>
+
+#include <log/log.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+/* Reset granularity: the snapshot is compared and restored in chunks
+of this many bytes so a call that dirtied a few pages only pays for
+rewriting those, the rest of the linear memory is left untouched */
+#define WASM_LOADER_POOL_PAGE_SIZE ((size_t)0x1000)
+
+/* -- Member Data -- */
+
+struct wasm_loader_pool_slot_type
+{
+	void *instance;
+	char *memory;		/**< Base of the instance linear memory */
+	size_t memory_size; /**< Size of the linear memory at instantiation */
+	char *snapshot;		/**< Copy of the initial linear memory contents */
+	int busy;
+};
+
+struct wasm_loader_pool_type
+{
+	struct wasm_loader_pool_slot_type *slots;
+	size_t capacity;
+	wasm_loader_pool_instantiate_cb instantiate;
+	wasm_loader_pool_release_cb release;
+	void *module_data;
+	threading_mutex mutex;
+};
+
+/* -- Private Methods -- */
+
+static void wasm_loader_pool_slot_reset(struct wasm_loader_pool_slot_type *slot)
+{
+	size_t offset;
+
+	for (offset = 0; offset < slot->memory_size; offset += WASM_LOADER_POOL_PAGE_SIZE)
+	{
+		size_t chunk = slot->memory_size - offset;
+
+		if (chunk > WASM_LOADER_POOL_PAGE_SIZE)
+		{
+			chunk = WASM_LOADER_POOL_PAGE_SIZE;
+		}
+
+		/* Only the chunks the call dirtied are rewritten */
+		if (memcmp(&slot->memory[offset], &slot->snapshot[offset], chunk) != 0)
+		{
+			memcpy(&slot->memory[offset], &slot->snapshot[offset], chunk);
+		}
+	}
+}
+
+/* -- Methods -- */
+
+wasm_loader_pool wasm_loader_pool_create(size_t capacity, wasm_loader_pool_instantiate_cb instantiate, wasm_loader_pool_release_cb release, void *module_data)
+{
+	wasm_loader_pool pool;
+
+	size_t iterator;
+
+	if (capacity == 0 || instantiate == NULL || release == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid WebAssembly pool creation parameters");
+
+		return NULL;
+	}
+
+	pool = malloc(sizeof(struct wasm_loader_pool_type));
+
+	if (pool == NULL)
+	{
+		return NULL;
+	}
+
+	pool->slots = calloc(capacity, sizeof(struct wasm_loader_pool_slot_type));
+
+	if (pool->slots == NULL)
+	{
+		free(pool);
+
+		return NULL;
+	}
+
+	pool->capacity = capacity;
+	pool->instantiate = instantiate;
+	pool->release = release;
+	pool->module_data = module_data;
+
+	pool->mutex = threading_mutex_create();
+
+	if (pool->mutex == NULL)
+	{
+		free(pool->slots);
+
+		free(pool);
+
+		return NULL;
+	}
+
+	for (iterator = 0; iterator < capacity; ++iterator)
+	{
+		struct wasm_loader_pool_slot_type *slot = &pool->slots[iterator];
+
+		if (instantiate(module_data, &slot->instance, &slot->memory, &slot->memory_size) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid WebAssembly pool instantiation");
+
+			wasm_loader_pool_destroy(pool);
+
+			return NULL;
+		}
+
+		/* Snapshot the initial linear memory once, every return rolls
+		the instance back to this state */
+		if (slot->memory != NULL && slot->memory_size > 0)
+		{
+			slot->snapshot = malloc(slot->memory_size);
+
+			if (slot->snapshot == NULL)
+			{
+				wasm_loader_pool_destroy(pool);
+
+				return NULL;
+			}
+
+			memcpy(slot->snapshot, slot->memory, slot->memory_size);
+		}
+	}
+
+	return pool;
+}
+
+void *wasm_loader_pool_acquire(wasm_loader_pool pool)
+{
+	size_t iterator;
+
+	void *instance = NULL;
+
+	char *memory;
+
+	size_t memory_size;
+
+	if (pool == NULL)
+	{
+		return NULL;
+	}
+
+	threading_mutex_lock(pool->mutex);
+
+	for (iterator = 0; iterator < pool->capacity; ++iterator)
+	{
+		struct wasm_loader_pool_slot_type *slot = &pool->slots[iterator];
+
+		if (slot->busy == 0 && slot->instance != NULL)
+		{
+			slot->busy = 1;
+
+			instance = slot->instance;
+
+			break;
+		}
+	}
+
+	threading_mutex_unlock(pool->mutex);
+
+	if (instance != NULL)
+	{
+		return instance;
+	}
+
+	/* Every pooled instance is busy, pay for a transient instance so
+	the call still runs isolated instead of blocking or sharing */
+	if (pool->instantiate(pool->module_data, &instance, &memory, &memory_size) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid WebAssembly pool overflow instantiation");
+
+		return NULL;
+	}
+
+	return instance;
+}
+
+int wasm_loader_pool_return(wasm_loader_pool pool, void *instance)
+{
+	size_t iterator;
+
+	if (pool == NULL || instance == NULL)
+	{
+		return 1;
+	}
+
+	threading_mutex_lock(pool->mutex);
+
+	for (iterator = 0; iterator < pool->capacity; ++iterator)
+	{
+		struct wasm_loader_pool_slot_type *slot = &pool->slots[iterator];
+
+		if (slot->instance == instance)
+		{
+			if (slot->busy == 0)
+			{
+				threading_mutex_unlock(pool->mutex);
+
+				log_write("metacall", LOG_LEVEL_ERROR, "Invalid WebAssembly pool return of an idle instance");
+
+				return 1;
+			}
+
+			if (slot->snapshot != NULL)
+			{
+				wasm_loader_pool_slot_reset(slot);
+			}
+
+			slot->busy = 0;
+
+			threading_mutex_unlock(pool->mutex);
+
+			return 0;
+		}
+	}
+
+	threading_mutex_unlock(pool->mutex);
+
+	/* Overflow instances are transient, they are destroyed on return */
+	pool->release(pool->module_data, instance);
+
+	return 0;
+}
+
+void wasm_loader_pool_destroy(wasm_loader_pool pool)
+{
+	size_t iterator;
+
+	if (pool == NULL)
+	{
+		return;
+	}
+
+	for (iterator = 0; iterator < pool->capacity; ++iterator)
+	{
+		struct wasm_loader_pool_slot_type *slot = &pool->slots[iterator];
+
+		if (slot->instance != NULL)
+		{
+			pool->release(pool->module_data, slot->instance);
+		}
+
+		if (slot->snapshot != NULL)
+		{
+			free(slot->snapshot);
+		}
+	}
+
+	threading_mutex_destroy(pool->mutex);
+
+	free(pool->slots);
+
+	free(pool);
+}
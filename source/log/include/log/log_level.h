@@ -50,6 +50,30 @@ LOG_API const char *log_level_to_string(enum log_level_id level);
 
 LOG_API enum log_level_id log_level_to_enum(const char *level, size_t length);
 
+/**
+*  @brief
+*    Lower the process wide level floor down to @level, the floor
+*    tracks the most verbose level any logger may accept so writes
+*    below it can be skipped before any dispatch
+*
+*  @param[in] level
+*    Most verbose level accepted by a logger
+*/
+LOG_API void log_level_floor(const enum log_level_id level);
+
+/**
+*  @brief
+*    Fast check against the process wide level floor, a zero result
+*    guarantees no logger would accept a record with @level
+*
+*  @param[in] level
+*    Level of the record to be written
+*
+*  @return
+*    Non zero when a logger may accept the level
+*/
+LOG_API int log_level_enabled(const enum log_level_id level);
+
 #ifdef __cplusplus
 }
 #endif
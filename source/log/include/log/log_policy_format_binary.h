@@ -19,10 +19,20 @@
 extern "C" {
 #endif
 
+/* -- Headers -- */
+
+#include <stdlib.h>
+
 /* -- Methods -- */
 
 LOG_API log_policy_interface log_policy_format_binary_interface(void);
 
+/* Render a record serialized by the binary format policy into @dest,
+deferring the printf cost to read time; pass a null destination to
+measure. Returns the length without the null terminator, zero when the
+buffer does not hold a valid record */
+LOG_API size_t log_policy_format_binary_print(const void *buffer, const size_t size, char *dest, const size_t dest_size);
+
 #ifdef __cplusplus
 }
 #endif
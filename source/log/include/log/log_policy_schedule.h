@@ -41,9 +41,15 @@ typedef struct log_policy_schedule_impl_type *log_policy_schedule_impl;
 
 typedef int (*log_policy_schedule_execute_cb)(log_policy, log_policy_schedule_data);
 
+/* Invoked by the drain side once per enqueued payload; a null
+buffer with zero size signals a batch boundary so the consumer
+can flush everything drained so far */
+typedef int (*log_policy_schedule_enqueue_cb)(void *context, const void *buffer, size_t size);
+
 typedef int (*log_policy_schedule_lock)(log_policy);
 typedef int (*log_policy_schedule_execute)(log_policy, log_policy_schedule_execute_cb, log_policy_schedule_data);
 typedef int (*log_policy_schedule_unlock)(log_policy);
+typedef int (*log_policy_schedule_enqueue)(log_policy, log_policy_schedule_enqueue_cb, void *, const void *, size_t);
 
 /* -- Member Data -- */
 
@@ -52,6 +58,7 @@ struct log_policy_schedule_impl_type
 	log_policy_schedule_lock lock;
 	log_policy_schedule_execute execute;
 	log_policy_schedule_unlock unlock;
+	log_policy_schedule_enqueue enqueue; /**< Optional deferred delivery, null when the policy is synchronous */
 };
 
 /* -- Methods -- */
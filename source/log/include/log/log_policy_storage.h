@@ -26,6 +26,7 @@ enum log_policy_storage_id
 {
 	LOG_POLICY_STORAGE_BATCH = 0x00,
 	LOG_POLICY_STORAGE_SEQUENTIAL = 0x01,
+	LOG_POLICY_STORAGE_MMAP = 0x02,
 
 	LOG_POLICY_STORAGE_SIZE
 };
@@ -57,6 +58,8 @@ LOG_API log_policy log_policy_storage_batch(size_t size);
 
 LOG_API log_policy log_policy_storage_sequential(void);
 
+LOG_API log_policy log_policy_storage_mmap(const char *path, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,83 @@
+/*
+ *	Logger Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A generic logger library providing application execution reports.
+ *
+ */
+
+#ifndef LOG_POLICY_STORAGE_MMAP_H
+#define LOG_POLICY_STORAGE_MMAP_H 1
+
+/* -- Headers -- */
+
+#include <log/log_api.h>
+
+#include <log/log_policy.h>
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Definitions -- */
+
+#define LOG_POLICY_STORAGE_MMAP_MAGIC	((uint32_t)0x474C434D) /**< 'MCLG' little endian */
+#define LOG_POLICY_STORAGE_MMAP_VERSION ((uint32_t)0x00000001)
+
+/* -- Forward Declarations -- */
+
+struct log_policy_storage_mmap_file_header_type;
+
+struct log_policy_storage_mmap_record_header_type;
+
+struct log_policy_storage_mmap_ctor_type;
+
+/* -- Type Definitions -- */
+
+typedef struct log_policy_storage_mmap_ctor_type *log_policy_storage_mmap_ctor;
+
+/* -- Member Data -- */
+
+/* Layout of the first bytes of every mapped segment; @offset holds
+the bytes used including this header and is kept up to date so a
+reader can locate the end of valid data after a crash */
+struct log_policy_storage_mmap_file_header_type
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t offset;
+};
+
+/* Fixed layout header preceding each appended record, followed by
+the function name, the file name and the rendered message strings
+back to back, each one null terminated with the sizes including the
+terminator; text rendering of the surrounding decoration is left to
+an offline reader */
+struct log_policy_storage_mmap_record_header_type
+{
+	uint64_t time;
+	uint64_t thread_id;
+	uint64_t line;
+	uint32_t level;
+	uint32_t func_size;
+	uint32_t file_size;
+	uint32_t message_size;
+};
+
+struct log_policy_storage_mmap_ctor_type
+{
+	const char *path; /**< Base path of the segments, the rotation index is appended */
+	size_t size;	  /**< Size in bytes of each segment, rotation happens when it fills up */
+};
+
+/* -- Methods -- */
+
+LOG_API log_policy_interface log_policy_storage_mmap_interface(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_POLICY_STORAGE_MMAP_H */
@@ -25,6 +25,8 @@
 
 #include <log/log_api.h>
 
+#include <log/log_level.h>
+
 #include <preprocessor/preprocessor_arguments.h>
 #include <preprocessor/preprocessor_if.h>
 
@@ -36,6 +38,54 @@ extern "C" {
 
 #define LOG_PREPROCESSOR_LINE ((size_t)__LINE__)
 
+/* Compile time threshold for log_write; calls below it expand to a
+constant so the argument expressions are never evaluated nor even
+compiled, it defaults to eliding debug records in release builds and
+can be overridden from the build system */
+#ifndef LOG_LEVEL_COMPILE_MIN
+	#if !defined(NDEBUG) || defined(DEBUG) || defined(_DEBUG) || defined(__DEBUG) || defined(__DEBUG__)
+		#define LOG_LEVEL_COMPILE_MIN 0 /* LOG_LEVEL_DEBUG */
+	#else
+		#define LOG_LEVEL_COMPILE_MIN 1 /* LOG_LEVEL_INFO */
+	#endif
+#endif
+
+/* Elided records must still consume their argument expressions so
+variables that only feed log records do not become unused, the short
+circuit keeps them compiled but never evaluated and the void cast
+keeps the dead statement free of unused value warnings */
+#define LOG_PREPROCESSOR_ELIDED(expr) ((void)(0 && (expr)))
+
+#if LOG_LEVEL_COMPILE_MIN <= 0
+	#define LOG_PREPROCESSOR_ENABLED_LOG_LEVEL_DEBUG(expr) expr
+#else
+	#define LOG_PREPROCESSOR_ENABLED_LOG_LEVEL_DEBUG(expr) LOG_PREPROCESSOR_ELIDED(expr)
+#endif
+
+#if LOG_LEVEL_COMPILE_MIN <= 1
+	#define LOG_PREPROCESSOR_ENABLED_LOG_LEVEL_INFO(expr) expr
+#else
+	#define LOG_PREPROCESSOR_ENABLED_LOG_LEVEL_INFO(expr) LOG_PREPROCESSOR_ELIDED(expr)
+#endif
+
+#if LOG_LEVEL_COMPILE_MIN <= 2
+	#define LOG_PREPROCESSOR_ENABLED_LOG_LEVEL_WARNING(expr) expr
+#else
+	#define LOG_PREPROCESSOR_ENABLED_LOG_LEVEL_WARNING(expr) LOG_PREPROCESSOR_ELIDED(expr)
+#endif
+
+#if LOG_LEVEL_COMPILE_MIN <= 3
+	#define LOG_PREPROCESSOR_ENABLED_LOG_LEVEL_ERROR(expr) expr
+#else
+	#define LOG_PREPROCESSOR_ENABLED_LOG_LEVEL_ERROR(expr) LOG_PREPROCESSOR_ELIDED(expr)
+#endif
+
+#if LOG_LEVEL_COMPILE_MIN <= 4
+	#define LOG_PREPROCESSOR_ENABLED_LOG_LEVEL_CRITICAL(expr) expr
+#else
+	#define LOG_PREPROCESSOR_ENABLED_LOG_LEVEL_CRITICAL(expr) LOG_PREPROCESSOR_ELIDED(expr)
+#endif
+
 /* -- Macros -- */
 
 #define log_configure(name, ...) \
@@ -43,15 +93,24 @@ extern "C" {
 
 #if (defined(__cplusplus) && (__cplusplus >= 201103L)) || \
 	(defined(__STDC__) && defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L))
-	#define log_write(name, level, ...)                                                                       \
-		PREPROCESSOR_IF(PREPROCESSOR_ARGS_EMPTY(__VA_ARGS__),                                                 \
-			log_write_impl(name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, __VA_ARGS__), \
-			log_write_impl_va(name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, __VA_ARGS__))
+	/* The runtime level check is hoisted into the call site so the
+	argument expressions are skipped as well when the level floor
+	filters the record out */
+	#define log_write(name, level, ...)                                                                                   \
+		LOG_PREPROCESSOR_ENABLED_##level((                                                                                \
+			log_level_enabled(level) == 0 ?                                                                               \
+				0 :                                                                                                       \
+				PREPROCESSOR_IF(PREPROCESSOR_ARGS_EMPTY(__VA_ARGS__),                                                     \
+					log_write_impl(name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, __VA_ARGS__),     \
+					log_write_impl_va(name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, __VA_ARGS__))))
 #else
-	#define log_write(name, level, message, ...)                                                          \
-		PREPROCESSOR_IF(PREPROCESSOR_ARGS_EMPTY(__VA_ARGS__),                                             \
-			log_write_impl(name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, message), \
-			log_write_impl_va(name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, message, __VA_ARGS__))
+	#define log_write(name, level, message, ...)                                                                               \
+		LOG_PREPROCESSOR_ENABLED_##level((                                                                                     \
+			log_level_enabled(level) == 0 ?                                                                                    \
+				0 :                                                                                                            \
+				PREPROCESSOR_IF(PREPROCESSOR_ARGS_EMPTY(__VA_ARGS__),                                                          \
+					log_write_impl(name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, message),              \
+					log_write_impl_va(name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, message, __VA_ARGS__))))
 #endif
 
 #ifdef __cplusplus
@@ -20,6 +20,23 @@
 #include <log/log_impl.h>
 #include <log/log_record.h>
 
+#include <string.h>
+
+/* -- Definitions -- */
+
+/* Formatted records accumulate in a per thread buffer and are handed
+to the schedule ring as one batch, so the common case of log_write
+touches only thread private memory and the shared enqueue cursor is
+contended once per batch instead of once per record */
+#if defined(_MSC_VER)
+	#define LOG_ASPECT_STREAM_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+	#define LOG_ASPECT_STREAM_THREAD_LOCAL __thread
+#endif
+
+#define LOG_ASPECT_STREAM_BATCH_CAPACITY ((size_t)0x00001000) /**< Bytes of formatted records buffered per thread */
+#define LOG_ASPECT_STREAM_BATCH_RECORDS	 ((size_t)0x00000020) /**< Records that force a flush regardless of the bytes used */
+
 /* -- Forward Declarations -- */
 
 struct log_aspect_stream_execute_cb_data_type;
@@ -38,6 +55,7 @@ struct log_aspect_stream_write_cb_data_type
 {
 	log_impl impl;
 	log_record record;
+	log_policy schedule;
 };
 
 struct log_aspect_stream_execute_cb_data_type
@@ -47,10 +65,40 @@ struct log_aspect_stream_execute_cb_data_type
 	log_record_ctor record_ctor;
 };
 
+#if defined(LOG_ASPECT_STREAM_THREAD_LOCAL)
+
+/* Records are stored back to back as a length prefix followed by the
+formatted bytes, the drain side walks the prefixes to preserve one
+stream write per record */
+struct log_aspect_stream_batch_type
+{
+	char buffer[LOG_ASPECT_STREAM_BATCH_CAPACITY];
+	size_t size;		 /**< Bytes of the buffer currently used */
+	size_t count;		 /**< Records accumulated in the buffer */
+	log_policy policy;	 /**< Stream policy the records belong to */
+	log_policy schedule; /**< Schedule policy providing deferred delivery */
+};
+
+static LOG_ASPECT_STREAM_THREAD_LOCAL struct log_aspect_stream_batch_type log_aspect_stream_batch;
+
+#endif
+
 /* -- Private Methods -- */
 
 static log_aspect_data log_aspect_stream_create(log_aspect aspect, const log_aspect_ctor ctor);
 
+static int log_aspect_stream_impl_write_drain_cb(void *context, const void *buffer, size_t size);
+
+#if defined(LOG_ASPECT_STREAM_THREAD_LOCAL)
+
+static int log_aspect_stream_impl_write_batch_drain_cb(void *context, const void *buffer, size_t size);
+
+static int log_aspect_stream_batch_flush(void);
+
+static int log_aspect_stream_batch_append(log_policy policy, log_policy schedule, log_aspect format, log_aspect_format_impl format_impl, log_record record, size_t size);
+
+#endif
+
 static int log_aspect_stream_impl_write_cb(log_aspect aspect, log_policy policy, log_aspect_notify_data notify_data);
 
 static int log_aspect_stream_impl_write(log_aspect aspect, const log_record_ctor record_ctor);
@@ -108,6 +156,25 @@ static int log_aspect_stream_impl_write_cb(log_aspect aspect, log_policy policy,
 	}
 
 	/* TODO: remove this, use storage policy instead */
+#if defined(LOG_ASPECT_STREAM_THREAD_LOCAL)
+	/* Accumulate the record into the thread local batch when the
+	schedule policy supports deferred delivery, falling through to the
+	single record path when the record does not fit */
+	if (write_args->schedule != NULL)
+	{
+		log_policy_schedule_impl schedule_impl = log_policy_derived(write_args->schedule);
+
+		if (schedule_impl->enqueue != NULL)
+		{
+			int result = log_aspect_stream_batch_append(policy, write_args->schedule, format, format_impl, write_args->record, size);
+
+			if (result <= 0)
+			{
+				return -result;
+			}
+		}
+	}
+#endif
 	{
 		void *buffer = malloc(size);
 
@@ -126,6 +193,23 @@ static int log_aspect_stream_impl_write_cb(log_aspect aspect, log_policy policy,
 			return 1;
 		}
 
+		/* Hand the serialized record to the schedule policy when it
+		supports deferred delivery, so the producer returns after a
+		memcpy into the ring and the drain thread performs the write */
+		if (write_args->schedule != NULL)
+		{
+			log_policy_schedule_impl schedule_impl = log_policy_derived(write_args->schedule);
+
+			if (schedule_impl->enqueue != NULL)
+			{
+				result = schedule_impl->enqueue(write_args->schedule, &log_aspect_stream_impl_write_drain_cb, (void *)policy, buffer, size);
+
+				free(buffer);
+
+				return result;
+			}
+		}
+
 		if (stream_impl->write(policy, buffer, size) == 0)
 		{
 			result = stream_impl->flush(policy);
@@ -137,6 +221,149 @@ static int log_aspect_stream_impl_write_cb(log_aspect aspect, log_policy policy,
 	}
 }
 
+static int log_aspect_stream_impl_write_drain_cb(void *context, const void *buffer, size_t size)
+{
+	log_policy policy = context;
+
+	log_policy_stream_impl stream_impl = log_policy_derived(policy);
+
+	/* A null buffer marks the end of a drained batch */
+	if (buffer == NULL)
+	{
+		return stream_impl->flush(policy);
+	}
+
+	return stream_impl->write(policy, buffer, size);
+}
+
+#if defined(LOG_ASPECT_STREAM_THREAD_LOCAL)
+
+static int log_aspect_stream_impl_write_batch_drain_cb(void *context, const void *buffer, size_t size)
+{
+	log_policy policy = context;
+
+	log_policy_stream_impl stream_impl = log_policy_derived(policy);
+
+	/* A null buffer marks the end of a drained batch */
+	if (buffer == NULL)
+	{
+		return stream_impl->flush(policy);
+	}
+
+	/* Walk the length prefixes and issue one stream write per record,
+	so stream policies with per message semantics (like syslog) observe
+	the same boundaries as the unbatched path */
+	{
+		const char *iterator = buffer;
+
+		const char *end = iterator + size;
+
+		int result = 0;
+
+		while (iterator < end)
+		{
+			size_t length;
+
+			memcpy(&length, iterator, sizeof(size_t));
+
+			iterator += sizeof(size_t);
+
+			result |= stream_impl->write(policy, iterator, length);
+
+			iterator += length;
+		}
+
+		return result;
+	}
+}
+
+static int log_aspect_stream_batch_flush(void)
+{
+	struct log_aspect_stream_batch_type *batch = &log_aspect_stream_batch;
+
+	log_policy_schedule_impl schedule_impl;
+
+	int result;
+
+	if (batch->count == 0)
+	{
+		return 0;
+	}
+
+	schedule_impl = log_policy_derived(batch->schedule);
+
+	result = schedule_impl->enqueue(batch->schedule, &log_aspect_stream_impl_write_batch_drain_cb, (void *)batch->policy, batch->buffer, batch->size);
+
+	batch->size = 0;
+	batch->count = 0;
+
+	return result;
+}
+
+static int log_aspect_stream_batch_append(log_policy policy, log_policy schedule, log_aspect format, log_aspect_format_impl format_impl, log_record record, size_t size)
+{
+	struct log_aspect_stream_batch_type *batch = &log_aspect_stream_batch;
+
+	/* Records of different destinations never share a batch */
+	if (batch->count > 0 && (batch->policy != policy || batch->schedule != schedule))
+	{
+		if (log_aspect_stream_batch_flush() != 0)
+		{
+			return -1;
+		}
+	}
+
+	/* Oversized records do not fit even an empty batch, the caller
+	takes the single record enqueue path after the pending records */
+	if (sizeof(size_t) + size > LOG_ASPECT_STREAM_BATCH_CAPACITY)
+	{
+		if (log_aspect_stream_batch_flush() != 0)
+		{
+			return -1;
+		}
+
+		return 1;
+	}
+
+	if (batch->size + sizeof(size_t) + size > LOG_ASPECT_STREAM_BATCH_CAPACITY)
+	{
+		if (log_aspect_stream_batch_flush() != 0)
+		{
+			return -1;
+		}
+	}
+
+	/* Serialize directly into the thread local buffer, skipping the
+	per record allocation of the unbatched path */
+	if (format_impl->serialize(format, record, &batch->buffer[batch->size + sizeof(size_t)], size) != 0)
+	{
+		return 1;
+	}
+
+	memcpy(&batch->buffer[batch->size], &size, sizeof(size_t));
+
+	batch->size += sizeof(size_t) + size;
+
+	++batch->count;
+
+	batch->policy = policy;
+	batch->schedule = schedule;
+
+	/* Errors must reach the sink immediately, they cannot wait in a
+	thread private buffer behind a crash */
+	if (batch->count >= LOG_ASPECT_STREAM_BATCH_RECORDS || log_record_level(record) >= LOG_LEVEL_ERROR)
+	{
+		if (log_aspect_stream_batch_flush() != 0)
+		{
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+#endif
+
 static int log_aspect_stream_impl_write_execute_cb(log_policy policy, log_aspect_schedule_data data)
 {
 	log_aspect_stream_execute_cb_data execute_data = data;
@@ -170,6 +397,7 @@ static int log_aspect_stream_impl_write_execute_cb(log_policy policy, log_aspect
 
 	write_data.impl = execute_data->impl;
 	write_data.record = record;
+	write_data.schedule = policy;
 
 	result = log_aspect_notify_all(execute_data->aspect, &log_aspect_stream_impl_write_cb, (log_aspect_notify_data)&write_data);
 
@@ -217,6 +445,15 @@ static int log_aspect_stream_impl_flush_cb(log_aspect aspect, log_policy policy,
 
 static int log_aspect_stream_impl_flush(log_aspect aspect)
 {
+#if defined(LOG_ASPECT_STREAM_THREAD_LOCAL)
+	/* Only the batch of the calling thread is reachable, other threads
+	hand over their batches on their next write or at destruction */
+	if (log_aspect_stream_batch_flush() != 0)
+	{
+		return 1;
+	}
+#endif
+
 	return log_aspect_notify_all(aspect, &log_aspect_stream_impl_flush_cb, NULL);
 }
 
@@ -225,5 +462,28 @@ static int log_aspect_stream_destroy(log_aspect aspect)
 	/* TODO */
 	(void)aspect;
 
+#if defined(LOG_ASPECT_STREAM_THREAD_LOCAL)
+	/* The schedule aspect is destroyed before this one, so the pending
+	batch of the calling thread is drained synchronously against the
+	stream policy instead of going through the schedule ring */
+	{
+		struct log_aspect_stream_batch_type *batch = &log_aspect_stream_batch;
+
+		int result = 0;
+
+		if (batch->count > 0)
+		{
+			result = log_aspect_stream_impl_write_batch_drain_cb((void *)batch->policy, batch->buffer, batch->size);
+
+			result |= log_aspect_stream_impl_write_batch_drain_cb((void *)batch->policy, NULL, 0);
+
+			batch->size = 0;
+			batch->count = 0;
+		}
+
+		return result;
+	}
+#else
 	return 0;
+#endif
 }
@@ -70,6 +70,8 @@ log_impl log_impl_create(const char *name)
 		impl->level = LOG_LEVEL_INFO;
 #endif
 
+		log_level_floor(impl->level);
+
 		for (iterator = 0; iterator < LOG_ASPECT_SIZE; ++iterator)
 		{
 			impl->aspects[iterator] = NULL;
@@ -112,6 +114,8 @@ enum log_level_id log_impl_level(log_impl impl)
 void log_impl_verbosity(log_impl impl, enum log_level_id level)
 {
 	impl->level = level;
+
+	log_level_floor(level);
 }
 
 int log_impl_write(log_impl impl, const log_record_ctor record_ctor)
@@ -22,10 +22,18 @@
 
 #include <log/log_level.h>
 
+#include <threading/threading_atomic.h>
+
 #include <string.h>
 
 /* -- Private Variables -- */
 
+/* Most verbose level any logger may accept; it starts above every
+valid level so writes are skipped until the first logger registers,
+and it only moves down so the check stays conservative when a logger
+is later made less verbose */
+static size_t level_floor = LOG_LEVEL_SIZE;
+
 static const char *level_name_list[LOG_LEVEL_SIZE] = {
 	"Debug",
 	"Information",
@@ -55,3 +63,21 @@ enum log_level_id log_level_to_enum(const char *level, size_t length)
 
 	return LOG_LEVEL_SIZE;
 }
+
+void log_level_floor(const enum log_level_id level)
+{
+	size_t current = threading_atomic_load(&level_floor);
+
+	while ((size_t)level < current)
+	{
+		if (threading_atomic_compare_exchange(&level_floor, &current, (size_t)level))
+		{
+			break;
+		}
+	}
+}
+
+int log_level_enabled(const enum log_level_id level)
+{
+	return ((size_t)level >= threading_atomic_load(&level_floor));
+}
@@ -11,10 +11,55 @@
 #include <log/log_policy_format.h>
 #include <log/log_policy_format_binary.h>
 
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+/* The write path captures the format string and the raw argument
+values into the record layout instead of rendering them, so a record
+costs a scan of the specifiers plus a few copies and the printf work
+is deferred to log_policy_format_binary_print, which runs at read time
+and only for records that survived filtering. The layout uses native
+endianness and is not portable across hosts */
+
+#define LOG_POLICY_FORMAT_BINARY_LITERAL ((uint32_t)0x00000001) /**< The message carries no specifiers, print copies it verbatim */
+
+#define LOG_POLICY_FORMAT_BINARY_SPEC_SIZE ((size_t)0x40) /**< Capacity of the rebuilt specifier during print */
+
+/* -- Enumerations -- */
+
+enum log_policy_format_binary_tag_id
+{
+	LOG_POLICY_FORMAT_BINARY_TAG_INT = 0x00,
+	LOG_POLICY_FORMAT_BINARY_TAG_UINT = 0x01,
+	LOG_POLICY_FORMAT_BINARY_TAG_DOUBLE = 0x02,
+	LOG_POLICY_FORMAT_BINARY_TAG_CHAR = 0x03,
+	LOG_POLICY_FORMAT_BINARY_TAG_STRING = 0x04,
+	LOG_POLICY_FORMAT_BINARY_TAG_POINTER = 0x05
+};
+
+enum log_policy_format_binary_modifier_id
+{
+	LOG_POLICY_FORMAT_BINARY_MODIFIER_NONE = 0x00,
+	LOG_POLICY_FORMAT_BINARY_MODIFIER_CHAR = 0x01,
+	LOG_POLICY_FORMAT_BINARY_MODIFIER_SHORT = 0x02,
+	LOG_POLICY_FORMAT_BINARY_MODIFIER_LONG = 0x03,
+	LOG_POLICY_FORMAT_BINARY_MODIFIER_LONG_LONG = 0x04,
+	LOG_POLICY_FORMAT_BINARY_MODIFIER_MAX = 0x05,
+	LOG_POLICY_FORMAT_BINARY_MODIFIER_SIZE = 0x06,
+	LOG_POLICY_FORMAT_BINARY_MODIFIER_PTRDIFF = 0x07,
+	LOG_POLICY_FORMAT_BINARY_MODIFIER_LONG_DOUBLE = 0x08
+};
+
 /* -- Forward Declarations -- */
 
 struct log_policy_format_binary_data_type;
 
+struct log_policy_format_binary_header_type;
+
 /* -- Type Definitions -- */
 
 typedef struct log_policy_format_binary_data_type *log_policy_format_binary_data;
@@ -26,10 +71,29 @@ struct log_policy_format_binary_data_type
 	void *todo;
 };
 
+struct log_policy_format_binary_header_type
+{
+	uint64_t time;		   /**< Timestamp of the record (time_t) */
+	uint64_t thread_id;	   /**< Identifier of the writing thread */
+	uint64_t line;		   /**< Line of the call site */
+	uint32_t level;		   /**< Level of the record (enum log_level_id) */
+	uint32_t flags;		   /**< Binary or of LOG_POLICY_FORMAT_BINARY flags */
+	uint32_t count;		   /**< Captured arguments following the strings */
+	uint32_t message_size; /**< Bytes of the format string including the null */
+	uint32_t func_size;	   /**< Bytes of the function name including the null */
+	uint32_t file_size;	   /**< Bytes of the file name including the null */
+};
+
 /* -- Private Methods -- */
 
 static int log_policy_format_binary_create(log_policy policy, const log_policy_ctor ctor);
 
+static const char *log_policy_format_binary_spec(const char *iterator, int *stars, int *modifier, char *conversion);
+
+static size_t log_policy_format_binary_pack(void *buffer, size_t offset, uint8_t tag, const void *payload, size_t payload_size);
+
+static size_t log_policy_format_binary_capture(const char *message, struct log_record_va_list_type *variable_args, void *buffer, size_t offset, uint32_t *count);
+
 static size_t log_policy_format_binary_size(log_policy policy, const log_record record);
 
 static size_t log_policy_format_binary_serialize(log_policy policy, const log_record record, void *buffer, const size_t size);
@@ -73,41 +137,906 @@ static int log_policy_format_binary_create(log_policy policy, const log_policy_c
 	return 0;
 }
 
+static const char *log_policy_format_binary_spec(const char *iterator, int *stars, int *modifier, char *conversion)
+{
+	*stars = 0;
+	*modifier = LOG_POLICY_FORMAT_BINARY_MODIFIER_NONE;
+
+	/* Flags */
+	while (*iterator == '-' || *iterator == '+' || *iterator == ' ' || *iterator == '#' || *iterator == '0' || *iterator == '\'')
+	{
+		++iterator;
+	}
+
+	/* Width */
+	if (*iterator == '*')
+	{
+		++(*stars);
+		++iterator;
+	}
+	else
+	{
+		while (*iterator >= '0' && *iterator <= '9')
+		{
+			++iterator;
+		}
+	}
+
+	/* Precision */
+	if (*iterator == '.')
+	{
+		++iterator;
+
+		if (*iterator == '*')
+		{
+			++(*stars);
+			++iterator;
+		}
+		else
+		{
+			while (*iterator >= '0' && *iterator <= '9')
+			{
+				++iterator;
+			}
+		}
+	}
+
+	/* Length modifier */
+	switch (*iterator)
+	{
+		case 'h': {
+			++iterator;
+
+			if (*iterator == 'h')
+			{
+				++iterator;
+				*modifier = LOG_POLICY_FORMAT_BINARY_MODIFIER_CHAR;
+			}
+			else
+			{
+				*modifier = LOG_POLICY_FORMAT_BINARY_MODIFIER_SHORT;
+			}
+
+			break;
+		}
+
+		case 'l': {
+			++iterator;
+
+			if (*iterator == 'l')
+			{
+				++iterator;
+				*modifier = LOG_POLICY_FORMAT_BINARY_MODIFIER_LONG_LONG;
+			}
+			else
+			{
+				*modifier = LOG_POLICY_FORMAT_BINARY_MODIFIER_LONG;
+			}
+
+			break;
+		}
+
+		case 'j': {
+			++iterator;
+			*modifier = LOG_POLICY_FORMAT_BINARY_MODIFIER_MAX;
+			break;
+		}
+
+		case 'z': {
+			++iterator;
+			*modifier = LOG_POLICY_FORMAT_BINARY_MODIFIER_SIZE;
+			break;
+		}
+
+		case 't': {
+			++iterator;
+			*modifier = LOG_POLICY_FORMAT_BINARY_MODIFIER_PTRDIFF;
+			break;
+		}
+
+		case 'L': {
+			++iterator;
+			*modifier = LOG_POLICY_FORMAT_BINARY_MODIFIER_LONG_DOUBLE;
+			break;
+		}
+	}
+
+	*conversion = *iterator;
+
+	if (*iterator == '\0')
+	{
+		return NULL;
+	}
+
+	return iterator + 1;
+}
+
+static size_t log_policy_format_binary_pack(void *buffer, size_t offset, uint8_t tag, const void *payload, size_t payload_size)
+{
+	if (buffer != NULL)
+	{
+		char *dest = (char *)buffer + offset;
+
+		*dest = (char)tag;
+
+		memcpy(dest + 1, payload, payload_size);
+	}
+
+	return offset + 1 + payload_size;
+}
+
+static size_t log_policy_format_binary_capture(const char *message, struct log_record_va_list_type *variable_args, void *buffer, size_t offset, uint32_t *count)
+{
+	const char *iterator = message;
+
+	va_list args;
+
+	*count = 0;
+
+	va_copy(args, variable_args->data);
+
+	while (*iterator != '\0')
+	{
+		int stars, modifier, star;
+
+		char conversion;
+
+		if (*iterator != '%')
+		{
+			++iterator;
+			continue;
+		}
+
+		++iterator;
+
+		if (*iterator == '%')
+		{
+			++iterator;
+			continue;
+		}
+
+		iterator = log_policy_format_binary_spec(iterator, &stars, &modifier, &conversion);
+
+		if (iterator == NULL)
+		{
+			break;
+		}
+
+		/* Star widths and precisions are arguments of their own,
+		captured ahead of the value like printf consumes them */
+		for (star = 0; star < stars; ++star)
+		{
+			int64_t value = (int64_t)va_arg(args, int);
+
+			offset = log_policy_format_binary_pack(buffer, offset, LOG_POLICY_FORMAT_BINARY_TAG_INT, &value, sizeof(value));
+
+			++(*count);
+		}
+
+		switch (conversion)
+		{
+			case 'd':
+			case 'i': {
+				int64_t value;
+
+				switch (modifier)
+				{
+					case LOG_POLICY_FORMAT_BINARY_MODIFIER_LONG:
+						value = (int64_t)va_arg(args, long);
+						break;
+
+					case LOG_POLICY_FORMAT_BINARY_MODIFIER_LONG_LONG:
+						value = (int64_t)va_arg(args, long long);
+						break;
+
+					case LOG_POLICY_FORMAT_BINARY_MODIFIER_MAX:
+						value = (int64_t)va_arg(args, intmax_t);
+						break;
+
+					case LOG_POLICY_FORMAT_BINARY_MODIFIER_SIZE:
+						value = (int64_t)va_arg(args, size_t);
+						break;
+
+					case LOG_POLICY_FORMAT_BINARY_MODIFIER_PTRDIFF:
+						value = (int64_t)va_arg(args, ptrdiff_t);
+						break;
+
+					default:
+						value = (int64_t)va_arg(args, int);
+						break;
+				}
+
+				offset = log_policy_format_binary_pack(buffer, offset, LOG_POLICY_FORMAT_BINARY_TAG_INT, &value, sizeof(value));
+
+				++(*count);
+
+				break;
+			}
+
+			case 'u':
+			case 'o':
+			case 'x':
+			case 'X': {
+				uint64_t value;
+
+				switch (modifier)
+				{
+					case LOG_POLICY_FORMAT_BINARY_MODIFIER_LONG:
+						value = (uint64_t)va_arg(args, unsigned long);
+						break;
+
+					case LOG_POLICY_FORMAT_BINARY_MODIFIER_LONG_LONG:
+						value = (uint64_t)va_arg(args, unsigned long long);
+						break;
+
+					case LOG_POLICY_FORMAT_BINARY_MODIFIER_MAX:
+						value = (uint64_t)va_arg(args, uintmax_t);
+						break;
+
+					case LOG_POLICY_FORMAT_BINARY_MODIFIER_SIZE:
+						value = (uint64_t)va_arg(args, size_t);
+						break;
+
+					case LOG_POLICY_FORMAT_BINARY_MODIFIER_PTRDIFF:
+						value = (uint64_t)va_arg(args, ptrdiff_t);
+						break;
+
+					default:
+						value = (uint64_t)va_arg(args, unsigned int);
+						break;
+				}
+
+				offset = log_policy_format_binary_pack(buffer, offset, LOG_POLICY_FORMAT_BINARY_TAG_UINT, &value, sizeof(value));
+
+				++(*count);
+
+				break;
+			}
+
+			case 'f':
+			case 'F':
+			case 'e':
+			case 'E':
+			case 'g':
+			case 'G':
+			case 'a':
+			case 'A': {
+				/* Long doubles are narrowed, the extended precision
+				does not survive the capture */
+				double value = (modifier == LOG_POLICY_FORMAT_BINARY_MODIFIER_LONG_DOUBLE) ?
+								   (double)va_arg(args, long double) :
+								   va_arg(args, double);
+
+				offset = log_policy_format_binary_pack(buffer, offset, LOG_POLICY_FORMAT_BINARY_TAG_DOUBLE, &value, sizeof(value));
+
+				++(*count);
+
+				break;
+			}
+
+			case 'c': {
+				int32_t value = (int32_t)va_arg(args, int);
+
+				offset = log_policy_format_binary_pack(buffer, offset, LOG_POLICY_FORMAT_BINARY_TAG_CHAR, &value, sizeof(value));
+
+				++(*count);
+
+				break;
+			}
+
+			case 's': {
+				if (modifier == LOG_POLICY_FORMAT_BINARY_MODIFIER_LONG)
+				{
+					/* Wide strings are captured as pointers and
+					rendered as such */
+					uint64_t value = (uint64_t)(uintptr_t)va_arg(args, void *);
+
+					offset = log_policy_format_binary_pack(buffer, offset, LOG_POLICY_FORMAT_BINARY_TAG_POINTER, &value, sizeof(value));
+				}
+				else
+				{
+					/* String bytes are copied into the record, the
+					pointer may not outlive the write */
+					const char *value = va_arg(args, const char *);
+
+					uint32_t length;
+
+					if (value == NULL)
+					{
+						value = "(null)";
+					}
+
+					length = (uint32_t)(strlen(value) + 1);
+
+					if (buffer != NULL)
+					{
+						char *dest = (char *)buffer + offset;
+
+						*dest = (char)LOG_POLICY_FORMAT_BINARY_TAG_STRING;
+
+						memcpy(dest + 1, &length, sizeof(length));
+
+						memcpy(dest + 1 + sizeof(length), value, length);
+					}
+
+					offset += 1 + sizeof(length) + length;
+				}
+
+				++(*count);
+
+				break;
+			}
+
+			default: {
+				/* Pointers and unknown conversions consume one
+				pointer sized argument */
+				uint64_t value = (uint64_t)(uintptr_t)va_arg(args, void *);
+
+				offset = log_policy_format_binary_pack(buffer, offset, LOG_POLICY_FORMAT_BINARY_TAG_POINTER, &value, sizeof(value));
+
+				++(*count);
+
+				break;
+			}
+		}
+	}
+
+	va_end(args);
+
+	return offset;
+}
+
 static size_t log_policy_format_binary_size(log_policy policy, const log_record record)
 {
-	const size_t mock_binary_size = 1;
+	struct log_record_va_list_type *variable_args = log_record_variable_args(record);
+
+	const char *message = log_record_message(record);
+
+	size_t offset = sizeof(struct log_policy_format_binary_header_type);
+
+	uint32_t count;
 
 	(void)policy;
-	(void)record;
 
-	/* TODO: implement properly this */
-	return mock_binary_size;
+	offset += strlen(message) + 1;
+	offset += strlen(log_record_func(record)) + 1;
+	offset += strlen(log_record_file(record)) + 1;
+
+	if (variable_args != NULL)
+	{
+		offset = log_policy_format_binary_capture(message, variable_args, NULL, offset, &count);
+	}
+
+	/* Stream policies strip a trailing null byte from every write, the
+	pad keeps the record intact on disk like the text policy does */
+	return offset + 1;
 }
 
 static size_t log_policy_format_binary_serialize(log_policy policy, const log_record record, void *buffer, const size_t size)
 {
-	log_policy_format_binary_data binary_data = log_policy_instance(policy);
+	struct log_record_va_list_type *variable_args = log_record_variable_args(record);
 
-	(void)binary_data;
-	(void)record;
-	(void)size;
+	const char *message = log_record_message(record);
+
+	struct log_policy_format_binary_header_type header;
+
+	size_t offset = sizeof(struct log_policy_format_binary_header_type);
+
+	(void)policy;
+
+	header.time = (uint64_t)*log_record_time(record);
+	header.thread_id = log_record_thread_id(record);
+	header.line = (uint64_t)log_record_line(record);
+	header.level = (uint32_t)log_record_level(record);
+	header.flags = 0;
+	header.count = 0;
+	header.message_size = (uint32_t)(strlen(message) + 1);
+	header.func_size = (uint32_t)(strlen(log_record_func(record)) + 1);
+	header.file_size = (uint32_t)(strlen(log_record_file(record)) + 1);
+
+	memcpy((char *)buffer + offset, message, header.message_size);
+
+	offset += header.message_size;
+
+	memcpy((char *)buffer + offset, log_record_func(record), header.func_size);
+
+	offset += header.func_size;
+
+	memcpy((char *)buffer + offset, log_record_file(record), header.file_size);
+
+	offset += header.file_size;
+
+	if (variable_args != NULL)
+	{
+		offset = log_policy_format_binary_capture(message, variable_args, buffer, offset, &header.count);
+	}
+	else
+	{
+		header.flags |= LOG_POLICY_FORMAT_BINARY_LITERAL;
+	}
+
+	memcpy(buffer, &header, sizeof(header));
+
+	if (offset + 1 > size)
+	{
+		return 0;
+	}
 
-	/* TODO: implement properly this */
-	*((char *)buffer) = '\0';
+	((char *)buffer)[offset] = '\0';
 
-	return size;
+	return offset + 1;
 }
 
 static size_t log_policy_format_binary_deserialize(log_policy policy, log_record record, const void *buffer, const size_t size)
 {
-	log_policy_format_binary_data binary_data = log_policy_instance(policy);
+	struct log_policy_format_binary_header_type header;
+
+	size_t offset;
 
-	(void)binary_data;
+	(void)policy;
 	(void)record;
-	(void)buffer;
-	(void)size;
 
-	return size;
+	if (size < sizeof(header))
+	{
+		return 0;
+	}
+
+	memcpy(&header, buffer, sizeof(header));
+
+	offset = sizeof(header) + header.message_size + header.func_size + header.file_size;
+
+	if (offset > size)
+	{
+		return 0;
+	}
+
+	/* Walk the argument section so the consumed size lets a reader
+	advance through concatenated records, the fields themselves are
+	rendered through log_policy_format_binary_print */
+	{
+		uint32_t argument;
+
+		for (argument = 0; argument < header.count; ++argument)
+		{
+			uint8_t tag;
+
+			if (offset >= size)
+			{
+				return 0;
+			}
+
+			tag = (uint8_t)((const char *)buffer)[offset++];
+
+			switch (tag)
+			{
+				case LOG_POLICY_FORMAT_BINARY_TAG_INT:
+				case LOG_POLICY_FORMAT_BINARY_TAG_UINT:
+				case LOG_POLICY_FORMAT_BINARY_TAG_POINTER: {
+					offset += sizeof(uint64_t);
+					break;
+				}
+
+				case LOG_POLICY_FORMAT_BINARY_TAG_DOUBLE: {
+					offset += sizeof(double);
+					break;
+				}
+
+				case LOG_POLICY_FORMAT_BINARY_TAG_CHAR: {
+					offset += sizeof(int32_t);
+					break;
+				}
+
+				case LOG_POLICY_FORMAT_BINARY_TAG_STRING: {
+					uint32_t string_size;
+
+					if (offset + sizeof(string_size) > size)
+					{
+						return 0;
+					}
+
+					memcpy(&string_size, (const char *)buffer + offset, sizeof(string_size));
+
+					offset += sizeof(string_size) + string_size;
+
+					break;
+				}
+
+				default: {
+					return 0;
+				}
+			}
+		}
+
+		if (offset > size)
+		{
+			return 0;
+		}
+	}
+
+	return offset;
+}
+
+size_t log_policy_format_binary_print(const void *buffer, const size_t size, char *dest, const size_t dest_size)
+{
+	struct log_policy_format_binary_header_type header;
+
+	const char *message, *iterator, *cursor;
+
+	size_t length = 0;
+
+	uint32_t argument;
+
+	if (buffer == NULL || size < sizeof(header))
+	{
+		return 0;
+	}
+
+	memcpy(&header, buffer, sizeof(header));
+
+	if (sizeof(header) + header.message_size + header.func_size + header.file_size > size)
+	{
+		return 0;
+	}
+
+	message = (const char *)buffer + sizeof(header);
+
+	cursor = message + header.message_size + header.func_size + header.file_size;
+
+	if (header.flags & LOG_POLICY_FORMAT_BINARY_LITERAL)
+	{
+		length = header.message_size > 0 ? header.message_size - 1 : 0;
+
+		if (dest != NULL && dest_size > length)
+		{
+			memcpy(dest, message, length);
+
+			dest[length] = '\0';
+		}
+
+		return length;
+	}
+
+	argument = 0;
+
+	for (iterator = message; *iterator != '\0';)
+	{
+		char spec[LOG_POLICY_FORMAT_BINARY_SPEC_SIZE];
+
+		size_t spec_length = 0;
+
+		int stars, modifier, star;
+
+		char conversion;
+
+		const char *spec_begin, *next;
+
+		uint8_t tag;
+
+		char *out;
+
+		size_t remaining;
+
+		if (*iterator != '%')
+		{
+			if (dest != NULL && length + 1 < dest_size)
+			{
+				dest[length] = *iterator;
+			}
+
+			++length;
+			++iterator;
+			continue;
+		}
+
+		++iterator;
+
+		if (*iterator == '%')
+		{
+			if (dest != NULL && length + 1 < dest_size)
+			{
+				dest[length] = '%';
+			}
+
+			++length;
+			++iterator;
+			continue;
+		}
+
+		spec_begin = iterator;
+
+		next = log_policy_format_binary_spec(iterator, &stars, &modifier, &conversion);
+
+		if (next == NULL)
+		{
+			break;
+		}
+
+		/* Rebuild the specifier with star widths and precisions
+		materialized from the captured arguments and the length
+		modifier normalized to the captured representation */
+		spec[spec_length++] = '%';
+
+		while (*spec_begin == '-' || *spec_begin == '+' || *spec_begin == ' ' || *spec_begin == '#' || *spec_begin == '0' || *spec_begin == '\'')
+		{
+			if (spec_length < sizeof(spec) - 1)
+			{
+				spec[spec_length++] = *spec_begin;
+			}
+
+			++spec_begin;
+		}
+
+		for (star = 0; star < 2; ++star)
+		{
+			int precision = (star == 1);
+
+			int64_t value;
+
+			if (precision)
+			{
+				if (*spec_begin != '.')
+				{
+					break;
+				}
+
+				++spec_begin;
+			}
+
+			if (*spec_begin == '*')
+			{
+				++spec_begin;
+
+				if (argument >= header.count || (size_t)(cursor - (const char *)buffer) >= size)
+				{
+					return 0;
+				}
+
+				++argument;
+
+				if (*cursor++ != (char)LOG_POLICY_FORMAT_BINARY_TAG_INT)
+				{
+					return 0;
+				}
+
+				memcpy(&value, cursor, sizeof(value));
+
+				cursor += sizeof(value);
+
+				if (precision)
+				{
+					/* A negative precision behaves as if omitted */
+					if (value >= 0)
+					{
+						spec_length += (size_t)snprintf(&spec[spec_length], sizeof(spec) - spec_length, ".%d", (int)value);
+					}
+				}
+				else
+				{
+					/* A negative width behaves as the left justify flag */
+					if (value < 0)
+					{
+						spec[spec_length++] = '-';
+						value = -value;
+					}
+
+					spec_length += (size_t)snprintf(&spec[spec_length], sizeof(spec) - spec_length, "%d", (int)value);
+				}
+			}
+			else
+			{
+				if (precision)
+				{
+					spec[spec_length++] = '.';
+				}
+
+				while (*spec_begin >= '0' && *spec_begin <= '9')
+				{
+					if (spec_length < sizeof(spec) - 1)
+					{
+						spec[spec_length++] = *spec_begin;
+					}
+
+					++spec_begin;
+				}
+			}
+		}
+
+		iterator = next;
+
+		if (argument >= header.count || (size_t)(cursor - (const char *)buffer) >= size)
+		{
+			return 0;
+		}
+
+		++argument;
+
+		tag = (uint8_t)*cursor++;
+
+		if (spec_length + 4 > sizeof(spec))
+		{
+			return 0;
+		}
+
+		if (dest != NULL && length < dest_size)
+		{
+			out = &dest[length];
+			remaining = dest_size - length;
+		}
+		else
+		{
+			out = NULL;
+			remaining = 0;
+		}
+
+		switch (tag)
+		{
+			case LOG_POLICY_FORMAT_BINARY_TAG_INT: {
+				int64_t value;
+
+				int result;
+
+				memcpy(&value, cursor, sizeof(value));
+
+				cursor += sizeof(value);
+
+				spec[spec_length++] = 'l';
+				spec[spec_length++] = 'l';
+				spec[spec_length++] = (conversion == 'i') ? 'i' : 'd';
+				spec[spec_length] = '\0';
+
+				result = snprintf(out, remaining, spec, (long long)value);
+
+				if (result < 0)
+				{
+					return 0;
+				}
+
+				length += (size_t)result;
+
+				break;
+			}
+
+			case LOG_POLICY_FORMAT_BINARY_TAG_UINT: {
+				uint64_t value;
+
+				int result;
+
+				memcpy(&value, cursor, sizeof(value));
+
+				cursor += sizeof(value);
+
+				spec[spec_length++] = 'l';
+				spec[spec_length++] = 'l';
+				spec[spec_length++] = (conversion == 'o' || conversion == 'x' || conversion == 'X') ? conversion : 'u';
+				spec[spec_length] = '\0';
+
+				result = snprintf(out, remaining, spec, (unsigned long long)value);
+
+				if (result < 0)
+				{
+					return 0;
+				}
+
+				length += (size_t)result;
+
+				break;
+			}
+
+			case LOG_POLICY_FORMAT_BINARY_TAG_DOUBLE: {
+				double value;
+
+				int result;
+
+				memcpy(&value, cursor, sizeof(value));
+
+				cursor += sizeof(value);
+
+				spec[spec_length++] = conversion;
+				spec[spec_length] = '\0';
+
+				result = snprintf(out, remaining, spec, value);
+
+				if (result < 0)
+				{
+					return 0;
+				}
+
+				length += (size_t)result;
+
+				break;
+			}
+
+			case LOG_POLICY_FORMAT_BINARY_TAG_CHAR: {
+				int32_t value;
+
+				int result;
+
+				memcpy(&value, cursor, sizeof(value));
+
+				cursor += sizeof(value);
+
+				spec[spec_length++] = 'c';
+				spec[spec_length] = '\0';
+
+				result = snprintf(out, remaining, spec, (int)value);
+
+				if (result < 0)
+				{
+					return 0;
+				}
+
+				length += (size_t)result;
+
+				break;
+			}
+
+			case LOG_POLICY_FORMAT_BINARY_TAG_STRING: {
+				uint32_t string_size;
+
+				int result;
+
+				memcpy(&string_size, cursor, sizeof(string_size));
+
+				cursor += sizeof(string_size);
+
+				if ((size_t)(cursor - (const char *)buffer) + string_size > size)
+				{
+					return 0;
+				}
+
+				spec[spec_length++] = 's';
+				spec[spec_length] = '\0';
+
+				result = snprintf(out, remaining, spec, cursor);
+
+				if (result < 0)
+				{
+					return 0;
+				}
+
+				length += (size_t)result;
+
+				cursor += string_size;
+
+				break;
+			}
+
+			case LOG_POLICY_FORMAT_BINARY_TAG_POINTER: {
+				uint64_t value;
+
+				int result;
+
+				memcpy(&value, cursor, sizeof(value));
+
+				cursor += sizeof(value);
+
+				spec[spec_length++] = 'p';
+				spec[spec_length] = '\0';
+
+				result = snprintf(out, remaining, spec, (void *)(uintptr_t)value);
+
+				if (result < 0)
+				{
+					return 0;
+				}
+
+				length += (size_t)result;
+
+				break;
+			}
+
+			default: {
+				return 0;
+			}
+		}
+	}
+
+	if (dest != NULL && dest_size > 0)
+	{
+		dest[length < dest_size ? length : dest_size - 1] = '\0';
+	}
+
+	return length;
 }
 
 static int log_policy_format_binary_destroy(log_policy policy)
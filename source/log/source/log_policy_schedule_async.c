@@ -11,20 +11,66 @@
 #include <log/log_policy_schedule.h>
 #include <log/log_policy_schedule_async.h>
 
+#include <threading/threading_atomic.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#include <windows.h>
+#else
+	#include <pthread.h>
+	#include <time.h>
+#endif
+
+/* -- Definitions -- */
+
+#define LOG_POLICY_SCHEDULE_ASYNC_RING_SIZE ((size_t)0x00000100) /**< Number of ring slots, must be a power of two */
+#define LOG_POLICY_SCHEDULE_ASYNC_SLOT_SIZE ((size_t)0x00000200) /**< Payload bytes available per slot */
+
 /* -- Forward Declarations -- */
 
+struct log_policy_schedule_async_slot_type;
+
 struct log_policy_schedule_async_data_type;
 
 /* -- Type Definitions -- */
 
+typedef struct log_policy_schedule_async_slot_type *log_policy_schedule_async_slot;
+
 typedef struct log_policy_schedule_async_data_type *log_policy_schedule_async_data;
 
 /* -- Member Data -- */
 
+/* Bounded multi-producer single-consumer ring; each slot carries its
+own sequence counter so producers claim a slot with a single compare
+and exchange on the enqueue cursor and publish it by bumping the
+sequence once the payload memcpy is done, no mutex is ever taken on
+the producer side */
+struct log_policy_schedule_async_slot_type
+{
+	size_t sequence;
+	log_policy_schedule_enqueue_cb callback;
+	void *context;
+	size_t size;
+	char data[LOG_POLICY_SCHEDULE_ASYNC_SLOT_SIZE];
+};
+
 struct log_policy_schedule_async_data_type
 {
-	/* TODO: this must be implemented with free-lock */
-	void *mutex;
+	struct log_policy_schedule_async_slot_type ring[LOG_POLICY_SCHEDULE_ASYNC_RING_SIZE];
+	size_t enqueue_pos;
+	size_t dequeue_pos;
+	size_t running;
+
+#if defined(_WIN32)
+	HANDLE thread;
+#else
+	pthread_t thread;
+#endif
 };
 
 /* -- Private Methods -- */
@@ -37,6 +83,18 @@ static int log_policy_schedule_async_execute(log_policy policy, log_policy_sched
 
 static int log_policy_schedule_async_unlock(log_policy policy);
 
+static int log_policy_schedule_async_enqueue(log_policy policy, log_policy_schedule_enqueue_cb callback, void *context, const void *buffer, size_t size);
+
+static size_t log_policy_schedule_async_drain(log_policy_schedule_async_data async_data);
+
+static void log_policy_schedule_async_sleep(void);
+
+#if defined(_WIN32)
+static DWORD WINAPI log_policy_schedule_async_thread(LPVOID data);
+#else
+static void *log_policy_schedule_async_thread(void *data);
+#endif
+
 static int log_policy_schedule_async_destroy(log_policy policy);
 
 /* -- Methods -- */
@@ -46,7 +104,8 @@ log_policy_interface log_policy_schedule_async_interface()
 	static struct log_policy_schedule_impl_type log_policy_schedule_async_impl_obj = {
 		&log_policy_schedule_async_lock,
 		&log_policy_schedule_async_execute,
-		&log_policy_schedule_async_unlock
+		&log_policy_schedule_async_unlock,
+		&log_policy_schedule_async_enqueue
 	};
 
 	static struct log_policy_interface_type policy_interface_schedule = {
@@ -62,6 +121,8 @@ static int log_policy_schedule_async_create(log_policy policy, const log_policy_
 {
 	log_policy_schedule_async_data async_data = malloc(sizeof(struct log_policy_schedule_async_data_type));
 
+	size_t iterator;
+
 	(void)ctor;
 
 	if (async_data == NULL)
@@ -69,7 +130,32 @@ static int log_policy_schedule_async_create(log_policy policy, const log_policy_
 		return 1;
 	}
 
-	async_data->mutex = NULL;
+	for (iterator = 0; iterator < LOG_POLICY_SCHEDULE_ASYNC_RING_SIZE; ++iterator)
+	{
+		async_data->ring[iterator].sequence = iterator;
+	}
+
+	async_data->enqueue_pos = 0;
+	async_data->dequeue_pos = 0;
+	async_data->running = 1;
+
+#if defined(_WIN32)
+	async_data->thread = CreateThread(NULL, 0, &log_policy_schedule_async_thread, async_data, 0, NULL);
+
+	if (async_data->thread == NULL)
+	{
+		free(async_data);
+
+		return 1;
+	}
+#else
+	if (pthread_create(&async_data->thread, NULL, &log_policy_schedule_async_thread, async_data) != 0)
+	{
+		free(async_data);
+
+		return 1;
+	}
+#endif
 
 	log_policy_instantiate(policy, async_data, LOG_POLICY_SCHEDULE_ASYNC);
 
@@ -80,8 +166,6 @@ static int log_policy_schedule_async_lock(log_policy policy)
 {
 	(void)policy;
 
-	/* mutex_lock(mutex); */
-
 	return 0;
 }
 
@@ -96,17 +180,192 @@ static int log_policy_schedule_async_unlock(log_policy policy)
 {
 	(void)policy;
 
-	/* mutex_unlock(mutex); */
+	return 0;
+}
+
+static int log_policy_schedule_async_enqueue(log_policy policy, log_policy_schedule_enqueue_cb callback, void *context, const void *buffer, size_t size)
+{
+	log_policy_schedule_async_data async_data = log_policy_instance(policy);
+
+	log_policy_schedule_async_slot slot;
+
+	size_t pos, sequence;
+
+	if (callback == NULL || buffer == NULL)
+	{
+		return 1;
+	}
+
+	/* Payloads larger than a slot are delivered synchronously
+	instead of blocking the producer until the ring drains */
+	if (size > LOG_POLICY_SCHEDULE_ASYNC_SLOT_SIZE)
+	{
+		if (callback(context, buffer, size) != 0)
+		{
+			return 1;
+		}
+
+		return callback(context, NULL, 0);
+	}
+
+	pos = threading_atomic_load(&async_data->enqueue_pos);
+
+	for (;;)
+	{
+		intptr_t difference;
+
+		slot = &async_data->ring[pos & (LOG_POLICY_SCHEDULE_ASYNC_RING_SIZE - 1)];
+
+		sequence = threading_atomic_load(&slot->sequence);
+
+		/* Signed distance so the comparison survives counter wrap */
+		difference = (intptr_t)(sequence - pos);
+
+		if (difference == 0)
+		{
+			/* The slot is free, claim it by advancing the cursor */
+			if (threading_atomic_compare_exchange(&async_data->enqueue_pos, &pos, pos + 1))
+			{
+				break;
+			}
+
+			/* Lost the race, @pos already holds the refreshed cursor */
+		}
+		else if (difference < 0)
+		{
+			/* The ring is full, deliver synchronously rather than
+			blocking the producer behind the drain thread */
+			if (callback(context, buffer, size) != 0)
+			{
+				return 1;
+			}
+
+			return callback(context, NULL, 0);
+		}
+		else
+		{
+			pos = threading_atomic_load(&async_data->enqueue_pos);
+		}
+	}
+
+	slot->callback = callback;
+	slot->context = context;
+	slot->size = size;
+
+	memcpy(slot->data, buffer, size);
+
+	/* Publish the slot to the consumer */
+	threading_atomic_store(&slot->sequence, pos + 1);
 
 	return 0;
 }
 
+static size_t log_policy_schedule_async_drain(log_policy_schedule_async_data async_data)
+{
+	size_t drained = 0;
+
+	log_policy_schedule_enqueue_cb flush_callback = NULL;
+
+	void *flush_context = NULL;
+
+	for (;;)
+	{
+		size_t pos = async_data->dequeue_pos;
+
+		log_policy_schedule_async_slot slot = &async_data->ring[pos & (LOG_POLICY_SCHEDULE_ASYNC_RING_SIZE - 1)];
+
+		size_t sequence = threading_atomic_load(&slot->sequence);
+
+		if (sequence != pos + 1)
+		{
+			break;
+		}
+
+		/* Flush the previous destination when the batch switches to
+		a different one, so each destination sees a single flush per
+		drained run instead of one per record */
+		if (flush_callback != NULL && (flush_callback != slot->callback || flush_context != slot->context))
+		{
+			flush_callback(flush_context, NULL, 0);
+		}
+
+		slot->callback(slot->context, slot->data, slot->size);
+
+		flush_callback = slot->callback;
+		flush_context = slot->context;
+
+		/* Release the slot for the next lap of producers */
+		threading_atomic_store(&slot->sequence, pos + LOG_POLICY_SCHEDULE_ASYNC_RING_SIZE);
+
+		async_data->dequeue_pos = pos + 1;
+
+		++drained;
+	}
+
+	if (flush_callback != NULL)
+	{
+		flush_callback(flush_context, NULL, 0);
+	}
+
+	return drained;
+}
+
+static void log_policy_schedule_async_sleep(void)
+{
+#if defined(_WIN32)
+	Sleep(1);
+#else
+	struct timespec interval;
+
+	interval.tv_sec = 0;
+	interval.tv_nsec = 1000000;
+
+	nanosleep(&interval, NULL);
+#endif
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI log_policy_schedule_async_thread(LPVOID data)
+#else
+static void *log_policy_schedule_async_thread(void *data)
+#endif
+{
+	log_policy_schedule_async_data async_data = data;
+
+	while (threading_atomic_load(&async_data->running) != 0)
+	{
+		if (log_policy_schedule_async_drain(async_data) == 0)
+		{
+			log_policy_schedule_async_sleep();
+		}
+	}
+
+	/* Deliver whatever producers enqueued before shutdown */
+	log_policy_schedule_async_drain(async_data);
+
+#if defined(_WIN32)
+	return 0;
+#else
+	return NULL;
+#endif
+}
+
 static int log_policy_schedule_async_destroy(log_policy policy)
 {
 	log_policy_schedule_async_data async_data = log_policy_instance(policy);
 
 	if (async_data != NULL)
 	{
+		threading_atomic_store(&async_data->running, 0);
+
+#if defined(_WIN32)
+		WaitForSingleObject(async_data->thread, INFINITE);
+
+		CloseHandle(async_data->thread);
+#else
+		pthread_join(async_data->thread, NULL);
+#endif
+
 		free(async_data);
 	}
 
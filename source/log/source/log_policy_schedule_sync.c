@@ -30,7 +30,8 @@ log_policy_interface log_policy_schedule_sync_interface()
 	static struct log_policy_schedule_impl_type log_policy_schedule_sync_impl_obj = {
 		&log_policy_schedule_sync_lock,
 		&log_policy_schedule_sync_execute,
-		&log_policy_schedule_sync_unlock
+		&log_policy_schedule_sync_unlock,
+		NULL
 	};
 
 	static struct log_policy_interface_type policy_interface_schedule = {
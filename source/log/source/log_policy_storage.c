@@ -10,6 +10,7 @@
 
 #include <log/log_policy_storage.h>
 #include <log/log_policy_storage_batch.h>
+#include <log/log_policy_storage_mmap.h>
 #include <log/log_policy_storage_sequential.h>
 
 /* -- Methods -- */
@@ -18,7 +19,8 @@ log_policy_interface log_policy_storage(const log_policy_id policy_storage_id)
 {
 	static const log_policy_singleton policy_storage_singleton[LOG_POLICY_STORAGE_SIZE] = {
 		&log_policy_storage_batch_interface,
-		&log_policy_storage_sequential_interface
+		&log_policy_storage_sequential_interface,
+		&log_policy_storage_mmap_interface
 	};
 
 	return policy_storage_singleton[policy_storage_id]();
@@ -37,3 +39,13 @@ log_policy log_policy_storage_sequential(void)
 {
 	return log_policy_create(LOG_ASPECT_STORAGE, log_policy_storage(LOG_POLICY_STORAGE_SEQUENTIAL), NULL);
 }
+
+log_policy log_policy_storage_mmap(const char *path, size_t size)
+{
+	struct log_policy_storage_mmap_ctor_type mmap_ctor;
+
+	mmap_ctor.path = path;
+	mmap_ctor.size = size;
+
+	return log_policy_create(LOG_ASPECT_STORAGE, log_policy_storage(LOG_POLICY_STORAGE_MMAP), &mmap_ctor);
+}
@@ -0,0 +1,397 @@
+/*
+*	Logger Library by Parra Studios
+*	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+*
+*	A generic logger library providing application execution reports.
+*
+*/
+
+/* -- Headers -- */
+
+#include <log/log_policy_storage.h>
+#include <log/log_policy_storage_mmap.h>
+#include <log/log_record.h>
+
+#include <format/format_specifier.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <unistd.h>
+#endif
+
+#ifndef va_copy
+	#if defined(__va_copy)
+		#define va_copy(dest, src) __va_copy((dest), (src))
+	#elif defined(__builtin_va_copy)
+		#define va_copy(dest, src) __builtin_va_copy((dest), (src))
+	#else
+		#define va_copy(dest, src) ((dest) = (src))
+	#endif
+#endif
+
+/* -- Definitions -- */
+
+#define LOG_POLICY_STORAGE_MMAP_MIN_SIZE  ((size_t)0x00010000) /**< Minimum segment size */
+#define LOG_POLICY_STORAGE_MMAP_PATH_SIZE ((size_t)0x00000200) /**< Maximum segment path length */
+
+/* -- Forward Declarations -- */
+
+struct log_policy_storage_mmap_data_type;
+
+/* -- Type Definitions -- */
+
+typedef struct log_policy_storage_mmap_data_type *log_policy_storage_mmap_data;
+
+/* -- Member Data -- */
+
+struct log_policy_storage_mmap_data_type
+{
+	char path[LOG_POLICY_STORAGE_MMAP_PATH_SIZE];
+	size_t size;
+	size_t index;
+	size_t offset;
+	void *map;
+
+#if defined(_WIN32)
+	HANDLE file;
+	HANDLE mapping;
+#else
+	int file;
+#endif
+};
+
+/* -- Private Methods -- */
+
+static int log_policy_storage_mmap_create(log_policy policy, const log_policy_ctor ctor);
+
+static int log_policy_storage_mmap_open(log_policy_storage_mmap_data mmap_data);
+
+static void log_policy_storage_mmap_close(log_policy_storage_mmap_data mmap_data);
+
+static int log_policy_storage_mmap_append(log_policy policy, const log_record record);
+
+static int log_policy_storage_mmap_flush(log_policy policy);
+
+static int log_policy_storage_mmap_destroy(log_policy policy);
+
+/* -- Methods -- */
+
+log_policy_interface log_policy_storage_mmap_interface()
+{
+	static struct log_policy_storage_impl_type log_policy_storage_mmap_impl_obj = {
+		&log_policy_storage_mmap_append,
+		&log_policy_storage_mmap_flush
+	};
+
+	static struct log_policy_interface_type policy_interface_storage = {
+		&log_policy_storage_mmap_create,
+		&log_policy_storage_mmap_impl_obj,
+		&log_policy_storage_mmap_destroy
+	};
+
+	return &policy_interface_storage;
+}
+
+static int log_policy_storage_mmap_open(log_policy_storage_mmap_data mmap_data)
+{
+	char segment_path[LOG_POLICY_STORAGE_MMAP_PATH_SIZE];
+
+	struct log_policy_storage_mmap_file_header_type *header;
+
+	if (snprintf(segment_path, LOG_POLICY_STORAGE_MMAP_PATH_SIZE, "%s.%" PRIuS, mmap_data->path, mmap_data->index) < 0)
+	{
+		return 1;
+	}
+
+#if defined(_WIN32)
+	mmap_data->file = CreateFileA(segment_path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if (mmap_data->file == INVALID_HANDLE_VALUE)
+	{
+		return 1;
+	}
+
+	mmap_data->mapping = CreateFileMappingA(mmap_data->file, NULL, PAGE_READWRITE, (DWORD)((uint64_t)mmap_data->size >> 32), (DWORD)(mmap_data->size & 0xFFFFFFFF), NULL);
+
+	if (mmap_data->mapping == NULL)
+	{
+		CloseHandle(mmap_data->file);
+
+		return 1;
+	}
+
+	mmap_data->map = MapViewOfFile(mmap_data->mapping, FILE_MAP_ALL_ACCESS, 0, 0, mmap_data->size);
+
+	if (mmap_data->map == NULL)
+	{
+		CloseHandle(mmap_data->mapping);
+		CloseHandle(mmap_data->file);
+
+		return 1;
+	}
+#else
+	mmap_data->file = open(segment_path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+	if (mmap_data->file == -1)
+	{
+		return 1;
+	}
+
+	if (ftruncate(mmap_data->file, (off_t)mmap_data->size) == -1)
+	{
+		close(mmap_data->file);
+
+		return 1;
+	}
+
+	mmap_data->map = mmap(NULL, mmap_data->size, PROT_READ | PROT_WRITE, MAP_SHARED, mmap_data->file, 0);
+
+	if (mmap_data->map == MAP_FAILED)
+	{
+		close(mmap_data->file);
+
+		return 1;
+	}
+#endif
+
+	header = mmap_data->map;
+
+	header->magic = LOG_POLICY_STORAGE_MMAP_MAGIC;
+	header->version = LOG_POLICY_STORAGE_MMAP_VERSION;
+	header->offset = (uint64_t)sizeof(struct log_policy_storage_mmap_file_header_type);
+
+	mmap_data->offset = sizeof(struct log_policy_storage_mmap_file_header_type);
+
+	return 0;
+}
+
+static void log_policy_storage_mmap_close(log_policy_storage_mmap_data mmap_data)
+{
+	if (mmap_data->map != NULL)
+	{
+		struct log_policy_storage_mmap_file_header_type *header = mmap_data->map;
+
+		header->offset = (uint64_t)mmap_data->offset;
+
+#if defined(_WIN32)
+		FlushViewOfFile(mmap_data->map, mmap_data->offset);
+		UnmapViewOfFile(mmap_data->map);
+		CloseHandle(mmap_data->mapping);
+		CloseHandle(mmap_data->file);
+#else
+		msync(mmap_data->map, mmap_data->offset, MS_SYNC);
+		munmap(mmap_data->map, mmap_data->size);
+		close(mmap_data->file);
+#endif
+
+		mmap_data->map = NULL;
+	}
+}
+
+static int log_policy_storage_mmap_create(log_policy policy, const log_policy_ctor ctor)
+{
+	log_policy_storage_mmap_data mmap_data;
+
+	const log_policy_storage_mmap_ctor mmap_ctor = ctor;
+
+	if (mmap_ctor == NULL || mmap_ctor->path == NULL)
+	{
+		return 1;
+	}
+
+	mmap_data = malloc(sizeof(struct log_policy_storage_mmap_data_type));
+
+	if (mmap_data == NULL)
+	{
+		return 1;
+	}
+
+	strncpy(mmap_data->path, mmap_ctor->path, LOG_POLICY_STORAGE_MMAP_PATH_SIZE - 1);
+
+	mmap_data->path[LOG_POLICY_STORAGE_MMAP_PATH_SIZE - 1] = '\0';
+
+	mmap_data->size = (mmap_ctor->size < LOG_POLICY_STORAGE_MMAP_MIN_SIZE) ? LOG_POLICY_STORAGE_MMAP_MIN_SIZE : mmap_ctor->size;
+
+	mmap_data->index = 0;
+
+	mmap_data->map = NULL;
+
+	if (log_policy_storage_mmap_open(mmap_data) != 0)
+	{
+		free(mmap_data);
+
+		return 1;
+	}
+
+	log_policy_instantiate(policy, mmap_data, LOG_POLICY_STORAGE_MMAP);
+
+	return 0;
+}
+
+static int log_policy_storage_mmap_append(log_policy policy, const log_record record)
+{
+	log_policy_storage_mmap_data mmap_data = log_policy_instance(policy);
+
+	struct log_policy_storage_mmap_record_header_type *header;
+
+	struct log_record_va_list_type *variable_args;
+
+	const char *func = log_record_func(record);
+	const char *file = log_record_file(record);
+	const char *message = log_record_message(record);
+
+	size_t func_size = strlen(func) + 1;
+	size_t file_size = strlen(file) + 1;
+	size_t message_size;
+
+	size_t record_size;
+
+	char *cursor;
+
+	int message_length = 0;
+
+	variable_args = log_record_variable_args(record);
+
+	/* The message is the only part rendered at write time, the
+	variable arguments cannot outlive the producer call frame */
+	if (variable_args != NULL)
+	{
+		va_list args_copy;
+
+		va_copy(args_copy, variable_args->data);
+
+		message_length = vsnprintf(NULL, 0, message, args_copy);
+
+		va_end(args_copy);
+
+		if (message_length < 0)
+		{
+			return 1;
+		}
+
+		message_size = (size_t)message_length + 1;
+	}
+	else
+	{
+		message_size = strlen(message) + 1;
+	}
+
+	record_size = sizeof(struct log_policy_storage_mmap_record_header_type) + func_size + file_size + message_size;
+
+	if (mmap_data->offset + record_size > mmap_data->size)
+	{
+		/* Rotate into the next segment */
+		log_policy_storage_mmap_close(mmap_data);
+
+		++mmap_data->index;
+
+		if (log_policy_storage_mmap_open(mmap_data) != 0)
+		{
+			return 1;
+		}
+
+		/* A record bigger than a whole segment cannot be stored */
+		if (mmap_data->offset + record_size > mmap_data->size)
+		{
+			return 1;
+		}
+	}
+
+	/* Bump pointer append, the header and strings land directly in
+	the mapped segment */
+	cursor = (char *)mmap_data->map + mmap_data->offset;
+
+	header = (struct log_policy_storage_mmap_record_header_type *)cursor;
+
+	header->time = (uint64_t)(*log_record_time(record));
+	header->thread_id = (uint64_t)log_record_thread_id(record);
+	header->line = (uint64_t)log_record_line(record);
+	header->level = (uint32_t)log_record_level(record);
+	header->func_size = (uint32_t)func_size;
+	header->file_size = (uint32_t)file_size;
+	header->message_size = (uint32_t)message_size;
+
+	cursor += sizeof(struct log_policy_storage_mmap_record_header_type);
+
+	memcpy(cursor, func, func_size);
+
+	cursor += func_size;
+
+	memcpy(cursor, file, file_size);
+
+	cursor += file_size;
+
+	if (variable_args != NULL)
+	{
+		va_list args_copy;
+
+		va_copy(args_copy, variable_args->data);
+
+		vsnprintf(cursor, message_size, message, args_copy);
+
+		va_end(args_copy);
+	}
+	else
+	{
+		memcpy(cursor, message, message_size);
+	}
+
+	mmap_data->offset += record_size;
+
+	return 0;
+}
+
+static int log_policy_storage_mmap_flush(log_policy policy)
+{
+	log_policy_storage_mmap_data mmap_data = log_policy_instance(policy);
+
+	struct log_policy_storage_mmap_file_header_type *header;
+
+	if (mmap_data->map == NULL)
+	{
+		return 1;
+	}
+
+	header = mmap_data->map;
+
+	header->offset = (uint64_t)mmap_data->offset;
+
+#if defined(_WIN32)
+	if (FlushViewOfFile(mmap_data->map, mmap_data->offset) == 0)
+	{
+		return 1;
+	}
+#else
+	if (msync(mmap_data->map, mmap_data->offset, MS_ASYNC) == -1)
+	{
+		return 1;
+	}
+#endif
+
+	return 0;
+}
+
+static int log_policy_storage_mmap_destroy(log_policy policy)
+{
+	log_policy_storage_mmap_data mmap_data = log_policy_instance(policy);
+
+	if (mmap_data != NULL)
+	{
+		log_policy_storage_mmap_close(mmap_data);
+
+		free(mmap_data);
+	}
+
+	return 0;
+}
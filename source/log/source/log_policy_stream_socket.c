@@ -11,26 +11,98 @@
 #include <log/log_policy_stream.h>
 #include <log/log_policy_stream_socket.h>
 
+#include <format/format_specifier.h>
+
+#include <threading/threading_mutex.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <winsock2.h>
+	#include <ws2tcpip.h>
+#else
+	#include <arpa/inet.h>
+	#include <errno.h>
+	#include <fcntl.h>
+	#include <netinet/in.h>
+	#include <sys/socket.h>
+	#include <sys/uio.h>
+	#include <unistd.h>
+#endif
+
+/* -- Definitions -- */
+
+/* The queue is bounded in records and in bytes, whichever trips first.
+A slow or browned out collector therefore costs the producer at most one
+enqueue (a copy under a mutex), never a blocking socket write */
+#define LOG_POLICY_STREAM_SOCKET_QUEUE_COUNT 0x400
+#define LOG_POLICY_STREAM_SOCKET_QUEUE_BYTES 0x100000
+
+/* Records handed to writev per flush batch, kept under any IOV_MAX */
+#define LOG_POLICY_STREAM_SOCKET_BATCH_SIZE 0x40
+
 /* -- Forward Declarations -- */
 
+struct log_policy_stream_socket_record_type;
+
 struct log_policy_stream_socket_data_type;
 
 /* -- Type Definitions -- */
 
+#if defined(_WIN32)
+typedef SOCKET log_policy_stream_socket_handle;
+#else
+typedef int log_policy_stream_socket_handle;
+#endif
+
 typedef struct log_policy_stream_socket_data_type *log_policy_stream_socket_data;
 
 /* -- Member Data -- */
 
+struct log_policy_stream_socket_record_type
+{
+	char *data;
+	size_t size;
+};
+
 struct log_policy_stream_socket_data_type
 {
-	/* TODO */
-	void *socket;
+	log_policy_stream_socket_handle socket;
+	threading_mutex mutex;
+
+	/* Ring of pending records, head is the oldest entry */
+	struct log_policy_stream_socket_record_type queue[LOG_POLICY_STREAM_SOCKET_QUEUE_COUNT];
+	size_t head;
+	size_t count;
+	size_t bytes;
+
+	/* Bytes of queue[head] already written by a partial flush */
+	size_t head_offset;
+
+	/* Records dropped since the last notice made it out, the overflow
+	policy is drop newest and report a sampled count instead of stalling */
+	size_t dropped;
 };
 
 /* -- Private Methods -- */
 
 static int log_policy_stream_socket_create(log_policy policy, const log_policy_ctor ctor);
 
+static int log_policy_stream_socket_nonblocking(log_policy_stream_socket_handle handle);
+
+static int log_policy_stream_socket_enqueue(log_policy_stream_socket_data socket_data, const void *buffer, const size_t size);
+
+static void log_policy_stream_socket_pop(log_policy_stream_socket_data socket_data, size_t written);
+
 static int log_policy_stream_socket_write(log_policy policy, const void *buffer, const size_t size);
 
 static int log_policy_stream_socket_flush(log_policy policy);
@@ -55,35 +127,201 @@ log_policy_interface log_policy_stream_socket_interface()
 	return &policy_interface_stream;
 }
 
+static int log_policy_stream_socket_nonblocking(log_policy_stream_socket_handle handle)
+{
+#if defined(_WIN32)
+	u_long mode = 1;
+
+	return ioctlsocket(handle, FIONBIO, &mode) != 0;
+#else
+	int flags = fcntl(handle, F_GETFL, 0);
+
+	if (flags == -1)
+	{
+		return 1;
+	}
+
+	return fcntl(handle, F_SETFL, flags | O_NONBLOCK) == -1;
+#endif
+}
+
 static int log_policy_stream_socket_create(log_policy policy, const log_policy_ctor ctor)
 {
 	log_policy_stream_socket_data socket_data = malloc(sizeof(struct log_policy_stream_socket_data_type));
 
 	const log_policy_stream_socket_ctor socket_ctor = ctor;
 
+	/* The union sidesteps the sockaddr aliasing cast */
+	union
+	{
+		struct sockaddr addr;
+		struct sockaddr_in in;
+	} address;
+
 	if (socket_data == NULL)
 	{
 		return 1;
 	}
 
-/* TODO: open socket */
-#define socket_open(ip, port) /* NULL */ (void *)socket_ctor
+	memset(socket_data, 0, sizeof(struct log_policy_stream_socket_data_type));
+
+	socket_data->mutex = threading_mutex_create();
+
+	if (socket_data->mutex == NULL)
+	{
+		free(socket_data);
+
+		return 1;
+	}
+
+	socket_data->socket = socket(AF_INET, SOCK_STREAM, 0);
+
+#if defined(_WIN32)
+	if (socket_data->socket == INVALID_SOCKET)
+#else
+	if (socket_data->socket < 0)
+#endif
+	{
+		threading_mutex_destroy(socket_data->mutex);
+
+		free(socket_data);
+
+		return 1;
+	}
+
+	memset(&address, 0, sizeof(address));
+
+	address.in.sin_family = AF_INET;
+	address.in.sin_port = htons(socket_ctor->port);
 
-	socket_data->socket = socket_open(socket_ctor->ip, socket_ctor->port);
+	if (inet_pton(AF_INET, socket_ctor->ip, &address.in.sin_addr) != 1 ||
+		log_policy_stream_socket_nonblocking(socket_data->socket) != 0)
+	{
+#if defined(_WIN32)
+		closesocket(socket_data->socket);
+#else
+		close(socket_data->socket);
+#endif
+
+		threading_mutex_destroy(socket_data->mutex);
+
+		free(socket_data);
+
+		return 1;
+	}
+
+	/* The connect races the first flushes on purpose, writes against a
+	half open socket simply stay queued until the handshake completes */
+	if (connect(socket_data->socket, &address.addr, sizeof(address.in)) != 0)
+	{
+#if defined(_WIN32)
+		if (WSAGetLastError() != WSAEWOULDBLOCK)
+#else
+		if (errno != EINPROGRESS)
+#endif
+		{
+#if defined(_WIN32)
+			closesocket(socket_data->socket);
+#else
+			close(socket_data->socket);
+#endif
+
+			threading_mutex_destroy(socket_data->mutex);
+
+			free(socket_data);
+
+			return 1;
+		}
+	}
 
 	log_policy_instantiate(policy, socket_data, LOG_POLICY_STREAM_SOCKET);
 
 	return 0;
 }
 
+static int log_policy_stream_socket_enqueue(log_policy_stream_socket_data socket_data, const void *buffer, const size_t size)
+{
+	struct log_policy_stream_socket_record_type *record;
+
+	if (socket_data->count >= LOG_POLICY_STREAM_SOCKET_QUEUE_COUNT ||
+		socket_data->bytes + size > LOG_POLICY_STREAM_SOCKET_QUEUE_BYTES)
+	{
+		++socket_data->dropped;
+
+		return 1;
+	}
+
+	record = &socket_data->queue[(socket_data->head + socket_data->count) % LOG_POLICY_STREAM_SOCKET_QUEUE_COUNT];
+
+	record->data = malloc(size);
+
+	if (record->data == NULL)
+	{
+		++socket_data->dropped;
+
+		return 1;
+	}
+
+	memcpy(record->data, buffer, size);
+
+	record->size = size;
+
+	++socket_data->count;
+
+	socket_data->bytes += size;
+
+	return 0;
+}
+
+static void log_policy_stream_socket_pop(log_policy_stream_socket_data socket_data, size_t written)
+{
+	while (written > 0 && socket_data->count > 0)
+	{
+		struct log_policy_stream_socket_record_type *record = &socket_data->queue[socket_data->head];
+
+		size_t remaining = record->size - socket_data->head_offset;
+
+		if (written < remaining)
+		{
+			/* Partial write inside the head record, resume there next flush */
+			socket_data->head_offset += written;
+
+			return;
+		}
+
+		written -= remaining;
+
+		socket_data->bytes -= record->size;
+
+		free(record->data);
+
+		record->data = NULL;
+
+		socket_data->head = (socket_data->head + 1) % LOG_POLICY_STREAM_SOCKET_QUEUE_COUNT;
+
+		--socket_data->count;
+
+		socket_data->head_offset = 0;
+	}
+}
+
 static int log_policy_stream_socket_write(log_policy policy, const void *buffer, const size_t size)
 {
 	log_policy_stream_socket_data socket_data = log_policy_instance(policy);
 
-	/* TODO: write to socket */
-	(void)socket_data;
-	(void)buffer;
-	(void)size;
+	size_t length = size > 0 ? size - 1 : 0;
+
+	if (length == 0)
+	{
+		return 0;
+	}
+
+	threading_mutex_lock(socket_data->mutex);
+
+	/* Do not write null character, drop on overflow instead of blocking */
+	log_policy_stream_socket_enqueue(socket_data, buffer, length);
+
+	threading_mutex_unlock(socket_data->mutex);
 
 	return 0;
 }
@@ -92,8 +330,76 @@ static int log_policy_stream_socket_flush(log_policy policy)
 {
 	log_policy_stream_socket_data socket_data = log_policy_instance(policy);
 
-	/* TODO: flush socket */
-	(void)socket_data;
+	threading_mutex_lock(socket_data->mutex);
+
+	/* A sampled notice stands in for the records lost to backpressure,
+	enqueued so it drains ahead of newer records */
+	if (socket_data->dropped > 0 && socket_data->count < LOG_POLICY_STREAM_SOCKET_QUEUE_COUNT)
+	{
+		char notice[0x80];
+
+		int length = snprintf(notice, sizeof(notice), "[log] dropped %" PRIuS " record(s) on socket backpressure\n", socket_data->dropped);
+
+		if (length > 0 && log_policy_stream_socket_enqueue(socket_data, notice, (size_t)length) == 0)
+		{
+			socket_data->dropped = 0;
+		}
+	}
+
+	while (socket_data->count > 0)
+	{
+#if defined(_WIN32)
+		/* Winsock has no writev, the head record is sent on its own */
+		struct log_policy_stream_socket_record_type *record = &socket_data->queue[socket_data->head];
+
+		int result = send(socket_data->socket, record->data + socket_data->head_offset, (int)(record->size - socket_data->head_offset), 0);
+
+		if (result <= 0)
+		{
+			break;
+		}
+
+		log_policy_stream_socket_pop(socket_data, (size_t)result);
+#else
+		struct iovec batch[LOG_POLICY_STREAM_SOCKET_BATCH_SIZE];
+
+		struct msghdr message;
+
+		size_t iterator, batch_size = socket_data->count < LOG_POLICY_STREAM_SOCKET_BATCH_SIZE ? socket_data->count : LOG_POLICY_STREAM_SOCKET_BATCH_SIZE;
+
+		ssize_t result;
+
+		for (iterator = 0; iterator < batch_size; ++iterator)
+		{
+			struct log_policy_stream_socket_record_type *record = &socket_data->queue[(socket_data->head + iterator) % LOG_POLICY_STREAM_SOCKET_QUEUE_COUNT];
+
+			size_t offset = iterator == 0 ? socket_data->head_offset : 0;
+
+			batch[iterator].iov_base = record->data + offset;
+			batch[iterator].iov_len = record->size - offset;
+		}
+
+		memset(&message, 0, sizeof(message));
+
+		message.msg_iov = batch;
+		message.msg_iovlen = batch_size;
+
+		/* The vectored write goes through sendmsg so a collector that
+		dropped the connection raises an error instead of SIGPIPE */
+		result = sendmsg(socket_data->socket, &message, MSG_NOSIGNAL);
+
+		if (result <= 0)
+		{
+			/* EAGAIN and friends leave the remainder queued for the next
+			flush, the producer side never waits on the collector */
+			break;
+		}
+
+		log_policy_stream_socket_pop(socket_data, (size_t)result);
+#endif
+	}
+
+	threading_mutex_unlock(socket_data->mutex);
 
 	return 0;
 }
@@ -104,7 +410,22 @@ static int log_policy_stream_socket_destroy(log_policy policy)
 
 	if (socket_data != NULL)
 	{
-		/* TODO: close socket */
+		size_t iterator;
+
+		log_policy_stream_socket_flush(policy);
+
+		for (iterator = 0; iterator < socket_data->count; ++iterator)
+		{
+			free(socket_data->queue[(socket_data->head + iterator) % LOG_POLICY_STREAM_SOCKET_QUEUE_COUNT].data);
+		}
+
+#if defined(_WIN32)
+		closesocket(socket_data->socket);
+#else
+		close(socket_data->socket);
+#endif
+
+		threading_mutex_destroy(socket_data->mutex);
 
 		free(socket_data);
 	}
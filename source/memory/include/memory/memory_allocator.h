@@ -55,6 +55,8 @@ MEMORY_API void memory_allocator_deallocate(memory_allocator allocator, void *da
 
 MEMORY_API size_t memory_allocator_used(memory_allocator allocator);
 
+MEMORY_API memory_allocator_impl memory_allocator_implementation(memory_allocator allocator);
+
 MEMORY_API void memory_allocator_destroy(memory_allocator allocator);
 
 #ifdef __cplusplus
@@ -0,0 +1,57 @@
+/*
+ *	Memory Library by Parra Studios
+ *	A generic cross-platform memory utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef MEMORY_ALLOCATOR_ARENA_H
+#define MEMORY_ALLOCATOR_ARENA_H 1
+
+/* -- Headers -- */
+
+#include <memory/memory_api.h>
+
+#include <memory/memory_allocator.h>
+#include <memory/memory_allocator_arena_impl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Methods -- */
+
+MEMORY_API memory_allocator memory_allocator_arena(size_t block_size);
+
+/**
+*  @brief
+*    Create an arena backed by a virtual reservation of @reserve_size
+*    bytes committed on demand, so the pool grows contiguously without
+*    spreading value sized allocations across the heap; @huge_pages
+*    different from zero backs the reservation with huge pages where
+*    the platform allows it, falling back to transparent huge page
+*    advice and then to regular pages. Allocations past the
+*    reservation spill into regular heap blocks
+*/
+MEMORY_API memory_allocator memory_allocator_arena_reserve(size_t block_size, size_t reserve_size, int huge_pages);
+
+MEMORY_API void memory_allocator_arena_reset(memory_allocator allocator);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEMORY_ALLOCATOR_ARENA_H */
@@ -0,0 +1,89 @@
+/*
+ *	Memory Library by Parra Studios
+ *	A generic cross-platform memory utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef MEMORY_ALLOCATOR_SHARED_H
+#define MEMORY_ALLOCATOR_SHARED_H 1
+
+/* -- Headers -- */
+
+#include <memory/memory_api.h>
+
+#include <memory/memory_allocator.h>
+#include <memory/memory_allocator_shared_impl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Create an allocator backed by an anonymous shared memory region of
+*    @size bytes. Processes forked afterwards inherit the region mapped
+*    at the same address, so a worker can allocate values into it and
+*    the parent reads them back without serialization. Allocation is a
+*    lock free bump, individual deallocations are a no-op and the whole
+*    region is released on destroy
+*
+*  @param[in] size
+*    Size in bytes of the region
+*
+*  @return
+*    Pointer to allocator on success, null otherwise
+*/
+MEMORY_API memory_allocator memory_allocator_shared(size_t size);
+
+/**
+*  @brief
+*    Offset of @data from the region base, stable across processes that
+*    map the region at different addresses
+*
+*  @param[in] allocator
+*    Pointer to the shared allocator
+*
+*  @param[in] data
+*    Pointer previously returned by an allocation on @allocator
+*
+*  @return
+*    Offset in bytes from the region base
+*/
+MEMORY_API size_t memory_allocator_shared_offset(memory_allocator allocator, void *data);
+
+/**
+*  @brief
+*    Resolve the offset @offset back into a pointer inside the region
+*
+*  @param[in] allocator
+*    Pointer to the shared allocator
+*
+*  @param[in] offset
+*    Offset in bytes from the region base
+*
+*  @return
+*    Pointer into the region, null if @offset is out of bounds
+*/
+MEMORY_API void *memory_allocator_shared_pointer(memory_allocator allocator, size_t offset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEMORY_ALLOCATOR_SHARED_H */
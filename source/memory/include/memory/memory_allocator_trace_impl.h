@@ -0,0 +1,78 @@
+/*
+ *	Memory Library by Parra Studios
+ *	A generic cross-platform memory utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef MEMORY_ALLOCATOR_TRACE_IMPL_H
+#define MEMORY_ALLOCATOR_TRACE_IMPL_H 1
+
+/* -- Headers -- */
+
+#include <memory/memory_api.h>
+
+#include <memory/memory_allocator_iface.h>
+#include <memory/memory_allocator_std_impl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Forward Declarations -- */
+
+struct memory_allocator_trace_ctx_type;
+
+struct memory_allocator_trace_stats_type;
+
+/* -- Type Definitions -- */
+
+typedef struct memory_allocator_trace_ctx_type *memory_allocator_trace_ctx;
+
+typedef struct memory_allocator_trace_stats_type *memory_allocator_trace_stats;
+
+/* -- Member Data -- */
+
+struct memory_allocator_trace_ctx_type
+{
+	memory_allocator_std_impl_malloc malloc;
+	memory_allocator_std_impl_realloc realloc;
+	memory_allocator_std_impl_free free;
+};
+
+struct memory_allocator_trace_stats_type
+{
+	size_t allocations;		/**< Number of successful allocations */
+	size_t reallocations;	/**< Number of successful reallocations */
+	size_t deallocations;	/**< Number of deallocations */
+	size_t bytes_allocated; /**< Cumulative bytes requested over the allocator lifetime */
+	size_t bytes_in_use;	/**< Bytes currently held by live blocks */
+	size_t bytes_peak;		/**< High water mark of bytes in use */
+};
+
+/* -- Methods -- */
+
+MEMORY_API memory_allocator_iface memory_allocator_trace_iface(void);
+
+MEMORY_API void memory_allocator_trace_impl_stats(memory_allocator_impl impl, memory_allocator_trace_stats stats);
+
+MEMORY_API void memory_allocator_trace_impl_reset(memory_allocator_impl impl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEMORY_ALLOCATOR_TRACE_IMPL_H */
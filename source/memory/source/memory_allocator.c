@@ -120,6 +120,11 @@ size_t memory_allocator_used(memory_allocator allocator)
 	return 0;
 }
 
+memory_allocator_impl memory_allocator_implementation(memory_allocator allocator)
+{
+	return allocator->impl;
+}
+
 void memory_allocator_destroy(memory_allocator allocator)
 {
 	memory_allocator_impl impl = allocator->impl;
@@ -0,0 +1,52 @@
+/*
+ *	Memory Library by Parra Studios
+ *	A generic cross-platform memory utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <memory/memory_allocator_arena.h>
+
+/* -- Methods -- */
+
+memory_allocator memory_allocator_arena(size_t block_size)
+{
+	struct memory_allocator_arena_ctx_type arena_ctx;
+
+	arena_ctx.block_size = block_size;
+	arena_ctx.reserve_size = 0;
+	arena_ctx.huge_pages = 0;
+
+	return memory_allocator_create(memory_allocator_arena_iface(), &arena_ctx);
+}
+
+memory_allocator memory_allocator_arena_reserve(size_t block_size, size_t reserve_size, int huge_pages)
+{
+	struct memory_allocator_arena_ctx_type arena_ctx;
+
+	arena_ctx.block_size = block_size;
+	arena_ctx.reserve_size = reserve_size;
+	arena_ctx.huge_pages = huge_pages;
+
+	return memory_allocator_create(memory_allocator_arena_iface(), &arena_ctx);
+}
+
+void memory_allocator_arena_reset(memory_allocator allocator)
+{
+	memory_allocator_arena_impl_reset(memory_allocator_implementation(allocator));
+}
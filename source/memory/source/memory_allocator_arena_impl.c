@@ -0,0 +1,476 @@
+/*
+ *	Memory Library by Parra Studios
+ *	A generic cross-platform memory utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <memory/memory_allocator_arena_impl.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+#elif defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)
+	#define MEMORY_ALLOCATOR_ARENA_MMAP 1
+
+	#include <sys/mman.h>
+	#include <unistd.h>
+#endif
+
+/* -- Definitions -- */
+
+#define MEMORY_ALLOCATOR_ARENA_ALIGNMENT ((size_t)0x10)
+
+#define MEMORY_ALLOCATOR_ARENA_BLOCK_SIZE_DEFAULT ((size_t)0x1000)
+
+#define MEMORY_ALLOCATOR_ARENA_HUGE_PAGE_SIZE ((size_t)0x200000)
+
+#define MEMORY_ALLOCATOR_ARENA_COMMIT_DEFAULT ((size_t)0x10000)
+
+/* -- Forward Declarations -- */
+
+struct memory_allocator_arena_block_type;
+
+struct memory_allocator_arena_impl_type;
+
+/* -- Type Definitions -- */
+
+typedef struct memory_allocator_arena_block_type *memory_allocator_arena_block;
+
+typedef struct memory_allocator_arena_impl_type *memory_allocator_arena_impl;
+
+/* -- Member Data -- */
+
+struct memory_allocator_arena_block_type
+{
+	memory_allocator_arena_block next;
+	size_t capacity;
+	size_t used;
+	/* The block data follows the header, aligned to MEMORY_ALLOCATOR_ARENA_ALIGNMENT */
+};
+
+struct memory_allocator_arena_impl_type
+{
+	size_t block_size;
+	size_t mark; /* Offset of the first block to rewind to on reset, it protects the allocator header */
+	int mark_set;
+	int mark_in_reserve; /* Whether the mark offset belongs to the reservation or the initial block */
+	memory_allocator_arena_block blocks;
+	unsigned char *reserve_base; /* Reserved virtual range, null when the arena grows through heap blocks only */
+	size_t reserve_capacity;	 /* Size of the reservation */
+	size_t reserve_committed;	 /* Bytes of the reservation backed by committed pages */
+	size_t reserve_used;		 /* Bump offset inside the reservation */
+	size_t commit_granularity;	 /* Commit step, the huge page size when huge pages are requested */
+};
+
+/* -- Private Methods -- */
+
+static memory_allocator_impl memory_allocator_arena_create(void *ctx);
+
+static void *memory_allocator_arena_allocate(memory_allocator_impl impl, size_t size);
+
+static void *memory_allocator_arena_reallocate(memory_allocator_impl impl, void *data, size_t size, size_t new_size);
+
+static void memory_allocator_arena_deallocate(memory_allocator_impl impl, void *data);
+
+static void memory_allocator_arena_destroy(memory_allocator_impl impl);
+
+static memory_allocator_arena_block memory_allocator_arena_block_create(size_t capacity);
+
+static void *memory_allocator_arena_block_data(memory_allocator_arena_block block);
+
+static int memory_allocator_arena_reserve_map(memory_allocator_arena_impl arena_impl, size_t reserve_size, int huge_pages);
+
+static int memory_allocator_arena_reserve_commit(memory_allocator_arena_impl arena_impl, size_t required);
+
+static void memory_allocator_arena_reserve_unmap(memory_allocator_arena_impl arena_impl);
+
+/* -- Methods -- */
+
+memory_allocator_iface memory_allocator_arena_iface()
+{
+	static struct memory_allocator_iface_type allocator_arena_iface = {
+		&memory_allocator_arena_create,
+		&memory_allocator_arena_allocate,
+		&memory_allocator_arena_reallocate,
+		&memory_allocator_arena_deallocate,
+		&memory_allocator_arena_destroy
+	};
+
+	return &allocator_arena_iface;
+}
+
+memory_allocator_arena_block memory_allocator_arena_block_create(size_t capacity)
+{
+	memory_allocator_arena_block block = malloc(sizeof(struct memory_allocator_arena_block_type) + capacity);
+
+	if (block == NULL)
+	{
+		return NULL;
+	}
+
+	block->next = NULL;
+	block->capacity = capacity;
+	block->used = 0;
+
+	return block;
+}
+
+void *memory_allocator_arena_block_data(memory_allocator_arena_block block)
+{
+	return (void *)(((unsigned char *)block) + sizeof(struct memory_allocator_arena_block_type));
+}
+
+/* Reserve @reserve_size bytes of virtual address space without backing
+pages, committing happens on demand as the bump offset advances; with
+@huge_pages the reservation tries explicit huge pages first and falls
+back to transparent huge page advice over regular pages */
+int memory_allocator_arena_reserve_map(memory_allocator_arena_impl arena_impl, size_t reserve_size, int huge_pages)
+{
+#if defined(_WIN32)
+	{
+		void *base;
+
+		/* Large pages need a privilege most processes lack, regular
+		pages keep the reservation portable */
+		arena_impl->commit_granularity = MEMORY_ALLOCATOR_ARENA_COMMIT_DEFAULT;
+
+		(void)huge_pages;
+
+		reserve_size = (reserve_size + arena_impl->commit_granularity - 1) & ~(arena_impl->commit_granularity - 1);
+
+		base = VirtualAlloc(NULL, reserve_size, MEM_RESERVE, PAGE_NOACCESS);
+
+		if (base == NULL)
+		{
+			return 1;
+		}
+
+		arena_impl->reserve_base = (unsigned char *)base;
+		arena_impl->reserve_capacity = reserve_size;
+
+		return 0;
+	}
+#elif defined(MEMORY_ALLOCATOR_ARENA_MMAP)
+	{
+		void *base = MAP_FAILED;
+
+		long page_size = sysconf(_SC_PAGESIZE);
+
+		arena_impl->commit_granularity = page_size > 0 ? (size_t)page_size : MEMORY_ALLOCATOR_ARENA_COMMIT_DEFAULT;
+
+		if (huge_pages != 0)
+		{
+			arena_impl->commit_granularity = MEMORY_ALLOCATOR_ARENA_HUGE_PAGE_SIZE;
+		}
+
+		reserve_size = (reserve_size + arena_impl->commit_granularity - 1) & ~(arena_impl->commit_granularity - 1);
+
+	#if defined(MAP_HUGETLB)
+		if (huge_pages != 0)
+		{
+			base = mmap(NULL, reserve_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		}
+	#endif
+
+		if (base == MAP_FAILED)
+		{
+			base = mmap(NULL, reserve_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		}
+
+		if (base == MAP_FAILED)
+		{
+			return 1;
+		}
+
+	#if defined(MADV_HUGEPAGE)
+		if (huge_pages != 0)
+		{
+			/* Best effort, the kernel backs the range with huge pages
+			as they are committed when transparent huge pages are on */
+			madvise(base, reserve_size, MADV_HUGEPAGE);
+		}
+	#endif
+
+		arena_impl->reserve_base = (unsigned char *)base;
+		arena_impl->reserve_capacity = reserve_size;
+
+		return 0;
+	}
+#else
+	{
+		/* No virtual memory control, the arena grows through heap blocks */
+		(void)arena_impl;
+		(void)reserve_size;
+		(void)huge_pages;
+
+		return 1;
+	}
+#endif
+}
+
+int memory_allocator_arena_reserve_commit(memory_allocator_arena_impl arena_impl, size_t required)
+{
+	size_t committed;
+
+	if (required <= arena_impl->reserve_committed)
+	{
+		return 0;
+	}
+
+	committed = (required + arena_impl->commit_granularity - 1) & ~(arena_impl->commit_granularity - 1);
+
+	if (committed > arena_impl->reserve_capacity)
+	{
+		committed = arena_impl->reserve_capacity;
+	}
+
+#if defined(_WIN32)
+	if (VirtualAlloc(arena_impl->reserve_base + arena_impl->reserve_committed, committed - arena_impl->reserve_committed, MEM_COMMIT, PAGE_READWRITE) == NULL)
+	{
+		return 1;
+	}
+#elif defined(MEMORY_ALLOCATOR_ARENA_MMAP)
+	if (mprotect(arena_impl->reserve_base + arena_impl->reserve_committed, committed - arena_impl->reserve_committed, PROT_READ | PROT_WRITE) != 0)
+	{
+		return 1;
+	}
+#endif
+
+	arena_impl->reserve_committed = committed;
+
+	return 0;
+}
+
+void memory_allocator_arena_reserve_unmap(memory_allocator_arena_impl arena_impl)
+{
+	if (arena_impl->reserve_base == NULL)
+	{
+		return;
+	}
+
+#if defined(_WIN32)
+	VirtualFree(arena_impl->reserve_base, 0, MEM_RELEASE);
+#elif defined(MEMORY_ALLOCATOR_ARENA_MMAP)
+	munmap(arena_impl->reserve_base, arena_impl->reserve_capacity);
+#endif
+
+	arena_impl->reserve_base = NULL;
+}
+
+memory_allocator_impl memory_allocator_arena_create(void *ctx)
+{
+	memory_allocator_arena_ctx arena_ctx = (memory_allocator_arena_ctx)ctx;
+
+	memory_allocator_arena_impl arena_impl = malloc(sizeof(struct memory_allocator_arena_impl_type));
+
+	if (arena_impl == NULL)
+	{
+		return NULL;
+	}
+
+	arena_impl->block_size = arena_ctx->block_size > 0 ? arena_ctx->block_size : MEMORY_ALLOCATOR_ARENA_BLOCK_SIZE_DEFAULT;
+	arena_impl->mark = 0;
+	arena_impl->mark_set = 0;
+	arena_impl->mark_in_reserve = 0;
+	arena_impl->reserve_base = NULL;
+	arena_impl->reserve_capacity = 0;
+	arena_impl->reserve_committed = 0;
+	arena_impl->reserve_used = 0;
+	arena_impl->commit_granularity = 0;
+
+	if (arena_ctx->reserve_size > 0)
+	{
+		/* Failure leaves the arena on the heap block path, the
+		reservation is an optimization, not a requirement */
+		memory_allocator_arena_reserve_map(arena_impl, arena_ctx->reserve_size, arena_ctx->huge_pages);
+	}
+
+	arena_impl->blocks = memory_allocator_arena_block_create(arena_impl->block_size);
+
+	if (arena_impl->blocks == NULL)
+	{
+		memory_allocator_arena_reserve_unmap(arena_impl);
+
+		free(arena_impl);
+
+		return NULL;
+	}
+
+	return (memory_allocator_impl)arena_impl;
+}
+
+void *memory_allocator_arena_allocate(memory_allocator_impl impl, size_t size)
+{
+	memory_allocator_arena_impl arena_impl = (memory_allocator_arena_impl)impl;
+
+	memory_allocator_arena_block block = arena_impl->blocks;
+
+	void *data;
+
+	/* Bump pointers stay aligned as long as every request is rounded up */
+	size = (size + MEMORY_ALLOCATOR_ARENA_ALIGNMENT - 1) & ~(MEMORY_ALLOCATOR_ARENA_ALIGNMENT - 1);
+
+	/* The reservation serves allocations first, keeping the pool
+	contiguous; exhaustion or a failed commit spills to heap blocks */
+	if (arena_impl->reserve_base != NULL && arena_impl->reserve_used + size <= arena_impl->reserve_capacity)
+	{
+		if (memory_allocator_arena_reserve_commit(arena_impl, arena_impl->reserve_used + size) == 0)
+		{
+			data = (void *)(arena_impl->reserve_base + arena_impl->reserve_used);
+
+			arena_impl->reserve_used += size;
+
+			if (arena_impl->mark_set == 0)
+			{
+				arena_impl->mark = arena_impl->reserve_used;
+				arena_impl->mark_set = 1;
+				arena_impl->mark_in_reserve = 1;
+			}
+
+			return data;
+		}
+	}
+
+	if (block->used + size > block->capacity)
+	{
+		size_t capacity = size > arena_impl->block_size ? size : arena_impl->block_size;
+
+		block = memory_allocator_arena_block_create(capacity);
+
+		if (block == NULL)
+		{
+			return NULL;
+		}
+
+		block->next = arena_impl->blocks;
+
+		arena_impl->blocks = block;
+	}
+
+	data = (void *)(((unsigned char *)memory_allocator_arena_block_data(block)) + block->used);
+
+	block->used += size;
+
+	/* The first allocation of the arena holds the allocator header,
+	remember its extent so reset does not rewind over it */
+	if (arena_impl->mark_set == 0)
+	{
+		arena_impl->mark = block->used;
+		arena_impl->mark_set = 1;
+	}
+
+	return data;
+}
+
+void *memory_allocator_arena_reallocate(memory_allocator_impl impl, void *data, size_t size, size_t new_size)
+{
+	void *new_data;
+
+	if (new_size <= size)
+	{
+		return data;
+	}
+
+	new_data = memory_allocator_arena_allocate(impl, new_size);
+
+	if (new_data == NULL)
+	{
+		return NULL;
+	}
+
+	if (data != NULL && size > 0)
+	{
+		memcpy(new_data, data, size);
+	}
+
+	return new_data;
+}
+
+void memory_allocator_arena_deallocate(memory_allocator_impl impl, void *data)
+{
+	/* Individual deallocations are a no-op, the memory
+	is given back wholesale by reset or destroy */
+	(void)impl;
+	(void)data;
+}
+
+void memory_allocator_arena_impl_reset(memory_allocator_impl impl)
+{
+	memory_allocator_arena_impl arena_impl = (memory_allocator_arena_impl)impl;
+
+	memory_allocator_arena_block block = arena_impl->blocks;
+
+	/* Free every overflow block, keeping the initial one
+	which holds the allocator header at its base */
+	while (block->next != NULL)
+	{
+		memory_allocator_arena_block next = block->next;
+
+		free(block);
+
+		block = next;
+	}
+
+	/* The committed part of the reservation is kept, rewinding the
+	bump offset is what makes the pool reusable without page faults */
+	if (arena_impl->mark_in_reserve != 0)
+	{
+		arena_impl->reserve_used = arena_impl->mark;
+
+		block->used = 0;
+	}
+	else
+	{
+		arena_impl->reserve_used = 0;
+
+		block->used = arena_impl->mark;
+	}
+
+	arena_impl->blocks = block;
+}
+
+void memory_allocator_arena_destroy(memory_allocator_impl impl)
+{
+	memory_allocator_arena_impl arena_impl = (memory_allocator_arena_impl)impl;
+
+	memory_allocator_arena_block block = arena_impl->blocks;
+
+	while (block != NULL)
+	{
+		memory_allocator_arena_block next = block->next;
+
+		free(block);
+
+		block = next;
+	}
+
+	memory_allocator_arena_reserve_unmap(arena_impl);
+
+	free(arena_impl);
+}
@@ -0,0 +1,44 @@
+/*
+ *	Memory Library by Parra Studios
+ *	A generic cross-platform memory utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <memory/memory_allocator_shared.h>
+
+/* -- Methods -- */
+
+memory_allocator memory_allocator_shared(size_t size)
+{
+	struct memory_allocator_shared_ctx_type shared_ctx;
+
+	shared_ctx.size = size;
+
+	return memory_allocator_create(memory_allocator_shared_iface(), &shared_ctx);
+}
+
+size_t memory_allocator_shared_offset(memory_allocator allocator, void *data)
+{
+	return memory_allocator_shared_impl_offset(memory_allocator_implementation(allocator), data);
+}
+
+void *memory_allocator_shared_pointer(memory_allocator allocator, size_t offset)
+{
+	return memory_allocator_shared_impl_pointer(memory_allocator_implementation(allocator), offset);
+}
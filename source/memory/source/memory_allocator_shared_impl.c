@@ -0,0 +1,259 @@
+/*
+ *	Memory Library by Parra Studios
+ *	A generic cross-platform memory utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <memory/memory_allocator_shared_impl.h>
+
+#include <string.h>
+
+#if defined(WIN32) || defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+#elif defined(unix) || defined(__unix__) || defined(__unix) ||                          \
+	defined(linux) || defined(__linux__) || defined(__linux) || defined(__gnu_linux) || \
+	defined(__CYGWIN__) || defined(__CYGWIN32__) ||                                     \
+	(defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+
+	#include <sys/mman.h>
+#endif
+
+/* -- Definitions -- */
+
+#define MEMORY_ALLOCATOR_SHARED_ALIGNMENT ((size_t)0x10)
+
+#define MEMORY_ALLOCATOR_SHARED_SIZE_DEFAULT ((size_t)0x100000)
+
+/* -- Forward Declarations -- */
+
+struct memory_allocator_shared_impl_type;
+
+/* -- Type Definitions -- */
+
+typedef struct memory_allocator_shared_impl_type *memory_allocator_shared_impl;
+
+/* -- Member Data -- */
+
+/* The header lives at the base of the region itself, so the bump
+offset is visible to every process sharing the mapping */
+struct memory_allocator_shared_impl_type
+{
+	size_t capacity;
+	volatile size_t used;
+
+#if defined(WIN32) || defined(_WIN32)
+	HANDLE mapping;
+#endif
+
+	/* The region data follows the header, aligned to MEMORY_ALLOCATOR_SHARED_ALIGNMENT */
+};
+
+/* -- Private Methods -- */
+
+static memory_allocator_impl memory_allocator_shared_create(void *ctx);
+
+static void *memory_allocator_shared_allocate(memory_allocator_impl impl, size_t size);
+
+static void *memory_allocator_shared_reallocate(memory_allocator_impl impl, void *data, size_t size, size_t new_size);
+
+static void memory_allocator_shared_deallocate(memory_allocator_impl impl, void *data);
+
+static void memory_allocator_shared_destroy(memory_allocator_impl impl);
+
+static int memory_allocator_shared_compare_exchange(volatile size_t *used, size_t expected, size_t desired);
+
+/* -- Methods -- */
+
+memory_allocator_iface memory_allocator_shared_iface()
+{
+	static struct memory_allocator_iface_type allocator_shared_iface = {
+		&memory_allocator_shared_create,
+		&memory_allocator_shared_allocate,
+		&memory_allocator_shared_reallocate,
+		&memory_allocator_shared_deallocate,
+		&memory_allocator_shared_destroy
+	};
+
+	return &allocator_shared_iface;
+}
+
+int memory_allocator_shared_compare_exchange(volatile size_t *used, size_t expected, size_t desired)
+{
+#if defined(_MSC_VER)
+	#if defined(_WIN64)
+	return InterlockedCompareExchange64((volatile LONG64 *)used, (LONG64)desired, (LONG64)expected) == (LONG64)expected;
+	#else
+	return InterlockedCompareExchange((volatile LONG *)used, (LONG)desired, (LONG)expected) == (LONG)expected;
+	#endif
+#else
+	return __sync_bool_compare_and_swap(used, expected, desired);
+#endif
+}
+
+memory_allocator_impl memory_allocator_shared_create(void *ctx)
+{
+	memory_allocator_shared_ctx shared_ctx = (memory_allocator_shared_ctx)ctx;
+
+	size_t capacity = shared_ctx->size > 0 ? shared_ctx->size : MEMORY_ALLOCATOR_SHARED_SIZE_DEFAULT;
+
+	memory_allocator_shared_impl shared_impl;
+
+#if defined(WIN32) || defined(_WIN32)
+	HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+		(DWORD)((unsigned long long)capacity >> 32), (DWORD)(capacity & 0xFFFFFFFFUL), NULL);
+
+	if (mapping == NULL)
+	{
+		return NULL;
+	}
+
+	shared_impl = (memory_allocator_shared_impl)MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+
+	if (shared_impl == NULL)
+	{
+		CloseHandle(mapping);
+
+		return NULL;
+	}
+
+	shared_impl->mapping = mapping;
+#elif defined(unix) || defined(__unix__) || defined(__unix) ||                          \
+	defined(linux) || defined(__linux__) || defined(__linux) || defined(__gnu_linux) || \
+	defined(__CYGWIN__) || defined(__CYGWIN32__) ||                                     \
+	(defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+
+	shared_impl = (memory_allocator_shared_impl)mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+	if (shared_impl == MAP_FAILED)
+	{
+		return NULL;
+	}
+#else
+	return NULL;
+#endif
+
+	shared_impl->capacity = capacity;
+	shared_impl->used = (sizeof(struct memory_allocator_shared_impl_type) + MEMORY_ALLOCATOR_SHARED_ALIGNMENT - 1) & ~(MEMORY_ALLOCATOR_SHARED_ALIGNMENT - 1);
+
+	return (memory_allocator_impl)shared_impl;
+}
+
+void *memory_allocator_shared_allocate(memory_allocator_impl impl, size_t size)
+{
+	memory_allocator_shared_impl shared_impl = (memory_allocator_shared_impl)impl;
+
+	/* Bump offsets stay aligned as long as every request is rounded up */
+	size = (size + MEMORY_ALLOCATOR_SHARED_ALIGNMENT - 1) & ~(MEMORY_ALLOCATOR_SHARED_ALIGNMENT - 1);
+
+	for (;;)
+	{
+		size_t used = shared_impl->used;
+
+		if (used + size > shared_impl->capacity)
+		{
+			return NULL;
+		}
+
+		/* Atomic bump, parent and forked workers may allocate concurrently */
+		if (memory_allocator_shared_compare_exchange(&shared_impl->used, used, used + size) != 0)
+		{
+			return (void *)(((unsigned char *)shared_impl) + used);
+		}
+	}
+}
+
+void *memory_allocator_shared_reallocate(memory_allocator_impl impl, void *data, size_t size, size_t new_size)
+{
+	void *new_data;
+
+	if (new_size <= size)
+	{
+		return data;
+	}
+
+	new_data = memory_allocator_shared_allocate(impl, new_size);
+
+	if (new_data == NULL)
+	{
+		return NULL;
+	}
+
+	if (data != NULL && size > 0)
+	{
+		memcpy(new_data, data, size);
+	}
+
+	return new_data;
+}
+
+void memory_allocator_shared_deallocate(memory_allocator_impl impl, void *data)
+{
+	/* Individual deallocations are a no-op, the region
+	is given back wholesale by destroy */
+	(void)impl;
+	(void)data;
+}
+
+size_t memory_allocator_shared_impl_offset(memory_allocator_impl impl, void *data)
+{
+	memory_allocator_shared_impl shared_impl = (memory_allocator_shared_impl)impl;
+
+	return (size_t)(((unsigned char *)data) - ((unsigned char *)shared_impl));
+}
+
+void *memory_allocator_shared_impl_pointer(memory_allocator_impl impl, size_t offset)
+{
+	memory_allocator_shared_impl shared_impl = (memory_allocator_shared_impl)impl;
+
+	if (offset >= shared_impl->capacity)
+	{
+		return NULL;
+	}
+
+	return (void *)(((unsigned char *)shared_impl) + offset);
+}
+
+void memory_allocator_shared_destroy(memory_allocator_impl impl)
+{
+	memory_allocator_shared_impl shared_impl = (memory_allocator_shared_impl)impl;
+
+#if defined(WIN32) || defined(_WIN32)
+	HANDLE mapping = shared_impl->mapping;
+
+	UnmapViewOfFile(shared_impl);
+
+	CloseHandle(mapping);
+#elif defined(unix) || defined(__unix__) || defined(__unix) ||                          \
+	defined(linux) || defined(__linux__) || defined(__linux) || defined(__gnu_linux) || \
+	defined(__CYGWIN__) || defined(__CYGWIN32__) ||                                     \
+	(defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+
+	munmap(shared_impl, shared_impl->capacity);
+#else
+	(void)shared_impl;
+#endif
+}
@@ -0,0 +1,228 @@
+/*
+ *	Memory Library by Parra Studios
+ *	A generic cross-platform memory utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <memory/memory_allocator_trace_impl.h>
+
+#include <stdlib.h>
+
+/* -- Forward Declarations -- */
+
+struct memory_allocator_trace_impl_type;
+
+union memory_allocator_trace_header_type;
+
+/* -- Type Definitions -- */
+
+typedef struct memory_allocator_trace_impl_type *memory_allocator_trace_impl;
+
+typedef union memory_allocator_trace_header_type *memory_allocator_trace_header;
+
+/* -- Member Data -- */
+
+struct memory_allocator_trace_impl_type
+{
+	memory_allocator_std_impl_malloc malloc;
+	memory_allocator_std_impl_realloc realloc;
+	memory_allocator_std_impl_free free;
+
+	struct memory_allocator_trace_stats_type stats;
+};
+
+/* Each block is prefixed with its size so deallocation and reallocation
+*  can account the bytes released; the union keeps the user data aligned */
+union memory_allocator_trace_header_type
+{
+	size_t size;
+	long double alignment;
+};
+
+/* -- Private Methods -- */
+
+static memory_allocator_impl memory_allocator_trace_create(void *ctx);
+
+static void *memory_allocator_trace_allocate(memory_allocator_impl impl, size_t size);
+
+static void *memory_allocator_trace_reallocate(memory_allocator_impl impl, void *data, size_t size, size_t new_size);
+
+static void memory_allocator_trace_deallocate(memory_allocator_impl impl, void *data);
+
+static void memory_allocator_trace_destroy(memory_allocator_impl impl);
+
+static void memory_allocator_trace_account_allocate(memory_allocator_trace_impl trace_impl, size_t size);
+
+static void memory_allocator_trace_account_deallocate(memory_allocator_trace_impl trace_impl, size_t size);
+
+/* -- Methods -- */
+
+memory_allocator_iface memory_allocator_trace_iface()
+{
+	static struct memory_allocator_iface_type allocator_trace_iface = {
+		&memory_allocator_trace_create,
+		&memory_allocator_trace_allocate,
+		&memory_allocator_trace_reallocate,
+		&memory_allocator_trace_deallocate,
+		&memory_allocator_trace_destroy
+	};
+
+	return &allocator_trace_iface;
+}
+
+void memory_allocator_trace_impl_stats(memory_allocator_impl impl, memory_allocator_trace_stats stats)
+{
+	memory_allocator_trace_impl trace_impl = (memory_allocator_trace_impl)impl;
+
+	*stats = trace_impl->stats;
+}
+
+void memory_allocator_trace_impl_reset(memory_allocator_impl impl)
+{
+	memory_allocator_trace_impl trace_impl = (memory_allocator_trace_impl)impl;
+
+	trace_impl->stats.allocations = 0;
+	trace_impl->stats.reallocations = 0;
+	trace_impl->stats.deallocations = 0;
+	trace_impl->stats.bytes_allocated = 0;
+	trace_impl->stats.bytes_peak = trace_impl->stats.bytes_in_use;
+}
+
+memory_allocator_impl memory_allocator_trace_create(void *ctx)
+{
+	memory_allocator_trace_ctx trace_ctx = (memory_allocator_trace_ctx)ctx;
+
+	memory_allocator_trace_impl trace_impl = trace_ctx->malloc(sizeof(struct memory_allocator_trace_impl_type));
+
+	if (trace_impl == NULL)
+	{
+		return NULL;
+	}
+
+	trace_impl->malloc = trace_ctx->malloc;
+	trace_impl->realloc = trace_ctx->realloc;
+	trace_impl->free = trace_ctx->free;
+
+	trace_impl->stats.allocations = 0;
+	trace_impl->stats.reallocations = 0;
+	trace_impl->stats.deallocations = 0;
+	trace_impl->stats.bytes_allocated = 0;
+	trace_impl->stats.bytes_in_use = 0;
+	trace_impl->stats.bytes_peak = 0;
+
+	return (memory_allocator_impl)trace_impl;
+}
+
+void memory_allocator_trace_account_allocate(memory_allocator_trace_impl trace_impl, size_t size)
+{
+	trace_impl->stats.bytes_allocated += size;
+	trace_impl->stats.bytes_in_use += size;
+
+	if (trace_impl->stats.bytes_in_use > trace_impl->stats.bytes_peak)
+	{
+		trace_impl->stats.bytes_peak = trace_impl->stats.bytes_in_use;
+	}
+}
+
+void memory_allocator_trace_account_deallocate(memory_allocator_trace_impl trace_impl, size_t size)
+{
+	trace_impl->stats.bytes_in_use -= size;
+}
+
+void *memory_allocator_trace_allocate(memory_allocator_impl impl, size_t size)
+{
+	memory_allocator_trace_impl trace_impl = (memory_allocator_trace_impl)impl;
+
+	memory_allocator_trace_header header = trace_impl->malloc(sizeof(union memory_allocator_trace_header_type) + size);
+
+	if (header == NULL)
+	{
+		return NULL;
+	}
+
+	header->size = size;
+
+	++trace_impl->stats.allocations;
+
+	memory_allocator_trace_account_allocate(trace_impl, size);
+
+	return (void *)(header + 1);
+}
+
+void *memory_allocator_trace_reallocate(memory_allocator_impl impl, void *data, size_t size, size_t new_size)
+{
+	memory_allocator_trace_impl trace_impl = (memory_allocator_trace_impl)impl;
+
+	memory_allocator_trace_header header, new_header;
+
+	(void)size;
+
+	if (data == NULL)
+	{
+		return memory_allocator_trace_allocate(impl, new_size);
+	}
+
+	header = ((memory_allocator_trace_header)data) - 1;
+
+	new_header = trace_impl->realloc(header, sizeof(union memory_allocator_trace_header_type) + new_size);
+
+	if (new_header == NULL)
+	{
+		return NULL;
+	}
+
+	memory_allocator_trace_account_deallocate(trace_impl, new_header->size);
+
+	new_header->size = new_size;
+
+	++trace_impl->stats.reallocations;
+
+	memory_allocator_trace_account_allocate(trace_impl, new_size);
+
+	return (void *)(new_header + 1);
+}
+
+void memory_allocator_trace_deallocate(memory_allocator_impl impl, void *data)
+{
+	memory_allocator_trace_impl trace_impl = (memory_allocator_trace_impl)impl;
+
+	memory_allocator_trace_header header;
+
+	if (data == NULL)
+	{
+		return;
+	}
+
+	header = ((memory_allocator_trace_header)data) - 1;
+
+	++trace_impl->stats.deallocations;
+
+	memory_allocator_trace_account_deallocate(trace_impl, header->size);
+
+	trace_impl->free(header);
+}
+
+void memory_allocator_trace_destroy(memory_allocator_impl impl)
+{
+	memory_allocator_trace_impl trace_impl = (memory_allocator_trace_impl)impl;
+
+	memory_allocator_std_impl_free free = trace_impl->free;
+
+	free(trace_impl);
+}
@@ -41,16 +41,27 @@ extern "C" {
 /* -- Headers -- */
 
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 /* -- Definitions -- */
 
-#define METACALL_FLAGS_FORK_SAFE 0x01 << 0x00
+#define METACALL_FLAGS_FORK_SAFE	0x01 << 0x00
+#define METACALL_FLAGS_BOOT_PROFILE 0x01 << 0x01
+
+#define METACALL_FRAME_ARGS_SIZE	0x10
+#define METACALL_FRAME_STORAGE_SIZE 0x40
+
+#define METACALL_INVALID_INDEX ((size_t)~0)
+
+#define METACALL_STATS_HISTOGRAM_SIZE 0x40
 
 /* -- Forward Declarations -- */
 
 struct metacall_initialize_configuration_type;
 
+struct metacall_frame;
+
 /* -- Type Definitions -- */
 
 struct metacall_initialize_configuration_type
@@ -59,6 +70,50 @@ struct metacall_initialize_configuration_type
 	void *options;
 };
 
+/**
+*  @brief
+*    Caller owned argument frame for zero allocation calls, the
+*    members must be treated as opaque and only be accessed
+*    through the metacall_frame API
+*/
+struct metacall_frame
+{
+	size_t size;
+	void *args[METACALL_FRAME_ARGS_SIZE];
+	union
+	{
+		double d;
+		long l;
+		void *ptr;
+		unsigned char data[METACALL_FRAME_STORAGE_SIZE];
+	} storage[METACALL_FRAME_ARGS_SIZE];
+};
+
+/**
+*  @brief
+*    Per function call instrumentation counters, filled by @metacall_stats;
+*    the histogram buckets call latency in nanoseconds by log2 of the
+*    elapsed time
+*/
+struct metacall_stats_type
+{
+	size_t call_count;
+	uint64_t total_time;
+	uint64_t latency_histogram[METACALL_STATS_HISTOGRAM_SIZE];
+};
+
+/**
+*  @brief
+*    Garbage collector counters of a runtime, filled by
+*    @metacall_gc_stats; runtimes report what they can measure and
+*    leave the rest at zero
+*/
+struct metacall_gc_stats_type
+{
+	size_t heap_size;		 /* Bytes (or runtime blocks) currently held by the managed heap */
+	size_t collection_count; /* Collections run since the loader initialized */
+};
+
 /* -- Global Variables -- */
 
 METACALL_API extern void *metacall_null_args[1];
@@ -102,18 +157,89 @@ METACALL_API void metacall_flags(int flags);
 */
 METACALL_API int metacall_initialize(void);
 
+/**
+*  @brief
+*    Retrieve the boot profile recorded during initialization when the
+*    flag METACALL_FLAGS_BOOT_PROFILE has been set before initializing;
+*    each phase of the startup (configuration, await executor, loader
+*    initialization, per tag runtime startup, preload) maps to the wall
+*    time it took in milliseconds
+*
+*  @return
+*    Map value of phase name to milliseconds as double, it must be
+*    destroyed with @metacall_value_destroy; null if the profiler was
+*    not enabled or nothing has been recorded yet
+*/
+METACALL_API void *metacall_initialize_report(void);
+
 /**
 *  @brief
 *    Initialize MetaCall library with configuration arguments
 *
 *  @param[in] initialize_config
-*    Extension of the script to be loaded in memory with data to be injected
+*    Null terminated array of per loader initialization options; for each
+*    entry, @options is a map value of string keys that is overlaid over
+*    the <tag>_loader configuration scope before the runtime starts, so
+*    knobs the loaders read from their configuration (interpreter heap
+*    sizes, garbage collection modes, thread pool widths) can be tuned
+*    per deployment without recompiling. The options map is owned by the
+*    caller and must outlive the loader
 *
 *  @return
 *    Zero if success, different from zero otherwise
 */
 METACALL_API int metacall_initialize_ex(struct metacall_initialize_configuration_type initialize_config[]);
 
+/**
+*  @brief
+*    Initialize MetaCall library and eagerly start the runtimes of @tags,
+*    each one on its own thread, so the total startup time approaches the
+*    slowest runtime instead of the sum of all of them; the tags passed in
+*    a single call must be independent between each other, runtimes that
+*    depend on another one must be initialized in a later call once this
+*    one has returned
+*
+*  @param[in] tags
+*    Array of loader tags to be initialized (e.g "node", "py", "rb")
+*
+*  @param[in] size
+*    Number of elements of @tags
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_initialize_parallel(const char *tags[], size_t size);
+
+/**
+*  @brief
+*    Kick off an asynchronous warm up of the loader plugins @tags and
+*    return immediately; the plugins are dynlink loaded and their
+*    runtimes started in the background so the first call that touches
+*    them does not pay the boot cost inline. Readiness can be awaited
+*    with @metacall_preload_await or polled per tag with
+*    @metacall_is_initialized
+*
+*  @param[in] tags
+*    Array of loader tags to be warmed up (e.g "node", "py", "rb")
+*
+*  @param[in] size
+*    Number of elements of @tags
+*
+*  @return
+*    Zero if the warm up was started, different from zero otherwise
+*/
+METACALL_API int metacall_preload(const char *tags[], size_t size);
+
+/**
+*  @brief
+*    Wait for the warm up started by @metacall_preload to finish,
+*    it returns immediately when no warm up is in flight
+*
+*  @return
+*    Zero if every preloaded runtime started correctly, different from zero otherwise
+*/
+METACALL_API int metacall_preload_await(void);
+
 /**
 *  @brief
 *    Check if script context is loaded by @tag
@@ -176,7 +302,8 @@ METACALL_API int metacall_execution_path_s(const char *tag, size_t tag_length, c
 *    Loads a script from file specified by @path
 *
 *  @param[in] tag
-*    Extension of the script
+*    Extension of the script, when null the tag is inferred from the
+*    extension of the first path through the loader dispatch table
 *
 *  @param[in] paths
 *    Path array of files
@@ -192,6 +319,33 @@ METACALL_API int metacall_execution_path_s(const char *tag, size_t tag_length, c
 */
 METACALL_API int metacall_load_from_file(const char *tag, const char *paths[], size_t size, void **handle);
 
+/**
+*  @brief
+*    Loads a batch of scripts from file, each one into its own handle;
+*    the files are grouped by loader with one worker per runtime so
+*    independent runtimes overlap their discovery, and loaders that
+*    declare parallel capable discovery spread the files of their
+*    group across threads
+*
+*  @param[in] tags
+*    Extension of each script, a null entry is inferred from the
+*    extension of its path through the loader dispatch table
+*
+*  @param[in] paths
+*    Path array of files, entry @i is loaded with loader @tags[i]
+*
+*  @param[in] size
+*    Size of the arrays @tags and @paths
+*
+*  @param[out] handles
+*    Optional array of @size references, entry @i receives the handle
+*    of @paths[i]
+*
+*  @return
+*    Zero if every file loaded, different from zero if any of them failed
+*/
+METACALL_API int metacall_load_from_file_bulk(const char *tags[], const char *paths[], size_t size, void *handles[]);
+
 /**
 *  @brief
 *    Loads a script from memory
@@ -213,6 +367,64 @@ METACALL_API int metacall_load_from_file(const char *tag, const char *paths[], s
 */
 METACALL_API int metacall_load_from_memory(const char *tag, const char *buffer, size_t size, void **handle);
 
+/**
+*  @brief
+*    Loads a script from the set of @paths without blocking the caller,
+*    parsing, compilation and discovery run on a background thread and
+*    the callbacks follow the same convention as @metacall_await
+
+*  @param[in] tag
+*    Extension of the script
+
+*  @param[in] paths
+*    Path array of scripts, copied before the call returns
+
+*  @param[in] size
+*    Size of the array @paths
+
+*  @param[in] resolve_callback
+*    Invoked from the background thread with the loaded handle on success
+
+*  @param[in] reject_callback
+*    Invoked from the background thread with null when the load fails
+
+*  @param[in] data
+*    User defined context passed to the callbacks
+
+*  @return
+*    Zero if the load was scheduled, different from zero otherwise
+*/
+METACALL_API int metacall_load_from_file_await(const char *tag, const char *paths[], size_t size, void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data);
+
+/**
+*  @brief
+*    Loads a script from memory without blocking the caller, the buffer
+*    is copied before the call returns and the callbacks follow the
+*    same convention as @metacall_await
+
+*  @param[in] tag
+*    Extension of the script
+
+*  @param[in] buffer
+*    Memory block representing the string of the script
+
+*  @param[in] size
+*    Size in bytes of the @buffer
+
+*  @param[in] resolve_callback
+*    Invoked from the background thread with the loaded handle on success
+
+*  @param[in] reject_callback
+*    Invoked from the background thread with null when the load fails
+
+*  @param[in] data
+*    User defined context passed to the callbacks
+
+*  @return
+*    Zero if the load was scheduled, different from zero otherwise
+*/
+METACALL_API int metacall_load_from_memory_await(const char *tag, const char *buffer, size_t size, void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data);
+
 /**
 *  @brief
 *    Loads a package of scrips from file specified by @path into loader defined by @extension
@@ -410,232 +622,881 @@ METACALL_API void *metacallht_s(void *handle, const char *name, const enum metac
 
 /**
 *  @brief
-*    Get the function by @name
+*    Call a function anonymously @count times with the argument
+*    matrix @args, crossing into the loader only once when the
+*    loader implements the batch interface; arguments must already
+*    match the types of the function signature
 *
 *  @param[in] name
 *    Name of the function
 *
+*  @param[in] args
+*    Array of @count argument arrays, each of @size elements
+*
+*  @param[in] size
+*    Number of arguments of each call
+*
+*  @param[in] count
+*    Number of calls in the batch
+*
+*  @param[out] results
+*    Array of @count values containing the result of each call
+*
 *  @return
-*    Function reference, null if the function does not exist
+*    Zero if success, different from zero otherwise
 */
-METACALL_API void *metacall_function(const char *name);
+METACALL_API int metacallv_batch(const char *name, void **args[], size_t size, size_t count, void *results[]);
 
 /**
 *  @brief
-*    Get the function by @name from @handle
+*    Call a function anonymously @count times with the argument
+*    matrix @args and function @func, crossing into the loader only
+*    once when the loader implements the batch interface; arguments
+*    must already match the types of the function signature
 *
-*  @param[in] handle
-*    Pointer to the handle returned by metacall_load_from_{file, memory, package}
+*  @param[in] func
+*    Reference to function to be called
 *
-*  @param[in] name
-*    Name of the function
+*  @param[in] args
+*    Array of @count argument arrays, each of @size elements
+*
+*  @param[in] size
+*    Number of arguments of each call
+*
+*  @param[in] count
+*    Number of calls in the batch
+*
+*  @param[out] results
+*    Array of @count values containing the result of each call
 *
 *  @return
-*    Function reference, null if the function does not exist
+*    Zero if success, different from zero otherwise
 */
-METACALL_API void *metacall_handle_function(void *handle, const char *name);
+METACALL_API int metacallfv_batch(void *func, void **args[], size_t size, size_t count, void *results[]);
 
 /**
 *  @brief
-*    Get the function parameter type id
+*    Register a cross-thread call router for the runtime @tag, owned
+*    by the calling thread; calls dispatched from other threads are
+*    enqueued and drained in batches by the owner, so runtimes pinned
+*    to their initializing thread can be reached without every
+*    embedder hand-rolling its own marshaling queue
 *
-*  @param[in] func
-*    The pointer to the function obtained from metacall_function
+*  @param[in] tag
+*    Extension of the loader the router belongs to
 *
-*  @param[in] parameter
-*    The index of the parameter to be retrieved
+*  @param[in] wake
+*    Callback notifying the owner that the queue became non empty,
+*    null for owners draining on their own schedule
 *
-*  @param[out] id
-*    The parameter type id that will be returned
+*  @param[in] data
+*    Reference to additional data passed to the wake callback
 *
 *  @return
-*    Return 0 if the @parameter index exists and @func is valid, 1 otherwhise
+*    Zero if success, different from zero otherwise
 */
-METACALL_API int metacall_function_parameter_type(void *func, size_t parameter, enum metacall_value_id *id);
+METACALL_API int metacall_dispatch_register(const char *tag, void (*wake)(void *), void *data);
 
 /**
 *  @brief
-*    Get the function return type id
+*    Unregister the call router of @tag, parked callers are woken
+*    with a null result
+*
+*  @param[in] tag
+*    Extension of the loader the router belongs to
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_dispatch_unregister(const char *tag);
+
+/**
+*  @brief
+*    Call the function @func through the router of @tag; on the owner
+*    thread the call runs directly, on any other thread it is queued
+*    and the caller parks on a futex until the owner drains it
+*
+*  @param[in] tag
+*    Extension of the loader the router belongs to
 *
 *  @param[in] func
-*    The pointer to the function obtained from metacall_function
+*    Reference to function to be called
 *
+*  @param[in] args
+*    Array of pointers to the values to be passed to the function
 *
-*  @param[out] id
-*    The value id of the return type of the function @func
+*  @param[in] size
+*    Number of function arguments
 *
 *  @return
-*    Return 0 if the @func is valid, 1 otherwhise
+*    Pointer to value containing the result of the call
 */
-METACALL_API int metacall_function_return_type(void *func, enum metacall_value_id *id);
+METACALL_API void *metacall_dispatchfv(const char *tag, void *func, void *args[], size_t size);
 
 /**
 *  @brief
-*    Get minimun mumber of arguments accepted by function @func
+*    Execute every call queued on the router of @tag in one sweep,
+*    must be invoked from the owner thread (typically from the
+*    runtime event loop)
 *
-*  @param[in] func
-*    Function reference
+*  @param[in] tag
+*    Extension of the loader the router belongs to
 *
 *  @return
-*    Return mumber of arguments
+*    Number of calls executed
 */
-METACALL_API size_t metacall_function_size(void *func);
+METACALL_API size_t metacall_dispatch_drain(const char *tag);
 
 /**
 *  @brief
-*    Check if the function @func is asynchronous or synchronous
+*    Initialize the caller owned argument frame @frame, which
+*    encodes primitive arguments inline into its own storage so
+*    scalar heavy calls do not allocate any value on the heap
 *
-*  @param[in] func
-*    Function reference
+*  @param[in] frame
+*    Pointer to the frame, usually allocated on the stack of the caller
 *
 *  @return
-*    Return 0 if it is syncrhonous, 1 if it is asynchronous and -1 if the function is NULL
+*    Zero if success, different from zero otherwise
 */
-METACALL_API int metacall_function_async(void *func);
+METACALL_API int metacall_frame_initialize(struct metacall_frame *frame);
 
 /**
 *  @brief
-*    Get the handle by @name
+*    Encode the boolean @b inline as the argument @index of @frame
 *
-*  @param[in] tag
-*    Extension of the script
+*  @param[in] frame
+*    Pointer to the frame initialized by @metacall_frame_initialize
 *
-*  @param[in] name
-*    Name of the handle
+*  @param[in] index
+*    Position of the argument inside the frame
+*
+*  @param[in] b
+*    Boolean to be encoded
 *
 *  @return
-*    Handle reference, null if the function does not exist
+*    Zero if success, different from zero otherwise
 */
-METACALL_API void *metacall_handle(const char *tag, const char *name);
+METACALL_API int metacall_frame_bool(struct metacall_frame *frame, size_t index, boolean b);
 
 /**
 *  @brief
-*    Get name of a @handle
+*    Encode the char @c inline as the argument @index of @frame
 *
-*  @param[in] handle
-*    Pointer to the handle to be retrieved
+*  @param[in] frame
+*    Pointer to the frame initialized by @metacall_frame_initialize
+*
+*  @param[in] index
+*    Position of the argument inside the frame
+*
+*  @param[in] c
+*    Character to be encoded
 *
 *  @return
-*    String that references the handle
+*    Zero if success, different from zero otherwise
 */
-METACALL_API const char *metacall_handle_id(void *handle);
+METACALL_API int metacall_frame_char(struct metacall_frame *frame, size_t index, char c);
 
 /**
 *  @brief
-*    Return a value representing the handle as a map of functions (or values)
+*    Encode the short @s inline as the argument @index of @frame
 *
-*  @param[in] handle
-*    Reference to the handle to be described
+*  @param[in] frame
+*    Pointer to the frame initialized by @metacall_frame_initialize
+*
+*  @param[in] index
+*    Position of the argument inside the frame
+*
+*  @param[in] s
+*    Short to be encoded
 *
 *  @return
-*    A value of type map on success, null otherwise
+*    Zero if success, different from zero otherwise
 */
-METACALL_API void *metacall_handle_export(void *handle);
+METACALL_API int metacall_frame_short(struct metacall_frame *frame, size_t index, short s);
 
 /**
 *  @brief
-*    Call a function anonymously by value array @args and function @func
+*    Encode the integer @i inline as the argument @index of @frame
 *
-*  @param[in] func
-*    Reference to function to be called
+*  @param[in] frame
+*    Pointer to the frame initialized by @metacall_frame_initialize
 *
-*  @param[in] args
-*    Array of pointers to data
+*  @param[in] index
+*    Position of the argument inside the frame
+*
+*  @param[in] i
+*    Integer to be encoded
 *
 *  @return
-*    Pointer to value containing the result of the call
+*    Zero if success, different from zero otherwise
 */
-METACALL_API void *metacallfv(void *func, void *args[]);
+METACALL_API int metacall_frame_int(struct metacall_frame *frame, size_t index, int i);
 
 /**
 *  @brief
-*    Call a function anonymously by value array @args and function @func
+*    Encode the long @l inline as the argument @index of @frame
 *
-*  @param[in] func
-*    Reference to function to be called
+*  @param[in] frame
+*    Pointer to the frame initialized by @metacall_frame_initialize
 *
-*  @param[in] args
-*    Array of pointers to data
+*  @param[in] index
+*    Position of the argument inside the frame
 *
-*  @param[in] size
-*    Number of function arguments
+*  @param[in] l
+*    Long to be encoded
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_frame_long(struct metacall_frame *frame, size_t index, long l);
+
+/**
+*  @brief
+*    Encode the float @f inline as the argument @index of @frame
+*
+*  @param[in] frame
+*    Pointer to the frame initialized by @metacall_frame_initialize
+*
+*  @param[in] index
+*    Position of the argument inside the frame
+*
+*  @param[in] f
+*    Float to be encoded
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_frame_float(struct metacall_frame *frame, size_t index, float f);
+
+/**
+*  @brief
+*    Encode the double @d inline as the argument @index of @frame
+*
+*  @param[in] frame
+*    Pointer to the frame initialized by @metacall_frame_initialize
+*
+*  @param[in] index
+*    Position of the argument inside the frame
+*
+*  @param[in] d
+*    Double to be encoded
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_frame_double(struct metacall_frame *frame, size_t index, double d);
+
+/**
+*  @brief
+*    Encode the pointer @ptr inline as the argument @index of @frame
+*
+*  @param[in] frame
+*    Pointer to the frame initialized by @metacall_frame_initialize
+*
+*  @param[in] index
+*    Position of the argument inside the frame
+*
+*  @param[in] ptr
+*    Pointer to be encoded
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_frame_ptr(struct metacall_frame *frame, size_t index, const void *ptr);
+
+/**
+*  @brief
+*    Call a function anonymously by the argument frame @frame,
+*    without allocating any argument value on the heap
+*
+*  @param[in] name
+*    Name of the function
+*
+*  @param[in] frame
+*    Pointer to the frame initialized by @metacall_frame_initialize
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacallv_frame(const char *name, struct metacall_frame *frame);
+
+/**
+*  @brief
+*    Call a function anonymously by the argument frame @frame
+*    and function @func, without allocating any argument value
+*    on the heap
+*
+*  @param[in] func
+*    Reference to function to be called
+*
+*  @param[in] frame
+*    Pointer to the frame initialized by @metacall_frame_initialize
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacallfv_frame(void *func, struct metacall_frame *frame);
+
+/**
+*  @brief
+*    Create a pre-resolved call site for the function @name,
+*    bundling the resolved function, its signature and a reusable
+*    argument slot array, so repeated invocations avoid the name
+*    lookup across the loader scopes
+*
+*  @param[in] name
+*    Name of the function
+*
+*  @return
+*    Opaque call site reference, null if the function does not exist
+*/
+METACALL_API void *metacall_callsite_create(const char *name);
+
+/**
+*  @brief
+*    Get the reusable argument slot array owned by @callsite,
+*    sized by @metacall_callsite_size, which can be filled by the
+*    caller and passed to @metacall_callsite_invoke
+*
+*  @param[in] callsite
+*    Pointer to the call site returned by @metacall_callsite_create
+*
+*  @return
+*    Pointer to the argument slot array, null if @callsite is invalid
+*/
+METACALL_API void **metacall_callsite_args(void *callsite);
+
+/**
+*  @brief
+*    Get the number of arguments of the function resolved by @callsite
+*
+*  @param[in] callsite
+*    Pointer to the call site returned by @metacall_callsite_create
+*
+*  @return
+*    Number of arguments of the resolved function
+*/
+METACALL_API size_t metacall_callsite_size(void *callsite);
+
+/**
+*  @brief
+*    Call the function resolved by @callsite by value array @args,
+*    without hashing the name or iterating the loader scopes
+*
+*  @param[in] callsite
+*    Pointer to the call site returned by @metacall_callsite_create
+*
+*  @param[in] args
+*    Array of pointers to data, usually @metacall_callsite_args
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacall_callsite_invoke(void *callsite, void *args[]);
+
+/**
+*  @brief
+*    Destroy the call site @callsite and release the resolved function
+*
+*  @param[in] callsite
+*    Pointer to the call site returned by @metacall_callsite_create
+*/
+METACALL_API void metacall_callsite_destroy(void *callsite);
+
+/**
+*  @brief
+*    Get the function by @name
+*
+*  @param[in] name
+*    Name of the function
+*
+*  @return
+*    Function reference, null if the function does not exist
+*/
+METACALL_API void *metacall_function(const char *name);
+
+/**
+*  @brief
+*    Obtain the current function generation; it is bumped on every
+*    load, clear, reload and destroy, so caches of pointers obtained
+*    from @metacall_function stay valid while the generation they
+*    were resolved under matches the current one
+*
+*  @return
+*    Current function generation
+*/
+METACALL_API size_t metacall_function_generation(void);
+
+typedef void (*metacall_generation_invalidate_cb)(size_t generation, void *data);
+
+/**
+*  @brief
+*    Register a hook executed whenever the function generation is
+*    bumped, allowing embedders to invalidate call site tokens
+*    eagerly instead of revalidating on each call
+*
+*  @param[in] callback
+*    Hook to be executed with the new generation
+*
+*  @param[in] data
+*    Context passed to the hook on each execution
+*
+*  @return
+*    Zero on success, non zero when the hook table is full
+*/
+METACALL_API int metacall_function_generation_register(metacall_generation_invalidate_cb callback, void *data);
+
+/**
+*  @brief
+*    Obtain the raw native address of @func when its loader guarantees
+*    C ABI compatibility (for example a pinned JIT symbol of the LLVM
+*    loader), letting hot inner loops call a loaded kernel at indirect
+*    call cost, bypassing the invoke marshaling entirely; the caller is
+*    responsible for casting to the correct C signature, which can be
+*    checked through @metacall_function_parameter_type and
+*    @metacall_function_return_type. The address is only stable while
+*    the generation it was resolved under matches
+*    @metacall_function_generation, it must be re-resolved after any
+*    load, clear, reload or destroy
+*
+*  @param[in] func
+*    The pointer to the function obtained from metacall_function
+*
+*  @param[out] generation
+*    Function generation the address was resolved under, for
+*    revalidation with one integer compare (optional, may be null)
+*
+*  @return
+*    Native callable address, null when the loader of @func cannot
+*    guarantee C ABI compatibility
+*/
+METACALL_API void *metacall_function_pointer(void *func, size_t *generation);
+
+/**
+*  @brief
+*    Get the function by @name from @handle
+*
+*  @param[in] handle
+*    Pointer to the handle returned by metacall_load_from_{file, memory, package}
+*
+*  @param[in] name
+*    Name of the function
+*
+*  @return
+*    Function reference, null if the function does not exist
+*/
+METACALL_API void *metacall_handle_function(void *handle, const char *name);
+
+/**
+*  @brief
+*    Get the function parameter type id
+*
+*  @param[in] func
+*    The pointer to the function obtained from metacall_function
+*
+*  @param[in] parameter
+*    The index of the parameter to be retrieved
+*
+*  @param[out] id
+*    The parameter type id that will be returned
+*
+*  @return
+*    Return 0 if the @parameter index exists and @func is valid, 1 otherwhise
+*/
+METACALL_API int metacall_function_parameter_type(void *func, size_t parameter, enum metacall_value_id *id);
+
+/**
+*  @brief
+*    Get the function return type id
+*
+*  @param[in] func
+*    The pointer to the function obtained from metacall_function
+*
+*
+*  @param[out] id
+*    The value id of the return type of the function @func
+*
+*  @return
+*    Return 0 if the @func is valid, 1 otherwhise
+*/
+METACALL_API int metacall_function_return_type(void *func, enum metacall_value_id *id);
+
+/**
+*  @brief
+*    Get minimun mumber of arguments accepted by function @func
+*
+*  @param[in] func
+*    Function reference
+*
+*  @return
+*    Return mumber of arguments
+*/
+METACALL_API size_t metacall_function_size(void *func);
+
+/**
+*  @brief
+*    Check if the function @func is asynchronous or synchronous
+*
+*  @param[in] func
+*    Function reference
+*
+*  @return
+*    Return 0 if it is syncrhonous, 1 if it is asynchronous and -1 if the function is NULL
+*/
+METACALL_API int metacall_function_async(void *func);
+
+/**
+*  @brief
+*    Get the handle by @name
+*
+*  @param[in] tag
+*    Extension of the script
+*
+*  @param[in] name
+*    Name of the handle
+*
+*  @return
+*    Handle reference, null if the function does not exist
+*/
+METACALL_API void *metacall_handle(const char *tag, const char *name);
+
+/**
+*  @brief
+*    Get name of a @handle
+*
+*  @param[in] handle
+*    Pointer to the handle to be retrieved
+*
+*  @return
+*    String that references the handle
+*/
+METACALL_API const char *metacall_handle_id(void *handle);
+
+/**
+*  @brief
+*    Return a value representing the handle as a map of functions (or values)
+*
+*  @param[in] handle
+*    Reference to the handle to be described
+*
+*  @return
+*    A value of type map on success, null otherwise
+*/
+METACALL_API void *metacall_handle_export(void *handle);
+
+/**
+*  @brief
+*    Call a function anonymously by value array @args and function @func
+*
+*  @param[in] func
+*    Reference to function to be called
+*
+*  @param[in] args
+*    Array of pointers to data
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacallfv(void *func, void *args[]);
+
+/**
+*  @brief
+*    Call a function anonymously by value array @args and function @func
+*
+*  @param[in] func
+*    Reference to function to be called
+*
+*  @param[in] args
+*    Array of pointers to data
+*
+*  @param[in] size
+*    Number of function arguments
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacallfv_s(void *func, void *args[], size_t size);
+
+/* Calls observed before a call site specializes */
+#define METACALL_SITE_THRESHOLD ((size_t)0x08)
+
+/* Inline cache token of a call site, embed one (zero initialized, see
+METACALL_SITE_INITIALIZER) per static call site and route the calls
+through metacall_site_invoke; after METACALL_SITE_THRESHOLD calls with
+an identical shape (same function, same argument types, no casts
+needed) the site flips to a specialized dispatch that skips the lookup,
+the per argument type checking and the generic call machinery, and it
+deoptimizes back to the generic path when the shape changes or
+functions are loaded or unloaded */
+struct metacall_site_type
+{
+	void *func;		   /**< Cached function of the site */
+	size_t generation; /**< Function generation the cache was filled at */
+	size_t shape;	   /**< Folded argument count and type ids */
+	size_t count;	   /**< Identical shape calls observed */
+	int specialized;   /**< Non zero once the site runs the fast path */
+};
+
+#define METACALL_SITE_INITIALIZER \
+	{ \
+		NULL, 0, 0, 0, 0 \
+	}
+
+/**
+*  @brief
+*    Call the function @name through the inline cache token @site,
+*    monomorphic call sites reach a specialized dispatch after warm up
+*
+*  @param[in] site
+*    Reference to the call site token (null falls back to metacallv_s)
+*
+*  @param[in] name
+*    Name of the function
+*
+*  @param[in] args
+*    Array of pointers to data
+*
+*  @param[in] size
+*    Number of function arguments
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacall_site_invoke(struct metacall_site_type *site, const char *name, void *args[], size_t size);
+
+/**
+*  @brief
+*    Call a function anonymously by variable arguments @va_args and function @func
+*
+*  @param[in] func
+*    Reference to function to be called
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacallf(void *func, ...);
+
+/**
+*  @brief
+*    Call a function anonymously by function @func and serial @buffer of size @size
+*
+*  @param[in] func
+*    Reference to function to be called
+*
+*  @param[in] buffer
+*    String representing an array to be deserialized into arguments of the function
+*
+*  @param[in] size
+*    Size of string @buffer
+*
+*  @param[in] allocator
+*    Pointer to allocator will allocate the value
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacallfs(void *func, const char *buffer, size_t size, void *allocator);
+
+/**
+*  @brief
+*    Call a function anonymously by value map (@keys -> @values) and function @func
+*
+*  @param[in] func
+*    Reference to function to be called
+*
+*  @param[in] keys
+*    Array of values representing argument keys
+*
+*  @param[in] values
+*    Array of values representing argument values data
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacallfmv(void *func, void *keys[], void *values[]);
+
+/**
+*  @brief
+*    Pre-resolve the keyword @name of the function @func to its
+*    position in the signature, so repeated map style calls can use
+*    @metacallfiv with integer indexing only
+*
+*  @param[in] func
+*    Reference to function
+*
+*  @param[in] name
+*    Name of the parameter
+*
+*  @return
+*    Position of the parameter, METACALL_INVALID_INDEX if it does not exist
+*/
+METACALL_API size_t metacall_function_index(void *func, const char *name);
+
+/**
+*  @brief
+*    Call a function anonymously by arguments @values positioned by
+*    the pre-resolved indices @indices, avoiding any keyword lookup
+*    on the call path; indices are usually obtained once through
+*    @metacall_function_index
+*
+*  @param[in] func
+*    Reference to function to be called
+*
+*  @param[in] indices
+*    Array of signature positions, one per element of @values
+*
+*  @param[in] values
+*    Array of pointers to data
+*
+*  @param[in] size
+*    Number of elements of @indices and @values, must match the arity
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacallfiv(void *func, const size_t indices[], void *values[], size_t size);
+
+/**
+*  @brief
+*    Call a function anonymously by function @func and serial @buffer of size @size
+*
+*  @param[in] func
+*    Reference to function to be called
+*
+*  @param[in] buffer
+*    String representing a map to be deserialized into arguments of the function
+*
+*  @param[in] size
+*    Size of string @buffer
+*
+*  @param[in] allocator
+*    Pointer to allocator will allocate the value
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacallfms(void *func, const char *buffer, size_t size, void *allocator);
+
+/**
+*  @brief
+*    Enables or disables the per function call instrumentation, when
+*    disabled the call path pays a single predictable branch
+*
+*  @param[in] enable
+*    Zero for disabling the instrumentation, different from zero for enabling it
+*/
+METACALL_API void metacall_stats_enable(int enable);
+
+/**
+*  @brief
+*    Retrieve the instrumentation counters recorded for the function @name
+*
+*  @param[in] name
+*    Name of the function
+*
+*  @param[out] stats
+*    Will be filled with the counters of the function, zeroed if the
+*    function has not been called with the instrumentation enabled
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_stats(const char *name, struct metacall_stats_type *stats);
+
+/**
+*  @brief
+*    Reset the instrumentation counters recorded for the function @name
+*
+*  @param[in] name
+*    Name of the function
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_stats_clear(const char *name);
+
+/**
+*  @brief
+*    Run a full garbage collection on the runtime of loader @tag, or
+*    on every loaded runtime when @tag is null; embedders call this in
+*    traffic troughs so collections do not land in the middle of a
+*    latency sensitive burst
+*
+*  @param[in] tag
+*    Extension of the loader (py, node, rb...), null for all loaders
 *
 *  @return
-*    Pointer to value containing the result of the call
+*    Zero if success; for a named tag, different from zero when the
+*    loader is not loaded or does not support explicit collection
 */
-METACALL_API void *metacallfv_s(void *func, void *args[], size_t size);
+METACALL_API int metacall_gc_collect(const char *tag);
 
 /**
 *  @brief
-*    Call a function anonymously by variable arguments @va_args and function @func
+*    Hint the runtime of loader @tag (or every runtime when @tag is
+*    null) to defer automatic collections; a hint, not a guarantee,
+*    the runtime may still collect under memory pressure. Pair each
+*    call with @metacall_gc_allow once the critical window closes
 *
-*  @param[in] func
-*    Reference to function to be called
+*  @param[in] tag
+*    Extension of the loader, null for all loaders
 *
 *  @return
-*    Pointer to value containing the result of the call
+*    Zero if success, different from zero otherwise
 */
-METACALL_API void *metacallf(void *func, ...);
+METACALL_API int metacall_gc_defer(const char *tag);
 
 /**
 *  @brief
-*    Call a function anonymously by function @func and serial @buffer of size @size
-*
-*  @param[in] func
-*    Reference to function to be called
-*
-*  @param[in] buffer
-*    String representing an array to be deserialized into arguments of the function
-*
-*  @param[in] size
-*    Size of string @buffer
+*    Resume the automatic collections previously deferred with
+*    @metacall_gc_defer on loader @tag, or on every loader when null
 *
-*  @param[in] allocator
-*    Pointer to allocator will allocate the value
+*  @param[in] tag
+*    Extension of the loader, null for all loaders
 *
 *  @return
-*    Pointer to value containing the result of the call
+*    Zero if success, different from zero otherwise
 */
-METACALL_API void *metacallfs(void *func, const char *buffer, size_t size, void *allocator);
+METACALL_API int metacall_gc_allow(const char *tag);
 
 /**
 *  @brief
-*    Call a function anonymously by value map (@keys -> @values) and function @func
-*
-*  @param[in] func
-*    Reference to function to be called
+*    Retrieve the garbage collector counters of loader @tag, or the
+*    aggregate across every loader when @tag is null
 *
-*  @param[in] keys
-*    Array of values representing argument keys
+*  @param[in] tag
+*    Extension of the loader, null for all loaders
 *
-*  @param[in] values
-*    Array of values representing argument values data
+*  @param[out] stats
+*    Will be filled with the counters the runtime can report, fields
+*    it cannot measure stay zero
 *
 *  @return
-*    Pointer to value containing the result of the call
+*    Zero if success, different from zero otherwise
 */
-METACALL_API void *metacallfmv(void *func, void *keys[], void *values[]);
+METACALL_API int metacall_gc_stats(const char *tag, struct metacall_gc_stats_type *stats);
 
 /**
 *  @brief
-*    Call a function anonymously by function @func and serial @buffer of size @size
-*
-*  @param[in] func
-*    Reference to function to be called
-*
-*  @param[in] buffer
-*    String representing a map to be deserialized into arguments of the function
-*
-*  @param[in] size
-*    Size of string @buffer
+*    Enable the call watchdog, a monitor thread samples calls running
+*    longer than @threshold_ms through runtime specific hooks (for
+*    example the Python stack dump) and reports them through the log
+*    subsystem; fast calls pay a slot claim and release only
 *
-*  @param[in] allocator
-*    Pointer to allocator will allocate the value
+*  @param[in] threshold_ms
+*    Minimum wall time of a call in milliseconds before it is sampled
 *
 *  @return
-*    Pointer to value containing the result of the call
+*    Zero if success, different from zero otherwise
 */
-METACALL_API void *metacallfms(void *func, const char *buffer, size_t size, void *allocator);
+METACALL_API int metacall_watchdog_enable(uint64_t threshold_ms);
+
+/**
+*  @brief
+*    Disable the call watchdog and join the monitor thread
+*/
+METACALL_API void metacall_watchdog_disable(void);
 
 /**
 *  @brief
@@ -750,6 +1611,94 @@ METACALL_API void *metacall_await(const char *name, void *args[], void *(*resolv
 */
 METACALL_API void *metacall_await_future(void *f, void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data);
 
+/**
+*  @brief
+*    Awaits an array of futures with a single blocking point and shared
+*    completion counting instead of one sequential await per future
+*
+*  @param[in] futures
+*    Array of pointers to the futures to be awaited
+*
+*  @param[in] size
+*    Number of futures in the array
+*
+*  @param[out] results
+*    Array of size @size receiving one value per future owned by the caller,
+*    null for futures which were rejected or could not be awaited
+*
+*  @return
+*    Zero if all futures resolved, different from zero otherwise
+*/
+METACALL_API int metacall_await_all(void *futures[], size_t size, void *results[]);
+
+/**
+*  @brief
+*    Awaits an array of futures until the first one completes
+*
+*  @param[in] futures
+*    Array of pointers to the futures to be awaited
+*
+*  @param[in] size
+*    Number of futures in the array
+*
+*  @param[out] index
+*    Position of the first completed future in the array
+*
+*  @param[out] result
+*    Value of the first completed future owned by the caller
+*
+*  @return
+*    Zero if the first completed future resolved, different from zero otherwise
+*/
+METACALL_API int metacall_await_any(void *futures[], size_t size, size_t *index, void **result);
+
+/**
+*  @brief
+*    Pull the next item out of the stream value @v (a value of id
+*    METACALL_STREAM returned by a call into a runtime generator or
+*    async iterator); items are produced lazily by the owning runtime
+*    so large result sets are consumed with constant memory instead of
+*    being materialized into a full array up front
+*
+*  @param[in] v
+*    Pointer to the stream value
+*
+*  @return
+*    Value owned by the caller, null once the stream is exhausted
+*/
+METACALL_API void *metacall_stream_next(void *v);
+
+/**
+*  @brief
+*    Pull up to @size items out of the stream value @v into @values,
+*    amortizing the per item dispatch overhead over the chunk
+*
+*  @param[in] v
+*    Pointer to the stream value
+*
+*  @param[out] values
+*    Array receiving the values, each one owned by the caller
+*
+*  @param[in] size
+*    Capacity of @values
+*
+*  @return
+*    Number of items pulled, less than @size only at exhaustion
+*/
+METACALL_API size_t metacall_stream_next_batch(void *v, void *values[], size_t size);
+
+/**
+*  @brief
+*    Check if the stream value @v was already exhausted by a previous pull
+*
+*  @param[in] v
+*    Pointer to the stream value
+*
+*  @return
+*    Non zero once the stream returned its last item
+*/
+METACALL_API int metacall_stream_end(void *v);
+
 /**
 *  @brief
 *    Executes an asynchronous call to the function and registers a callback to be executed when a future is resolved (it does block)
@@ -1135,6 +2084,101 @@ METACALL_API void *metacall_object_get(void *obj, const char *key);
 */
 METACALL_API int metacall_object_set(void *obj, const char *key, void *v);
 
+/**
+*  @brief
+*    Resolve the method @name of @obj once into an opaque token,
+*    repeated calls through the token avoid the per call name lookup
+*
+*  @param[in] obj
+*    Pointer to the object
+*
+*  @param[in] name
+*    Name of the method to resolve
+*
+*  @return
+*    Pointer to the method handle owned by the caller or NULL if an error occurred
+*/
+METACALL_API void *metacall_object_method(void *obj, const char *name);
+
+/**
+*  @brief
+*    Call a method previously resolved by metacall_object_method
+*
+*  @param[in] method
+*    Pointer to the method handle
+*
+*  @param[in] args
+*    Array of pointers to the values to be passed to the method
+*
+*  @param[in] argc
+*    Number of elements of the array @args
+*
+*  @return
+*    Pointer to the value returned by the method or NULL if an error occurred
+*/
+METACALL_API void *metacallv_object_method(void *method, void *args[], size_t argc);
+
+/**
+*  @brief
+*    Destroy a method handle previously resolved by metacall_object_method
+*
+*  @param[in] method
+*    Pointer to the method handle
+*/
+METACALL_API void metacall_object_method_destroy(void *method);
+
+/**
+*  @brief
+*    Resolve the attribute @key of @obj once into an opaque handle,
+*    repeated accesses through the handle avoid the per access key lookup
+*
+*  @param[in] obj
+*    Pointer to the object
+*
+*  @param[in] key
+*    Name of the attribute to resolve
+*
+*  @return
+*    Pointer to the attribute handle owned by the caller or NULL if an error occurred
+*/
+METACALL_API void *metacall_object_attribute(void *obj, const char *key);
+
+/**
+*  @brief
+*    Get the value of a previously resolved attribute handle
+*
+*  @param[in] attr
+*    Pointer to the attribute handle
+*
+*  @return
+*    Pointer to the attribute value or NULL if an error occurred
+*/
+METACALL_API void *metacall_object_attribute_get(void *attr);
+
+/**
+*  @brief
+*    Set the value of a previously resolved attribute handle
+*
+*  @param[in] attr
+*    Pointer to the attribute handle
+*
+*  @param[in] v
+*    Value to set
+*
+*  @return
+*    Non-zero integer if an error ocurred
+*/
+METACALL_API int metacall_object_attribute_set(void *attr, void *v);
+
+/**
+*  @brief
+*    Destroy an attribute handle previously resolved by metacall_object_attribute
+*
+*  @param[in] attr
+*    Pointer to the attribute handle
+*/
+METACALL_API void metacall_object_attribute_destroy(void *attr);
+
 /**
 *  @brief
 *    Provide information about all loaded objects
@@ -1150,6 +2194,32 @@ METACALL_API int metacall_object_set(void *obj, const char *key, void *v);
 */
 METACALL_API char *metacall_inspect(size_t *size, void *allocator);
 
+/**
+*  @brief
+*    Provide information about a subset of the loaded objects, building
+*    and serializing only the requested subtree instead of the full
+*    metadata tree that metacall_inspect walks
+*
+*  @param[in] tag
+*    Extension of the loader to restrict the query to (NULL for all loaders)
+*
+*  @param[in] handle_name
+*    Name of the handle to restrict the query to (NULL for all handles)
+*
+*  @param[in] name_prefix
+*    Prefix the object names must start with (NULL for all objects)
+*
+*  @param[out] size
+*    Size in bytes of return buffer
+*
+*  @param[in] allocator
+*    Pointer to allocator will allocate the string
+*
+*  @return
+*    String containing introspection information
+*/
+METACALL_API char *metacall_inspect_query(const char *tag, const char *handle_name, const char *name_prefix, size_t *size, void *allocator);
+
 /**
 *  @brief
 *    Convert the value @v to serialized string
@@ -1171,6 +2241,87 @@ METACALL_API char *metacall_inspect(size_t *size, void *allocator);
 */
 METACALL_API char *metacall_serialize(const char *name, void *v, size_t *size, void *allocator);
 
+/**
+*  @brief
+*    Create a reusable serialization buffer backed by @allocator,
+*    its capacity is retained across serializations so steady state
+*    callers do not allocate per call
+*
+*  @param[in] allocator
+*    Pointer to allocator will allocate the buffer contents
+*
+*  @return
+*    Pointer to the buffer on success, null otherwise
+*/
+METACALL_API void *metacall_serialize_buffer_create(void *allocator);
+
+/**
+*  @brief
+*    Convert the value @v to serialized string inside the reusable
+*    buffer @buffer, overwriting its previous contents
+*
+*  @param[in] name
+*    Name of the serial to be used
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @param[in] buffer
+*    Pointer to the reusable serialization buffer
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+METACALL_API int metacall_serialize_buffer(const char *name, void *v, void *buffer);
+
+/**
+*  @brief
+*    Provide information about all loaded objects inside the
+*    reusable buffer @buffer, overwriting its previous contents
+*
+*  @param[in] buffer
+*    Pointer to the reusable serialization buffer
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+METACALL_API int metacall_inspect_buffer(void *buffer);
+
+/**
+*  @brief
+*    Obtain the serialized contents of the reusable buffer @buffer
+*
+*  @param[in] buffer
+*    Pointer to the reusable serialization buffer
+*
+*  @return
+*    Null terminated string with the last serialization
+*/
+METACALL_API char *metacall_serialize_buffer_data(void *buffer);
+
+/**
+*  @brief
+*    Obtain the size in bytes of the contents of the reusable
+*    buffer @buffer, including the null terminator
+*
+*  @param[in] buffer
+*    Pointer to the reusable serialization buffer
+*
+*  @return
+*    Size in bytes of the last serialization
+*/
+METACALL_API size_t metacall_serialize_buffer_size(void *buffer);
+
+/**
+*  @brief
+*    Destroy the reusable serialization buffer @buffer and
+*    its contents
+*
+*  @param[in] buffer
+*    Pointer to the reusable serialization buffer
+*/
+METACALL_API void metacall_serialize_buffer_destroy(void *buffer);
+
 /**
 *  @brief
 *    Convert the string @buffer to value
@@ -1204,6 +2355,22 @@ METACALL_API void *metacall_deserialize(const char *name, const char *buffer, si
 */
 METACALL_API int metacall_clear(void *handle);
 
+/**
+*  @brief
+*    Reload the handle from its original source paths incrementally,
+*    re-parsing the sources and swapping only the functions that are
+*    discovered again; function pointers obtained before the reload
+*    stay valid and call the new implementations. Only handles loaded
+*    from file can be reloaded
+
+*  @param[in] handle
+*    Reference to the handle to be reloaded
+
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_reload(void *handle);
+
 /**
 *  @brief
 *    Destroy MetaCall library
@@ -1213,6 +2380,27 @@ METACALL_API int metacall_clear(void *handle);
 */
 METACALL_API int metacall_destroy(void);
 
+/**
+*  @brief
+*    Destroy MetaCall library in a background thread, returning
+*    immediately; the teardown of the runtimes happens detached from
+*    the caller so shutdown is not gated on it. Use metacall_destroy_await
+*    to join the teardown before the process exits
+*
+*  @return
+*    Zero if the destruction was scheduled, different from zero otherwise
+*/
+METACALL_API int metacall_destroy_async(void);
+
+/**
+*  @brief
+*    Wait for a destruction started by metacall_destroy_async to complete
+*
+*  @return
+*    Zero if success or no destruction was in flight, different from zero otherwise
+*/
+METACALL_API int metacall_destroy_await(void);
+
 /**
 *  @brief
 *    Provide the module information
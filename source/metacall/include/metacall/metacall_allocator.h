@@ -136,6 +136,35 @@ METACALL_API void *metacall_allocator_realloc(void *allocator, void *data, size_
 */
 METACALL_API void metacall_allocator_free(void *allocator, void *data);
 
+/**
+*  @brief
+*    Bind @allocator as the value allocation source of the calling
+*    thread, typically an nginx request pool created through
+*    @metacall_allocator_create with METACALL_ALLOCATOR_NGINX; every
+*    value the thread creates until @metacall_allocator_unbind (call
+*    arguments, marshaling temporaries, results) comes from the pool
+*    and is never freed individually, the pool reclaims the whole
+*    request at once when it is destroyed, so the request path runs
+*    with zero frees; pair it with passing the same allocator to
+*    @metacall_serialize so the response buffer follows the same
+*    lifetime
+*
+*  @param[in] allocator
+*    Pointer to allocator instance
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_allocator_bind(void *allocator);
+
+/**
+*  @brief
+*    Restore the default value allocator for the calling thread,
+*    values created from the bound pool remain valid until their
+*    pool is destroyed
+*/
+METACALL_API void metacall_allocator_unbind(void);
+
 /**
 *  @brief
 *    Destroy an allocator instance
@@ -61,18 +61,64 @@ typedef pid_t metacall_pid;
 
 typedef int (*metacall_pre_fork_callback_ptr)(void *);
 typedef int (*metacall_post_fork_callback_ptr)(metacall_pid, void *);
+typedef int (*metacall_zygote_worker_callback_ptr)(void *);
+
+/* Embedder fork coordination: @prepare quiesces the embedder state in
+the parent before the fork, @parent resumes it in the parent and
+@child repairs it in the child */
+typedef int (*metacall_fork_prepare_callback_ptr)(void *data);
+typedef int (*metacall_fork_parent_callback_ptr)(void *data);
+typedef int (*metacall_fork_child_callback_ptr)(void *data);
 
 /* -- Methods -- */
 
 /**
 *  @brief
-*    Initialize fork detours and allocate shared memory
+*    Initialize fork detours and allocate shared memory. The detours
+*    install lazily: besides the METACALL_FLAGS_FORK_SAFE eager opt-in,
+*    they are pulled in on the first fork callback registration, so
+*    deployments that never fork keep pristine code paths
 *
 *  @return
 *    Zero if success, different from zero otherwise
 */
 METACALL_API int metacall_fork_initialize(void);
 
+/**
+*  @brief
+*    Register a set of embedder fork coordination callbacks, the first
+*    registration installs the fork detours on demand
+*
+*  @param[in] prepare
+*    Callback quiescing the embedder state before the fork
+*
+*  @param[in] parent
+*    Callback resuming the embedder state in the parent after the fork
+*
+*  @param[in] child
+*    Callback repairing the embedder state in the child after the fork
+*
+*  @param[in] data
+*    Reference to additional data passed to the callbacks, it also
+*    identifies the registration on unregister
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_fork_callback_register(metacall_fork_prepare_callback_ptr prepare, metacall_fork_parent_callback_ptr parent, metacall_fork_child_callback_ptr child, void *data);
+
+/**
+*  @brief
+*    Unregister the embedder fork callbacks identified by @data
+*
+*  @param[in] data
+*    Reference passed on registration
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_fork_callback_unregister(void *data);
+
 /**
 *  @brief
 *    Set fork hook callback
@@ -85,6 +131,30 @@ METACALL_API int metacall_fork_initialize(void);
 */
 METACALL_API void metacall_fork(metacall_pre_fork_callback_ptr pre_callback, metacall_post_fork_callback_ptr post_callback);
 
+/**
+*  @brief
+*    Spawn a worker process from a warm parent (zygote mode). The parent
+*    is expected to have initialized the loaders and preloaded its scripts,
+*    the worker inherits all of that state resident via copy-on-write, so
+*    spawning skips the runtime boot entirely. The fork goes through the
+*    detour trampoline, bypassing the destroy and initialize cycle that
+*    the fork hook performs for coherency on arbitrary forks; the caller
+*    owns the decision that the loaded runtimes tolerate this (single
+*    threaded interpreters do, runtimes with live worker threads may not)
+*
+*  @param[in] worker_callback
+*    Callback executed in the worker process, its return value becomes
+*    the worker exit code
+*
+*  @param[in] context
+*    Reference to additional data passed to the worker callback
+*
+*  @return
+*    Process identifier of the worker in the parent, negative on error
+*    (always negative on platforms without fork)
+*/
+METACALL_API int metacall_fork_zygote(metacall_zygote_worker_callback_ptr worker_callback, void *context);
+
 /**
 *  @brief
 *    Unregister fork detours and destroy shared memory
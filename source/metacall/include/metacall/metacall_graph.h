@@ -0,0 +1,160 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef METACALL_GRAPH_H
+#define METACALL_GRAPH_H 1
+
+/* -- Headers -- */
+
+#include <metacall/metacall_api.h>
+
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+*	Cross-language call graph executor. A graph declares functions as
+*	nodes and data dependencies as edges; execution schedules the nodes
+*	in dependency order, passing each dependency result as an argument
+*	of the dependent node. The scheduler prefers running consecutive
+*	ready nodes that belong to the same runtime, so chains that stay
+*	inside one loader cross the host boundary once instead of on every
+*	hop, and asynchronous functions run concurrently through the await
+*	resolve and reject plumbing while the synchronous part of the graph
+*	keeps executing.
+*/
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Create an empty call graph
+*
+*  @return
+*    Pointer to the graph, null if it failed
+*/
+METACALL_API void *metacall_graph_create(void);
+
+/**
+*  @brief
+*    Declare a node executing the function @func when its dependencies
+*    are resolved
+*
+*  @param[in] graph
+*    Pointer to the graph
+*
+*  @param[in] label
+*    Unique label identifying the node inside the graph
+*
+*  @param[in] func
+*    Pointer to the function (as returned by metacall_function)
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_graph_node(void *graph, const char *label, void *func);
+
+/**
+*  @brief
+*    Bind a constant argument to the node @label, bound arguments are
+*    passed before the dependency results in binding order; the graph
+*    takes ownership of @v
+*
+*  @param[in] graph
+*    Pointer to the graph
+*
+*  @param[in] label
+*    Label of the node receiving the argument
+*
+*  @param[in] v
+*    Value to be bound
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_graph_node_arg(void *graph, const char *label, void *v);
+
+/**
+*  @brief
+*    Declare a data dependency: the result of @src is passed as an
+*    argument of @dst (after its bound arguments, in edge declaration
+*    order) and @dst does not execute before @src completed
+*
+*  @param[in] graph
+*    Pointer to the graph
+*
+*  @param[in] src
+*    Label of the node producing the value
+*
+*  @param[in] dst
+*    Label of the node consuming the value
+*
+*  @return
+*    Zero if success, different from zero otherwise
+*/
+METACALL_API int metacall_graph_edge(void *graph, const char *src, const char *dst);
+
+/**
+*  @brief
+*    Execute the graph, scheduling the nodes in dependency order; the
+*    call returns once every node completed or a node failed (in which
+*    case the nodes still pending are not executed); a graph can be
+*    executed again, previous results are dropped
+*
+*  @param[in] graph
+*    Pointer to the graph
+*
+*  @return
+*    Zero if every node succeeded, different from zero otherwise
+*/
+METACALL_API int metacall_graph_execute(void *graph);
+
+/**
+*  @brief
+*    Retrieve the result of the node @label from the last execution,
+*    the caller owns the returned value
+*
+*  @param[in] graph
+*    Pointer to the graph
+*
+*  @param[in] label
+*    Label of the node
+*
+*  @return
+*    Copy of the node result, null if the node did not complete
+*/
+METACALL_API void *metacall_graph_result(void *graph, const char *label);
+
+/**
+*  @brief
+*    Destroy the graph, its bound arguments and its results
+*
+*  @param[in] graph
+*    Pointer to the graph
+*/
+METACALL_API void metacall_graph_destroy(void *graph);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* METACALL_GRAPH_H */
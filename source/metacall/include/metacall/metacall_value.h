@@ -60,6 +60,8 @@ enum metacall_value_id
 	METACALL_NULL = 14,
 	METACALL_CLASS = 15,
 	METACALL_OBJECT = 16,
+	METACALL_TYPED_ARRAY = 17,
+	METACALL_STREAM = 18,
 
 	METACALL_SIZE,
 	METACALL_INVALID
@@ -166,6 +168,59 @@ METACALL_API void *metacall_value_create_double(double d);
 */
 METACALL_API void *metacall_value_create_string(const char *str, size_t length);
 
+/**
+*  @brief
+*    Create a value from the character block @str of @length bytes
+*    which does not need to be null terminated; only @length characters
+*    are read and the value writes its own terminator, so slices of a
+*    bigger string can be passed without an intermediate copy
+*
+*  @param[in] str
+*    Character block to be copied into the value
+*
+*  @param[in] length
+*    Number of characters to copy from the block
+*
+*  @return
+*    Pointer to value if success, null otherwise
+*/
+METACALL_API void *metacall_value_create_string_n(const char *str, size_t length);
+
+/**
+*  @brief
+*    Create a string value borrowing the characters of @str instead of
+*    copying them; the caller keeps ownership of the string and must
+*    guarantee it outlives the value
+*
+*  @param[in] str
+*    Null terminated string to be borrowed by the value
+*
+*  @param[in] length
+*    Length of the string without the null terminator
+*
+*  @return
+*    Pointer to value if success, null otherwise
+*/
+METACALL_API void *metacall_value_create_string_view(const char *str, size_t length);
+
+/**
+*  @brief
+*    Create a string value borrowing the characters of @str without
+*    copy or free; the caller guarantees the characters live for the
+*    rest of the process (string literals, fixed tables), so copies of
+*    the value keep borrowing them instead of duplicating the string
+*
+*  @param[in] str
+*    Null terminated string with static lifetime to be borrowed
+*
+*  @param[in] length
+*    Length of the string without the null terminator
+*
+*  @return
+*    Pointer to value if success, null otherwise
+*/
+METACALL_API void *metacall_value_create_string_static(const char *str, size_t length);
+
 /**
 *  @brief
 *    Create a value buffer from array @buffer
@@ -181,6 +236,23 @@ METACALL_API void *metacall_value_create_string(const char *str, size_t length);
 */
 METACALL_API void *metacall_value_create_buffer(const void *buffer, size_t size);
 
+/**
+*  @brief
+*    Create a buffer value borrowing the memory block @buffer instead
+*    of copying it; the caller keeps ownership of the block and must
+*    guarantee it outlives the value
+*
+*  @param[in] buffer
+*    Memory block to be borrowed by the value
+*
+*  @param[in] size
+*    Size in bytes of the memory block
+*
+*  @return
+*    Pointer to value if success, null otherwise
+*/
+METACALL_API void *metacall_value_create_buffer_view(void *buffer, size_t size);
+
 /**
 *  @brief
 *    Create a value array from array of values @values
@@ -196,6 +268,44 @@ METACALL_API void *metacall_value_create_buffer(const void *buffer, size_t size)
 */
 METACALL_API void *metacall_value_create_array(const void *values[], size_t size);
 
+/**
+*  @brief
+*    Create a typed array value from contiguous memory block @data
+*
+*  @param[in] data
+*    Constant memory block of elements to be copied into the value,
+*    or null to leave the elements zeroed
+*
+*  @param[in] count
+*    Number of elements contained in the block
+*
+*  @param[in] id
+*    Value id of the elements, it must be a numeric primitive
+*
+*  @return
+*    Pointer to typed array value if success, null otherwhise
+*/
+METACALL_API void *metacall_value_create_typed_array(const void *data, size_t count, enum metacall_value_id id);
+
+/**
+*  @brief
+*    Create a typed array value borrowing the contiguous memory block @data,
+*    the block is neither copied nor freed so it must outlive the value
+*
+*  @param[in] data
+*    Memory block of elements viewed by the value
+*
+*  @param[in] count
+*    Number of elements contained in the block
+*
+*  @param[in] id
+*    Value id of the elements, it must be a numeric primitive
+*
+*  @return
+*    Pointer to typed array value if success, null otherwhise
+*/
+METACALL_API void *metacall_value_create_typed_array_view(void *data, size_t count, enum metacall_value_id id);
+
 /**
 *  @brief
 *    Create a value map from array of tuples @map
@@ -235,6 +345,18 @@ METACALL_API void *metacall_value_create_ptr(const void *ptr);
 */
 METACALL_API void *metacall_value_create_future(void *f);
 
+/**
+*  @brief
+*    Create a value from stream @s
+*
+*  @param[in] s
+*    Pointer to stream will be copied into value
+*
+*  @return
+*    Pointer to value if success, null otherwhise
+*/
+METACALL_API void *metacall_value_create_stream(void *s);
+
 /**
 *  @brief
 *    Create a value from function @f
@@ -441,6 +563,58 @@ METACALL_API float metacall_value_to_float(void *v);
 */
 METACALL_API double metacall_value_to_double(void *v);
 
+/**
+*  @brief
+*    Unchecked variants of the scalar accessors, they skip the type
+*    validation entirely (including in debug builds) for tight result
+*    processing loops where the type is already known; passing a value
+*    of the wrong type is undefined behavior
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Value converted to the respective scalar type
+*/
+METACALL_API boolean metacall_value_to_bool_unchecked(void *v);
+
+METACALL_API char metacall_value_to_char_unchecked(void *v);
+
+METACALL_API short metacall_value_to_short_unchecked(void *v);
+
+METACALL_API int metacall_value_to_int_unchecked(void *v);
+
+METACALL_API long metacall_value_to_long_unchecked(void *v);
+
+METACALL_API float metacall_value_to_float_unchecked(void *v);
+
+METACALL_API double metacall_value_to_double_unchecked(void *v);
+
+/**
+*  @brief
+*    Extract the contents of array value @v into caller buffer
+*    @buffer as a contiguous block of scalars of type @id, validating
+*    the element types once instead of per access; typed arrays of a
+*    matching type are extracted with a single copy
+*
+*  @param[in] v
+*    Reference to the array or typed array value
+*
+*  @param[in] id
+*    Scalar type of the elements to extract
+*
+*  @param[out] buffer
+*    Caller owned block with room for at least @count elements of type @id
+*
+*  @param[in] count
+*    Maximum number of elements to extract
+*
+*  @return
+*    Number of elements written into @buffer, stopping at the first
+*    element that does not match @id
+*/
+METACALL_API size_t metacall_value_array_extract(void *v, enum metacall_value_id id, void *buffer, size_t count);
+
 /**
 *  @brief
 *    Convert value @v to string
@@ -477,6 +651,42 @@ METACALL_API void *metacall_value_to_buffer(void *v);
 */
 METACALL_API void **metacall_value_to_array(void *v);
 
+/**
+*  @brief
+*    Convert value @v to a pointer to its contiguous typed element block
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Value converted to memory block
+*/
+METACALL_API void *metacall_value_to_typed_array(void *v);
+
+/**
+*  @brief
+*    Obtain the element value id of typed array value @v
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Value id of the elements of the typed array
+*/
+METACALL_API enum metacall_value_id metacall_value_typed_array_id(void *v);
+
+/**
+*  @brief
+*    Obtain the number of elements of typed array value @v
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Number of elements contained in the typed array
+*/
+METACALL_API size_t metacall_value_typed_array_count(void *v);
+
 /**
 *  @brief
 *    Convert value @v to map
@@ -489,6 +699,23 @@ METACALL_API void **metacall_value_to_array(void *v);
 */
 METACALL_API void **metacall_value_to_map(void *v);
 
+/**
+*  @brief
+*    Obtain the value stored in map value @v under key @key,
+*    large maps are backed by a hash index built on first access
+*    so the lookup does not degrade to a linear scan
+*
+*  @param[in] v
+*    Reference to the map value
+*
+*  @param[in] key
+*    Key string to look up
+*
+*  @return
+*    Value of the tuple matching @key, null if not present
+*/
+METACALL_API void *metacall_value_map_get(void *v, const char *key);
+
 /**
 *  @brief
 *    Convert value @v to pointer
@@ -513,6 +740,18 @@ METACALL_API void *metacall_value_to_ptr(void *v);
 */
 METACALL_API void *metacall_value_to_future(void *v);
 
+/**
+*  @brief
+*    Convert value @v to stream
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Value converted to stream
+*/
+METACALL_API void *metacall_value_to_stream(void *v);
+
 /**
 *  @brief
 *    Convert value @v to function
@@ -769,6 +1008,21 @@ METACALL_API void *metacall_value_from_ptr(void *v, const void *ptr);
 */
 METACALL_API void *metacall_value_from_future(void *v, void *f);
 
+/**
+*  @brief
+*    Assign stream @s to value @v
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @param[in] s
+*    Stream to be assigned to value @v
+*
+*  @return
+*    Value with stream @s assigned to it
+*/
+METACALL_API void *metacall_value_from_stream(void *v, void *s);
+
 /**
 *  @brief
 *    Assign function @f to value @v
@@ -25,23 +25,62 @@
 #include <metacall/metacall_version.h>
 
 #include <loader/loader.h>
+#include <loader/loader_dispatch.h>
+#include <loader/loader_fork.h>
+#include <loader/loader_path.h>
 
 #include <reflect/reflect.h>
 
+#include <adt/adt_string_pool.h>
+
+#include <threading/threading_atomic.h>
+
 #include <configuration/configuration.h>
 
 #include <log/log.h>
 
+#include <portability/portability_clock.h>
+
 #include <serial/serial.h>
 
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+#else
+	#include <pthread.h>
+#endif
 
 /* -- Definitions -- */
 
 #define METACALL_ARGS_SIZE 0x10
 #define METACALL_SERIAL	   "rapid_json"
 
+#define METACALL_BOOT_PHASES_SIZE	  0x20
+#define METACALL_BOOT_PHASE_NAME_SIZE 0x20
+
+#define METACALL_GENERATION_CALLBACKS_SIZE 0x08
+
+/* -- Type Definitions -- */
+
+struct metacall_callsite_type
+{
+	function f;
+	signature s;
+	size_t args_count;
+	void *args[METACALL_ARGS_SIZE];
+};
+
 /* -- Global Variables -- */
 
 void *metacall_null_args[1];
@@ -50,8 +89,90 @@ void *metacall_null_args[1];
 
 static int metacall_initialize_flag = 1;
 static int metacall_log_null_flag = 1;
+
+/* Background destruction, so shutdown is not gated on runtime teardown */
+struct metacall_destroy_async_type
+{
+	int active;
+	int result;
+#if defined(_WIN32)
+	HANDLE thread;
+#else
+	pthread_t thread;
+#endif
+};
+
+static struct metacall_destroy_async_type metacall_destroy_async_state = { 0 };
 static int metacall_config_flags = 0;
 
+/* Boot profiler, wall time of each startup phase recorded when
+*  METACALL_FLAGS_BOOT_PROFILE is set before initialization */
+struct metacall_boot_phase_type
+{
+	char name[METACALL_BOOT_PHASE_NAME_SIZE];
+	uint64_t elapsed;
+};
+
+static struct metacall_boot_phase_type metacall_boot_phases[METACALL_BOOT_PHASES_SIZE];
+static size_t metacall_boot_phases_count = 0;
+
+/* Function pointer stability contract: the generation is bumped on
+*  every load, clear, reload and destroy, so embedder side caches of
+*  metacall_function pointers revalidate with one integer compare */
+struct metacall_generation_callback_type
+{
+	metacall_generation_invalidate_cb callback;
+	void *data;
+};
+
+static size_t metacall_function_generation_count = 0;
+static struct metacall_generation_callback_type metacall_generation_callbacks[METACALL_GENERATION_CALLBACKS_SIZE];
+static size_t metacall_generation_callbacks_count = 0;
+
+/* -- Private Methods -- */
+
+/**
+*  @brief
+*    Advance the function generation and run the registered
+*    invalidation hooks with the new generation
+*/
+static void metacall_generation_bump(void);
+
+static void metacall_generation_bump(void)
+{
+	size_t generation = threading_atomic_fetch_add(&metacall_function_generation_count, 1) + 1;
+
+	size_t iterator;
+
+	for (iterator = 0; iterator < metacall_generation_callbacks_count; ++iterator)
+	{
+		metacall_generation_callbacks[iterator].callback(generation, metacall_generation_callbacks[iterator].data);
+	}
+}
+
+static uint64_t metacall_boot_clock(void)
+{
+	return portability_clock_nanoseconds();
+}
+
+static void metacall_boot_phase_record(const char *name, uint64_t start)
+{
+	struct metacall_boot_phase_type *phase;
+
+	if (!(metacall_config_flags & METACALL_FLAGS_BOOT_PROFILE) || metacall_boot_phases_count >= METACALL_BOOT_PHASES_SIZE)
+	{
+		return;
+	}
+
+	phase = &metacall_boot_phases[metacall_boot_phases_count++];
+
+	strncpy(phase->name, name, METACALL_BOOT_PHASE_NAME_SIZE - 1);
+
+	phase->name[METACALL_BOOT_PHASE_NAME_SIZE - 1] = '\0';
+
+	phase->elapsed = metacall_boot_clock() - start;
+}
+
 /* -- Methods -- */
 
 const char *metacall_serial()
@@ -77,6 +198,8 @@ int metacall_initialize()
 
 	memory_allocator allocator;
 
+	uint64_t phase_start;
+
 	/* Initialize logs by default to stdout if none has been defined */
 	if (metacall_log_null_flag != 0 && log_size() == 0)
 	{
@@ -103,18 +226,31 @@ int metacall_initialize()
 
 	metacall_null_args[0] = NULL;
 
+	metacall_boot_phases_count = 0;
+
 #ifdef METACALL_FORK_SAFE
 	if (metacall_config_flags & METACALL_FLAGS_FORK_SAFE)
 	{
+		phase_start = metacall_boot_clock();
+
 		if (metacall_fork_initialize() != 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid MetaCall fork initialization");
 		}
 
+		metacall_boot_phase_record("fork", phase_start);
+
 		log_write("metacall", LOG_LEVEL_DEBUG, "MetaCall fork initialized");
 	}
+
+	/* Without the eager opt-in the detours install lazily, pulled in
+	by the first fork callback registration (a fork aware loader or an
+	embedder); processes that never register keep unpatched code */
+	loader_fork_activation(&metacall_fork_initialize);
 #endif /* METACALL_FORK_SAFE */
 
+	phase_start = metacall_boot_clock();
+
 	allocator = memory_allocator_std(&malloc, &realloc, &free);
 
 	if (configuration_initialize(metacall_serial(), NULL, allocator) != 0)
@@ -128,6 +264,8 @@ int metacall_initialize()
 
 	memory_allocator_destroy(allocator);
 
+	metacall_boot_phase_record("configuration", phase_start);
+
 	/* TODO: Improve log initialization and configuration */
 	{
 		configuration config = configuration_scope(CONFIGURATION_GLOBAL_SCOPE);
@@ -152,13 +290,73 @@ int metacall_initialize()
 		}
 	}
 
+	phase_start = metacall_boot_clock();
+
+	if (function_await_executor_initialize() != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid MetaCall await executor initialization");
+	}
+
+	metacall_boot_phase_record("await_executor", phase_start);
+
+	phase_start = metacall_boot_clock();
+
 	loader_initialize();
 
+	metacall_boot_phase_record("loader", phase_start);
+
 	metacall_initialize_flag = 0;
 
 	return 0;
 }
 
+void *metacall_initialize_report()
+{
+	value report;
+
+	value *report_map;
+
+	size_t iterator;
+
+	if (metacall_boot_phases_count == 0)
+	{
+		return NULL;
+	}
+
+	report = value_create_map(NULL, metacall_boot_phases_count);
+
+	if (report == NULL)
+	{
+		return NULL;
+	}
+
+	report_map = value_to_map(report);
+
+	for (iterator = 0; iterator < metacall_boot_phases_count; ++iterator)
+	{
+		value tuple = value_create_array(NULL, 2);
+
+		value *tuple_array;
+
+		if (tuple == NULL)
+		{
+			value_type_destroy(report);
+
+			return NULL;
+		}
+
+		tuple_array = value_to_array(tuple);
+
+		tuple_array[0] = value_create_string(metacall_boot_phases[iterator].name, strlen(metacall_boot_phases[iterator].name));
+
+		tuple_array[1] = value_create_double((double)metacall_boot_phases[iterator].elapsed / 1.0e6);
+
+		report_map[iterator] = tuple;
+	}
+
+	return report;
+}
+
 int metacall_initialize_ex(struct metacall_initialize_configuration_type initialize_config[])
 {
 	size_t index = 0;
@@ -170,6 +368,10 @@ int metacall_initialize_ex(struct metacall_initialize_configuration_type initial
 
 	while (!(initialize_config[index].tag == NULL && initialize_config[index].options == NULL))
 	{
+		uint64_t phase_start = metacall_boot_clock();
+
+		char phase_name[METACALL_BOOT_PHASE_NAME_SIZE];
+
 		loader_impl impl = loader_get_impl(initialize_config[index].tag);
 
 		if (impl == NULL)
@@ -179,12 +381,57 @@ int metacall_initialize_ex(struct metacall_initialize_configuration_type initial
 
 		loader_set_options(initialize_config[index].tag, initialize_config[index].options);
 
+		snprintf(phase_name, METACALL_BOOT_PHASE_NAME_SIZE, "loader:%s", initialize_config[index].tag);
+
+		metacall_boot_phase_record(phase_name, phase_start);
+
 		++index;
 	}
 
 	return 0;
 }
 
+int metacall_initialize_parallel(const char *tags[], size_t size)
+{
+	uint64_t phase_start;
+
+	int result;
+
+	if (metacall_initialize() == 1)
+	{
+		return 1;
+	}
+
+	phase_start = metacall_boot_clock();
+
+	result = loader_initialize_parallel(tags, size);
+
+	metacall_boot_phase_record("loader_parallel", phase_start);
+
+	return result;
+}
+
+int metacall_preload(const char *tags[], size_t size)
+{
+	if (metacall_initialize() == 1)
+	{
+		return 1;
+	}
+
+	return loader_preload(tags, size);
+}
+
+int metacall_preload_await(void)
+{
+	uint64_t phase_start = metacall_boot_clock();
+
+	int result = loader_preload_await();
+
+	metacall_boot_phase_record("preload_await", phase_start);
+
+	return result;
+}
+
 int metacall_is_initialized(const char *tag)
 {
 	return loader_is_initialized(tag);
@@ -230,6 +477,20 @@ int metacall_execution_path_s(const char *tag, size_t tag_length, const char *pa
 	return loader_execution_path(tag_impl, path_impl);
 }
 
+/* Infer the loader tag from the extension of the first path through
+the perfect hash dispatch table, null when it cannot be resolved */
+static const char *metacall_load_from_file_tag(const char *paths[], size_t size)
+{
+	loader_naming_tag extension;
+
+	if (size == 0 || loader_path_get_extension(paths[0], extension) <= 1)
+	{
+		return NULL;
+	}
+
+	return loader_naming_tag_from_extension(extension);
+}
+
 int metacall_load_from_file(const char *tag, const char *paths[], size_t size, void **handle)
 {
 	loader_naming_path *path_impl;
@@ -240,6 +501,18 @@ int metacall_load_from_file(const char *tag, const char *paths[], size_t size, v
 		return 1;
 	}
 
+	if (tag == NULL)
+	{
+		tag = metacall_load_from_file_tag(paths, size);
+
+		if (tag == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "MetaCall could not infer the loader tag from path %s", paths[0]);
+
+			return 1;
+		}
+	}
+
 	path_impl = (loader_naming_path *)malloc(sizeof(loader_naming_path) * size);
 
 	if (path_impl == NULL)
@@ -256,22 +529,175 @@ int metacall_load_from_file(const char *tag, const char *paths[], size_t size, v
 
 	free(path_impl);
 
+	if (result == 0)
+	{
+		metacall_generation_bump();
+	}
+
+	return result;
+}
+
+int metacall_load_from_file_bulk(const char *tags[], const char *paths[], size_t size, void *handles[])
+{
+	loader_naming_tag *tag_impl;
+
+	loader_naming_path *path_impl;
+
+	size_t iterator;
+
+	int result;
+
+	if (tags == NULL || paths == NULL || size == 0)
+	{
+		return 1;
+	}
+
+	tag_impl = (loader_naming_tag *)malloc(sizeof(loader_naming_tag) * size);
+
+	path_impl = (loader_naming_path *)malloc(sizeof(loader_naming_path) * size);
+
+	if (tag_impl == NULL || path_impl == NULL)
+	{
+		free(tag_impl);
+
+		free(path_impl);
+
+		return 1;
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		const char *tag = tags[iterator];
+
+		if (tag == NULL)
+		{
+			tag = metacall_load_from_file_tag(&paths[iterator], 1);
+
+			if (tag == NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "MetaCall could not infer the loader tag from path %s", paths[iterator]);
+
+				free(tag_impl);
+
+				free(path_impl);
+
+				return 1;
+			}
+		}
+
+		strncpy(tag_impl[iterator], tag, LOADER_NAMING_TAG_SIZE);
+
+		strncpy(path_impl[iterator], paths[iterator], LOADER_NAMING_PATH_SIZE);
+	}
+
+	result = loader_load_from_file_bulk((const loader_naming_tag *)tag_impl, (const loader_naming_path *)path_impl, size, handles);
+
+	free(tag_impl);
+
+	free(path_impl);
+
+	if (result == 0)
+	{
+		metacall_generation_bump();
+	}
+
 	return result;
 }
 
 int metacall_load_from_memory(const char *tag, const char *buffer, size_t size, void **handle)
 {
-	return loader_load_from_memory(tag, buffer, size, handle);
+	int result = loader_load_from_memory(tag, buffer, size, handle);
+
+	if (result == 0)
+	{
+		metacall_generation_bump();
+	}
+
+	return result;
+}
+
+int metacall_load_from_file_await(const char *tag, const char *paths[], size_t size, void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data)
+{
+	loader_naming_path *path_impl;
+	size_t iterator;
+
+	if (size == 0)
+	{
+		return 1;
+	}
+
+	if (tag == NULL)
+	{
+		tag = metacall_load_from_file_tag(paths, size);
+
+		if (tag == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "MetaCall could not infer the loader tag from path %s", paths[0]);
+
+			return 1;
+		}
+	}
+
+	path_impl = (loader_naming_path *)malloc(sizeof(loader_naming_path) * size);
+
+	if (path_impl == NULL)
+	{
+		return 1;
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		strncpy(path_impl[iterator], paths[iterator], LOADER_NAMING_PATH_SIZE);
+	}
+
+	int result = loader_load_from_file_await(tag, (const loader_naming_path *)path_impl, size, resolve_callback, reject_callback, data);
+
+	free(path_impl);
+
+	/* The bump happens at initiation rather than completion, a
+	spurious invalidation is harmless while a missed one is not */
+	if (result == 0)
+	{
+		metacall_generation_bump();
+	}
+
+	return result;
+}
+
+int metacall_load_from_memory_await(const char *tag, const char *buffer, size_t size, void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data)
+{
+	int result = loader_load_from_memory_await(tag, buffer, size, resolve_callback, reject_callback, data);
+
+	if (result == 0)
+	{
+		metacall_generation_bump();
+	}
+
+	return result;
 }
 
 int metacall_load_from_package(const char *tag, const char *path, void **handle)
 {
-	return loader_load_from_package(tag, path, handle);
+	int result = loader_load_from_package(tag, path, handle);
+
+	if (result == 0)
+	{
+		metacall_generation_bump();
+	}
+
+	return result;
 }
 
 int metacall_load_from_configuration(const char *path, void **handle, void *allocator)
 {
-	return loader_load_from_configuration(path, handle, allocator);
+	int result = loader_load_from_configuration(path, handle, allocator);
+
+	if (result == 0)
+	{
+		metacall_generation_bump();
+	}
+
+	return result;
 }
 
 void *metacallv(const char *name, void *args[])
@@ -326,20 +752,177 @@ void *metacallhv_s(void *handle, const char *name, void *args[], size_t size)
 	return metacallfv_s(f, args, size);
 }
 
-void *metacall(const char *name, ...)
+int metacallfv_batch(void *func, void **args[], size_t size, size_t count, void *results[])
 {
-	value f_val = loader_get(name);
-	function f = NULL;
+	function f = (function)func;
 
-	if (value_type_id(f_val) == TYPE_FUNCTION)
+	if (f == NULL)
 	{
-		f = value_to_function(f_val);
+		return 1;
+	}
+
+	return function_call_batch(f, args, size, count, (function_return *)results);
+}
+
+int metacallv_batch(const char *name, void **args[], size_t size, size_t count, void *results[])
+{
+	value f_val = loader_get(name);
+	function f = NULL;
+
+	if (value_type_id(f_val) == TYPE_FUNCTION)
+	{
+		f = value_to_function(f_val);
+	}
+
+	return metacallfv_batch(f, args, size, count, results);
+}
+
+int metacall_dispatch_register(const char *tag, void (*wake)(void *), void *data)
+{
+	return loader_dispatch_register(tag, wake, data);
+}
+
+int metacall_dispatch_unregister(const char *tag)
+{
+	return loader_dispatch_unregister(tag);
+}
+
+void *metacall_dispatchfv(const char *tag, void *func, void *args[], size_t size)
+{
+	return loader_dispatch_invoke(tag, (function)func, args, size);
+}
+
+size_t metacall_dispatch_drain(const char *tag)
+{
+	return loader_dispatch_drain(tag);
+}
+
+/* On stack backing store for one vararg decoded by metacall_varargs_pack,
+sized to hold the value descriptor plus any scalar payload or a short string */
+union metacall_varargs_storage
+{
+	double d;
+	long l;
+	void *ptr;
+	unsigned char data[METACALL_FRAME_STORAGE_SIZE];
+};
+
+static void *metacall_varargs_value(union metacall_varargs_storage *storage, const void *data, size_t bytes, type_id id)
+{
+	value v = value_type_create_static(storage->data, METACALL_FRAME_STORAGE_SIZE, data, bytes, id);
+
+	if (v == NULL)
+	{
+		/* The payload does not fit into the frame slot (long strings),
+		fall back to the heap representation */
+		v = value_type_create(data, bytes, id);
+	}
+
+	return v;
+}
+
+static void metacall_varargs_pack(signature s, const enum metacall_value_id ids[], size_t args_count, va_list va, void *args[], union metacall_varargs_storage storage[])
+{
+	size_t iterator;
+
+	for (iterator = 0; iterator < args_count; ++iterator)
+	{
+		type t = signature_get_type(s, iterator);
+
+		type_id id;
+
+		if (t != NULL)
+		{
+			id = type_index(t);
+		}
+		else if (ids != NULL)
+		{
+			id = (type_id)ids[iterator];
+		}
+		else
+		{
+			args[iterator] = NULL;
+
+			continue;
+		}
+
+		if (id == TYPE_BOOL)
+		{
+			boolean b = (boolean)va_arg(va, unsigned int);
+
+			args[iterator] = metacall_varargs_value(&storage[iterator], &b, sizeof(boolean), id);
+		}
+		else if (id == TYPE_CHAR)
+		{
+			char c = (char)va_arg(va, int);
+
+			args[iterator] = metacall_varargs_value(&storage[iterator], &c, sizeof(char), id);
+		}
+		else if (id == TYPE_SHORT)
+		{
+			short sh = (short)va_arg(va, int);
+
+			args[iterator] = metacall_varargs_value(&storage[iterator], &sh, sizeof(short), id);
+		}
+		else if (id == TYPE_INT)
+		{
+			int i = va_arg(va, int);
+
+			args[iterator] = metacall_varargs_value(&storage[iterator], &i, sizeof(int), id);
+		}
+		else if (id == TYPE_LONG)
+		{
+			long l = va_arg(va, long);
+
+			args[iterator] = metacall_varargs_value(&storage[iterator], &l, sizeof(long), id);
+		}
+		else if (id == TYPE_FLOAT)
+		{
+			float fl = (float)va_arg(va, double);
+
+			args[iterator] = metacall_varargs_value(&storage[iterator], &fl, sizeof(float), id);
+		}
+		else if (id == TYPE_DOUBLE)
+		{
+			double d = va_arg(va, double);
+
+			args[iterator] = metacall_varargs_value(&storage[iterator], &d, sizeof(double), id);
+		}
+		else if (id == TYPE_STRING)
+		{
+			const char *str = va_arg(va, const char *);
+
+			args[iterator] = metacall_varargs_value(&storage[iterator], str, strlen(str) + 1, id);
+		}
+		else if (id == TYPE_PTR)
+		{
+			const void *ptr = va_arg(va, const void *);
+
+			args[iterator] = metacall_varargs_value(&storage[iterator], &ptr, sizeof(const void *), id);
+		}
+		else
+		{
+			args[iterator] = NULL;
+		}
+	}
+}
+
+void *metacall(const char *name, ...)
+{
+	value f_val = loader_get(name);
+	function f = NULL;
+
+	if (value_type_id(f_val) == TYPE_FUNCTION)
+	{
+		f = value_to_function(f_val);
 	}
 
 	if (f != NULL)
 	{
 		void *args[METACALL_ARGS_SIZE];
 
+		union metacall_varargs_storage storage[METACALL_ARGS_SIZE];
+
 		value ret = NULL;
 
 		signature s = function_signature(f);
@@ -350,55 +933,7 @@ void *metacall(const char *name, ...)
 
 		va_start(va, name);
 
-		for (iterator = 0; iterator < args_count; ++iterator)
-		{
-			type t = signature_get_type(s, iterator);
-
-			type_id id = type_index(t);
-
-			if (id == TYPE_BOOL)
-			{
-				args[iterator] = value_create_bool((boolean)va_arg(va, unsigned int));
-			}
-			else if (id == TYPE_CHAR)
-			{
-				args[iterator] = value_create_char((char)va_arg(va, int));
-			}
-			else if (id == TYPE_SHORT)
-			{
-				args[iterator] = value_create_short((short)va_arg(va, int));
-			}
-			else if (id == TYPE_INT)
-			{
-				args[iterator] = value_create_int(va_arg(va, int));
-			}
-			else if (id == TYPE_LONG)
-			{
-				args[iterator] = value_create_long(va_arg(va, long));
-			}
-			else if (id == TYPE_FLOAT)
-			{
-				args[iterator] = value_create_float((float)va_arg(va, double));
-			}
-			else if (id == TYPE_DOUBLE)
-			{
-				args[iterator] = value_create_double(va_arg(va, double));
-			}
-			else if (id == TYPE_STRING)
-			{
-				const char *str = va_arg(va, const char *);
-
-				args[iterator] = value_create_string(str, strlen(str));
-			}
-			else if (id == TYPE_PTR)
-			{
-				args[iterator] = value_create_ptr(va_arg(va, const void *));
-			}
-			else
-			{
-				args[iterator] = NULL;
-			}
-		}
+		metacall_varargs_pack(s, NULL, args_count, va, args, storage);
 
 		va_end(va);
 
@@ -446,6 +981,8 @@ void *metacallt(const char *name, const enum metacall_value_id ids[], ...)
 	{
 		void *args[METACALL_ARGS_SIZE];
 
+		union metacall_varargs_storage storage[METACALL_ARGS_SIZE];
+
 		value ret = NULL;
 
 		signature s = function_signature(f);
@@ -456,64 +993,7 @@ void *metacallt(const char *name, const enum metacall_value_id ids[], ...)
 
 		va_start(va, ids);
 
-		for (iterator = 0; iterator < args_count; ++iterator)
-		{
-			type t = signature_get_type(s, iterator);
-
-			type_id id = type_index(t);
-
-			if (t != NULL)
-			{
-				id = type_index(t);
-			}
-			else
-			{
-				id = ids[iterator];
-			}
-
-			if (id == TYPE_BOOL)
-			{
-				args[iterator] = value_create_bool((boolean)va_arg(va, unsigned int));
-			}
-			if (id == TYPE_CHAR)
-			{
-				args[iterator] = value_create_char((char)va_arg(va, int));
-			}
-			else if (id == TYPE_SHORT)
-			{
-				args[iterator] = value_create_short((short)va_arg(va, int));
-			}
-			else if (id == TYPE_INT)
-			{
-				args[iterator] = value_create_int(va_arg(va, int));
-			}
-			else if (id == TYPE_LONG)
-			{
-				args[iterator] = value_create_long(va_arg(va, long));
-			}
-			else if (id == TYPE_FLOAT)
-			{
-				args[iterator] = value_create_float((float)va_arg(va, double));
-			}
-			else if (id == TYPE_DOUBLE)
-			{
-				args[iterator] = value_create_double(va_arg(va, double));
-			}
-			else if (id == TYPE_STRING)
-			{
-				const char *str = va_arg(va, const char *);
-
-				args[iterator] = value_create_string(str, strlen(str));
-			}
-			else if (id == TYPE_PTR)
-			{
-				args[iterator] = value_create_ptr(va_arg(va, const void *));
-			}
-			else
-			{
-				args[iterator] = NULL;
-			}
-		}
+		metacall_varargs_pack(s, ids, args_count, va, args, storage);
 
 		va_end(va);
 
@@ -544,6 +1024,8 @@ void *metacallt_s(const char *name, const enum metacall_value_id ids[], size_t s
 	{
 		void *args[METACALL_ARGS_SIZE];
 
+		union metacall_varargs_storage storage[METACALL_ARGS_SIZE];
+
 		value ret = NULL;
 
 		signature s = function_signature(f);
@@ -554,64 +1036,7 @@ void *metacallt_s(const char *name, const enum metacall_value_id ids[], size_t s
 
 		va_start(va, size);
 
-		for (iterator = 0; iterator < size; ++iterator)
-		{
-			type t = signature_get_type(s, iterator);
-
-			type_id id = type_index(t);
-
-			if (t != NULL)
-			{
-				id = type_index(t);
-			}
-			else
-			{
-				id = ids[iterator];
-			}
-
-			if (id == TYPE_BOOL)
-			{
-				args[iterator] = value_create_bool((boolean)va_arg(va, unsigned int));
-			}
-			if (id == TYPE_CHAR)
-			{
-				args[iterator] = value_create_char((char)va_arg(va, int));
-			}
-			else if (id == TYPE_SHORT)
-			{
-				args[iterator] = value_create_short((short)va_arg(va, int));
-			}
-			else if (id == TYPE_INT)
-			{
-				args[iterator] = value_create_int(va_arg(va, int));
-			}
-			else if (id == TYPE_LONG)
-			{
-				args[iterator] = value_create_long(va_arg(va, long));
-			}
-			else if (id == TYPE_FLOAT)
-			{
-				args[iterator] = value_create_float((float)va_arg(va, double));
-			}
-			else if (id == TYPE_DOUBLE)
-			{
-				args[iterator] = value_create_double(va_arg(va, double));
-			}
-			else if (id == TYPE_STRING)
-			{
-				const char *str = va_arg(va, const char *);
-
-				args[iterator] = value_create_string(str, strlen(str));
-			}
-			else if (id == TYPE_PTR)
-			{
-				args[iterator] = value_create_ptr(va_arg(va, const void *));
-			}
-			else
-			{
-				args[iterator] = NULL;
-			}
-		}
+		metacall_varargs_pack(s, ids, size, va, args, storage);
 
 		va_end(va);
 
@@ -642,6 +1067,8 @@ void *metacallht_s(void *handle, const char *name, const enum metacall_value_id
 	{
 		void *args[METACALL_ARGS_SIZE];
 
+		union metacall_varargs_storage storage[METACALL_ARGS_SIZE];
+
 		value ret = NULL;
 
 		signature s = function_signature(f);
@@ -652,78 +1079,250 @@ void *metacallht_s(void *handle, const char *name, const enum metacall_value_id
 
 		va_start(va, size);
 
+		metacall_varargs_pack(s, ids, size, va, args, storage);
+
+		va_end(va);
+
+		ret = function_call(f, args, size);
+
 		for (iterator = 0; iterator < size; ++iterator)
 		{
-			type t = signature_get_type(s, iterator);
+			value_destroy(args[iterator]);
+		}
+
+		return ret;
+	}
+
+	return NULL;
+}
+
+static int metacall_frame_arg(struct metacall_frame *frame, size_t index, const void *data, size_t bytes, type_id id)
+{
+	if (frame == NULL || index >= METACALL_FRAME_ARGS_SIZE)
+	{
+		return 1;
+	}
+
+	frame->args[index] = value_type_create_static(frame->storage[index].data, METACALL_FRAME_STORAGE_SIZE, data, bytes, id);
+
+	if (frame->args[index] == NULL)
+	{
+		return 1;
+	}
+
+	if (index + 1 > frame->size)
+	{
+		frame->size = index + 1;
+	}
+
+	return 0;
+}
+
+int metacall_frame_initialize(struct metacall_frame *frame)
+{
+	if (frame == NULL)
+	{
+		return 1;
+	}
+
+	frame->size = 0;
+
+	memset(frame->args, 0, sizeof(frame->args));
+
+	return 0;
+}
+
+int metacall_frame_bool(struct metacall_frame *frame, size_t index, boolean b)
+{
+	return metacall_frame_arg(frame, index, &b, sizeof(boolean), TYPE_BOOL);
+}
+
+int metacall_frame_char(struct metacall_frame *frame, size_t index, char c)
+{
+	return metacall_frame_arg(frame, index, &c, sizeof(char), TYPE_CHAR);
+}
+
+int metacall_frame_short(struct metacall_frame *frame, size_t index, short s)
+{
+	return metacall_frame_arg(frame, index, &s, sizeof(short), TYPE_SHORT);
+}
+
+int metacall_frame_int(struct metacall_frame *frame, size_t index, int i)
+{
+	return metacall_frame_arg(frame, index, &i, sizeof(int), TYPE_INT);
+}
+
+int metacall_frame_long(struct metacall_frame *frame, size_t index, long l)
+{
+	return metacall_frame_arg(frame, index, &l, sizeof(long), TYPE_LONG);
+}
+
+int metacall_frame_float(struct metacall_frame *frame, size_t index, float f)
+{
+	return metacall_frame_arg(frame, index, &f, sizeof(float), TYPE_FLOAT);
+}
+
+int metacall_frame_double(struct metacall_frame *frame, size_t index, double d)
+{
+	return metacall_frame_arg(frame, index, &d, sizeof(double), TYPE_DOUBLE);
+}
+
+int metacall_frame_ptr(struct metacall_frame *frame, size_t index, const void *ptr)
+{
+	return metacall_frame_arg(frame, index, &ptr, sizeof(const void *), TYPE_PTR);
+}
+
+void *metacallv_frame(const char *name, struct metacall_frame *frame)
+{
+	if (frame == NULL)
+	{
+		return NULL;
+	}
+
+	return metacallv_s(name, frame->args, frame->size);
+}
+
+void *metacallfv_frame(void *func, struct metacall_frame *frame)
+{
+	if (frame == NULL)
+	{
+		return NULL;
+	}
+
+	return metacallfv_s(func, frame->args, frame->size);
+}
+
+void *metacall_callsite_create(const char *name)
+{
+	value f_val = loader_get(name);
+	function f = NULL;
+
+	struct metacall_callsite_type *callsite;
+
+	if (value_type_id(f_val) == TYPE_FUNCTION)
+	{
+		f = value_to_function(f_val);
+	}
+
+	if (f == NULL)
+	{
+		return NULL;
+	}
+
+	callsite = (struct metacall_callsite_type *)malloc(sizeof(struct metacall_callsite_type));
+
+	if (callsite == NULL)
+	{
+		return NULL;
+	}
+
+	if (function_increment_reference(f) != 0)
+	{
+		free(callsite);
+
+		return NULL;
+	}
+
+	callsite->f = f;
+	callsite->s = function_signature(f);
+	callsite->args_count = signature_count(callsite->s);
+
+	memset(callsite->args, 0, sizeof(callsite->args));
+
+	return callsite;
+}
+
+void **metacall_callsite_args(void *callsite)
+{
+	struct metacall_callsite_type *c = (struct metacall_callsite_type *)callsite;
+
+	if (c == NULL)
+	{
+		return NULL;
+	}
+
+	return c->args;
+}
+
+size_t metacall_callsite_size(void *callsite)
+{
+	struct metacall_callsite_type *c = (struct metacall_callsite_type *)callsite;
+
+	if (c == NULL)
+	{
+		return 0;
+	}
 
+	return c->args_count;
+}
+
+void *metacall_callsite_invoke(void *callsite, void *args[])
+{
+	struct metacall_callsite_type *c = (struct metacall_callsite_type *)callsite;
+
+	size_t iterator;
+
+	value ret;
+
+	if (c == NULL)
+	{
+		return NULL;
+	}
+
+	/* The function and signature are already resolved, so the hot path
+	neither hashes the name nor iterates the loader scopes */
+	for (iterator = 0; iterator < c->args_count; ++iterator)
+	{
+		type t = signature_get_type(c->s, iterator);
+
+		if (t != NULL)
+		{
 			type_id id = type_index(t);
 
-			if (t != NULL)
-			{
-				id = type_index(t);
-			}
-			else
+			if (id != value_type_id((value)args[iterator]))
 			{
-				id = ids[iterator];
-			}
+				value cast_arg = value_type_cast((value)args[iterator], id);
 
-			if (id == TYPE_BOOL)
-			{
-				args[iterator] = value_create_bool((boolean)va_arg(va, unsigned int));
-			}
-			if (id == TYPE_CHAR)
-			{
-				args[iterator] = value_create_char((char)va_arg(va, int));
-			}
-			else if (id == TYPE_SHORT)
-			{
-				args[iterator] = value_create_short((short)va_arg(va, int));
-			}
-			else if (id == TYPE_INT)
-			{
-				args[iterator] = value_create_int(va_arg(va, int));
-			}
-			else if (id == TYPE_LONG)
-			{
-				args[iterator] = value_create_long(va_arg(va, long));
-			}
-			else if (id == TYPE_FLOAT)
-			{
-				args[iterator] = value_create_float((float)va_arg(va, double));
-			}
-			else if (id == TYPE_DOUBLE)
-			{
-				args[iterator] = value_create_double(va_arg(va, double));
+				if (cast_arg != NULL)
+				{
+					args[iterator] = cast_arg;
+				}
 			}
-			else if (id == TYPE_STRING)
-			{
-				const char *str = va_arg(va, const char *);
+		}
+	}
 
-				args[iterator] = value_create_string(str, strlen(str));
-			}
-			else if (id == TYPE_PTR)
-			{
-				args[iterator] = value_create_ptr(va_arg(va, const void *));
-			}
-			else
+	ret = function_call(c->f, args, c->args_count);
+
+	if (ret != NULL)
+	{
+		type t = signature_get_return(c->s);
+
+		if (t != NULL)
+		{
+			type_id id = type_index(t);
+
+			if (id != value_type_id(ret))
 			{
-				args[iterator] = NULL;
+				value cast_ret = value_type_cast(ret, id);
+
+				return (cast_ret == NULL) ? ret : cast_ret;
 			}
 		}
+	}
 
-		va_end(va);
+	return ret;
+}
 
-		ret = function_call(f, args, size);
+void metacall_callsite_destroy(void *callsite)
+{
+	struct metacall_callsite_type *c = (struct metacall_callsite_type *)callsite;
 
-		for (iterator = 0; iterator < size; ++iterator)
-		{
-			value_destroy(args[iterator]);
-		}
+	if (c != NULL)
+	{
+		function_decrement_reference(c->f);
 
-		return ret;
+		free(c);
 	}
-
-	return NULL;
 }
 
 void *metacall_function(const char *name)
@@ -733,10 +1332,27 @@ void *metacall_function(const char *name)
 
 	if (value_type_id(f_val) == TYPE_FUNCTION)
 	{
-		f = value_to_function(f_val);
+		f = value_to_function(f_val);
+	}
+
+	return f;
+}
+
+void *metacall_function_pointer(void *func, size_t *generation)
+{
+	if (func == NULL)
+	{
+		return NULL;
+	}
+
+	/* Snapshot the generation before resolving so the caller never
+	holds an address newer than the generation it revalidates with */
+	if (generation != NULL)
+	{
+		*generation = metacall_function_generation();
 	}
 
-	return f;
+	return loader_function_pointer((function)func);
 }
 
 void *metacall_handle_function(void *handle, const char *name)
@@ -866,6 +1482,10 @@ void *metacallfv_s(void *func, void *args[], size_t size)
 
 		value ret;
 
+		void *host_data;
+
+		loader_register_invoke host_invoke;
+
 		for (iterator = 0; iterator < size; ++iterator)
 		{
 			type t = signature_get_type(s, iterator);
@@ -886,7 +1506,18 @@ void *metacallfv_s(void *func, void *args[], size_t size)
 			}
 		}
 
-		ret = function_call(f, args, size);
+		/* Host functions registered through metacall_register dispatch
+		straight to the registered pointer, skipping the proxy marshaling */
+		host_invoke = loader_register_function_invoke(f, &host_data);
+
+		if (host_invoke != NULL)
+		{
+			ret = host_invoke(size, args, host_data);
+		}
+		else
+		{
+			ret = function_call(f, args, size);
+		}
 
 		if (ret != NULL)
 		{
@@ -911,74 +1542,165 @@ void *metacallfv_s(void *func, void *args[], size_t size)
 	return NULL;
 }
 
-void *metacallf(void *func, ...)
+/**
+*  @brief
+*    Check if a call of shape @args can specialize against @f, only
+*    cast free shapes qualify so the specialized dispatch can skip
+*    the per argument type checking without changing behavior
+*
+*  @param[in] f
+*    Reference to the function of the site
+*
+*  @param[in] args
+*    Array of pointers to values
+*
+*  @param[in] size
+*    Number of function arguments
+*
+*  @return
+*    One when the site can specialize, zero otherwise
+*/
+static int metacall_site_specializable(function f, void *args[], size_t size)
 {
-	function f = (function)func;
+	signature s = function_signature(f);
 
-	if (f != NULL)
+	size_t iterator;
+
+	if (signature_count(s) != size)
 	{
-		void *args[METACALL_ARGS_SIZE];
+		return 0;
+	}
 
-		value ret = NULL;
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		type t = signature_get_type(s, iterator);
 
-		signature s = function_signature(f);
+		if (t != NULL && type_index(t) != value_type_id((value)args[iterator]))
+		{
+			return 0;
+		}
+	}
 
-		size_t iterator, args_count = signature_count(s);
+	return 1;
+}
 
-		va_list va;
+void *metacall_site_invoke(struct metacall_site_type *site, const char *name, void *args[], size_t size)
+{
+	size_t shape, iterator;
 
-		va_start(va, func);
+	function f;
 
-		for (iterator = 0; iterator < args_count; ++iterator)
+	if (site == NULL)
+	{
+		return metacallv_s(name, args, size);
+	}
+
+	/* Fold the argument count and type ids into the shape of the call */
+	shape = size;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		shape = (shape << 5) + shape + (size_t)value_type_id((value)args[iterator]);
+	}
+
+	if (site->func != NULL && site->shape == shape && site->generation == metacall_function_generation())
+	{
+		f = (function)site->func;
+
+		if (site->specialized != 0)
 		{
-			type t = signature_get_type(s, iterator);
+			void *host_data;
 
-			type_id id = type_index(t);
+			loader_register_invoke host_invoke = loader_register_function_invoke(f, &host_data);
 
-			if (id == TYPE_BOOL)
-			{
-				args[iterator] = value_create_bool((boolean)va_arg(va, unsigned int));
-			}
-			if (id == TYPE_CHAR)
-			{
-				args[iterator] = value_create_char((char)va_arg(va, int));
-			}
-			else if (id == TYPE_SHORT)
-			{
-				args[iterator] = value_create_short((short)va_arg(va, int));
-			}
-			else if (id == TYPE_INT)
-			{
-				args[iterator] = value_create_int(va_arg(va, int));
-			}
-			else if (id == TYPE_LONG)
-			{
-				args[iterator] = value_create_long(va_arg(va, long));
-			}
-			else if (id == TYPE_FLOAT)
+			value ret;
+
+			if (host_invoke != NULL)
 			{
-				args[iterator] = value_create_float((float)va_arg(va, double));
+				ret = host_invoke(size, args, host_data);
 			}
-			else if (id == TYPE_DOUBLE)
+			else
 			{
-				args[iterator] = value_create_double(va_arg(va, double));
+				ret = function_call(f, args, size);
 			}
-			else if (id == TYPE_STRING)
-			{
-				const char *str = va_arg(va, const char *);
 
-				args[iterator] = value_create_string(str, strlen(str));
-			}
-			else if (id == TYPE_PTR)
+			/* The return cast of the generic path is kept, it is two
+			predictable branches on the monomorphic steady state */
+			if (ret != NULL)
 			{
-				args[iterator] = value_create_ptr(va_arg(va, const void *));
+				type t = signature_get_return(function_signature(f));
+
+				if (t != NULL)
+				{
+					type_id id = type_index(t);
+
+					if (id != value_type_id(ret))
+					{
+						value cast_ret = value_type_cast(ret, id);
+
+						return (cast_ret == NULL) ? ret : cast_ret;
+					}
+				}
 			}
-			else
+
+			return ret;
+		}
+
+		/* Warm up, specialize after enough identical cast free calls */
+		if (++site->count >= METACALL_SITE_THRESHOLD)
+		{
+			site->specialized = metacall_site_specializable(f, args, size);
+
+			/* Shapes that need casting never specialize, reset so the
+			signature is not re-evaluated on every call */
+			if (site->specialized == 0)
 			{
-				args[iterator] = NULL;
+				site->count = 0;
 			}
 		}
 
+		return metacallfv_s(f, args, size);
+	}
+
+	/* Generic path, (re)bind the site to the resolved function */
+	f = (function)metacall_function(name);
+
+	if (f == NULL)
+	{
+		return NULL;
+	}
+
+	site->func = f;
+	site->generation = metacall_function_generation();
+	site->shape = shape;
+	site->count = 1;
+	site->specialized = 0;
+
+	return metacallfv_s(f, args, size);
+}
+
+void *metacallf(void *func, ...)
+{
+	function f = (function)func;
+
+	if (f != NULL)
+	{
+		void *args[METACALL_ARGS_SIZE];
+
+		union metacall_varargs_storage storage[METACALL_ARGS_SIZE];
+
+		value ret = NULL;
+
+		signature s = function_signature(f);
+
+		size_t iterator, args_count = signature_count(s);
+
+		va_list va;
+
+		va_start(va, func);
+
+		metacall_varargs_pack(s, NULL, args_count, va, args, storage);
+
 		va_end(va);
 
 		ret = function_call(f, args, args_count);
@@ -1090,6 +1812,95 @@ void *metacallfs(void *func, const char *buffer, size_t size, void *allocator)
 	return NULL;
 }
 
+size_t metacall_function_index(void *func, const char *name)
+{
+	function f = (function)func;
+
+	if (f != NULL && name != NULL)
+	{
+		signature s = function_signature(f);
+
+		return signature_get_index(s, name);
+	}
+
+	return METACALL_INVALID_INDEX;
+}
+
+void *metacallfiv(void *func, const size_t indices[], void *values[], size_t size)
+{
+	function f = (function)func;
+
+	if (f != NULL)
+	{
+		void *args[METACALL_ARGS_SIZE];
+
+		signature s = function_signature(f);
+
+		size_t iterator, args_count = signature_count(s);
+
+		value ret;
+
+		if (size != args_count)
+		{
+			return NULL;
+		}
+
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			size_t index = indices[iterator];
+
+			type t;
+
+			if (index >= args_count)
+			{
+				return NULL;
+			}
+
+			t = signature_get_type(s, index);
+
+			if (t != NULL)
+			{
+				type_id id = type_index(t);
+
+				if (id != value_type_id((value)values[iterator]))
+				{
+					value cast_arg = value_type_cast((value)values[iterator], id);
+
+					if (cast_arg != NULL)
+					{
+						values[iterator] = cast_arg;
+					}
+				}
+			}
+
+			args[index] = values[iterator];
+		}
+
+		ret = function_call(f, args, args_count);
+
+		if (ret != NULL)
+		{
+			type t = signature_get_return(s);
+
+			if (t != NULL)
+			{
+				type_id id = type_index(t);
+
+				if (id != value_type_id(ret))
+				{
+					value cast_ret = value_type_cast(ret, id);
+
+					return (cast_ret == NULL) ? ret : cast_ret;
+				}
+			}
+		}
+
+		return ret;
+	}
+
+	return NULL;
+}
+
 void *metacallfmv(void *func, void *keys[], void *values[])
 {
 	function f = (function)func;
@@ -1269,43 +2080,132 @@ void *metacallfms(void *func, const char *buffer, size_t size, void *allocator)
 				values[iterator] = v_element[1];
 			}
 
-			ret = metacallfmv(f, keys, values);
+			ret = metacallfmv(f, keys, values);
+
+			if (ret != NULL)
+			{
+				type t = signature_get_return(s);
+
+				if (t != NULL)
+				{
+					type_id id = type_index(t);
+
+					if (id != value_type_id(ret))
+					{
+						value cast_ret = value_type_cast(ret, id);
+
+						if (cast_ret != NULL)
+						{
+							ret = cast_ret;
+						}
+					}
+				}
+			}
+
+			for (iterator = 0; iterator < args_count; ++iterator)
+			{
+				/* Due to casting, destroy must be done to arrays instead of to the map */
+				value_destroy(keys[iterator]);
+				value_destroy(values[iterator]);
+				value_destroy(v_map[iterator]);
+			}
+
+			value_destroy(v);
+
+			return ret;
+		}
+	}
+
+	return NULL;
+}
+
+void metacall_stats_enable(int enable)
+{
+	function_stats_enable(enable);
+}
+
+int metacall_stats(const char *name, struct metacall_stats_type *stats)
+{
+	function f = (function)metacall_function(name);
+
+	struct function_stats_type function_stats_data;
+
+	if (f == NULL || stats == NULL)
+	{
+		return 1;
+	}
+
+	if (function_stats(f, &function_stats_data) != 0)
+	{
+		return 1;
+	}
+
+	stats->call_count = function_stats_data.count;
+	stats->total_time = function_stats_data.total_time;
+
+	memcpy(stats->latency_histogram, function_stats_data.histogram, sizeof(stats->latency_histogram));
+
+	return 0;
+}
+
+int metacall_stats_clear(const char *name)
+{
+	function f = (function)metacall_function(name);
+
+	if (f == NULL)
+	{
+		return 1;
+	}
+
+	function_stats_clear(f);
+
+	return 0;
+}
+
+int metacall_gc_collect(const char *tag)
+{
+	return loader_gc_collect(tag);
+}
+
+int metacall_gc_defer(const char *tag)
+{
+	return loader_gc_hint(tag, 1);
+}
 
-			if (ret != NULL)
-			{
-				type t = signature_get_return(s);
+int metacall_gc_allow(const char *tag)
+{
+	return loader_gc_hint(tag, 0);
+}
 
-				if (t != NULL)
-				{
-					type_id id = type_index(t);
+int metacall_gc_stats(const char *tag, struct metacall_gc_stats_type *stats)
+{
+	struct loader_impl_gc_stats_type gc_stats;
 
-					if (id != value_type_id(ret))
-					{
-						value cast_ret = value_type_cast(ret, id);
+	if (stats == NULL)
+	{
+		return 1;
+	}
 
-						if (cast_ret != NULL)
-						{
-							ret = cast_ret;
-						}
-					}
-				}
-			}
+	if (loader_gc_stats(tag, &gc_stats) != 0)
+	{
+		return 1;
+	}
 
-			for (iterator = 0; iterator < args_count; ++iterator)
-			{
-				/* Due to casting, destroy must be done to arrays instead of to the map */
-				value_destroy(keys[iterator]);
-				value_destroy(values[iterator]);
-				value_destroy(v_map[iterator]);
-			}
+	stats->heap_size = gc_stats.heap_size;
 
-			value_destroy(v);
+	stats->collection_count = gc_stats.collection_count;
 
-			return ret;
-		}
-	}
+	return 0;
+}
 
-	return NULL;
+int metacall_watchdog_enable(uint64_t threshold_ms)
+{
+	return function_watchdog_initialize(threshold_ms * 1000000ULL);
+}
+
+void metacall_watchdog_disable(void)
+{
+	function_watchdog_destroy();
 }
 
 int metacall_register(const char *name, void *(*invoke)(size_t, void *[], void *), void **func, enum metacall_value_id return_type, size_t size, ...)
@@ -1359,6 +2259,46 @@ void *metacall_await_future(void *f, void *(*resolve_callback)(void *, void *),
 	return NULL;
 }
 
+int metacall_await_all(void *futures[], size_t size, void *results[])
+{
+	return future_await_all((future *)futures, size, (future_return *)results);
+}
+
+int metacall_await_any(void *futures[], size_t size, size_t *index, void **result)
+{
+	return future_await_any((future *)futures, size, index, (future_return *)result);
+}
+
+void *metacall_stream_next(void *v)
+{
+	if (v == NULL || value_type_id(v) != TYPE_STREAM)
+	{
+		return NULL;
+	}
+
+	return stream_next(value_to_stream(v));
+}
+
+size_t metacall_stream_next_batch(void *v, void *values[], size_t size)
+{
+	if (v == NULL || value_type_id(v) != TYPE_STREAM)
+	{
+		return 0;
+	}
+
+	return stream_next_batch(value_to_stream(v), (value *)values, size);
+}
+
+int metacall_stream_end(void *v)
+{
+	if (v == NULL || value_type_id(v) != TYPE_STREAM)
+	{
+		return 1;
+	}
+
+	return stream_end(value_to_stream(v));
+}
+
 void *metacall_await_s(const char *name, void *args[], size_t size, void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data)
 {
 	value f_val = loader_get(name);
@@ -1781,11 +2721,49 @@ int metacall_object_set(void *obj, const char *key, void *v)
 	return object_set(obj, key, v);
 }
 
+void *metacall_object_method(void *obj, const char *name)
+{
+	return object_method_resolve(obj, name);
+}
+
+void *metacallv_object_method(void *method, void *args[], size_t argc)
+{
+	return object_method_call(method, args, argc);
+}
+
+void metacall_object_method_destroy(void *method)
+{
+	object_method_destroy(method);
+}
+
+void *metacall_object_attribute(void *obj, const char *key)
+{
+	return object_attribute_resolve(obj, key);
+}
+
+void *metacall_object_attribute_get(void *attr)
+{
+	return object_attribute_get(attr);
+}
+
+int metacall_object_attribute_set(void *attr, void *v)
+{
+	return object_attribute_set(attr, v);
+}
+
+void metacall_object_attribute_destroy(void *attr)
+{
+	object_attribute_destroy(attr);
+}
+
 char *metacall_inspect(size_t *size, void *allocator)
 {
 	serial s;
 
-	value v = loader_metadata();
+	/* The metadata tree is cached by the loader and only rebuilt
+	after loading, clearing or registering functions, so steady
+	state inspection is a plain serialization */
+	value v = loader_metadata_cached();
 
 	char *str;
 
@@ -1799,6 +2777,42 @@ char *metacall_inspect(size_t *size, void *allocator)
 
 			return NULL;
 		}
+
+		s = serial_create(metacall_serial());
+
+		str = serial_serialize(s, v, size, allocator);
+
+		value_type_destroy(v);
+
+		return str;
+	}
+
+	s = serial_create(metacall_serial());
+
+	return serial_serialize(s, v, size, allocator);
+}
+
+char *metacall_inspect_query(const char *tag, const char *handle_name, const char *name_prefix, size_t *size, void *allocator)
+{
+	serial s;
+
+	/* Partial inspects build only the requested subtree, they bypass
+	the full tree metadata cache so the filtered result is built,
+	serialized and destroyed in one shot */
+	value v = loader_metadata_filter(tag, handle_name, name_prefix);
+
+	char *str;
+
+	if (v == NULL)
+	{
+		v = value_create_map(NULL, 0);
+
+		if (v == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid MetaCall inspect query map creation");
+
+			return NULL;
+		}
 	}
 
 	s = serial_create(metacall_serial());
@@ -1817,6 +2831,82 @@ char *metacall_serialize(const char *name, void *v, size_t *size, void *allocato
 	return serial_serialize(s, (value)v, size, (memory_allocator)allocator);
 }
 
+void *metacall_serialize_buffer_create(void *allocator)
+{
+	serial_buffer buffer = malloc(sizeof(struct serial_buffer_type));
+
+	if (buffer == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid MetaCall serialize buffer allocation");
+
+		return NULL;
+	}
+
+	serial_buffer_initialize(buffer, (memory_allocator)allocator);
+
+	return buffer;
+}
+
+int metacall_serialize_buffer(const char *name, void *v, void *buffer)
+{
+	serial s = serial_create(name);
+
+	return serial_serialize_into(s, (value)v, (serial_buffer)buffer);
+}
+
+int metacall_inspect_buffer(void *buffer)
+{
+	serial s;
+
+	value v = loader_metadata_cached();
+
+	int result;
+
+	if (v == NULL)
+	{
+		v = value_create_map(NULL, 0);
+
+		if (v == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid MetaCall inspect map creation");
+
+			return 1;
+		}
+
+		s = serial_create(metacall_serial());
+
+		result = serial_serialize_into(s, v, (serial_buffer)buffer);
+
+		value_type_destroy(v);
+
+		return result;
+	}
+
+	s = serial_create(metacall_serial());
+
+	return serial_serialize_into(s, v, (serial_buffer)buffer);
+}
+
+char *metacall_serialize_buffer_data(void *buffer)
+{
+	return ((serial_buffer)buffer)->data;
+}
+
+size_t metacall_serialize_buffer_size(void *buffer)
+{
+	return ((serial_buffer)buffer)->size;
+}
+
+void metacall_serialize_buffer_destroy(void *buffer)
+{
+	if (buffer != NULL)
+	{
+		serial_buffer_destroy((serial_buffer)buffer);
+
+		free(buffer);
+	}
+}
+
 void *metacall_deserialize(const char *name, const char *buffer, size_t size, void *allocator)
 {
 	serial s = serial_create(name);
@@ -1826,13 +2916,57 @@ void *metacall_deserialize(const char *name, const char *buffer, size_t size, vo
 
 int metacall_clear(void *handle)
 {
-	return loader_clear(handle);
+	int result = loader_clear(handle);
+
+	if (result == 0)
+	{
+		metacall_generation_bump();
+	}
+
+	return result;
+}
+
+int metacall_reload(void *handle)
+{
+	int result = loader_reload(handle);
+
+	if (result == 0)
+	{
+		metacall_generation_bump();
+	}
+
+	return result;
+}
+
+size_t metacall_function_generation(void)
+{
+	return threading_atomic_load(&metacall_function_generation_count);
 }
 
-int metacall_destroy()
+int metacall_function_generation_register(metacall_generation_invalidate_cb callback, void *data)
+{
+	if (callback == NULL || metacall_generation_callbacks_count >= METACALL_GENERATION_CALLBACKS_SIZE)
+	{
+		return 1;
+	}
+
+	metacall_generation_callbacks[metacall_generation_callbacks_count].callback = callback;
+	metacall_generation_callbacks[metacall_generation_callbacks_count].data = data;
+
+	++metacall_generation_callbacks_count;
+
+	return 0;
+}
+
+static int metacall_destroy_impl(void)
 {
 	if (metacall_initialize_flag == 0)
 	{
+		/* Stop the await executor before unloading so no task touches a dying runtime */
+		function_watchdog_destroy();
+
+		function_await_executor_destroy();
+
 		if (loader_unload() != 0)
 		{
 			return 1;
@@ -1840,12 +2974,102 @@ int metacall_destroy()
 
 		configuration_destroy();
 
+		/* The string pool references slab allocated values, it must let
+		go of them before the slabs are reclaimed */
+		value_string_pool_clear();
+
+		value_pool_clear();
+
+		string_intern_clear();
+
+		metacall_generation_bump();
+
 		metacall_initialize_flag = 1;
 	}
 
 	return 0;
 }
 
+#if defined(_WIN32)
+static DWORD WINAPI metacall_destroy_async_thread(LPVOID data)
+#else
+static void *metacall_destroy_async_thread(void *data)
+#endif
+{
+	(void)data;
+
+	/* Take ownership of the loaders so they can be torn down here */
+	loader_initialization_adopt();
+
+	metacall_destroy_async_state.result = metacall_destroy_impl();
+
+#if defined(_WIN32)
+	return 0;
+#else
+	return NULL;
+#endif
+}
+
+int metacall_destroy()
+{
+	/* Join a background destruction if one is in flight, so mixing
+	both entry points never tears down twice */
+	int result = metacall_destroy_await();
+
+	if (result != 0)
+	{
+		return result;
+	}
+
+	return metacall_destroy_impl();
+}
+
+int metacall_destroy_async()
+{
+	if (metacall_initialize_flag != 0 || metacall_destroy_async_state.active != 0)
+	{
+		return 1;
+	}
+
+#if defined(_WIN32)
+	metacall_destroy_async_state.thread = CreateThread(NULL, 0, &metacall_destroy_async_thread, NULL, 0, NULL);
+
+	if (metacall_destroy_async_state.thread == NULL)
+	{
+		return 1;
+	}
+#else
+	if (pthread_create(&metacall_destroy_async_state.thread, NULL, &metacall_destroy_async_thread, NULL) != 0)
+	{
+		return 1;
+	}
+#endif
+
+	metacall_destroy_async_state.active = 1;
+
+	return 0;
+}
+
+int metacall_destroy_await()
+{
+	if (metacall_destroy_async_state.active == 0)
+	{
+		return 0;
+	}
+
+#if defined(_WIN32)
+	WaitForSingleObject(metacall_destroy_async_state.thread, INFINITE);
+
+	CloseHandle(metacall_destroy_async_state.thread);
+#else
+	pthread_join(metacall_destroy_async_state.thread, NULL);
+#endif
+
+	metacall_destroy_async_state.active = 0;
+
+	return metacall_destroy_async_state.result;
+}
+
 const char *metacall_print_info()
 {
 	static const char metacall_info[] =
@@ -24,6 +24,15 @@
 
 #include <memory/memory.h>
 
+#include <reflect/reflect_value.h>
+
+/* -- Private Methods -- */
+
+static void *metacall_allocator_bind_alloc(void *ctx, size_t size)
+{
+	return memory_allocator_allocate((memory_allocator)ctx, size);
+}
+
 /* -- Methods -- */
 
 void *metacall_allocator_create(enum metacall_allocator_id allocator_id, void *ctx)
@@ -64,6 +73,21 @@ void metacall_allocator_free(void *allocator, void *data)
 	memory_allocator_deallocate((memory_allocator)allocator, data);
 }
 
+int metacall_allocator_bind(void *allocator)
+{
+	if (allocator == NULL)
+	{
+		return 1;
+	}
+
+	return value_alloc_bind(&metacall_allocator_bind_alloc, allocator);
+}
+
+void metacall_allocator_unbind(void)
+{
+	value_alloc_bind(NULL, NULL);
+}
+
 void metacall_allocator_destroy(void *allocator)
 {
 	memory_allocator_destroy((memory_allocator)allocator);
@@ -13,6 +13,8 @@
 
 #include <detour/detour.h>
 
+#include <loader/loader_fork.h>
+
 #include <log/log.h>
 
 #include <stdlib.h>
@@ -238,6 +240,51 @@ pid_t metacall_fork_hook()
 		}
 	}
 
+	/* Runtimes that registered fork coordination survive the fork in
+	place: quiesce them, fork through the trampoline and repair their
+	event loops in the child (the node loader does it through
+	uv_loop_fork), keeping the warm state instead of tearing every
+	loader down and rebooting it */
+	if (loader_fork_count() > 0)
+	{
+		if (loader_fork_prepare() != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "MetaCall fork loader preparation");
+		}
+
+		/* Execute the real fork */
+		pid = metacall_fork_trampoline();
+
+		if (pid == 0)
+		{
+			if (loader_fork_child() != 0)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "MetaCall fork loader child resume");
+			}
+		}
+		else
+		{
+			if (loader_fork_parent() != 0)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "MetaCall fork loader parent resume");
+			}
+		}
+
+		/* Execute post fork callback */
+		if (post_callback != NULL)
+		{
+			log_write("metacall", LOG_LEVEL_DEBUG, "MetaCall process post fork callback execution");
+
+			/* TODO: Context */
+			if (post_callback(pid, NULL) != 0)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "MetaCall invalid detour post callback invocation");
+			}
+		}
+
+		return pid;
+	}
+
 	log_write("metacall", LOG_LEVEL_DEBUG, "MetaCall process fork auto destroy");
 
 	/* Destroy metacall before the fork */
@@ -325,12 +372,41 @@ int metacall_fork_initialize()
 
 	if (metacall_detour_handle == NULL)
 	{
-		metacall_detour_handle = detour_install(metacall_detour, (void (*)(void))fork_func, (void (*)(void)) & metacall_fork_hook);
+		/* Install through the transactional API so any hook added here
+		later shares a single protection and cache flush cycle */
+		void (*fork_target)(void) = (void (*)(void))fork_func;
+
+		metacall_detour_handle = detour_transaction_begin(metacall_detour);
 
 		if (metacall_detour_handle == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "MetaCall invalid detour transaction");
+
+			metacall_fork_destroy();
+
+			return 1;
+		}
+
+		if (detour_transaction_queue(metacall_detour, metacall_detour_handle, &fork_target, (void (*)(void)) & metacall_fork_hook) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "MetaCall invalid detour queueing");
+
+			detour_transaction_rollback(metacall_detour, metacall_detour_handle);
+
+			metacall_detour_handle = NULL;
+
+			metacall_fork_destroy();
+
+			return 1;
+		}
+
+		if (detour_transaction_commit(metacall_detour, metacall_detour_handle) != 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "MetaCall invalid detour installation");
 
+			/* Commit failure already destroyed the handle */
+			metacall_detour_handle = NULL;
+
 			metacall_fork_destroy();
 
 			return 1;
@@ -351,6 +427,100 @@ void metacall_fork(metacall_pre_fork_callback_ptr pre_callback, metacall_post_fo
 {
 	metacall_pre_fork_callback = pre_callback;
 	metacall_post_fork_callback = post_callback;
+
+	/* Setting a callback is an implicit opt-in, install the detours
+	lazily so processes that never touch the fork API keep running on
+	unpatched code */
+	if ((pre_callback != NULL || post_callback != NULL) && metacall_detour_handle == NULL)
+	{
+		if (metacall_fork_initialize() != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "MetaCall lazy fork initialization");
+		}
+	}
+}
+
+int metacall_fork_callback_register(metacall_fork_prepare_callback_ptr prepare, metacall_fork_parent_callback_ptr parent, metacall_fork_child_callback_ptr child, void *data)
+{
+	/* Registration flows through the loader fork registry, which
+	triggers the lazy detour installation on its first participant */
+	return loader_fork_register(prepare, parent, child, data);
+}
+
+int metacall_fork_callback_unregister(void *data)
+{
+	return loader_fork_unregister(data);
+}
+
+int metacall_fork_zygote(metacall_zygote_worker_callback_ptr worker_callback, void *context)
+{
+#if defined(unix) || defined(__unix__) || defined(__unix) ||                            \
+	defined(linux) || defined(__linux__) || defined(__linux) || defined(__gnu_linux) || \
+	defined(__CYGWIN__) || defined(__CYGWIN32__) ||                                     \
+	(defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+
+	pid_t (*fork_trampoline)(void);
+
+	pid_t pid;
+
+	if (worker_callback == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "MetaCall invalid zygote worker callback");
+
+		return -1;
+	}
+
+	/* Fork through the trampoline so the hook does not tear down and
+	reboot the runtimes, the worker inherits the warm state of the
+	parent via copy-on-write */
+	if (metacall_detour_handle != NULL)
+	{
+		fork_trampoline = (pid_t(*)(void))detour_trampoline(metacall_detour_handle);
+	}
+	else
+	{
+		fork_trampoline = &fork;
+	}
+
+	/* Quiesce fork aware runtimes so the worker inherits a consistent
+	snapshot and can repair their event loops before running */
+	if (loader_fork_prepare() != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "MetaCall zygote loader preparation");
+	}
+
+	pid = fork_trampoline();
+
+	if (pid == 0)
+	{
+		if (loader_fork_child() != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "MetaCall zygote loader child resume");
+		}
+
+		/* Worker process, the callback return value is the exit code */
+		_exit(worker_callback(context));
+	}
+
+	if (loader_fork_parent() != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "MetaCall zygote loader parent resume");
+	}
+
+	if (pid < 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "MetaCall zygote fork failed");
+	}
+
+	return (int)pid;
+#else
+	(void)worker_callback;
+	(void)context;
+
+	log_write("metacall", LOG_LEVEL_ERROR, "MetaCall zygote mode requires a platform with fork");
+
+	return -1;
+#endif
 }
 
 int metacall_fork_destroy()
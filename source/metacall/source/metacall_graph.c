@@ -0,0 +1,704 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <metacall/metacall_graph.h>
+
+#include <reflect/reflect_function.h>
+#include <reflect/reflect_value_type.h>
+
+#include <adt/adt_vector.h>
+
+#include <threading/threading_event.h>
+#include <threading/threading_mutex.h>
+
+#include <log/log.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+#define METACALL_GRAPH_NODE_IDLE 0
+#define METACALL_GRAPH_NODE_RUNNING 1
+#define METACALL_GRAPH_NODE_DONE 2
+#define METACALL_GRAPH_NODE_FAILED 3
+
+/* -- Member Data -- */
+
+struct metacall_graph_type;
+
+struct metacall_graph_node_type
+{
+	char *label;
+	function func;
+	vector args;	/* Bound values, owned by the graph */
+	vector deps;	/* Indexes of the dependency nodes in edge order */
+	size_t pending; /* Dependencies not yet completed during execution */
+	value result;	/* Owned by the graph, dropped on re-execution */
+	int state;
+};
+
+struct metacall_graph_await_type
+{
+	struct metacall_graph_type *g;
+	size_t index;
+};
+
+struct metacall_graph_type
+{
+	vector nodes; /* struct metacall_graph_node_type */
+
+	/* Execution state, the mutex guards the completion queue shared
+	with the await callbacks and the event wakes the scheduler */
+	threading_mutex mutex;
+	struct threading_event_type event;
+	vector completed; /* Node indexes completed asynchronously */
+	size_t outstanding;
+	int failed;
+};
+
+/* -- Private Methods -- */
+
+static struct metacall_graph_node_type *metacall_graph_find(struct metacall_graph_type *g, const char *label, size_t *index)
+{
+	size_t iterator, size = vector_size(g->nodes);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct metacall_graph_node_type *node = vector_at(g->nodes, iterator);
+
+		if (strcmp(node->label, label) == 0)
+		{
+			if (index != NULL)
+			{
+				*index = iterator;
+			}
+
+			return node;
+		}
+	}
+
+	return NULL;
+}
+
+static value metacall_graph_resolve(value v, void *data)
+{
+	struct metacall_graph_await_type *await = data;
+
+	struct metacall_graph_type *g = await->g;
+
+	struct metacall_graph_node_type *node = vector_at(g->nodes, await->index);
+
+	threading_mutex_lock(g->mutex);
+
+	/* The loader owns @v, the node keeps its own reference */
+	node->result = (v != NULL) ? value_type_copy(v) : NULL;
+
+	node->state = METACALL_GRAPH_NODE_DONE;
+
+	vector_push_back(g->completed, &await->index);
+
+	threading_mutex_unlock(g->mutex);
+
+	threading_event_signal(&g->event);
+
+	return NULL;
+}
+
+static value metacall_graph_reject(value v, void *data)
+{
+	struct metacall_graph_await_type *await = data;
+
+	struct metacall_graph_type *g = await->g;
+
+	struct metacall_graph_node_type *node = vector_at(g->nodes, await->index);
+
+	(void)v;
+
+	log_write("metacall", LOG_LEVEL_ERROR, "Graph node (%s) rejected", node->label);
+
+	threading_mutex_lock(g->mutex);
+
+	node->state = METACALL_GRAPH_NODE_FAILED;
+
+	g->failed = 1;
+
+	vector_push_back(g->completed, &await->index);
+
+	threading_mutex_unlock(g->mutex);
+
+	threading_event_signal(&g->event);
+
+	return NULL;
+}
+
+static void metacall_graph_node_clear(struct metacall_graph_node_type *node)
+{
+	if (node->result != NULL)
+	{
+		value_type_destroy(node->result);
+
+		node->result = NULL;
+	}
+
+	node->state = METACALL_GRAPH_NODE_IDLE;
+
+	node->pending = vector_size(node->deps);
+}
+
+/* Mark the dependents of @index ready when their last dependency
+completed, must run with the completion state consistent */
+static void metacall_graph_ready_dependents(struct metacall_graph_type *g, size_t index, vector ready)
+{
+	size_t iterator, size = vector_size(g->nodes);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct metacall_graph_node_type *node = vector_at(g->nodes, iterator);
+
+		size_t dep_iterator, deps_size = vector_size(node->deps);
+
+		for (dep_iterator = 0; dep_iterator < deps_size; ++dep_iterator)
+		{
+			if (*(size_t *)vector_at(node->deps, dep_iterator) == index)
+			{
+				--node->pending;
+
+				if (node->pending == 0)
+				{
+					vector_push_back(ready, &iterator);
+				}
+			}
+		}
+	}
+}
+
+/* -- Methods -- */
+
+void *metacall_graph_create(void)
+{
+	struct metacall_graph_type *g = malloc(sizeof(struct metacall_graph_type));
+
+	if (g == NULL)
+	{
+		return NULL;
+	}
+
+	g->nodes = vector_create(sizeof(struct metacall_graph_node_type));
+
+	if (g->nodes == NULL)
+	{
+		free(g);
+
+		return NULL;
+	}
+
+	g->completed = vector_create(sizeof(size_t));
+
+	if (g->completed == NULL)
+	{
+		vector_destroy(g->nodes);
+
+		free(g);
+
+		return NULL;
+	}
+
+	g->mutex = threading_mutex_create();
+
+	if (g->mutex == NULL)
+	{
+		vector_destroy(g->completed);
+
+		vector_destroy(g->nodes);
+
+		free(g);
+
+		return NULL;
+	}
+
+	g->outstanding = 0;
+
+	g->failed = 0;
+
+	return g;
+}
+
+int metacall_graph_node(void *graph, const char *label, void *func)
+{
+	struct metacall_graph_type *g = graph;
+
+	struct metacall_graph_node_type node;
+
+	size_t label_size;
+
+	if (g == NULL || label == NULL || func == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid graph node parameters");
+
+		return 1;
+	}
+
+	if (metacall_graph_find(g, label, NULL) != NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Graph node (%s) already declared", label);
+
+		return 1;
+	}
+
+	label_size = strlen(label) + 1;
+
+	node.label = malloc(sizeof(char) * label_size);
+
+	if (node.label == NULL)
+	{
+		return 1;
+	}
+
+	memcpy(node.label, label, label_size);
+
+	node.args = vector_create(sizeof(value));
+
+	if (node.args == NULL)
+	{
+		free(node.label);
+
+		return 1;
+	}
+
+	node.deps = vector_create(sizeof(size_t));
+
+	if (node.deps == NULL)
+	{
+		vector_destroy(node.args);
+
+		free(node.label);
+
+		return 1;
+	}
+
+	node.func = func;
+
+	node.pending = 0;
+
+	node.result = NULL;
+
+	node.state = METACALL_GRAPH_NODE_IDLE;
+
+	/* The graph keeps the function alive while it references it */
+	function_increment_reference(node.func);
+
+	vector_push_back(g->nodes, &node);
+
+	return 0;
+}
+
+int metacall_graph_node_arg(void *graph, const char *label, void *v)
+{
+	struct metacall_graph_type *g = graph;
+
+	struct metacall_graph_node_type *node;
+
+	if (g == NULL || label == NULL || v == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid graph node argument parameters");
+
+		return 1;
+	}
+
+	node = metacall_graph_find(g, label, NULL);
+
+	if (node == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Graph node (%s) not declared", label);
+
+		return 1;
+	}
+
+	vector_push_back(node->args, &v);
+
+	return 0;
+}
+
+int metacall_graph_edge(void *graph, const char *src, const char *dst)
+{
+	struct metacall_graph_type *g = graph;
+
+	struct metacall_graph_node_type *dst_node;
+
+	size_t src_index;
+
+	if (g == NULL || src == NULL || dst == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid graph edge parameters");
+
+		return 1;
+	}
+
+	if (metacall_graph_find(g, src, &src_index) == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Graph node (%s) not declared", src);
+
+		return 1;
+	}
+
+	dst_node = metacall_graph_find(g, dst, NULL);
+
+	if (dst_node == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Graph node (%s) not declared", dst);
+
+		return 1;
+	}
+
+	vector_push_back(dst_node->deps, &src_index);
+
+	return 0;
+}
+
+int metacall_graph_execute(void *graph)
+{
+	struct metacall_graph_type *g = graph;
+
+	struct metacall_graph_await_type *awaits;
+
+	vector ready;
+
+	size_t iterator, size, completed_count = 0;
+
+	function_interface last_interface = NULL;
+
+	int result = 1;
+
+	if (g == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid graph execute parameters");
+
+		return 1;
+	}
+
+	size = vector_size(g->nodes);
+
+	if (size == 0)
+	{
+		return 0;
+	}
+
+	ready = vector_create(sizeof(size_t));
+
+	if (ready == NULL)
+	{
+		return 1;
+	}
+
+	awaits = malloc(sizeof(struct metacall_graph_await_type) * size);
+
+	if (awaits == NULL)
+	{
+		vector_destroy(ready);
+
+		return 1;
+	}
+
+	/* Reset the execution state, a graph can run multiple times */
+	g->failed = 0;
+
+	g->outstanding = 0;
+
+	vector_resize(g->completed, 0);
+
+	threading_event_initialize(&g->event);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct metacall_graph_node_type *node = vector_at(g->nodes, iterator);
+
+		metacall_graph_node_clear(node);
+
+		awaits[iterator].g = g;
+
+		awaits[iterator].index = iterator;
+
+		if (node->pending == 0)
+		{
+			vector_push_back(ready, &iterator);
+		}
+	}
+
+	while (completed_count < size)
+	{
+		size_t index, ready_size;
+
+		struct metacall_graph_node_type *node;
+
+		/* Drain the asynchronously completed nodes */
+		threading_mutex_lock(g->mutex);
+
+		while (vector_size(g->completed) > 0)
+		{
+			size_t completed_index = *(size_t *)vector_back(g->completed);
+
+			vector_pop_back(g->completed);
+
+			--g->outstanding;
+
+			++completed_count;
+
+			metacall_graph_ready_dependents(g, completed_index, ready);
+		}
+
+		threading_mutex_unlock(g->mutex);
+
+		if (g->failed != 0)
+		{
+			break;
+		}
+
+		ready_size = vector_size(ready);
+
+		if (ready_size == 0)
+		{
+			if (g->outstanding > 0)
+			{
+				/* Nothing runnable until an await resolves */
+				threading_event_wait(&g->event);
+
+				continue;
+			}
+
+			/* No progress possible, the remaining nodes form a cycle */
+			log_write("metacall", LOG_LEVEL_ERROR, "Graph execution stalled, the dependencies form a cycle");
+
+			break;
+		}
+
+		/* Prefer a ready node living in the same runtime as the last
+		executed one, chains inside one loader then run back to back
+		and the boundary is crossed once per runtime switch instead of
+		once per node */
+		index = 0;
+
+		if (last_interface != NULL)
+		{
+			for (iterator = 0; iterator < ready_size; ++iterator)
+			{
+				struct metacall_graph_node_type *candidate = vector_at(g->nodes, *(size_t *)vector_at(ready, iterator));
+
+				if (function_interface_get(candidate->func) == last_interface)
+				{
+					index = iterator;
+
+					break;
+				}
+			}
+		}
+
+		{
+			size_t node_index = *(size_t *)vector_at(ready, index);
+
+			size_t args_size, deps_size, args_count;
+
+			void **argv;
+
+			void *argv_empty = NULL;
+
+			node = vector_at(g->nodes, node_index);
+
+			vector_set(ready, index, vector_back(ready));
+
+			vector_pop_back(ready);
+
+			args_size = vector_size(node->args);
+
+			deps_size = vector_size(node->deps);
+
+			args_count = args_size + deps_size;
+
+			if (args_count > 0)
+			{
+				argv = malloc(sizeof(void *) * args_count);
+
+				if (argv == NULL)
+				{
+					break;
+				}
+
+				for (iterator = 0; iterator < args_size; ++iterator)
+				{
+					argv[iterator] = *(value *)vector_at(node->args, iterator);
+				}
+
+				/* Dependency results are borrowed, inside one runtime
+				they flow between the nodes without copies */
+				for (iterator = 0; iterator < deps_size; ++iterator)
+				{
+					struct metacall_graph_node_type *dep = vector_at(g->nodes, *(size_t *)vector_at(node->deps, iterator));
+
+					argv[args_size + iterator] = dep->result;
+				}
+			}
+			else
+			{
+				argv = &argv_empty;
+			}
+
+			last_interface = function_interface_get(node->func);
+
+			if (function_async_id(node->func) == FUNCTION_ASYNC)
+			{
+				value future;
+
+				node->state = METACALL_GRAPH_NODE_RUNNING;
+
+				++g->outstanding;
+
+				future = function_await(node->func, argv, args_count, &metacall_graph_resolve, &metacall_graph_reject, &awaits[node_index]);
+
+				if (future != NULL)
+				{
+					value_type_destroy(future);
+				}
+			}
+			else
+			{
+				node->result = function_call(node->func, argv, args_count);
+
+				node->state = METACALL_GRAPH_NODE_DONE;
+
+				++completed_count;
+
+				metacall_graph_ready_dependents(g, node_index, ready);
+			}
+
+			if (args_count > 0)
+			{
+				free(argv);
+			}
+		}
+	}
+
+	/* The await contexts cannot be released while callbacks may still
+	fire, drain the outstanding awaits even on failure */
+	for (;;)
+	{
+		size_t outstanding;
+
+		threading_mutex_lock(g->mutex);
+
+		while (vector_size(g->completed) > 0)
+		{
+			vector_pop_back(g->completed);
+
+			--g->outstanding;
+		}
+
+		outstanding = g->outstanding;
+
+		threading_mutex_unlock(g->mutex);
+
+		if (outstanding == 0)
+		{
+			break;
+		}
+
+		threading_event_wait(&g->event);
+	}
+
+	if (g->failed == 0 && completed_count == size)
+	{
+		result = 0;
+	}
+
+	free(awaits);
+
+	vector_destroy(ready);
+
+	return result;
+}
+
+void *metacall_graph_result(void *graph, const char *label)
+{
+	struct metacall_graph_type *g = graph;
+
+	struct metacall_graph_node_type *node;
+
+	if (g == NULL || label == NULL)
+	{
+		return NULL;
+	}
+
+	node = metacall_graph_find(g, label, NULL);
+
+	if (node == NULL || node->state != METACALL_GRAPH_NODE_DONE || node->result == NULL)
+	{
+		return NULL;
+	}
+
+	return value_type_copy(node->result);
+}
+
+void metacall_graph_destroy(void *graph)
+{
+	struct metacall_graph_type *g = graph;
+
+	size_t iterator, size;
+
+	if (g == NULL)
+	{
+		return;
+	}
+
+	size = vector_size(g->nodes);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct metacall_graph_node_type *node = vector_at(g->nodes, iterator);
+
+		size_t arg_iterator, args_size = vector_size(node->args);
+
+		for (arg_iterator = 0; arg_iterator < args_size; ++arg_iterator)
+		{
+			value_type_destroy(*(value *)vector_at(node->args, arg_iterator));
+		}
+
+		if (node->result != NULL)
+		{
+			value_type_destroy(node->result);
+		}
+
+		function_destroy(node->func);
+
+		vector_destroy(node->args);
+
+		vector_destroy(node->deps);
+
+		free(node->label);
+	}
+
+	threading_mutex_destroy(g->mutex);
+
+	vector_destroy(g->completed);
+
+	vector_destroy(g->nodes);
+
+	free(g);
+}
@@ -26,6 +26,10 @@
 
 #include <reflect/reflect_value.h>
 #include <reflect/reflect_value_type.h>
+#include <reflect/reflect_value_type_id_size.h>
+
+#include <stdint.h>
+#include <string.h>
 
 /* -- Member Data -- */
 
@@ -46,7 +50,9 @@ static const enum metacall_value_id value_id_map[] = {
 	METACALL_FUNCTION,
 	METACALL_NULL,
 	METACALL_CLASS,
-	METACALL_OBJECT
+	METACALL_OBJECT,
+	METACALL_TYPED_ARRAY,
+	METACALL_STREAM
 };
 
 /* -- Static Assertions -- */
@@ -71,6 +77,8 @@ static_assert(((int)TYPE_BOOL == (int)METACALL_BOOL) &&
 				  ((int)TYPE_NULL == (int)METACALL_NULL) &&
 				  ((int)TYPE_CLASS == (int)METACALL_CLASS) &&
 				  ((int)TYPE_OBJECT == (int)METACALL_OBJECT) &&
+				  ((int)TYPE_TYPED_ARRAY == (int)METACALL_TYPED_ARRAY) &&
+				  ((int)TYPE_STREAM == (int)METACALL_STREAM) &&
 				  ((int)TYPE_SIZE == (int)METACALL_SIZE) &&
 				  ((int)TYPE_INVALID == (int)METACALL_INVALID),
 	"Internal reflect value types does not match with public metacall API value types");
@@ -120,16 +128,46 @@ void *metacall_value_create_string(const char *str, size_t length)
 	return value_create_string(str, length);
 }
 
+void *metacall_value_create_string_n(const char *str, size_t length)
+{
+	return value_create_string_n(str, length);
+}
+
+void *metacall_value_create_string_view(const char *str, size_t length)
+{
+	return value_create_string_view(str, length);
+}
+
+void *metacall_value_create_string_static(const char *str, size_t length)
+{
+	return value_create_string_static(str, length);
+}
+
 void *metacall_value_create_buffer(const void *buffer, size_t size)
 {
 	return value_create_buffer(buffer, size);
 }
 
+void *metacall_value_create_buffer_view(void *buffer, size_t size)
+{
+	return value_create_buffer_view(buffer, size);
+}
+
 void *metacall_value_create_array(const void *values[], size_t size)
 {
 	return value_create_array((const value *)values, size);
 }
 
+void *metacall_value_create_typed_array(const void *data, size_t count, enum metacall_value_id id)
+{
+	return value_create_typed_array(data, count, (type_id)id);
+}
+
+void *metacall_value_create_typed_array_view(void *data, size_t count, enum metacall_value_id id)
+{
+	return value_create_typed_array_view(data, count, (type_id)id);
+}
+
 void *metacall_value_create_map(const void *tuples[], size_t size)
 {
 	return value_create_map((const value *)tuples, size);
@@ -145,6 +183,11 @@ void *metacall_value_create_future(void *f)
 	return value_create_future(f);
 }
 
+void *metacall_value_create_stream(void *s)
+{
+	return value_create_stream(s);
+}
+
 void *metacall_value_create_function(void *f)
 {
 	return value_create_function(f);
@@ -251,6 +294,101 @@ double metacall_value_to_double(void *v)
 	return value_to_double(v);
 }
 
+boolean metacall_value_to_bool_unchecked(void *v)
+{
+	return value_to_bool(v);
+}
+
+char metacall_value_to_char_unchecked(void *v)
+{
+	return value_to_char(v);
+}
+
+short metacall_value_to_short_unchecked(void *v)
+{
+	return value_to_short(v);
+}
+
+int metacall_value_to_int_unchecked(void *v)
+{
+	return value_to_int(v);
+}
+
+long metacall_value_to_long_unchecked(void *v)
+{
+	return value_to_long(v);
+}
+
+float metacall_value_to_float_unchecked(void *v)
+{
+	return value_to_float(v);
+}
+
+double metacall_value_to_double_unchecked(void *v)
+{
+	return value_to_double(v);
+}
+
+size_t metacall_value_array_extract(void *v, enum metacall_value_id id, void *buffer, size_t count)
+{
+	size_t element_size = value_type_id_size((type_id)id);
+
+	size_t index, size;
+
+	value *v_array;
+
+	if (v == NULL || buffer == NULL || element_size == 0)
+	{
+		return 0;
+	}
+
+	/* Typed arrays of a matching type are a single contiguous block */
+	if (value_type_id(v) == TYPE_TYPED_ARRAY)
+	{
+		if (value_typed_array_type_id(v) != (type_id)id)
+		{
+			return 0;
+		}
+
+		size = value_typed_array_count(v);
+
+		if (count < size)
+		{
+			size = count;
+		}
+
+		memcpy(buffer, value_to_typed_array(v), element_size * size);
+
+		return size;
+	}
+
+	if (value_type_id(v) != TYPE_ARRAY)
+	{
+		return 0;
+	}
+
+	size = value_type_count(v);
+
+	if (count < size)
+	{
+		size = count;
+	}
+
+	v_array = value_to_array(v);
+
+	for (index = 0; index < size; ++index)
+	{
+		if (value_type_id(v_array[index]) != (type_id)id)
+		{
+			break;
+		}
+
+		value_to(v_array[index], (void *)(((uintptr_t)buffer) + element_size * index), element_size);
+	}
+
+	return index;
+}
+
 char *metacall_value_to_string(void *v)
 {
 	assert(value_type_id(v) == TYPE_STRING);
@@ -272,6 +410,27 @@ void **metacall_value_to_array(void *v)
 	return value_to_array(v);
 }
 
+void *metacall_value_to_typed_array(void *v)
+{
+	assert(value_type_id(v) == TYPE_TYPED_ARRAY);
+
+	return value_to_typed_array(v);
+}
+
+enum metacall_value_id metacall_value_typed_array_id(void *v)
+{
+	assert(value_type_id(v) == TYPE_TYPED_ARRAY);
+
+	return (enum metacall_value_id)value_typed_array_type_id(v);
+}
+
+size_t metacall_value_typed_array_count(void *v)
+{
+	assert(value_type_id(v) == TYPE_TYPED_ARRAY);
+
+	return value_typed_array_count(v);
+}
+
 void **metacall_value_to_map(void *v)
 {
 	assert(value_type_id(v) == TYPE_MAP);
@@ -279,6 +438,13 @@ void **metacall_value_to_map(void *v)
 	return value_to_map(v);
 }
 
+void *metacall_value_map_get(void *v, const char *key)
+{
+	assert(value_type_id(v) == TYPE_MAP);
+
+	return value_type_map_get(v, key);
+}
+
 void *metacall_value_to_ptr(void *v)
 {
 	assert(value_type_id(v) == TYPE_PTR);
@@ -293,6 +459,13 @@ void *metacall_value_to_future(void *v)
 	return value_to_future(v);
 }
 
+void *metacall_value_to_stream(void *v)
+{
+	assert(value_type_id(v) == TYPE_STREAM);
+
+	return value_to_stream(v);
+}
+
 void *metacall_value_to_function(void *v)
 {
 	assert(value_type_id(v) == TYPE_FUNCTION);
@@ -386,6 +559,11 @@ void *metacall_value_from_future(void *v, void *f)
 	return value_from_future(v, f);
 }
 
+void *metacall_value_from_stream(void *v, void *s)
+{
+	return value_from_stream(v, s);
+}
+
 void *metacall_value_from_function(void *v, void *f)
 {
 	return value_from_function(v, f);
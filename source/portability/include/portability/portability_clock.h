@@ -0,0 +1,88 @@
+/*
+ *	Portability Library by Parra Studios
+ *	A generic cross-platform portability utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef PORTABILITY_CLOCK_H
+#define PORTABILITY_CLOCK_H 1
+
+/* -- Headers -- */
+
+#include <portability/portability_api.h>
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Read the monotonic clock in nanoseconds; the reference point is
+*    arbitrary but stable for the life of the process, so the reading
+*    is only meaningful as a difference between two calls
+*
+*  @return
+*    Monotonic nanoseconds since an arbitrary origin
+*/
+PORTABILITY_API uint64_t portability_clock_nanoseconds(void);
+
+/**
+*  @brief
+*    Read the raw cycle counter of the processor (rdtsc on x86, the
+*    virtual counter on arm64), the cheapest timestamp available; when
+*    the architecture offers none it falls back to the monotonic clock.
+*    Raw readings are converted to time with
+*    portability_clock_cycles_to_nanoseconds
+*
+*  @return
+*    Current cycle counter reading
+*/
+PORTABILITY_API uint64_t portability_clock_cycles(void);
+
+/**
+*  @brief
+*    Convert a cycle counter delta to nanoseconds using a scale
+*    calibrated once against the monotonic clock on first use
+*
+*  @param[in] cycles
+*    Difference between two portability_clock_cycles readings
+*
+*  @return
+*    The delta expressed in nanoseconds
+*/
+PORTABILITY_API uint64_t portability_clock_cycles_to_nanoseconds(uint64_t cycles);
+
+/**
+*  @brief
+*    Read a coarse monotonic ticker in milliseconds, cheaper than the
+*    nanosecond clock where the platform offers one; meant for
+*    timeouts and watchdogs where millisecond granularity is enough
+*
+*  @return
+*    Monotonic milliseconds since an arbitrary origin
+*/
+PORTABILITY_API uint64_t portability_clock_coarse_milliseconds(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTABILITY_CLOCK_H */
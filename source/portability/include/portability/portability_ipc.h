@@ -0,0 +1,141 @@
+/*
+ *	Portability Library by Parra Studios
+ *	A generic cross-platform portability utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef PORTABILITY_IPC_H
+#define PORTABILITY_IPC_H 1
+
+/* -- Headers -- */
+
+#include <portability/portability_api.h>
+
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Definitions -- */
+
+#define PORTABILITY_IPC_NAME_SIZE 0x80
+
+/* -- Type Definitions -- */
+
+/* Local inter process channel, backed by a unix domain socket on POSIX
+*  and by a named pipe on win32; names are short identifiers which get
+*  mapped into the platform endpoint path internally */
+typedef struct portability_ipc_type *portability_ipc;
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Create a listening endpoint for local inter process communication
+*
+*  @param[in] name
+*    Short identifier of the endpoint (e.g "metacallcli")
+*
+*  @return
+*    Pointer to the server endpoint on success, null otherwise
+*/
+PORTABILITY_API portability_ipc portability_ipc_server_create(const char *name);
+
+/**
+*  @brief
+*    Block until a client connects to the server endpoint @server
+*
+*  @param[in] server
+*    Pointer to the server endpoint
+*
+*  @return
+*    Pointer to the accepted connection on success, null otherwise
+*/
+PORTABILITY_API portability_ipc portability_ipc_server_accept(portability_ipc server);
+
+/**
+*  @brief
+*    Connect to the listening endpoint @name of another process
+*
+*  @param[in] name
+*    Short identifier of the endpoint (e.g "metacallcli")
+*
+*  @return
+*    Pointer to the connection on success, null otherwise
+*/
+PORTABILITY_API portability_ipc portability_ipc_client_connect(const char *name);
+
+/**
+*  @brief
+*    Write exactly @size bytes of @buffer into the connection @ipc
+*
+*  @param[in] ipc
+*    Pointer to the connection
+*
+*  @param[in] buffer
+*    Data to be written
+*
+*  @param[in] size
+*    Size in bytes of @buffer
+*
+*  @return
+*    Zero if the whole buffer was written, different from zero otherwise
+*/
+PORTABILITY_API int portability_ipc_write(portability_ipc ipc, const void *buffer, size_t size);
+
+/**
+*  @brief
+*    Read exactly @size bytes from the connection @ipc into @buffer
+*
+*  @param[in] ipc
+*    Pointer to the connection
+*
+*  @param[out] buffer
+*    Destination of the data being read
+*
+*  @param[in] size
+*    Size in bytes to be read
+*
+*  @return
+*    Zero if the whole buffer was read, different from zero otherwise
+*/
+PORTABILITY_API int portability_ipc_read(portability_ipc ipc, void *buffer, size_t size);
+
+/**
+*  @brief
+*    Close a connection obtained from accept or connect
+*
+*  @param[in] ipc
+*    Pointer to the connection
+*/
+PORTABILITY_API void portability_ipc_close(portability_ipc ipc);
+
+/**
+*  @brief
+*    Close a server endpoint and remove it from the system
+*
+*  @param[in] server
+*    Pointer to the server endpoint
+*/
+PORTABILITY_API void portability_ipc_server_destroy(portability_ipc server);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTABILITY_IPC_H */
@@ -0,0 +1,82 @@
+/*
+ *	Portability Library by Parra Studios
+ *	A generic cross-platform portability utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef PORTABILITY_PROBE_H
+#define PORTABILITY_PROBE_H 1
+
+/* -- Headers -- */
+
+#include <portability/portability_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Macros -- */
+
+/* Static tracepoints under the 'metacall' provider, so perf and
+*  bpftrace can attribute latency at the call path boundaries without
+*  recompiling. They compile to a single nop (plus an ELF note) when
+*  <sys/sdt.h> is available and to nothing at all otherwise.
+*  TODO: Implement the win32 path on top of ETW (TraceLogging) */
+#if !defined(PORTABILITY_PROBE_SDT) && defined(__linux__) && defined(__has_include)
+	#if __has_include(<sys/sdt.h>)
+		#define PORTABILITY_PROBE_SDT 1
+	#endif
+#endif
+
+#if defined(PORTABILITY_PROBE_SDT)
+
+	#include <sys/sdt.h>
+
+	#define PORTABILITY_PROBE(name)					DTRACE_PROBE(metacall, name)
+	#define PORTABILITY_PROBE_1(name, a)			DTRACE_PROBE1(metacall, name, a)
+	#define PORTABILITY_PROBE_2(name, a, b)			DTRACE_PROBE2(metacall, name, a, b)
+	#define PORTABILITY_PROBE_3(name, a, b, c)		DTRACE_PROBE3(metacall, name, a, b, c)
+
+#else
+
+	#define PORTABILITY_PROBE(name) \
+		do \
+		{ \
+		} while (0)
+
+	#define PORTABILITY_PROBE_1(name, a) \
+		do \
+		{ \
+		} while (0)
+
+	#define PORTABILITY_PROBE_2(name, a, b) \
+		do \
+		{ \
+		} while (0)
+
+	#define PORTABILITY_PROBE_3(name, a, b, c) \
+		do \
+		{ \
+		} while (0)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTABILITY_PROBE_H */
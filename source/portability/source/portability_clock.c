@@ -0,0 +1,154 @@
+/*
+ *	Portability Library by Parra Studios
+ *	A generic cross-platform portability utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <portability/portability_clock.h>
+
+#if defined(WIN32) || defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+
+	#include <intrin.h>
+#else
+	#include <time.h>
+#endif
+
+/* -- Definitions -- */
+
+/* The calibration window, long enough to make the cycle to nanosecond
+*  ratio stable against scheduler noise, short enough to hide inside
+*  the first measurement that needs it */
+#define PORTABILITY_CLOCK_CALIBRATION_WINDOW 1000000ULL
+
+/* -- Private Variables -- */
+
+/* Calibration is performed at most once per process; the race between
+*  two first callers is benign, both compute the same ratio from the
+*  same invariant counters and either result is valid */
+static volatile double portability_clock_ratio = 0.0;
+
+/* -- Methods -- */
+
+uint64_t portability_clock_nanoseconds(void)
+{
+#if defined(WIN32) || defined(_WIN32)
+	LARGE_INTEGER frequency, counter;
+
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+
+	return (uint64_t)((counter.QuadPart * 1000000000ULL) / frequency.QuadPart);
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((uint64_t)ts.tv_sec) * 1000000000ULL + ((uint64_t)ts.tv_nsec);
+#endif
+}
+
+uint64_t portability_clock_cycles(void)
+{
+#if defined(WIN32) || defined(_WIN32)
+	return (uint64_t)__rdtsc();
+#elif defined(__x86_64__) || defined(__amd64__)
+	uint32_t low, high;
+
+	__asm__ __volatile__("rdtsc"
+						 : "=a"(low), "=d"(high));
+
+	return (((uint64_t)high) << 32) | ((uint64_t)low);
+#elif defined(__i386__)
+	uint64_t counter;
+
+	__asm__ __volatile__("rdtsc"
+						 : "=A"(counter));
+
+	return counter;
+#elif defined(__aarch64__)
+	uint64_t counter;
+
+	__asm__ __volatile__("mrs %0, cntvct_el0"
+						 : "=r"(counter));
+
+	return counter;
+#else
+	/* No accessible cycle counter, the monotonic clock keeps the
+	calibrated conversion an identity */
+	return portability_clock_nanoseconds();
+#endif
+}
+
+uint64_t portability_clock_cycles_to_nanoseconds(uint64_t cycles)
+{
+	double ratio = portability_clock_ratio;
+
+	if (ratio == 0.0)
+	{
+		uint64_t nanoseconds_start = portability_clock_nanoseconds();
+
+		uint64_t cycles_start = portability_clock_cycles();
+
+		uint64_t nanoseconds_end, cycles_end;
+
+		do
+		{
+			nanoseconds_end = portability_clock_nanoseconds();
+		} while (nanoseconds_end - nanoseconds_start < PORTABILITY_CLOCK_CALIBRATION_WINDOW);
+
+		cycles_end = portability_clock_cycles();
+
+		if (cycles_end > cycles_start)
+		{
+			ratio = (double)(nanoseconds_end - nanoseconds_start) / (double)(cycles_end - cycles_start);
+		}
+		else
+		{
+			ratio = 1.0;
+		}
+
+		portability_clock_ratio = ratio;
+	}
+
+	return (uint64_t)(((double)cycles) * ratio);
+}
+
+uint64_t portability_clock_coarse_milliseconds(void)
+{
+#if defined(WIN32) || defined(_WIN32)
+	return (uint64_t)GetTickCount64();
+#elif defined(CLOCK_MONOTONIC_COARSE)
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+
+	return ((uint64_t)ts.tv_sec) * 1000ULL + ((uint64_t)ts.tv_nsec) / 1000000ULL;
+#else
+	return portability_clock_nanoseconds() / 1000000ULL;
+#endif
+}
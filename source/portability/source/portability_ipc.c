@@ -0,0 +1,443 @@
+/*
+ *	Portability Library by Parra Studios
+ *	A generic cross-platform portability utility.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <portability/portability_ipc.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(WIN32) || defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+#else
+	#include <errno.h>
+	#include <sys/socket.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+
+/* -- Member Data -- */
+
+struct portability_ipc_type
+{
+#if defined(WIN32) || defined(_WIN32)
+	HANDLE handle;
+#else
+	int fd;
+#endif
+	int server;
+	char name[PORTABILITY_IPC_NAME_SIZE];
+};
+
+/* -- Private Methods -- */
+
+static int portability_ipc_name(const char *name, char *endpoint, size_t size)
+{
+#if defined(WIN32) || defined(_WIN32)
+	int result = snprintf(endpoint, size, "\\\\.\\pipe\\%s", name);
+#else
+	int result = snprintf(endpoint, size, "/tmp/%s.sock", name);
+#endif
+
+	return (result <= 0 || (size_t)result >= size) ? 1 : 0;
+}
+
+static portability_ipc portability_ipc_allocate(void)
+{
+	portability_ipc ipc = malloc(sizeof(struct portability_ipc_type));
+
+	if (ipc == NULL)
+	{
+		return NULL;
+	}
+
+#if defined(WIN32) || defined(_WIN32)
+	ipc->handle = INVALID_HANDLE_VALUE;
+#else
+	ipc->fd = -1;
+#endif
+	ipc->server = 0;
+	ipc->name[0] = '\0';
+
+	return ipc;
+}
+
+/* -- Methods -- */
+
+portability_ipc portability_ipc_server_create(const char *name)
+{
+	portability_ipc server;
+
+	char endpoint[PORTABILITY_IPC_NAME_SIZE];
+
+	if (name == NULL || portability_ipc_name(name, endpoint, sizeof(endpoint)) != 0)
+	{
+		return NULL;
+	}
+
+	server = portability_ipc_allocate();
+
+	if (server == NULL)
+	{
+		return NULL;
+	}
+
+	server->server = 1;
+
+	strncpy(server->name, endpoint, sizeof(server->name) - 1);
+
+	server->name[sizeof(server->name) - 1] = '\0';
+
+#if defined(WIN32) || defined(_WIN32)
+	{
+		/* Named pipe instances are created per accept, the server only
+		holds the endpoint name until then */
+		return server;
+	}
+#else
+	{
+		/* The union makes the generic sockaddr view of the address a
+		well defined access instead of a type punned pointer cast */
+		union
+		{
+			struct sockaddr_un un;
+			struct sockaddr addr;
+		} address;
+
+		/* A silently truncated socket path would bind the wrong
+		endpoint, reject names that do not fit instead */
+		size_t length = strlen(endpoint);
+
+		if (length >= sizeof(address.un.sun_path))
+		{
+			free(server);
+
+			return NULL;
+		}
+
+		server->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+		if (server->fd == -1)
+		{
+			free(server);
+
+			return NULL;
+		}
+
+		memset(&address, 0, sizeof(address));
+
+		address.un.sun_family = AF_UNIX;
+
+		memcpy(address.un.sun_path, endpoint, length + 1);
+
+		/* Remove a stale endpoint left behind by a previous instance */
+		unlink(endpoint);
+
+		if (bind(server->fd, &address.addr, sizeof(address.un)) == -1 || listen(server->fd, 8) == -1)
+		{
+			close(server->fd);
+
+			free(server);
+
+			return NULL;
+		}
+
+		return server;
+	}
+#endif
+}
+
+portability_ipc portability_ipc_server_accept(portability_ipc server)
+{
+	portability_ipc connection;
+
+	if (server == NULL || server->server != 1)
+	{
+		return NULL;
+	}
+
+	connection = portability_ipc_allocate();
+
+	if (connection == NULL)
+	{
+		return NULL;
+	}
+
+#if defined(WIN32) || defined(_WIN32)
+	{
+		connection->handle = CreateNamedPipeA(server->name,
+			PIPE_ACCESS_DUPLEX,
+			PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT,
+			PIPE_UNLIMITED_INSTANCES,
+			0x1000, 0x1000, 0, NULL);
+
+		if (connection->handle == INVALID_HANDLE_VALUE)
+		{
+			free(connection);
+
+			return NULL;
+		}
+
+		if (ConnectNamedPipe(connection->handle, NULL) == 0 && GetLastError() != ERROR_PIPE_CONNECTED)
+		{
+			CloseHandle(connection->handle);
+
+			free(connection);
+
+			return NULL;
+		}
+
+		return connection;
+	}
+#else
+	{
+		do
+		{
+			connection->fd = accept(server->fd, NULL, NULL);
+
+		} while (connection->fd == -1 && errno == EINTR);
+
+		if (connection->fd == -1)
+		{
+			free(connection);
+
+			return NULL;
+		}
+
+		return connection;
+	}
+#endif
+}
+
+portability_ipc portability_ipc_client_connect(const char *name)
+{
+	portability_ipc connection;
+
+	char endpoint[PORTABILITY_IPC_NAME_SIZE];
+
+	if (name == NULL || portability_ipc_name(name, endpoint, sizeof(endpoint)) != 0)
+	{
+		return NULL;
+	}
+
+	connection = portability_ipc_allocate();
+
+	if (connection == NULL)
+	{
+		return NULL;
+	}
+
+#if defined(WIN32) || defined(_WIN32)
+	{
+		connection->handle = CreateFileA(endpoint, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, 0, NULL);
+
+		if (connection->handle == INVALID_HANDLE_VALUE)
+		{
+			free(connection);
+
+			return NULL;
+		}
+
+		return connection;
+	}
+#else
+	{
+		/* Same union as the server side to avoid the type punned cast */
+		union
+		{
+			struct sockaddr_un un;
+			struct sockaddr addr;
+		} address;
+
+		/* Same length validation as the server side, a truncated
+		path would connect to the wrong endpoint */
+		size_t length = strlen(endpoint);
+
+		if (length >= sizeof(address.un.sun_path))
+		{
+			free(connection);
+
+			return NULL;
+		}
+
+		connection->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+		if (connection->fd == -1)
+		{
+			free(connection);
+
+			return NULL;
+		}
+
+		memset(&address, 0, sizeof(address));
+
+		address.un.sun_family = AF_UNIX;
+
+		memcpy(address.un.sun_path, endpoint, length + 1);
+
+		if (connect(connection->fd, &address.addr, sizeof(address.un)) == -1)
+		{
+			close(connection->fd);
+
+			free(connection);
+
+			return NULL;
+		}
+
+		return connection;
+	}
+#endif
+}
+
+int portability_ipc_write(portability_ipc ipc, const void *buffer, size_t size)
+{
+	const char *data = buffer;
+
+	size_t written = 0;
+
+	if (ipc == NULL || buffer == NULL)
+	{
+		return 1;
+	}
+
+	while (written < size)
+	{
+#if defined(WIN32) || defined(_WIN32)
+		DWORD bytes = 0;
+
+		if (WriteFile(ipc->handle, data + written, (DWORD)(size - written), &bytes, NULL) == 0 || bytes == 0)
+		{
+			return 1;
+		}
+#else
+		ssize_t bytes = write(ipc->fd, data + written, size - written);
+
+		if (bytes == -1 && errno == EINTR)
+		{
+			continue;
+		}
+
+		if (bytes <= 0)
+		{
+			return 1;
+		}
+#endif
+
+		written += (size_t)bytes;
+	}
+
+	return 0;
+}
+
+int portability_ipc_read(portability_ipc ipc, void *buffer, size_t size)
+{
+	char *data = buffer;
+
+	size_t readed = 0;
+
+	if (ipc == NULL || buffer == NULL)
+	{
+		return 1;
+	}
+
+	while (readed < size)
+	{
+#if defined(WIN32) || defined(_WIN32)
+		DWORD bytes = 0;
+
+		if (ReadFile(ipc->handle, data + readed, (DWORD)(size - readed), &bytes, NULL) == 0 || bytes == 0)
+		{
+			return 1;
+		}
+#else
+		ssize_t bytes = read(ipc->fd, data + readed, size - readed);
+
+		if (bytes == -1 && errno == EINTR)
+		{
+			continue;
+		}
+
+		if (bytes <= 0)
+		{
+			return 1;
+		}
+#endif
+
+		readed += (size_t)bytes;
+	}
+
+	return 0;
+}
+
+void portability_ipc_close(portability_ipc ipc)
+{
+	if (ipc == NULL)
+	{
+		return;
+	}
+
+#if defined(WIN32) || defined(_WIN32)
+	if (ipc->handle != INVALID_HANDLE_VALUE)
+	{
+		if (ipc->server == 0)
+		{
+			FlushFileBuffers(ipc->handle);
+
+			DisconnectNamedPipe(ipc->handle);
+		}
+
+		CloseHandle(ipc->handle);
+	}
+#else
+	if (ipc->fd != -1)
+	{
+		close(ipc->fd);
+	}
+#endif
+
+	free(ipc);
+}
+
+void portability_ipc_server_destroy(portability_ipc server)
+{
+	if (server == NULL || server->server != 1)
+	{
+		return;
+	}
+
+#if defined(WIN32) || defined(_WIN32)
+	free(server);
+#else
+	close(server->fd);
+
+	unlink(server->name);
+
+	free(server);
+#endif
+}
@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Buffers;
 using System.Collections.Generic;
 using System.Linq;
 using System.Runtime.InteropServices;
@@ -60,5 +61,61 @@ namespace MetacallCsPort
         {
             return Marshal.PtrToStructure<T>(this.ptr);
         }
+
+        /* Zero copy access to a returned buffer value: the span aliases
+        the native memory owned by this result, so it is only valid until
+        Dispose and must not be stored past it */
+        public unsafe Span<byte> AsSpan()
+        {
+            IntPtr buffer = MetacallAPI.metacall_value_to_buffer(this.ptr);
+            long size = MetacallAPI.metacall_value_size(this.ptr);
+
+            return new Span<byte>((void*)buffer, (int)size);
+        }
+
+        public unsafe Memory<byte> AsMemory()
+        {
+            IntPtr buffer = MetacallAPI.metacall_value_to_buffer(this.ptr);
+            long size = MetacallAPI.metacall_value_size(this.ptr);
+
+            return new NativeMemoryManager((byte*)buffer, (int)size).Memory;
+        }
+
+        /* Copying escape hatch for callers that outlive the result */
+        public byte[] AsByteArray()
+        {
+            return AsSpan().ToArray();
+        }
+
+        private sealed unsafe class NativeMemoryManager : MemoryManager<byte>
+        {
+            private readonly byte* pointer;
+            private readonly int length;
+
+            public NativeMemoryManager(byte* pointer, int length)
+            {
+                this.pointer = pointer;
+                this.length = length;
+            }
+
+            public override Span<byte> GetSpan()
+            {
+                return new Span<byte>(pointer, length);
+            }
+
+            public override MemoryHandle Pin(int elementIndex = 0)
+            {
+                /* Native memory never moves, there is nothing to pin */
+                return new MemoryHandle(pointer + elementIndex);
+            }
+
+            public override void Unpin()
+            {
+            }
+
+            protected override void Dispose(bool disposing)
+            {
+            }
+        }
     }
 }
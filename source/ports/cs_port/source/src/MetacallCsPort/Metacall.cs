@@ -69,16 +69,18 @@ namespace MetacallCsPort
 
         public ExecutionResult Invoke(string function, params object[] args)
         {
-            List<IntPtr> metacallArgs = new List<IntPtr>(args.Length);
+            List<GCHandle> pinned = new List<GCHandle>();
 
-            foreach (var arg in args)
+            try
             {
-                metacallArgs.Add(primitiveToIntPtr[arg.GetType()](arg));
-            }
+                IntPtr ptr = MetacallAPI.metacallv(function, MakeArgs(args, pinned));
 
-            IntPtr ptr = MetacallAPI.metacallv(function, metacallArgs.ToArray());
-
-            return ExecutionResult.Make(ptr);
+                return ExecutionResult.Make(ptr);
+            }
+            finally
+            {
+                FreeArgs(pinned);
+            }
         }
 
         public bool HasFunction(string name)
@@ -101,17 +103,55 @@ namespace MetacallCsPort
         }
 
         protected ExecutionResult Invoke(Function function, params object[] args)
+        {
+            List<GCHandle> pinned = new List<GCHandle>();
+
+            try
+            {
+                IntPtr ptr = MetacallAPI.metacallfv(function.Pointer, MakeArgs(args, pinned));
+
+                return ExecutionResult.Make(ptr);
+            }
+            finally
+            {
+                FreeArgs(pinned);
+            }
+        }
+
+        private static IntPtr[] MakeArgs(object[] args, List<GCHandle> pinned)
         {
             List<IntPtr> metacallArgs = new List<IntPtr>(args.Length);
 
             foreach (var arg in args)
             {
-                metacallArgs.Add(primitiveToIntPtr[arg.GetType()](arg));
+                byte[] buffer = arg as byte[];
+
+                if (buffer != null)
+                {
+                    /* Pin the managed array for the duration of the call and
+                    hand the runtime a view over it, the bytes cross the
+                    boundary without a copy */
+                    GCHandle handle = GCHandle.Alloc(buffer, GCHandleType.Pinned);
+
+                    pinned.Add(handle);
+
+                    metacallArgs.Add(MetacallAPI.metacall_value_create_buffer_view(handle.AddrOfPinnedObject(), (long)buffer.Length));
+                }
+                else
+                {
+                    metacallArgs.Add(primitiveToIntPtr[arg.GetType()](arg));
+                }
             }
 
-            IntPtr ptr = MetacallAPI.metacallfv(function.Pointer, metacallArgs.ToArray());
+            return metacallArgs.ToArray();
+        }
 
-            return ExecutionResult.Make(ptr);
+        private static void FreeArgs(List<GCHandle> pinned)
+        {
+            foreach (var handle in pinned)
+            {
+                handle.Free();
+            }
         }
 
         private static Dictionary<Type, Func<object, IntPtr>> primitiveToIntPtr = new Dictionary<Type, Func<object, IntPtr>>()
@@ -20,7 +20,10 @@ namespace MetacallCsPort
             METACALL_FLOAT = 5,
             METACALL_DOUBLE = 6,
             METACALL_STRING = 7,
-            METACALL_PTR = 8,
+            METACALL_BUFFER = 8,
+            METACALL_ARRAY = 9,
+            METACALL_MAP = 10,
+            METACALL_PTR = 11,
 
             METACALL_SIZE,
             METACALL_INVALID
@@ -82,5 +85,21 @@ namespace MetacallCsPort
 
         [DllImport(libraryName, CharSet = CharSet.Ansi)]
         public static extern IntPtr metacall_value_create_ptr(IntPtr ptr);
+
+        [DllImport(libraryName, CharSet = CharSet.Ansi)]
+        public static extern IntPtr metacall_value_create_buffer(IntPtr buffer, long size);
+
+        [DllImport(libraryName, CharSet = CharSet.Ansi)]
+        public static extern IntPtr metacall_value_create_buffer_view(IntPtr buffer, long size);
+
+        [DllImport(libraryName, CharSet = CharSet.Ansi)]
+        public static extern IntPtr metacall_value_to_buffer(IntPtr v);
+
+        [DllImport(libraryName, CharSet = CharSet.Ansi)]
+        public static extern long metacall_value_size(IntPtr v);
+
+        /* The enum above already takes the metacall_value_id name */
+        [DllImport(libraryName, EntryPoint = "metacall_value_id", CharSet = CharSet.Ansi)]
+        public static extern metacall_value_id metacall_value_type(IntPtr v);
     }
 }
@@ -32,6 +32,38 @@ namespace metacall
 template <typename... Ts>
 METACALL_API int metacall(std::string name, Ts... ts);
 
+/* Compile time map between a C++ type and the C API value constructors,
+specialized for every type the typed call facade supports */
+template <typename T>
+struct value_type_traits;
+
+/* Traits over a call signature written as a C++ function type,
+specialized below for R(Args...) */
+template <typename S>
+struct signature_traits;
+
+/**
+*  @brief
+*    Invoke the function @name with the argument and return types fixed
+*    at compile time by the signature @S (e.g. call<double(int, int)>("sum", 3, 4));
+*    the arguments are packed into value handles on the stack frame of the
+*    caller without any runtime type dispatch, and the arity of @ts is
+*    validated against @S at compile time and against the loaded function
+*    signature before invoking
+*
+*  @param[in] name
+*    Name of the function to invoke
+*
+*  @param[in] ts
+*    Arguments of the call, converted to the types declared by @S
+*
+*  @return
+*    Return value of the call converted to the return type of @S,
+*    value initialized when the call fails
+*/
+template <typename S, typename... Ts>
+typename signature_traits<S>::return_type call(const char *name, Ts... ts);
+
 } /* namespace metacall */
 
 #include <metacall/metacall.inl>
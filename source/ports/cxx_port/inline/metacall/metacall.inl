@@ -25,8 +25,23 @@
 
 #include <metacall/metacall_api.hpp>
 
+#include <metacall/metacall_value.h>
+
+#include <cstddef>
+#include <cstring>
 #include <string>
 
+/* metacall.h cannot be included here because its global function
+metacall collides with the namespace, so the call entry points the
+facade relies on are declared directly against the C library */
+extern "C" {
+METACALL_API void *metacall_function(const char *name);
+
+METACALL_API size_t metacall_function_size(void *func);
+
+METACALL_API void *metacallfv_s(void *func, void *args[], size_t size);
+}
+
 namespace metacall
 {
 template <typename... Ts>
@@ -35,6 +50,222 @@ METACALL_API int metacall(std::string name, Ts... ts)
 	return 0;
 }
 
+template <>
+struct value_type_traits<bool>
+{
+	static void *create(bool b)
+	{
+		return metacall_value_create_bool(b ? 1L : 0L);
+	}
+
+	static bool to(void *v)
+	{
+		return metacall_value_to_bool(v) != 0L;
+	}
+};
+
+template <>
+struct value_type_traits<char>
+{
+	static void *create(char c)
+	{
+		return metacall_value_create_char(c);
+	}
+
+	static char to(void *v)
+	{
+		return metacall_value_to_char(v);
+	}
+};
+
+template <>
+struct value_type_traits<short>
+{
+	static void *create(short s)
+	{
+		return metacall_value_create_short(s);
+	}
+
+	static short to(void *v)
+	{
+		return metacall_value_to_short(v);
+	}
+};
+
+template <>
+struct value_type_traits<int>
+{
+	static void *create(int i)
+	{
+		return metacall_value_create_int(i);
+	}
+
+	static int to(void *v)
+	{
+		return metacall_value_to_int(v);
+	}
+};
+
+template <>
+struct value_type_traits<long>
+{
+	static void *create(long l)
+	{
+		return metacall_value_create_long(l);
+	}
+
+	static long to(void *v)
+	{
+		return metacall_value_to_long(v);
+	}
+};
+
+template <>
+struct value_type_traits<float>
+{
+	static void *create(float f)
+	{
+		return metacall_value_create_float(f);
+	}
+
+	static float to(void *v)
+	{
+		return metacall_value_to_float(v);
+	}
+};
+
+template <>
+struct value_type_traits<double>
+{
+	static void *create(double d)
+	{
+		return metacall_value_create_double(d);
+	}
+
+	static double to(void *v)
+	{
+		return metacall_value_to_double(v);
+	}
+};
+
+template <>
+struct value_type_traits<const char *>
+{
+	static void *create(const char *str)
+	{
+		return metacall_value_create_string(str, std::strlen(str));
+	}
+
+	static const char *to(void *v)
+	{
+		return metacall_value_to_string(v);
+	}
+};
+
+template <>
+struct value_type_traits<std::string>
+{
+	static void *create(const std::string &str)
+	{
+		return metacall_value_create_string(str.c_str(), str.length());
+	}
+
+	static std::string to(void *v)
+	{
+		return std::string(metacall_value_to_string(v));
+	}
+};
+
+template <>
+struct value_type_traits<void *>
+{
+	static void *create(void *ptr)
+	{
+		return metacall_value_create_ptr(ptr);
+	}
+
+	static void *to(void *v)
+	{
+		return metacall_value_to_ptr(v);
+	}
+};
+
+/* Converts the value returned by the call into the return type of the
+signature and releases it, specialized so void returns only release */
+template <typename R>
+struct return_type_traits
+{
+	static R from(void *ret)
+	{
+		R result;
+
+		if (ret == NULL)
+		{
+			return R();
+		}
+
+		result = value_type_traits<R>::to(ret);
+
+		metacall_value_destroy(ret);
+
+		return result;
+	}
+};
+
+template <>
+struct return_type_traits<void>
+{
+	static void from(void *ret)
+	{
+		if (ret != NULL)
+		{
+			metacall_value_destroy(ret);
+		}
+	}
+};
+
+template <typename R, typename... Args>
+struct signature_traits<R(Args...)>
+{
+	typedef R return_type;
+
+	static const size_t arity = sizeof...(Args);
+
+	template <typename... Ts>
+	static R invoke(const char *name, Ts... ts)
+	{
+		static_assert(sizeof...(Ts) == sizeof...(Args), "Argument count of the call does not match the arity of the signature");
+
+		void *func = metacall_function(name);
+
+		if (func == NULL || metacall_function_size(func) != sizeof...(Args))
+		{
+			return R();
+		}
+
+		{
+			/* One trailing null slot so zero argument calls still
+			have a valid array to point into */
+			void *args[sizeof...(Args) + 1] = { value_type_traits<Args>::create(static_cast<Args>(ts))..., NULL };
+
+			void *ret = metacallfv_s(func, args, sizeof...(Args));
+
+			for (size_t iterator = 0; iterator < sizeof...(Args); ++iterator)
+			{
+				metacall_value_destroy(args[iterator]);
+			}
+
+			return return_type_traits<R>::from(ret);
+		}
+	}
+};
+
+template <typename S, typename... Ts>
+typename signature_traits<S>::return_type call(const char *name, Ts... ts)
+{
+	return signature_traits<S>::invoke(name, ts...);
+}
+
 } /* namespace metacall */
 
 #endif /* METACALL_INL */
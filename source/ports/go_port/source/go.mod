@@ -1,3 +1,3 @@
 module github.com/metacall/core/source/ports/go_port/source
 
-go 1.14
+go 1.21
@@ -9,10 +9,74 @@ import "C"
 import (
 	"unsafe"
 	"errors"
+	"runtime"
 )
 
 const PtrSizeInBytes = (32 << uintptr(^uintptr(0)>>63)) >> 3
 
+// valueCreate marshals one Go argument into a MetaCall value. Byte
+// slices are pinned and borrowed by the value instead of being copied,
+// the pin must outlive the call and the destruction of the values.
+func valueCreate(arg interface{}, pinner *runtime.Pinner) unsafe.Pointer {
+
+	// Create int
+	if i, ok := arg.(int); ok {
+		return C.metacall_value_create_int((C.int)(i))
+	}
+
+	// Create float32
+	if i, ok := arg.(float32); ok {
+		return C.metacall_value_create_float((C.float)(i))
+	}
+
+	// Create float64
+	if i, ok := arg.(float64); ok {
+		return C.metacall_value_create_double((C.double)(i))
+	}
+
+	// Create string
+	if str, ok := arg.(string); ok {
+		cStr := C.CString(str)
+		defer C.free(unsafe.Pointer(cStr))
+		return C.metacall_value_create_string(cStr, (C.size_t)(len(str)))
+	}
+
+	// Create buffer borrowing the pinned slice storage
+	if b, ok := arg.([]byte); ok && len(b) > 0 {
+		pinner.Pin(&b[0])
+		return C.metacall_value_create_buffer_view(unsafe.Pointer(&b[0]), (C.size_t)(len(b)))
+	}
+
+	// TODO: Other types ...
+
+	return nil
+}
+
+// valueToGo converts a MetaCall value into its Go counterpart
+func valueToGo(ret unsafe.Pointer) interface{} {
+	switch (C.metacall_value_id(ret)) {
+		case C.METACALL_INT: {
+			return int(C.metacall_value_to_int(ret))
+		}
+
+		case C.METACALL_FLOAT: {
+			return float32(C.metacall_value_to_float(ret))
+		}
+
+		case C.METACALL_DOUBLE: {
+			return float64(C.metacall_value_to_double(ret))
+		}
+
+		case C.METACALL_STRING: {
+			return C.GoString(C.metacall_value_to_string(ret))
+		}
+
+		// TODO: Other types ...
+	}
+
+	return nil
+}
+
 func Initialize() error {
 	// TODO: Remove this once go loader is implemented
 	if (int(C.metacall_initialize()) != 0) {
@@ -61,32 +125,15 @@ func Call(function string, args ...interface{}) (interface{}, error) {
 	cArgs := C.malloc(C.size_t(size) * C.size_t(unsafe.Sizeof(uintptr(0))))
 	defer C.free(unsafe.Pointer(cArgs))
 
+	// Pins live until the values are destroyed, so borrowed byte
+	// slices stay in place while C holds pointers into them
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+
 	for index, arg := range args {
 		cArg := (*unsafe.Pointer)(unsafe.Pointer(uintptr(unsafe.Pointer(cArgs)) + uintptr(index) * PtrSizeInBytes))
 
-		// Create int
-		if i, ok := arg.(int); ok {
-			*cArg = C.metacall_value_create_int((C.int)(i))
-		}
-
-		// Create float32
-		if i, ok := arg.(float32); ok {
-			*cArg = C.metacall_value_create_float((C.float)(i))
-		}
-
-		// Create float64
-		if i, ok := arg.(float64); ok {
-			*cArg = C.metacall_value_create_double((C.double)(i))
-		}
-
-		// Create string
-		if str, ok := arg.(string); ok {
-			cStr := C.CString(str)
-			defer C.free(unsafe.Pointer(cStr))
-			*cArg = C.metacall_value_create_string(cStr, (C.size_t)(len(str)))
-		}
-
-		// TODO: Other types ...
+		*cArg = valueCreate(arg, &pinner)
 	}
 
 	defer (func () {
@@ -101,28 +148,96 @@ func Call(function string, args ...interface{}) (interface{}, error) {
 	if ret != nil {
 		defer C.metacall_value_destroy(ret)
 
-		switch (C.metacall_value_id(unsafe.Pointer(ret))) {
-			case C.METACALL_INT: {
-				return int(C.metacall_value_to_int(unsafe.Pointer(ret))), nil
-			}
+		return valueToGo(unsafe.Pointer(ret)), nil
+	}
 
-			case C.METACALL_FLOAT: {
-				return float32(C.metacall_value_to_float(unsafe.Pointer(ret))), nil
-			}
+	return nil, nil
+}
 
-			case C.METACALL_DOUBLE: {
-				return float64(C.metacall_value_to_double(unsafe.Pointer(ret))), nil
-			}
+// CallBatch invokes the function once per element of argsBatch crossing
+// cgo a single time, every invocation must carry the same number of
+// arguments; the results are fanned back out in invocation order
+func CallBatch(function string, argsBatch ...[]interface{}) ([]interface{}, error) {
+
+	cFunction := C.CString(function)
+	defer C.free(unsafe.Pointer(cFunction))
+
+	cFunc := C.metacall_function(cFunction)
+
+	if cFunc == nil {
+		return nil, errors.New("Function not found")
+	}
+
+	count := len(argsBatch)
+
+	if count == 0 {
+		return nil, nil
+	}
+
+	size := len(argsBatch[0])
+
+	for _, args := range argsBatch {
+		if len(args) != size {
+			return nil, errors.New("MetaCall batch requires the same arity on every invocation")
+		}
+	}
 
-			case C.METACALL_STRING: {
-				return C.GoString(C.metacall_value_to_string(unsafe.Pointer(ret))), nil
+	// One block holds the per invocation argument arrays, another the
+	// array of pointers into it and a third the results, all in C
+	// memory so a single cgo transition carries the whole batch
+	cArgsBlock := C.malloc(C.size_t(count) * C.size_t(size + 1) * PtrSizeInBytes)
+	defer C.free(unsafe.Pointer(cArgsBlock))
+
+	cArgsIndex := C.malloc(C.size_t(count) * PtrSizeInBytes)
+	defer C.free(unsafe.Pointer(cArgsIndex))
+
+	cResults := C.malloc(C.size_t(count) * PtrSizeInBytes)
+	defer C.free(unsafe.Pointer(cResults))
+
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+
+	for invocation, args := range argsBatch {
+		base := uintptr(unsafe.Pointer(cArgsBlock)) + uintptr(invocation * (size + 1)) * PtrSizeInBytes
+
+		cIndex := (*unsafe.Pointer)(unsafe.Pointer(uintptr(unsafe.Pointer(cArgsIndex)) + uintptr(invocation) * PtrSizeInBytes))
+		*cIndex = unsafe.Pointer(base)
+
+		for index, arg := range args {
+			cArg := (*unsafe.Pointer)(unsafe.Pointer(base + uintptr(index) * PtrSizeInBytes))
+
+			*cArg = valueCreate(arg, &pinner)
+		}
+	}
+
+	defer (func () {
+		for invocation, args := range argsBatch {
+			base := uintptr(unsafe.Pointer(cArgsBlock)) + uintptr(invocation * (size + 1)) * PtrSizeInBytes
+
+			for index, _ := range args {
+				cArg := (*unsafe.Pointer)(unsafe.Pointer(base + uintptr(index) * PtrSizeInBytes))
+				C.metacall_value_destroy(*cArg)
 			}
+		}
+	})()
+
+	if int(C.metacallfv_batch(cFunc, (**unsafe.Pointer)(cArgsIndex), (C.size_t)(size), (C.size_t)(count), (*unsafe.Pointer)(cResults))) != 0 {
+		return nil, errors.New("MetaCall failed to invoke the batch")
+	}
+
+	results := make([]interface{}, count)
+
+	for invocation := 0; invocation < count; invocation++ {
+		cResult := (*unsafe.Pointer)(unsafe.Pointer(uintptr(unsafe.Pointer(cResults)) + uintptr(invocation) * PtrSizeInBytes))
 
-			// TODO: Other types ...
+		if *cResult != nil {
+			results[invocation] = valueToGo(*cResult)
+
+			C.metacall_value_destroy(*cResult)
 		}
 	}
 
-	return nil, nil
+	return results, nil
 }
 
 func Destroy() {
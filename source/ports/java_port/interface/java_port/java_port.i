@@ -60,6 +60,10 @@
 
 	%include <metacall/metacall.h>
 
+	/* The value API is exposed so buffers can travel as direct
+	ByteBuffers over the native value memory (see java_port_impl.i) */
+	%include <metacall/metacall_value.h>
+
 #endif /* SWIG && SWIGJAVA */
 
 #endif /* METACALL_SWIG_WRAPPER_JAVA_PORT_I */
@@ -66,6 +66,62 @@ extern "C" {
 	$2 = c_string_size;
 }
 
+/**
+*  @brief
+*    Surface buffer creation as direct ByteBuffers: the native address
+*    and capacity of the buffer are taken as they are, so the bytes
+*    cross the boundary without the copy GetByteArrayElements implies;
+*    heap (non direct) buffers are rejected with an exception
+*/
+%typemap(jni) (const void * buffer, size_t size) "jobject"
+%typemap(jtype) (const void * buffer, size_t size) "java.nio.ByteBuffer"
+%typemap(jstype) (const void * buffer, size_t size) "java.nio.ByteBuffer"
+%typemap(javain) (const void * buffer, size_t size) "$javainput"
+
+%typemap(in) (const void * buffer, size_t size)
+{
+	void * address = (*jenv)->GetDirectBufferAddress(jenv, $input);
+
+	if (address == NULL)
+	{
+		jclass c = (*jenv)->FindClass(jenv, "java/lang/IllegalArgumentException");
+
+		(*jenv)->ThrowNew(jenv, c, "A direct ByteBuffer is required");
+	}
+
+	$1 = address;
+
+	$2 = (size_t)(*jenv)->GetDirectBufferCapacity(jenv, $input);
+}
+
+/* The borrowing variant shares the same zero copy mapping */
+%typemap(jni) (void * buffer, size_t size) "jobject"
+%typemap(jtype) (void * buffer, size_t size) "java.nio.ByteBuffer"
+%typemap(jstype) (void * buffer, size_t size) "java.nio.ByteBuffer"
+%typemap(javain) (void * buffer, size_t size) "$javainput"
+
+%typemap(in) (void * buffer, size_t size) = (const void * buffer, size_t size);
+
+/**
+*  @brief
+*    Surface buffer extraction as a direct ByteBuffer wrapping the
+*    native memory of the value; the buffer stays valid until the
+*    value is destroyed, callers must keep the value alive while
+*    they read through the buffer
+*/
+%typemap(jni) void * metacall_value_to_buffer "jobject"
+%typemap(jtype) void * metacall_value_to_buffer "java.nio.ByteBuffer"
+%typemap(jstype) void * metacall_value_to_buffer "java.nio.ByteBuffer"
+%typemap(javaout) void * metacall_value_to_buffer
+{
+	return $jnicall;
+}
+
+%typemap(out) void * metacall_value_to_buffer
+{
+	$result = (*jenv)->NewDirectByteBuffer(jenv, $1, (jlong)metacall_value_size(arg1));
+}
+
 /**
 *  @brief
 *    Transform load mechanism from Java list into
@@ -82,6 +82,32 @@ const metacall = (name, ...args) => {
 	return addon.metacall(name, ...args);
 };
 
+/* Per function call stubs, each stub wraps the function pointer resolved
+once by the addon so repeated calls skip the by-name lookup */
+const metacall_function_cache = new Map();
+
+const metacall_function = (name) => {
+	if (Object.prototype.toString.call(name) !== '[object String]') {
+		throw Error('Function name should be of string type.');
+	}
+
+	let stub = metacall_function_cache.get(name);
+
+	if (stub === undefined) {
+		const func = addon.metacall_function(name);
+
+		if (func === null) {
+			return null;
+		}
+
+		stub = (...args) => addon.metacall_function_invoke(func, ...args);
+
+		metacall_function_cache.set(name, stub);
+	}
+
+	return stub;
+};
+
 const metacall_load_from_file = (tag, paths) => {
 	if (Object.prototype.toString.call(tag) !== '[object String]') {
 		throw Error('Tag should be a string indicating the id of the loader to be used [py, rb, cs, js, node, mock...].');
@@ -168,6 +194,7 @@ const metacall_require = (tag, name) => {
 /* Module exports */
 const module_exports = {
 	metacall,
+	metacall_function,
 	metacall_inspect,
 	metacall_load_from_file,
 	metacall_load_from_file_export,
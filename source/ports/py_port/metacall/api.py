@@ -46,13 +46,25 @@ if module == None:
 	print('\x1b[33m\x1b[1m', 'If you have it installed in an non-standard folder, please define os.environ[\'LOADER_LIBRARY_PATH\'].', '\x1b[0m')
 	raise ImportError('MetaCall Python Port was not found')
 
+# Generation counter bumped on every successful load, cached wrapper
+# modules built under an older generation are regenerated on import
+__metacall_load_generation__ = 0
+
 # Load from file
 def metacall_load_from_file(tag, paths):
-	return module.metacall_load_from_file(tag, paths)
+	global __metacall_load_generation__
+	result = module.metacall_load_from_file(tag, paths)
+	if result:
+		__metacall_load_generation__ += 1
+	return result
 
 # Load from memory
 def metacall_load_from_memory(tag, buffer):
-	return module.metacall_load_from_memory(tag, buffer)
+	global __metacall_load_generation__
+	result = module.metacall_load_from_memory(tag, buffer)
+	if result:
+		__metacall_load_generation__ += 1
+	return result
 
 # Invocation
 def metacall(function_name, *args):
@@ -79,6 +91,10 @@ import functools
 # Save the original Python import
 __python_import__ = builtins.__import__
 
+# Cache of generated wrapper modules, keyed by import name and stamped
+# with the load generation they were built at
+__metacall_module_cache__ = {}
+
 def __metacall_import__(name, globals=None, locals=None, fromlist=(), level=0):
 	def find_handle(handle_name):
 		metadata = metacall_inspect()
@@ -109,11 +125,16 @@ def __metacall_import__(name, globals=None, locals=None, fromlist=(), level=0):
 		# 	mod.__package__ = '.'.join(handle_name.split('.')[:-1])
 		mod.__package__ = handle_name
 
-		# Add the symbols to the module
-		symbol_dict = dict(functools.reduce(lambda symbols, func: {**symbols, func['name']: lambda *args: metacall(func['name'], *args) }, handle['scope']['funcs'], {}))
+		# Add the symbols to the module, binding each function through a C
+		# implemented partial over the extension call so invocations do not
+		# allocate a frame for a Python level trampoline closure
+		symbol_dict = { func['name']: functools.partial(module.metacall, func['name']) for func in handle['scope']['funcs'] }
 
 		mod.__dict__.update(symbol_dict)
 
+		# Cache the module so repeated imports become a dictionary lookup
+		__metacall_module_cache__[name] = (__metacall_load_generation__, mod)
+
 		return mod
 
 	# Map file extension to tags
@@ -153,6 +174,13 @@ def __metacall_import__(name, globals=None, locals=None, fromlist=(), level=0):
 	if mod:
 		return mod
 
+	# Resolve from the wrapper module cache unless a load happened since
+	# it was generated, in which case the module is rebuilt below
+	cached = __metacall_module_cache__.get(name)
+
+	if cached != None and cached[0] == __metacall_load_generation__:
+		return cached[1]
+
 	# Obtain the extension of the module if any
 	extension = None if name.count('.') == 0 else name.split('.')[-1]
 
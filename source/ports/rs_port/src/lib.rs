@@ -39,11 +39,14 @@ extern "C" {
     fn metacall_value_create_float(f: c_float) -> *mut c_void;
     fn metacall_value_create_double(d: c_double) -> *mut c_void;
     fn metacall_value_create_bool(b: c_int) -> *mut c_void;
-    fn metacall_value_create_string(st: *const c_char, ln: usize) -> *mut c_void;
+    fn metacall_value_create_string_n(st: *const c_char, ln: usize) -> *mut c_void;
+    fn metacall_value_create_buffer_view(buf: *mut c_void, sz: usize) -> *mut c_void;
     fn metacall_value_create_char(st: c_char) -> *mut c_void;
     fn metacall_value_destroy(v: *mut c_void);
     fn metacall_value_id(v: *mut c_void) -> c_int;
+    fn metacall_value_size(v: *mut c_void) -> usize;
     fn metacall_value_to_string(v: *mut c_void) -> *mut c_char;
+    fn metacall_value_to_buffer(v: *mut c_void) -> *mut c_void;
     fn metacall_value_to_char(v: *mut c_void) -> c_char;
     fn metacall_value_to_short(v: *mut c_void) -> c_short;
     fn metacall_value_to_int(v: *mut c_void) -> c_int;
@@ -111,6 +114,24 @@ impl From<c_double> for Any {
     }
 }
 
+/// Packs one argument into a raw MetaCall value; string slices are read
+/// length-delimited so no NUL-terminated intermediate copy is made, and
+/// buffers are borrowed from the slice for the duration of the call
+unsafe fn value_create_arg(arg: &Any) -> *mut c_void {
+    match arg {
+        Any::Short(x) => metacall_value_create_short(*x),
+        Any::Int(x) => metacall_value_create_int(*x),
+        Any::Long(x) => metacall_value_create_long(*x),
+        Any::Float(x) => metacall_value_create_float(*x),
+        Any::Double(x) => metacall_value_create_double(*x),
+        Any::Bool(x) => metacall_value_create_bool(*x as c_int),
+        Any::Char(x) => metacall_value_create_char(*x as c_char),
+        Any::Str(x) => metacall_value_create_string_n(x.as_ptr() as *const c_char, x.len()),
+        Any::Buffer(x) => metacall_value_create_buffer_view(x.as_ptr() as *mut c_void, x.len()),
+        _ => todo!(),
+    }
+}
+
 pub fn initialize() -> Result<(), &'static str> {
     if unsafe { metacall_initialize() } != 0 {
         Err("Metacall failed to initialize")
@@ -160,23 +181,7 @@ pub fn metacall<'a>(
         if c_func.is_null() {
             return Err("Function Not Found");
         }
-        let mut c_args: Vec<*mut c_void> = args
-            .into_iter()
-            .map(|arg| match arg {
-                Any::Short(x) => metacall_value_create_short(*x),
-                Any::Int(x) => metacall_value_create_int(*x),
-                Any::Long(x) => metacall_value_create_long(*x),
-                Any::Float(x) => metacall_value_create_float(*x),
-                Any::Double(x) => metacall_value_create_double(*x),
-                Any::Bool(x) => metacall_value_create_bool(*x as c_int),
-                Any::Char(x) => metacall_value_create_char(*x as c_char),
-                Any::Str(x) => {
-                    let st = CString::new(x.as_str()).expect("can't convert to c str");
-                    metacall_value_create_string(st.as_ptr(), x.len())
-                }
-                _ => todo!(),
-            })
-            .collect();
+        let mut c_args: Vec<*mut c_void> = args.into_iter().map(|arg| value_create_arg(arg)).collect();
         let ret: *mut c_void = metacallfv_s(c_func, c_args.as_mut_ptr(), c_args.len());
         let mut rt = Any::Null;
         if !ret.is_null() {
@@ -241,6 +246,81 @@ pub fn metacall<'a>(
     }
 }
 
+/// Owned handle over a raw MetaCall value which exposes string and
+/// buffer payloads as slices borrowed from the value itself, so large
+/// returns reach Rust without being copied into owned containers; the
+/// borrows are tied to the lifetime of the view and the underlying
+/// value is destroyed when the view is dropped
+pub struct ValueView {
+    v: *mut c_void,
+}
+
+impl ValueView {
+    /// Borrow the payload of a string value, length delimited through
+    /// the value size so no NUL scan or copy takes place
+    pub fn as_str(&self) -> Option<&str> {
+        unsafe {
+            /* TODO: This should be done by an enum or something mimicking the enum in metacall.h */
+            if metacall_value_id(self.v) != 7 {
+                return None;
+            }
+            let ptr = metacall_value_to_string(self.v) as *const u8;
+            if ptr.is_null() {
+                return None;
+            }
+            let len = metacall_value_size(self.v).saturating_sub(1);
+            std::str::from_utf8(std::slice::from_raw_parts(ptr, len)).ok()
+        }
+    }
+
+    /// Borrow the payload of a buffer value
+    pub fn as_bytes(&self) -> Option<&[u8]> {
+        unsafe {
+            if metacall_value_id(self.v) != 8 {
+                return None;
+            }
+            let ptr = metacall_value_to_buffer(self.v) as *const u8;
+            if ptr.is_null() {
+                return None;
+            }
+            Some(std::slice::from_raw_parts(ptr, metacall_value_size(self.v)))
+        }
+    }
+}
+
+impl Drop for ValueView {
+    fn drop(&mut self) {
+        unsafe {
+            metacall_value_destroy(self.v);
+        }
+    }
+}
+
+/// Same call protocol as `metacall` but the result is handed back as a
+/// `ValueView` instead of being converted into an owned `Any`, avoiding
+/// the copy of large string and buffer returns
+pub fn metacall_view<'a>(
+    func: &str,
+    args: impl IntoIterator<Item = &'a Any>,
+) -> Result<ValueView, &'static str> {
+    let c_function = CString::new(func).expect("Conversion to C String failed");
+    unsafe {
+        let c_func: *mut c_void = metacall_function(c_function.as_ptr());
+        if c_func.is_null() {
+            return Err("Function Not Found");
+        }
+        let mut c_args: Vec<*mut c_void> = args.into_iter().map(|arg| value_create_arg(arg)).collect();
+        let ret: *mut c_void = metacallfv_s(c_func, c_args.as_mut_ptr(), c_args.len());
+        for arg in c_args {
+            metacall_value_destroy(arg);
+        }
+        if ret.is_null() {
+            return Err("Function call failed");
+        }
+        Ok(ValueView { v: ret })
+    }
+}
+
 pub fn destroy() {
     unsafe {
         metacall_destroy();
@@ -26,6 +26,7 @@
 #include <reflect/reflect_context.h>
 #include <reflect/reflect_function.h>
 #include <reflect/reflect_future.h>
+#include <reflect/reflect_stream.h>
 #include <reflect/reflect_scope.h>
 #include <reflect/reflect_signature.h>
 #include <reflect/reflect_type.h>
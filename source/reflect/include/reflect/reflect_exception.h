@@ -31,8 +31,39 @@ struct exception_type;
 
 typedef struct exception_type *exception;
 
+/* Invoked at most once on first access of the message or stack trace,
+the callback stores malloc allocated strings owned by the exception */
+typedef int (*exception_lazy_callback)(void *, char **, char **);
+
+typedef void (*exception_lazy_destroy)(void *);
+
 REFLECT_API exception exception_create(const char *message, const char *label, int code, const char *stacktrace);
 
+/**
+*  @brief
+*    Create an exception which defers message and stack trace formatting
+*    to @callback on first access, handlers that never read them skip the cost
+*
+*  @param[in] callback
+*    Callback formatting the message and stack trace on demand
+*
+*  @param[in] context_destroy
+*    Callback releasing @context, called after formatting or on destruction
+*
+*  @param[in] context
+*    Producer owned state needed for formatting (e.g. a runtime exception object)
+*
+*  @param[in] label
+*    Label of the exception, copied eagerly
+*
+*  @param[in] code
+*    Numeric code of the exception
+*
+*  @return
+*    Pointer to the exception on success, null otherwise
+*/
+REFLECT_API exception exception_create_lazy(exception_lazy_callback callback, exception_lazy_destroy context_destroy, void *context, const char *label, int code);
+
 REFLECT_API const char *exception_message(exception ex);
 
 REFLECT_API const char *exception_label(exception ex);
@@ -24,10 +24,16 @@
 #include <reflect/reflect_signature.h>
 #include <reflect/reflect_value.h>
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define FUNCTION_STATS_HISTOGRAM_SIZE 0x40
+
+#define FUNCTION_BRIDGE_CACHE_SIZE 0x04
+
 struct function_type;
 
 typedef void *function_impl;
@@ -50,6 +56,8 @@ typedef function_return (*function_impl_interface_await)(function, function_impl
 
 typedef void (*function_impl_interface_destroy)(function, function_impl);
 
+typedef int (*function_impl_interface_invoke_batch)(function, function_impl, void **[], size_t, size_t, function_return[]);
+
 typedef struct function_interface_type
 {
 	function_impl_interface_create create;
@@ -57,6 +65,10 @@ typedef struct function_interface_type
 	function_impl_interface_await await;
 	function_impl_interface_destroy destroy;
 
+	/* Optional entry, loaders implementing it receive the whole batch in a
+	single crossing of the language boundary instead of one invoke per call */
+	function_impl_interface_invoke_batch invoke_batch;
+
 } * function_interface;
 
 enum function_async_id
@@ -65,6 +77,16 @@ enum function_async_id
 	FUNCTION_ASYNC = 1
 };
 
+/* Per function instrumentation counters, recorded by function_call when
+enabled through function_stats_enable; the histogram buckets elapsed
+time in nanoseconds by log2 */
+struct function_stats_type
+{
+	size_t count;
+	uint64_t total_time;
+	uint64_t histogram[FUNCTION_STATS_HISTOGRAM_SIZE];
+};
+
 typedef function_interface (*function_impl_interface_singleton)(void);
 
 REFLECT_API function function_create(const char *name, size_t args_count, function_impl impl, function_impl_interface_singleton singleton);
@@ -81,16 +103,78 @@ REFLECT_API void function_bind(function func, void *data);
 
 REFLECT_API void *function_closure(function func);
 
+REFLECT_API function_impl function_impl_get(function func);
+
+/* The interface identifies the runtime behind the function, callers
+can compare it against a known singleton to special case dispatch */
+REFLECT_API function_interface function_interface_get(function func);
+
+/* Destructor of a cached cross runtime trampoline, fired when the
+bridge is replaced or the function goes away */
+typedef void (*function_bridge_destroy_cb)(function func, void *bridge);
+
+/* Per direction trampoline cache for callbacks crossing runtimes;
+@direction is an opaque key identifying the destination runtime
+(conventionally its interface singleton), so a callback dispatched
+repeatedly into the same runtime builds its bridge (bound reference,
+conversion plan) once and reuses it afterwards. The cache holds
+FUNCTION_BRIDGE_CACHE_SIZE directions, set fails once full and the
+caller falls back to building the bridge per call */
+REFLECT_API void *function_bridge_get(function func, const void *direction);
+
+REFLECT_API int function_bridge_set(function func, const void *direction, void *bridge, function_bridge_destroy_cb destroy_cb);
+
+REFLECT_API void function_bridge_clear(function func);
+
 REFLECT_API const char *function_name(function func);
 
 REFLECT_API signature function_signature(function func);
 
 REFLECT_API value function_metadata(function func);
 
+REFLECT_API void function_metadata_invalidate(function func);
+
+/* Swaps the implementation of @src into @dst keeping the identity of
+@dst intact, cached function pointers stay valid across a reload; the
+displaced implementation is destroyed with @src */
+REFLECT_API int function_rebind(function dst, function src);
+
 REFLECT_API function_return function_call(function func, function_args args, size_t size);
 
+/* Opt the function in or out of the validating invoke pipeline; the
+pipeline is selected once so release-mode calls run without residual
+arity or null checks, while individual functions can be switched to
+validation at run time for debugging (debug builds default to it) */
+REFLECT_API void function_validate_enable(function func, int enable);
+
+REFLECT_API int function_validate_enabled(function func);
+
+REFLECT_API int function_call_batch(function func, void **args[], size_t size, size_t count, function_return results[]);
+
+REFLECT_API void function_stats_enable(int enable);
+
+REFLECT_API int function_stats(function func, struct function_stats_type *stats);
+
+REFLECT_API void function_stats_clear(function func);
+
+/* Watchdog sampler invoked from the monitor thread when an in flight
+call exceeds the configured threshold; loaders register runtime
+specific samplers that capture the runtime side stack, elapsed time
+comes in nanoseconds */
+typedef void (*function_watchdog_sampler)(function func, uint64_t elapsed, void *data);
+
+REFLECT_API int function_watchdog_initialize(uint64_t threshold);
+
+REFLECT_API int function_watchdog_register(function_watchdog_sampler sampler, void *data);
+
+REFLECT_API void function_watchdog_destroy(void);
+
 REFLECT_API function_return function_await(function func, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context);
 
+REFLECT_API int function_await_executor_initialize(void);
+
+REFLECT_API void function_await_executor_destroy(void);
+
 REFLECT_API void function_destroy(function func);
 
 #ifdef __cplusplus
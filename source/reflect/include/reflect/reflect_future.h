@@ -59,6 +59,26 @@ REFLECT_API future future_create(future_impl impl, future_impl_interface_singlet
 
 REFLECT_API future_return future_await(future f, future_resolve_callback resolve_callback, future_reject_callback reject_callback, void *context);
 
+/**
+*  @brief
+*    Await an array of futures with a single blocking point, @results receives
+*    one value per future owned by the caller (null for rejected or invalid futures)
+*
+*  @return
+*    Returns zero if all futures resolved, distinct from zero otherwise
+*/
+REFLECT_API int future_await_all(future futures[], size_t size, future_return results[]);
+
+/**
+*  @brief
+*    Await an array of futures until the first one completes, @index receives
+*    the position of the winner and @result its value owned by the caller
+*
+*  @return
+*    Returns zero if the first completed future resolved, distinct from zero otherwise
+*/
+REFLECT_API int future_await_any(future futures[], size_t size, size_t *index, future_return *result);
+
 REFLECT_API void future_destroy(future f);
 
 #ifdef __cplusplus
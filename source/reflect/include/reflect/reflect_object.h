@@ -55,6 +55,32 @@ typedef int (*object_impl_interface_destructor)(object, object_impl);
 
 typedef void (*object_impl_interface_destroy)(object, object_impl);
 
+struct object_attribute_type;
+
+typedef struct object_attribute_type *object_attribute;
+
+typedef void *object_attribute_impl;
+
+struct object_method_type;
+
+typedef struct object_method_type *object_method;
+
+typedef void *object_method_impl;
+
+typedef int (*object_impl_interface_method_resolve)(object, object_impl, const char *, object_method_impl *);
+
+typedef value (*object_impl_interface_method_invoke_handle)(object, object_impl, object_method_impl, object_args, size_t);
+
+typedef void (*object_impl_interface_method_destroy)(object, object_impl, object_method_impl);
+
+typedef int (*object_impl_interface_attribute_resolve)(object, object_impl, const char *, object_attribute_impl *);
+
+typedef value (*object_impl_interface_attribute_get)(object, object_impl, object_attribute_impl);
+
+typedef int (*object_impl_interface_attribute_set)(object, object_impl, object_attribute_impl, value);
+
+typedef void (*object_impl_interface_attribute_destroy)(object, object_impl, object_attribute_impl);
+
 typedef struct object_interface_type
 {
 	object_impl_interface_create create;
@@ -65,6 +91,19 @@ typedef struct object_interface_type
 	object_impl_interface_destructor destructor;
 	object_impl_interface_destroy destroy;
 
+	/* Optional attribute handle support, loaders without it fall
+	back to the string keyed get and set methods */
+	object_impl_interface_attribute_resolve attribute_resolve;
+	object_impl_interface_attribute_get attribute_get;
+	object_impl_interface_attribute_set attribute_set;
+	object_impl_interface_attribute_destroy attribute_destroy;
+
+	/* Optional method handle support, loaders without it fall
+	back to the string keyed method_invoke */
+	object_impl_interface_method_resolve method_resolve;
+	object_impl_interface_method_invoke_handle method_invoke_handle;
+	object_impl_interface_method_destroy method_destroy;
+
 } * object_interface;
 
 typedef object_interface (*object_impl_interface_singleton)(void);
@@ -81,8 +120,38 @@ REFLECT_API int object_set(object obj, const char *key, value v);
 
 REFLECT_API value object_get(object obj, const char *key);
 
+/**
+*  @brief
+*    Resolve the attribute @key of @obj once into an opaque accessor,
+*    get and set through the handle skip the per access key lookup
+*
+*  @return
+*    Pointer to the attribute handle owned by the caller, null otherwise
+*/
+REFLECT_API object_attribute object_attribute_resolve(object obj, const char *key);
+
+REFLECT_API value object_attribute_get(object_attribute attr);
+
+REFLECT_API int object_attribute_set(object_attribute attr, value v);
+
+REFLECT_API void object_attribute_destroy(object_attribute attr);
+
 REFLECT_API value object_call(object obj, const char *name, object_args args, size_t size);
 
+/**
+*  @brief
+*    Resolve the method @name of @obj once into an opaque token,
+*    calls through the token skip the per call name lookup
+*
+*  @return
+*    Pointer to the method handle owned by the caller, null otherwise
+*/
+REFLECT_API object_method object_method_resolve(object obj, const char *name);
+
+REFLECT_API value object_method_call(object_method method, object_args args, size_t size);
+
+REFLECT_API void object_method_destroy(object_method method);
+
 REFLECT_API value object_await(object obj, const char *name, object_args args, size_t size, object_resolve_callback resolve_callback, object_reject_callback reject_callback, void *context);
 
 REFLECT_API const char *object_name(object obj);
@@ -36,6 +36,8 @@ typedef size_t scope_stack_ptr;
 
 typedef struct scope_type *scope;
 
+typedef int (*scope_iterate_cb)(scope sp, const char *key, value v, void *data);
+
 REFLECT_API scope scope_create(const char *name);
 
 REFLECT_API size_t scope_size(scope sp);
@@ -44,12 +46,24 @@ REFLECT_API int scope_define(scope sp, const char *key, value obj);
 
 REFLECT_API value scope_metadata(scope sp);
 
+/* Like scope_metadata but only emits the objects whose name starts
+with @name_prefix (NULL or empty prefix matches everything), so
+partial inspects build only the requested subtree */
+REFLECT_API value scope_metadata_filter(scope sp, const char *name_prefix);
+
 REFLECT_API value scope_export(scope sp);
 
 REFLECT_API value scope_get(scope sp, const char *key);
 
+REFLECT_API int scope_iterate(scope sp, scope_iterate_cb iterate_cb, void *data);
+
 REFLECT_API value scope_undef(scope sp, const char *key);
 
+/* Probe the process wide filter of defined names, returns zero when
+@key may be defined in some scope and different from zero when it is
+definitely defined nowhere, so callers can skip probing every scope */
+REFLECT_API int scope_filter_probe(const char *key);
+
 REFLECT_API int scope_append(scope dest, scope src);
 
 REFLECT_API int scope_contains(scope dest, scope src);
@@ -0,0 +1,105 @@
+/*
+ *	Reflect Library by Parra Studios
+ *	A library for provide reflection and metadata representation.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef REFLECT_STREAM_H
+#define REFLECT_STREAM_H 1
+
+#include <reflect/reflect_value.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct stream_type;
+
+typedef void *stream_impl;
+
+typedef struct stream_type *stream;
+
+typedef int (*stream_impl_interface_create)(stream, stream_impl);
+
+typedef value (*stream_impl_interface_next)(stream, stream_impl);
+
+typedef void (*stream_impl_interface_destroy)(stream, stream_impl);
+
+typedef struct stream_interface_type
+{
+	stream_impl_interface_create create;
+	stream_impl_interface_next next;
+	stream_impl_interface_destroy destroy;
+
+} * stream_interface;
+
+typedef stream_interface (*stream_impl_interface_singleton)(void);
+
+REFLECT_API stream stream_create(stream_impl impl, stream_impl_interface_singleton singleton);
+
+/**
+*  @brief
+*    Pull the next item out of the stream @s, the item is produced
+*    lazily by the owning runtime (a generator, an async iterator)
+*    instead of materializing the whole sequence up front
+*
+*  @param[in] s
+*    Reference to the stream
+*
+*  @return
+*    Value owned by the caller, null once the stream is exhausted
+*/
+REFLECT_API value stream_next(stream s);
+
+/**
+*  @brief
+*    Pull up to @size items out of the stream @s into @results,
+*    amortizing the per item dispatch overhead over the chunk
+*
+*  @param[in] s
+*    Reference to the stream
+*
+*  @param[out] results
+*    Array receiving the values, owned by the caller
+*
+*  @param[in] size
+*    Capacity of @results
+*
+*  @return
+*    Number of items pulled, less than @size only at exhaustion
+*/
+REFLECT_API size_t stream_next_batch(stream s, value results[], size_t size);
+
+/**
+*  @brief
+*    Check if the stream @s was already exhausted by a previous pull
+*
+*  @param[in] s
+*    Reference to the stream
+*
+*  @return
+*    Non zero once the stream returned its last item
+*/
+REFLECT_API int stream_end(stream s);
+
+REFLECT_API void stream_destroy(stream s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REFLECT_STREAM_H */
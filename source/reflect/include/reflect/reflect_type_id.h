@@ -46,6 +46,8 @@ enum type_primitive_id
 	TYPE_NULL = 14,
 	TYPE_CLASS = 15,
 	TYPE_OBJECT = 16,
+	TYPE_TYPED_ARRAY = 17,
+	TYPE_STREAM = 18,
 
 	TYPE_SIZE,
 	TYPE_INVALID
@@ -233,6 +235,30 @@ REFLECT_API int type_id_class(type_id id);
 */
 REFLECT_API int type_id_object(type_id id);
 
+/**
+*  @brief
+*    Check if type id is typed array value (contiguous typed buffer)
+*
+*  @param[in] id
+*    Type id to be checked
+*
+*  @return
+*    Returns zero if type is typed array, different from zero otherwhise
+*/
+REFLECT_API int type_id_typed_array(type_id id);
+
+/**
+*  @brief
+*    Check if type id is stream value (stream)
+*
+*  @param[in] id
+*    Type id to be checked
+*
+*  @return
+*    Returns zero if type is stream, different from zero otherwhise
+*/
+REFLECT_API int type_id_stream(type_id id);
+
 /**
 *  @brief
 *    Check if type id is invalid
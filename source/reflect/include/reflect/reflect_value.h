@@ -45,6 +45,10 @@ typedef void *value;
 
 typedef void (*value_finalizer_cb)(value, void *);
 
+typedef void (*value_destroy_cb)(value);
+
+typedef void *(*value_alloc_bind_cb)(void *, size_t);
+
 /* -- Methods -- */
 
 /**
@@ -59,6 +63,110 @@ typedef void (*value_finalizer_cb)(value, void *);
 */
 REFLECT_API value value_alloc(size_t bytes);
 
+/**
+*  @brief
+*    Route every value allocation of the calling thread through
+*    @callback (request pool embeddings like nginx bind their pool
+*    here); the values come out flagged as caller owned storage so
+*    destroying them runs finalizers but never frees, the pool
+*    reclaims them all at once, and when the pool is exhausted the
+*    allocation falls back to the regular path; a null @callback
+*    restores the default allocator
+*
+*  @param[in] callback
+*    Allocation callback receiving @ctx and the total size in bytes
+*    (header included, see @value_alloc_size), null to unbind
+*
+*  @param[in] ctx
+*    Context passed through to @callback on every allocation
+*
+*  @return
+*    Zero on success, different from zero when the platform lacks
+*    thread local storage support
+*/
+REFLECT_API int value_alloc_bind(value_alloc_bind_cb callback, void *ctx);
+
+/**
+*  @brief
+*    Returns the total storage in bytes required to hold a value
+*    with size @bytes, including the value header
+*
+*  @param[in] bytes
+*    Size in bytes of the value body
+*
+*  @return
+*    Size in bytes of header plus body
+*/
+REFLECT_API size_t value_alloc_size(size_t bytes);
+
+/**
+*  @brief
+*    Initialize a value with size @bytes into the caller owned
+*    memory block @buffer, which must be at least of size
+*    @value_alloc_size(@bytes); the resulting value is never freed
+*    by @value_destroy, the caller keeps the ownership of @buffer
+*
+*  @param[in] buffer
+*    Pointer to caller owned memory block
+*
+*  @param[in] bytes
+*    Size in bytes of the value body
+*
+*  @return
+*    Pointer to uninitialized value if success, null otherwhise
+*/
+REFLECT_API value value_alloc_static(void *buffer, size_t bytes);
+
+/**
+*  @brief
+*    Check if the value @v is stored inline into the handle itself
+*    instead of the heap; inline values are immutable, they do not
+*    provide an addressable body through @value_data and they are
+*    not destroyed by @value_destroy
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Different from zero if the value is inline, zero otherwise
+*/
+REFLECT_API int value_inline(value v);
+
+/**
+*  @brief
+*    Create a value from @data with size @bytes encoded inline into
+*    the handle itself, tagged with @tag, avoiding any heap allocation;
+*    only small payloads can be encoded and the encoding is unavailable
+*    on platforms without 64 bit pointers, in which case null is
+*    returned and the caller must fall back to a heap allocated value
+*
+*  @param[in] data
+*    Pointer to memory block
+*
+*  @param[in] bytes
+*    Size in bytes of the memory block @data
+*
+*  @param[in] tag
+*    Tag stored along the payload, defined by the upper layers
+*
+*  @return
+*    Pointer to value if success, null if the payload cannot be encoded
+*/
+REFLECT_API value value_inline_create(const void *data, size_t bytes, int tag);
+
+/**
+*  @brief
+*    Get the tag of the inline value @v previously stored
+*    by @value_inline_create
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Tag stored along the payload
+*/
+REFLECT_API int value_inline_tag(value v);
+
 /**
 *  @brief
 *    Create a value from @data with size @bytes
@@ -111,6 +219,25 @@ REFLECT_API void value_move(value src, value dst);
 */
 REFLECT_API size_t value_size(value v);
 
+/**
+*  @brief
+*    Shrink or grow the body of a value in place without reallocating,
+*    it succeeds only when @v is solely owned, neither inline nor a
+*    view, and @bytes fits in the existing allocation (the exact body
+*    size for heap and static values, the slab size class for pooled
+*    values)
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @param[in] bytes
+*    New size in bytes of the value body
+*
+*  @return
+*    Zero on success, different from zero when the allocation cannot be resized
+*/
+REFLECT_API int value_resize(value v, size_t bytes);
+
 /**
 *  @brief
 *    Increment reference count of a value
@@ -129,6 +256,31 @@ REFLECT_API void value_ref_inc(value v);
 */
 REFLECT_API void value_ref_dec(value v);
 
+/**
+*  @brief
+*    Drop one reference of value @v without destroying it, the caller
+*    that observes zero remaining owns the reclamation of the value
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Number of references remaining after the drop
+*/
+REFLECT_API size_t value_ref_release(value v);
+
+/**
+*  @brief
+*    Retrieve the reference count of a value
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Current number of references held on the value
+*/
+REFLECT_API size_t value_ref_count(value v);
+
 /**
 *  @brief
 *    Set up the value finalizer, a callback that
@@ -145,6 +297,88 @@ REFLECT_API void value_ref_dec(value v);
 */
 REFLECT_API void value_finalizer(value v, value_finalizer_cb finalizer, void *finalizer_data);
 
+/**
+*  @brief
+*    Mark the value @v as a view, its body holds a descriptor over
+*    memory owned by someone else instead of the data itself
+*
+*  @param[in] v
+*    Reference to the value
+*/
+REFLECT_API void value_view_mark(value v);
+
+/**
+*  @brief
+*    Check if the value @v is a view over borrowed memory
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Non zero when the value is a view
+*/
+REFLECT_API int value_view(value v);
+
+/**
+*  @brief
+*    Mark the value @v as immortal, the memory it borrows is
+*    guaranteed by the caller to live for the rest of the process so
+*    copies may keep borrowing it instead of duplicating
+*
+*  @param[in] v
+*    Reference to the value
+*/
+REFLECT_API void value_immortal_mark(value v);
+
+/**
+*  @brief
+*    Check if the value @v borrows memory with static lifetime
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Non zero when the borrowed memory is immortal
+*/
+REFLECT_API int value_immortal(value v);
+
+/**
+*  @brief
+*    Tag the value @v as holding validated UTF-8, set once at creation
+*    so boundaries crossing into runtimes skip revalidation
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @param[in] ascii
+*    Non zero when the content is additionally pure seven bit ASCII
+*/
+REFLECT_API void value_utf8_mark(value v, int ascii);
+
+/**
+*  @brief
+*    Check if the value @v was tagged as validated UTF-8
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Non zero when the content is known valid UTF-8
+*/
+REFLECT_API int value_utf8(value v);
+
+/**
+*  @brief
+*    Check if the value @v was tagged as pure seven bit ASCII
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Non zero when the content is known ASCII
+*/
+REFLECT_API int value_ascii(value v);
+
 /**
 *  @brief
 *    Get pointer reference to value data
@@ -190,6 +424,40 @@ REFLECT_API void value_to(value v, void *data, size_t bytes);
 */
 REFLECT_API value value_from(value v, const void *data, size_t bytes);
 
+/**
+*  @brief
+*    Enter an epoch protected read side critical section; values
+*    retired through @value_epoch_retire stay alive until every
+*    reader inside a section at retire time has exited, so readers
+*    can access shared values without touching the reference count
+*
+*  @return
+*    Zero on success, non zero when epoch protection is unavailable
+*    for this thread (the caller must fall back to reference counts)
+*/
+REFLECT_API int value_epoch_enter(void);
+
+/**
+*  @brief
+*    Leave the epoch protected read side critical section of the
+*    calling thread
+*/
+REFLECT_API void value_epoch_exit(void);
+
+/**
+*  @brief
+*    Retire the value @v, deferring its destruction until no epoch
+*    protected reader can still observe it; the callback runs at
+*    quiescence from the thread that detects it
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @param[in] destroy_cb
+*    Destructor to run at quiescence, @value_destroy when null
+*/
+REFLECT_API void value_epoch_retire(value v, value_destroy_cb destroy_cb);
+
 /**
 *  @brief
 *    Destroy a value from scope stack
@@ -199,6 +467,14 @@ REFLECT_API value value_from(value v, const void *data, size_t bytes);
 */
 REFLECT_API void value_destroy(value v);
 
+/**
+*  @brief
+*    Release the slab blocks backing the small value pool; must only
+*    be called when no values allocated through @value_alloc are
+*    alive, usually at library destruction
+*/
+REFLECT_API void value_pool_clear(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,6 +29,7 @@
 #include <reflect/reflect_function.h>
 #include <reflect/reflect_future.h>
 #include <reflect/reflect_object.h>
+#include <reflect/reflect_stream.h>
 #include <reflect/reflect_type_id.h>
 #include <reflect/reflect_value.h>
 #include <reflect/reflect_value_type_cast.h>
@@ -59,16 +60,103 @@ REFLECT_API value value_type_create(const void *data, size_t bytes, type_id id);
 
 /**
 *  @brief
-*    Make a deep copy of value @v
+*    Create a value type from @data with size @bytes and typeid @id
+*    into the caller owned memory block @buffer of size @size,
+*    avoiding any heap allocation; the resulting value is never
+*    freed by @value_destroy, the caller keeps the ownership of @buffer
+*
+*  @param[in] buffer
+*    Pointer to caller owned memory block
+*
+*  @param[in] size
+*    Size in bytes of the memory block @buffer
+*
+*  @param[in] data
+*    Pointer to memory block
+*
+*  @param[in] bytes
+*    Size in bytes of the memory block @data
+*
+*  @param[in] id
+*    Type of memory block @data
+*
+*  @return
+*    Pointer to value if success, null if @buffer cannot hold the value
+*/
+REFLECT_API value value_type_create_static(void *buffer, size_t size, const void *data, size_t bytes, type_id id);
+
+/**
+*  @brief
+*    Rewrite a value type in place over its existing allocation,
+*    replacing the body with @data of size @bytes and the type id
+*    trailer with @id without reallocating; it succeeds only when the
+*    value is solely owned, neither inline nor a view, and the new
+*    body fits in the allocation (see @value_resize), otherwise null
+*    is returned and @v is left untouched so the caller can fall back
+*    to @value_type_create
+*
+*  @param[in] v
+*    Reference to the value to be retyped
+*
+*  @param[in] data
+*    Pointer to the new body, null keeps the current body bytes
+*
+*  @param[in] bytes
+*    Size in bytes of the new body
+*
+*  @param[in] id
+*    New type of the value
+*
+*  @return
+*    Reference to @v retyped if success, null if the allocation cannot hold the new body
+*/
+REFLECT_API value value_type_retype(value v, const void *data, size_t bytes, type_id id);
+
+/**
+*  @brief
+*    Make a deep copy of value @v, the copy owns a private tree the
+*    caller can mutate freely through the accessors
 *
 *  @param[in] v
 *    Reference to the value is going to be copied
 *
 *  @return
-*    Pointer to a deep copy of new value if success, null otherwhise
+*    Pointer to a copy of new value if success, null otherwhise
 */
 REFLECT_API value value_type_copy(value v);
 
+/**
+*  @brief
+*    Make a shared copy of value @v: composite values (arrays and
+*    maps) share the handle with a reference count bump instead of
+*    deep copying, the holder must treat the contents as read only
+*    or call value_type_unshare before the first write; any other
+*    type falls back to value_type_copy
+*
+*  @param[in] v
+*    Reference to the value is going to be copied
+*
+*  @return
+*    Pointer to the shared value if success, null otherwhise
+*/
+REFLECT_API value value_type_copy_shared(value v);
+
+/**
+*  @brief
+*    Materialize a private copy of composite value @v if it is shared
+*    with other holders, must be called before mutating the contents
+*    of a value obtained from value_type_copy_shared (value_from_array
+*    and value_from_map do this themselves)
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Reference to a value private to the caller, @v itself when it
+*    was not shared, null if the copy failed
+*/
+REFLECT_API value value_type_unshare(value v);
+
 /**
 *  @brief
 *    Returns the size of the value type
@@ -204,6 +292,116 @@ REFLECT_API value value_create_double(double d);
 */
 REFLECT_API value value_create_string(const char *str, size_t length);
 
+/**
+*  @brief
+*    Enable or disable the hash-consing pool for short strings; while
+*    enabled value_create_string returns a shared reference counted
+*    value on repeated contents, so equal strings compare by pointer
+*    and retained result sets hold one allocation per distinct string.
+*    Disabling releases the references held by the pool
+*
+*  @param[in] enable
+*    Non zero enables the pool, zero disables and clears it
+*/
+REFLECT_API void value_string_pool_enable(int enable);
+
+/**
+*  @brief
+*    Check whether the string pool is active
+*
+*  @return
+*    Non zero when the pool is enabled
+*/
+REFLECT_API int value_string_pool_enabled(void);
+
+/**
+*  @brief
+*    Release the references held by the string pool, values still
+*    referenced by callers survive the clear
+*/
+REFLECT_API void value_string_pool_clear(void);
+
+/**
+*  @brief
+*    Create a string value borrowing the characters of @str instead
+*    of copying them; the caller keeps ownership of the string and must
+*    guarantee it outlives the value (attach a finalizer when the
+*    string has to be released with the value)
+*
+*  @param[in] str
+*    Null terminated string to be borrowed by the value
+*
+*  @param[in] length
+*    Length of the string without the null terminator
+*
+*  @return
+*    Pointer to string value if success, null otherwise
+*/
+REFLECT_API value value_create_string_view(const char *str, size_t length);
+
+/**
+*  @brief
+*    Create a string value borrowing the characters of @str without
+*    copy or free; the caller guarantees the characters live for the
+*    rest of the process (string literals, fixed tables), which lets
+*    value_type_copy share the value instead of deep copying it
+*
+*  @param[in] str
+*    Null terminated string with static lifetime to be borrowed
+*
+*  @param[in] length
+*    Length of the string without the null terminator
+*
+*  @return
+*    Pointer to string value if success, null otherwise
+*/
+REFLECT_API value value_create_string_static(const char *str, size_t length);
+
+/**
+*  @brief
+*    Check if the string value @v was validated as well formed UTF-8
+*    when it was created; boundaries that require valid UTF-8 query
+*    this flag instead of rescanning the characters
+*
+*  @param[in] v
+*    Reference to the string value
+*
+*  @return
+*    Non zero when the content is known valid UTF-8
+*/
+REFLECT_API int value_type_string_utf8(value v);
+
+/**
+*  @brief
+*    Check if the string value @v contains only seven bit ASCII, a
+*    stronger guarantee than value_type_string_utf8 which enables one
+*    byte fast paths in runtime conversions
+*
+*  @param[in] v
+*    Reference to the string value
+*
+*  @return
+*    Non zero when the content is known ASCII
+*/
+REFLECT_API int value_type_string_ascii(value v);
+
+/**
+*  @brief
+*    Create a string value from the character block @str of @length
+*    bytes which does not need to be null terminated; only @length
+*    characters are read and the value writes its own terminator
+*
+*  @param[in] str
+*    Character block to be copied into the value
+*
+*  @param[in] length
+*    Number of characters to copy from the block
+*
+*  @return
+*    Pointer to string value if success, null otherwise
+*/
+REFLECT_API value value_create_string_n(const char *str, size_t length);
+
 /**
 *  @brief
 *    Create a value buffer from array @buffer
@@ -219,6 +417,24 @@ REFLECT_API value value_create_string(const char *str, size_t length);
 */
 REFLECT_API value value_create_buffer(const void *buffer, size_t size);
 
+/**
+*  @brief
+*    Create a buffer value borrowing the memory block @buffer instead
+*    of copying it; the caller keeps ownership of the block and must
+*    guarantee it outlives the value (attach a finalizer when the
+*    block has to be released with the value)
+*
+*  @param[in] buffer
+*    Memory block to be borrowed by the value
+*
+*  @param[in] size
+*    Size in bytes of the memory block
+*
+*  @return
+*    Pointer to buffer value if success, null otherwise
+*/
+REFLECT_API value value_create_buffer_view(void *buffer, size_t size);
+
 /**
 *  @brief
 *    Create a value array from array of values @values
@@ -234,6 +450,44 @@ REFLECT_API value value_create_buffer(const void *buffer, size_t size);
 */
 REFLECT_API value value_create_array(const value *values, size_t size);
 
+/**
+*  @brief
+*    Create a typed array value from contiguous memory block @data
+*
+*  @param[in] data
+*    Constant memory block of elements will be copied into the value,
+*    or null to leave the elements zeroed
+*
+*  @param[in] count
+*    Number of elements contained in the block
+*
+*  @param[in] id
+*    Type id of the elements, it must be a numeric primitive
+*
+*  @return
+*    Pointer to value if success, null otherwhise
+*/
+REFLECT_API value value_create_typed_array(const void *data, size_t count, type_id id);
+
+/**
+*  @brief
+*    Create a typed array value borrowing the contiguous memory block @data,
+*    the block is neither copied nor freed so it must outlive the value
+*
+*  @param[in] data
+*    Memory block of elements viewed by the value
+*
+*  @param[in] count
+*    Number of elements contained in the block
+*
+*  @param[in] id
+*    Type id of the elements, it must be a numeric primitive
+*
+*  @return
+*    Pointer to value if success, null otherwhise
+*/
+REFLECT_API value value_create_typed_array_view(void *data, size_t count, type_id id);
+
 /**
 *  @brief
 *    Create a value map from array of tuples @map
@@ -273,6 +527,18 @@ REFLECT_API value value_create_ptr(const void *ptr);
 */
 REFLECT_API value value_create_future(future f);
 
+/**
+*  @brief
+*    Create a value from stream @s
+*
+*  @param[in] s
+*    Pointer to stream will be copied into value
+*
+*  @return
+*    Pointer to value if success, null otherwhise
+*/
+REFLECT_API value value_create_stream(stream s);
+
 /**
 *  @brief
 *    Create a value from function @f
@@ -453,6 +719,62 @@ REFLECT_API void *value_to_buffer(value v);
 */
 REFLECT_API value *value_to_array(value v);
 
+/**
+*  @brief
+*    Convert value @v to a pointer to its contiguous typed element block
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Value converted to memory block
+*/
+REFLECT_API void *value_to_typed_array(value v);
+
+/**
+*  @brief
+*    Obtain the element type id of typed array value @v
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Type id of the elements of the typed array
+*/
+REFLECT_API type_id value_typed_array_type_id(value v);
+
+/**
+*  @brief
+*    Obtain the number of elements of typed array value @v
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Number of elements contained in the typed array
+*/
+REFLECT_API size_t value_typed_array_count(value v);
+
+/**
+*  @brief
+*    Retag the element type of typed array value @v in place, the
+*    element block keeps its byte capacity so only conversions to an
+*    equal or smaller element type are accepted, and the value must
+*    own its block exclusively (neither borrowed, a view nor shared);
+*    the caller is responsible for converting the element bytes, the
+*    descriptor alone is rewritten here
+*
+*  @param[in] v
+*    Reference to the typed array value
+*
+*  @param[in] id
+*    New element type id, it must be a numeric primitive
+*
+*  @return
+*    Reference to @v retagged if success, null if the block cannot be reused
+*/
+REFLECT_API value value_typed_array_retype(value v, type_id id);
+
 /**
 *  @brief
 *    Convert value @v to map
@@ -465,6 +787,23 @@ REFLECT_API value *value_to_array(value v);
 */
 REFLECT_API value *value_to_map(value v);
 
+/**
+*  @brief
+*    Obtain the value stored in map value @v under key @key,
+*    large maps are backed by a hash index built on first access
+*    so the lookup does not degrade to a linear scan
+*
+*  @param[in] v
+*    Reference to the map value
+*
+*  @param[in] key
+*    Key string to look up
+*
+*  @return
+*    Value of the tuple matching @key, null if not present
+*/
+REFLECT_API value value_type_map_get(value v, const char *key);
+
 /**
 *  @brief
 *    Convert value @v to pointer
@@ -489,6 +828,18 @@ REFLECT_API void *value_to_ptr(value v);
 */
 REFLECT_API future value_to_future(value v);
 
+/**
+*  @brief
+*    Convert value @v to stream
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Value converted to stream
+*/
+REFLECT_API stream value_to_stream(value v);
+
 /**
 *  @brief
 *    Convert value @v to function
@@ -745,6 +1096,21 @@ REFLECT_API value value_from_ptr(value v, const void *ptr);
 */
 REFLECT_API value value_from_future(value v, future f);
 
+/**
+*  @brief
+*    Assign stream reference @s to value @v
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @param[in] s
+*    Stream to be assigned to value @v
+*
+*  @return
+*    Value with stream @s assigned to it
+*/
+REFLECT_API value value_from_stream(value v, stream s);
+
 /**
 *  @brief
 *    Assign function reference @f to value @v
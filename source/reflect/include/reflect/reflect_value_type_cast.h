@@ -49,6 +49,26 @@ extern "C" {
 */
 REFLECT_API value value_type_cast(value v, type_id id);
 
+/**
+*  @brief
+*    Casts the elements of a typed array (or an array of uniform
+*    numeric values) to the element type @id in bulk, the conversion
+*    kernel is selected once per (source, destination) type pair so
+*    large payloads convert in a tight loop instead of per element
+*    switch dispatch
+*
+*  @param[in] v
+*    Reference to the typed array or array value
+*
+*  @param[in] id
+*    New element type id, it must be a numeric primitive
+*
+*  @return
+*    Typed array value with the casted elements, reference to @v if
+*    the elements already have type @id, or null on error
+*/
+REFLECT_API value value_type_cast_array(value v, type_id id);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,71 @@
+/*
+ *	Reflect Library by Parra Studios
+ *	A library for provide reflection and metadata representation.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef REFLECT_VALUE_TYPE_TRAITS_H
+#define REFLECT_VALUE_TYPE_TRAITS_H 1
+
+/* -- Headers -- */
+
+#include <reflect/reflect_api.h>
+
+#include <reflect/reflect_type_id.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Headers -- */
+
+#include <stdlib.h>
+
+/* -- Type Definitions -- */
+
+/* Compile time constant traits of a type id, generated in one dense
+table so hot paths query them with a single array load instead of a
+function call with a switch */
+struct value_type_traits_type
+{
+	size_t size;			   /* Size in bytes of the value body (zero for TYPE_NULL) */
+	size_t alignment;		   /* Natural alignment of the value body */
+	unsigned char scalar;	   /* Non zero for self contained arithmetic scalars */
+	unsigned char ref_counted; /* Non zero when copies share a reference counted handle */
+};
+
+/* -- Member Data -- */
+
+/* Trait table indexed by type id, TYPE_SIZE entries */
+REFLECT_API extern const struct value_type_traits_type value_type_id_traits[];
+
+/* -- Macros -- */
+
+/* Hot path accessors, they do not validate @id against TYPE_SIZE */
+#define value_type_id_traits_size(id) (value_type_id_traits[(id)].size)
+
+#define value_type_id_traits_alignment(id) (value_type_id_traits[(id)].alignment)
+
+#define value_type_id_traits_scalar(id) (value_type_id_traits[(id)].scalar)
+
+#define value_type_id_traits_ref_counted(id) (value_type_id_traits[(id)].ref_counted)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REFLECT_VALUE_TYPE_TRAITS_H */
@@ -25,6 +25,8 @@
 
 #include <log/log.h>
 
+#include <threading/threading_atomic.h>
+
 #include <stdlib.h>
 #include <string.h>
 
@@ -89,6 +91,30 @@ klass class_create(const char *name, class_impl impl, class_impl_interface_singl
 	return cls;
 }
 
+/**
+*  @brief
+*    Atomically decrement the reference counter protecting
+*    against underflow, in which case the counter is restored
+*
+*  @param[in] cls
+*    Reference to the class
+*
+*  @return
+*    Value of the counter previous to the decrement, zero on underflow
+*/
+static size_t class_release_reference(klass cls)
+{
+	size_t ref_count = threading_atomic_fetch_sub(&cls->ref_count, 1);
+
+	if (ref_count == 0)
+	{
+		/* Underflow, restore the counter */
+		threading_atomic_fetch_add(&cls->ref_count, 1);
+	}
+
+	return ref_count;
+}
+
 int class_increment_reference(klass cls)
 {
 	if (cls == NULL)
@@ -96,13 +122,14 @@ int class_increment_reference(klass cls)
 		return 1;
 	}
 
-	if (cls->ref_count == SIZE_MAX)
+	if (threading_atomic_fetch_add(&cls->ref_count, 1) == SIZE_MAX)
 	{
+		/* Overflow, restore the counter */
+		threading_atomic_fetch_sub(&cls->ref_count, 1);
+
 		return 1;
 	}
 
-	++cls->ref_count;
-
 	return 0;
 }
 
@@ -113,13 +140,11 @@ int class_decrement_reference(klass cls)
 		return 1;
 	}
 
-	if (cls->ref_count == 0)
+	if (class_release_reference(cls) == 0)
 	{
 		return 1;
 	}
 
-	--cls->ref_count;
-
 	return 0;
 }
 
@@ -304,12 +329,14 @@ void class_destroy(klass cls)
 {
 	if (cls != NULL)
 	{
-		if (class_decrement_reference(cls) != 0)
+		size_t ref_count = class_release_reference(cls);
+
+		if (ref_count == 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid reference counter in class: %s", cls->name ? cls->name : "<anonymous>");
 		}
 
-		if (cls->ref_count == 0)
+		if (ref_count <= 1)
 		{
 			if (cls->name == NULL)
 			{
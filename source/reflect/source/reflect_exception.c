@@ -27,15 +27,83 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* Labels are short error codes most of the time, they are stored
+inline when they fit to avoid a heap allocation per throw */
+#define EXCEPTION_LABEL_INLINE_SIZE 0x20
+
 struct exception_type
 {
 	char *message;
 	char *label;
+	char label_inline[EXCEPTION_LABEL_INLINE_SIZE];
 	int code;
 	char *stacktrace;
 	uint64_t id;
+	exception_lazy_callback lazy_callback;
+	exception_lazy_destroy lazy_destroy;
+	void *lazy_context;
 };
 
+static int exception_label_copy(exception ex, const char *label);
+
+static void exception_resolve(exception ex);
+
+int exception_label_copy(exception ex, const char *label)
+{
+	size_t label_size;
+
+	if (label == NULL)
+	{
+		ex->label = NULL;
+
+		return 0;
+	}
+
+	label_size = strlen(label) + 1;
+
+	if (label_size <= EXCEPTION_LABEL_INLINE_SIZE)
+	{
+		ex->label = ex->label_inline;
+	}
+	else
+	{
+		ex->label = malloc(sizeof(char) * label_size);
+
+		if (ex->label == NULL)
+		{
+			return 1;
+		}
+	}
+
+	memcpy(ex->label, label, label_size);
+
+	return 0;
+}
+
+void exception_resolve(exception ex)
+{
+	if (ex->lazy_callback != NULL)
+	{
+		exception_lazy_callback callback = ex->lazy_callback;
+
+		ex->lazy_callback = NULL;
+
+		if (callback(ex->lazy_context, &ex->message, &ex->stacktrace) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid exception lazy resolution <%p>", (void *)ex);
+		}
+
+		if (ex->lazy_destroy != NULL)
+		{
+			ex->lazy_destroy(ex->lazy_context);
+
+			ex->lazy_destroy = NULL;
+		}
+
+		ex->lazy_context = NULL;
+	}
+}
+
 exception exception_create(const char *message, const char *label, int code, const char *stacktrace)
 {
 	exception ex = malloc(sizeof(struct exception_type));
@@ -63,22 +131,9 @@ exception exception_create(const char *message, const char *label, int code, con
 		ex->message = NULL;
 	}
 
-	if (label != NULL)
+	if (exception_label_copy(ex, label) != 0)
 	{
-		size_t label_size = strlen(label) + 1;
-
-		ex->label = malloc(sizeof(char) * label_size);
-
-		if (ex->label == NULL)
-		{
-			goto label_bad_alloc;
-		}
-
-		memcpy(ex->label, label, label_size);
-	}
-	else
-	{
-		ex->label = NULL;
+		goto label_bad_alloc;
 	}
 
 	if (stacktrace != NULL)
@@ -103,11 +158,20 @@ exception exception_create(const char *message, const char *label, int code, con
 
 	ex->id = thread_id_get_current();
 
+	ex->lazy_callback = NULL;
+
+	ex->lazy_destroy = NULL;
+
+	ex->lazy_context = NULL;
+
 	return ex;
 
 stacktrace_bad_alloc:
 
-	free(ex->label);
+	if (ex->label != NULL && ex->label != ex->label_inline)
+	{
+		free(ex->label);
+	}
 
 label_bad_alloc:
 
@@ -122,6 +186,46 @@ exception_bad_alloc:
 	return NULL;
 }
 
+exception exception_create_lazy(exception_lazy_callback callback, exception_lazy_destroy context_destroy, void *context, const char *label, int code)
+{
+	exception ex;
+
+	if (callback == NULL)
+	{
+		return NULL;
+	}
+
+	ex = malloc(sizeof(struct exception_type));
+
+	if (ex == NULL)
+	{
+		return NULL;
+	}
+
+	ex->message = NULL;
+
+	if (exception_label_copy(ex, label) != 0)
+	{
+		free(ex);
+
+		return NULL;
+	}
+
+	ex->stacktrace = NULL;
+
+	ex->code = code;
+
+	ex->id = thread_id_get_current();
+
+	ex->lazy_callback = callback;
+
+	ex->lazy_destroy = context_destroy;
+
+	ex->lazy_context = context;
+
+	return ex;
+}
+
 const char *exception_message(exception ex)
 {
 	if (ex == NULL)
@@ -129,6 +233,8 @@ const char *exception_message(exception ex)
 		return NULL;
 	}
 
+	exception_resolve(ex);
+
 	return ex->message;
 }
 
@@ -159,6 +265,8 @@ const char *exception_stacktrace(exception ex)
 		return NULL;
 	}
 
+	exception_resolve(ex);
+
 	return ex->stacktrace;
 }
 
@@ -166,12 +274,19 @@ void exception_destroy(exception ex)
 {
 	if (ex != NULL)
 	{
+		/* Handlers that never read the details skip the formatting
+		entirely, only the producer context has to be released */
+		if (ex->lazy_destroy != NULL)
+		{
+			ex->lazy_destroy(ex->lazy_context);
+		}
+
 		if (ex->message != NULL)
 		{
 			free(ex->message);
 		}
 
-		if (ex->label != NULL)
+		if (ex->label != NULL && ex->label != ex->label_inline)
 		{
 			free(ex->label);
 		}
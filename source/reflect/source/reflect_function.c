@@ -19,26 +19,138 @@
  */
 
 #include <reflect/reflect_function.h>
+
+#include <adt/adt_string_pool.h>
 #include <reflect/reflect_value_type.h>
 
+#include <format/format_specifier.h>
+
 #include <log/log.h>
 
+#include <portability/portability_clock.h>
+#include <portability/portability_probe.h>
+
+#include <threading/threading_atomic.h>
+#include <threading/threading_mutex.h>
+#include <threading/threading_pool.h>
+
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+#else
+	#include <time.h>
+#endif
+
+/* Cached cross runtime trampoline, keyed by the interface singleton of
+the destination runtime so each direction the callback travels builds
+its bridge (bound reference, conversion plan) exactly once */
+struct function_bridge_type
+{
+	const void *direction;
+	void *bridge;
+	function_bridge_destroy_cb destroy_cb;
+};
+
 struct function_type
 {
-	char *name;
+	const char *name; /* Canonical copy owned by the global string pool */
 	signature s;
 	function_impl impl;
 	function_interface interface;
 	size_t ref_count;
 	int async;
 	void *data;
+	struct function_stats_type *stats;
+	value metadata;					/* Memoized metadata map, shared with inspect trees by reference */
+	struct function_bridge_type *bridges; /* Lazily allocated trampoline cache (FUNCTION_BRIDGE_CACHE_SIZE slots) */
+	function_return (*pipeline)(function func, function_args args, size_t size); /* Invoke pipeline selected at creation, validating or unchecked */
+	int validate; /* Sticky validation opt-in, survives pipeline reselection on rebind */
+};
+
+struct function_await_task_type
+{
+	function func;
+	value *args;
+	size_t size;
+	function_resolve_callback resolve_callback;
+	function_reject_callback reject_callback;
+	void *context;
 };
 
+static int function_stats_enabled = 0;
+
+/* Shared executor for loaders without a native await, workers drain
+completions in runs instead of waking the host once per result */
+static threading_mutex function_await_executor_mutex = NULL;
+
+static threading_pool function_await_executor = NULL;
+
+/* Watchdog over in flight calls, each call claims a slot on entry and
+releases it on return; the monitor thread scans the slots and samples
+calls exceeding the threshold through the registered loader hooks */
+#define FUNCTION_WATCHDOG_SLOTS_SIZE	0x40
+#define FUNCTION_WATCHDOG_SAMPLERS_SIZE 0x08
+
+/* Slot funcs hold 0 when free, 1 while being claimed and the function
+pointer while the call is in flight */
+struct function_watchdog_slot_type
+{
+	size_t func;
+	uint64_t start;
+};
+
+struct function_watchdog_sampler_type
+{
+	function_watchdog_sampler sampler;
+	void *data;
+};
+
+static struct function_watchdog_slot_type function_watchdog_slots[FUNCTION_WATCHDOG_SLOTS_SIZE];
+
+static struct function_watchdog_sampler_type function_watchdog_samplers[FUNCTION_WATCHDOG_SAMPLERS_SIZE];
+
+static size_t function_watchdog_samplers_size = 0;
+
+static uint64_t function_watchdog_threshold = 0;
+
+static int function_watchdog_enabled = 0;
+
+static size_t function_watchdog_running = 0;
+
+static threading_pool function_watchdog_pool = NULL;
+
 static value function_metadata_name(function func);
 
+static uint64_t function_stats_clock(void);
+
+static size_t function_watchdog_claim(function func);
+
+static void function_watchdog_release(size_t index);
+
+static void *function_watchdog_task(void *data);
+
+static function_return function_call_stats(function func, function_args args, size_t size);
+
+static function_return function_call_pipeline(function func, function_args args, size_t size);
+
+static function_return function_call_validate(function func, function_args args, size_t size);
+
+static void function_call_select(function func);
+
+static void *function_await_executor_task(void *data);
+
+static function_return function_await_executor_dispatch(function func, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context);
+
 static value function_metadata_signature(function func);
 
 function function_create(const char *name, size_t args_count, function_impl impl, function_impl_interface_singleton singleton)
@@ -52,20 +164,16 @@ function function_create(const char *name, size_t args_count, function_impl impl
 
 	if (name != NULL)
 	{
-		size_t func_name_size = strlen(name) + 1;
-
-		func->name = malloc(sizeof(char) * func_name_size);
+		func->name = string_intern(name);
 
 		if (func->name == NULL)
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Invalid function name allocation <%s>", name);
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid function name interning <%s>", name);
 
 			free(func);
 
 			return NULL;
 		}
-
-		memcpy(func->name, name, func_name_size);
 	}
 	else
 	{
@@ -76,6 +184,9 @@ function function_create(const char *name, size_t args_count, function_impl impl
 	func->ref_count = 0;
 	func->async = FUNCTION_SYNC;
 	func->data = NULL;
+	func->stats = NULL;
+	func->metadata = NULL;
+	func->bridges = NULL;
 
 	func->s = signature_create(args_count);
 
@@ -83,7 +194,6 @@ function function_create(const char *name, size_t args_count, function_impl impl
 	{
 		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function signature allocation");
 
-		free(func->name);
 		free(func);
 
 		return NULL;
@@ -97,16 +207,50 @@ function function_create(const char *name, size_t args_count, function_impl impl
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid function (%s) create callback <%p>", func->name, func->interface->create);
 
-			free(func->name);
 			free(func);
 
 			return NULL;
 		}
 	}
 
+/* Debug builds validate every call by default, release builds take the
+unchecked pipeline; either way the selection happens once here instead
+of branching on every invocation */
+#if (!defined(NDEBUG) || defined(DEBUG) || defined(_DEBUG) || defined(__DEBUG) || defined(__DEBUG__))
+	func->validate = 1;
+#else
+	func->validate = 0;
+#endif
+
+	function_call_select(func);
+
 	return func;
 }
 
+/**
+*  @brief
+*    Atomically decrement the reference counter protecting
+*    against underflow, in which case the counter is restored
+*
+*  @param[in] func
+*    Reference to the function
+*
+*  @return
+*    Value of the counter previous to the decrement, zero on underflow
+*/
+static size_t function_release_reference(function func)
+{
+	size_t ref_count = threading_atomic_fetch_sub(&func->ref_count, 1);
+
+	if (ref_count == 0)
+	{
+		/* Underflow, restore the counter */
+		threading_atomic_fetch_add(&func->ref_count, 1);
+	}
+
+	return ref_count;
+}
+
 int function_increment_reference(function func)
 {
 	if (func == NULL)
@@ -114,13 +258,14 @@ int function_increment_reference(function func)
 		return 1;
 	}
 
-	if (func->ref_count == SIZE_MAX)
+	if (threading_atomic_fetch_add(&func->ref_count, 1) == SIZE_MAX)
 	{
+		/* Overflow, restore the counter */
+		threading_atomic_fetch_sub(&func->ref_count, 1);
+
 		return 1;
 	}
 
-	++func->ref_count;
-
 	return 0;
 }
 
@@ -131,13 +276,11 @@ int function_decrement_reference(function func)
 		return 1;
 	}
 
-	if (func->ref_count == 0)
+	if (function_release_reference(func) == 0)
 	{
 		return 1;
 	}
 
-	--func->ref_count;
-
 	return 0;
 }
 
@@ -166,6 +309,117 @@ void *function_closure(function func)
 	return NULL;
 }
 
+function_impl function_impl_get(function func)
+{
+	if (func != NULL)
+	{
+		return func->impl;
+	}
+
+	return NULL;
+}
+
+function_interface function_interface_get(function func)
+{
+	if (func != NULL)
+	{
+		return func->interface;
+	}
+
+	return NULL;
+}
+
+void *function_bridge_get(function func, const void *direction)
+{
+	if (func != NULL && func->bridges != NULL && direction != NULL)
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < FUNCTION_BRIDGE_CACHE_SIZE; ++iterator)
+		{
+			if (func->bridges[iterator].direction == direction)
+			{
+				return func->bridges[iterator].bridge;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+int function_bridge_set(function func, const void *direction, void *bridge, function_bridge_destroy_cb destroy_cb)
+{
+	size_t iterator, slot = FUNCTION_BRIDGE_CACHE_SIZE;
+
+	if (func == NULL || direction == NULL)
+	{
+		return 1;
+	}
+
+	if (func->bridges == NULL)
+	{
+		func->bridges = calloc(FUNCTION_BRIDGE_CACHE_SIZE, sizeof(struct function_bridge_type));
+
+		if (func->bridges == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid function bridge cache allocation");
+
+			return 1;
+		}
+	}
+
+	for (iterator = 0; iterator < FUNCTION_BRIDGE_CACHE_SIZE; ++iterator)
+	{
+		if (func->bridges[iterator].direction == direction)
+		{
+			slot = iterator;
+			break;
+		}
+
+		if (func->bridges[iterator].direction == NULL && slot == FUNCTION_BRIDGE_CACHE_SIZE)
+		{
+			slot = iterator;
+		}
+	}
+
+	if (slot == FUNCTION_BRIDGE_CACHE_SIZE)
+	{
+		/* All slots taken, the caller keeps building the bridge per call */
+		return 1;
+	}
+
+	if (func->bridges[slot].bridge != NULL && func->bridges[slot].destroy_cb != NULL)
+	{
+		func->bridges[slot].destroy_cb(func, func->bridges[slot].bridge);
+	}
+
+	func->bridges[slot].direction = direction;
+	func->bridges[slot].bridge = bridge;
+	func->bridges[slot].destroy_cb = destroy_cb;
+
+	return 0;
+}
+
+void function_bridge_clear(function func)
+{
+	if (func != NULL && func->bridges != NULL)
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < FUNCTION_BRIDGE_CACHE_SIZE; ++iterator)
+		{
+			if (func->bridges[iterator].bridge != NULL && func->bridges[iterator].destroy_cb != NULL)
+			{
+				func->bridges[iterator].destroy_cb(func, func->bridges[iterator].bridge);
+			}
+		}
+
+		free(func->bridges);
+
+		func->bridges = NULL;
+	}
+}
+
 const char *function_name(function func)
 {
 	if (func != NULL)
@@ -294,12 +548,86 @@ value function_metadata_signature(function func)
 	return sig;
 }
 
+void function_metadata_invalidate(function func)
+{
+	if (func != NULL && func->metadata != NULL)
+	{
+		value_type_destroy(func->metadata);
+
+		func->metadata = NULL;
+	}
+}
+
+int function_rebind(function dst, function src)
+{
+	signature s;
+	function_impl impl;
+	function_interface interface;
+	int async;
+	void *data;
+
+	if (dst == NULL || src == NULL || dst == src)
+	{
+		return 1;
+	}
+
+	/* Swap the implementation state, @dst keeps its identity (name,
+	reference count and the pointer call sites have cached) while @src
+	carries the previous implementation away, to be destroyed with the
+	shell that owns it */
+	s = dst->s;
+	dst->s = src->s;
+	src->s = s;
+
+	impl = dst->impl;
+	dst->impl = src->impl;
+	src->impl = impl;
+
+	interface = dst->interface;
+	dst->interface = src->interface;
+	src->interface = interface;
+
+	async = dst->async;
+	dst->async = src->async;
+	src->async = async;
+
+	data = dst->data;
+	dst->data = src->data;
+	src->data = data;
+
+	function_metadata_invalidate(dst);
+
+	function_metadata_invalidate(src);
+
+	/* Cached trampolines reference the displaced implementation */
+	function_bridge_clear(dst);
+
+	function_bridge_clear(src);
+
+	/* The swapped interfaces may differ in callability, reselect the
+	invoke pipelines against them */
+	function_call_select(dst);
+
+	function_call_select(src);
+
+	return 0;
+}
+
 value function_metadata(function func)
 {
 	value name, sig, async, f;
 
 	value *f_map;
 
+	/* The map is built once and shared by reference afterwards,
+	callers destroy their reference as if they owned a fresh copy */
+	if (func->metadata != NULL)
+	{
+		value_ref_inc(func->metadata);
+
+		return func->metadata;
+	}
+
 	/* Create function name array */
 	name = function_metadata_name(func);
 
@@ -347,12 +675,14 @@ value function_metadata(function func)
 	f_map[1] = sig;
 	f_map[2] = async;
 
+	func->metadata = f;
+
+	/* One reference kept by the cache, one handed to the caller */
+	value_ref_inc(f);
+
 	return f;
 }
 
-/* TODO: Implement a complete new module for debugging and tracking the values */
-
-#if 0 /* (!defined(NDEBUG) || defined(DEBUG) || defined(_DEBUG) || defined(__DEBUG) || defined(__DEBUG__)) */
 static void function_call_value_debug(type_id id, value v)
 {
 	switch (id)
@@ -527,7 +857,7 @@ static function_return function_call_debug(function func, function_args args, si
 		function_call_value_debug(id_arg, (value)args[iterator]);
 	}
 
-	ret = func->interface->invoke(func, func->impl, args, size);
+	ret = function_call_pipeline(func, args, size);
 
 	if (ret != NULL)
 	{
@@ -553,7 +883,333 @@ static function_return function_call_debug(function func, function_args args, si
 
 	return ret;
 }
+
+static function_return function_call_validate(function func, function_args args, size_t size)
+{
+	if (args == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function call, arguments are null");
+
+		return NULL;
+	}
+
+	if (func->interface == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function call, function interface is null");
+
+		return NULL;
+	}
+
+	if (func->interface->invoke == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function call, function interface invoke method is null");
+
+		return NULL;
+	}
+
+	/* Loaders with variadic support may pass more arguments than the
+	declared arity, surface the mismatch without rejecting the call */
+	if (size != signature_count(func->s))
+	{
+		log_write("metacall", LOG_LEVEL_WARNING, "Function call arity mismatch, %" PRIuS " arguments against a signature of %" PRIuS, size, signature_count(func->s));
+	}
+
+	return function_call_debug(func, args, size);
+}
+
+static void function_call_select(function func)
+{
+	/* Functions without a callable interface are pinned to the
+	validating pipeline so invoking them reports the error instead of
+	dereferencing null */
+	if (func->validate != 0 || func->interface == NULL || func->interface->invoke == NULL)
+	{
+		func->pipeline = &function_call_validate;
+	}
+	else
+	{
+		func->pipeline = &function_call_pipeline;
+	}
+}
+
+uint64_t function_stats_clock(void)
+{
+	return portability_clock_nanoseconds();
+}
+
+function_return function_call_stats(function func, function_args args, size_t size)
+{
+	uint64_t start = function_stats_clock(), elapsed;
+
+	function_return ret = func->interface->invoke(func, func->impl, args, size);
+
+	if (func->stats == NULL)
+	{
+		func->stats = malloc(sizeof(struct function_stats_type));
+
+		if (func->stats != NULL)
+		{
+			memset(func->stats, 0, sizeof(struct function_stats_type));
+		}
+	}
+
+	if (func->stats != NULL)
+	{
+		size_t bucket = 0;
+
+		elapsed = function_stats_clock() - start;
+
+		++func->stats->count;
+
+		func->stats->total_time += elapsed;
+
+		while (elapsed > 1 && bucket < FUNCTION_STATS_HISTOGRAM_SIZE - 1)
+		{
+			elapsed >>= 1;
+			++bucket;
+		}
+
+		++func->stats->histogram[bucket];
+	}
+
+	return ret;
+}
+
+void function_stats_enable(int enable)
+{
+	function_stats_enabled = enable;
+}
+
+size_t function_watchdog_claim(function func)
+{
+	size_t iterator;
+
+	for (iterator = 0; iterator < FUNCTION_WATCHDOG_SLOTS_SIZE; ++iterator)
+	{
+		size_t expected = 0;
+
+		if (threading_atomic_compare_exchange(&function_watchdog_slots[iterator].func, &expected, (size_t)1))
+		{
+			function_watchdog_slots[iterator].start = function_stats_clock();
+
+			threading_atomic_store(&function_watchdog_slots[iterator].func, (size_t)func);
+
+			return iterator;
+		}
+	}
+
+	/* The table is full, the call proceeds unmonitored */
+	return FUNCTION_WATCHDOG_SLOTS_SIZE;
+}
+
+void function_watchdog_release(size_t index)
+{
+	threading_atomic_store(&function_watchdog_slots[index].func, (size_t)0);
+}
+
+void *function_watchdog_task(void *data)
+{
+	(void)data;
+
+	while (threading_atomic_load(&function_watchdog_running) != 0)
+	{
+		uint64_t now = function_stats_clock();
+
+		uint64_t interval;
+
+		size_t iterator;
+
+		for (iterator = 0; iterator < FUNCTION_WATCHDOG_SLOTS_SIZE; ++iterator)
+		{
+			size_t f = threading_atomic_load(&function_watchdog_slots[iterator].func);
+
+			if (f > 1)
+			{
+				uint64_t elapsed = now - function_watchdog_slots[iterator].start;
+
+				if (elapsed >= function_watchdog_threshold)
+				{
+					/* The in flight call keeps the function alive while
+					the slot is claimed, so the pointer stays valid here */
+					function func = (function)f;
+
+					size_t sampler_iterator;
+
+					log_write("metacall", LOG_LEVEL_WARNING, "Watchdog detected call to function %s running for %lu ms",
+						func->name != NULL ? func->name : "<anonymous>", (unsigned long)(elapsed / 1000000ULL));
+
+					for (sampler_iterator = 0; sampler_iterator < function_watchdog_samplers_size; ++sampler_iterator)
+					{
+						function_watchdog_samplers[sampler_iterator].sampler(func, elapsed, function_watchdog_samplers[sampler_iterator].data);
+					}
+				}
+			}
+		}
+
+		/* Scan at half the threshold, clamped between 1ms and 1s */
+		interval = function_watchdog_threshold / 2000000ULL;
+
+		if (interval < 1)
+		{
+			interval = 1;
+		}
+		else if (interval > 1000)
+		{
+			interval = 1000;
+		}
+
+#if defined(_WIN32)
+		Sleep((DWORD)interval);
+#else
+		{
+			struct timespec ts;
+
+			ts.tv_sec = (time_t)(interval / 1000);
+			ts.tv_nsec = (long)((interval % 1000) * 1000000);
+
+			nanosleep(&ts, NULL);
+		}
 #endif
+	}
+
+	return NULL;
+}
+
+int function_watchdog_initialize(uint64_t threshold)
+{
+	function_watchdog_threshold = threshold;
+
+	if (function_watchdog_pool != NULL)
+	{
+		return 0;
+	}
+
+	memset(function_watchdog_slots, 0, sizeof(function_watchdog_slots));
+
+	function_watchdog_pool = threading_pool_create(1);
+
+	if (function_watchdog_pool == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid watchdog monitor thread creation");
+
+		return 1;
+	}
+
+	threading_atomic_store(&function_watchdog_running, (size_t)1);
+
+	if (threading_pool_post(function_watchdog_pool, &function_watchdog_task, NULL) != 0)
+	{
+		threading_atomic_store(&function_watchdog_running, (size_t)0);
+
+		threading_pool_destroy(function_watchdog_pool);
+
+		function_watchdog_pool = NULL;
+
+		return 1;
+	}
+
+	function_watchdog_enabled = 1;
+
+	return 0;
+}
+
+int function_watchdog_register(function_watchdog_sampler sampler, void *data)
+{
+	if (sampler == NULL || function_watchdog_samplers_size >= FUNCTION_WATCHDOG_SAMPLERS_SIZE)
+	{
+		return 1;
+	}
+
+	function_watchdog_samplers[function_watchdog_samplers_size].sampler = sampler;
+	function_watchdog_samplers[function_watchdog_samplers_size].data = data;
+
+	++function_watchdog_samplers_size;
+
+	return 0;
+}
+
+void function_watchdog_destroy(void)
+{
+	/* Loaders register their samplers unconditionally, clear them even
+	when the watchdog was never enabled so a re-initialization of the
+	library does not accumulate duplicated hooks */
+	function_watchdog_samplers_size = 0;
+
+	if (function_watchdog_pool == NULL)
+	{
+		return;
+	}
+
+	function_watchdog_enabled = 0;
+
+	threading_atomic_store(&function_watchdog_running, (size_t)0);
+
+	threading_pool_destroy(function_watchdog_pool);
+
+	function_watchdog_pool = NULL;
+
+	function_watchdog_samplers_size = 0;
+}
+
+int function_stats(function func, struct function_stats_type *stats)
+{
+	if (func == NULL || stats == NULL)
+	{
+		return 1;
+	}
+
+	if (func->stats == NULL)
+	{
+		memset(stats, 0, sizeof(struct function_stats_type));
+
+		return 0;
+	}
+
+	memcpy(stats, func->stats, sizeof(struct function_stats_type));
+
+	return 0;
+}
+
+void function_stats_clear(function func)
+{
+	if (func != NULL && func->stats != NULL)
+	{
+		memset(func->stats, 0, sizeof(struct function_stats_type));
+	}
+}
+
+function_return function_call_pipeline(function func, function_args args, size_t size)
+{
+	function_return ret;
+
+	size_t watchdog_slot = FUNCTION_WATCHDOG_SLOTS_SIZE;
+
+	PORTABILITY_PROBE_2(function_call_begin, func->name, size);
+
+	/* A single predictable branch per facility when the instrumentation is disabled */
+	if (function_watchdog_enabled != 0)
+	{
+		watchdog_slot = function_watchdog_claim(func);
+	}
+
+	if (function_stats_enabled != 0)
+	{
+		ret = function_call_stats(func, args, size);
+	}
+	else
+	{
+		ret = func->interface->invoke(func, func->impl, args, size);
+	}
+
+	if (watchdog_slot < FUNCTION_WATCHDOG_SLOTS_SIZE)
+	{
+		function_watchdog_release(watchdog_slot);
+	}
+
+	PORTABILITY_PROBE_2(function_call_end, func->name, ret);
+
+	return ret;
+}
 
 function_return function_call(function func, function_args args, size_t size)
 {
@@ -564,36 +1220,218 @@ function_return function_call(function func, function_args args, size_t size)
 		return NULL;
 	}
 
-	if (args == NULL)
+	/* The pipeline was selected at creation, release-mode functions
+	jump straight into the invocation without residual validation
+	branches while opted-in ones go through the checked path */
+	return func->pipeline(func, args, size);
+}
+
+void function_validate_enable(function func, int enable)
+{
+	if (func == NULL)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function call, arguments are null");
+		return;
+	}
 
-		return NULL;
+	func->validate = (enable != 0);
+
+	function_call_select(func);
+}
+
+int function_validate_enabled(function func)
+{
+	if (func == NULL)
+	{
+		return 0;
+	}
+
+	return func->validate;
+}
+
+int function_call_batch(function func, void **args[], size_t size, size_t count, function_return results[])
+{
+	size_t iterator;
+
+	if (func == NULL || args == NULL || results == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function batch call, function, arguments or results are null");
+
+		return 1;
 	}
 
 	if (func->interface == NULL)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function call, function interface is null");
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function batch call, function interface is null");
 
-		return NULL;
+		return 1;
+	}
+
+	/* Cross the loader boundary once if the loader implements the batch entry */
+	if (func->interface->invoke_batch != NULL)
+	{
+		return func->interface->invoke_batch(func, func->impl, args, size, count, results);
 	}
 
 	if (func->interface->invoke == NULL)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function call, function interface invoke method is null");
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function batch call, function interface invoke method is null");
+
+		return 1;
+	}
+
+	for (iterator = 0; iterator < count; ++iterator)
+	{
+		results[iterator] = func->interface->invoke(func, func->impl, args[iterator], size);
+	}
+
+	return 0;
+}
+
+int function_await_executor_initialize(void)
+{
+	if (function_await_executor_mutex != NULL)
+	{
+		return 0;
+	}
+
+	function_await_executor_mutex = threading_mutex_create();
+
+	return !(function_await_executor_mutex != NULL);
+}
+
+void function_await_executor_destroy(void)
+{
+	if (function_await_executor != NULL)
+	{
+		threading_pool_destroy(function_await_executor);
+
+		function_await_executor = NULL;
+	}
+
+	if (function_await_executor_mutex != NULL)
+	{
+		threading_mutex_destroy(function_await_executor_mutex);
 
+		function_await_executor_mutex = NULL;
+	}
+}
+
+void *function_await_executor_task(void *data)
+{
+	struct function_await_task_type *task = data;
+
+	function func = task->func;
+
+	function_return ret = func->interface->invoke(func, func->impl, task->args, task->size);
+
+	size_t iterator;
+
+	if (ret != NULL)
+	{
+		if (task->resolve_callback != NULL)
+		{
+			task->resolve_callback(ret, task->context);
+		}
+
+		value_type_destroy(ret);
+	}
+	else if (task->reject_callback != NULL)
+	{
+		task->reject_callback(NULL, task->context);
+	}
+
+	for (iterator = 0; iterator < task->size; ++iterator)
+	{
+		value_type_destroy(task->args[iterator]);
+	}
+
+	free(task->args);
+
+	function_destroy(func);
+
+	free(task);
+
+	return NULL;
+}
+
+function_return function_await_executor_dispatch(function func, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
+{
+	struct function_await_task_type *task;
+
+	size_t iterator;
+
+	if (function_await_executor_mutex == NULL || func->interface == NULL || func->interface->invoke == NULL)
+	{
 		return NULL;
 	}
 
-	/*
-	#if (!defined(NDEBUG) || defined(DEBUG) || defined(_DEBUG) || defined(__DEBUG) || defined(__DEBUG__))
-		return function_call_debug(func, args, size);
-	#else
-		return func->interface->invoke(func, func->impl, args, size);
-	#endif
-	*/
+	threading_mutex_lock(function_await_executor_mutex);
+
+	/* The pool is created on first use so hosts which never await
+	through the fallback do not pay for the worker threads */
+	if (function_await_executor == NULL)
+	{
+		function_await_executor = threading_pool_create(0);
+	}
+
+	threading_mutex_unlock(function_await_executor_mutex);
+
+	if (function_await_executor == NULL)
+	{
+		return NULL;
+	}
+
+	task = malloc(sizeof(struct function_await_task_type));
+
+	if (task == NULL)
+	{
+		return NULL;
+	}
 
-	return func->interface->invoke(func, func->impl, args, size);
+	task->args = malloc(sizeof(value) * size);
+
+	if (task->args == NULL && size > 0)
+	{
+		free(task);
+
+		return NULL;
+	}
+
+	/* The caller may destroy the arguments once this returns, keep a copy alive until completion */
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		task->args[iterator] = value_type_copy(args[iterator]);
+	}
+
+	task->func = func;
+
+	task->size = size;
+
+	task->resolve_callback = resolve_callback;
+
+	task->reject_callback = reject_callback;
+
+	task->context = context;
+
+	function_increment_reference(func);
+
+	if (threading_pool_post(function_await_executor, &function_await_executor_task, task) != 0)
+	{
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			value_type_destroy(task->args[iterator]);
+		}
+
+		free(task->args);
+
+		function_destroy(func);
+
+		free(task);
+
+		return NULL;
+	}
+
+	return value_create_null();
 }
 
 function_return function_await(function func, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
@@ -613,6 +1451,9 @@ function_return function_await(function func, function_args args, size_t size, f
 
 			return func->interface->await(func, func->impl, args, size, resolve_callback, reject_callback, context);
 		}
+
+		/* Loaders without a native event loop dispatch the call through the shared executor */
+		return function_await_executor_dispatch(func, args, size, resolve_callback, reject_callback, context);
 	}
 
 	return NULL;
@@ -622,12 +1463,14 @@ void function_destroy(function func)
 {
 	if (func != NULL)
 	{
-		if (function_decrement_reference(func) != 0)
+		size_t ref_count = function_release_reference(func);
+
+		if (ref_count == 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid reference counter in function: %s", func->name ? func->name : "<anonymous>");
 		}
 
-		if (func->ref_count == 0)
+		if (ref_count <= 1)
 		{
 			if (func->name == NULL)
 			{
@@ -645,11 +1488,15 @@ void function_destroy(function func)
 
 			signature_destroy(func->s);
 
-			if (func->name != NULL)
+			if (func->stats != NULL)
 			{
-				free(func->name);
+				free(func->stats);
 			}
 
+			function_bridge_clear(func);
+
+			function_metadata_invalidate(func);
+
 			free(func);
 		}
 	}
@@ -19,18 +19,78 @@
  */
 
 #include <reflect/reflect_future.h>
+#include <reflect/reflect_value_type.h>
 
 #include <log/log.h>
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+#else
+	#include <pthread.h>
+#endif
+
 struct future_type
 {
 	future_impl impl;
 	future_interface interface;
 };
 
+struct future_await_state_type;
+
+struct future_await_slot_type
+{
+	struct future_await_state_type *state;
+	size_t index;
+	value result;
+	int rejected;
+	int done;
+};
+
+struct future_await_state_type
+{
+#if defined(_WIN32)
+	CRITICAL_SECTION lock;
+	CONDITION_VARIABLE cond;
+#else
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+#endif
+	size_t pending; /**< Futures not yet completed */
+	size_t refs;	/**< One per slot plus one for the waiter */
+	size_t winner;	/**< Index of the first completed future */
+	int any;		/**< Non-zero when only the first completion is collected */
+	struct future_await_slot_type *slots;
+	size_t size;
+};
+
+static struct future_await_state_type *future_await_state_create(size_t size, int any);
+
+static void future_await_state_lock(struct future_await_state_type *state);
+
+static void future_await_state_unlock(struct future_await_state_type *state);
+
+static void future_await_state_release(struct future_await_state_type *state);
+
+static void future_await_slot_complete(struct future_await_slot_type *slot, value v, int rejected);
+
+static value future_await_slot_resolve(value v, void *context);
+
+static value future_await_slot_reject(value v, void *context);
+
+static void future_await_register(future futures[], size_t size, struct future_await_state_type *state);
+
 future future_create(future_impl impl, future_impl_interface_singleton singleton)
 {
 	future f = malloc(sizeof(struct future_type));
@@ -81,6 +141,292 @@ future_return future_await(future f, future_resolve_callback resolve_callback, f
 	return NULL;
 }
 
+struct future_await_state_type *future_await_state_create(size_t size, int any)
+{
+	struct future_await_state_type *state = malloc(sizeof(struct future_await_state_type) + sizeof(struct future_await_slot_type) * size);
+
+	size_t iterator;
+
+	if (state == NULL)
+	{
+		return NULL;
+	}
+
+#if defined(_WIN32)
+	InitializeCriticalSection(&state->lock);
+
+	InitializeConditionVariable(&state->cond);
+#else
+	if (pthread_mutex_init(&state->lock, NULL) != 0)
+	{
+		free(state);
+
+		return NULL;
+	}
+
+	if (pthread_cond_init(&state->cond, NULL) != 0)
+	{
+		pthread_mutex_destroy(&state->lock);
+
+		free(state);
+
+		return NULL;
+	}
+#endif
+
+	state->pending = size;
+
+	state->refs = size + 1;
+
+	state->winner = SIZE_MAX;
+
+	state->any = any;
+
+	state->slots = (struct future_await_slot_type *)(state + 1);
+
+	state->size = size;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		state->slots[iterator].state = state;
+
+		state->slots[iterator].index = iterator;
+
+		state->slots[iterator].result = NULL;
+
+		state->slots[iterator].rejected = 1;
+
+		state->slots[iterator].done = 0;
+	}
+
+	return state;
+}
+
+void future_await_state_lock(struct future_await_state_type *state)
+{
+#if defined(_WIN32)
+	EnterCriticalSection(&state->lock);
+#else
+	pthread_mutex_lock(&state->lock);
+#endif
+}
+
+void future_await_state_unlock(struct future_await_state_type *state)
+{
+#if defined(_WIN32)
+	LeaveCriticalSection(&state->lock);
+#else
+	pthread_mutex_unlock(&state->lock);
+#endif
+}
+
+void future_await_state_release(struct future_await_state_type *state)
+{
+	size_t refs;
+
+	future_await_state_lock(state);
+
+	refs = --state->refs;
+
+	future_await_state_unlock(state);
+
+	if (refs == 0)
+	{
+#if defined(_WIN32)
+		DeleteCriticalSection(&state->lock);
+#else
+		pthread_cond_destroy(&state->cond);
+
+		pthread_mutex_destroy(&state->lock);
+#endif
+
+		free(state);
+	}
+}
+
+void future_await_slot_complete(struct future_await_slot_type *slot, value v, int rejected)
+{
+	struct future_await_state_type *state = slot->state;
+
+	int completed = 0;
+
+	future_await_state_lock(state);
+
+	if (slot->done == 0)
+	{
+		slot->done = 1;
+
+		slot->rejected = rejected;
+
+		/* In any mode only the winner keeps its value, the rest are discarded on arrival */
+		if (v != NULL && (state->any == 0 || state->winner == SIZE_MAX))
+		{
+			slot->result = value_type_copy(v);
+		}
+
+		if (state->winner == SIZE_MAX)
+		{
+			state->winner = slot->index;
+		}
+
+		--state->pending;
+
+		completed = 1;
+
+#if defined(_WIN32)
+		WakeAllConditionVariable(&state->cond);
+#else
+		pthread_cond_broadcast(&state->cond);
+#endif
+	}
+
+	future_await_state_unlock(state);
+
+	if (completed != 0)
+	{
+		future_await_state_release(state);
+	}
+}
+
+value future_await_slot_resolve(value v, void *context)
+{
+	future_await_slot_complete(context, v, 0);
+
+	return NULL;
+}
+
+value future_await_slot_reject(value v, void *context)
+{
+	future_await_slot_complete(context, v, 1);
+
+	return NULL;
+}
+
+void future_await_register(future futures[], size_t size, struct future_await_state_type *state)
+{
+	size_t iterator;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		future_return ret = future_await(futures[iterator], &future_await_slot_resolve, &future_await_slot_reject, &state->slots[iterator]);
+
+		if (ret == NULL)
+		{
+			/* The await could not be registered, complete the slot as rejected
+			so the shared completion count is not blocked forever */
+			future_await_slot_complete(&state->slots[iterator], NULL, 1);
+		}
+		else
+		{
+			value_type_destroy(ret);
+		}
+	}
+}
+
+int future_await_all(future futures[], size_t size, future_return results[])
+{
+	struct future_await_state_type *state;
+
+	size_t iterator;
+
+	int result = 0;
+
+	if (futures == NULL || results == NULL || size == 0)
+	{
+		return 1;
+	}
+
+	state = future_await_state_create(size, 0);
+
+	if (state == NULL)
+	{
+		return 1;
+	}
+
+	future_await_register(futures, size, state);
+
+	future_await_state_lock(state);
+
+	while (state->pending > 0)
+	{
+#if defined(_WIN32)
+		SleepConditionVariableCS(&state->cond, &state->lock, INFINITE);
+#else
+		pthread_cond_wait(&state->cond, &state->lock);
+#endif
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		results[iterator] = state->slots[iterator].result;
+
+		state->slots[iterator].result = NULL;
+
+		if (state->slots[iterator].rejected != 0)
+		{
+			result = 1;
+		}
+	}
+
+	future_await_state_unlock(state);
+
+	future_await_state_release(state);
+
+	return result;
+}
+
+int future_await_any(future futures[], size_t size, size_t *index, future_return *result)
+{
+	struct future_await_state_type *state;
+
+	size_t winner;
+
+	int rejected;
+
+	if (futures == NULL || index == NULL || result == NULL || size == 0)
+	{
+		return 1;
+	}
+
+	state = future_await_state_create(size, 1);
+
+	if (state == NULL)
+	{
+		return 1;
+	}
+
+	future_await_register(futures, size, state);
+
+	future_await_state_lock(state);
+
+	while (state->winner == SIZE_MAX && state->pending > 0)
+	{
+#if defined(_WIN32)
+		SleepConditionVariableCS(&state->cond, &state->lock, INFINITE);
+#else
+		pthread_cond_wait(&state->cond, &state->lock);
+#endif
+	}
+
+	winner = state->winner;
+
+	*index = winner;
+
+	*result = state->slots[winner].result;
+
+	state->slots[winner].result = NULL;
+
+	rejected = state->slots[winner].rejected;
+
+	future_await_state_unlock(state);
+
+	/* Late completions only decrement the shared count, the state
+	is freed once the last registered callback has fired */
+	future_await_state_release(state);
+
+	return rejected;
+}
+
 void future_destroy(future f)
 {
 	if (f != NULL)
@@ -19,12 +19,15 @@
  */
 
 #include <adt/adt_set.h>
+#include <adt/adt_string_pool.h>
 
 #include <reflect/reflect_object.h>
 #include <reflect/reflect_value_type.h>
 
 #include <log/log.h>
 
+#include <threading/threading_atomic.h>
+
 #include <stdlib.h>
 #include <string.h>
 
@@ -38,6 +41,20 @@ struct object_type
 	klass cls;
 };
 
+struct object_attribute_type
+{
+	object obj;				   /**< Object the attribute was resolved against */
+	object_attribute_impl impl; /**< Loader owned accessor, null without loader support */
+	const char *key;		   /**< Interned attribute name used by the fallback path */
+};
+
+struct object_method_type
+{
+	object obj;				/**< Object the method was resolved against */
+	object_method_impl impl; /**< Loader owned method token, null without loader support */
+	const char *name;		/**< Interned method name used by the fallback path */
+};
+
 static value object_metadata_name(object obj);
 
 object object_create(const char *name, object_impl impl, object_impl_interface_singleton singleton, klass cls)
@@ -93,6 +110,30 @@ object object_create(const char *name, object_impl impl, object_impl_interface_s
 	return obj;
 }
 
+/**
+*  @brief
+*    Atomically decrement the reference counter protecting
+*    against underflow, in which case the counter is restored
+*
+*  @param[in] obj
+*    Reference to the object
+*
+*  @return
+*    Value of the counter previous to the decrement, zero on underflow
+*/
+static size_t object_release_reference(object obj)
+{
+	size_t ref_count = threading_atomic_fetch_sub(&obj->ref_count, 1);
+
+	if (ref_count == 0)
+	{
+		/* Underflow, restore the counter */
+		threading_atomic_fetch_add(&obj->ref_count, 1);
+	}
+
+	return ref_count;
+}
+
 int object_increment_reference(object obj)
 {
 	if (obj == NULL)
@@ -100,13 +141,14 @@ int object_increment_reference(object obj)
 		return 1;
 	}
 
-	if (obj->ref_count == SIZE_MAX)
+	if (threading_atomic_fetch_add(&obj->ref_count, 1) == SIZE_MAX)
 	{
+		/* Overflow, restore the counter */
+		threading_atomic_fetch_sub(&obj->ref_count, 1);
+
 		return 1;
 	}
 
-	++obj->ref_count;
-
 	return 0;
 }
 
@@ -117,13 +159,11 @@ int object_decrement_reference(object obj)
 		return 1;
 	}
 
-	if (obj->ref_count == 0)
+	if (object_release_reference(obj) == 0)
 	{
 		return 1;
 	}
 
-	--obj->ref_count;
-
 	return 0;
 }
 
@@ -245,6 +285,190 @@ int object_set(object obj, const char *key, value v)
 	return 1;
 }
 
+object_attribute object_attribute_resolve(object obj, const char *key)
+{
+	object_attribute attr;
+
+	if (obj == NULL || key == NULL)
+	{
+		return NULL;
+	}
+
+	attr = malloc(sizeof(struct object_attribute_type));
+
+	if (attr == NULL)
+	{
+		return NULL;
+	}
+
+	attr->obj = obj;
+
+	attr->impl = NULL;
+
+	/* The interned copy outlives the parsed key the caller passed in */
+	attr->key = string_intern(key);
+
+	if (attr->key == NULL)
+	{
+		free(attr);
+
+		return NULL;
+	}
+
+	if (obj->interface != NULL && obj->interface->attribute_resolve != NULL)
+	{
+		if (obj->interface->attribute_resolve(obj, obj->impl, attr->key, &attr->impl) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid object (%s) attribute resolve callback <%p>", obj->name, obj->interface->attribute_resolve);
+
+			free(attr);
+
+			return NULL;
+		}
+	}
+
+	object_increment_reference(obj);
+
+	return attr;
+}
+
+value object_attribute_get(object_attribute attr)
+{
+	object obj;
+
+	if (attr == NULL)
+	{
+		return NULL;
+	}
+
+	obj = attr->obj;
+
+	if (attr->impl != NULL && obj->interface != NULL && obj->interface->attribute_get != NULL)
+	{
+		return obj->interface->attribute_get(obj, obj->impl, attr->impl);
+	}
+
+	return object_get(obj, attr->key);
+}
+
+int object_attribute_set(object_attribute attr, value v)
+{
+	object obj;
+
+	if (attr == NULL)
+	{
+		return 1;
+	}
+
+	obj = attr->obj;
+
+	if (attr->impl != NULL && obj->interface != NULL && obj->interface->attribute_set != NULL)
+	{
+		return obj->interface->attribute_set(obj, obj->impl, attr->impl, v);
+	}
+
+	return object_set(obj, attr->key, v);
+}
+
+void object_attribute_destroy(object_attribute attr)
+{
+	if (attr != NULL)
+	{
+		object obj = attr->obj;
+
+		if (attr->impl != NULL && obj->interface != NULL && obj->interface->attribute_destroy != NULL)
+		{
+			obj->interface->attribute_destroy(obj, obj->impl, attr->impl);
+		}
+
+		object_destroy(obj);
+
+		free(attr);
+	}
+}
+
+object_method object_method_resolve(object obj, const char *name)
+{
+	object_method method;
+
+	if (obj == NULL || name == NULL)
+	{
+		return NULL;
+	}
+
+	method = malloc(sizeof(struct object_method_type));
+
+	if (method == NULL)
+	{
+		return NULL;
+	}
+
+	method->obj = obj;
+
+	method->impl = NULL;
+
+	method->name = string_intern(name);
+
+	if (method->name == NULL)
+	{
+		free(method);
+
+		return NULL;
+	}
+
+	if (obj->interface != NULL && obj->interface->method_resolve != NULL)
+	{
+		if (obj->interface->method_resolve(obj, obj->impl, method->name, &method->impl) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid object (%s) method resolve callback <%p>", obj->name, obj->interface->method_resolve);
+
+			free(method);
+
+			return NULL;
+		}
+	}
+
+	object_increment_reference(obj);
+
+	return method;
+}
+
+value object_method_call(object_method method, object_args args, size_t size)
+{
+	object obj;
+
+	if (method == NULL)
+	{
+		return NULL;
+	}
+
+	obj = method->obj;
+
+	if (method->impl != NULL && obj->interface != NULL && obj->interface->method_invoke_handle != NULL)
+	{
+		return obj->interface->method_invoke_handle(obj, obj->impl, method->impl, args, size);
+	}
+
+	return object_call(obj, method->name, args, size);
+}
+
+void object_method_destroy(object_method method)
+{
+	if (method != NULL)
+	{
+		object obj = method->obj;
+
+		if (method->impl != NULL && obj->interface != NULL && obj->interface->method_destroy != NULL)
+		{
+			obj->interface->method_destroy(obj, obj->impl, method->impl);
+		}
+
+		object_destroy(obj);
+
+		free(method);
+	}
+}
+
 value object_call(object obj, const char *name, object_args args, size_t argc)
 {
 	if (obj != NULL && obj->interface != NULL && obj->interface->method_invoke != NULL)
@@ -306,12 +530,14 @@ void object_destroy(object obj)
 {
 	if (obj != NULL)
 	{
-		if (object_decrement_reference(obj) != 0)
+		size_t ref_count = object_release_reference(obj);
+
+		if (ref_count == 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid reference counter in object: %s", obj->name ? obj->name : "<anonymous>");
 		}
 
-		if (obj->ref_count == 0)
+		if (ref_count <= 1)
 		{
 			if (obj->name == NULL)
 			{
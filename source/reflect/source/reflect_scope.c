@@ -22,29 +22,159 @@
 #include <reflect/reflect_scope.h>
 #include <reflect/reflect_value_type.h>
 
-#include <adt/adt_set.h>
+#include <adt/adt_hashmap.h>
+#include <adt/adt_string_pool.h>
 #include <adt/adt_vector.h>
 
+#include <threading/threading_atomic.h>
+
 #include <log/log.h>
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
-struct scope_metadata_array_cb_iterator_type;
+#if defined(_MSC_VER)
+	#define SCOPE_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+	#define SCOPE_THREAD_LOCAL __thread
+#endif
 
-struct scope_export_cb_iterator_type;
+#if defined(SCOPE_THREAD_LOCAL)
+	#define SCOPE_GET_CACHE_SIZE 0x40
+#endif
 
-typedef struct scope_metadata_array_cb_iterator_type *scope_metadata_array_cb_iterator;
+struct scope_metadata_array_cb_iterator_type;
 
-typedef struct scope_export_cb_iterator_type *scope_export_cb_iterator;
+typedef struct scope_metadata_array_cb_iterator_type *scope_metadata_array_cb_iterator;
 
 struct scope_type
 {
 	char *name;		   /**< Scope name */
-	set objects;	   /**< Map of scope objects indexed by name string */
+	hashmap objects;	   /**< Map of scope objects indexed by name string */
 	vector call_stack; /**< Scope call stack */
+	size_t generation; /**< Mutation stamp invalidating the per thread read cache */
+};
+
+#if defined(SCOPE_GET_CACHE_SIZE)
+
+/* Per thread direct mapped cache over scope_get, entries are valid
+only while the stamped generation matches the scope one */
+struct scope_get_cache_entry_type
+{
+	scope sp;
+	const char *key;
+	value val;
+	size_t generation;
 };
 
+static SCOPE_THREAD_LOCAL struct scope_get_cache_entry_type scope_get_cache[SCOPE_GET_CACHE_SIZE];
+
+/* Generations are drawn from a process wide counter so a scope allocated
+over a freed one never aliases the stale cache entries of another thread */
+static size_t scope_generation_counter = 0;
+
+static size_t scope_generation_next(void)
+{
+	return threading_atomic_fetch_add(&scope_generation_counter, 1) + 1;
+}
+
+static void scope_generation_bump(scope sp)
+{
+	threading_atomic_store(&sp->generation, scope_generation_next());
+}
+
+static size_t scope_get_cache_slot(scope sp, const char *key)
+{
+	uintptr_t hash = ((uintptr_t)sp >> 4) ^ ((uintptr_t)key >> 3);
+
+	return (size_t)(hash & (SCOPE_GET_CACHE_SIZE - 1));
+}
+
+#else
+
+static void scope_generation_bump(scope sp)
+{
+	++sp->generation;
+}
+
+#endif /* SCOPE_GET_CACHE_SIZE */
+
+/* Counting Bloom filter over every name defined across all scopes, a
+lookup for a name that exists nowhere is answered from two counter
+loads instead of probing the scope of every loader. Counters never
+underflow, a stale positive only costs the probes it would have cost
+without the filter */
+#define SCOPE_FILTER_SIZE ((size_t)0x8000)
+#define SCOPE_FILTER_MASK (SCOPE_FILTER_SIZE - 1)
+
+static size_t scope_filter_counters[SCOPE_FILTER_SIZE];
+
+static void scope_filter_slots(const char *key, size_t *first, size_t *second)
+{
+	size_t h = (size_t)hash_callback_str((const hash_key)key);
+
+	/* Derive the second index by remixing the first hash, cheaper
+	than hashing the string twice */
+	size_t mixed = (h * (size_t)0x9E3779B1) ^ (h >> 15);
+
+	*first = h & SCOPE_FILTER_MASK;
+	*second = (h + mixed) & SCOPE_FILTER_MASK;
+}
+
+static void scope_filter_insert(const char *key)
+{
+	size_t first, second;
+
+	scope_filter_slots(key, &first, &second);
+
+	threading_atomic_fetch_add(&scope_filter_counters[first], 1);
+	threading_atomic_fetch_add(&scope_filter_counters[second], 1);
+}
+
+static void scope_filter_decrement(size_t slot)
+{
+	size_t current = threading_atomic_load(&scope_filter_counters[slot]);
+
+	while (current > 0)
+	{
+		if (threading_atomic_compare_exchange(&scope_filter_counters[slot], &current, current - 1))
+		{
+			break;
+		}
+	}
+}
+
+static void scope_filter_remove(const char *key)
+{
+	size_t first, second;
+
+	scope_filter_slots(key, &first, &second);
+
+	scope_filter_decrement(first);
+	scope_filter_decrement(second);
+}
+
+int scope_filter_probe(const char *key)
+{
+	size_t first, second;
+
+	if (key == NULL)
+	{
+		return 0;
+	}
+
+	scope_filter_slots(key, &first, &second);
+
+	if (threading_atomic_load(&scope_filter_counters[first]) == 0 ||
+		threading_atomic_load(&scope_filter_counters[second]) == 0)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
 struct scope_metadata_array_cb_iterator_type
 {
 	value *functions;
@@ -56,21 +186,11 @@ struct scope_metadata_array_cb_iterator_type
 	size_t objects_size;
 };
 
-struct scope_export_cb_iterator_type
-{
-	size_t iterator;
-	value *values;
-};
-
-static int scope_metadata_array_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args);
-
-static int scope_export_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args);
-
-static int scope_metadata_array(scope sp, value v_array[3]);
+static int scope_metadata_array(scope sp, const char *name_prefix, value v_array[3]);
 
 static value scope_metadata_name(scope sp);
 
-static int scope_destroy_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args);
+static int scope_destroy_cb_iterate(hashmap s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args);
 
 scope scope_create(const char *name)
 {
@@ -97,7 +217,9 @@ scope scope_create(const char *name)
 
 			memcpy(sp->name, name, sp_name_size);
 
-			sp->objects = set_create(&hash_callback_str, &comparable_callback_str);
+			/* The keys are interned so the map can hash and compare
+			the canonical pointers instead of the string bytes */
+			sp->objects = hashmap_create(&hash_callback_ptr, &comparable_callback_ptr);
 
 			if (sp->objects == NULL)
 			{
@@ -116,7 +238,7 @@ scope scope_create(const char *name)
 			{
 				log_write("metacall", LOG_LEVEL_ERROR, "Scope create call stack bad allocation");
 
-				set_destroy(sp->objects);
+				hashmap_destroy(sp->objects);
 
 				free(sp->name);
 
@@ -131,7 +253,7 @@ scope scope_create(const char *name)
 
 				vector_destroy(sp->call_stack);
 
-				set_destroy(sp->objects);
+				hashmap_destroy(sp->objects);
 
 				free(sp->name);
 
@@ -148,6 +270,10 @@ scope scope_create(const char *name)
 
 				memcpy(call_stack_head, &head_index, sizeof(size_t));
 
+				sp->generation = 0;
+
+				scope_generation_bump(sp);
+
 				return sp;
 			}
 
@@ -170,7 +296,7 @@ size_t scope_size(scope sp)
 {
 	if (sp != NULL)
 	{
-		return set_size(sp->objects);
+		return hashmap_size(sp->objects);
 	}
 
 	return 0;
@@ -180,69 +306,60 @@ int scope_define(scope sp, const char *key, value val)
 {
 	if (sp != NULL && key != NULL && val != NULL)
 	{
-		return set_insert(sp->objects, (set_key)key, (set_value)val);
-	}
+		const char *interned = string_intern(key);
 
-	return 1;
-}
+		if (interned == NULL)
+		{
+			return 1;
+		}
 
-int scope_metadata_array_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args)
-{
-	scope_metadata_array_cb_iterator metadata_iterator = (scope_metadata_array_cb_iterator)args;
+		if (hashmap_insert(sp->objects, (hashmap_key)interned, (hashmap_value)val) != 0)
+		{
+			return 1;
+		}
 
-	(void)s;
-	(void)key;
+		scope_filter_insert(interned);
 
-	int type_id = value_type_id(val);
+		scope_generation_bump(sp);
 
-	if (type_id == TYPE_FUNCTION)
-	{
-		metadata_iterator->functions[metadata_iterator->functions_size++] = function_metadata(value_to_function(val));
-	}
-	else if (type_id == TYPE_CLASS)
-	{
-		metadata_iterator->classes[metadata_iterator->classes_size++] = class_metadata(value_to_class(val));
-	}
-	else if (type_id == TYPE_OBJECT)
-	{
-		metadata_iterator->objects[metadata_iterator->objects_size++] = object_metadata(value_to_object(val));
+		return 0;
 	}
 
-	return 0;
+	return 1;
 }
 
-int scope_metadata_array_cb_iterate_counter(set s, set_key key, set_value val, set_cb_iterate_args args)
+int scope_metadata_array(scope sp, const char *name_prefix, value v_array[3])
 {
-	scope_metadata_array_cb_iterator metadata_iterator = (scope_metadata_array_cb_iterator)args;
+	struct scope_metadata_array_cb_iterator_type metadata_iterator = {
+		NULL, NULL, NULL, 0, 0, 0
+	};
 
-	(void)s;
-	(void)key;
+	struct hashmap_cursor_type cursor;
 
-	type_id id = value_type_id(val);
+	size_t name_prefix_length = name_prefix != NULL ? strlen(name_prefix) : 0;
 
-	if (id == TYPE_FUNCTION)
+	for (hashmap_cursor_begin(sp->objects, &cursor); hashmap_cursor_end(&cursor) != 0; hashmap_cursor_next(&cursor))
 	{
-		metadata_iterator->functions_size++;
-	}
-	else if (id == TYPE_CLASS)
-	{
-		metadata_iterator->classes_size++;
-	}
-	else if (id == TYPE_OBJECT)
-	{
-		metadata_iterator->objects_size++;
-	}
-
-	return 0;
-}
+		type_id id = value_type_id(hashmap_cursor_value(&cursor));
 
-int scope_metadata_array(scope sp, value v_array[3])
-{
-	struct scope_metadata_array_cb_iterator_type metadata_iterator = {
-		NULL, NULL, NULL, 0, 0, 0
-	};
+		if (name_prefix_length > 0 && strncmp((const char *)hashmap_cursor_key(&cursor), name_prefix, name_prefix_length) != 0)
+		{
+			continue;
+		}
 
-	set_iterate(sp->objects, &scope_metadata_array_cb_iterate_counter, (set_cb_iterate_args)&metadata_iterator);
+		if (id == TYPE_FUNCTION)
+		{
+			metadata_iterator.functions_size++;
+		}
+		else if (id == TYPE_CLASS)
+		{
+			metadata_iterator.classes_size++;
+		}
+		else if (id == TYPE_OBJECT)
+		{
+			metadata_iterator.objects_size++;
+		}
+	}
 
 	value functions_val = value_create_array(NULL, metadata_iterator.functions_size);
 
@@ -279,7 +396,30 @@ int scope_metadata_array(scope sp, value v_array[3])
 	metadata_iterator.functions_size = 0;
 	metadata_iterator.objects_size = 0;
 
-	set_iterate(sp->objects, &scope_metadata_array_cb_iterate, (set_cb_iterate_args)&metadata_iterator);
+	for (hashmap_cursor_begin(sp->objects, &cursor); hashmap_cursor_end(&cursor) != 0; hashmap_cursor_next(&cursor))
+	{
+		value val = hashmap_cursor_value(&cursor);
+
+		type_id id = value_type_id(val);
+
+		if (name_prefix_length > 0 && strncmp((const char *)hashmap_cursor_key(&cursor), name_prefix, name_prefix_length) != 0)
+		{
+			continue;
+		}
+
+		if (id == TYPE_FUNCTION)
+		{
+			metadata_iterator.functions[metadata_iterator.functions_size++] = function_metadata(value_to_function(val));
+		}
+		else if (id == TYPE_CLASS)
+		{
+			metadata_iterator.classes[metadata_iterator.classes_size++] = class_metadata(value_to_class(val));
+		}
+		else if (id == TYPE_OBJECT)
+		{
+			metadata_iterator.objects[metadata_iterator.objects_size++] = object_metadata(value_to_object(val));
+		}
+	}
 
 	v_array[0] = functions_val;
 	v_array[1] = classes_val;
@@ -319,6 +459,11 @@ value scope_metadata_name(scope sp)
 }
 
 value scope_metadata(scope sp)
+{
+	return scope_metadata_filter(sp, NULL);
+}
+
+value scope_metadata_filter(scope sp, const char *name_prefix)
 {
 	value *v_map, v = value_create_map(NULL, 4);
 	value v_array[3] = { NULL, NULL, NULL }; // 0: funcs, 1: cls, 2: obj
@@ -339,7 +484,7 @@ value scope_metadata(scope sp)
 	}
 
 	/* Obtain all scope objects of each type (functions, classes and objects) */
-	if (scope_metadata_array(sp, v_array) != 0)
+	if (scope_metadata_array(sp, name_prefix, v_array) != 0)
 	{
 		value_type_destroy(v);
 		return NULL;
@@ -372,62 +517,55 @@ value scope_metadata(scope sp)
 	return v;
 }
 
-int scope_export_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args)
+value scope_export(scope sp)
 {
-	scope_export_cb_iterator export_iterator = (scope_export_cb_iterator)args;
+	struct hashmap_cursor_type cursor;
 
-	const char *key_str = (const char *)key;
+	size_t iterator = 0;
 
-	value *v_array, v = value_create_array(NULL, 2);
+	value *values, export = value_create_map(NULL, scope_size(sp));
 
-	(void)s;
-
-	if (v == NULL)
+	if (export == NULL)
 	{
-		return 0;
+		return NULL;
 	}
 
-	v_array = value_to_array(v);
-
-	v_array[0] = value_create_string(key_str, strlen(key_str));
+	values = value_to_map(export);
 
-	if (v_array[0] == NULL)
+	for (hashmap_cursor_begin(sp->objects, &cursor); hashmap_cursor_end(&cursor) != 0; hashmap_cursor_next(&cursor))
 	{
-		value_type_destroy(v);
-
-		return 0;
-	}
+		const char *key_str = (const char *)hashmap_cursor_key(&cursor);
 
-	v_array[1] = value_type_copy(val);
+		value *v_array, v = value_create_array(NULL, 2);
 
-	if (v_array[1] == NULL)
-	{
-		value_type_destroy(v);
+		if (v == NULL)
+		{
+			continue;
+		}
 
-		return 0;
-	}
+		v_array = value_to_array(v);
 
-	export_iterator->values[export_iterator->iterator] = v;
-	++export_iterator->iterator;
+		v_array[0] = value_create_string(key_str, strlen(key_str));
 
-	return 0;
-}
+		if (v_array[0] == NULL)
+		{
+			value_type_destroy(v);
 
-value scope_export(scope sp)
-{
-	struct scope_export_cb_iterator_type export_iterator;
+			continue;
+		}
 
-	value export = value_create_map(NULL, scope_size(sp));
+		v_array[1] = value_type_copy(hashmap_cursor_value(&cursor));
 
-	if (export == NULL)
-	{
-		return NULL;
-	}
+		if (v_array[1] == NULL)
+		{
+			value_type_destroy(v);
 
-	export_iterator.iterator = 0;
-	export_iterator.values = value_to_map(export);
+			continue;
+		}
 
-	set_iterate(sp->objects, &scope_export_cb_iterate, (set_cb_iterate_args)&export_iterator);
+		values[iterator] = v;
+		++iterator;
+	}
 
 	return export;
 }
@@ -436,17 +574,86 @@ value scope_get(scope sp, const char *key)
 {
 	if (sp != NULL && key != NULL)
 	{
-		return (value)set_get(sp->objects, (set_key)key);
+		const char *interned = string_intern(key);
+
+#if defined(SCOPE_GET_CACHE_SIZE)
+		struct scope_get_cache_entry_type *entry = &scope_get_cache[scope_get_cache_slot(sp, interned)];
+
+		/* The generation is read before the lookup so a concurrent define
+		can only make the cached entry stale, never wrongly fresh */
+		size_t generation = threading_atomic_load(&sp->generation);
+
+		value val;
+
+		if (entry->sp == sp && entry->key == interned && entry->generation == generation)
+		{
+			return entry->val;
+		}
+
+		val = (value)hashmap_get(sp->objects, (hashmap_key)interned);
+
+		entry->sp = sp;
+		entry->key = interned;
+		entry->val = val;
+		entry->generation = generation;
+
+		return val;
+#else
+		return (value)hashmap_get(sp->objects, (hashmap_key)interned);
+#endif
 	}
 
 	return NULL;
 }
 
+struct scope_iterate_args_type
+{
+	scope sp;
+	scope_iterate_cb iterate_cb;
+	void *data;
+};
+
+static int scope_iterate_cb_adapter(hashmap map, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args)
+{
+	struct scope_iterate_args_type *iterate_args = args;
+
+	(void)map;
+
+	return iterate_args->iterate_cb(iterate_args->sp, (const char *)key, (value)val, iterate_args->data);
+}
+
+int scope_iterate(scope sp, scope_iterate_cb iterate_cb, void *data)
+{
+	struct scope_iterate_args_type iterate_args;
+
+	if (sp == NULL || iterate_cb == NULL)
+	{
+		return 1;
+	}
+
+	iterate_args.sp = sp;
+	iterate_args.iterate_cb = iterate_cb;
+	iterate_args.data = data;
+
+	hashmap_iterate(sp->objects, &scope_iterate_cb_adapter, (hashmap_cb_iterate_args)&iterate_args);
+
+	return 0;
+}
+
 value scope_undef(scope sp, const char *key)
 {
 	if (sp != NULL && key != NULL)
 	{
-		return (value)set_remove(sp->objects, (set_key)key);
+		value val = (value)hashmap_remove(sp->objects, (hashmap_key)string_intern(key));
+
+		if (val != NULL)
+		{
+			scope_filter_remove(key);
+		}
+
+		scope_generation_bump(sp);
+
+		return val;
 	}
 
 	return NULL;
@@ -454,17 +661,53 @@ value scope_undef(scope sp, const char *key)
 
 int scope_append(scope dest, scope src)
 {
-	return set_append(dest->objects, src->objects);
+	int result = hashmap_append(dest->objects, src->objects);
+
+	if (result == 0)
+	{
+		struct hashmap_cursor_type cursor;
+
+		/* The copied names enter @dest without passing through
+		scope_define, account them in the filter so an undefine from
+		either scope cannot underflow their counters */
+		for (hashmap_cursor_begin(src->objects, &cursor); hashmap_cursor_end(&cursor) != 0; hashmap_cursor_next(&cursor))
+		{
+			scope_filter_insert((const char *)hashmap_cursor_key(&cursor));
+		}
+	}
+
+	scope_generation_bump(dest);
+
+	return result;
 }
 
 int scope_contains(scope dest, scope src)
 {
-	return set_contains_any(dest->objects, src->objects);
+	return hashmap_contains_any(dest->objects, src->objects);
 }
 
 int scope_remove(scope dest, scope src)
 {
-	return set_disjoint(dest->objects, src->objects);
+	int result;
+
+	struct hashmap_cursor_type cursor;
+
+	/* Only names about to leave @dest are removed from the filter */
+	for (hashmap_cursor_begin(src->objects, &cursor); hashmap_cursor_end(&cursor) != 0; hashmap_cursor_next(&cursor))
+	{
+		hashmap_key key = hashmap_cursor_key(&cursor);
+
+		if (hashmap_get(dest->objects, key) != NULL)
+		{
+			scope_filter_remove((const char *)key);
+		}
+	}
+
+	result = hashmap_disjoint(dest->objects, src->objects);
+
+	scope_generation_bump(dest);
+
+	return result;
 }
 
 size_t *scope_stack_return(scope sp)
@@ -585,12 +828,16 @@ int scope_stack_pop(scope sp)
 	return 1;
 }
 
-int scope_destroy_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args)
+int scope_destroy_cb_iterate(hashmap s, hashmap_key key, hashmap_value val, hashmap_cb_iterate_args args)
 {
 	(void)s;
-	(void)key;
 	(void)args;
 
+	if (key != NULL)
+	{
+		scope_filter_remove((const char *)key);
+	}
+
 	if (val != NULL)
 	{
 		value_type_destroy(val);
@@ -605,9 +852,9 @@ void scope_destroy(scope sp)
 {
 	if (sp != NULL)
 	{
-		set_iterate(sp->objects, &scope_destroy_cb_iterate, NULL);
+		hashmap_iterate(sp->objects, &scope_destroy_cb_iterate, NULL);
 
-		set_destroy(sp->objects);
+		hashmap_destroy(sp->objects);
 
 		vector_destroy(sp->call_stack);
 
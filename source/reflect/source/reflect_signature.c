@@ -21,30 +21,47 @@
 #include <reflect/reflect_signature.h>
 #include <reflect/reflect_value_type.h>
 
-#include <adt/adt_set.h>
+#include <threading/threading_atomic.h>
 
 #include <log/log.h>
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
 #define REFLECT_SIGNATURE_INVALID_INDEX ((size_t)~0)
 
+#define SIGNATURE_NAME_POOL_CAPACITY ((size_t)0x100)
+
 typedef struct signature_node_type
 {
 	size_t index;
-	char *name;
+	const char *name; /**< Interned in the name pool, shared across signatures */
 	type t;
 
 } * signature_node;
 
+/* The argument records follow the header inside the same allocation
+and the names are interned, so the whole signature is one contiguous
+block and the per call walk over the parameters is a linear scan */
 struct signature_type
 {
 	type ret;
-	set map;
 	size_t count;
 };
 
+/* Interned parameter name, linked into its hash bucket; the nodes are
+never freed, parameter names are few, short and repeat heavily across
+functions so they live as long as the process */
+struct signature_name_type
+{
+	struct signature_name_type *next;
+	size_t length;
+	char str[1];
+};
+
+static const char *signature_name_intern(const char *name);
+
 static signature_node signature_head(signature s);
 
 static signature_node signature_at(signature s, size_t index);
@@ -57,6 +74,70 @@ static value signature_metadata_args_map(signature s);
 
 static value signature_metadata_args(signature s);
 
+static uintptr_t signature_name_pool_table[SIGNATURE_NAME_POOL_CAPACITY] = { 0 };
+
+const char *signature_name_intern(const char *name)
+{
+	uint64_t h = 0xCBF29CE484222325ULL;
+
+	size_t slot, length = strlen(name);
+
+	struct signature_name_type *node, *head;
+
+	for (slot = 0; slot < length; ++slot)
+	{
+		h ^= (uint64_t)(unsigned char)name[slot];
+		h *= 0x00000100000001B3ULL;
+	}
+
+	slot = (size_t)(h % SIGNATURE_NAME_POOL_CAPACITY);
+
+	head = (struct signature_name_type *)threading_atomic_load(&signature_name_pool_table[slot]);
+
+	for (node = head; node != NULL; node = node->next)
+	{
+		if (node->length == length && memcmp(node->str, name, length) == 0)
+		{
+			return node->str;
+		}
+	}
+
+	node = malloc(sizeof(struct signature_name_type) + length + 1);
+
+	if (node == NULL)
+	{
+		return NULL;
+	}
+
+	node->length = length;
+
+	memcpy(node->str, name, length + 1);
+
+	{
+		uintptr_t expected;
+
+		do
+		{
+			expected = threading_atomic_load(&signature_name_pool_table[slot]);
+
+			node->next = (struct signature_name_type *)expected;
+
+			/* Another thread may have interned the same name meanwhile */
+			for (head = node->next; head != NULL; head = head->next)
+			{
+				if (head->length == length && memcmp(head->str, name, length) == 0)
+				{
+					free(node);
+
+					return head->str;
+				}
+			}
+		} while (threading_atomic_compare_exchange(&signature_name_pool_table[slot], &expected, (uintptr_t)node) == 0);
+	}
+
+	return node->str;
+}
+
 signature_node signature_head(signature s)
 {
 	if (s != NULL)
@@ -87,17 +168,6 @@ signature signature_create(size_t count)
 	{
 		size_t index;
 
-		s->map = set_create(&hash_callback_str, &comparable_callback_str);
-
-		if (s->map == NULL)
-		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Invalid signature set allocation");
-
-			free(s);
-
-			return NULL;
-		}
-
 		s->ret = NULL;
 
 		s->count = count;
@@ -137,7 +207,13 @@ signature signature_resize(signature s, size_t count)
 		return NULL;
 	}
 
-	for (index = new_s->count; index < count; ++index)
+	/* The count must grow before initializing the fresh records,
+	signature_at bounds checks against it */
+	index = new_s->count;
+
+	new_s->count = count;
+
+	for (; index < count; ++index)
 	{
 		signature_node node = signature_at(new_s, index);
 
@@ -149,8 +225,6 @@ signature signature_resize(signature s, size_t count)
 		}
 	}
 
-	new_s->count = count;
-
 	return new_s;
 }
 
@@ -168,11 +242,19 @@ size_t signature_get_index(signature s, const char *name)
 {
 	if (s != NULL && name != NULL)
 	{
-		signature_node node = set_get(s->map, (set_key)name);
+		signature_node node_list = signature_head(s);
 
-		if (node != NULL)
+		size_t index;
+
+		/* The records sit in one contiguous block right after the
+		header, for the handful of parameters a function takes this
+		scan stays within a cache line or two and beats hashing */
+		for (index = 0; index < s->count; ++index)
 		{
-			return node->index;
+			if (node_list[index].name != NULL && strcmp(node_list[index].name, name) == 0)
+			{
+				return node_list[index].index;
+			}
 		}
 	}
 
@@ -219,9 +301,7 @@ void signature_set(signature s, size_t index, const char *name, type t)
 	{
 		signature_node node = signature_at(s, index);
 
-		size_t name_size = strlen(name) + 1;
-
-		char *name_node = malloc(sizeof(char) * name_size);
+		const char *name_node = signature_name_intern(name);
 
 		if (name_node == NULL)
 		{
@@ -230,29 +310,11 @@ void signature_set(signature s, size_t index, const char *name, type t)
 			return;
 		}
 
-		if (node->name != NULL)
-		{
-			free(node->name);
-		}
-
 		node->name = name_node;
 
-		memcpy(node->name, name, name_size);
-
 		node->t = t;
 
 		node->index = index;
-
-		if (set_insert(s->map, (set_key)node->name, (set_value)node) != 0)
-		{
-			free(node->name);
-
-			node->index = REFLECT_SIGNATURE_INVALID_INDEX;
-			node->name = NULL;
-			node->t = NULL;
-
-			log_write("metacall", LOG_LEVEL_ERROR, "Invalid signature set insertion");
-		}
 	}
 }
 
@@ -485,22 +547,10 @@ value signature_metadata(signature s)
 
 void signature_destroy(signature s)
 {
+	/* The argument records live inside the signature block and the
+	names belong to the intern pool, one free releases everything */
 	if (s != NULL)
 	{
-		size_t index;
-
-		for (index = 0; index < s->count; ++index)
-		{
-			signature_node node = signature_at(s, index);
-
-			if (node != NULL && node->name != NULL)
-			{
-				free(node->name);
-			}
-		}
-
-		set_destroy(s->map);
-
 		free(s);
 	}
 }
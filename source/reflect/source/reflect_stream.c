@@ -0,0 +1,137 @@
+/*
+ *	Reflect Library by Parra Studios
+ *	A library for provide reflection and metadata representation.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <reflect/reflect_stream.h>
+
+#include <log/log.h>
+
+#include <stdlib.h>
+
+struct stream_type
+{
+	stream_impl impl;
+	stream_interface interface;
+	int end; /**< Non zero once the runtime reported exhaustion */
+};
+
+stream stream_create(stream_impl impl, stream_impl_interface_singleton singleton)
+{
+	stream s = malloc(sizeof(struct stream_type));
+
+	if (s == NULL)
+	{
+		return NULL;
+	}
+
+	s->impl = impl;
+	s->end = 0;
+
+	if (singleton)
+	{
+		s->interface = singleton();
+	}
+	else
+	{
+		s->interface = NULL;
+	}
+
+	if (s->interface != NULL && s->interface->create != NULL)
+	{
+		if (s->interface->create(s, impl) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid stream create callback <%p>", s->interface->create);
+
+			free(s);
+
+			return NULL;
+		}
+	}
+
+	return s;
+}
+
+value stream_next(stream s)
+{
+	if (s != NULL && s->end == 0)
+	{
+		if (s->interface != NULL && s->interface->next != NULL)
+		{
+			value v = s->interface->next(s, s->impl);
+
+			/* Exhaustion is latched so later pulls short circuit
+			without calling back into the runtime */
+			if (v == NULL)
+			{
+				s->end = 1;
+			}
+
+			return v;
+		}
+	}
+
+	return NULL;
+}
+
+size_t stream_next_batch(stream s, value results[], size_t size)
+{
+	size_t count = 0;
+
+	if (s == NULL || results == NULL)
+	{
+		return 0;
+	}
+
+	while (count < size)
+	{
+		value v = stream_next(s);
+
+		if (v == NULL)
+		{
+			break;
+		}
+
+		results[count++] = v;
+	}
+
+	return count;
+}
+
+int stream_end(stream s)
+{
+	if (s != NULL)
+	{
+		return s->end;
+	}
+
+	return 1;
+}
+
+void stream_destroy(stream s)
+{
+	if (s != NULL)
+	{
+		if (s->interface != NULL && s->interface->destroy != NULL)
+		{
+			s->interface->destroy(s, s->impl);
+		}
+
+		free(s);
+	}
+}
@@ -39,7 +39,9 @@ static const char *type_id_name_map[] = {
 	"Function",
 	"Null",
 	"Class",
-	"Object"
+	"Object",
+	"Typed Array",
+	"Stream"
 };
 
 static_assert((int)sizeof(type_id_name_map) / sizeof(type_id_name_map[0]) == (int)TYPE_SIZE,
@@ -126,6 +128,16 @@ int type_id_object(type_id id)
 	return !(id == TYPE_OBJECT);
 }
 
+int type_id_typed_array(type_id id)
+{
+	return !(id == TYPE_TYPED_ARRAY);
+}
+
+int type_id_stream(type_id id)
+{
+	return !(id == TYPE_STREAM);
+}
+
 int type_id_invalid(type_id id)
 {
 	return !(id >= TYPE_SIZE);
@@ -22,6 +22,8 @@
 
 #include <reflect/reflect_value.h>
 
+#include <threading/threading_atomic.h>
+
 #include <stdint.h>
 #include <string.h>
 
@@ -33,16 +35,130 @@ struct value_impl_type;
 
 typedef struct value_impl_type *value_impl;
 
+/* -- Definitions -- */
+
+#define VALUE_IMPL_FLAG_HEAP     0x00
+#define VALUE_IMPL_FLAG_STATIC   0x01
+#define VALUE_IMPL_FLAG_POOL     0x02
+#define VALUE_IMPL_FLAG_VIEW     0x04
+#define VALUE_IMPL_FLAG_IMMORTAL 0x08
+#define VALUE_IMPL_FLAG_UTF8     0x10
+#define VALUE_IMPL_FLAG_ASCII    0x20
+
+/* Small values are carved from slab blocks instead of going through
+malloc; freed headers are kept in per size class free lists so most
+value allocations are a single pointer pop */
+#define VALUE_POOL_CLASS_COUNT	  3
+#define VALUE_POOL_BLOCK_CAPACITY 0x40
+
+/* Inline values are encoded into the handle itself instead of the heap.
+The encoding requires the payload to fit into the upper half of the
+handle, so it is only available on platforms with 64 bit pointers:
+
+	bit  0       : inline mark (heap pointers are at least word aligned)
+	bits 1 .. 7  : size in bytes of the payload
+	bits 8 .. 15 : tag defined by the upper layers (the type id)
+	bits 32 .. 63: payload
+*/
+#if UINTPTR_MAX > UINT32_MAX
+	#define VALUE_INLINE_SUPPORT 1
+#endif
+
+/* Epoch based reclamation for values shared across threads: readers
+enter a critical section instead of bumping the reference count, and
+retired values are destroyed only once every reader that was inside a
+section at retire time has left, which takes three epochs */
+#if defined(_MSC_VER)
+	#define VALUE_EPOCH_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+	#define VALUE_EPOCH_THREAD_LOCAL __thread
+#endif
+
+#define VALUE_EPOCH_COUNT	   3
+#define VALUE_EPOCH_THREAD_MAX 0x40
+
+#define VALUE_INLINE_MARK		  ((uintptr_t)0x01)
+#define VALUE_INLINE_BYTES_OFFSET 1
+#define VALUE_INLINE_BYTES_MASK	  ((uintptr_t)0x7F)
+#define VALUE_INLINE_TAG_OFFSET	  8
+#define VALUE_INLINE_TAG_MASK	  ((uintptr_t)0xFF)
+#define VALUE_INLINE_DATA_OFFSET  32
+#define VALUE_INLINE_DATA_SIZE	  4
+
 /* -- Member Data -- */
 
 struct value_impl_type
 {
 	size_t bytes;
 	size_t ref_count;
+	unsigned int flags;
 	value_finalizer_cb finalizer;
 	void *finalizer_data;
 };
 
+struct value_pool_chunk_type
+{
+	struct value_pool_chunk_type *next;
+};
+
+struct value_pool_block_type
+{
+	struct value_pool_block_type *next;
+};
+
+struct value_epoch_retired_type
+{
+	value v;
+	value_destroy_cb destroy_cb;
+	struct value_epoch_retired_type *next;
+};
+
+/* Padded to a cache line so reader flags of different threads never
+share one, keeping the read side free of coherence traffic */
+struct value_epoch_thread_type
+{
+	size_t active;
+	size_t epoch;
+	char padding[0x40 - (sizeof(size_t) * 2)];
+};
+
+/* -- Private Variables -- */
+
+static const size_t value_pool_class_size[VALUE_POOL_CLASS_COUNT] = { 0x40, 0x80, 0x100 };
+
+/* The block list is global so the whole pool can be torn down at
+shutdown, but it is push only and the pushes go through an atomic
+compare exchange, so carving a slab never takes a lock */
+static uintptr_t value_pool_block_list = 0;
+
+static struct value_epoch_thread_type value_epoch_threads[VALUE_EPOCH_THREAD_MAX];
+
+static size_t value_epoch_thread_count = 0;
+
+static size_t value_epoch_global = 0;
+
+/* Retire list heads per epoch, stored as integers so the lock free
+pushes can go through the atomic compare exchange macros */
+static uintptr_t value_epoch_retired_list[VALUE_EPOCH_COUNT] = { 0, 0, 0 };
+
+#if defined(VALUE_EPOCH_THREAD_LOCAL)
+/* Free lists are per thread magazines: a chunk freed by a thread goes
+to that thread's list and the hot alloc / destroy path never touches
+shared state; without thread local storage the pool is disabled and
+small values fall back to malloc */
+static VALUE_EPOCH_THREAD_LOCAL struct value_pool_chunk_type *value_pool_free_list[VALUE_POOL_CLASS_COUNT] = { NULL, NULL, NULL };
+
+static VALUE_EPOCH_THREAD_LOCAL int value_epoch_thread_slot = -1;
+
+/* Per thread allocation override for request scoped embeddings: while
+a binding is active every value allocated by the thread comes from the
+bound pool and is flagged static, so destroying it runs the finalizer
+but never frees and the pool reclaims the whole request at once */
+static VALUE_EPOCH_THREAD_LOCAL value_alloc_bind_cb value_alloc_bind_callback = NULL;
+
+static VALUE_EPOCH_THREAD_LOCAL void *value_alloc_bind_context = NULL;
+#endif
+
 /* -- Private Methods -- */
 
 /**
@@ -57,11 +173,141 @@ struct value_impl_type
 */
 value_impl value_descriptor(value v);
 
+/**
+*  @brief
+*    Obtain the size class index of the pool for a total size @size
+*
+*  @param[in] size
+*    Total size in bytes including the value header
+*
+*  @return
+*    Index of the size class, negative if @size is not poolable
+*/
+static int value_pool_class(size_t size);
+
+/**
+*  @brief
+*    Pop a chunk from the free list of the size class @pool_class,
+*    carving a new slab block if the free list is empty
+*
+*  @param[in] pool_class
+*    Index of the size class
+*
+*  @return
+*    Pointer to an uninitialized value header, null if the slab
+*    block allocation failed
+*/
+#if defined(VALUE_EPOCH_THREAD_LOCAL)
+static value_impl value_pool_alloc(int pool_class);
+#endif
+
+/**
+*  @brief
+*    Try to advance the global epoch and reclaim the retire list that
+*    can no longer be observed by any reader
+*/
+static void value_epoch_collect(void);
+
 /* -- Methods -- */
 
+static int value_pool_class(size_t size)
+{
+	int pool_class;
+
+	for (pool_class = 0; pool_class < VALUE_POOL_CLASS_COUNT; ++pool_class)
+	{
+		if (size <= value_pool_class_size[pool_class])
+		{
+			return pool_class;
+		}
+	}
+
+	return -1;
+}
+
+#if defined(VALUE_EPOCH_THREAD_LOCAL)
+static value_impl value_pool_alloc(int pool_class)
+{
+	struct value_pool_chunk_type *chunk = value_pool_free_list[pool_class];
+
+	if (chunk == NULL)
+	{
+		const size_t chunk_size = value_pool_class_size[pool_class];
+
+		struct value_pool_block_type *block = malloc(sizeof(struct value_pool_block_type) + chunk_size * VALUE_POOL_BLOCK_CAPACITY);
+
+		uintptr_t base, expected;
+
+		size_t iterator;
+
+		if (block == NULL)
+		{
+			return NULL;
+		}
+
+		do
+		{
+			expected = threading_atomic_load(&value_pool_block_list);
+
+			block->next = (struct value_pool_block_type *)expected;
+		} while (threading_atomic_compare_exchange(&value_pool_block_list, &expected, (uintptr_t)block) == 0);
+
+		base = ((uintptr_t)block) + sizeof(struct value_pool_block_type);
+
+		/* The carved chunks go straight to the magazine of the calling
+		thread, no other thread can observe them until they are freed */
+		for (iterator = 0; iterator < VALUE_POOL_BLOCK_CAPACITY; ++iterator)
+		{
+			chunk = (struct value_pool_chunk_type *)(base + chunk_size * iterator);
+
+			chunk->next = value_pool_free_list[pool_class];
+
+			value_pool_free_list[pool_class] = chunk;
+		}
+
+		chunk = value_pool_free_list[pool_class];
+	}
+
+	value_pool_free_list[pool_class] = chunk->next;
+
+	return (value_impl)chunk;
+}
+#endif
+
+void value_pool_clear(void)
+{
+	struct value_pool_block_type *block = (struct value_pool_block_type *)threading_atomic_load(&value_pool_block_list);
+
+	/* Only meant for shutdown, once every other thread has stopped
+	allocating: it can reset the magazine of the calling thread but
+	not the thread local magazines of the others, which would dangle
+	if the process kept creating values afterwards */
+	while (block != NULL)
+	{
+		struct value_pool_block_type *next = block->next;
+
+		free(block);
+
+		block = next;
+	}
+
+	threading_atomic_store(&value_pool_block_list, 0);
+
+#if defined(VALUE_EPOCH_THREAD_LOCAL)
+	{
+		int pool_class;
+
+		for (pool_class = 0; pool_class < VALUE_POOL_CLASS_COUNT; ++pool_class)
+		{
+			value_pool_free_list[pool_class] = NULL;
+		}
+	}
+#endif
+}
+
 value_impl value_descriptor(value v)
 {
-	if (v == NULL)
+	if (v == NULL || value_inline(v) != 0)
 	{
 		return NULL;
 	}
@@ -69,9 +315,136 @@ value_impl value_descriptor(value v)
 	return (value_impl)(((uintptr_t)v) - sizeof(struct value_impl_type));
 }
 
+int value_inline(value v)
+{
+	return (((uintptr_t)v) & VALUE_INLINE_MARK) != 0;
+}
+
+value value_inline_create(const void *data, size_t bytes, int tag)
+{
+#if defined(VALUE_INLINE_SUPPORT)
+	uintptr_t encoded = VALUE_INLINE_MARK;
+
+	uint32_t payload = 0;
+
+	if (data == NULL || bytes == 0 || bytes > VALUE_INLINE_DATA_SIZE || tag < 0 || ((uintptr_t)tag) > VALUE_INLINE_TAG_MASK)
+	{
+		return NULL;
+	}
+
+	memcpy(&payload, data, bytes);
+
+	encoded |= ((uintptr_t)bytes) << VALUE_INLINE_BYTES_OFFSET;
+	encoded |= ((uintptr_t)tag) << VALUE_INLINE_TAG_OFFSET;
+	encoded |= ((uintptr_t)payload) << VALUE_INLINE_DATA_OFFSET;
+
+	return (value)encoded;
+#else
+	(void)data;
+	(void)bytes;
+	(void)tag;
+
+	return NULL;
+#endif /* VALUE_INLINE_SUPPORT */
+}
+
+int value_inline_tag(value v)
+{
+	return (int)((((uintptr_t)v) >> VALUE_INLINE_TAG_OFFSET) & VALUE_INLINE_TAG_MASK);
+}
+
+int value_alloc_bind(value_alloc_bind_cb callback, void *ctx)
+{
+#if defined(VALUE_EPOCH_THREAD_LOCAL)
+	value_alloc_bind_callback = callback;
+
+	value_alloc_bind_context = ctx;
+
+	return 0;
+#else
+	(void)callback;
+	(void)ctx;
+
+	return 1;
+#endif
+}
+
 value value_alloc(size_t bytes)
 {
-	value_impl impl = malloc(sizeof(struct value_impl_type) + bytes);
+	int pool_class;
+
+	value_impl impl;
+
+#if defined(VALUE_EPOCH_THREAD_LOCAL)
+	if (value_alloc_bind_callback != NULL)
+	{
+		impl = value_alloc_bind_callback(value_alloc_bind_context, sizeof(struct value_impl_type) + bytes);
+
+		if (impl != NULL)
+		{
+			impl->bytes = bytes;
+			impl->ref_count = 1;
+			impl->flags = VALUE_IMPL_FLAG_STATIC;
+			impl->finalizer = NULL;
+			impl->finalizer_data = NULL;
+
+			return (value)(((uintptr_t)impl) + sizeof(struct value_impl_type));
+		}
+
+		/* An exhausted pool falls through to the regular path, those
+		values are heap owned and freed individually as usual */
+	}
+#endif
+
+#if defined(VALUE_EPOCH_THREAD_LOCAL)
+	pool_class = value_pool_class(sizeof(struct value_impl_type) + bytes);
+#else
+	pool_class = -1;
+#endif
+
+	if (pool_class >= 0)
+	{
+#if defined(VALUE_EPOCH_THREAD_LOCAL)
+		impl = value_pool_alloc(pool_class);
+#else
+		impl = NULL;
+#endif
+
+		if (impl == NULL)
+		{
+			return NULL;
+		}
+
+		impl->flags = VALUE_IMPL_FLAG_POOL;
+	}
+	else
+	{
+		impl = malloc(sizeof(struct value_impl_type) + bytes);
+
+		if (impl == NULL)
+		{
+			return NULL;
+		}
+
+		impl->flags = VALUE_IMPL_FLAG_HEAP;
+	}
+
+	impl->bytes = bytes;
+	impl->ref_count = 1;
+	impl->finalizer = NULL;
+	impl->finalizer_data = NULL;
+
+	return (value)(((uintptr_t)impl) + sizeof(struct value_impl_type));
+}
+
+size_t value_alloc_size(size_t bytes)
+{
+	return sizeof(struct value_impl_type) + bytes;
+}
+
+value value_alloc_static(void *buffer, size_t bytes)
+{
+	value_impl impl = (value_impl)buffer;
 
 	if (impl == NULL)
 	{
@@ -80,6 +453,7 @@ value value_alloc(size_t bytes)
 
 	impl->bytes = bytes;
 	impl->ref_count = 1;
+	impl->flags = VALUE_IMPL_FLAG_STATIC;
 	impl->finalizer = NULL;
 	impl->finalizer_data = NULL;
 
@@ -102,9 +476,19 @@ value value_create(const void *data, size_t bytes)
 
 value value_copy(value v)
 {
-	size_t size = value_size(v);
+	size_t size;
 
-	value copy = value_alloc(size);
+	value copy;
+
+	/* Inline values are immutable and live in the handle, the handle itself is the copy */
+	if (value_inline(v) != 0)
+	{
+		return v;
+	}
+
+	size = value_size(v);
+
+	copy = value_alloc(size);
 
 	if (copy == NULL)
 	{
@@ -133,7 +517,14 @@ void value_move(value src, value dst)
 
 size_t value_size(value v)
 {
-	value_impl impl = value_descriptor(v);
+	value_impl impl;
+
+	if (value_inline(v) != 0)
+	{
+		return (size_t)((((uintptr_t)v) >> VALUE_INLINE_BYTES_OFFSET) & VALUE_INLINE_BYTES_MASK);
+	}
+
+	impl = value_descriptor(v);
 
 	if (impl == NULL)
 	{
@@ -143,13 +534,52 @@ size_t value_size(value v)
 	return impl->bytes;
 }
 
+int value_resize(value v, size_t bytes)
+{
+	value_impl impl;
+
+	if (value_inline(v) != 0)
+	{
+		return 1;
+	}
+
+	impl = value_descriptor(v);
+
+	/* Views alias caller owned storage and shared values may be read
+	concurrently, both must keep their body intact */
+	if (impl == NULL || (impl->flags & VALUE_IMPL_FLAG_VIEW) || threading_atomic_load(&impl->ref_count) > 1)
+	{
+		return 1;
+	}
+
+	if (impl->flags & VALUE_IMPL_FLAG_POOL)
+	{
+		/* A pooled chunk must stay in its size class, the destroy
+		path recomputes the class from the body size when the chunk
+		returns to the free list */
+		if (value_pool_class(sizeof(struct value_impl_type) + bytes) != value_pool_class(sizeof(struct value_impl_type) + impl->bytes))
+		{
+			return 1;
+		}
+	}
+	else if (bytes > impl->bytes)
+	{
+		/* Heap and static allocations are exactly as big as their body */
+		return 1;
+	}
+
+	impl->bytes = bytes;
+
+	return 0;
+}
+
 void value_ref_inc(value v)
 {
 	value_impl impl = value_descriptor(v);
 
 	if (impl != NULL)
 	{
-		++impl->ref_count;
+		threading_atomic_fetch_add(&impl->ref_count, 1);
 	}
 }
 
@@ -159,15 +589,41 @@ void value_ref_dec(value v)
 
 	if (impl != NULL)
 	{
-		--impl->ref_count;
-
-		if (impl->ref_count == 0)
+		/* Only the thread that releases the last reference destroys the value */
+		if (threading_atomic_fetch_sub(&impl->ref_count, 1) == 1)
 		{
 			value_destroy(v);
 		}
 	}
 }
 
+size_t value_ref_release(value v)
+{
+	value_impl impl = value_descriptor(v);
+
+	if (impl == NULL)
+	{
+		return 0;
+	}
+
+	/* A single atomic decrement, so when several holders race to
+	release the value exactly one of them observes zero remaining
+	and takes ownership of the reclamation */
+	return threading_atomic_fetch_sub(&impl->ref_count, 1) - 1;
+}
+
+size_t value_ref_count(value v)
+{
+	value_impl impl = value_descriptor(v);
+
+	if (impl == NULL)
+	{
+		return 0;
+	}
+
+	return threading_atomic_load(&impl->ref_count);
+}
+
 void value_finalizer(value v, value_finalizer_cb finalizer, void *finalizer_data)
 {
 	value_impl impl = value_descriptor(v);
@@ -179,9 +635,88 @@ void value_finalizer(value v, value_finalizer_cb finalizer, void *finalizer_data
 	}
 }
 
+void value_view_mark(value v)
+{
+	value_impl impl = value_descriptor(v);
+
+	if (impl != NULL)
+	{
+		impl->flags |= VALUE_IMPL_FLAG_VIEW;
+	}
+}
+
+int value_view(value v)
+{
+	/* Inline values carry their payload in the handle, never a view */
+	if (v == NULL || value_inline(v) != 0)
+	{
+		return 0;
+	}
+
+	return !!(value_descriptor(v)->flags & VALUE_IMPL_FLAG_VIEW);
+}
+
+void value_immortal_mark(value v)
+{
+	value_impl impl = value_descriptor(v);
+
+	if (impl != NULL)
+	{
+		impl->flags |= VALUE_IMPL_FLAG_IMMORTAL;
+	}
+}
+
+int value_immortal(value v)
+{
+	/* Inline values are copied with the handle, the mark is pointless */
+	if (v == NULL || value_inline(v) != 0)
+	{
+		return 0;
+	}
+
+	return !!(value_descriptor(v)->flags & VALUE_IMPL_FLAG_IMMORTAL);
+}
+
+void value_utf8_mark(value v, int ascii)
+{
+	value_impl impl = value_descriptor(v);
+
+	if (impl != NULL)
+	{
+		impl->flags |= VALUE_IMPL_FLAG_UTF8;
+
+		if (ascii != 0)
+		{
+			impl->flags |= VALUE_IMPL_FLAG_ASCII;
+		}
+	}
+}
+
+int value_utf8(value v)
+{
+	/* Inline payloads are too short for a flag, callers rescan them */
+	if (v == NULL || value_inline(v) != 0)
+	{
+		return 0;
+	}
+
+	return !!(value_descriptor(v)->flags & VALUE_IMPL_FLAG_UTF8);
+}
+
+int value_ascii(value v)
+{
+	if (v == NULL || value_inline(v) != 0)
+	{
+		return 0;
+	}
+
+	return !!(value_descriptor(v)->flags & VALUE_IMPL_FLAG_ASCII);
+}
+
 void *value_data(value v)
 {
-	if (v == NULL)
+	/* Inline values are encoded into the handle, there is no addressable body */
+	if (v == NULL || value_inline(v) != 0)
 	{
 		return NULL;
 	}
@@ -191,7 +726,23 @@ void *value_data(value v)
 
 void value_to(value v, void *data, size_t bytes)
 {
-	void *src = value_data(v);
+	void *src;
+
+	if (value_inline(v) != 0)
+	{
+		uint32_t payload = (uint32_t)(((uintptr_t)v) >> VALUE_INLINE_DATA_OFFSET);
+
+		size_t size = value_size(v);
+
+		if (data != NULL && bytes > 0)
+		{
+			memcpy(data, &payload, (bytes <= size) ? bytes : size);
+		}
+
+		return;
+	}
+
+	src = value_data(v);
 
 	if (src != NULL && data != NULL && bytes > 0)
 	{
@@ -201,7 +752,37 @@ void value_to(value v, void *data, size_t bytes)
 
 value value_from(value v, const void *data, size_t bytes)
 {
-	void *dest = value_data(v);
+	void *dest;
+
+	/* Inline handles carry their payload in the pointer itself and are
+	immutable, so the write has to produce a freshly encoded handle;
+	writing through value_data would be silently skipped otherwise */
+	if (value_inline(v) != 0)
+	{
+		size_t size = value_size(v);
+
+		unsigned char payload[VALUE_INLINE_DATA_SIZE] = { 0 };
+
+		if (bytes == 0 || size == 0 || size > VALUE_INLINE_DATA_SIZE)
+		{
+			return v;
+		}
+
+		value_to(v, payload, size);
+
+		if (data != NULL)
+		{
+			memcpy(payload, data, (bytes <= size) ? bytes : size);
+		}
+		else
+		{
+			memset(payload, 0, (bytes <= size) ? bytes : size);
+		}
+
+		return value_inline_create(payload, size, value_inline_tag(v));
+	}
+
+	dest = value_data(v);
 
 	if (dest != NULL && bytes > 0)
 	{
@@ -218,17 +799,175 @@ value value_from(value v, const void *data, size_t bytes)
 	return v;
 }
 
+int value_epoch_enter(void)
+{
+#if defined(VALUE_EPOCH_THREAD_LOCAL)
+	if (value_epoch_thread_slot < 0)
+	{
+		size_t slot = threading_atomic_fetch_add(&value_epoch_thread_count, 1);
+
+		if (slot >= VALUE_EPOCH_THREAD_MAX)
+		{
+			/* Out of reader slots, this thread must hold references */
+			return 1;
+		}
+
+		value_epoch_thread_slot = (int)slot;
+	}
+
+	threading_atomic_store(&value_epoch_threads[value_epoch_thread_slot].active, 1);
+
+	threading_atomic_store(&value_epoch_threads[value_epoch_thread_slot].epoch, threading_atomic_load(&value_epoch_global));
+
+	return 0;
+#else
+	return 1;
+#endif
+}
+
+void value_epoch_exit(void)
+{
+#if defined(VALUE_EPOCH_THREAD_LOCAL)
+	if (value_epoch_thread_slot >= 0)
+	{
+		threading_atomic_store(&value_epoch_threads[value_epoch_thread_slot].active, 0);
+	}
+#endif
+}
+
+static void value_epoch_collect(void)
+{
+	size_t epoch = threading_atomic_load(&value_epoch_global);
+
+	size_t count = threading_atomic_load(&value_epoch_thread_count);
+
+	size_t slot;
+
+	uintptr_t head;
+
+	struct value_epoch_retired_type *node;
+
+	if (count > VALUE_EPOCH_THREAD_MAX)
+	{
+		count = VALUE_EPOCH_THREAD_MAX;
+	}
+
+	/* A reader still pinned to a previous epoch may observe values
+	retired there, nothing can be reclaimed yet */
+	for (slot = 0; slot < count; ++slot)
+	{
+		if (threading_atomic_load(&value_epoch_threads[slot].active) != 0 &&
+			threading_atomic_load(&value_epoch_threads[slot].epoch) != epoch)
+		{
+			return;
+		}
+	}
+
+	/* Only the thread that advances the epoch reclaims, concurrent
+	collectors lose the exchange and leave */
+	if (threading_atomic_compare_exchange(&value_epoch_global, &epoch, epoch + 1) == 0)
+	{
+		return;
+	}
+
+	/* With the epoch advanced, the list two epochs behind the old one
+	cannot be observed by any reader anymore */
+	do
+	{
+		head = threading_atomic_load(&value_epoch_retired_list[(epoch + 1) % VALUE_EPOCH_COUNT]);
+	} while (threading_atomic_compare_exchange(&value_epoch_retired_list[(epoch + 1) % VALUE_EPOCH_COUNT], &head, 0) == 0);
+
+	node = (struct value_epoch_retired_type *)head;
+
+	while (node != NULL)
+	{
+		struct value_epoch_retired_type *next = node->next;
+
+		node->destroy_cb(node->v);
+
+		free(node);
+
+		node = next;
+	}
+}
+
+void value_epoch_retire(value v, value_destroy_cb destroy_cb)
+{
+	struct value_epoch_retired_type *node;
+
+	size_t epoch_index;
+
+	if (v == NULL)
+	{
+		return;
+	}
+
+	if (destroy_cb == NULL)
+	{
+		destroy_cb = &value_destroy;
+	}
+
+	node = malloc(sizeof(struct value_epoch_retired_type));
+
+	if (node == NULL)
+	{
+		/* Destroying in place is the only option left, the caller
+		already gave up its reference */
+		destroy_cb(v);
+
+		return;
+	}
+
+	node->v = v;
+	node->destroy_cb = destroy_cb;
+
+	epoch_index = threading_atomic_load(&value_epoch_global) % VALUE_EPOCH_COUNT;
+
+	{
+		/* The expected head lives in a local integer so the compare
+		exchange never aliases the node pointer with another type */
+		uintptr_t expected;
+
+		do
+		{
+			expected = threading_atomic_load(&value_epoch_retired_list[epoch_index]);
+
+			node->next = (struct value_epoch_retired_type *)expected;
+		} while (threading_atomic_compare_exchange(&value_epoch_retired_list[epoch_index], &expected, (uintptr_t)node) == 0);
+	}
+
+	value_epoch_collect();
+}
+
 void value_destroy(value v)
 {
 	value_impl impl = value_descriptor(v);
 
-	if (impl != NULL && impl->ref_count <= 1)
+	if (impl != NULL && threading_atomic_load(&impl->ref_count) <= 1)
 	{
 		if (impl->finalizer != NULL)
 		{
 			impl->finalizer(v, impl->finalizer_data);
 		}
 
-		free(impl);
+		/* Pooled values return to the magazine of the destroying
+		thread, static values live in caller owned storage so they
+		must not be freed */
+		if (impl->flags & VALUE_IMPL_FLAG_POOL)
+		{
+#if defined(VALUE_EPOCH_THREAD_LOCAL)
+			int pool_class = value_pool_class(sizeof(struct value_impl_type) + impl->bytes);
+
+			struct value_pool_chunk_type *chunk = (struct value_pool_chunk_type *)impl;
+
+			chunk->next = value_pool_free_list[pool_class];
+
+			value_pool_free_list[pool_class] = chunk;
+#endif
+		}
+		else if (!(impl->flags & VALUE_IMPL_FLAG_STATIC))
+		{
+			free(impl);
+		}
 	}
 }
@@ -21,13 +21,138 @@
 /* -- Headers -- */
 
 #include <reflect/reflect_value_type.h>
+#include <reflect/reflect_value_type_id_size.h>
+#include <reflect/reflect_value_type_traits.h>
+
+#include <adt/adt_hashmap.h>
+
+#include <threading/threading_mutex.h>
+
+#include <preprocessor/preprocessor_concatenation.h>
+#include <preprocessor/preprocessor_for.h>
+
+#include <portability/portability_assert.h>
 
 #include <log/log.h>
 
 #include <stdint.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+/* Maps with at least this many tuples get a lazily built hash index
+on the first keyed access, below it a linear scan beats hashing */
+#define VALUE_TYPE_MAP_INDEX_THRESHOLD ((size_t)0x10)
+
+/* Hash-consing pool for short repeated strings (enum-like statuses,
+category names); strings at or above the threshold never enter it so
+the retained memory stays bounded by the table capacity */
+#define VALUE_STRING_POOL_CAPACITY	 ((size_t)0x200)
+#define VALUE_STRING_POOL_MAX_LENGTH ((size_t)0x40)
+
+/* -- Member Data -- */
+
+/* Stored at the start of the value body of a typed array, the element
+block either follows the descriptor inside the same allocation or is
+borrowed from the caller when the value is created as a view */
+struct value_typed_array_descriptor_type
+{
+	type_id id;	  /**< Type id of the elements */
+	size_t count; /**< Number of elements in the block */
+	void *data;	  /**< Pointer to the contiguous element block */
+	int borrowed; /**< Nonzero when the block is owned by the caller */
+};
+
+/* Stored as the value body of a buffer view, the block itself is
+always borrowed from the caller (owned buffers store their bytes
+inline in the value body and carry no descriptor) */
+struct value_buffer_view_descriptor_type
+{
+	void *data;	 /**< Pointer to the borrowed memory block */
+	size_t size; /**< Size in bytes of the memory block */
+};
+
+/* -- Private Variables -- */
+
+/* Indexes are kept out of line so the map value layout is untouched,
+the registry maps the value handle to its key index and entries are
+evicted when the value is destroyed */
+static hashmap value_map_index_registry = NULL;
+
+/* -- Private Methods -- */
+
+/**
+*  @brief
+*    Obtain the hash index of map value @v, building it on first access
+*
+*  @param[in] v
+*    Reference to the map value
+*
+*  @param[in] v_map
+*    Tuples of the map value
+*
+*  @param[in] size
+*    Number of tuples of the map value
+*
+*  @return
+*    Hash index mapping key strings to tuples, null on allocation failure
+*/
+static hashmap value_type_map_index(value v, value *v_map, size_t size);
 
 /* -- Methods -- */
 
+static hashmap value_type_map_index(value v, value *v_map, size_t size)
+{
+	hashmap map_index;
+
+	size_t index;
+
+	if (value_map_index_registry == NULL)
+	{
+		value_map_index_registry = hashmap_create(&hash_callback_ptr, &comparable_callback_ptr);
+
+		if (value_map_index_registry == NULL)
+		{
+			return NULL;
+		}
+	}
+
+	map_index = hashmap_get(value_map_index_registry, (hashmap_key)v);
+
+	if (map_index != NULL)
+	{
+		return map_index;
+	}
+
+	map_index = hashmap_create(&hash_callback_str, &comparable_callback_str);
+
+	if (map_index == NULL)
+	{
+		return NULL;
+	}
+
+	/* Key strings are borrowed from the tuples, the index never
+	outlives the map value it belongs to */
+	for (index = 0; index < size; ++index)
+	{
+		value *tuple = value_to_array(v_map[index]);
+
+		if (tuple != NULL && value_type_id(tuple[0]) == TYPE_STRING)
+		{
+			hashmap_insert(map_index, (hashmap_key)value_to_string(tuple[0]), (hashmap_value)v_map[index]);
+		}
+	}
+
+	if (hashmap_insert(value_map_index_registry, (hashmap_key)v, (hashmap_value)map_index) != 0)
+	{
+		hashmap_destroy(map_index);
+
+		return NULL;
+	}
+
+	return map_index;
+}
+
 value value_type_create(const void *data, size_t bytes, type_id id)
 {
 	value v = value_alloc(bytes + sizeof(type_id));
@@ -40,197 +165,877 @@ value value_type_create(const void *data, size_t bytes, type_id id)
 	/* Memset body */
 	value_from(v, data, bytes);
 
-	/* Memset header */
-	value_from((value)(((uintptr_t)v) + bytes), &id, sizeof(type_id));
+	/* The type id trailer is copied directly, the offset pointer is
+	not a value handle and an odd offset would look like an inline
+	encoded one to value_from */
+	memcpy((void *)(((uintptr_t)v) + bytes), &id, sizeof(type_id));
 
 	return v;
 }
 
+value value_type_create_static(void *buffer, size_t size, const void *data, size_t bytes, type_id id)
+{
+	value v;
+
+	if (buffer == NULL || size < value_alloc_size(bytes + sizeof(type_id)))
+	{
+		return NULL;
+	}
+
+	v = value_alloc_static(buffer, bytes + sizeof(type_id));
+
+	if (v == NULL)
+	{
+		return NULL;
+	}
+
+	/* Memset body */
+	value_from(v, data, bytes);
+
+	/* Direct copy for the same reason as value_type_create */
+	memcpy((void *)(((uintptr_t)v) + bytes), &id, sizeof(type_id));
+
+	return v;
+}
+
+value value_type_retype(value v, const void *data, size_t bytes, type_id id)
+{
+	if (v == NULL || value_resize(v, bytes + sizeof(type_id)) != 0)
+	{
+		return NULL;
+	}
+
+	if (data != NULL)
+	{
+		/* The new body may overlap the old one when the caller
+		converts a value over its own storage */
+		memmove(v, data, bytes);
+	}
+
+	/* Direct copy for the same reason as value_type_create */
+	memcpy((void *)(((uintptr_t)v) + bytes), &id, sizeof(type_id));
+
+	return v;
+}
+
+/* -- Type Dispatch -- */
+
+/* The copy and destroy operations dispatch through dense tables
+indexed by type id instead of predicate ladders, the type list below
+drives the generation and the static asserts fail whenever a type id
+is added to the enumeration without extending the tables */
+
+#define VALUE_TYPE_DISPATCH_LIST \
+	bool, char, short, int, long, float, double, \
+		string, buffer, array, map, ptr, future, \
+		function, null, class, object, typed_array, \
+		stream
+
+/* Scalars and borrowed pointers copy by cloning the value body */
+#define VALUE_TYPE_COPY_PLAIN(name) \
+	static value PREPROCESSOR_CONCAT(value_type_copy_, name)(value v) \
+	{ \
+		return value_copy(v); \
+	}
+
+PREPROCESSOR_FOR_EACH(VALUE_TYPE_COPY_PLAIN, bool, char, short, int, long, float, double, ptr, future, stream, null)
+
+#undef VALUE_TYPE_COPY_PLAIN
+
+/* Composites deep copy their children so the copy honors the public
+contract: the caller owns a private tree it can mutate through the
+accessors without touching the original; callers that only read can
+share the handle instead through value_type_copy_shared */
+#define VALUE_TYPE_COPY_COMPOSITE(name) \
+	static value PREPROCESSOR_CONCAT(value_type_copy_, name)(value v) \
+	{ \
+		size_t index, size = value_type_count(v); \
+\
+		value new_v = PREPROCESSOR_CONCAT(value_create_, name)(NULL, size); \
+\
+		value *new_v_data, *v_data; \
+\
+		if (new_v == NULL) \
+		{ \
+			return NULL; \
+		} \
+\
+		new_v_data = PREPROCESSOR_CONCAT(value_to_, name)(new_v); \
+\
+		v_data = PREPROCESSOR_CONCAT(value_to_, name)(v); \
+\
+		for (index = 0; index < size; ++index) \
+		{ \
+			new_v_data[index] = value_type_copy(v_data[index]); \
+		} \
+\
+		return new_v; \
+	}
+
+PREPROCESSOR_FOR_EACH(VALUE_TYPE_COPY_COMPOSITE, array, map)
+
+#undef VALUE_TYPE_COPY_COMPOSITE
+
+static value value_type_copy_string(value v)
+{
+	if (value_view(v) != 0)
+	{
+		/* Immortal views borrow characters with static lifetime,
+		sharing the value is always safe */
+		if (value_immortal(v) != 0)
+		{
+			value_ref_inc(v);
+
+			return v;
+		}
+
+		/* Plain views deep copy so the copy owns its characters and
+		does not depend on the lifetime of the borrowed block */
+		return value_create_string(value_to_string(v), value_type_size(v) - 1);
+	}
+
+	return value_copy(v);
+}
+
+static value value_type_copy_buffer(value v)
+{
+	/* Same rationale as string views, the copy owns its block */
+	if (value_view(v) != 0)
+	{
+		return value_create_buffer(value_to_buffer(v), value_type_size(v));
+	}
+
+	return value_copy(v);
+}
+
+static value value_type_copy_function(value v)
+{
+	value cpy = value_copy(v);
+
+	if (cpy != NULL)
+	{
+		function f = value_to_function(cpy);
+
+		function_increment_reference(f);
+	}
+
+	return cpy;
+}
+
+static value value_type_copy_class(value v)
+{
+	value cpy = value_copy(v);
+
+	if (cpy != NULL)
+	{
+		klass cls = value_to_class(v);
+
+		class_increment_reference(cls);
+	}
+
+	return cpy;
+}
+
+static value value_type_copy_object(value v)
+{
+	value cpy = value_copy(v);
+
+	if (cpy != NULL)
+	{
+		object obj = value_to_object(cpy);
+
+		object_increment_reference(obj);
+	}
+
+	return cpy;
+}
+
+static value value_type_copy_typed_array(value v)
+{
+	/* Views deep copy into a self contained typed array so the
+	copy does not depend on the lifetime of the borrowed block */
+	return value_create_typed_array(value_to_typed_array(v), value_typed_array_count(v), value_typed_array_type_id(v));
+}
+
+#define VALUE_TYPE_COPY_ENTRY(name) PREPROCESSOR_CONCAT(&value_type_copy_, name),
+
+static value (*const value_type_copy_table[])(value) = {
+	PREPROCESSOR_FOR_EACH(VALUE_TYPE_COPY_ENTRY, VALUE_TYPE_DISPATCH_LIST)
+};
+
+#undef VALUE_TYPE_COPY_ENTRY
+
+static_assert((int)sizeof(value_type_copy_table) / sizeof(value_type_copy_table[0]) == (int)TYPE_SIZE,
+	"Size of value type copy dispatch table does not match the type size.");
+
 value value_type_copy(value v)
 {
 	if (v != NULL)
 	{
 		type_id id = value_type_id(v);
 
-		if (type_id_array(id) == 0)
+		if (type_id_invalid(id) != 0)
 		{
-			size_t index, size = value_type_count(v);
+			return value_type_copy_table[id](v);
+		}
+	}
 
-			value new_v = value_create_array(NULL, size);
+	return NULL;
+}
 
-			value *new_v_array = value_to_array(new_v);
+value value_type_copy_shared(value v)
+{
+	if (v != NULL)
+	{
+		type_id id = value_type_id(v);
 
-			value *v_array = value_to_array(v);
+		/* Composites share the handle with a reference count bump,
+		the holder must treat the contents as read only or materialize
+		a private copy through value_type_unshare before writing */
+		if (type_id_array(id) == 0 || type_id_map(id) == 0)
+		{
+			value_ref_inc(v);
 
-			for (index = 0; index < size; ++index)
+			return v;
+		}
+	}
+
+	return value_type_copy(v);
+}
+
+value value_type_unshare(value v)
+{
+	type_id id;
+
+	size_t index, size;
+
+	value new_v;
+
+	value *new_v_data, *v_data;
+
+	if (v == NULL || value_inline(v) != 0)
+	{
+		return v;
+	}
+
+	id = value_type_id(v);
+
+	/* Only composites are shared by value_type_copy, any other value
+	is private to its holder already; strings are the exception when
+	the string pool hands out shared references */
+	if (type_id_array(id) != 0 && type_id_map(id) != 0)
+	{
+		if (type_id_string(id) == 0 && value_ref_count(v) > 1)
+		{
+			/* Shared views (immortal strings) materialize an owned
+			copy, value_copy would clone the descriptor and drop the
+			view mark leaving it misread as character data */
+			value new_v = (value_view(v) != 0) ?
+							  value_create_string(value_to_string(v), value_type_size(v) - 1) :
+							  value_copy(v);
+
+			if (new_v == NULL)
 			{
-				new_v_array[index] = value_type_copy(v_array[index]);
+				return NULL;
 			}
+
+			value_ref_dec(v);
+
+			return new_v;
 		}
-		else if (type_id_map(id) == 0)
-		{
-			size_t index, size = value_type_count(v);
 
-			value new_v = value_create_map(NULL, size);
+		return v;
+	}
+
+	if (value_ref_count(v) <= 1)
+	{
+		return v;
+	}
+
+	size = value_type_count(v);
+
+	new_v = (type_id_array(id) == 0) ? value_create_array(NULL, size) : value_create_map(NULL, size);
+
+	if (new_v == NULL)
+	{
+		return NULL;
+	}
 
-			value *new_v_map = value_to_map(new_v);
+	new_v_data = value_to_array(new_v);
 
-			value *v_map = value_to_map(v);
+	v_data = value_to_array(v);
+
+	/* Children go through value_type_copy so nested composites stay
+	shared until they are themselves written to */
+	for (index = 0; index < size; ++index)
+	{
+		new_v_data[index] = value_type_copy(v_data[index]);
+	}
+
+	/* Drop the shared reference, the remaining holders keep the original */
+	value_ref_dec(v);
+
+	return new_v;
+}
+
+size_t value_type_size(value v)
+{
+	size_t size = value_size(v);
+
+	/* Inline values do not store the type id in the body, it lives in the tag */
+	if (value_inline(v) != 0)
+	{
+		return size;
+	}
+
+	/* Buffer and string views report the size of the borrowed
+	block, not the descriptor */
+	if (value_view(v) != 0 && (value_type_id(v) == TYPE_BUFFER || value_type_id(v) == TYPE_STRING))
+	{
+		struct value_buffer_view_descriptor_type *descriptor = value_data(v);
+
+		return descriptor->size;
+	}
+
+	return size - sizeof(type_id);
+}
+
+size_t value_type_count(void *v)
+{
+	const type_id id = value_type_id(v);
+
+	if (id == TYPE_ARRAY || id == TYPE_MAP)
+	{
+		/* Array and map can contain multiple values */
+		return value_type_size(v) / sizeof(const value);
+	}
+	else if (id == TYPE_TYPED_ARRAY)
+	{
+		return value_typed_array_count(v);
+	}
+	else if (id == TYPE_INVALID)
+	{
+		/* Invalid does not contain any value */
+		return 0;
+	}
+
+	/* Rest of values only can contain one value */
+	return 1;
+}
+
+type_id value_type_id(value v)
+{
+	type_id id = TYPE_INVALID;
+
+	if (value_inline(v) != 0)
+	{
+		return (type_id)value_inline_tag(v);
+	}
+
+	if (v != NULL)
+	{
+		size_t size = value_size(v);
+
+		size_t offset = size - sizeof(type_id);
+
+		/* Direct copy, an odd offset pointer would be mistaken for an
+		inline encoded handle by value_to */
+		memcpy(&id, (const void *)(((uintptr_t)v) + offset), sizeof(type_id));
+	}
 
-			for (index = 0; index < size; ++index)
+	return id;
+}
+
+value value_create_bool(boolean b)
+{
+	value v = value_inline_create(&b, sizeof(boolean), TYPE_BOOL);
+
+	if (v != NULL)
+	{
+		return v;
+	}
+
+	return value_type_create(&b, sizeof(boolean), TYPE_BOOL);
+}
+
+value value_create_char(char c)
+{
+	value v = value_inline_create(&c, sizeof(char), TYPE_CHAR);
+
+	if (v != NULL)
+	{
+		return v;
+	}
+
+	return value_type_create(&c, sizeof(char), TYPE_CHAR);
+}
+
+value value_create_short(short s)
+{
+	value v = value_inline_create(&s, sizeof(short), TYPE_SHORT);
+
+	if (v != NULL)
+	{
+		return v;
+	}
+
+	return value_type_create(&s, sizeof(short), TYPE_SHORT);
+}
+
+value value_create_int(int i)
+{
+	value v = value_inline_create(&i, sizeof(int), TYPE_INT);
+
+	if (v != NULL)
+	{
+		return v;
+	}
+
+	return value_type_create(&i, sizeof(int), TYPE_INT);
+}
+
+value value_create_long(long l)
+{
+	return value_type_create(&l, sizeof(long), TYPE_LONG);
+}
+
+value value_create_float(float f)
+{
+	value v = value_inline_create(&f, sizeof(float), TYPE_FLOAT);
+
+	if (v != NULL)
+	{
+		return v;
+	}
+
+	return value_type_create(&f, sizeof(float), TYPE_FLOAT);
+}
+
+value value_create_double(double d)
+{
+	return value_type_create(&d, sizeof(double), TYPE_DOUBLE);
+}
+
+/* -- String Pool -- */
+
+/* Direct mapped table of shared string values, each slot holds one
+reference so entries stay alive while callers come and go; a colliding
+newcomer evicts the occupant, which bounds the table without an
+eviction policy for a working set of a few hundred distinct strings */
+static value value_string_pool_table[VALUE_STRING_POOL_CAPACITY] = { NULL };
+
+static threading_mutex value_string_pool_mutex = NULL;
+
+static int value_string_pool_active = 0;
+
+static size_t value_string_pool_slot(const char *str, size_t length)
+{
+	uint64_t h = 0xCBF29CE484222325ULL;
+
+	size_t iterator;
+
+	for (iterator = 0; iterator < length; ++iterator)
+	{
+		h ^= (uint64_t)(unsigned char)str[iterator];
+		h *= 0x00000100000001B3ULL;
+	}
+
+	return (size_t)(h % VALUE_STRING_POOL_CAPACITY);
+}
+
+void value_string_pool_enable(int enable)
+{
+	if (enable != 0)
+	{
+		if (value_string_pool_mutex == NULL)
+		{
+			value_string_pool_mutex = threading_mutex_create();
+
+			if (value_string_pool_mutex == NULL)
 			{
-				new_v_map[index] = value_type_copy(v_map[index]);
+				return;
 			}
 		}
-		else if (type_id_function(id) == 0)
+
+		value_string_pool_active = 1;
+	}
+	else
+	{
+		value_string_pool_active = 0;
+
+		value_string_pool_clear();
+	}
+}
+
+int value_string_pool_enabled(void)
+{
+	return value_string_pool_active;
+}
+
+void value_string_pool_clear(void)
+{
+	size_t slot;
+
+	if (value_string_pool_mutex == NULL)
+	{
+		return;
+	}
+
+	threading_mutex_lock(value_string_pool_mutex);
+
+	for (slot = 0; slot < VALUE_STRING_POOL_CAPACITY; ++slot)
+	{
+		if (value_string_pool_table[slot] != NULL)
 		{
-			value cpy = value_copy(v);
+			value_ref_dec(value_string_pool_table[slot]);
 
-			if (cpy != NULL)
-			{
-				function f = value_to_function(cpy);
+			value_string_pool_table[slot] = NULL;
+		}
+	}
 
-				function_increment_reference(f);
-			}
+	threading_mutex_unlock(value_string_pool_mutex);
+}
+
+/* Strings are validated once at creation and the verdict is cached on
+the value, so every boundary that needs well formed UTF-8 (runtimes,
+serializers) queries a flag instead of rescanning the bytes */
+static void value_string_tag(value v, const char *str, size_t length)
+{
+	size_t iterator = 0;
+
+	int ascii = 1;
+
+	if (v == NULL)
+	{
+		return;
+	}
+
+	while (iterator < length)
+	{
+		unsigned char byte = (unsigned char)str[iterator];
+
+		unsigned char second;
+
+		if (byte < 0x80)
+		{
+			++iterator;
 
-			return cpy;
+			continue;
 		}
-		else if (type_id_class(id) == 0)
+
+		ascii = 0;
+
+		if (byte < 0xC2)
 		{
-			value cpy = value_copy(v);
+			/* Continuation byte out of sequence or overlong two byte form */
+			return;
+		}
 
-			if (cpy != NULL)
-			{
-				klass cls = value_to_class(v);
+		if (iterator + 1 >= length)
+		{
+			return;
+		}
+
+		second = (unsigned char)str[iterator + 1];
 
-				class_increment_reference(cls);
+		if (byte < 0xE0)
+		{
+			if ((second & 0xC0) != 0x80)
+			{
+				return;
 			}
 
-			return cpy;
+			iterator += 2;
 		}
-		else if (type_id_object(id) == 0)
+		else if (byte < 0xF0)
 		{
-			value cpy = value_copy(v);
-
-			if (cpy != NULL)
+			/* Overlong three byte forms and the surrogate range */
+			if ((second & 0xC0) != 0x80 ||
+				(byte == 0xE0 && second < 0xA0) ||
+				(byte == 0xED && second > 0x9F) ||
+				iterator + 2 >= length ||
+				((unsigned char)str[iterator + 2] & 0xC0) != 0x80)
 			{
-				object obj = value_to_object(cpy);
+				return;
+			}
 
-				object_increment_reference(obj);
+			iterator += 3;
+		}
+		else if (byte < 0xF5)
+		{
+			/* Overlong four byte forms and code points past U+10FFFF */
+			if ((second & 0xC0) != 0x80 ||
+				(byte == 0xF0 && second < 0x90) ||
+				(byte == 0xF4 && second > 0x8F) ||
+				iterator + 3 >= length ||
+				((unsigned char)str[iterator + 2] & 0xC0) != 0x80 ||
+				((unsigned char)str[iterator + 3] & 0xC0) != 0x80)
+			{
+				return;
 			}
 
-			return cpy;
+			iterator += 4;
 		}
+		else
+		{
+			return;
+		}
+	}
 
-		if (type_id_invalid(id) != 0)
+	value_utf8_mark(v, ascii);
+}
+
+int value_type_string_utf8(value v)
+{
+	if (v == NULL || value_type_id(v) != TYPE_STRING)
+	{
+		return 0;
+	}
+
+	return value_utf8(v);
+}
+
+int value_type_string_ascii(value v)
+{
+	if (v == NULL || value_type_id(v) != TYPE_STRING)
+	{
+		return 0;
+	}
+
+	return value_ascii(v);
+}
+
+value value_create_string(const char *str, size_t length)
+{
+	value v;
+
+	size_t slot;
+
+	if (value_string_pool_active == 0 || str == NULL || length >= VALUE_STRING_POOL_MAX_LENGTH)
+	{
+		v = value_type_create(str, length + 1, TYPE_STRING);
+
+		value_string_tag(v, str, length);
+
+		return v;
+	}
+
+	slot = value_string_pool_slot(str, length);
+
+	threading_mutex_lock(value_string_pool_mutex);
+
+	v = value_string_pool_table[slot];
+
+	if (v != NULL && value_type_size(v) == length + 1 && memcmp(value_to_string(v), str, length) == 0)
+	{
+		/* Hit, hand out another reference to the shared value; the
+		copy-on-write discipline (value_type_unshare) protects it from
+		mutation through any single holder */
+		value_ref_inc(v);
+
+		threading_mutex_unlock(value_string_pool_mutex);
+
+		return v;
+	}
+
+	threading_mutex_unlock(value_string_pool_mutex);
+
+	v = value_type_create(str, length + 1, TYPE_STRING);
+
+	if (v == NULL)
+	{
+		return NULL;
+	}
+
+	value_string_tag(v, str, length);
+
+	/* Publish the newcomer evicting whatever occupied the slot, the
+	displaced value lives on through the references already handed out */
+	threading_mutex_lock(value_string_pool_mutex);
+
+	{
+		value displaced = value_string_pool_table[slot];
+
+		value_ref_inc(v);
+
+		value_string_pool_table[slot] = v;
+
+		threading_mutex_unlock(value_string_pool_mutex);
+
+		if (displaced != NULL)
 		{
-			return value_copy(v);
+			value_ref_dec(displaced);
 		}
 	}
 
-	return NULL;
+	return v;
 }
 
-size_t value_type_size(value v)
+value value_create_string_n(const char *str, size_t length)
 {
-	size_t size = value_size(v);
+	value v;
 
-	return size - sizeof(type_id);
+	if (str == NULL)
+	{
+		return NULL;
+	}
+
+	v = value_type_create(NULL, length + 1, TYPE_STRING);
+
+	if (v != NULL)
+	{
+		char *data = value_to_string(v);
+
+		memcpy(data, str, length);
+
+		data[length] = '\0';
+
+		value_string_tag(v, data, length);
+	}
+
+	return v;
 }
 
-size_t value_type_count(void *v)
+value value_create_string_view(const char *str, size_t length)
 {
-	const type_id id = value_type_id(v);
+	struct value_buffer_view_descriptor_type descriptor;
 
-	if (id == TYPE_ARRAY || id == TYPE_MAP)
+	value v;
+
+	if (str == NULL)
 	{
-		/* Array and map can contain multiple values */
-		return value_type_size(v) / sizeof(const value);
+		return NULL;
 	}
-	else if (id == TYPE_INVALID)
+
+	descriptor.data = (void *)str;
+	descriptor.size = length + 1;
+
+	v = value_type_create(&descriptor, sizeof(struct value_buffer_view_descriptor_type), TYPE_STRING);
+
+	if (v != NULL)
+	{
+		value_view_mark(v);
+
+		value_string_tag(v, str, length);
+	}
+
+	return v;
+}
+
+value value_create_string_static(const char *str, size_t length)
+{
+	value v = value_create_string_view(str, length);
+
+	if (v != NULL)
+	{
+		/* The immortal mark tells value_type_copy the characters
+		never go away, so copies share the value instead of deep
+		copying like plain views do */
+		value_immortal_mark(v);
+	}
+
+	return v;
+}
+
+value value_create_buffer(const void *buffer, size_t size)
+{
+	if (buffer == NULL || size == 0)
 	{
-		/* Invalid does not contain any value */
-		return 0;
+		return NULL;
 	}
 
-	/* Rest of values only can contain one value */
-	return 1;
+	return value_type_create(buffer, sizeof(char) * size, TYPE_BUFFER);
 }
 
-type_id value_type_id(value v)
+value value_create_buffer_view(void *buffer, size_t size)
 {
-	type_id id = TYPE_INVALID;
+	struct value_buffer_view_descriptor_type descriptor;
 
-	if (v != NULL)
+	value v;
+
+	if (buffer == NULL || size == 0)
 	{
-		size_t size = value_size(v);
+		return NULL;
+	}
 
-		size_t offset = size - sizeof(type_id);
+	descriptor.data = buffer;
+	descriptor.size = size;
 
-		value_to((value)(((uintptr_t)v) + offset), &id, sizeof(type_id));
+	v = value_type_create(&descriptor, sizeof(struct value_buffer_view_descriptor_type), TYPE_BUFFER);
+
+	if (v != NULL)
+	{
+		value_view_mark(v);
 	}
 
-	return id;
+	return v;
 }
 
-value value_create_bool(boolean b)
+value value_create_array(const value *values, size_t size)
 {
-	return value_type_create(&b, sizeof(boolean), TYPE_BOOL);
+	return value_type_create(values, sizeof(const value) * size, TYPE_ARRAY);
 }
 
-value value_create_char(char c)
+value value_create_map(const value *tuples, size_t size)
 {
-	return value_type_create(&c, sizeof(char), TYPE_CHAR);
+	return value_type_create(tuples, sizeof(const value) * size, TYPE_MAP);
 }
 
-value value_create_short(short s)
+value value_create_typed_array(const void *data, size_t count, type_id id)
 {
-	return value_type_create(&s, sizeof(short), TYPE_SHORT);
-}
+	struct value_typed_array_descriptor_type *descriptor;
 
-value value_create_int(int i)
-{
-	return value_type_create(&i, sizeof(int), TYPE_INT);
-}
+	size_t element_size;
 
-value value_create_long(long l)
-{
-	return value_type_create(&l, sizeof(long), TYPE_LONG);
-}
+	value v;
 
-value value_create_float(float f)
-{
-	return value_type_create(&f, sizeof(float), TYPE_FLOAT);
-}
+	if (count == 0 || type_id_invalid(id) == 0 || value_type_id_traits_scalar(id) == 0)
+	{
+		return NULL;
+	}
 
-value value_create_double(double d)
-{
-	return value_type_create(&d, sizeof(double), TYPE_DOUBLE);
-}
+	/* Scalars always have a non zero size, one array load resolves it */
+	element_size = value_type_id_traits_size(id);
 
-value value_create_string(const char *str, size_t length)
-{
-	return value_type_create(str, length + 1, TYPE_STRING);
-}
+	/* The element block lives right after the descriptor inside the
+	same allocation, so the whole value is one contiguous block */
+	v = value_type_create(NULL, sizeof(struct value_typed_array_descriptor_type) + (element_size * count), TYPE_TYPED_ARRAY);
 
-value value_create_buffer(const void *buffer, size_t size)
-{
-	if (buffer == NULL || size == 0)
+	if (v == NULL)
 	{
 		return NULL;
 	}
 
-	return value_type_create(buffer, sizeof(char) * size, TYPE_BUFFER);
-}
+	descriptor = value_data(v);
 
-value value_create_array(const value *values, size_t size)
-{
-	return value_type_create(values, sizeof(const value) * size, TYPE_ARRAY);
+	descriptor->id = id;
+	descriptor->count = count;
+	descriptor->data = (void *)(((uintptr_t)descriptor) + sizeof(struct value_typed_array_descriptor_type));
+	descriptor->borrowed = 0;
+
+	if (data != NULL)
+	{
+		memcpy(descriptor->data, data, element_size * count);
+	}
+
+	return v;
 }
 
-value value_create_map(const value *tuples, size_t size)
+value value_create_typed_array_view(void *data, size_t count, type_id id)
 {
-	return value_type_create(tuples, sizeof(const value) * size, TYPE_MAP);
+	struct value_typed_array_descriptor_type descriptor;
+
+	if (data == NULL || count == 0 || type_id_invalid(id) == 0 || value_type_id_traits_scalar(id) == 0)
+	{
+		return NULL;
+	}
+
+	descriptor.id = id;
+	descriptor.count = count;
+	descriptor.data = data;
+	descriptor.borrowed = 1;
+
+	return value_type_create(&descriptor, sizeof(struct value_typed_array_descriptor_type), TYPE_TYPED_ARRAY);
 }
 
 value value_create_ptr(const void *ptr)
@@ -243,6 +1048,11 @@ value value_create_future(future f)
 	return value_type_create(&f, sizeof(future), TYPE_FUTURE);
 }
 
+value value_create_stream(stream s)
+{
+	return value_type_create(&s, sizeof(stream), TYPE_STREAM);
+}
+
 value value_create_function(function f)
 {
 	value v = value_type_create(&f, sizeof(function), TYPE_FUNCTION);
@@ -366,11 +1176,25 @@ double value_to_double(value v)
 
 char *value_to_string(value v)
 {
+	if (value_view(v) != 0)
+	{
+		struct value_buffer_view_descriptor_type *descriptor = value_data(v);
+
+		return descriptor->data;
+	}
+
 	return value_data(v);
 }
 
 void *value_to_buffer(value v)
 {
+	if (value_view(v) != 0)
+	{
+		struct value_buffer_view_descriptor_type *descriptor = value_data(v);
+
+		return descriptor->data;
+	}
+
 	return value_data(v);
 }
 
@@ -384,6 +1208,103 @@ value *value_to_map(value v)
 	return value_data(v);
 }
 
+value value_type_map_get(value v, const char *key)
+{
+	value *v_map;
+
+	size_t index, size;
+
+	if (v == NULL || key == NULL || value_type_id(v) != TYPE_MAP)
+	{
+		return NULL;
+	}
+
+	size = value_type_count(v);
+
+	v_map = value_to_map(v);
+
+	if (size >= VALUE_TYPE_MAP_INDEX_THRESHOLD)
+	{
+		hashmap map_index = value_type_map_index(v, v_map, size);
+
+		/* The index reflects the tuples at the time of the first keyed
+		access, mutating them through value_to_map afterwards is not
+		visible here; fall through to the scan on allocation failure */
+		if (map_index != NULL)
+		{
+			value tuple = (value)hashmap_get(map_index, (hashmap_key)key);
+
+			if (tuple != NULL)
+			{
+				return value_to_array(tuple)[1];
+			}
+
+			return NULL;
+		}
+	}
+
+	for (index = 0; index < size; ++index)
+	{
+		value *tuple = value_to_array(v_map[index]);
+
+		if (tuple != NULL && value_type_id(tuple[0]) == TYPE_STRING && strcmp(value_to_string(tuple[0]), key) == 0)
+		{
+			return tuple[1];
+		}
+	}
+
+	return NULL;
+}
+
+void *value_to_typed_array(value v)
+{
+	struct value_typed_array_descriptor_type *descriptor = value_data(v);
+
+	return descriptor->data;
+}
+
+type_id value_typed_array_type_id(value v)
+{
+	struct value_typed_array_descriptor_type *descriptor = value_data(v);
+
+	return descriptor->id;
+}
+
+size_t value_typed_array_count(value v)
+{
+	struct value_typed_array_descriptor_type *descriptor = value_data(v);
+
+	return descriptor->count;
+}
+
+value value_typed_array_retype(value v, type_id id)
+{
+	struct value_typed_array_descriptor_type *descriptor;
+
+	if (v == NULL || value_type_id(v) != TYPE_TYPED_ARRAY || value_type_id_traits_scalar(id) == 0)
+	{
+		return NULL;
+	}
+
+	/* Borrowed blocks belong to the caller and shared values may be
+	read concurrently, neither may be rewritten in place */
+	if (value_view(v) != 0 || value_ref_count(v) > 1)
+	{
+		return NULL;
+	}
+
+	descriptor = value_data(v);
+
+	if (descriptor->borrowed != 0 || value_type_id_traits_size(id) > value_type_id_traits_size(descriptor->id))
+	{
+		return NULL;
+	}
+
+	descriptor->id = id;
+
+	return v;
+}
+
 void *value_to_ptr(value v)
 {
 	uintptr_t *uint_ptr = value_data(v);
@@ -398,6 +1319,13 @@ future value_to_future(value v)
 	return (future)(*uint_future);
 }
 
+stream value_to_stream(value v)
+{
+	uintptr_t *uint_stream = value_data(v);
+
+	return (stream)(*uint_stream);
+}
+
 function value_to_function(value v)
 {
 	uintptr_t *uint_function = value_data(v);
@@ -495,7 +1423,17 @@ value value_from_array(value v, const value *values, size_t size)
 {
 	if (v != NULL && values != NULL && size > 0)
 	{
-		size_t current_size = value_size(v);
+		size_t current_size;
+
+		/* Writing to a shared composite materializes the private copy */
+		v = value_type_unshare(v);
+
+		if (v == NULL)
+		{
+			return NULL;
+		}
+
+		current_size = value_size(v);
 
 		size_t bytes = sizeof(const value) * size;
 
@@ -509,7 +1447,17 @@ value value_from_map(value v, const value *tuples, size_t size)
 {
 	if (v != NULL && tuples != NULL && size > 0)
 	{
-		size_t current_size = value_size(v);
+		size_t current_size;
+
+		/* Writing to a shared composite materializes the private copy */
+		v = value_type_unshare(v);
+
+		if (v == NULL)
+		{
+			return NULL;
+		}
+
+		current_size = value_size(v);
 
 		size_t bytes = sizeof(const value) * size;
 
@@ -529,6 +1477,11 @@ value value_from_future(value v, future f)
 	return value_from(v, &f, sizeof(future));
 }
 
+value value_from_stream(value v, stream s)
+{
+	return value_from(v, &s, sizeof(stream));
+}
+
 value value_from_function(value v, function f)
 {
 	return value_from(v, &f, sizeof(function));
@@ -549,105 +1502,167 @@ value value_from_object(value v, object o)
 	return value_from(v, &o, sizeof(object));
 }
 
-void value_type_destroy(value v)
+/* Scalars and borrowed pointers carry no owned resources, destroying
+the value body is all there is to do */
+#define VALUE_TYPE_DESTROY_PLAIN(name) \
+	static void PREPROCESSOR_CONCAT(value_type_destroy_, name)(value v) \
+	{ \
+		(void)v; \
+	}
+
+PREPROCESSOR_FOR_EACH(VALUE_TYPE_DESTROY_PLAIN, bool, char, short, int, long, float, double, string, buffer, ptr, null, typed_array)
+
+#undef VALUE_TYPE_DESTROY_PLAIN
+
+static void value_type_destroy_array(value v)
 {
-	if (v != NULL)
+	size_t index, size = value_type_count(v);
+
+	value *v_array = value_to_array(v);
+
+	/* log_write("metacall", LOG_LEVEL_DEBUG, "Destroy array value <%p> of size %u", (void *)v, size); */
+
+	for (index = 0; index < size; ++index)
 	{
-		type_id id = value_type_id(v);
+		value_type_destroy(v_array[index]);
+	}
+}
 
-		if (type_id_array(id) == 0)
-		{
-			size_t index, size = value_type_count(v);
+static void value_type_destroy_map(value v)
+{
+	size_t index, size = value_type_count(v);
 
-			value *v_array = value_to_array(v);
+	value *v_map = value_to_map(v);
 
-			/* log_write("metacall", LOG_LEVEL_DEBUG, "Destroy array value <%p> of size %u", (void *)v, size); */
+	/* log_write("metacall", LOG_LEVEL_DEBUG, "Destroy map value <%p> of size %u", (void *)v, size); */
 
-			for (index = 0; index < size; ++index)
-			{
-				value_type_destroy(v_array[index]);
-			}
-		}
-		else if (type_id_map(id) == 0)
+	/* Drop the lazily built hash index of the map if any */
+	if (size >= VALUE_TYPE_MAP_INDEX_THRESHOLD && value_map_index_registry != NULL)
+	{
+		hashmap map_index = (hashmap)hashmap_remove(value_map_index_registry, (hashmap_key)v);
+
+		if (map_index != NULL)
 		{
-			size_t index, size = value_type_count(v);
+			hashmap_destroy(map_index);
+		}
+	}
+
+	for (index = 0; index < size; ++index)
+	{
+		value_type_destroy(v_map[index]);
+	}
+}
 
-			value *v_map = value_to_map(v);
+static void value_type_destroy_future(value v)
+{
+	future f = value_to_future(v);
 
-			/* log_write("metacall", LOG_LEVEL_DEBUG, "Destroy map value <%p> of size %u", (void *)v, size); */
+	log_write("metacall", LOG_LEVEL_DEBUG, "Destroy future value <%p>", (void *)v);
 
-			for (index = 0; index < size; ++index)
-			{
-				value_type_destroy(v_map[index]);
-			}
-		}
-		else if (type_id_future(id) == 0)
-		{
-			future f = value_to_future(v);
+	future_destroy(f);
+}
 
-			log_write("metacall", LOG_LEVEL_DEBUG, "Destroy future value <%p>", (void *)v);
+static void value_type_destroy_stream(value v)
+{
+	stream s = value_to_stream(v);
 
-			future_destroy(f);
-		}
-		else if (type_id_function(id) == 0)
-		{
-			function f = value_to_function(v);
-			const char *name = function_name(f);
+	log_write("metacall", LOG_LEVEL_DEBUG, "Destroy stream value <%p>", (void *)v);
 
-			if (name == NULL)
-			{
-				log_write("metacall", LOG_LEVEL_DEBUG, "Destroy anonymous function <%p> value <%p>", (void *)f, (void *)v);
-			}
-			else
-			{
-				log_write("metacall", LOG_LEVEL_DEBUG, "Destroy function %s <%p> value <%p>", name, (void *)f, (void *)v);
-			}
+	stream_destroy(s);
+}
 
-			function_destroy(f);
-		}
-		else if (type_id_class(id) == 0)
-		{
-			klass c = value_to_class(v);
-			const char *name = class_name(c);
+static void value_type_destroy_function(value v)
+{
+	function f = value_to_function(v);
+	const char *name = function_name(f);
 
-			if (name == NULL)
-			{
-				log_write("metacall", LOG_LEVEL_DEBUG, "Destroy anonymous class <%p> value <%p>", (void *)c, (void *)v);
-			}
-			else
-			{
-				log_write("metacall", LOG_LEVEL_DEBUG, "Destroy class %s <%p> value <%p>", name, (void *)c, (void *)v);
-			}
+	if (name == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_DEBUG, "Destroy anonymous function <%p> value <%p>", (void *)f, (void *)v);
+	}
+	else
+	{
+		log_write("metacall", LOG_LEVEL_DEBUG, "Destroy function %s <%p> value <%p>", name, (void *)f, (void *)v);
+	}
 
-			class_destroy(c);
-		}
-		else if (type_id_object(id) == 0)
-		{
-			object o = value_to_object(v);
-			const char *name = object_name(o);
-			int delete_return;
+	function_destroy(f);
+}
 
-			if (name == NULL)
-			{
-				log_write("metacall", LOG_LEVEL_DEBUG, "Destroy anonymous object <%p> value <%p>", (void *)o, (void *)v);
-			}
-			else
-			{
-				log_write("metacall", LOG_LEVEL_DEBUG, "Destroy object %s <%p> value <%p>", name, (void *)o, (void *)v);
-			}
+static void value_type_destroy_class(value v)
+{
+	klass c = value_to_class(v);
+	const char *name = class_name(c);
 
-			delete_return = object_delete(o);
+	if (name == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_DEBUG, "Destroy anonymous class <%p> value <%p>", (void *)c, (void *)v);
+	}
+	else
+	{
+		log_write("metacall", LOG_LEVEL_DEBUG, "Destroy class %s <%p> value <%p>", name, (void *)c, (void *)v);
+	}
 
-			if (delete_return != 0)
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid deletion of object <%p>, destructor return error code %d", (void *)o, delete_return);
-			}
+	class_destroy(c);
+}
+
+static void value_type_destroy_object(value v)
+{
+	object o = value_to_object(v);
+	const char *name = object_name(o);
+	int delete_return;
+
+	if (name == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_DEBUG, "Destroy anonymous object <%p> value <%p>", (void *)o, (void *)v);
+	}
+	else
+	{
+		log_write("metacall", LOG_LEVEL_DEBUG, "Destroy object %s <%p> value <%p>", name, (void *)o, (void *)v);
+	}
+
+	delete_return = object_delete(o);
 
-			object_destroy(o);
+	if (delete_return != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid deletion of object <%p>, destructor return error code %d", (void *)o, delete_return);
+	}
+
+	object_destroy(o);
+}
+
+#define VALUE_TYPE_DESTROY_ENTRY(name) PREPROCESSOR_CONCAT(&value_type_destroy_, name),
+
+static void (*const value_type_destroy_table[])(value) = {
+	PREPROCESSOR_FOR_EACH(VALUE_TYPE_DESTROY_ENTRY, VALUE_TYPE_DISPATCH_LIST)
+};
+
+#undef VALUE_TYPE_DESTROY_ENTRY
+
+static_assert((int)sizeof(value_type_destroy_table) / sizeof(value_type_destroy_table[0]) == (int)TYPE_SIZE,
+	"Size of value type destroy dispatch table does not match the type size.");
+
+void value_type_destroy(value v)
+{
+	if (v != NULL)
+	{
+		type_id id;
+
+		/* Shared subtrees (like memoized metadata) drop one
+		reference and stay alive for the remaining holders; the drop
+		is a single atomic decrement so when holders race to destroy,
+		exactly the one releasing the last reference dispatches the
+		children below */
+		if (value_ref_release(v) > 0)
+		{
+			return;
 		}
 
+		id = value_type_id(v);
+
 		if (type_id_invalid(id) != 0)
 		{
+			value_type_destroy_table[id](v);
+
 			value_destroy(v);
 		}
 		else
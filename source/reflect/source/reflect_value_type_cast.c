@@ -13,11 +13,175 @@
 #include <reflect/reflect_value_type_demotion.h>
 #include <reflect/reflect_value_type_id_size.h>
 #include <reflect/reflect_value_type_promotion.h>
+#include <reflect/reflect_value_type_traits.h>
 
 #include <stdint.h>
 
+/* -- Private Methods -- */
+
+/**
+*  @brief
+*    Convert @count elements from @src to @dest in a single tight
+*    loop, the (source, destination) pair is resolved once so the
+*    compiler can vectorize the per element conversion
+*
+*  @return
+*    Zero on success, different from zero when the pair is unsupported
+*/
+static int value_type_cast_array_kernel(const void *src, type_id src_id, void *dest, type_id dest_id, size_t count);
+
 /* -- Methods -- */
 
+/* Tight conversion loop for one (source, destination) type pair,
+plain casts in a countable loop so the compiler can vectorize */
+#define VALUE_TYPE_CAST_ARRAY_KERNEL(src_type, dest_type) \
+	do \
+	{ \
+		const src_type *src_data = src; \
+		dest_type *dest_data = dest; \
+		size_t index; \
+\
+		for (index = 0; index < count; ++index) \
+		{ \
+			dest_data[index] = (dest_type)src_data[index]; \
+		} \
+\
+		return 0; \
+	} while (0)
+
+/* Booleans are normalized instead of truncated */
+#define VALUE_TYPE_CAST_ARRAY_KERNEL_BOOL(src_type) \
+	do \
+	{ \
+		const src_type *src_data = src; \
+		boolean *dest_data = dest; \
+		size_t index; \
+\
+		for (index = 0; index < count; ++index) \
+		{ \
+			dest_data[index] = (boolean)(src_data[index] != (src_type)0); \
+		} \
+\
+		return 0; \
+	} while (0)
+
+#define VALUE_TYPE_CAST_ARRAY_KERNEL_DEST(src_type) \
+	switch (dest_id) \
+	{ \
+		case TYPE_BOOL: \
+			VALUE_TYPE_CAST_ARRAY_KERNEL_BOOL(src_type); \
+		case TYPE_CHAR: \
+			VALUE_TYPE_CAST_ARRAY_KERNEL(src_type, char); \
+		case TYPE_SHORT: \
+			VALUE_TYPE_CAST_ARRAY_KERNEL(src_type, short); \
+		case TYPE_INT: \
+			VALUE_TYPE_CAST_ARRAY_KERNEL(src_type, int); \
+		case TYPE_LONG: \
+			VALUE_TYPE_CAST_ARRAY_KERNEL(src_type, long); \
+		case TYPE_FLOAT: \
+			VALUE_TYPE_CAST_ARRAY_KERNEL(src_type, float); \
+		case TYPE_DOUBLE: \
+			VALUE_TYPE_CAST_ARRAY_KERNEL(src_type, double); \
+		default: \
+			return 1; \
+	}
+
+int value_type_cast_array_kernel(const void *src, type_id src_id, void *dest, type_id dest_id, size_t count)
+{
+	switch (src_id)
+	{
+		case TYPE_BOOL:
+			VALUE_TYPE_CAST_ARRAY_KERNEL_DEST(boolean);
+		case TYPE_CHAR:
+			VALUE_TYPE_CAST_ARRAY_KERNEL_DEST(char);
+		case TYPE_SHORT:
+			VALUE_TYPE_CAST_ARRAY_KERNEL_DEST(short);
+		case TYPE_INT:
+			VALUE_TYPE_CAST_ARRAY_KERNEL_DEST(int);
+		case TYPE_LONG:
+			VALUE_TYPE_CAST_ARRAY_KERNEL_DEST(long);
+		case TYPE_FLOAT:
+			VALUE_TYPE_CAST_ARRAY_KERNEL_DEST(float);
+		case TYPE_DOUBLE:
+			VALUE_TYPE_CAST_ARRAY_KERNEL_DEST(double);
+		default:
+			return 1;
+	}
+}
+
+value value_type_cast_array(value v, type_id id)
+{
+	type_id src_id = value_type_id(v);
+
+	type_id element_id;
+
+	value dest;
+
+	if (type_id_invalid(src_id) == 0 || type_id_invalid(id) == 0 || value_type_id_traits_scalar(id) == 0)
+	{
+		return NULL;
+	}
+
+	/* Arrays of uniform numeric values go through their typed array
+	representation first so the bulk kernel applies to them as well */
+	if (type_id_array(src_id) == 0)
+	{
+		v = value_type_cast(v, TYPE_TYPED_ARRAY);
+
+		if (v == NULL)
+		{
+			return NULL;
+		}
+	}
+	else if (type_id_typed_array(src_id) != 0)
+	{
+		return NULL;
+	}
+
+	element_id = value_typed_array_type_id(v);
+
+	/* Equal element types, avoid casting */
+	if (element_id == id)
+	{
+		return v;
+	}
+
+	/* Size preserving or narrowing conversions over an exclusively
+	owned element block run forward in place, the write cursor never
+	overtakes the read cursor so no staging buffer is required */
+	if (value_typed_array_retype(v, id) != NULL)
+	{
+		void *data = value_to_typed_array(v);
+
+		if (value_type_cast_array_kernel(data, element_id, data, id, value_typed_array_count(v)) != 0)
+		{
+			value_type_destroy(v);
+
+			return NULL;
+		}
+
+		return v;
+	}
+
+	dest = value_create_typed_array(NULL, value_typed_array_count(v), id);
+
+	if (dest == NULL)
+	{
+		return NULL;
+	}
+
+	if (value_type_cast_array_kernel(value_to_typed_array(v), element_id, value_to_typed_array(dest), id, value_typed_array_count(v)) != 0)
+	{
+		value_type_destroy(dest);
+
+		return NULL;
+	}
+
+	value_type_destroy(v);
+
+	return dest;
+}
+
 value value_type_cast(value v, type_id id)
 {
 	type_id src_id = value_type_id(v);
@@ -94,7 +258,14 @@ value value_type_cast(value v, type_id id)
 	/* Convert single value to buffer */
 	if (type_id_buffer(id) == 0 && src_id < TYPE_BUFFER)
 	{
-		value dest = value_type_create(value_data(v), value_type_id_size(src_id), TYPE_BUFFER);
+		char buffer[8] = { 0 };
+
+		value dest;
+
+		/* Decode through value_to so inline values without addressable body are supported */
+		value_to(v, (void *)&buffer[0], value_type_id_traits_size(src_id));
+
+		dest = value_type_create((void *)&buffer[0], value_type_id_traits_size(src_id), TYPE_BUFFER);
 
 		if (dest == NULL)
 		{
@@ -156,6 +327,100 @@ value value_type_cast(value v, type_id id)
 		return dest;
 	}
 
+	/* Convert typed array to array of boxed values */
+	if (type_id_typed_array(src_id) == 0 && type_id_array(id) == 0)
+	{
+		size_t index, count = value_typed_array_count(v);
+
+		type_id element_id = value_typed_array_type_id(v);
+
+		size_t element_size = value_type_id_traits_size(element_id);
+
+		const char *data = value_to_typed_array(v);
+
+		value dest = value_create_array(NULL, count);
+
+		value *dest_array;
+
+		if (dest == NULL)
+		{
+			return NULL;
+		}
+
+		dest_array = value_to_array(dest);
+
+		for (index = 0; index < count; ++index)
+		{
+			dest_array[index] = value_type_create(data + (element_size * index), element_size, element_id);
+
+			if (dest_array[index] == NULL)
+			{
+				value_type_destroy(dest);
+
+				return NULL;
+			}
+		}
+
+		value_type_destroy(v);
+
+		return dest;
+	}
+
+	/* Convert array of uniform numeric values to typed array */
+	if (type_id_array(src_id) == 0 && type_id_typed_array(id) == 0)
+	{
+		value *values = value_to_array(v);
+
+		size_t index, count = value_type_count(v);
+
+		type_id element_id;
+
+		size_t element_size;
+
+		value dest;
+
+		char *data;
+
+		if (count == 0)
+		{
+			return NULL;
+		}
+
+		element_id = value_type_id(values[0]);
+
+		if (value_type_id_traits_scalar(element_id) == 0)
+		{
+			return NULL;
+		}
+
+		element_size = value_type_id_traits_size(element_id);
+
+		dest = value_create_typed_array(NULL, count, element_id);
+
+		if (dest == NULL)
+		{
+			return NULL;
+		}
+
+		data = value_to_typed_array(dest);
+
+		for (index = 0; index < count; ++index)
+		{
+			if (value_type_id(values[index]) != element_id)
+			{
+				value_type_destroy(dest);
+
+				return NULL;
+			}
+
+			value_to(values[index], data + (element_size * index), element_size);
+		}
+
+		value_type_destroy(v);
+
+		return dest;
+	}
+
 	/* TODO: Map */
 
 	src_size = value_type_id_size(src_id);
@@ -183,13 +448,10 @@ value value_type_cast(value v, type_id id)
 
 			value_to(v, &data, src_size);
 
-			if (src_size == dest_size)
-			{
-				value_from((value)(((uintptr_t)v) + src_size), &id, sizeof(type_id));
+			/* Reuse the allocation whenever the decimal body fits in it */
+			dest = value_type_retype(v, NULL, dest_size, id);
 
-				dest = v;
-			}
-			else
+			if (dest == NULL)
 			{
 				dest = value_type_create(NULL, dest_size, id);
 
@@ -255,13 +517,10 @@ value value_type_cast(value v, type_id id)
 				return NULL;
 			}
 
-			if (src_size == dest_size)
-			{
-				value_from((value)(((uintptr_t)v) + src_size), &id, sizeof(type_id));
+			/* Reuse the allocation whenever the integer body fits in it */
+			dest = value_type_retype(v, NULL, dest_size, id);
 
-				dest = v;
-			}
-			else
+			if (dest == NULL)
 			{
 				dest = value_type_create(NULL, dest_size, id);
 
@@ -37,6 +37,8 @@ value value_type_demotion_boolean(value v, type_id id)
 		{ 0 }
 	};
 
+	boolean demotion_init = (boolean)0L;
+
 	value demotion = NULL;
 
 	type_id v_id = value_type_id(v);
@@ -53,14 +55,21 @@ value value_type_demotion_boolean(value v, type_id id)
 
 	value_to(v, (void *)&buffer.b[0], value_type_id_size(v_id));
 
-	demotion = value_type_create(NULL, value_type_id_size(id), id);
+	/* Retype in place when the boolean body fits the existing
+	allocation, the body is reset so the false case needs no write */
+	demotion = value_type_retype(v, (const void *)&demotion_init, value_type_id_size(id), id);
 
 	if (demotion == NULL)
 	{
-		return v;
-	}
+		demotion = value_type_create(NULL, value_type_id_size(id), id);
 
-	value_destroy(v);
+		if (demotion == NULL)
+		{
+			return v;
+		}
+
+		value_destroy(v);
+	}
 
 	if (type_id_decimal(v_id) == 0)
 	{
@@ -119,6 +128,14 @@ value value_type_demotion_integer(value v, type_id id)
 
 	value_to(v, (void *)&buffer[0], value_type_id_size(v_id));
 
+	/* Retype in place when the demoted body fits the existing allocation */
+	demotion = value_type_retype(v, (void *)&buffer[0], value_type_id_size(id), id);
+
+	if (demotion != NULL)
+	{
+		return demotion;
+	}
+
 	demotion = value_type_create((void *)&buffer[0], value_type_id_size(id), id);
 
 	if (demotion == NULL)
@@ -157,6 +174,14 @@ value value_type_demotion_decimal(value v, type_id id)
 
 	decimal_demotion.f = (float)decimal_demotion.d;
 
+	/* Retype in place when the demoted body fits the existing allocation */
+	demotion = value_type_retype(v, (const void *)&decimal_demotion.f, value_type_id_size(id), id);
+
+	if (demotion != NULL)
+	{
+		return demotion;
+	}
+
 	demotion = value_create_float(decimal_demotion.f);
 
 	if (demotion == NULL)
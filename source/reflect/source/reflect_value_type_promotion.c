@@ -46,6 +46,14 @@ value value_type_promotion_integer(value v, type_id id)
 
 	value_to(v, (void *)&buffer[0], value_type_id_size(v_id));
 
+	/* Retype in place when the promoted body fits the existing allocation */
+	promotion = value_type_retype(v, (void *)&buffer[0], value_type_id_size(id), id);
+
+	if (promotion != NULL)
+	{
+		return promotion;
+	}
+
 	promotion = value_type_create((void *)&buffer[0], value_type_id_size(id), id);
 
 	if (promotion == NULL)
@@ -86,6 +94,14 @@ value value_type_promotion_decimal(value v, type_id id)
 
 	decimal_promotion.d = (double)decimal_promotion.f;
 
+	/* Retype in place when the promoted body fits the existing allocation */
+	promotion = value_type_retype(v, (const void *)&decimal_promotion.d, value_type_id_size(id), id);
+
+	if (promotion != NULL)
+	{
+		return promotion;
+	}
+
 	promotion = value_create_double(decimal_promotion.d);
 
 	if (promotion == NULL)
@@ -0,0 +1,78 @@
+/*
+ *	Reflect Library by Parra Studios
+ *	A library for provide reflection and metadata representation.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <reflect/reflect_value_type.h>
+#include <reflect/reflect_value_type_traits.h>
+
+#include <preprocessor/preprocessor_for.h>
+#include <preprocessor/preprocessor_tuple.h>
+
+#include <portability/portability_assert.h>
+
+#include <stddef.h>
+
+/* -- Macros -- */
+
+/* Natural alignment of @type without C11 _Alignof, the padding byte
+forces the member to its alignment boundary */
+#define VALUE_TYPE_TRAITS_ALIGNOF(type) \
+	offsetof( \
+		struct { \
+			char padding; \
+			type member; \
+		}, \
+		member)
+
+/* Trait tuples in type id order: (size, alignment, scalar, ref counted);
+the static assert below fails whenever a type id is added to the
+enumeration without extending the table */
+#define VALUE_TYPE_TRAITS_TABLE \
+	(sizeof(boolean), VALUE_TYPE_TRAITS_ALIGNOF(boolean), 1, 0),	/* TYPE_BOOL */ \
+		(sizeof(char), VALUE_TYPE_TRAITS_ALIGNOF(char), 1, 0),		/* TYPE_CHAR */ \
+		(sizeof(short), VALUE_TYPE_TRAITS_ALIGNOF(short), 1, 0),	/* TYPE_SHORT */ \
+		(sizeof(int), VALUE_TYPE_TRAITS_ALIGNOF(int), 1, 0),		/* TYPE_INT */ \
+		(sizeof(long), VALUE_TYPE_TRAITS_ALIGNOF(long), 1, 0),		/* TYPE_LONG */ \
+		(sizeof(float), VALUE_TYPE_TRAITS_ALIGNOF(float), 1, 0),	/* TYPE_FLOAT */ \
+		(sizeof(double), VALUE_TYPE_TRAITS_ALIGNOF(double), 1, 0),	/* TYPE_DOUBLE */ \
+		(sizeof(char *), VALUE_TYPE_TRAITS_ALIGNOF(char *), 0, 0),	/* TYPE_STRING */ \
+		(sizeof(void *), VALUE_TYPE_TRAITS_ALIGNOF(void *), 0, 0),	/* TYPE_BUFFER */ \
+		(sizeof(value *), VALUE_TYPE_TRAITS_ALIGNOF(value *), 0, 1), /* TYPE_ARRAY */ \
+		(sizeof(value *), VALUE_TYPE_TRAITS_ALIGNOF(value *), 0, 1), /* TYPE_MAP */ \
+		(sizeof(void *), VALUE_TYPE_TRAITS_ALIGNOF(void *), 0, 0),	/* TYPE_PTR */ \
+		(sizeof(future), VALUE_TYPE_TRAITS_ALIGNOF(future), 0, 0),	/* TYPE_FUTURE */ \
+		(sizeof(function), VALUE_TYPE_TRAITS_ALIGNOF(function), 0, 1), /* TYPE_FUNCTION */ \
+		((size_t)0, (size_t)1, 0, 0),								/* TYPE_NULL */ \
+		(sizeof(klass), VALUE_TYPE_TRAITS_ALIGNOF(klass), 0, 1),	/* TYPE_CLASS */ \
+		(sizeof(object), VALUE_TYPE_TRAITS_ALIGNOF(object), 0, 1),	/* TYPE_OBJECT */ \
+		(sizeof(void *), VALUE_TYPE_TRAITS_ALIGNOF(void *), 0, 0),	/* TYPE_TYPED_ARRAY */ \
+		(sizeof(stream), VALUE_TYPE_TRAITS_ALIGNOF(stream), 0, 0)	/* TYPE_STREAM */
+
+#define VALUE_TYPE_TRAITS_ENTRY(tuple) { PREPROCESSOR_TUPLE_EXPAND(tuple) },
+
+/* -- Member Data -- */
+
+const struct value_type_traits_type value_type_id_traits[] = {
+	PREPROCESSOR_FOR_EACH(VALUE_TYPE_TRAITS_ENTRY, VALUE_TYPE_TRAITS_TABLE)
+};
+
+static_assert((int)sizeof(value_type_id_traits) / sizeof(value_type_id_traits[0]) == (int)TYPE_SIZE,
+	"Size of value type traits table does not match the type size.");
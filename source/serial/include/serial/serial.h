@@ -13,6 +13,8 @@
 
 #include <serial/serial_api.h>
 
+#include <serial/serial_buffer.h>
+
 #include <memory/memory.h>
 
 #include <reflect/reflect.h>
@@ -105,6 +107,26 @@ SERIAL_API const char *serial_name(serial s);
 */
 SERIAL_API char *serial_serialize(serial s, value v, size_t *size, memory_allocator allocator);
 
+/**
+*  @brief
+*    Serialize value @v with serial @s into the caller owned buffer
+*    @buffer, the buffer capacity is reused across calls so steady
+*    state serialization does not allocate
+*
+*  @param[in] s
+*    Reference to the serial
+*
+*  @param[in] v
+*    Reference to the value to be serialized
+*
+*  @param[in] buffer
+*    Reference to the reusable serialization buffer
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+SERIAL_API int serial_serialize_into(serial s, value v, serial_buffer buffer);
+
 /**
 *  @brief
 *    Convert a string @buffer to a deserialized value using serial @s
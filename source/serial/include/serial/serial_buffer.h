@@ -0,0 +1,115 @@
+/*
+ *	Serial Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing multiple serialization and deserialization formats.
+ *
+ */
+
+#ifndef SERIAL_BUFFER_H
+#define SERIAL_BUFFER_H 1
+
+/* -- Headers -- */
+
+#include <serial/serial_api.h>
+
+#include <memory/memory.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Forward Declarations -- */
+
+struct serial_buffer_type;
+
+/* -- Type Definitions -- */
+
+typedef struct serial_buffer_type *serial_buffer;
+
+/* -- Member Data -- */
+
+/* Caller owned growable buffer reused across serializations, the
+contents are only reallocated when a serialization outgrows the
+capacity retained from previous calls */
+struct serial_buffer_type
+{
+	char *data;					/**< Serialized contents including the null terminator */
+	size_t size;				/**< Bytes used by the current contents */
+	size_t capacity;			/**< Bytes allocated for @data */
+	memory_allocator allocator; /**< Allocator backing @data */
+};
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Initialize the caller owned buffer @buffer backed by @allocator
+*
+*  @param[in] buffer
+*    Pointer to the buffer
+*
+*  @param[in] allocator
+*    Allocator used to grow and free the contents
+*/
+SERIAL_API void serial_buffer_initialize(serial_buffer buffer, memory_allocator allocator);
+
+/**
+*  @brief
+*    Grow the buffer so it can hold at least @capacity bytes,
+*    preserving the current contents
+*
+*  @param[in] buffer
+*    Pointer to the buffer
+*
+*  @param[in] capacity
+*    Minimum capacity in bytes
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+SERIAL_API int serial_buffer_reserve(serial_buffer buffer, size_t capacity);
+
+/**
+*  @brief
+*    Append @size bytes from @data to the buffer, growing it
+*    geometrically when the capacity is exceeded
+*
+*  @param[in] buffer
+*    Pointer to the buffer
+*
+*  @param[in] data
+*    Bytes to be appended
+*
+*  @param[in] size
+*    Number of bytes to append
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+SERIAL_API int serial_buffer_write(serial_buffer buffer, const char *data, size_t size);
+
+/**
+*  @brief
+*    Discard the contents keeping the capacity for reuse
+*
+*  @param[in] buffer
+*    Pointer to the buffer
+*/
+SERIAL_API void serial_buffer_clear(serial_buffer buffer);
+
+/**
+*  @brief
+*    Free the contents of the buffer, the buffer struct itself
+*    is owned by the caller
+*
+*  @param[in] buffer
+*    Pointer to the buffer
+*/
+SERIAL_API void serial_buffer_destroy(serial_buffer buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SERIAL_BUFFER_H */
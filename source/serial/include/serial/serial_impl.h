@@ -13,6 +13,8 @@
 
 #include <serial/serial_api.h>
 
+#include <serial/serial_buffer.h>
+
 #include <memory/memory.h>
 
 #include <reflect/reflect.h>
@@ -95,6 +97,25 @@ SERIAL_API int serial_impl_load(serial_impl impl, const char *path, const char *
 */
 SERIAL_API char *serial_impl_serialize(serial_impl impl, value v, size_t *size, memory_allocator allocator);
 
+/**
+*  @brief
+*    Serialize value @v into the caller owned buffer @buffer,
+*    reusing its capacity across calls
+*
+*  @param[in] impl
+*    Reference to the serial implementation
+*
+*  @param[in] v
+*    Reference to the value to be serialized
+*
+*  @param[in] buffer
+*    Reference to the reusable serialization buffer
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+SERIAL_API int serial_impl_serialize_into(serial_impl impl, value v, serial_buffer buffer);
+
 /**
 *  @brief
 *    Convert a string @buffer to a deserialized value using serial implementation @impl
@@ -13,6 +13,7 @@
 
 #include <serial/serial_api.h>
 
+#include <serial/serial_buffer.h>
 #include <serial/serial_impl_handle.h>
 
 #include <memory/memory.h>
@@ -35,6 +36,8 @@ typedef serial_impl_handle (*serial_interface_initialize)(memory_allocator);
 
 typedef char *(*serial_interface_serialize)(serial_impl_handle, value, size_t *);
 
+typedef int (*serial_interface_serialize_into)(serial_impl_handle, value, serial_buffer);
+
 typedef value (*serial_interface_deserialize)(serial_impl_handle, const char *, size_t);
 
 typedef int (*serial_interface_destroy)(serial_impl_handle);
@@ -50,6 +53,7 @@ struct serial_interface_type
 	serial_interface_extension extension;
 	serial_interface_initialize initialize;
 	serial_interface_serialize serialize;
+	serial_interface_serialize_into serialize_into;
 	serial_interface_deserialize deserialize;
 	serial_interface_destroy destroy;
 };
@@ -0,0 +1,95 @@
+/*
+ *	Serial Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing multiple serialization and deserialization formats.
+ *
+ */
+
+#ifndef SERIAL_SCHEMA_H
+#define SERIAL_SCHEMA_H 1
+
+/* -- Headers -- */
+
+#include <serial/serial_api.h>
+
+#include <serial/serial.h>
+#include <serial/serial_buffer.h>
+
+#include <memory/memory.h>
+
+#include <reflect/reflect_value_type.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Forward Declarations -- */
+
+struct serial_schema_type;
+
+/* -- Type Definitions -- */
+
+typedef struct serial_schema_type *serial_schema;
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Compile a serialization plan from the shape of @sample, a flat
+*    sequence of structural literals and leaf emissions with
+*    precomputed child paths. Values sharing the shape of @sample
+*    (same container arities, map keys and leaf types) serialize
+*    through the plan without walking the tree or dispatching on
+*    type per node
+*
+*  @param[in] s
+*    Serial implementation the plan emits through
+*
+*  @param[in] sample
+*    Value whose shape is compiled
+*
+*  @param[in] allocator
+*    Allocator used during compilation and for the leaf scratch buffer
+*
+*  @return
+*    Pointer to the schema on success, null when the shape cannot be
+*    compiled (the caller falls back to serial_serialize)
+*/
+SERIAL_API serial_schema serial_schema_compile(serial s, value sample, memory_allocator allocator);
+
+/**
+*  @brief
+*    Serialize @v through the plan of @schema into @buffer,
+*    overwriting its contents. A schema serializes from one thread
+*    at a time, it keeps internal scratch state between calls
+*
+*  @param[in] schema
+*    Pointer to the compiled schema
+*
+*  @param[in] v
+*    Value to serialize, it must match the compiled shape
+*
+*  @param[in] buffer
+*    Caller owned buffer receiving the serialization
+*
+*  @return
+*    Zero on success, different from zero when @v does not match the
+*    shape (the caller falls back to serial_serialize)
+*/
+SERIAL_API int serial_schema_serialize(serial_schema schema, value v, serial_buffer buffer);
+
+/**
+*  @brief
+*    Destroy the schema and its plan
+*
+*  @param[in] schema
+*    Pointer to the compiled schema
+*/
+SERIAL_API void serial_schema_destroy(serial_schema schema);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SERIAL_SCHEMA_H */
@@ -159,6 +159,18 @@ char *serial_serialize(serial s, value v, size_t *size, memory_allocator allocat
 	return serial_impl_serialize(s->impl, v, size, allocator);
 }
 
+int serial_serialize_into(serial s, value v, serial_buffer buffer)
+{
+	if (s == NULL || v == NULL || buffer == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization called with wrong arguments");
+
+		return 1;
+	}
+
+	return serial_impl_serialize_into(s->impl, v, buffer);
+}
+
 value serial_deserialize(serial s, const char *buffer, size_t size, memory_allocator allocator)
 {
 	if (s == NULL || buffer == NULL || size == 0)
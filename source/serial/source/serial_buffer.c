@@ -0,0 +1,121 @@
+/*
+ *	Serial Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing multiple serialization and deserialization formats.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <serial/serial_buffer.h>
+
+#include <log/log.h>
+
+#include <string.h>
+
+/* -- Definitions -- */
+
+#define SERIAL_BUFFER_CAPACITY_MIN ((size_t)0x100) /**< Minimum capacity on first growth */
+
+/* -- Methods -- */
+
+void serial_buffer_initialize(serial_buffer buffer, memory_allocator allocator)
+{
+	if (buffer != NULL)
+	{
+		buffer->data = NULL;
+		buffer->size = 0;
+		buffer->capacity = 0;
+		buffer->allocator = allocator;
+	}
+}
+
+int serial_buffer_reserve(serial_buffer buffer, size_t capacity)
+{
+	char *data;
+
+	if (buffer == NULL)
+	{
+		return 1;
+	}
+
+	if (capacity <= buffer->capacity)
+	{
+		return 0;
+	}
+
+	if (buffer->data == NULL)
+	{
+		data = memory_allocator_allocate(buffer->allocator, capacity);
+	}
+	else
+	{
+		data = memory_allocator_reallocate(buffer->allocator, buffer->data, buffer->capacity, capacity);
+	}
+
+	if (data == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid serial buffer reservation");
+
+		return 1;
+	}
+
+	buffer->data = data;
+	buffer->capacity = capacity;
+
+	return 0;
+}
+
+int serial_buffer_write(serial_buffer buffer, const char *data, size_t size)
+{
+	if (buffer == NULL || data == NULL)
+	{
+		return 1;
+	}
+
+	if (buffer->size + size > buffer->capacity)
+	{
+		size_t capacity = (buffer->capacity < SERIAL_BUFFER_CAPACITY_MIN) ? SERIAL_BUFFER_CAPACITY_MIN : (buffer->capacity << 1);
+
+		if (capacity < buffer->size + size)
+		{
+			capacity = buffer->size + size;
+		}
+
+		if (serial_buffer_reserve(buffer, capacity) != 0)
+		{
+			return 1;
+		}
+	}
+
+	memcpy(buffer->data + buffer->size, data, size);
+
+	buffer->size += size;
+
+	return 0;
+}
+
+void serial_buffer_clear(serial_buffer buffer)
+{
+	if (buffer != NULL)
+	{
+		buffer->size = 0;
+	}
+}
+
+void serial_buffer_destroy(serial_buffer buffer)
+{
+	if (buffer != NULL)
+	{
+		if (buffer->data != NULL)
+		{
+			memory_allocator_deallocate(buffer->allocator, buffer->data);
+
+			buffer->data = NULL;
+		}
+
+		buffer->size = 0;
+		buffer->capacity = 0;
+	}
+}
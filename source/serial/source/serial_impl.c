@@ -182,6 +182,41 @@ char *serial_impl_serialize(serial_impl impl, value v, size_t *size, memory_allo
 	return buffer;
 }
 
+int serial_impl_serialize_into(serial_impl impl, value v, serial_buffer buffer)
+{
+	serial_impl_handle handle;
+
+	int result;
+
+	if (buffer == NULL)
+	{
+		return 1;
+	}
+
+	handle = impl->iface->initialize(buffer->allocator);
+
+	if (handle == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid serial implementation handle initialization");
+
+		return 1;
+	}
+
+	result = impl->iface->serialize_into(handle, v, buffer);
+
+	if (result != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid serial implementation handle serialization");
+	}
+
+	if (impl->iface->destroy(handle) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid serial implementation handle destruction");
+	}
+
+	return result;
+}
+
 value serial_impl_deserialize(serial_impl impl, const char *buffer, size_t size, memory_allocator allocator)
 {
 	serial_impl_handle handle = impl->iface->initialize(allocator);
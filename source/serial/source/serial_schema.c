@@ -0,0 +1,460 @@
+/*
+ *	Serial Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing multiple serialization and deserialization formats.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <serial/serial_schema.h>
+
+#include <log/log.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+#define SERIAL_SCHEMA_PATH_SIZE ((size_t)0x20) /**< Maximum nesting depth of a compiled shape */
+
+/* -- Forward Declarations -- */
+
+struct serial_schema_op_type;
+
+struct serial_schema_compile_ctx_type;
+
+/* -- Type Definitions -- */
+
+typedef struct serial_schema_op_type *serial_schema_op;
+
+typedef struct serial_schema_compile_ctx_type *serial_schema_compile_ctx;
+
+/* -- Member Data -- */
+
+/* The plan interleaves structural literals (separators, brackets and
+map keys, split out of a serialization of the sample) with leaf
+emissions addressed by precomputed child index paths */
+struct serial_schema_op_type
+{
+	char *literal;		 /**< Structural bytes emitted before the leaf */
+	size_t literal_size; /**< Length of @literal without null terminator */
+	size_t *path;		 /**< Child indexes from the root to the leaf */
+	size_t path_size;	 /**< Number of indexes in @path */
+	type_id id;			 /**< Expected type of the leaf */
+};
+
+struct serial_schema_type
+{
+	serial s;						  /**< Serial implementation the plan emits through */
+	memory_allocator allocator;		  /**< Allocator backing the scratch buffer */
+	struct serial_schema_op_type *ops; /**< Leaf operations in emission order */
+	size_t count;					  /**< Number of operations */
+	char *trailer;					  /**< Structural bytes emitted after the last leaf */
+	size_t trailer_size;			  /**< Length of @trailer without null terminator */
+	struct serial_buffer_type scratch; /**< Reused buffer for leaf emission */
+};
+
+struct serial_schema_compile_ctx_type
+{
+	serial s;					/**< Serial implementation used for matching */
+	memory_allocator allocator; /**< Allocator for the intermediate serializations */
+	const char *full;			/**< Serialization of the whole sample */
+	size_t cursor;				/**< Position of the next literal inside @full */
+	serial_schema_op ops;		/**< Operation array being filled */
+	size_t index;				/**< Next operation to fill */
+	size_t path[SERIAL_SCHEMA_PATH_SIZE]; /**< Indexes of the current traversal */
+};
+
+/* -- Private Methods -- */
+
+static size_t serial_schema_leaf_count(value v);
+
+static int serial_schema_compile_walk(serial_schema_compile_ctx ctx, value v, size_t depth);
+
+static value serial_schema_resolve(value v, const size_t *path, size_t path_size);
+
+/* -- Methods -- */
+
+static size_t serial_schema_leaf_count(value v)
+{
+	type_id id = value_type_id(v);
+
+	size_t count = 0, iterator, size;
+
+	if (id == TYPE_ARRAY)
+	{
+		value *elements = value_to_array(v);
+
+		size = value_type_count(v);
+
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			count += serial_schema_leaf_count(elements[iterator]);
+		}
+
+		return count;
+	}
+
+	if (id == TYPE_MAP)
+	{
+		value *pairs = value_to_map(v);
+
+		size = value_type_count(v);
+
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			value *tuple = value_to_array(pairs[iterator]);
+
+			/* Keys are part of the structure, only the pair values
+			vary between payloads of the same shape */
+			count += serial_schema_leaf_count(tuple[1]);
+		}
+
+		return count;
+	}
+
+	return 1;
+}
+
+static int serial_schema_compile_walk(serial_schema_compile_ctx ctx, value v, size_t depth)
+{
+	type_id id = value_type_id(v);
+
+	size_t iterator, size;
+
+	if (depth >= SERIAL_SCHEMA_PATH_SIZE)
+	{
+		return 1;
+	}
+
+	if (id == TYPE_ARRAY)
+	{
+		value *elements = value_to_array(v);
+
+		size = value_type_count(v);
+
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			ctx->path[depth] = iterator;
+
+			if (serial_schema_compile_walk(ctx, elements[iterator], depth + 1) != 0)
+			{
+				return 1;
+			}
+		}
+
+		return 0;
+	}
+
+	if (id == TYPE_MAP)
+	{
+		value *pairs = value_to_map(v);
+
+		size = value_type_count(v);
+
+		if (depth + 1 >= SERIAL_SCHEMA_PATH_SIZE)
+		{
+			return 1;
+		}
+
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			value *tuple = value_to_array(pairs[iterator]);
+
+			ctx->path[depth] = iterator;
+			ctx->path[depth + 1] = 1;
+
+			if (serial_schema_compile_walk(ctx, tuple[1], depth + 2) != 0)
+			{
+				return 1;
+			}
+		}
+
+		return 0;
+	}
+
+	/* Leaf: serialize it alone and locate its bytes inside the sample
+	serialization, the gap since the previous match is the structural
+	literal emitted before this leaf */
+	{
+		serial_schema_op op = &ctx->ops[ctx->index];
+
+		size_t text_size;
+
+		char *text = serial_serialize(ctx->s, v, &text_size, ctx->allocator);
+
+		const char *match;
+
+		size_t length;
+
+		if (text == NULL)
+		{
+			return 1;
+		}
+
+		length = strlen(text);
+
+		match = strstr(&ctx->full[ctx->cursor], text);
+
+		if (match == NULL)
+		{
+			/* The leaf bytes are not recognizable inside the sample
+			serialization, the shape cannot be compiled safely */
+			memory_allocator_deallocate(ctx->allocator, text);
+
+			return 1;
+		}
+
+		memory_allocator_deallocate(ctx->allocator, text);
+
+		op->literal_size = (size_t)(match - &ctx->full[ctx->cursor]);
+
+		op->literal = malloc(op->literal_size + 1);
+
+		if (op->literal == NULL)
+		{
+			return 1;
+		}
+
+		memcpy(op->literal, &ctx->full[ctx->cursor], op->literal_size);
+
+		op->literal[op->literal_size] = '\0';
+
+		op->path_size = depth;
+
+		op->path = malloc(depth > 0 ? depth * sizeof(size_t) : sizeof(size_t));
+
+		if (op->path == NULL)
+		{
+			return 1;
+		}
+
+		memcpy(op->path, ctx->path, depth * sizeof(size_t));
+
+		op->id = id;
+
+		ctx->cursor = (size_t)(match - ctx->full) + length;
+
+		++ctx->index;
+
+		return 0;
+	}
+}
+
+serial_schema serial_schema_compile(serial s, value sample, memory_allocator allocator)
+{
+	serial_schema schema;
+
+	struct serial_schema_compile_ctx_type ctx;
+
+	char *full;
+
+	size_t full_size, count, iterator;
+
+	if (s == NULL || sample == NULL || allocator == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid schema compilation arguments");
+
+		return NULL;
+	}
+
+	full = serial_serialize(s, sample, &full_size, allocator);
+
+	if (full == NULL)
+	{
+		return NULL;
+	}
+
+	count = serial_schema_leaf_count(sample);
+
+	schema = malloc(sizeof(struct serial_schema_type));
+
+	if (schema == NULL)
+	{
+		memory_allocator_deallocate(allocator, full);
+
+		return NULL;
+	}
+
+	schema->s = s;
+	schema->allocator = allocator;
+	schema->count = count;
+	schema->trailer = NULL;
+	schema->trailer_size = 0;
+
+	schema->ops = malloc(count > 0 ? count * sizeof(struct serial_schema_op_type) : sizeof(struct serial_schema_op_type));
+
+	if (schema->ops == NULL)
+	{
+		memory_allocator_deallocate(allocator, full);
+
+		free(schema);
+
+		return NULL;
+	}
+
+	for (iterator = 0; iterator < count; ++iterator)
+	{
+		schema->ops[iterator].literal = NULL;
+		schema->ops[iterator].path = NULL;
+	}
+
+	serial_buffer_initialize(&schema->scratch, allocator);
+
+	ctx.s = s;
+	ctx.allocator = allocator;
+	ctx.full = full;
+	ctx.cursor = 0;
+	ctx.ops = schema->ops;
+	ctx.index = 0;
+
+	if (serial_schema_compile_walk(&ctx, sample, 0) != 0 || ctx.index != count)
+	{
+		log_write("metacall", LOG_LEVEL_DEBUG, "Schema compilation fell back, the sample shape is not compilable");
+
+		memory_allocator_deallocate(allocator, full);
+
+		serial_schema_destroy(schema);
+
+		return NULL;
+	}
+
+	/* Structural bytes after the last leaf (closing brackets) */
+	schema->trailer_size = strlen(&full[ctx.cursor]);
+
+	schema->trailer = malloc(schema->trailer_size + 1);
+
+	if (schema->trailer == NULL)
+	{
+		memory_allocator_deallocate(allocator, full);
+
+		serial_schema_destroy(schema);
+
+		return NULL;
+	}
+
+	memcpy(schema->trailer, &full[ctx.cursor], schema->trailer_size + 1);
+
+	memory_allocator_deallocate(allocator, full);
+
+	return schema;
+}
+
+static value serial_schema_resolve(value v, const size_t *path, size_t path_size)
+{
+	size_t iterator;
+
+	for (iterator = 0; iterator < path_size; ++iterator)
+	{
+		type_id id = value_type_id(v);
+
+		value *children;
+
+		if (id == TYPE_ARRAY)
+		{
+			children = value_to_array(v);
+		}
+		else if (id == TYPE_MAP)
+		{
+			children = value_to_map(v);
+		}
+		else
+		{
+			return NULL;
+		}
+
+		if (path[iterator] >= value_type_count(v))
+		{
+			return NULL;
+		}
+
+		v = children[path[iterator]];
+	}
+
+	return v;
+}
+
+int serial_schema_serialize(serial_schema schema, value v, serial_buffer buffer)
+{
+	size_t iterator;
+
+	if (schema == NULL || v == NULL || buffer == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid schema serialization arguments");
+
+		return 1;
+	}
+
+	serial_buffer_clear(buffer);
+
+	for (iterator = 0; iterator < schema->count; ++iterator)
+	{
+		serial_schema_op op = &schema->ops[iterator];
+
+		value leaf;
+
+		if (serial_buffer_write(buffer, op->literal, op->literal_size) != 0)
+		{
+			return 1;
+		}
+
+		leaf = serial_schema_resolve(v, op->path, op->path_size);
+
+		if (leaf == NULL || value_type_id(leaf) != op->id)
+		{
+			/* The value does not match the compiled shape */
+			return 1;
+		}
+
+		if (serial_serialize_into(schema->s, leaf, &schema->scratch) != 0)
+		{
+			return 1;
+		}
+
+		if (serial_buffer_write(buffer, schema->scratch.data, schema->scratch.size > 0 ? schema->scratch.size - 1 : 0) != 0)
+		{
+			return 1;
+		}
+	}
+
+	if (serial_buffer_write(buffer, schema->trailer, schema->trailer_size + 1) != 0)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+void serial_schema_destroy(serial_schema schema)
+{
+	if (schema != NULL)
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < schema->count; ++iterator)
+		{
+			if (schema->ops[iterator].literal != NULL)
+			{
+				free(schema->ops[iterator].literal);
+			}
+
+			if (schema->ops[iterator].path != NULL)
+			{
+				free(schema->ops[iterator].path);
+			}
+		}
+
+		free(schema->ops);
+
+		if (schema->trailer != NULL)
+		{
+			free(schema->trailer);
+		}
+
+		serial_buffer_destroy(&schema->scratch);
+
+		free(schema);
+	}
+}
@@ -0,0 +1,115 @@
+/*
+ *	Serial Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing multiple serialization and deserialization formats.
+ *
+ */
+
+#ifndef BINARY_SERIAL_IMPL_H
+#define BINARY_SERIAL_IMPL_H 1
+
+/* -- Headers -- */
+
+#include <binary_serial/binary_serial_api.h>
+
+#include <serial/serial_interface.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Retrieve extension supported by Binary Format implementation
+*
+*  @return
+*    Returns constant string representing serial extension
+*
+*/
+BINARY_SERIAL_API const char *binary_serial_impl_extension(void);
+
+/**
+*  @brief
+*    Initialize Binary Format document implementation
+*
+*  @return
+*    Returns pointer to serial document implementation on success, null pointer otherwise
+*
+*/
+BINARY_SERIAL_API serial_impl_handle binary_serial_impl_initialize(memory_allocator allocator);
+
+/**
+*  @brief
+*    Serialize with Binary Format document implementation @handle
+*
+*  @param[in] handle
+*    Pointer to the serial document implementation
+*
+*  @param[in] v
+*    Reference to the value is going to be serialized
+*
+*  @param[out] size
+*    Size in bytes of the return buffer
+*
+*  @return
+*    Buffer with the value serialized on correct serialization, null otherwise
+*
+*/
+BINARY_SERIAL_API char *binary_serial_impl_serialize(serial_impl_handle handle, value v, size_t *size);
+
+/**
+*  @brief
+*    Serialize with Binary Format implementation @handle
+*    into the caller owned buffer @buffer, reusing its capacity
+*
+*  @param[in] handle
+*    Reference to the serial implementation
+*
+*  @param[in] v
+*    Reference to the value is going to be serialized
+*
+*  @param[in] buffer
+*    Reference to the reusable serialization buffer
+*
+*  @return
+*    Zero on correct serialization, different from zero otherwise
+*/
+BINARY_SERIAL_API int binary_serial_impl_serialize_into(serial_impl_handle handle, value v, serial_buffer buffer);
+
+/**
+*  @brief
+*    Deserialize with Binary Format document implementation @handle
+*
+*  @param[in] handle
+*    Pointer to the serial document implementation
+*
+*  @param[in] buffer
+*    Reference to the buffer is going to be deserialized
+*
+*  @param[in] size
+*    Size in bytes of the buffer @buffer
+*
+*  @return
+*    Pointer to value deserialized on correct serialization, null otherwise
+*
+*/
+BINARY_SERIAL_API value binary_serial_impl_deserialize(serial_impl_handle handle, const char *buffer, size_t size);
+
+/**
+*  @brief
+*    Destroy Binary Format document implementation
+*
+*  @return
+*    Returns zero on correct destruction, distinct from zero otherwise
+*
+*/
+BINARY_SERIAL_API int binary_serial_impl_destroy(serial_impl_handle handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BINARY_SERIAL_IMPL_H */
@@ -0,0 +1,47 @@
+/*
+ *	Serial Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing multiple serialization and deserialization formats.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <metacall/metacall_version.h>
+
+#include <binary_serial/binary_serial.h>
+#include <binary_serial/binary_serial_impl.h>
+
+/* -- Methods -- */
+
+serial_interface binary_serial_impl_interface_singleton()
+{
+	static struct serial_interface_type interface_instance_binary = {
+		&binary_serial_impl_extension,
+		&binary_serial_impl_initialize,
+		&binary_serial_impl_serialize,
+		&binary_serial_impl_serialize_into,
+		&binary_serial_impl_deserialize,
+		&binary_serial_impl_destroy
+	};
+
+	return &interface_instance_binary;
+}
+
+const char *binary_serial_print_info()
+{
+	static const char binary_serial_info[] =
+		"Binary Format Serial Plugin " METACALL_VERSION "\n"
+		"Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>\n"
+
+#ifdef BINARY_SERIAL_STATIC_DEFINE
+		"Compiled as static library type\n"
+#else
+		"Compiled as shared library type\n"
+#endif
+
+		"\n";
+
+	return binary_serial_info;
+}
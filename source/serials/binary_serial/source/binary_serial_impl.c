@@ -0,0 +1,574 @@
+/*
+ *	Serial Library by Parra Studios
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing multiple serialization and deserialization formats.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <binary_serial/binary_serial_impl.h>
+
+#include <reflect/reflect_value_type.h>
+#include <reflect/reflect_value_type_id_size.h>
+
+#include <log/log.h>
+
+#include <stdint.h>
+#include <string.h>
+
+/* -- Format --
+
+Length prefixed binary encoding designed for passing values between
+processes on the same machine, scalars and typed array element runs
+are stored as raw host endian bytes so encoding and decoding reduce
+to a memcpy instead of text formatting:
+
+	value       := tag payload
+	tag         := uint8 (type_id)
+	scalar      := raw bytes of the scalar (bool .. double, ptr)
+	string      := uint64 length, bytes (terminator not stored)
+	buffer      := uint64 size, bytes
+	array       := uint64 count, count * value
+	map         := uint64 count, count * value (each tuple an array)
+	typed array := uint8 element tag, uint64 count, raw element block
+	null        := tag only
+
+The encoding is host endian and not meant for persistent storage or
+transport between machines of different architectures */
+
+/* -- Private Methods -- */
+
+static int binary_serial_impl_size_value(value v, size_t *size);
+
+static void binary_serial_impl_write_value(value v, char **cursor);
+
+static value binary_serial_impl_read_value(const char **cursor, size_t *remaining);
+
+/* -- Methods -- */
+
+const char *binary_serial_impl_extension()
+{
+	static const char extension[] = "mcb";
+
+	return extension;
+}
+
+serial_impl_handle binary_serial_impl_initialize(memory_allocator allocator)
+{
+	return allocator;
+}
+
+int binary_serial_impl_size_value(value v, size_t *size)
+{
+	type_id id = value_type_id(v);
+
+	size_t iterator, count;
+
+	/* Tag byte */
+	*size += sizeof(uint8_t);
+
+	switch (id)
+	{
+		case TYPE_BOOL:
+		case TYPE_CHAR:
+		case TYPE_SHORT:
+		case TYPE_INT:
+		case TYPE_LONG:
+		case TYPE_FLOAT:
+		case TYPE_DOUBLE:
+		case TYPE_PTR: {
+			*size += value_type_id_size(id);
+
+			return 0;
+		}
+
+		case TYPE_STRING: {
+			*size += sizeof(uint64_t) + (value_type_size(v) - 1);
+
+			return 0;
+		}
+
+		case TYPE_BUFFER: {
+			*size += sizeof(uint64_t) + value_type_size(v);
+
+			return 0;
+		}
+
+		case TYPE_ARRAY:
+		case TYPE_MAP: {
+			value *values = (id == TYPE_ARRAY) ? value_to_array(v) : value_to_map(v);
+
+			count = value_type_count(v);
+
+			*size += sizeof(uint64_t);
+
+			for (iterator = 0; iterator < count; ++iterator)
+			{
+				if (binary_serial_impl_size_value(values[iterator], size) != 0)
+				{
+					return 1;
+				}
+			}
+
+			return 0;
+		}
+
+		case TYPE_TYPED_ARRAY: {
+			*size += sizeof(uint8_t) + sizeof(uint64_t) + value_typed_array_count(v) * value_type_id_size(value_typed_array_type_id(v));
+
+			return 0;
+		}
+
+		case TYPE_NULL: {
+			return 0;
+		}
+
+		default: {
+			log_write("metacall", LOG_LEVEL_ERROR, "Unsupported type (%d) in Binary Format implementation", (int)id);
+
+			return 1;
+		}
+	}
+}
+
+void binary_serial_impl_write_value(value v, char **cursor)
+{
+	type_id id = value_type_id(v);
+
+	uint8_t tag = (uint8_t)id;
+
+	uint64_t length;
+
+	size_t iterator, count;
+
+	memcpy(*cursor, &tag, sizeof(uint8_t));
+
+	*cursor += sizeof(uint8_t);
+
+	switch (id)
+	{
+		case TYPE_BOOL:
+		case TYPE_CHAR:
+		case TYPE_SHORT:
+		case TYPE_INT:
+		case TYPE_LONG:
+		case TYPE_FLOAT:
+		case TYPE_DOUBLE:
+		case TYPE_PTR: {
+			size_t bytes = value_type_id_size(id);
+
+			memcpy(*cursor, value_data(v), bytes);
+
+			*cursor += bytes;
+
+			break;
+		}
+
+		case TYPE_STRING: {
+			length = (uint64_t)(value_type_size(v) - 1);
+
+			memcpy(*cursor, &length, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+
+			memcpy(*cursor, value_to_string(v), (size_t)length);
+
+			*cursor += (size_t)length;
+
+			break;
+		}
+
+		case TYPE_BUFFER: {
+			length = (uint64_t)value_type_size(v);
+
+			memcpy(*cursor, &length, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+
+			memcpy(*cursor, value_to_buffer(v), (size_t)length);
+
+			*cursor += (size_t)length;
+
+			break;
+		}
+
+		case TYPE_ARRAY:
+		case TYPE_MAP: {
+			value *values = (id == TYPE_ARRAY) ? value_to_array(v) : value_to_map(v);
+
+			count = value_type_count(v);
+
+			length = (uint64_t)count;
+
+			memcpy(*cursor, &length, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+
+			for (iterator = 0; iterator < count; ++iterator)
+			{
+				binary_serial_impl_write_value(values[iterator], cursor);
+			}
+
+			break;
+		}
+
+		case TYPE_TYPED_ARRAY: {
+			uint8_t element_tag = (uint8_t)value_typed_array_type_id(v);
+
+			size_t block_size;
+
+			count = value_typed_array_count(v);
+
+			block_size = count * value_type_id_size((type_id)element_tag);
+
+			memcpy(*cursor, &element_tag, sizeof(uint8_t));
+
+			*cursor += sizeof(uint8_t);
+
+			length = (uint64_t)count;
+
+			memcpy(*cursor, &length, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+
+			/* Scalar run stored as a single raw block */
+			memcpy(*cursor, value_to_typed_array(v), block_size);
+
+			*cursor += block_size;
+
+			break;
+		}
+
+		case TYPE_NULL:
+		default: {
+			break;
+		}
+	}
+}
+
+char *binary_serial_impl_serialize(serial_impl_handle handle, value v, size_t *size)
+{
+	memory_allocator allocator;
+
+	size_t length = 0;
+
+	char *buffer, *cursor;
+
+	if (handle == NULL || v == NULL || size == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization called with wrong arguments in Binary Format implementation");
+
+		return NULL;
+	}
+
+	allocator = (memory_allocator)handle;
+
+	if (binary_serial_impl_size_value(v, &length) != 0 || length == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization invalid length calculation in Binary Format implementation");
+
+		return NULL;
+	}
+
+	buffer = memory_allocator_allocate(allocator, length);
+
+	if (buffer == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization invalid buffer allocation in Binary Format implementation");
+
+		*size = 0;
+
+		return NULL;
+	}
+
+	cursor = buffer;
+
+	binary_serial_impl_write_value(v, &cursor);
+
+	*size = length;
+
+	return buffer;
+}
+
+int binary_serial_impl_serialize_into(serial_impl_handle handle, value v, serial_buffer buffer)
+{
+	size_t length = 0;
+
+	char *cursor;
+
+	if (handle == NULL || v == NULL || buffer == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization called with wrong arguments in Binary Format implementation");
+
+		return 1;
+	}
+
+	if (binary_serial_impl_size_value(v, &length) != 0 || length == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization invalid length calculation in Binary Format implementation");
+
+		return 1;
+	}
+
+	if (serial_buffer_reserve(buffer, length) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization invalid buffer reservation in Binary Format implementation");
+
+		return 1;
+	}
+
+	serial_buffer_clear(buffer);
+
+	cursor = buffer->data;
+
+	binary_serial_impl_write_value(v, &cursor);
+
+	buffer->size = length;
+
+	return 0;
+}
+
+value binary_serial_impl_read_value(const char **cursor, size_t *remaining)
+{
+	uint8_t tag;
+
+	uint64_t length;
+
+	type_id id;
+
+	if (*remaining < sizeof(uint8_t))
+	{
+		return NULL;
+	}
+
+	memcpy(&tag, *cursor, sizeof(uint8_t));
+
+	*cursor += sizeof(uint8_t);
+	*remaining -= sizeof(uint8_t);
+
+	id = (type_id)tag;
+
+	switch (id)
+	{
+		case TYPE_BOOL:
+		case TYPE_CHAR:
+		case TYPE_SHORT:
+		case TYPE_INT:
+		case TYPE_LONG:
+		case TYPE_FLOAT:
+		case TYPE_DOUBLE:
+		case TYPE_PTR: {
+			size_t bytes = value_type_id_size(id);
+
+			value v;
+
+			if (*remaining < bytes)
+			{
+				return NULL;
+			}
+
+			v = value_type_create(*cursor, bytes, id);
+
+			*cursor += bytes;
+			*remaining -= bytes;
+
+			return v;
+		}
+
+		case TYPE_STRING: {
+			value v;
+
+			if (*remaining < sizeof(uint64_t))
+			{
+				return NULL;
+			}
+
+			memcpy(&length, *cursor, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+			*remaining -= sizeof(uint64_t);
+
+			if (*remaining < (size_t)length)
+			{
+				return NULL;
+			}
+
+			v = value_create_string(*cursor, (size_t)length);
+
+			*cursor += (size_t)length;
+			*remaining -= (size_t)length;
+
+			return v;
+		}
+
+		case TYPE_BUFFER: {
+			value v;
+
+			if (*remaining < sizeof(uint64_t))
+			{
+				return NULL;
+			}
+
+			memcpy(&length, *cursor, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+			*remaining -= sizeof(uint64_t);
+
+			if (*remaining < (size_t)length)
+			{
+				return NULL;
+			}
+
+			v = value_create_buffer(*cursor, (size_t)length);
+
+			*cursor += (size_t)length;
+			*remaining -= (size_t)length;
+
+			return v;
+		}
+
+		case TYPE_ARRAY:
+		case TYPE_MAP: {
+			value v;
+
+			value *values;
+
+			size_t iterator, count;
+
+			if (*remaining < sizeof(uint64_t))
+			{
+				return NULL;
+			}
+
+			memcpy(&length, *cursor, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+			*remaining -= sizeof(uint64_t);
+
+			count = (size_t)length;
+
+			/* Each element needs at least its tag byte */
+			if (*remaining < count)
+			{
+				return NULL;
+			}
+
+			v = (id == TYPE_ARRAY) ? value_create_array(NULL, count) : value_create_map(NULL, count);
+
+			if (v == NULL)
+			{
+				return NULL;
+			}
+
+			values = (id == TYPE_ARRAY) ? value_to_array(v) : value_to_map(v);
+
+			for (iterator = 0; iterator < count; ++iterator)
+			{
+				values[iterator] = binary_serial_impl_read_value(cursor, remaining);
+
+				if (values[iterator] == NULL)
+				{
+					/* Unread elements are left null, destroy releases
+					the ones decoded so far */
+					value_type_destroy(v);
+
+					return NULL;
+				}
+			}
+
+			return v;
+		}
+
+		case TYPE_TYPED_ARRAY: {
+			uint8_t element_tag;
+
+			size_t count, block_size;
+
+			value v;
+
+			if (*remaining < sizeof(uint8_t) + sizeof(uint64_t))
+			{
+				return NULL;
+			}
+
+			memcpy(&element_tag, *cursor, sizeof(uint8_t));
+
+			*cursor += sizeof(uint8_t);
+			*remaining -= sizeof(uint8_t);
+
+			memcpy(&length, *cursor, sizeof(uint64_t));
+
+			*cursor += sizeof(uint64_t);
+			*remaining -= sizeof(uint64_t);
+
+			if (type_id_boolean((type_id)element_tag) != 0 && type_id_char((type_id)element_tag) != 0 && type_id_integer((type_id)element_tag) != 0 && type_id_decimal((type_id)element_tag) != 0)
+			{
+				return NULL;
+			}
+
+			count = (size_t)length;
+
+			block_size = count * value_type_id_size((type_id)element_tag);
+
+			if (*remaining < block_size)
+			{
+				return NULL;
+			}
+
+			v = value_create_typed_array(*cursor, count, (type_id)element_tag);
+
+			*cursor += block_size;
+			*remaining -= block_size;
+
+			return v;
+		}
+
+		case TYPE_NULL: {
+			return value_create_null();
+		}
+
+		default: {
+			return NULL;
+		}
+	}
+}
+
+value binary_serial_impl_deserialize(serial_impl_handle handle, const char *buffer, size_t size)
+{
+	const char *cursor;
+
+	size_t remaining;
+
+	value v;
+
+	if (handle == NULL || buffer == NULL || size == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Deserialization called with wrong arguments in Binary Format implementation");
+
+		return NULL;
+	}
+
+	cursor = buffer;
+
+	remaining = size;
+
+	v = binary_serial_impl_read_value(&cursor, &remaining);
+
+	if (v == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Deserialization invalid or truncated buffer in Binary Format implementation");
+
+		return NULL;
+	}
+
+	return v;
+}
+
+int binary_serial_impl_destroy(serial_impl_handle handle)
+{
+	(void)handle;
+
+	return 0;
+}
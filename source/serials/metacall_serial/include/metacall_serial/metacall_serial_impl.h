@@ -60,6 +60,25 @@ METACALL_SERIAL_API serial_impl_handle metacall_serial_impl_initialize(memory_al
 */
 METACALL_SERIAL_API char *metacall_serial_impl_serialize(serial_impl_handle handle, value v, size_t *size);
 
+/**
+*  @brief
+*    Serialize with MetaCall Native Format implementation @handle
+*    into the caller owned buffer @buffer, reusing its capacity
+*
+*  @param[in] handle
+*    Reference to the serial implementation
+*
+*  @param[in] v
+*    Reference to the value is going to be serialized
+*
+*  @param[in] buffer
+*    Reference to the reusable serialization buffer
+*
+*  @return
+*    Zero on correct serialization, different from zero otherwise
+*/
+METACALL_SERIAL_API int metacall_serial_impl_serialize_into(serial_impl_handle handle, value v, serial_buffer buffer);
+
 /**
 *  @brief
 *    Deserialize with MetaCall Native Format document implementation @handle
@@ -21,6 +21,7 @@ serial_interface metacall_serial_impl_interface_singleton()
 		&metacall_serial_impl_extension,
 		&metacall_serial_impl_initialize,
 		&metacall_serial_impl_serialize,
+		&metacall_serial_impl_serialize_into,
 		&metacall_serial_impl_deserialize,
 		&metacall_serial_impl_destroy
 	};
@@ -104,6 +104,55 @@ char *metacall_serial_impl_serialize(serial_impl_handle handle, value v, size_t
 	return buffer;
 }
 
+int metacall_serial_impl_serialize_into(serial_impl_handle handle, value v, serial_buffer buffer)
+{
+	size_t length, buffer_size;
+
+	if (handle == NULL || v == NULL || buffer == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization called with wrong arguments in MetaCall Native Format implementation");
+
+		return 1;
+	}
+
+	metacall_serial_impl_serialize_value(v, NULL, 0, &length);
+
+	if (length == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization invalid length calculation in MetaCall Native Format implementation");
+
+		return 1;
+	}
+
+	buffer_size = length + 1;
+
+	/* The capacity retained from previous serializations is reused,
+	the contents are written in place without intermediate copies */
+	if (serial_buffer_reserve(buffer, buffer_size) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization invalid buffer reservation in MetaCall Native Format implementation");
+
+		return 1;
+	}
+
+	serial_buffer_clear(buffer);
+
+	metacall_serial_impl_serialize_value(v, buffer->data, buffer_size, &length);
+
+	if (length + 1 != buffer_size)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization invalid length + 1 != buffer "
+											   "(%" PRIuS " != %" PRIuS ") in MetaCall Native Format implementation",
+			length + 1, buffer_size);
+
+		return 1;
+	}
+
+	buffer->size = buffer_size;
+
+	return 0;
+}
+
 value metacall_serial_impl_deserialize_value(const char *buffer, size_t size)
 {
 	value v = NULL;
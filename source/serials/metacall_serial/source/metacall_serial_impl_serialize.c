@@ -24,6 +24,7 @@
 
 #include <portability/portability_assert.h>
 
+#include <format/format_number.h>
 #include <format/format_print.h>
 
 #include <log/log.h>
@@ -74,6 +75,10 @@ static void metacall_serial_impl_serialize_class(value v, char *dest, size_t siz
 
 static void metacall_serial_impl_serialize_object(value v, char *dest, size_t size, const char *format, size_t *length);
 
+static void metacall_serial_impl_serialize_typed_array(value v, char *dest, size_t size, const char *format, size_t *length);
+
+static void metacall_serial_impl_serialize_stream(value v, char *dest, size_t size, const char *format, size_t *length);
+
 /* -- Definitions -- */
 
 static const char *metacall_serialize_format[] = {
@@ -93,7 +98,9 @@ static const char *metacall_serialize_format[] = {
 	NULL, /* TODO: Function */
 	"%s",
 	NULL, /* TODO: Class */
-	NULL  /* TODO: Object */
+	NULL, /* TODO: Object */
+	NULL, /* Typed Array */
+	NULL  /* Stream */
 };
 
 static_assert((size_t)TYPE_SIZE == (size_t)sizeof(metacall_serialize_format) / sizeof(metacall_serialize_format[0]),
@@ -116,7 +123,9 @@ static metacall_serialize_impl_ptr serialize_func[] = {
 	&metacall_serial_impl_serialize_function,
 	&metacall_serial_impl_serialize_null,
 	&metacall_serial_impl_serialize_class,
-	&metacall_serial_impl_serialize_object
+	&metacall_serial_impl_serialize_object,
+	&metacall_serial_impl_serialize_typed_array,
+	&metacall_serial_impl_serialize_stream
 };
 
 static_assert((size_t)TYPE_SIZE == (size_t)sizeof(serialize_func) / sizeof(serialize_func[0]),
@@ -155,27 +164,48 @@ void metacall_serial_impl_serialize_char(value v, char *dest, size_t size, const
 
 void metacall_serial_impl_serialize_short(value v, char *dest, size_t size, const char *format, size_t *length)
 {
-	*length = snprintf(dest, size, format, value_to_short(v));
+	(void)format;
+
+	*length = format_number_ltoa((long)value_to_short(v), dest, size);
 }
 
 void metacall_serial_impl_serialize_int(value v, char *dest, size_t size, const char *format, size_t *length)
 {
-	*length = snprintf(dest, size, format, value_to_int(v));
+	(void)format;
+
+	*length = format_number_ltoa((long)value_to_int(v), dest, size);
 }
 
 void metacall_serial_impl_serialize_long(value v, char *dest, size_t size, const char *format, size_t *length)
 {
-	*length = snprintf(dest, size, format, value_to_long(v));
+	(void)format;
+
+	*length = format_number_ltoa(value_to_long(v), dest, size);
 }
 
 void metacall_serial_impl_serialize_float(value v, char *dest, size_t size, const char *format, size_t *length)
 {
-	*length = snprintf(dest, size, format, value_to_float(v));
+	/* Same promotion as the variadic snprintf call, the fast emitter
+	keeps the "%.6f" notation and the format appends the float suffix */
+	size_t number_length = format_number_dtoa((double)value_to_float(v), dest, size > 0 ? size - 1 : 0);
+
+	(void)format;
+
+	if (dest != NULL && size > number_length + 1)
+	{
+		dest[number_length] = 'f';
+
+		dest[number_length + 1] = '\0';
+	}
+
+	*length = number_length + 1;
 }
 
 void metacall_serial_impl_serialize_double(value v, char *dest, size_t size, const char *format, size_t *length)
 {
-	*length = snprintf(dest, size, format, value_to_double(v));
+	(void)format;
+
+	*length = format_number_dtoa(value_to_double(v), dest, size);
 }
 
 void metacall_serial_impl_serialize_string(value v, char *dest, size_t size, const char *format, size_t *length)
@@ -313,6 +343,18 @@ void metacall_serial_impl_serialize_future(value v, char *dest, size_t size, con
 	*length = 0;
 }
 
+void metacall_serial_impl_serialize_stream(value v, char *dest, size_t size, const char *format, size_t *length)
+{
+	/* Streams are lazy handles into a live runtime, they cannot be
+	serialized without draining them first */
+	(void)v;
+	(void)dest;
+	(void)size;
+	(void)format;
+
+	*length = 0;
+}
+
 void metacall_serial_impl_serialize_function(value v, char *dest, size_t size, const char *format, size_t *length)
 {
 	/* TODO: Implement function serialization */
@@ -353,4 +395,36 @@ void metacall_serial_impl_serialize_object(value v, char *dest, size_t size, con
 	(void)format;
 
 	*length = 0;
-}
\ No newline at end of file
+}
+void metacall_serial_impl_serialize_typed_array(value v, char *dest, size_t size, const char *format, size_t *length)
+{
+	/* Materialize a boxed copy, the cast consumes its input and the
+	serializer does not own @v */
+	value copy = value_type_copy(v);
+
+	value array_value;
+
+	(void)format;
+
+	if (copy == NULL)
+	{
+		*length = 0;
+
+		return;
+	}
+
+	array_value = value_type_cast(copy, TYPE_ARRAY);
+
+	if (array_value == NULL)
+	{
+		value_type_destroy(copy);
+
+		*length = 0;
+
+		return;
+	}
+
+	metacall_serial_impl_serialize_array(array_value, dest, size, metacall_serial_impl_serialize_format(TYPE_ARRAY), length);
+
+	value_type_destroy(array_value);
+}
@@ -72,6 +72,26 @@ RAPID_JSON_SERIAL_API serial_impl_handle rapid_json_serial_impl_initialize(memor
 */
 RAPID_JSON_SERIAL_API char *rapid_json_serial_impl_serialize(serial_impl_handle handle, value v, size_t *size);
 
+/**
+*  @brief
+*    Serialize with RapidJSON document implementation @handle into
+*    the caller owned buffer @buffer, the writer emits directly over
+*    the buffer so its capacity is reused across calls
+*
+*  @param[in] handle
+*    Reference to the serial implementation
+*
+*  @param[in] v
+*    Reference to the value is going to be serialized
+*
+*  @param[in] buffer
+*    Reference to the reusable serialization buffer
+*
+*  @return
+*    Zero on correct serialization, different from zero otherwise
+*/
+RAPID_JSON_SERIAL_API int rapid_json_serial_impl_serialize_into(serial_impl_handle handle, value v, serial_buffer buffer);
+
 /**
 *  @brief
 *    Deserialize with RapidJSON document implementation @handle
@@ -21,6 +21,7 @@ serial_interface rapid_json_serial_impl_interface_singleton()
 		&rapid_json_serial_impl_extension,
 		&rapid_json_serial_impl_initialize,
 		&rapid_json_serial_impl_serialize,
+		&rapid_json_serial_impl_serialize_into,
 		&rapid_json_serial_impl_deserialize,
 		&rapid_json_serial_impl_destroy
 	};
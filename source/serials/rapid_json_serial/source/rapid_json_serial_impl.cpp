@@ -14,10 +14,14 @@
 
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <limits>
 #include <sstream>
+#include <vector>
 
 /* -- Type Definitions -- */
 
@@ -34,8 +38,6 @@ static void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *js
 
 static char *rapid_json_serial_impl_document_stringify(rapid_json_document document, size_t *size);
 
-static value rapid_json_serial_impl_deserialize_value(const rapidjson::Value *v);
-
 /* -- Classes -- */
 
 // https://techoverflow.net/2020/01/13/how-to-fix-rapidjson-segmentation-faults-when-building-nested-documents/
@@ -211,6 +213,30 @@ void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
 			json_map.AddMember(json_member, json_inner_value, rapid_json_allocator);
 		}
 	}
+	else if (id == TYPE_TYPED_ARRAY)
+	{
+		/* Materialize a boxed copy, the cast consumes its input and
+		the serializer does not own @v */
+		value copy = value_type_copy(v);
+
+		value array_value = (copy != NULL) ? value_type_cast(copy, TYPE_ARRAY) : NULL;
+
+		if (array_value == NULL)
+		{
+			if (copy != NULL)
+			{
+				value_type_destroy(copy);
+			}
+
+			json_v->SetNull();
+
+			return;
+		}
+
+		rapid_json_serial_impl_serialize_value(array_value, json_v);
+
+		value_type_destroy(array_value);
+	}
 	else if (id == TYPE_FUTURE)
 	{
 		/* TODO: Improve future serialization */
@@ -233,6 +259,18 @@ void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
 
 		json_v->SetString(str, length);
 	}
+	else if (id == TYPE_STREAM)
+	{
+		/* Streams are lazy handles into a live runtime, they cannot
+		be serialized without draining them first */
+		static const char str[] = "[Stream]";
+
+		size_t size = sizeof(str);
+
+		rapidjson::SizeType length = size > 0 ? (rapidjson::SizeType)(size - 1) : 0;
+
+		json_v->SetString(str, length);
+	}
 	else if (id == TYPE_CLASS)
 	{
 		/* TODO: Improve class serialization */
@@ -295,6 +333,67 @@ char *rapid_json_serial_impl_document_stringify(rapid_json_document document, si
 	return buffer_str;
 }
 
+/* Output stream emitting directly into a serial_buffer, so the
+writer appends in place and the buffer capacity is reused */
+class rapid_json_serial_buffer_stream
+{
+public:
+	typedef char Ch;
+
+	rapid_json_serial_buffer_stream(serial_buffer buffer) :
+		buffer(buffer) {}
+
+	void Put(char c)
+	{
+		serial_buffer_write(buffer, &c, 1);
+	}
+
+	void Flush() {}
+
+private:
+	serial_buffer buffer;
+};
+
+int rapid_json_serial_impl_serialize_into(serial_impl_handle handle, value v, serial_buffer buffer)
+{
+	rapid_json_document document = static_cast<rapid_json_document>(handle);
+
+	if (handle == NULL || v == NULL || buffer == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization called with wrong arguments in RapidJSON implementation");
+
+		return 1;
+	}
+
+	rapid_json_serial_impl_serialize_value(v, &document->impl);
+
+	serial_buffer_clear(buffer);
+
+	{
+		rapid_json_serial_buffer_stream stream(buffer);
+		rapidjson::Writer<rapid_json_serial_buffer_stream> writer(stream);
+
+		if (document->impl.Accept(writer) == false)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid document write in RapidJSON implementation");
+
+			return 1;
+		}
+	}
+
+	/* Keep the contents null terminated like the allocating path */
+	{
+		const char terminator = '\0';
+
+		if (serial_buffer_write(buffer, &terminator, 1) != 0)
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
 char *rapid_json_serial_impl_serialize(serial_impl_handle handle, value v, size_t *size)
 {
 	rapid_json_document document = static_cast<rapid_json_document>(handle);
@@ -311,164 +410,238 @@ char *rapid_json_serial_impl_serialize(serial_impl_handle handle, value v, size_
 	return rapid_json_serial_impl_document_stringify(document, size);
 }
 
-value rapid_json_serial_impl_deserialize_value(const rapidjson::Value *v)
+/* SAX handler building reflect values directly from parse events,
+the rapidjson DOM is never materialized so a payload holds a single
+tree in memory while it is being deserialized */
+class rapid_json_serial_value_handler
 {
-	if (v->IsNull())
+public:
+	rapid_json_serial_value_handler() :
+		root(NULL) {}
+
+	bool Null()
 	{
-		return value_create_null();
+		return Consume(value_create_null());
 	}
-	else if (v->IsBool() == true)
+
+	bool Bool(bool b)
 	{
-		return value_create_bool(v->GetBool() == true ? 1L : 0L);
+		return Consume(value_create_bool(b == true ? 1L : 0L));
 	}
-	/*else if (v->IsString() == true && v->GetStringLength() == 1)
+
+	bool Int(int i)
 	{
-		const char * str = v->GetString();
+		return Consume(value_create_int(i));
+	}
 
-		return value_create_char(str[0]);
-	}*/
-	else if (v->IsInt() == true)
+	bool Uint(unsigned int ui)
 	{
-		int i = v->GetInt();
+		log_write("metacall", LOG_LEVEL_WARNING, "Casting unsigned integer to integer (posible overflow) in RapidJSON implementation");
 
-		return value_create_int(i);
+		return Consume(value_create_int((int)ui));
 	}
-	else if (v->IsUint() == true)
+
+	bool Int64(int64_t i)
 	{
-		unsigned int ui = v->GetUint();
+		return Consume(value_create_long((long)i));
+	}
 
-		log_write("metacall", LOG_LEVEL_WARNING, "Casting unsigned integer to integer (posible overflow) in RapidJSON implementation");
+	bool Uint64(uint64_t ui)
+	{
+		log_write("metacall", LOG_LEVEL_WARNING, "Casting unsigned long to int (posible overflow) in RapidJSON implementation");
 
-		return value_create_int((int)ui);
+		return Consume(value_create_long((long)ui));
 	}
-	else if (v->IsInt64() == true)
+
+	bool Double(double d)
 	{
-		int64_t i = v->GetInt64();
+		/* Mirror the lossless float detection of the DOM based walker */
+		if (d >= static_cast<double>(-std::numeric_limits<float>::max()) && d <= static_cast<double>(std::numeric_limits<float>::max()))
+		{
+			float f = static_cast<float>(d);
+
+			if (static_cast<double>(f) == d)
+			{
+				return Consume(value_create_float(f));
+			}
+		}
 
-		return value_create_long((long)i);
+		return Consume(value_create_double(d));
 	}
-	else if (v->IsUint64() == true)
-	{
-		uint64_t ui = v->GetUint64();
 
-		log_write("metacall", LOG_LEVEL_WARNING, "Casting unsigned long to int (posible overflow) in RapidJSON implementation");
+	bool RawNumber(const char *str, rapidjson::SizeType length, bool copy)
+	{
+		(void)str;
+		(void)length;
+		(void)copy;
 
-		return value_create_long((long)ui);
+		return false;
 	}
-	else if (v->IsFloat() == true || v->IsLosslessFloat() == true)
+
+	bool String(const char *str, rapidjson::SizeType length, bool copy)
 	{
-		float f = v->GetFloat();
+		(void)copy;
 
-		return value_create_float(f);
+		return Consume(value_create_string(str, (size_t)length));
 	}
-	else if (v->IsDouble() == true || v->IsLosslessDouble() == true)
+
+	bool StartObject()
 	{
-		double d = v->GetDouble();
+		frames.push_back(frame(true));
 
-		return value_create_double((double)d);
+		return true;
 	}
-	else if (v->IsString() == true /*&& v->GetStringLength() > 1*/)
+
+	bool Key(const char *str, rapidjson::SizeType length, bool copy)
 	{
-		rapidjson::SizeType length = v->GetStringLength();
+		value v = value_create_string(str, (size_t)length);
+
+		(void)copy;
+
+		if (v == NULL)
+		{
+			return false;
+		}
 
-		const char *str = v->GetString();
+		frames.back().key = v;
 
-		return value_create_string(str, (size_t)length);
+		return true;
 	}
-	else if (v->IsArray() == true)
+
+	bool EndObject(rapidjson::SizeType member_count)
 	{
-		rapidjson::SizeType size = v->Size();
+		(void)member_count;
 
-		value v_array = value_create_array(NULL, size);
+		return End();
+	}
 
-		value *values;
+	bool StartArray()
+	{
+		frames.push_back(frame(false));
 
-		size_t index = 0;
+		return true;
+	}
 
-		if (size == 0 || v_array == NULL)
-		{
-			return v_array;
-		}
+	bool EndArray(rapidjson::SizeType element_count)
+	{
+		(void)element_count;
 
-		values = static_cast<value *>(value_to_array(v_array));
+		return End();
+	}
 
-		for (rapidjson::Value::ConstValueIterator it = v->Begin(); it != v->End(); ++it)
-		{
-			values[index] = rapid_json_serial_impl_deserialize_value(it);
+	value Root()
+	{
+		return root;
+	}
 
-			if (values[index] == NULL)
-			{
-				for (size_t iterator = 0; iterator < index; ++iterator)
-				{
-					value_type_destroy(values[iterator]);
-				}
+	/* Release the partially built tree after a parse or handler error */
+	void Cleanup()
+	{
+		if (root != NULL)
+		{
+			value_type_destroy(root);
 
-				value_destroy(v_array);
+			root = NULL;
+		}
 
-				return NULL;
+		for (size_t iterator = 0; iterator < frames.size(); ++iterator)
+		{
+			if (frames[iterator].key != NULL)
+			{
+				value_type_destroy(frames[iterator].key);
 			}
 
-			++index;
+			for (size_t element = 0; element < frames[iterator].elements.size(); ++element)
+			{
+				value_type_destroy(frames[iterator].elements[element]);
+			}
 		}
 
-		return v_array;
+		frames.clear();
 	}
-	else if (v->IsObject() == true)
-	{
-		const rapidjson::SizeType size = v->MemberCount();
 
-		value v_map = value_create_map(NULL, size);
+private:
+	struct frame
+	{
+		frame(bool is_map) :
+			is_map(is_map), key(NULL) {}
 
-		value *tuples;
+		bool is_map;
+		value key;
+		std::vector<value> elements;
+	};
 
-		size_t index = 0;
+	/* Attach a completed value to the enclosing container, taking
+	ownership of @v in every outcome */
+	bool Consume(value v)
+	{
+		if (v == NULL)
+		{
+			return false;
+		}
 
-		if (size == 0 || v_map == NULL)
+		if (frames.empty() == true)
 		{
-			return v_map;
+			root = v;
+
+			return true;
 		}
 
-		tuples = static_cast<value *>(value_to_map(v_map));
+		frame &top = frames.back();
 
-		for (rapidjson::Value::ConstMemberIterator it = v->MemberBegin(); it != v->MemberEnd(); ++it)
+		if (top.is_map == true)
 		{
-			const value tupla[] = {
-				rapid_json_serial_impl_deserialize_value(&it->name),
-				rapid_json_serial_impl_deserialize_value(&it->value)
-			};
+			const value tupla[] = { top.key, v };
 
-			if (tupla[0] == NULL || tupla[1] == NULL)
-			{
-				if (tupla[0] != NULL)
-				{
-					value_type_destroy(tupla[0]);
-				}
+			value t = value_create_array(tupla, sizeof(tupla) / sizeof(tupla[0]));
 
-				if (tupla[1] != NULL)
-				{
-					value_type_destroy(tupla[1]);
-				}
+			top.key = NULL;
 
-				value_type_destroy(v_map);
+			if (t == NULL)
+			{
+				value_type_destroy(tupla[0]);
+				value_type_destroy(tupla[1]);
 
-				return NULL;
+				return false;
 			}
 
-			tuples[index++] = value_create_array(tupla, sizeof(tupla) / sizeof(tupla[0]));
+			top.elements.push_back(t);
+		}
+		else
+		{
+			top.elements.push_back(v);
 		}
 
-		return v_map;
+		return true;
 	}
 
-	log_write("metacall", LOG_LEVEL_ERROR, "Unsuported value type in RapidJSON implementation");
+	/* Close the innermost container and hand it to its parent */
+	bool End()
+	{
+		frame &top = frames.back();
+
+		size_t size = top.elements.size();
 
-	return NULL;
-}
+		const value *elements = (size == 0) ? NULL : &top.elements[0];
+
+		value v = (top.is_map == true) ? value_create_map(elements, size) : value_create_array(elements, size);
+
+		if (v == NULL)
+		{
+			return false;
+		}
+
+		frames.pop_back();
+
+		return Consume(v);
+	}
+
+	value root;
+	std::vector<frame> frames;
+};
 
 value rapid_json_serial_impl_deserialize(serial_impl_handle handle, const char *buffer, size_t size)
 {
-	rapid_json_document document = static_cast<rapid_json_document>(handle);
-
 	if (handle == NULL || buffer == NULL || size == 0)
 	{
 		log_write("metacall", LOG_LEVEL_ERROR, "Deserialization called with wrong arguments in RapidJSON implementation");
@@ -476,7 +649,13 @@ value rapid_json_serial_impl_deserialize(serial_impl_handle handle, const char *
 		return NULL;
 	}
 
-	rapidjson::ParseResult parse_result = document->impl.Parse(buffer, size - 1);
+	rapidjson::Reader reader;
+
+	rapidjson::MemoryStream stream(buffer, size - 1);
+
+	rapid_json_serial_value_handler value_handler;
+
+	rapidjson::ParseResult parse_result = reader.Parse(stream, value_handler);
 
 	if (parse_result.IsError() == true)
 	{
@@ -485,10 +664,12 @@ value rapid_json_serial_impl_deserialize(serial_impl_handle handle, const char *
 		log_write("metacall", LOG_LEVEL_ERROR, "Invalid parsing of document (%s) in RapidJSON implementation: %s at %" PRIuS,
 			buffer, error_message, parse_result.Offset());
 
+		value_handler.Cleanup();
+
 		return NULL;
 	}
 
-	return rapid_json_serial_impl_deserialize_value(&document->impl);
+	return value_handler.Root();
 }
 
 int rapid_json_serial_impl_destroy(serial_impl_handle handle)
@@ -138,3 +138,112 @@ TEST_F(adt_set_test, DefaultConstructor)
 
 	set_destroy(s);
 }
+
+TEST_F(adt_set_test, ReserveBulkInsertCompact)
+{
+	static key_str key_array[] = {
+		"bulk00", "bulk01", "bulk02", "bulk03",
+		"bulk04", "bulk05", "bulk06", "bulk07",
+		"bulk08", "bulk09", "bulk10", "bulk11",
+		"bulk12", "bulk13", "bulk14", "bulk15"
+	};
+
+	static int value_array[] = {
+		10, 11, 12, 13, 14, 15, 16, 17,
+		18, 19, 20, 21, 22, 23, 24, 25
+	};
+
+	static const size_t key_array_size = sizeof(key_array) / sizeof(key_array[0]);
+
+	set s = set_create_reserve(&hash_callback_str, &comparable_callback_str, key_array_size);
+
+	set_key keys[key_array_size];
+	set_value values[key_array_size];
+
+	EXPECT_NE((set)NULL, (set)s);
+
+	for (size_t i = 0; i < key_array_size; ++i)
+	{
+		keys[i] = key_array[i];
+		values[i] = &value_array[i];
+	}
+
+	EXPECT_EQ((int)0, (int)set_insert_array(s, keys, values, key_array_size));
+
+	EXPECT_EQ((size_t)key_array_size, (size_t)set_size(s));
+
+	/* Duplicate bulk insert overwrites instead of growing */
+	EXPECT_EQ((int)0, (int)set_insert_array(s, keys, values, key_array_size));
+
+	EXPECT_EQ((size_t)key_array_size, (size_t)set_size(s));
+
+	EXPECT_EQ((int)0, (int)set_compact(s));
+
+	for (size_t i = 0; i < key_array_size; ++i)
+	{
+		int *value = (int *)set_get(s, key_array[i]);
+
+		EXPECT_NE((int *)NULL, (int *)value);
+
+		EXPECT_EQ((int)value_array[i], (int)*value);
+	}
+
+	set_destroy(s);
+}
+
+TEST_F(adt_set_test, IncrementalRehash)
+{
+	/* Enough keys to cross the growth ratio several times, so lookups
+	and removals run while the old bucket array is still draining */
+	static const size_t key_count = 2000;
+
+	static char key_array[key_count][0x10];
+
+	static int value_array[key_count];
+
+	set s = set_create(&hash_callback_str, &comparable_callback_str);
+
+	EXPECT_NE((set)NULL, (set)s);
+
+	for (size_t i = 0; i < key_count; ++i)
+	{
+		snprintf(key_array[i], sizeof(key_array[i]), "rehash%04zu", i);
+
+		value_array[i] = (int)i;
+
+		EXPECT_EQ((int)0, (int)set_insert(s, key_array[i], &value_array[i]));
+
+		/* Probe a key inserted earlier, it may still live in the old array */
+		int *value = (int *)set_get(s, key_array[i / 2]);
+
+		EXPECT_NE((int *)NULL, (int *)value);
+
+		EXPECT_EQ((int)(i / 2), (int)*value);
+	}
+
+	EXPECT_EQ((size_t)key_count, (size_t)set_size(s));
+
+	for (size_t i = 0; i < key_count; i += 2)
+	{
+		int *removed = (int *)set_remove(s, key_array[i]);
+
+		EXPECT_NE((int *)NULL, (int *)removed);
+
+		EXPECT_EQ((int)i, (int)*removed);
+
+		EXPECT_NE((int)0, (int)set_contains(s, key_array[i]));
+	}
+
+	EXPECT_EQ((size_t)(key_count / 2), (size_t)set_size(s));
+
+	for (size_t i = 1; i < key_count; i += 2)
+	{
+		int *value = (int *)set_get(s, key_array[i]);
+
+		EXPECT_NE((int *)NULL, (int *)value);
+
+		EXPECT_EQ((int)i, (int)*value);
+	}
+
+	set_destroy(s);
+}
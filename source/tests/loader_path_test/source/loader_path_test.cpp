@@ -628,3 +628,49 @@ TEST_F(loader_path_test, loader_path_test_canonical_absolute_end_many_dot)
 	EXPECT_EQ((size_t)size, (size_t)sizeof(result));
 	EXPECT_EQ((char)'\0', (char)result[size - 1]);
 }
+
+TEST_F(loader_path_test, loader_path_test_join_buffer)
+{
+	const char left[] = "/a/b/c";
+	const char right[] = "e/f/g";
+	const char result[] = "/a/b/c/e/f/g";
+
+	char join[sizeof(result)];
+
+	size_t size = loader_path_join_buffer(left, sizeof(left), right, sizeof(right), join, sizeof(join));
+
+	EXPECT_EQ((int)0, (int)strcmp(join, result));
+	EXPECT_EQ((size_t)size, (size_t)sizeof(result));
+	EXPECT_EQ((char)'\0', (char)result[size - 1]);
+}
+
+TEST_F(loader_path_test, loader_path_test_join_buffer_overflow)
+{
+	const char left[] = "/a/b/c";
+	const char right[] = "e/f/g";
+
+	char join[sizeof(left)];
+
+	size_t size = loader_path_join_buffer(left, sizeof(left), right, sizeof(right), join, sizeof(join));
+
+	EXPECT_EQ((size_t)size, (size_t)0);
+}
+
+TEST_F(loader_path_test, loader_path_test_canonical_cached)
+{
+	const char path[] = "/a/b/c/./d/../e";
+	const char result[] = "/a/b/c/e";
+
+	loader_naming_path canonical, cached;
+
+	/* The first call computes and memoizes, the second one hits the cache */
+	size_t size = loader_path_canonical_cached(path, sizeof(path), canonical);
+	size_t cached_size = loader_path_canonical_cached(path, sizeof(path), cached);
+
+	EXPECT_EQ((int)0, (int)strcmp(canonical, result));
+	EXPECT_EQ((int)0, (int)strcmp(cached, canonical));
+	EXPECT_EQ((size_t)size, (size_t)cached_size);
+	EXPECT_EQ((size_t)size, (size_t)sizeof(result));
+
+	loader_path_cache_clear();
+}
@@ -0,0 +1,269 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_loaders.h>
+#include <metacall/metacall_value.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+/* Allocation budget regression tests: representative scenarios run
+under an interposed allocator that counts every allocation and the
+bytes it requested, and each scenario asserts a per operation budget.
+The budgets are deliberately generous upper bounds, they are not meant
+to be tight, only to fail loudly when a change adds an order of
+magnitude of allocations to a path that used to be lean */
+
+/* Interposition relies on the executable overriding the libc malloc
+family for the whole process, which glibc supports through the
+__libc_* entry points; on other platforms the scenarios still run but
+the budgets are not enforced */
+#if defined(__linux__) && defined(__GLIBC__)
+	#define METACALL_ALLOCATION_BUDGET_INTERPOSE 1
+#endif
+
+#if defined(METACALL_ALLOCATION_BUDGET_INTERPOSE)
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t num, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void __libc_free(void *ptr);
+
+/* The tests are single threaded, plain counters are enough */
+static int allocation_tracking = 0;
+static size_t allocation_count = 0;
+static size_t allocation_bytes = 0;
+
+extern "C" void *malloc(size_t size)
+{
+	if (allocation_tracking != 0)
+	{
+		++allocation_count;
+		allocation_bytes += size;
+	}
+
+	return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t num, size_t size)
+{
+	if (allocation_tracking != 0)
+	{
+		++allocation_count;
+		allocation_bytes += num * size;
+	}
+
+	return __libc_calloc(num, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+	if (allocation_tracking != 0)
+	{
+		++allocation_count;
+		allocation_bytes += size;
+	}
+
+	return __libc_realloc(ptr, size);
+}
+
+extern "C" void free(void *ptr)
+{
+	__libc_free(ptr);
+}
+
+	#if defined(_WIN32)
+		#define PRIuS "Iu"
+	#else
+		#define PRIuS "zu"
+	#endif
+
+#endif /* METACALL_ALLOCATION_BUDGET_INTERPOSE */
+
+/* The scenarios are mock loader driven, without it the helpers have no
+callers and would warn as unused */
+#if defined(OPTION_BUILD_LOADERS_MOCK)
+
+static void allocation_budget_begin(void)
+{
+#if defined(METACALL_ALLOCATION_BUDGET_INTERPOSE)
+	allocation_count = 0;
+	allocation_bytes = 0;
+	allocation_tracking = 1;
+#endif
+}
+
+static void allocation_budget_end(const char *scenario, size_t iterations, size_t count_budget, size_t bytes_budget)
+{
+#if defined(METACALL_ALLOCATION_BUDGET_INTERPOSE)
+	allocation_tracking = 0;
+
+	printf("%s: %" PRIuS " allocations, %" PRIuS " bytes over %" PRIuS " iterations\n",
+		scenario, allocation_count, allocation_bytes, iterations);
+
+	EXPECT_LE((size_t)allocation_count, (size_t)(iterations * count_budget)) << scenario << " exceeded its allocation count budget";
+
+	EXPECT_LE((size_t)allocation_bytes, (size_t)(iterations * bytes_budget)) << scenario << " exceeded its allocation bytes budget";
+#else
+	(void)scenario;
+	(void)iterations;
+	(void)count_budget;
+	(void)bytes_budget;
+#endif
+}
+
+#endif /* OPTION_BUILD_LOADERS_MOCK */
+
+class metacall_allocation_budget_test : public testing::Test
+{
+public:
+};
+
+TEST_F(metacall_allocation_budget_test, DefaultConstructor)
+{
+	metacall_print_info();
+
+	ASSERT_EQ((int)0, (int)metacall_initialize());
+
+/* Mock */
+#if defined(OPTION_BUILD_LOADERS_MOCK)
+	{
+		static const size_t iterations = 64;
+
+		const char *mock_scripts[] = {
+			"empty.mock"
+		};
+
+		ASSERT_EQ((int)0, (int)metacall_load_from_file("mock", mock_scripts, sizeof(mock_scripts) / sizeof(mock_scripts[0]), NULL));
+
+		/* Scalar call: two doubles in, one double out */
+		{
+			void *ret = metacall("two_doubles", 3.0, 4.0);
+
+			ASSERT_NE((void *)NULL, (void *)ret);
+
+			metacall_value_destroy(ret);
+
+			allocation_budget_begin();
+
+			for (size_t iterator = 0; iterator < iterations; ++iterator)
+			{
+				ret = metacall("two_doubles", 3.0, 4.0);
+
+				metacall_value_destroy(ret);
+			}
+
+			allocation_budget_end("scalar call", iterations, 32, 0x1000);
+		}
+
+		/* String call: the return value carries a string copy */
+		{
+			void *ret = metacall("bench_string");
+
+			ASSERT_NE((void *)NULL, (void *)ret);
+
+			metacall_value_destroy(ret);
+
+			allocation_budget_begin();
+
+			for (size_t iterator = 0; iterator < iterations; ++iterator)
+			{
+				ret = metacall("bench_string");
+
+				metacall_value_destroy(ret);
+			}
+
+			allocation_budget_end("string call", iterations, 48, 0x10000);
+		}
+
+		/* Map call: the return value is a copied map of scalars */
+		{
+			void *ret = metacall("bench_map");
+
+			ASSERT_NE((void *)NULL, (void *)ret);
+
+			metacall_value_destroy(ret);
+
+			allocation_budget_begin();
+
+			for (size_t iterator = 0; iterator < iterations; ++iterator)
+			{
+				ret = metacall("bench_map");
+
+				metacall_value_destroy(ret);
+			}
+
+			allocation_budget_end("map call", iterations, 0x100, 0x10000);
+		}
+
+		/* Inspect: serializes the whole context */
+		{
+			static const size_t inspect_iterations = 8;
+
+			struct metacall_allocator_std_type std_ctx = { &std::malloc, &std::realloc, &std::free };
+
+			void *allocator = metacall_allocator_create(METACALL_ALLOCATOR_STD, (void *)&std_ctx);
+
+			size_t size = 0;
+
+			char *inspect_str = metacall_inspect(&size, allocator);
+
+			ASSERT_NE((char *)NULL, (char *)inspect_str);
+
+			metacall_allocator_free(allocator, inspect_str);
+
+			allocation_budget_begin();
+
+			for (size_t iterator = 0; iterator < inspect_iterations; ++iterator)
+			{
+				inspect_str = metacall_inspect(&size, allocator);
+
+				metacall_allocator_free(allocator, inspect_str);
+			}
+
+			allocation_budget_end("inspect", inspect_iterations, 0x1000, 0x100000);
+
+			metacall_allocator_destroy(allocator);
+		}
+
+		/* Load: each iteration loads one more mock module */
+		{
+			static const size_t load_iterations = 8;
+
+			static const char buffer[] =
+				"#!/usr/bin/env mock\n";
+
+			allocation_budget_begin();
+
+			for (size_t iterator = 0; iterator < load_iterations; ++iterator)
+			{
+				EXPECT_EQ((int)0, (int)metacall_load_from_memory("mock", buffer, sizeof(buffer), NULL));
+			}
+
+			allocation_budget_end("load", load_iterations, 0x400, 0x40000);
+		}
+	}
+#endif /* OPTION_BUILD_LOADERS_MOCK */
+
+	EXPECT_EQ((int)0, (int)metacall_destroy());
+}
@@ -154,7 +154,14 @@ object_interface hello_world_object_impl_interface_singleton()
 			&hello_world_object_impl_interface_method_invoke,
 			&hello_world_object_impl_interface_method_await,
 			&hello_world_object_impl_interface_destructor,
-			&hello_world_object_impl_interface_destroy
+			&hello_world_object_impl_interface_destroy,
+			NULL /* attribute_resolve */,
+			NULL /* attribute_get */,
+			NULL /* attribute_set */,
+			NULL /* attribute_destroy */,
+			NULL /* method_resolve */,
+			NULL /* method_invoke_handle */,
+			NULL /* method_destroy */
 	};
 
 	return &hello_world_interface;
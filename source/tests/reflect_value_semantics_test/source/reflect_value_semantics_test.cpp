@@ -0,0 +1,230 @@
+/*
+ *	Reflect Library by Parra Studios
+ *	A library for provide reflection and metadata representation.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <reflect/reflect_value_type.h>
+#include <reflect/reflect_value_type_cast.h>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+class reflect_value_semantics_test : public testing::Test
+{
+public:
+};
+
+TEST_F(reflect_value_semantics_test, inline_scalar_round_trip)
+{
+	value v = value_create_int(7);
+
+	EXPECT_EQ((type_id)TYPE_INT, (type_id)value_type_id(v));
+	EXPECT_EQ((int)7, (int)value_to_int(v));
+
+	/* Writes to an inline value re-encode the handle, the caller
+	must always consume the returned one */
+	v = value_from_int(v, 42);
+
+	EXPECT_EQ((type_id)TYPE_INT, (type_id)value_type_id(v));
+	EXPECT_EQ((int)42, (int)value_to_int(v));
+
+	value_destroy(v);
+}
+
+TEST_F(reflect_value_semantics_test, inline_scalar_from_all_types)
+{
+	value v = value_create_bool(0L);
+
+	v = value_from_bool(v, 1L);
+	EXPECT_EQ((boolean)1L, (boolean)value_to_bool(v));
+	value_destroy(v);
+
+	v = value_create_char('a');
+	v = value_from_char(v, 'z');
+	EXPECT_EQ((char)'z', (char)value_to_char(v));
+	value_destroy(v);
+
+	v = value_create_short(3);
+	v = value_from_short(v, -9);
+	EXPECT_EQ((short)-9, (short)value_to_short(v));
+	value_destroy(v);
+
+	v = value_create_float(1.5f);
+	v = value_from_float(v, 2.25f);
+	EXPECT_EQ((float)2.25f, (float)value_to_float(v));
+	value_destroy(v);
+}
+
+TEST_F(reflect_value_semantics_test, inline_scalar_copy_and_cast)
+{
+	value v = value_create_int(1000);
+
+	value copy = value_type_copy(v);
+
+	EXPECT_EQ((int)1000, (int)value_to_int(copy));
+
+	copy = value_type_cast(copy, TYPE_LONG);
+
+	EXPECT_EQ((type_id)TYPE_LONG, (type_id)value_type_id(copy));
+	EXPECT_EQ((long)1000L, (long)value_to_long(copy));
+
+	/* The original is unaffected by casting the copy */
+	EXPECT_EQ((type_id)TYPE_INT, (type_id)value_type_id(v));
+	EXPECT_EQ((int)1000, (int)value_to_int(v));
+
+	value_destroy(copy);
+	value_destroy(v);
+}
+
+TEST_F(reflect_value_semantics_test, pool_recycling_threaded)
+{
+	static const size_t thread_count = 8;
+	static const size_t iterations = 10000;
+
+	std::vector<std::thread> threads;
+
+	for (size_t thread_id = 0; thread_id < thread_count; ++thread_id)
+	{
+		threads.emplace_back([thread_id]() {
+			for (size_t iterator = 0; iterator < iterations; ++iterator)
+			{
+				long expected = (long)(thread_id * iterations + iterator);
+
+				value v = value_create_long(expected);
+
+				value s = value_create_string("pooled chunk sized body", 23);
+
+				ASSERT_EQ((long)expected, (long)value_to_long(v));
+
+				ASSERT_EQ((int)0, (int)strcmp(value_to_string(s), "pooled chunk sized body"));
+
+				value_destroy(v);
+				value_destroy(s);
+			}
+		});
+	}
+
+	for (std::thread &thread : threads)
+	{
+		thread.join();
+	}
+}
+
+TEST_F(reflect_value_semantics_test, array_copy_then_mutate)
+{
+	value inner[2] = {
+		value_create_long(1L),
+		value_create_long(2L)
+	};
+
+	value v = value_create_array(inner, 2);
+
+	value copy = value_type_copy(v);
+
+	value *copy_data, *v_data;
+
+	/* The copy is deep, mutating it through the accessor must leave
+	the original intact */
+	ASSERT_NE((value)v, (value)copy);
+
+	copy_data = value_to_array(copy);
+
+	value_destroy(copy_data[0]);
+
+	copy_data[0] = value_create_long(99L);
+
+	v_data = value_to_array(v);
+
+	EXPECT_EQ((long)1L, (long)value_to_long(v_data[0]));
+	EXPECT_EQ((long)99L, (long)value_to_long(copy_data[0]));
+
+	value_type_destroy(copy);
+
+	EXPECT_EQ((long)1L, (long)value_to_long(v_data[0]));
+
+	value_type_destroy(v);
+}
+
+TEST_F(reflect_value_semantics_test, map_copy_then_mutate)
+{
+	value tuple[2] = {
+		value_create_string("key", 3),
+		value_create_long(5L)
+	};
+
+	value tuples[1] = {
+		value_create_array(tuple, 2)
+	};
+
+	value v = value_create_map(tuples, 1);
+
+	value copy = value_type_copy(v);
+
+	value *copy_tuple, *v_tuple;
+
+	ASSERT_NE((value)v, (value)copy);
+
+	copy_tuple = value_to_array(value_to_map(copy)[0]);
+
+	value_destroy(copy_tuple[1]);
+
+	copy_tuple[1] = value_create_long(50L);
+
+	v_tuple = value_to_array(value_to_map(v)[0]);
+
+	EXPECT_EQ((long)5L, (long)value_to_long(v_tuple[1]));
+	EXPECT_EQ((long)50L, (long)value_to_long(copy_tuple[1]));
+
+	value_type_destroy(copy);
+	value_type_destroy(v);
+}
+
+TEST_F(reflect_value_semantics_test, shared_copy_opt_in)
+{
+	value inner[1] = {
+		value_create_long(7L)
+	};
+
+	value v = value_create_array(inner, 1);
+
+	/* The shared copy is the same handle with one more reference,
+	destroying it leaves the original and its children alive */
+	value shared = value_type_copy_shared(v);
+
+	ASSERT_EQ((value)v, (value)shared);
+
+	value_type_destroy(shared);
+
+	EXPECT_EQ((long)7L, (long)value_to_long(value_to_array(v)[0]));
+
+	/* Unshare materializes a private copy once it is shared again */
+	shared = value_type_copy_shared(v);
+
+	{
+		value unshared = value_type_unshare(shared);
+
+		ASSERT_NE((value)v, (value)unshared);
+
+		value_type_destroy(unshared);
+	}
+
+	value_type_destroy(v);
+}
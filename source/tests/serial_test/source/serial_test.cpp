@@ -320,7 +320,9 @@ TEST_F(serial_test, DefaultConstructor)
 			NULL, /* TODO: Function */
 			"(null)",
 			NULL, /* TODO: Class */
-			NULL  /* TODO: Object */
+			NULL, /* TODO: Object */
+			NULL, /* TODO: Typed Array */
+			NULL  /* Stream */
 		};
 
 		static_assert((int)sizeof(value_names) / sizeof(value_names[0]) == (int)TYPE_SIZE,
@@ -399,6 +401,9 @@ TEST_F(serial_test, DefaultConstructor)
 			value_create_class(cls),
 			value_create_object(class_new(cls, NULL, NULL, 0))
 			*/
+			/* TODO: Implement typed array and stream stringification */
+			NULL,
+			NULL,
 		};
 
 		static_assert((int)sizeof(value_array) / sizeof(value_array[0]) == (int)TYPE_SIZE,
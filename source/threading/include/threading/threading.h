@@ -23,6 +23,9 @@
 
 #include <threading/threading_api.h>
 
+#include <threading/threading_atomic.h>
+#include <threading/threading_event.h>
+#include <threading/threading_mutex.h>
 #include <threading/threading_thread_id.h>
 
 #ifdef __cplusplus
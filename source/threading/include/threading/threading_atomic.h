@@ -0,0 +1,111 @@
+/*
+ *	Thrading Library by Parra Studios
+ *	A threading library providing utilities for lock-free data structures and more.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef THREADING_ATOMIC_H
+#define THREADING_ATOMIC_H 1
+
+/* -- Headers -- */
+
+#include <threading/threading_api.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Macros -- */
+
+/**
+*  @brief
+*    Atomic operations on word sized counters, used for reference
+*    counting of handles shared across threads; they map to the
+*    compiler intrinsics so no lock is ever taken
+*/
+#if defined(__GNUC__) || defined(__clang__)
+
+	#define threading_atomic_fetch_add(ptr, n)		 __atomic_fetch_add((ptr), (n), __ATOMIC_RELAXED)
+	#define threading_atomic_fetch_sub(ptr, n)		 __atomic_fetch_sub((ptr), (n), __ATOMIC_ACQ_REL)
+	#define threading_atomic_load(ptr)				 __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+	#define threading_atomic_store(ptr, n)			 __atomic_store_n((ptr), (n), __ATOMIC_RELEASE)
+
+	/* Returns non zero when the exchange succeeded, otherwise the
+	current contents are written back into @expected */
+	#define threading_atomic_compare_exchange(ptr, expected, desired) \
+		__atomic_compare_exchange_n((ptr), (expected), (desired), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+
+#elif defined(_MSC_VER)
+
+	#include <intrin.h>
+
+	#if defined(_WIN64)
+		#define threading_atomic_fetch_add(ptr, n) ((size_t)_InterlockedExchangeAdd64((volatile __int64 *)(ptr), (__int64)(n)))
+		#define threading_atomic_fetch_sub(ptr, n) ((size_t)_InterlockedExchangeAdd64((volatile __int64 *)(ptr), -((__int64)(n))))
+		#define threading_atomic_load(ptr)		   ((size_t)_InterlockedExchangeAdd64((volatile __int64 *)(ptr), 0))
+		#define threading_atomic_store(ptr, n)	   ((void)_InterlockedExchange64((volatile __int64 *)(ptr), (__int64)(n)))
+	#else
+		#define threading_atomic_fetch_add(ptr, n) ((size_t)_InterlockedExchangeAdd((volatile long *)(ptr), (long)(n)))
+		#define threading_atomic_fetch_sub(ptr, n) ((size_t)_InterlockedExchangeAdd((volatile long *)(ptr), -((long)(n))))
+		#define threading_atomic_load(ptr)		   ((size_t)_InterlockedExchangeAdd((volatile long *)(ptr), 0))
+		#define threading_atomic_store(ptr, n)	   ((void)_InterlockedExchange((volatile long *)(ptr), (long)(n)))
+	#endif
+
+static __forceinline int threading_atomic_compare_exchange_impl(volatile size_t *ptr, size_t *expected, size_t desired)
+{
+	#if defined(_WIN64)
+	size_t previous = (size_t)_InterlockedCompareExchange64((volatile __int64 *)ptr, (__int64)desired, (__int64)*expected);
+	#else
+	size_t previous = (size_t)_InterlockedCompareExchange((volatile long *)ptr, (long)desired, (long)*expected);
+	#endif
+
+	if (previous == *expected)
+	{
+		return 1;
+	}
+
+	*expected = previous;
+
+	return 0;
+}
+
+	/* Returns non zero when the exchange succeeded, otherwise the
+	current contents are written back into @expected */
+	#define threading_atomic_compare_exchange(ptr, expected, desired) \
+		threading_atomic_compare_exchange_impl((volatile size_t *)(ptr), (size_t *)(expected), (size_t)(desired))
+
+#else
+
+	/* Fall back to plain operations on platforms without known
+	intrinsics, matching the previous single threaded behavior */
+	#define threading_atomic_fetch_add(ptr, n) (((*(ptr)) += (n)) - (n))
+	#define threading_atomic_fetch_sub(ptr, n) (((*(ptr)) -= (n)) + (n))
+	#define threading_atomic_load(ptr)		   (*(ptr))
+	#define threading_atomic_store(ptr, n)	   ((void)((*(ptr)) = (n)))
+	#define threading_atomic_compare_exchange(ptr, expected, desired) \
+		((*(ptr) == *(expected)) ? ((void)(*(ptr) = (desired)), 1) : ((void)(*(expected) = *(ptr)), 0))
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREADING_ATOMIC_H */
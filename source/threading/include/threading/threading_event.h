@@ -0,0 +1,99 @@
+/*
+ *	Thrading Library by Parra Studios
+ *	A threading library providing utilities for lock-free data structures and more.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef THREADING_EVENT_H
+#define THREADING_EVENT_H 1
+
+/* -- Headers -- */
+
+#include <threading/threading_api.h>
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Forward Declarations -- */
+
+struct threading_event_type;
+
+/* -- Type Definitions -- */
+
+typedef struct threading_event_type *threading_event;
+
+/* -- Member Data -- */
+
+/* Caller owned binary event for one waiter and one signaler, built on
+futex word waits instead of a mutex and condition variable pair; it
+holds no resources so it can live on the stack and needs no
+destruction, the state must be treated as opaque */
+struct threading_event_type
+{
+	volatile uint32_t state;
+};
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Initialize the event to the non signaled state, it must not be
+*    waited on or signaled concurrently with the initialization
+*
+*  @param[in] e
+*    Pointer to the event
+*/
+THREADING_API void threading_event_initialize(threading_event e);
+
+/**
+*  @brief
+*    Block until the event is signaled and consume the signal, the
+*    wait spins briefly before parking in the kernel so a result that
+*    is already available costs no system call; only one thread may
+*    wait on the event at a time
+*
+*  @param[in] e
+*    Pointer to the event
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+THREADING_API int threading_event_wait(threading_event e);
+
+/**
+*  @brief
+*    Signal the event, waking the parked waiter if there is one or
+*    letting the next wait return immediately otherwise; the event
+*    must not be accessed by the signaler afterwards as the waiter
+*    owns the storage and may release it once woken
+*
+*  @param[in] e
+*    Pointer to the event
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+THREADING_API int threading_event_signal(threading_event e);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREADING_EVENT_H */
@@ -0,0 +1,88 @@
+/*
+ *	Thrading Library by Parra Studios
+ *	A threading library providing utilities for lock-free data structures and more.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef THREADING_MUTEX_H
+#define THREADING_MUTEX_H 1
+
+/* -- Headers -- */
+
+#include <threading/threading_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Forward Declarations -- */
+
+struct threading_mutex_type;
+
+/* -- Type Definitions -- */
+
+typedef struct threading_mutex_type *threading_mutex;
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Create a mutual exclusion lock depending on the platform
+*
+*  @return
+*    Pointer to the mutex on success, null otherwise
+*/
+THREADING_API threading_mutex threading_mutex_create(void);
+
+/**
+*  @brief
+*    Block until the mutex is acquired by the calling thread
+*
+*  @param[in] m
+*    Pointer to the mutex
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+THREADING_API int threading_mutex_lock(threading_mutex m);
+
+/**
+*  @brief
+*    Release the mutex previously acquired by the calling thread
+*
+*  @param[in] m
+*    Pointer to the mutex
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+THREADING_API int threading_mutex_unlock(threading_mutex m);
+
+/**
+*  @brief
+*    Destroy the mutex, it must not be locked by any thread
+*
+*  @param[in] m
+*    Pointer to the mutex
+*/
+THREADING_API void threading_mutex_destroy(threading_mutex m);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREADING_MUTEX_H */
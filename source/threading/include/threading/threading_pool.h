@@ -0,0 +1,193 @@
+/*
+ *	Thrading Library by Parra Studios
+ *	A threading library providing utilities for lock-free data structures and more.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef THREADING_POOL_H
+#define THREADING_POOL_H 1
+
+/* -- Headers -- */
+
+#include <threading/threading_api.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Forward Declarations -- */
+
+struct threading_pool_type;
+
+struct threading_pool_future_type;
+
+/* -- Type Definitions -- */
+
+typedef struct threading_pool_type *threading_pool;
+
+typedef struct threading_pool_future_type *threading_pool_future;
+
+typedef void *(*threading_pool_task_callback)(void *);
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Create a thread pool executing submitted tasks on a fixed set of worker threads
+*
+*  @param[in] size
+*    Number of worker threads, zero selects the number of logical processors
+*
+*  @return
+*    Pointer to the thread pool on success, null otherwise
+*/
+THREADING_API threading_pool threading_pool_create(size_t size);
+
+/**
+*  @brief
+*    Create a thread pool like @threading_pool_create but pinning each
+*    worker to one processor, interleaved across NUMA nodes when the
+*    topology is visible, so every node keeps local workers and the
+*    work they execute stays on local memory
+*
+*  @param[in] size
+*    Number of worker threads, zero selects the number of logical processors
+*
+*  @return
+*    Pointer to the thread pool on success, null otherwise
+*/
+THREADING_API threading_pool threading_pool_create_pinned(size_t size);
+
+/**
+*  @brief
+*    Pin the calling thread with the same node interleaved placement
+*    the pinned pool uses for its workers; runtime owned threads
+*    (event loops, interpreter pools) opt in with the index of their
+*    slot so they land next to the workers serving the same node
+*
+*  @param[in] index
+*    Placement slot of the calling thread
+*
+*  @return
+*    Zero on success, different from zero when pinning is unsupported or fails
+*/
+THREADING_API int threading_pool_thread_pin(size_t index);
+
+/**
+*  @brief
+*    Retrieve the number of worker threads of the pool
+*
+*  @param[in] p
+*    Pointer to the thread pool
+*
+*  @return
+*    Number of worker threads, zero if the pool is invalid
+*/
+THREADING_API size_t threading_pool_size(threading_pool p);
+
+/**
+*  @brief
+*    Submit a task to the pool, returning a future for awaiting its result
+*
+*  @param[in] p
+*    Pointer to the thread pool
+*
+*  @param[in] callback
+*    Task to be executed on a worker thread
+*
+*  @param[in] data
+*    Context passed to the task callback
+*
+*  @return
+*    Pointer to a future owned by the caller on success, null otherwise
+*/
+THREADING_API threading_pool_future threading_pool_submit(threading_pool p, threading_pool_task_callback callback, void *data);
+
+/**
+*  @brief
+*    Submit a fire and forget task to the pool, the result is discarded
+*
+*  @param[in] p
+*    Pointer to the thread pool
+*
+*  @param[in] callback
+*    Task to be executed on a worker thread
+*
+*  @param[in] data
+*    Context passed to the task callback
+*
+*  @return
+*    Zero on success, different from zero otherwise
+*/
+THREADING_API int threading_pool_post(threading_pool p, threading_pool_task_callback callback, void *data);
+
+/**
+*  @brief
+*    Block until the future is completed
+*
+*  @param[in] f
+*    Pointer to the future
+*
+*  @return
+*    Result returned by the task, null if the future is invalid or the task was dropped
+*/
+THREADING_API void *threading_pool_await(threading_pool_future f);
+
+/**
+*  @brief
+*    Block until the future is completed or the deadline expires
+*
+*  @param[in] f
+*    Pointer to the future
+*
+*  @param[in] timeout
+*    Deadline in milliseconds relative to the call
+*
+*  @param[out] result
+*    Pointer to the result returned by the task, set only on completion
+*
+*  @return
+*    Zero on completion, different from zero if the deadline expired
+*/
+THREADING_API int threading_pool_await_deadline(threading_pool_future f, uint64_t timeout, void **result);
+
+/**
+*  @brief
+*    Destroy the future, it can be awaited by at most one thread and destroyed once
+*
+*  @param[in] f
+*    Pointer to the future
+*/
+THREADING_API void threading_pool_future_destroy(threading_pool_future f);
+
+/**
+*  @brief
+*    Destroy the thread pool, pending tasks are drained by the workers before they exit
+*
+*  @param[in] p
+*    Pointer to the thread pool
+*/
+THREADING_API void threading_pool_destroy(threading_pool p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREADING_POOL_H */
@@ -0,0 +1,244 @@
+/*
+ *	Thrading Library by Parra Studios
+ *	A threading library providing utilities for lock-free data structures and more.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <threading/threading_event.h>
+
+#if defined(__linux__)
+	#include <linux/futex.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#elif defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+
+	#if defined(_MSC_VER)
+		#pragma comment(lib, "Synchronization.lib")
+	#endif
+#else
+	#include <pthread.h>
+#endif
+
+/* -- Definitions -- */
+
+/* Iterations spent polling the state before parking in the kernel,
+sized so a signaler running concurrently is caught without a system
+call while an idle waiter still parks quickly */
+#define THREADING_EVENT_SPIN_COUNT ((size_t)0x400)
+
+/* Event states */
+#define THREADING_EVENT_EMPTY	 UINT32_C(0)
+#define THREADING_EVENT_SIGNALED UINT32_C(1)
+#define THREADING_EVENT_PARKED	 UINT32_C(2)
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define threading_event_atomic_load(ptr)	  __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+	#define threading_event_atomic_exchange(ptr, desired) \
+		__atomic_exchange_n((ptr), (desired), __ATOMIC_ACQ_REL)
+	#define threading_event_atomic_compare_exchange(ptr, expected, desired) \
+		__atomic_compare_exchange_n((ptr), (expected), (desired), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+	#if defined(__i386__) || defined(__x86_64__)
+		#define threading_event_pause() __builtin_ia32_pause()
+	#else
+		#define threading_event_pause() \
+			do \
+			{ \
+			} while (0)
+	#endif
+#elif defined(_MSC_VER)
+	#include <intrin.h>
+
+	#define threading_event_atomic_load(ptr)			  ((uint32_t)_InterlockedOr((volatile long *)(ptr), 0))
+	#define threading_event_atomic_exchange(ptr, desired) ((uint32_t)_InterlockedExchange((volatile long *)(ptr), (long)(desired)))
+
+static __forceinline int threading_event_atomic_compare_exchange_impl(volatile uint32_t *ptr, uint32_t *expected, uint32_t desired)
+{
+	uint32_t previous = (uint32_t)_InterlockedCompareExchange((volatile long *)ptr, (long)desired, (long)*expected);
+
+	if (previous == *expected)
+	{
+		return 1;
+	}
+
+	*expected = previous;
+
+	return 0;
+}
+
+	#define threading_event_atomic_compare_exchange(ptr, expected, desired) \
+		threading_event_atomic_compare_exchange_impl((ptr), (expected), (desired))
+	#define threading_event_pause() YieldProcessor()
+#else
+	#define threading_event_atomic_load(ptr) (*(ptr))
+	#define threading_event_atomic_exchange(ptr, desired) \
+		threading_event_atomic_exchange_impl((ptr), (desired))
+
+static uint32_t threading_event_atomic_exchange_impl(volatile uint32_t *ptr, uint32_t desired)
+{
+	uint32_t previous = *ptr;
+
+	*ptr = desired;
+
+	return previous;
+}
+
+	#define threading_event_atomic_compare_exchange(ptr, expected, desired) \
+		((*(ptr) == *(expected)) ? ((void)(*(ptr) = (desired)), 1) : ((void)(*(expected) = *(ptr)), 0))
+	#define threading_event_pause() \
+		do \
+		{ \
+		} while (0)
+#endif
+
+/* -- Private Data -- */
+
+#if !defined(__linux__) && !defined(_WIN32)
+/* Platforms without a known futex word wait park every event on a
+shared condition variable instead; wakes broadcast and each waiter
+rechecks its own state word, the spin fast path still avoids this
+entirely when the signal arrives in time */
+static pthread_mutex_t threading_event_park_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t threading_event_park_cond = PTHREAD_COND_INITIALIZER;
+#endif
+
+/* -- Private Methods -- */
+
+static void threading_event_park(threading_event e)
+{
+#if defined(__linux__)
+	syscall(SYS_futex, &e->state, FUTEX_WAIT_PRIVATE, THREADING_EVENT_PARKED, NULL, NULL, 0);
+#elif defined(_WIN32)
+	uint32_t expected = THREADING_EVENT_PARKED;
+
+	WaitOnAddress((volatile void *)&e->state, &expected, sizeof(uint32_t), INFINITE);
+#else
+	pthread_mutex_lock(&threading_event_park_mutex);
+
+	while (threading_event_atomic_load(&e->state) == THREADING_EVENT_PARKED)
+	{
+		pthread_cond_wait(&threading_event_park_cond, &threading_event_park_mutex);
+	}
+
+	pthread_mutex_unlock(&threading_event_park_mutex);
+#endif
+}
+
+static void threading_event_unpark(threading_event e)
+{
+#if defined(__linux__)
+	syscall(SYS_futex, &e->state, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+#elif defined(_WIN32)
+	WakeByAddressSingle((void *)&e->state);
+#else
+	(void)e;
+
+	pthread_mutex_lock(&threading_event_park_mutex);
+
+	pthread_cond_broadcast(&threading_event_park_cond);
+
+	pthread_mutex_unlock(&threading_event_park_mutex);
+#endif
+}
+
+/* -- Methods -- */
+
+void threading_event_initialize(threading_event e)
+{
+	if (e != NULL)
+	{
+		e->state = THREADING_EVENT_EMPTY;
+	}
+}
+
+int threading_event_wait(threading_event e)
+{
+	size_t spin;
+
+	uint32_t expected;
+
+	if (e == NULL)
+	{
+		return 1;
+	}
+
+	/* Fast path, the signal arrives while polling so the wait never
+	enters the kernel */
+	for (spin = 0; spin < THREADING_EVENT_SPIN_COUNT; ++spin)
+	{
+		expected = THREADING_EVENT_SIGNALED;
+
+		if (threading_event_atomic_compare_exchange(&e->state, &expected, THREADING_EVENT_EMPTY))
+		{
+			return 0;
+		}
+
+		threading_event_pause();
+	}
+
+	/* Slow path, advertise the parked waiter so the signaler issues
+	a wake and wait on the state word itself */
+	for (;;)
+	{
+		expected = THREADING_EVENT_SIGNALED;
+
+		if (threading_event_atomic_compare_exchange(&e->state, &expected, THREADING_EVENT_EMPTY))
+		{
+			return 0;
+		}
+
+		expected = THREADING_EVENT_EMPTY;
+
+		threading_event_atomic_compare_exchange(&e->state, &expected, THREADING_EVENT_PARKED);
+
+		if (threading_event_atomic_load(&e->state) == THREADING_EVENT_PARKED)
+		{
+			threading_event_park(e);
+		}
+	}
+}
+
+int threading_event_signal(threading_event e)
+{
+	uint32_t previous;
+
+	if (e == NULL)
+	{
+		return 1;
+	}
+
+	previous = threading_event_atomic_exchange(&e->state, THREADING_EVENT_SIGNALED);
+
+	/* The wake is only paid when the waiter actually parked, a waiter
+	still in the spin phase observes the state change by itself */
+	if (previous == THREADING_EVENT_PARKED)
+	{
+		threading_event_unpark(e);
+	}
+
+	return 0;
+}
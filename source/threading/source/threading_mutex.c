@@ -0,0 +1,121 @@
+/*
+ *	Thrading Library by Parra Studios
+ *	A threading library providing utilities for lock-free data structures and more.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <threading/threading_mutex.h>
+
+#include <stdlib.h>
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+#else
+	#include <pthread.h>
+#endif
+
+/* -- Member Data -- */
+
+struct threading_mutex_type
+{
+#if defined(_WIN32)
+	CRITICAL_SECTION impl;
+#else
+	pthread_mutex_t impl;
+#endif
+};
+
+/* -- Methods -- */
+
+threading_mutex threading_mutex_create(void)
+{
+	threading_mutex m = malloc(sizeof(struct threading_mutex_type));
+
+	if (m == NULL)
+	{
+		return NULL;
+	}
+
+#if defined(_WIN32)
+	InitializeCriticalSection(&m->impl);
+#else
+	if (pthread_mutex_init(&m->impl, NULL) != 0)
+	{
+		free(m);
+
+		return NULL;
+	}
+#endif
+
+	return m;
+}
+
+int threading_mutex_lock(threading_mutex m)
+{
+	if (m == NULL)
+	{
+		return 1;
+	}
+
+#if defined(_WIN32)
+	EnterCriticalSection(&m->impl);
+
+	return 0;
+#else
+	return pthread_mutex_lock(&m->impl);
+#endif
+}
+
+int threading_mutex_unlock(threading_mutex m)
+{
+	if (m == NULL)
+	{
+		return 1;
+	}
+
+#if defined(_WIN32)
+	LeaveCriticalSection(&m->impl);
+
+	return 0;
+#else
+	return pthread_mutex_unlock(&m->impl);
+#endif
+}
+
+void threading_mutex_destroy(threading_mutex m)
+{
+	if (m != NULL)
+	{
+#if defined(_WIN32)
+		DeleteCriticalSection(&m->impl);
+#else
+		pthread_mutex_destroy(&m->impl);
+#endif
+
+		free(m);
+	}
+}
@@ -0,0 +1,916 @@
+/*
+ *	Thrading Library by Parra Studios
+ *	A threading library providing utilities for lock-free data structures and more.
+ *
+ *	Copyright (C) 2016 - 2021 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+	#define _GNU_SOURCE /* For pthread_setaffinity_np */
+#endif
+
+#include <threading/threading_pool.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <process.h>
+	#include <windows.h>
+#else
+	#include <errno.h>
+	#include <pthread.h>
+	#include <time.h>
+	#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+	#include <sched.h>
+#endif
+
+/* -- Definitions -- */
+
+#define THREADING_POOL_SIZE_DEFAULT 0x04
+
+/* -- Forward Declarations -- */
+
+struct threading_pool_task_type;
+
+/* -- Type Definitions -- */
+
+typedef struct threading_pool_task_type *threading_pool_task;
+
+/* -- Member Data -- */
+
+struct threading_pool_future_type
+{
+#if defined(_WIN32)
+	CRITICAL_SECTION lock;
+	CONDITION_VARIABLE cond;
+#else
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+#endif
+	int done;  /**< Non-zero once the task has been completed or dropped */
+	int refs;  /**< Shared between the owner and the executing task */
+	void *result;
+};
+
+struct threading_pool_task_type
+{
+	threading_pool_task_callback callback;
+	void *data;
+	threading_pool_future future;
+	threading_pool_task next;
+};
+
+struct threading_pool_type
+{
+#if defined(_WIN32)
+	CRITICAL_SECTION lock;
+	CONDITION_VARIABLE cond;
+	HANDLE *threads;
+#else
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	pthread_t *threads;
+#endif
+	threading_pool_task front; /**< Head of the pending task queue */
+	threading_pool_task back;  /**< Tail of the pending task queue */
+	int shutdown;
+	size_t size;
+};
+
+/* -- Private Methods -- */
+
+static size_t threading_pool_size_default(void);
+
+static threading_pool threading_pool_create_impl(size_t size, int pinned);
+
+#if defined(_WIN32)
+static int threading_pool_processor_pin(HANDLE thread, size_t index);
+#else
+static int threading_pool_processor_pin(pthread_t thread, size_t index);
+#endif
+
+static threading_pool_future threading_pool_future_create(void);
+
+static void threading_pool_future_complete(threading_pool_future f, void *result);
+
+static void threading_pool_future_release(threading_pool_future f);
+
+static int threading_pool_enqueue(threading_pool p, threading_pool_task_callback callback, void *data, threading_pool_future f);
+
+#if defined(_WIN32)
+static unsigned __stdcall threading_pool_worker(void *data);
+#else
+static void *threading_pool_worker(void *data);
+#endif
+
+/* -- Methods -- */
+
+size_t threading_pool_size_default(void)
+{
+#if defined(_WIN32)
+	SYSTEM_INFO info;
+
+	GetSystemInfo(&info);
+
+	return info.dwNumberOfProcessors > 0 ? (size_t)info.dwNumberOfProcessors : THREADING_POOL_SIZE_DEFAULT;
+#else
+	long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return processors > 0 ? (size_t)processors : THREADING_POOL_SIZE_DEFAULT;
+#endif
+}
+
+#if defined(__linux__)
+
+/* Number of NUMA nodes exposed through sysfs, one when the topology
+is not visible */
+static size_t threading_pool_node_count(void)
+{
+	size_t node;
+
+	for (node = 0;; ++node)
+	{
+		char path[0x40];
+
+		snprintf(path, sizeof(path), "/sys/devices/system/node/node%zu", node);
+
+		if (access(path, F_OK) != 0)
+		{
+			break;
+		}
+	}
+
+	return node > 0 ? node : 1;
+}
+
+/* The @index-th processor of NUMA node @node parsed from its sysfs
+cpulist (comma separated ranges), (size_t)-1 when it does not exist */
+static size_t threading_pool_node_cpu(size_t node, size_t index)
+{
+	char path[0x40];
+
+	FILE *file;
+
+	size_t count = 0;
+
+	snprintf(path, sizeof(path), "/sys/devices/system/node/node%zu/cpulist", node);
+
+	file = fopen(path, "r");
+
+	if (file == NULL)
+	{
+		return (size_t)-1;
+	}
+
+	for (;;)
+	{
+		size_t begin, end, cpu;
+
+		int separator;
+
+		if (fscanf(file, "%zu", &begin) != 1)
+		{
+			break;
+		}
+
+		end = begin;
+
+		separator = fgetc(file);
+
+		if (separator == '-')
+		{
+			if (fscanf(file, "%zu", &end) != 1)
+			{
+				break;
+			}
+
+			separator = fgetc(file);
+		}
+
+		for (cpu = begin; cpu <= end; ++cpu)
+		{
+			if (count == index)
+			{
+				fclose(file);
+
+				return cpu;
+			}
+
+			++count;
+		}
+
+		if (separator != ',')
+		{
+			break;
+		}
+	}
+
+	fclose(file);
+
+	return (size_t)-1;
+}
+
+#endif
+
+/* Pin @thread to one processor: slot @index lands on node
+(index % nodes), walking the processors of each node in order, so
+consecutive slots interleave across the nodes and every node keeps
+local workers */
+#if defined(_WIN32)
+int threading_pool_processor_pin(HANDLE thread, size_t index)
+{
+	SYSTEM_INFO info;
+
+	GetSystemInfo(&info);
+
+	if (info.dwNumberOfProcessors == 0)
+	{
+		return 1;
+	}
+
+	if (SetThreadAffinityMask(thread, (DWORD_PTR)1 << (index % info.dwNumberOfProcessors)) == 0)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+#else
+int threading_pool_processor_pin(pthread_t thread, size_t index)
+{
+	#if defined(__linux__)
+	{
+		size_t nodes = threading_pool_node_count();
+
+		size_t cpu = (size_t)-1;
+
+		cpu_set_t cpus;
+
+		if (nodes > 1)
+		{
+			cpu = threading_pool_node_cpu(index % nodes, index / nodes);
+		}
+
+		if (cpu == (size_t)-1)
+		{
+			long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+			cpu = processors > 0 ? index % (size_t)processors : index;
+		}
+
+		CPU_ZERO(&cpus);
+
+		CPU_SET((int)cpu, &cpus);
+
+		return pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpus) == 0 ? 0 : 1;
+	}
+	#else
+	{
+		/* Affinity is not portable beyond this */
+		(void)thread;
+		(void)index;
+
+		return 1;
+	}
+	#endif
+}
+#endif
+
+threading_pool_future threading_pool_future_create(void)
+{
+	threading_pool_future f = malloc(sizeof(struct threading_pool_future_type));
+
+	if (f == NULL)
+	{
+		return NULL;
+	}
+
+#if defined(_WIN32)
+	InitializeCriticalSection(&f->lock);
+
+	InitializeConditionVariable(&f->cond);
+#else
+	if (pthread_mutex_init(&f->lock, NULL) != 0)
+	{
+		free(f);
+
+		return NULL;
+	}
+
+	if (pthread_cond_init(&f->cond, NULL) != 0)
+	{
+		pthread_mutex_destroy(&f->lock);
+
+		free(f);
+
+		return NULL;
+	}
+#endif
+
+	f->done = 0;
+
+	/* One reference for the owner, one for the executing task */
+	f->refs = 2;
+
+	f->result = NULL;
+
+	return f;
+}
+
+void threading_pool_future_complete(threading_pool_future f, void *result)
+{
+#if defined(_WIN32)
+	EnterCriticalSection(&f->lock);
+
+	f->result = result;
+
+	f->done = 1;
+
+	WakeAllConditionVariable(&f->cond);
+
+	LeaveCriticalSection(&f->lock);
+#else
+	pthread_mutex_lock(&f->lock);
+
+	f->result = result;
+
+	f->done = 1;
+
+	pthread_cond_broadcast(&f->cond);
+
+	pthread_mutex_unlock(&f->lock);
+#endif
+}
+
+void threading_pool_future_release(threading_pool_future f)
+{
+	int refs;
+
+#if defined(_WIN32)
+	EnterCriticalSection(&f->lock);
+
+	refs = --f->refs;
+
+	LeaveCriticalSection(&f->lock);
+#else
+	pthread_mutex_lock(&f->lock);
+
+	refs = --f->refs;
+
+	pthread_mutex_unlock(&f->lock);
+#endif
+
+	if (refs == 0)
+	{
+#if defined(_WIN32)
+		DeleteCriticalSection(&f->lock);
+#else
+		pthread_cond_destroy(&f->cond);
+
+		pthread_mutex_destroy(&f->lock);
+#endif
+
+		free(f);
+	}
+}
+
+#if defined(_WIN32)
+unsigned __stdcall threading_pool_worker(void *data)
+#else
+void *threading_pool_worker(void *data)
+#endif
+{
+	threading_pool p = data;
+
+	for (;;)
+	{
+		threading_pool_task task;
+
+#if defined(_WIN32)
+		EnterCriticalSection(&p->lock);
+
+		while (p->front == NULL && p->shutdown == 0)
+		{
+			SleepConditionVariableCS(&p->cond, &p->lock, INFINITE);
+		}
+
+		if (p->front == NULL && p->shutdown != 0)
+		{
+			LeaveCriticalSection(&p->lock);
+
+			break;
+		}
+
+		task = p->front;
+
+		p->front = task->next;
+
+		if (p->front == NULL)
+		{
+			p->back = NULL;
+		}
+
+		LeaveCriticalSection(&p->lock);
+#else
+		pthread_mutex_lock(&p->lock);
+
+		while (p->front == NULL && p->shutdown == 0)
+		{
+			pthread_cond_wait(&p->cond, &p->lock);
+		}
+
+		if (p->front == NULL && p->shutdown != 0)
+		{
+			pthread_mutex_unlock(&p->lock);
+
+			break;
+		}
+
+		task = p->front;
+
+		p->front = task->next;
+
+		if (p->front == NULL)
+		{
+			p->back = NULL;
+		}
+
+		pthread_mutex_unlock(&p->lock);
+#endif
+
+		{
+			void *result = task->callback(task->data);
+
+			if (task->future != NULL)
+			{
+				threading_pool_future_complete(task->future, result);
+
+				threading_pool_future_release(task->future);
+			}
+
+			free(task);
+		}
+	}
+
+#if defined(_WIN32)
+	return 0;
+#else
+	return NULL;
+#endif
+}
+
+threading_pool threading_pool_create_impl(size_t size, int pinned)
+{
+	threading_pool p = malloc(sizeof(struct threading_pool_type));
+
+	size_t iterator;
+
+	if (p == NULL)
+	{
+		return NULL;
+	}
+
+	if (size == 0)
+	{
+		size = threading_pool_size_default();
+	}
+
+	p->front = NULL;
+
+	p->back = NULL;
+
+	p->shutdown = 0;
+
+	p->size = 0;
+
+#if defined(_WIN32)
+	p->threads = malloc(sizeof(HANDLE) * size);
+#else
+	p->threads = malloc(sizeof(pthread_t) * size);
+#endif
+
+	if (p->threads == NULL)
+	{
+		free(p);
+
+		return NULL;
+	}
+
+#if defined(_WIN32)
+	InitializeCriticalSection(&p->lock);
+
+	InitializeConditionVariable(&p->cond);
+#else
+	if (pthread_mutex_init(&p->lock, NULL) != 0)
+	{
+		free(p->threads);
+
+		free(p);
+
+		return NULL;
+	}
+
+	if (pthread_cond_init(&p->cond, NULL) != 0)
+	{
+		pthread_mutex_destroy(&p->lock);
+
+		free(p->threads);
+
+		free(p);
+
+		return NULL;
+	}
+#endif
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+#if defined(_WIN32)
+		p->threads[iterator] = (HANDLE)_beginthreadex(NULL, 0, &threading_pool_worker, p, 0, NULL);
+
+		if (p->threads[iterator] == NULL)
+#else
+		if (pthread_create(&p->threads[iterator], NULL, &threading_pool_worker, p) != 0)
+#endif
+		{
+			break;
+		}
+
+		if (pinned != 0)
+		{
+			/* Best effort, an unpinnable worker still serves the queue */
+			threading_pool_processor_pin(p->threads[iterator], p->size);
+		}
+
+		++p->size;
+	}
+
+	if (p->size == 0)
+	{
+		threading_pool_destroy(p);
+
+		return NULL;
+	}
+
+	return p;
+}
+
+threading_pool threading_pool_create(size_t size)
+{
+	return threading_pool_create_impl(size, 0);
+}
+
+threading_pool threading_pool_create_pinned(size_t size)
+{
+	return threading_pool_create_impl(size, 1);
+}
+
+int threading_pool_thread_pin(size_t index)
+{
+#if defined(_WIN32)
+	return threading_pool_processor_pin(GetCurrentThread(), index);
+#else
+	return threading_pool_processor_pin(pthread_self(), index);
+#endif
+}
+
+size_t threading_pool_size(threading_pool p)
+{
+	if (p == NULL)
+	{
+		return 0;
+	}
+
+	return p->size;
+}
+
+int threading_pool_enqueue(threading_pool p, threading_pool_task_callback callback, void *data, threading_pool_future f)
+{
+	threading_pool_task task = malloc(sizeof(struct threading_pool_task_type));
+
+	if (task == NULL)
+	{
+		return 1;
+	}
+
+	task->callback = callback;
+
+	task->data = data;
+
+	task->future = f;
+
+	task->next = NULL;
+
+#if defined(_WIN32)
+	EnterCriticalSection(&p->lock);
+
+	if (p->shutdown != 0)
+	{
+		LeaveCriticalSection(&p->lock);
+
+		free(task);
+
+		return 1;
+	}
+
+	if (p->back != NULL)
+	{
+		p->back->next = task;
+	}
+	else
+	{
+		p->front = task;
+	}
+
+	p->back = task;
+
+	WakeConditionVariable(&p->cond);
+
+	LeaveCriticalSection(&p->lock);
+#else
+	pthread_mutex_lock(&p->lock);
+
+	if (p->shutdown != 0)
+	{
+		pthread_mutex_unlock(&p->lock);
+
+		free(task);
+
+		return 1;
+	}
+
+	if (p->back != NULL)
+	{
+		p->back->next = task;
+	}
+	else
+	{
+		p->front = task;
+	}
+
+	p->back = task;
+
+	pthread_cond_signal(&p->cond);
+
+	pthread_mutex_unlock(&p->lock);
+#endif
+
+	return 0;
+}
+
+threading_pool_future threading_pool_submit(threading_pool p, threading_pool_task_callback callback, void *data)
+{
+	threading_pool_future f;
+
+	if (p == NULL || callback == NULL)
+	{
+		return NULL;
+	}
+
+	f = threading_pool_future_create();
+
+	if (f == NULL)
+	{
+		return NULL;
+	}
+
+	if (threading_pool_enqueue(p, callback, data, f) != 0)
+	{
+		/* Drop both references, the task will never run */
+		threading_pool_future_release(f);
+
+		threading_pool_future_release(f);
+
+		return NULL;
+	}
+
+	return f;
+}
+
+int threading_pool_post(threading_pool p, threading_pool_task_callback callback, void *data)
+{
+	if (p == NULL || callback == NULL)
+	{
+		return 1;
+	}
+
+	return threading_pool_enqueue(p, callback, data, NULL);
+}
+
+void *threading_pool_await(threading_pool_future f)
+{
+	void *result;
+
+	if (f == NULL)
+	{
+		return NULL;
+	}
+
+#if defined(_WIN32)
+	EnterCriticalSection(&f->lock);
+
+	while (f->done == 0)
+	{
+		SleepConditionVariableCS(&f->cond, &f->lock, INFINITE);
+	}
+
+	result = f->result;
+
+	LeaveCriticalSection(&f->lock);
+#else
+	pthread_mutex_lock(&f->lock);
+
+	while (f->done == 0)
+	{
+		pthread_cond_wait(&f->cond, &f->lock);
+	}
+
+	result = f->result;
+
+	pthread_mutex_unlock(&f->lock);
+#endif
+
+	return result;
+}
+
+int threading_pool_await_deadline(threading_pool_future f, uint64_t timeout, void **result)
+{
+	if (f == NULL)
+	{
+		return 1;
+	}
+
+#if defined(_WIN32)
+	{
+		ULONGLONG deadline = GetTickCount64() + timeout;
+
+		EnterCriticalSection(&f->lock);
+
+		while (f->done == 0)
+		{
+			ULONGLONG now = GetTickCount64();
+
+			if (now >= deadline)
+			{
+				LeaveCriticalSection(&f->lock);
+
+				return 1;
+			}
+
+			SleepConditionVariableCS(&f->cond, &f->lock, (DWORD)(deadline - now));
+		}
+
+		if (result != NULL)
+		{
+			*result = f->result;
+		}
+
+		LeaveCriticalSection(&f->lock);
+	}
+#else
+	{
+		struct timespec deadline;
+
+		clock_gettime(CLOCK_REALTIME, &deadline);
+
+		deadline.tv_sec += (time_t)(timeout / 1000);
+
+		deadline.tv_nsec += (long)(timeout % 1000) * 1000000L;
+
+		if (deadline.tv_nsec >= 1000000000L)
+		{
+			deadline.tv_sec += 1;
+
+			deadline.tv_nsec -= 1000000000L;
+		}
+
+		pthread_mutex_lock(&f->lock);
+
+		while (f->done == 0)
+		{
+			if (pthread_cond_timedwait(&f->cond, &f->lock, &deadline) == ETIMEDOUT && f->done == 0)
+			{
+				pthread_mutex_unlock(&f->lock);
+
+				return 1;
+			}
+		}
+
+		if (result != NULL)
+		{
+			*result = f->result;
+		}
+
+		pthread_mutex_unlock(&f->lock);
+	}
+#endif
+
+	return 0;
+}
+
+void threading_pool_future_destroy(threading_pool_future f)
+{
+	if (f != NULL)
+	{
+		threading_pool_future_release(f);
+	}
+}
+
+void threading_pool_destroy(threading_pool p)
+{
+	size_t iterator;
+
+	threading_pool_task task;
+
+	if (p == NULL)
+	{
+		return;
+	}
+
+#if defined(_WIN32)
+	EnterCriticalSection(&p->lock);
+
+	p->shutdown = 1;
+
+	WakeAllConditionVariable(&p->cond);
+
+	LeaveCriticalSection(&p->lock);
+#else
+	pthread_mutex_lock(&p->lock);
+
+	p->shutdown = 1;
+
+	pthread_cond_broadcast(&p->cond);
+
+	pthread_mutex_unlock(&p->lock);
+#endif
+
+	for (iterator = 0; iterator < p->size; ++iterator)
+	{
+#if defined(_WIN32)
+		WaitForSingleObject(p->threads[iterator], INFINITE);
+
+		CloseHandle(p->threads[iterator]);
+#else
+		pthread_join(p->threads[iterator], NULL);
+#endif
+	}
+
+	/* Workers drain the queue before exiting, anything left means no
+	worker ever started, complete it so awaiting threads do not block */
+	task = p->front;
+
+	while (task != NULL)
+	{
+		threading_pool_task next = task->next;
+
+		if (task->future != NULL)
+		{
+			threading_pool_future_complete(task->future, NULL);
+
+			threading_pool_future_release(task->future);
+		}
+
+		free(task);
+
+		task = next;
+	}
+
+#if defined(_WIN32)
+	DeleteCriticalSection(&p->lock);
+#else
+	pthread_cond_destroy(&p->cond);
+
+	pthread_mutex_destroy(&p->lock);
+#endif
+
+	free(p->threads);
+
+	free(p);
+}